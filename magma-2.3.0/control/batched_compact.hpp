@@ -0,0 +1,652 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_BATCHED_COMPACT_HPP
+#define MAGMA_BATCHED_COMPACT_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host batched engine for small matrices, used by magma_*_batched_cpu and
+    magma_*_vbatched_cpu.
+
+    Matrices of the same size are processed in groups of lanes, in the
+    "compact" layout: element (i,j) of the m-by-n matrix in lane l of a group
+    is at Ac[ (i + j*m)*lanes + l ], so each scalar operation of the
+    factorization becomes a loop over the lanes that the compiler vectorizes.
+    The kernels are templates on the matrix order NT; they are instantiated
+    for NT = 1, ..., magma_compact_nt_max, and NT = 0 is the instantiation
+    for a runtime order, used up to magma_compact_max_size.
+    Larger matrices are done one at a time by LAPACK.
+
+    Variable size batches are sorted into size classes, the matrices with the
+    same dimensions, and each class is split into groups of lanes.
+*******************************************************************************/
+
+/// largest order with a compile-time specialized kernel
+const magma_int_t magma_compact_nt_max  = 32;
+
+/// largest order done in the compact layout; larger ones are done by LAPACK
+const magma_int_t magma_compact_max_size = 64;
+
+
+/******************************************************************************/
+// lanes fill 64 bytes, one AVX-512 register or cache line.
+template< typename T > struct magma_compact_traits;
+
+template<> struct magma_compact_traits< double > {
+    typedef double real_t;
+    static const int lanes = 8;
+    static double make( double r ) { return r; }
+};
+
+template<> struct magma_compact_traits< float > {
+    typedef float real_t;
+    static const int lanes = 16;
+    static float make( float r ) { return r; }
+};
+
+template<> struct magma_compact_traits< magmaDoubleComplex > {
+    typedef double real_t;
+    static const int lanes = 4;
+    static magmaDoubleComplex make( double r ) { return MAGMA_Z_MAKE( r, 0 ); }
+};
+
+template<> struct magma_compact_traits< magmaFloatComplex > {
+    typedef float real_t;
+    static const int lanes = 8;
+    static magmaFloatComplex make( float r ) { return MAGMA_C_MAKE( r, 0 ); }
+};
+
+
+/***************************************************************************//**
+    Calls Kernel::run< NT >( n, args... ) for NT = n if n <= NTMAX,
+    else Kernel::run< 0 >( n, args... ).
+*******************************************************************************/
+template< int NT, typename Kernel >
+struct magma_compact_dispatch
+{
+    template< typename... Args >
+    static void run( magma_int_t n, Args... args )
+    {
+        if (n == NT)
+            Kernel::template run< NT >( n, args... );
+        else
+            magma_compact_dispatch< NT-1, Kernel >::run( n, args... );
+    }
+};
+
+template< typename Kernel >
+struct magma_compact_dispatch< 0, Kernel >
+{
+    template< typename... Args >
+    static void run( magma_int_t n, Args... args )
+    {
+        Kernel::template run< 0 >( n, args... );
+    }
+};
+
+
+/***************************************************************************//**
+    Copies op( A_l ), for the count matrices A_l = ptr[l] with leading
+    dimension ld[l], into the m-by-n compact matrix Ac, where op is
+    MagmaNoTrans, MagmaTrans, or MagmaConjTrans.
+    Unused lanes, l >= count, are set to the identity if identity is true,
+    else to zero, so the kernels run on them without exceptions.
+*******************************************************************************/
+template< typename T >
+void magma_compact_pack(
+    magma_trans_t op, magma_int_t m, magma_int_t n,
+    T* const* ptr, const magma_int_t* ld, magma_int_t count,
+    T* Ac, bool identity )
+{
+    typedef magma_compact_traits< T > traits;
+    const int L = traits::lanes;
+    const T zero = traits::make( 0 );
+    const T one  = traits::make( 1 );
+
+    // column j of Ac is column j of A_l, or row j for op != MagmaNoTrans,
+    // read with stride inc[l]
+    const T* col[ L ];
+    magma_int_t inc[ L ];
+    for (magma_int_t j = 0; j < n; ++j) {
+        for (magma_int_t l = 0; l < count; ++l) {
+            col[l] = (op == MagmaNoTrans ? ptr[l] + j*ld[l] : ptr[l] + j);
+            inc[l] = (op == MagmaNoTrans ? 1 : ld[l]);
+        }
+        T* a = Ac + j*m*L;
+        for (magma_int_t i = 0; i < m; ++i) {
+            if (op == MagmaConjTrans) {
+                for (magma_int_t l = 0; l < count; ++l)
+                    a[ i*L + l ] = conj( col[l][ i*inc[l] ] );
+            }
+            else {
+                for (magma_int_t l = 0; l < count; ++l)
+                    a[ i*L + l ] = col[l][ i*inc[l] ];
+            }
+            for (magma_int_t l = count; l < L; ++l)
+                a[ i*L + l ] = (identity && i == j ? one : zero);
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Copies the m-by-n compact matrix Ac back into the count matrices
+    A_l = ptr[l], such that op( A_l ) = Ac. Only the uplo part of Ac
+    (MagmaLower, MagmaUpper, or MagmaFull) is copied.
+*******************************************************************************/
+template< typename T >
+void magma_compact_unpack(
+    magma_trans_t op, magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    const T* Ac,
+    T* const* ptr, const magma_int_t* ld, magma_int_t count )
+{
+    const int L = magma_compact_traits< T >::lanes;
+
+    T* col[ L ];
+    magma_int_t inc[ L ];
+    for (magma_int_t j = 0; j < n; ++j) {
+        for (magma_int_t l = 0; l < count; ++l) {
+            col[l] = (op == MagmaNoTrans ? ptr[l] + j*ld[l] : ptr[l] + j);
+            inc[l] = (op == MagmaNoTrans ? 1 : ld[l]);
+        }
+        magma_int_t i0 = (uplo == MagmaLower ? j : 0);
+        magma_int_t i1 = (uplo == MagmaUpper ? min( j+1, m ) : m);
+        const T* a = Ac + j*m*L;
+        for (magma_int_t i = i0; i < i1; ++i) {
+            if (op == MagmaConjTrans) {
+                for (magma_int_t l = 0; l < count; ++l)
+                    col[l][ i*inc[l] ] = conj( a[ i*L + l ] );
+            }
+            else {
+                for (magma_int_t l = 0; l < count; ++l)
+                    col[l][ i*inc[l] ] = a[ i*L + l ];
+            }
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Groups of matrices of a batch: the matrices index[ start[g] : start[g+1] ]
+    of group g have the same dimensions. There are at most lanes matrices in
+    a group, and one if the matrices are larger than magma_compact_max_size.
+*******************************************************************************/
+struct magma_compact_groups
+{
+    std::vector< magma_int_t > index;
+    std::vector< magma_int_t > start;
+
+    magma_int_t size() const { return magma_int_t( start.size() ) - 1; }
+};
+
+/// Sorts the batch into size classes and splits them into groups of lanes.
+/// For a fixed size batch, m_array and n_array are NULL, and m and n give
+/// the dimensions; else n_array may equal m_array for square matrices.
+inline void magma_compact_make_groups(
+    magma_int_t batchCount, magma_int_t lanes,
+    magma_int_t m, magma_int_t n,
+    const magma_int_t* m_array, const magma_int_t* n_array,
+    magma_compact_groups& groups )
+{
+    groups.index.resize( batchCount );
+    groups.start.clear();
+    for (magma_int_t k = 0; k < batchCount; ++k) {
+        groups.index[k] = k;
+    }
+    if (m_array != NULL) {
+        std::stable_sort( groups.index.begin(), groups.index.end(),
+            [m_array, n_array]( magma_int_t a, magma_int_t b ) {
+                return m_array[a] < m_array[b]
+                       || (m_array[a] == m_array[b] && n_array[a] < n_array[b]);
+            });
+    }
+
+    magma_int_t k = 0;
+    while (k < batchCount) {
+        magma_int_t mk = (m_array ? m_array[ groups.index[k] ] : m);
+        magma_int_t nk = (n_array ? n_array[ groups.index[k] ] : n);
+        magma_int_t width = (mk > magma_compact_max_size || nk > magma_compact_max_size
+                             ? 1 : lanes);
+        groups.start.push_back( k );
+        magma_int_t kk = k + 1;
+        while (kk < batchCount && kk - k < width
+               && (m_array == NULL
+                   || (m_array[ groups.index[kk] ] == mk
+                       && n_array[ groups.index[kk] ] == nk)))
+        {
+            ++kk;
+        }
+        k = kk;
+    }
+    groups.start.push_back( batchCount );
+}
+
+
+/***************************************************************************//**
+    Runs func( idx, count, work ) on each group, over the OpenMP threads,
+    with LAPACK set to one thread. work is a per-thread std::vector< T >
+    that func may resize.
+*******************************************************************************/
+template< typename T, typename Func >
+void magma_compact_parallel_groups(
+    const magma_compact_groups& groups, Func func )
+{
+    magma_int_t ngroup  = groups.size();
+    magma_int_t nthread = min( magma_get_parallel_numthreads(), max( ngroup, 1 ));
+
+    magma_int_t mklth = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+
+    #pragma omp parallel num_threads( nthread )
+    {
+        std::vector< T > work;
+        #pragma omp for schedule( dynamic )
+        for (magma_int_t g = 0; g < ngroup; ++g) {
+            magma_int_t k = groups.start[g];
+            func( &groups.index[k], groups.start[g+1] - k, work );
+        }
+    }
+
+    magma_set_lapack_numthreads( mklth );
+}
+
+
+/***************************************************************************//**
+    Cholesky factorization A = L L^H of the n-by-n compact matrix A,
+    lower triangle only. info[l] is set to the first non-positive pivot of
+    lane l, as in LAPACK; that lane's factor is then unspecified.
+
+    Left-looking: each column is updated by dot products accumulated in
+    registers, two rows at a time, rather than updating the whole trailing
+    matrix in memory at each step.
+*******************************************************************************/
+template< typename T >
+struct magma_potrf_compact_kernel
+{
+    template< int NT >
+    static void run( magma_int_t n_, T* A, magma_int_t* info )
+    {
+        typedef magma_compact_traits< T > traits;
+        typedef typename traits::real_t real_t;
+        const int L = traits::lanes;
+        const magma_int_t n = (NT > 0 ? NT : n_);
+        #define A(i_, j_) (A + ((i_) + (j_)*n)*L)
+
+        T s0[ L ], s1[ L ];
+        real_t rdiag[ L ];
+        for (magma_int_t j = 0; j < n; ++j) {
+            // A(j:n, j) -= A(j:n, 0:j) A(j, 0:j)^H
+            magma_int_t i = j;
+            for (; i+1 < n; i += 2) {
+                T* a0 = A(i,  j);
+                T* a1 = A(i+1,j);
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    s0[l] = a0[l];
+                    s1[l] = a1[l];
+                }
+                for (magma_int_t k = 0; k < j; ++k) {
+                    const T* ajk = A(j,  k);
+                    const T* b0  = A(i,  k);
+                    const T* b1  = A(i+1,k);
+                    #pragma omp simd
+                    for (int l = 0; l < L; ++l) {
+                        T c = conj( ajk[l] );
+                        s0[l] -= b0[l] * c;
+                        s1[l] -= b1[l] * c;
+                    }
+                }
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    a0[l] = s0[l];
+                    a1[l] = s1[l];
+                }
+            }
+            if (i < n) {
+                T* a0 = A(i,j);
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    s0[l] = a0[l];
+                }
+                for (magma_int_t k = 0; k < j; ++k) {
+                    const T* ajk = A(j,k);
+                    const T* b0  = A(i,k);
+                    #pragma omp simd
+                    for (int l = 0; l < L; ++l) {
+                        s0[l] -= b0[l] * conj( ajk[l] );
+                    }
+                }
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    a0[l] = s0[l];
+                }
+            }
+
+            // A(j,j) = sqrt( A(j,j) ), A(j+1:n, j) /= A(j,j)
+            T* ajj = A(j,j);
+            for (int l = 0; l < L; ++l) {
+                real_t d = real( ajj[l] );
+                if (! (d > 0)) {
+                    if (info[l] == 0)
+                        info[l] = j+1;
+                    d = 1;
+                }
+                d = sqrt( d );
+                ajj[l]   = traits::make( d );
+                rdiag[l] = 1 / d;
+            }
+            for (magma_int_t i = j+1; i < n; ++i) {
+                T* aij = A(i,j);
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    aij[l] *= rdiag[l];
+                }
+            }
+        }
+        #undef A
+    }
+};
+
+
+/***************************************************************************//**
+    LU factorization with partial pivoting of the m-by-n compact matrix A,
+    as in LAPACK getf2. ipiv holds min(m,n) compact pivots, 1-based;
+    info[l] is set to the first zero pivot of lane l.
+    The specialized instantiations NT > 0 are for m = n = NT.
+*******************************************************************************/
+template< typename T >
+struct magma_getrf_compact_kernel
+{
+    template< int NT >
+    static void run( magma_int_t m_, magma_int_t n_, T* A, magma_int_t* ipiv, magma_int_t* info )
+    {
+        typedef magma_compact_traits< T > traits;
+        typedef typename traits::real_t real_t;
+        const int L = traits::lanes;
+        const magma_int_t m = (NT > 0 ? NT : m_);
+        const magma_int_t n = (NT > 0 ? NT : n_);
+        const T one = traits::make( 1 );
+        #define A(i_, j_) (A + ((i_) + (j_)*m)*L)
+
+        magma_int_t piv[ L ];
+        real_t amax[ L ];
+        T rpiv[ L ];
+        for (magma_int_t j = 0; j < min( m, n ); ++j) {
+            // find pivot
+            const T* ajj = A(j,j);
+            for (int l = 0; l < L; ++l) {
+                piv[l]  = j;
+                amax[l] = abs1( ajj[l] );
+            }
+            for (magma_int_t i = j+1; i < m; ++i) {
+                const T* aij = A(i,j);
+                for (int l = 0; l < L; ++l) {
+                    real_t a = abs1( aij[l] );
+                    if (a > amax[l]) {
+                        amax[l] = a;
+                        piv[l]  = i;
+                    }
+                }
+            }
+
+            // swap rows j and piv in each lane
+            for (int l = 0; l < L; ++l) {
+                ipiv[ j*L + l ] = piv[l] + 1;
+                if (piv[l] != j) {
+                    for (magma_int_t k = 0; k < n; ++k) {
+                        T tmp = A(j,k)[l];
+                        A(j,k)[l] = A(piv[l],k)[l];
+                        A(piv[l],k)[l] = tmp;
+                    }
+                }
+            }
+
+            // scale column; a zero pivot leaves a zero column
+            for (int l = 0; l < L; ++l) {
+                if (amax[l] == 0) {
+                    if (info[l] == 0)
+                        info[l] = j+1;
+                    rpiv[l] = one;
+                }
+                else {
+                    rpiv[l] = one / ajj[l];
+                }
+            }
+            for (magma_int_t i = j+1; i < m; ++i) {
+                T* aij = A(i,j);
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    aij[l] *= rpiv[l];
+                }
+            }
+
+            // rank-1 update of trailing matrix, two columns at a time
+            magma_int_t k = j+1;
+            for (; k+1 < n; k += 2) {
+                T ajk0[ L ], ajk1[ L ];
+                for (int l = 0; l < L; ++l) {
+                    ajk0[l] = A(j,k  )[l];
+                    ajk1[l] = A(j,k+1)[l];
+                }
+                for (magma_int_t i = j+1; i < m; ++i) {
+                    const T* __restrict__ aij = A(i,j);
+                    T* __restrict__ aik0 = A(i,k);
+                    T* __restrict__ aik1 = A(i,k+1);
+                    #pragma omp simd
+                    for (int l = 0; l < L; ++l) {
+                        aik0[l] -= aij[l] * ajk0[l];
+                        aik1[l] -= aij[l] * ajk1[l];
+                    }
+                }
+            }
+            for (; k < n; ++k) {
+                T ajk0[ L ];
+                for (int l = 0; l < L; ++l) {
+                    ajk0[l] = A(j,k)[l];
+                }
+                for (magma_int_t i = j+1; i < m; ++i) {
+                    const T* __restrict__ aij = A(i,j);
+                    T* __restrict__ aik0 = A(i,k);
+                    #pragma omp simd
+                    for (int l = 0; l < L; ++l) {
+                        aik0[l] -= aij[l] * ajk0[l];
+                    }
+                }
+            }
+        }
+        #undef A
+    }
+};
+
+
+/***************************************************************************//**
+    QR factorization of the m-by-n compact matrix A by Householder
+    reflectors, as in LAPACK geqr2. tau holds min(m,n) compact scalars.
+    The reflectors are generated as in larfg, without its rescaling of
+    vectors with tiny norms.
+    The specialized instantiations NT > 0 are for m = n = NT.
+*******************************************************************************/
+template< typename T >
+struct magma_geqrf_compact_kernel
+{
+    template< int NT >
+    static void run( magma_int_t m_, magma_int_t n_, T* A, T* tau )
+    {
+        typedef magma_compact_traits< T > traits;
+        typedef typename traits::real_t real_t;
+        const int L = traits::lanes;
+        const magma_int_t m = (NT > 0 ? NT : m_);
+        const magma_int_t n = (NT > 0 ? NT : n_);
+        const T one = traits::make( 1 );
+        #define A(i_, j_) (A + ((i_) + (j_)*m)*L)
+
+        real_t xnorm[ L ];
+        T scal[ L ], w[ L ];
+        for (magma_int_t j = 0; j < min( m, n ); ++j) {
+            // generate reflector H(j) to annihilate A(j+1:m, j)
+            for (int l = 0; l < L; ++l) {
+                xnorm[l] = 0;
+            }
+            for (magma_int_t i = j+1; i < m; ++i) {
+                const T* aij = A(i,j);
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    xnorm[l] += real( aij[l] )*real( aij[l] ) + imag( aij[l] )*imag( aij[l] );
+                }
+            }
+            T* ajj  = A(j,j);
+            T* tauj = tau + j*L;
+            for (int l = 0; l < L; ++l) {
+                real_t ar = real( ajj[l] );
+                real_t ai = imag( ajj[l] );
+                if (xnorm[l] == 0 && ai == 0) {
+                    tauj[l] = traits::make( 0 );
+                    scal[l] = one;
+                }
+                else {
+                    real_t beta = -copysign( sqrt( ar*ar + ai*ai + xnorm[l] ), ar );
+                    tauj[l] = traits::make( (beta - ar) / beta ) - ( ajj[l] - traits::make( ar ) ) / beta;
+                    scal[l] = one / (ajj[l] - beta);
+                    ajj[l]  = traits::make( beta );
+                }
+            }
+            for (magma_int_t i = j+1; i < m; ++i) {
+                T* aij = A(i,j);
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    aij[l] *= scal[l];
+                }
+            }
+
+            // apply H(j)^H = I - conj(tau) v v^H to A(j:m, j+1:n) from the left
+            for (magma_int_t k = j+1; k < n; ++k) {
+                T* ajk = A(j,k);
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    w[l] = ajk[l];
+                }
+                for (magma_int_t i = j+1; i < m; ++i) {
+                    const T* aij = A(i,j);
+                    const T* aik = A(i,k);
+                    #pragma omp simd
+                    for (int l = 0; l < L; ++l) {
+                        w[l] += conj( aij[l] ) * aik[l];
+                    }
+                }
+                #pragma omp simd
+                for (int l = 0; l < L; ++l) {
+                    w[l]   *= conj( tauj[l] );
+                    ajk[l] -= w[l];
+                }
+                for (magma_int_t i = j+1; i < m; ++i) {
+                    const T* aij = A(i,j);
+                    T* aik = A(i,k);
+                    #pragma omp simd
+                    for (int l = 0; l < L; ++l) {
+                        aik[l] -= aij[l] * w[l];
+                    }
+                }
+            }
+        }
+        #undef A
+    }
+};
+
+
+/***************************************************************************//**
+    Solves op( A ) X = B for the m-by-m triangular compact matrix A and the
+    m-by-n compact matrix B, overwriting B, where op( A ) is A for
+    trans = MagmaNoTrans, else A^T. Conjugation, alpha, and the right side
+    case are done by the caller when packing.
+    The specialized instantiations NT > 0 are for m = NT.
+*******************************************************************************/
+template< typename T >
+struct magma_trsm_compact_kernel
+{
+    template< int NT >
+    static void run(
+        magma_int_t m_, magma_uplo_t uplo, magma_trans_t trans, magma_diag_t diag,
+        magma_int_t n, const T* A, T* B, T* invd )
+    {
+        typedef magma_compact_traits< T > traits;
+        const int L = traits::lanes;
+        const magma_int_t m = (NT > 0 ? NT : m_);
+        const T one = traits::make( 1 );
+        #define A(i_, j_) (A + ((i_) + (j_)*m)*L)
+        #define B(i_, j_) (B + ((i_) + (j_)*m)*L)
+
+        bool nounit = (diag == MagmaNonUnit);
+        if (nounit) {
+            for (magma_int_t j = 0; j < m; ++j) {
+                const T* ajj = A(j,j);
+                for (int l = 0; l < L; ++l) {
+                    invd[ j*L + l ] = one / ajj[l];
+                }
+            }
+        }
+
+        bool forward = ((uplo == MagmaLower) == (trans == MagmaNoTrans));
+        for (magma_int_t c = 0; c < n; ++c) {
+            for (magma_int_t jj = 0; jj < m; ++jj) {
+                magma_int_t j = (forward ? jj : m-1-jj);
+                T* bj = B(j,c);
+                if (trans == MagmaNoTrans) {
+                    // axpy: B(i,c) -= A(i,j) B(j,c) for i below (lower) or above (upper) j
+                    if (nounit) {
+                        #pragma omp simd
+                        for (int l = 0; l < L; ++l) {
+                            bj[l] *= invd[ j*L + l ];
+                        }
+                    }
+                    magma_int_t i0 = (forward ? j+1 : 0);
+                    magma_int_t i1 = (forward ? m   : j);
+                    for (magma_int_t i = i0; i < i1; ++i) {
+                        const T* aij = A(i,j);
+                        T* bi = B(i,c);
+                        #pragma omp simd
+                        for (int l = 0; l < L; ++l) {
+                            bi[l] -= aij[l] * bj[l];
+                        }
+                    }
+                }
+                else {
+                    // dot: B(j,c) -= sum A(i,j) B(i,c) for i already solved
+                    magma_int_t i0 = (forward ? 0 : j+1);
+                    magma_int_t i1 = (forward ? j : m  );
+                    for (magma_int_t i = i0; i < i1; ++i) {
+                        const T* aij = A(i,j);
+                        const T* bi  = B(i,c);
+                        #pragma omp simd
+                        for (int l = 0; l < L; ++l) {
+                            bj[l] -= aij[l] * bi[l];
+                        }
+                    }
+                    if (nounit) {
+                        #pragma omp simd
+                        for (int l = 0; l < L; ++l) {
+                            bj[l] *= invd[ j*L + l ];
+                        }
+                    }
+                }
+            }
+        }
+        #undef A
+        #undef B
+    }
+};
+
+#endif        //  #ifndef MAGMA_BATCHED_COMPACT_HPP
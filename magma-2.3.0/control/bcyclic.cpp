@@ -0,0 +1,260 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+#include "magma_internal.h"
+
+// Index queries for the 2D block-cyclic distribution, magma_bcyclic_t.
+// Tile (ti, tj) is on grid row ti % p and grid column tj % q, i.e., on
+// participant (ti % p) + (tj % q)*p, at local tile (ti / p, tj / q).
+// Each participant's tiles are stored, in global order, in one local
+// column-major matrix, so the part of any global submatrix that a
+// participant owns is a single local submatrix; see
+// magma_bcyclic_local_range. A 1D column layout is p = 1, q = ngpu, and
+// a 1D row layout is p = ngpu, q = 1, as in magma_zsetmatrix_1D_col_bcyclic
+// and magma_zsetmatrix_1D_row_bcyclic.
+
+
+/***************************************************************************//**
+    Returns the number of rows (or columns) of an n-row matrix, distributed
+    1D block cyclic in blocks of nb over nprocs participants, that are on
+    participant iproc, as ScaLAPACK's numroc. Equivalently, the local index
+    that global index n maps to on iproc.
+
+    Example with n = 75, nb = 10, nprocs = 3: 30 on iproc 0, 25 on iproc 1
+    (global 10-19, 40-49, 70-74), and 20 on iproc 2.
+
+    @param[in]  n       Number of rows. n >= 0.
+    @param[in]  nb      Block size. nb > 0.
+    @param[in]  iproc   Participant, 0 <= iproc < nprocs.
+    @param[in]  nprocs  Number of participants. nprocs > 0.
+
+    @return Number of rows on iproc.
+
+    @ingroup magma_bcyclic
+*******************************************************************************/
+extern "C" magma_int_t
+magma_bcyclic_numroc(
+    magma_int_t n, magma_int_t nb, magma_int_t iproc, magma_int_t nprocs )
+{
+    magma_int_t nblocks = n / nb;
+    magma_int_t nloc    = (nblocks / nprocs)*nb;
+    magma_int_t extra   = nblocks % nprocs;
+    if (iproc < extra)
+        nloc += nb;
+    else if (iproc == extra)
+        nloc += n % nb;
+    return nloc;
+}
+
+
+/***************************************************************************//**
+    Chooses a p-by-q grid for nprocs participants, as square as possible,
+    with p <= q and p*q = nprocs. A 2D grid spreads each block column, and
+    so the panel, over p participants, where a 1D column layout puts it
+    on one.
+
+    @param[in]  nprocs  Number of participants. nprocs > 0.
+    @param[out] p       Number of grid rows.
+    @param[out] q       Number of grid columns.
+
+    @ingroup magma_bcyclic
+*******************************************************************************/
+extern "C" void
+magma_bcyclic_grid(
+    magma_int_t nprocs, magma_int_t *p, magma_int_t *q )
+{
+    magma_int_t pp = magma_int_t( sqrt( double(nprocs) ));
+    while (pp > 1 && nprocs % pp != 0) {
+        pp -= 1;
+    }
+    *p = max( 1, pp );
+    *q = nprocs / *p;
+}
+
+
+/***************************************************************************//**
+    Initializes the descriptor of an m-by-n matrix distributed 2D block
+    cyclic in mb-by-nb tiles over a p-by-q grid. The local leading dimension
+    is the local rows of participant 0, which has the most, rounded up to a
+    multiple of 32. Participant d needs desc->ldd * nloc elements, with nloc
+    from magma_bcyclic_local_size.
+
+    @param[out] desc    The descriptor.
+    @param[in]  m       Number of rows.    m >= 0.
+    @param[in]  n       Number of columns. n >= 0.
+    @param[in]  mb      Number of rows    in a tile. mb > 0.
+    @param[in]  nb      Number of columns in a tile. nb > 0.
+    @param[in]  p       Number of grid rows.    p > 0.
+    @param[in]  q       Number of grid columns. q > 0.
+
+    @return info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_bcyclic
+*******************************************************************************/
+extern "C" magma_int_t
+magma_bcyclic_init(
+    magma_bcyclic_t *desc,
+    magma_int_t m, magma_int_t n, magma_int_t mb, magma_int_t nb,
+    magma_int_t p, magma_int_t q )
+{
+    magma_int_t info = 0;
+    if (desc == NULL)
+        info = -1;
+    else if (m < 0)
+        info = -2;
+    else if (n < 0)
+        info = -3;
+    else if (mb < 1)
+        info = -4;
+    else if (nb < 1)
+        info = -5;
+    else if (p < 1)
+        info = -6;
+    else if (q < 1)
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    desc->m   = m;
+    desc->n   = n;
+    desc->mb  = mb;
+    desc->nb  = nb;
+    desc->p   = p;
+    desc->q   = q;
+    desc->ldd = magma_roundup( max( 1, magma_bcyclic_numroc( m, mb, 0, p )), 32 );
+    return info;
+}
+
+
+/***************************************************************************//**
+    Returns the participant that owns element (i, j).
+
+    @param[in]  desc    The descriptor.
+    @param[in]  i       Global row,    0 <= i < desc->m.
+    @param[in]  j       Global column, 0 <= j < desc->n.
+
+    @return Participant d, 0 <= d < p*q.
+
+    @ingroup magma_bcyclic
+*******************************************************************************/
+extern "C" magma_int_t
+magma_bcyclic_owner(
+    const magma_bcyclic_t *desc, magma_int_t i, magma_int_t j )
+{
+    return (i / desc->mb) % desc->p
+         + ((j / desc->nb) % desc->q) * desc->p;
+}
+
+
+/***************************************************************************//**
+    Converts global indices (i, j) to the owner and local indices there.
+
+    @param[in]  desc    The descriptor.
+    @param[in]  i       Global row,    0 <= i < desc->m.
+    @param[in]  j       Global column, 0 <= j < desc->n.
+    @param[out] dev     Participant that owns (i, j).
+    @param[out] il      Local row on dev.
+    @param[out] jl      Local column on dev.
+
+    @ingroup magma_bcyclic
+*******************************************************************************/
+extern "C" void
+magma_bcyclic_local_index(
+    const magma_bcyclic_t *desc, magma_int_t i, magma_int_t j,
+    magma_int_t *dev, magma_int_t *il, magma_int_t *jl )
+{
+    magma_int_t mb = desc->mb, nb = desc->nb;
+    *dev = magma_bcyclic_owner( desc, i, j );
+    *il  = (i / (mb*desc->p))*mb + i % mb;
+    *jl  = (j / (nb*desc->q))*nb + j % nb;
+}
+
+
+/***************************************************************************//**
+    Converts local indices (il, jl) on participant dev to global indices.
+
+    @param[in]  desc    The descriptor.
+    @param[in]  dev     Participant, 0 <= dev < p*q.
+    @param[in]  il      Local row on dev.
+    @param[in]  jl      Local column on dev.
+    @param[out] i       Global row.
+    @param[out] j       Global column.
+
+    @ingroup magma_bcyclic
+*******************************************************************************/
+extern "C" void
+magma_bcyclic_global_index(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t il, magma_int_t jl,
+    magma_int_t *i, magma_int_t *j )
+{
+    magma_int_t mb = desc->mb, nb = desc->nb;
+    magma_int_t pr = dev % desc->p;
+    magma_int_t pc = dev / desc->p;
+    *i = ((il / mb)*desc->p + pr)*mb + il % mb;
+    *j = ((jl / nb)*desc->q + pc)*nb + jl % nb;
+}
+
+
+/***************************************************************************//**
+    Returns the size of the local matrix on participant dev.
+
+    @param[in]  desc    The descriptor.
+    @param[in]  dev     Participant, 0 <= dev < p*q.
+    @param[out] mloc    Local rows on dev.
+    @param[out] nloc    Local columns on dev.
+
+    @ingroup magma_bcyclic
+*******************************************************************************/
+extern "C" void
+magma_bcyclic_local_size(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t *mloc, magma_int_t *nloc )
+{
+    *mloc = magma_bcyclic_numroc( desc->m, desc->mb, dev % desc->p, desc->p );
+    *nloc = magma_bcyclic_numroc( desc->n, desc->nb, dev / desc->p, desc->q );
+}
+
+
+/***************************************************************************//**
+    Returns the part of the global m-by-n submatrix A(i:i+m-1, j:j+n-1) that
+    is on participant dev, which is the local submatrix starting at (il, jl)
+    of size mloc-by-nloc; mloc or nloc is 0 if dev owns none of it.
+    Generalizes magma_indices_1D_bcyclic to 2D.
+
+    @param[in]  desc    The descriptor.
+    @param[in]  dev     Participant, 0 <= dev < p*q.
+    @param[in]  i       First global row of the submatrix.
+    @param[in]  j       First global column of the submatrix.
+    @param[in]  m       Rows    of the submatrix. 0 <= i+m <= desc->m.
+    @param[in]  n       Columns of the submatrix. 0 <= j+n <= desc->n.
+    @param[out] il      First local row on dev.
+    @param[out] jl      First local column on dev.
+    @param[out] mloc    Local rows on dev.
+    @param[out] nloc    Local columns on dev.
+
+    @ingroup magma_bcyclic
+*******************************************************************************/
+extern "C" void
+magma_bcyclic_local_range(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magma_int_t *il, magma_int_t *jl, magma_int_t *mloc, magma_int_t *nloc )
+{
+    // global rows before i, and before i+m, owned by grid row pr
+    magma_int_t pr = dev % desc->p;
+    magma_int_t pc = dev / desc->p;
+    *il   = magma_bcyclic_numroc( i,   desc->mb, pr, desc->p );
+    *mloc = magma_bcyclic_numroc( i+m, desc->mb, pr, desc->p ) - *il;
+    *jl   = magma_bcyclic_numroc( j,   desc->nb, pc, desc->q );
+    *nloc = magma_bcyclic_numroc( j+n, desc->nb, pc, desc->q ) - *jl;
+}
@@ -0,0 +1,359 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_CONVERT_HOST_HPP
+#define MAGMA_CONVERT_HOST_HPP
+
+// STL headers first; if a caller already included magma_internal.h,
+// its min, max macros are lifted around them
+#pragma push_macro("min")
+#pragma push_macro("max")
+#undef min
+#undef max
+#include <stdint.h>
+#include <string.h>
+#include <limits>
+#pragma pop_macro("max")
+#pragma pop_macro("min")
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host precision-conversion engine, used by magma_*lag2*_cpu,
+    magma_*lat2*_cpu, magma_slag2h_cpu and friends, and the host backend's
+    magmablas_*lag2* and *lat2*.
+
+    A complex matrix is converted as a real one: its column of m elements
+    is 2m contiguous reals. Columns, or the part of each column inside the
+    triangle for *lat2*, are converted in parallel, each in one pass that
+    also checks the range, so A is read once. With AVX, double <-> single
+    use vcvtpd2ps and vcvtps2pd; with F16C, single <-> half use vcvtps2ph
+    and vcvtph2ps; otherwise, and for bfloat16, the compiler vectorizes
+    the scalar conversions below.
+
+    As in LAPACK's dlag2s, an entry is out of range if it is greater than
+    the largest finite value of the target in magnitude; NaN is not.
+    Out-of-range entries are still converted, rounding to +-Inf (or to the
+    largest finite value, within half an ulp of it). Only columns that
+    have one are scanned again, to find the first, in column-major order;
+    its offset i + j*lda is returned.
+*******************************************************************************/
+
+/// number of elements below which a conversion runs on one thread
+const magma_int_t magma_convert_nb_parallel = 65536;
+
+
+/******************************************************************************/
+// IEEE binary16 and bfloat16 to and from single, rounding to nearest even.
+// Used where F16C is not available, for the tails of F16C loops, and
+// for bfloat16, where the loops vectorize as integer operations.
+static inline magmaHalf convert_host_s2h( float x )
+{
+    uint32_t u;
+    memcpy( &u, &x, sizeof(u) );
+    uint32_t sign = (u >> 16) & 0x8000;
+    uint32_t a = u & 0x7fffffff;
+    if (a >= 0x7f800000) {
+        // Inf, or NaN kept quiet with the high bits of its payload
+        return magmaHalf( sign | 0x7c00 | (a > 0x7f800000 ? 0x0200 | ((a >> 13) & 0x03ff) : 0) );
+    }
+    if (a >= 0x477ff000) {
+        // >= 65520 rounds to Inf
+        return magmaHalf( sign | 0x7c00 );
+    }
+    if (a < 0x38800000) {
+        // below 2^-14, a subnormal half: adding 0.5 rounds to a multiple
+        // of 2^-24, the half ulp, which is then in the low mantissa bits
+        float f;
+        memcpy( &f, &a, sizeof(f) );
+        f += 0.5f;
+        memcpy( &a, &f, sizeof(a) );
+        return magmaHalf( sign | (a - 0x3f000000) );
+    }
+    // normal: rebias exponent by 127 - 15, round mantissa to 10 bits
+    a += 0xc8000fff + ((a >> 13) & 1);
+    return magmaHalf( sign | (a >> 13) );
+}
+
+static inline float convert_host_h2s( magmaHalf h )
+{
+    uint32_t sign = uint32_t( h & 0x8000 ) << 16;
+    uint32_t a = h & 0x7fff;
+    uint32_t u;
+    if (a > 0x7c00) {
+        u = 0x7fc00000 | ((a & 0x03ff) << 13);  // NaN, made quiet as by F16C
+    }
+    else if (a == 0x7c00) {
+        u = 0x7f800000;                         // Inf
+    }
+    else if (a >= 0x0400) {
+        u = (a << 13) + 0x38000000;             // normal
+    }
+    else {
+        float f = float( a ) * 5.9604644775390625e-08f;  // a * 2^-24, subnormal or zero
+        memcpy( &u, &f, sizeof(u) );
+    }
+    u |= sign;
+    float x;
+    memcpy( &x, &u, sizeof(x) );
+    return x;
+}
+
+static inline magmaBfloat16 convert_host_s2bf( float x )
+{
+    uint32_t u;
+    memcpy( &u, &x, sizeof(u) );
+    // NaN is kept quiet; otherwise round the low 16 bits to nearest even
+    uint32_t r = ((u & 0x7fffffff) > 0x7f800000)
+               ? (u >> 16) | 0x0040
+               : (u + 0x7fff + ((u >> 16) & 1)) >> 16;
+    return magmaBfloat16( r );
+}
+
+static inline float convert_host_bf2s( magmaBfloat16 h )
+{
+    uint32_t u = uint32_t( h ) << 16;
+    float x;
+    memcpy( &x, &u, sizeof(x) );
+    return x;
+}
+
+
+/******************************************************************************/
+// Tags for the 16-bit formats, which share a storage type.
+struct convert_host_half     { typedef magmaHalf     type; };
+struct convert_host_bfloat16 { typedef magmaBfloat16 type; };
+
+// Scalar conversion from S to the format D, and the storage type of D.
+template< typename S, typename D >
+struct convert_host_op
+{
+    typedef D dst_t;
+    static D cvt( S x ) { return D( x ); }
+};
+
+template<>
+struct convert_host_op< float, convert_host_half >
+{
+    typedef magmaHalf dst_t;
+    static magmaHalf cvt( float x ) { return convert_host_s2h( x ); }
+};
+
+template<>
+struct convert_host_op< convert_host_half, float >
+{
+    typedef float dst_t;
+    static float cvt( magmaHalf x ) { return convert_host_h2s( x ); }
+};
+
+template<>
+struct convert_host_op< float, convert_host_bfloat16 >
+{
+    typedef magmaBfloat16 dst_t;
+    static magmaBfloat16 cvt( float x ) { return convert_host_s2bf( x ); }
+};
+
+template<>
+struct convert_host_op< convert_host_bfloat16, float >
+{
+    typedef float dst_t;
+    static float cvt( magmaBfloat16 x ) { return convert_host_bf2s( x ); }
+};
+
+// storage type of S, which is a tag for the 16-bit formats
+template< typename S > struct convert_host_src        { typedef S type; };
+template<> struct convert_host_src< convert_host_half >     { typedef magmaHalf     type; };
+template<> struct convert_host_src< convert_host_bfloat16 > { typedef magmaBfloat16 type; };
+
+
+/***************************************************************************//**
+    Converts x(0:len-1) to y(0:len-1). If Check, returns whether any
+    |x(i)| > rmax, else 0. The generic kernel is one simd loop;
+    specializations below use the conversion instructions directly.
+*******************************************************************************/
+template< typename S, typename D >
+struct convert_host_kernel
+{
+    typedef typename convert_host_src< S >::type src_t;
+    typedef typename convert_host_op< S, D >::dst_t dst_t;
+
+    template< bool Check >
+    static int tail( const src_t* x, dst_t* y, magma_int_t len, src_t rmax )
+    {
+        int flag = 0;
+        if (Check) {
+            #pragma omp simd reduction(|:flag)
+            for (magma_int_t i = 0; i < len; ++i) {
+                flag |= (x[i] < -rmax) | (x[i] > rmax);
+                y[i] = convert_host_op< S, D >::cvt( x[i] );
+            }
+        }
+        else {
+            #pragma omp simd
+            for (magma_int_t i = 0; i < len; ++i) {
+                y[i] = convert_host_op< S, D >::cvt( x[i] );
+            }
+        }
+        return flag;
+    }
+
+    template< bool Check >
+    static int run( const src_t* x, dst_t* y, magma_int_t len, src_t rmax )
+    {
+        return tail< Check >( x, y, len, rmax );
+    }
+};
+
+#if defined(__AVX__)
+
+template<>
+template< bool Check >
+int convert_host_kernel< double, float >::run(
+    const double* x, float* y, magma_int_t len, double rmax )
+{
+    const __m256d vmax = _mm256_set1_pd( rmax );
+    const __m256d vabs = _mm256_castsi256_pd( _mm256_set1_epi64x( 0x7fffffffffffffffLL ));
+    __m256d bad = _mm256_setzero_pd();
+    magma_int_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        __m256d v0 = _mm256_loadu_pd( x + i     );
+        __m256d v1 = _mm256_loadu_pd( x + i + 4 );
+        if (Check) {
+            bad = _mm256_or_pd( bad, _mm256_cmp_pd( _mm256_and_pd( v0, vabs ), vmax, _CMP_GT_OQ ));
+            bad = _mm256_or_pd( bad, _mm256_cmp_pd( _mm256_and_pd( v1, vabs ), vmax, _CMP_GT_OQ ));
+        }
+        _mm_storeu_ps( y + i,     _mm256_cvtpd_ps( v0 ));
+        _mm_storeu_ps( y + i + 4, _mm256_cvtpd_ps( v1 ));
+    }
+    int flag = (_mm256_movemask_pd( bad ) != 0);
+    return flag | tail< Check >( x + i, y + i, len - i, rmax );
+}
+
+template<>
+template< bool Check >
+int convert_host_kernel< float, double >::run(
+    const float* x, double* y, magma_int_t len, float rmax )
+{
+    magma_int_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        _mm256_storeu_pd( y + i,     _mm256_cvtps_pd( _mm_loadu_ps( x + i     )));
+        _mm256_storeu_pd( y + i + 4, _mm256_cvtps_pd( _mm_loadu_ps( x + i + 4 )));
+    }
+    return tail< Check >( x + i, y + i, len - i, rmax );
+}
+
+#endif // __AVX__
+
+#if defined(__F16C__)
+
+template<>
+template< bool Check >
+int convert_host_kernel< float, convert_host_half >::run(
+    const float* x, magmaHalf* y, magma_int_t len, float rmax )
+{
+    const __m256 vmax = _mm256_set1_ps( rmax );
+    const __m256 vabs = _mm256_castsi256_ps( _mm256_set1_epi32( 0x7fffffff ));
+    __m256 bad = _mm256_setzero_ps();
+    magma_int_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        __m256 v = _mm256_loadu_ps( x + i );
+        if (Check) {
+            bad = _mm256_or_ps( bad, _mm256_cmp_ps( _mm256_and_ps( v, vabs ), vmax, _CMP_GT_OQ ));
+        }
+        _mm_storeu_si128( (__m128i*) (y + i),
+                          _mm256_cvtps_ph( v, _MM_FROUND_TO_NEAREST_INT ));
+    }
+    int flag = (_mm256_movemask_ps( bad ) != 0);
+    return flag | tail< Check >( x + i, y + i, len - i, rmax );
+}
+
+template<>
+template< bool Check >
+int convert_host_kernel< convert_host_half, float >::run(
+    const magmaHalf* x, float* y, magma_int_t len, magmaHalf rmax )
+{
+    magma_int_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        _mm256_storeu_ps( y + i, _mm256_cvtph_ps( _mm_loadu_si128( (const __m128i*) (x + i) )));
+    }
+    return tail< Check >( x + i, y + i, len - i, rmax );
+}
+
+#endif // __F16C__
+
+
+/***************************************************************************//**
+    Converts the m-by-n matrix A, or its upper or lower triangle, to B.
+    S is the source type; D the target, or a tag for the 16-bit formats.
+    Each element is w values of S, w = 2 for complex.
+    If Check, returns the offset i + j*lda, in elements, of the first
+    entry of A (in column-major order) with a part greater than rmax in
+    magnitude; else, or if there is none, returns -1.
+    Called synchronously; the magmablas_* wrappers handle queues.
+*******************************************************************************/
+template< typename S, typename D, bool Check >
+magma_int_t magma_convert_host(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    const typename convert_host_src< S >::type* A, magma_int_t lda,
+    typename convert_host_op< S, D >::dst_t* B, magma_int_t ldb,
+    magma_int_t w,
+    typename convert_host_src< S >::type rmax )
+{
+    typedef typename convert_host_src< S >::type src_t;
+    typedef convert_host_kernel< S, D > kernel;
+
+    const magma_int_t none = (std::numeric_limits< magma_int_t >::max)();
+    magma_int_t first = none;
+    magma_int_t nelem = (uplo == MagmaFull ? m*n : n*(n+1)/2);
+    bool parallel = (nelem*w >= magma_convert_nb_parallel);
+
+    // converts column j; on overflow, updates first to the first bad entry
+    auto column = [&]( magma_int_t j, magma_int_t& first_ )
+    {
+        magma_int_t ibegin = (uplo == MagmaLower ? j : 0);
+        magma_int_t iend   = (uplo == MagmaUpper ? min( j+1, m ) : m);
+        if (ibegin >= iend)
+            return;
+        const src_t* x = A + (ibegin + j*lda)*w;
+        magma_int_t len = (iend - ibegin)*w;
+        int flag = kernel::template run< Check >( x, B + (ibegin + j*ldb)*w, len, rmax );
+        if (Check && flag && ibegin + j*lda < first_) {
+            for (magma_int_t k = 0; k < len; ++k) {
+                if (x[k] < -rmax || x[k] > rmax) {
+                    first_ = min( first_, ibegin + k/w + j*lda );
+                    break;
+                }
+            }
+        }
+    };
+
+    if (uplo == MagmaFull) {
+        #pragma omp parallel for schedule(static) reduction(min:first) if (parallel)
+        for (magma_int_t j = 0; j < n; ++j) {
+            column( j, first );
+        }
+    }
+    else {
+        // triangles have columns of varying length
+        #pragma omp parallel for schedule(dynamic, 16) reduction(min:first) if (parallel)
+        for (magma_int_t j = 0; j < n; ++j) {
+            column( j, first );
+        }
+    }
+    return (first == none ? -1 : first);
+}
+
+#endif // MAGMA_CONVERT_HOST_HPP
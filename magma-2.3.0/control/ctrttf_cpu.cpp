@@ -0,0 +1,164 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from control/ztrttf_cpu.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+*/
+#include "symmetric_host.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CTRTTF_CPU copies a triangular matrix A from standard full format (TR)
+    to rectangular full packed format (TF), as LAPACK's ctrttf does, but in
+    parallel, with cache-friendly transposes; see control/symmetric_host.hpp.
+    RFP format stores the triangle in N*(N+1)/2 elements, half the memory
+    of full format, as two full-format blocks, so routines such as LAPACK's
+    cpftrf can work on it with Level 3 BLAS.
+
+    Arguments
+    ---------
+    @param[in]
+    transr  magma_trans_t
+      -     = MagmaNoTrans:   ARF in Normal format is wanted;
+      -     = MagmaConjTrans: ARF in Conjugate-transpose format is wanted.
+                              (MagmaTrans in real precisions.)
+
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  A is upper triangular;
+      -     = MagmaLower:  A is lower triangular.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    A       COMPLEX array, dimension (LDA,N)
+            On entry, the triangular matrix A. Only the triangle given by
+            uplo is referenced.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    ARF     COMPLEX array, dimension (N*(N+1)/2)
+            On exit, the triangle of A in RFP format: with N even and
+            TRANSR = MagmaNoTrans, an (N+1)-by-(N/2) matrix; with N odd,
+            N-by-((N+1)/2); transposed if TRANSR = MagmaConjTrans.
+            See LAPACK's ctrttf for the layout.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_trttf
+*******************************************************************************/
+extern "C" void
+magma_ctrttf_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *ARF,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( transr != MagmaNoTrans && transr != Magma_ConjTrans )
+        *info = -1;
+    else if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -2;
+    else if ( n < 0 )
+        *info = -3;
+    else if ( lda < max(1,n) )
+        *info = -5;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_rfp_host( true, transr, uplo, n,
+                    const_cast< magmaFloatComplex* >( A ), lda, ARF );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CTFTTR_CPU copies a triangular matrix A from rectangular full packed
+    format (TF) to standard full format (TR), as LAPACK's ctfttr does, but
+    in parallel; see magma_ctrttf_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    transr  magma_trans_t
+      -     = MagmaNoTrans:   ARF is in Normal format;
+      -     = MagmaConjTrans: ARF is in Conjugate-transpose format.
+                              (MagmaTrans in real precisions.)
+
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  A is upper triangular;
+      -     = MagmaLower:  A is lower triangular.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    ARF     COMPLEX array, dimension (N*(N+1)/2)
+            On entry, the triangle of A in RFP format.
+
+    @param[out]
+    A       COMPLEX array, dimension (LDA,N)
+            On exit, the triangle of A given by uplo. The other strict
+            triangle is not referenced.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_trttf
+*******************************************************************************/
+extern "C" void
+magma_ctfttr_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *ARF,
+    magmaFloatComplex *A, magma_int_t lda,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( transr != MagmaNoTrans && transr != Magma_ConjTrans )
+        *info = -1;
+    else if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -2;
+    else if ( n < 0 )
+        *info = -3;
+    else if ( lda < max(1,n) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_rfp_host( false, transr, uplo, n,
+                    A, lda, const_cast< magmaFloatComplex* >( ARF ) );
+}
@@ -0,0 +1,347 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#include "schedule_sim.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    Dry run of magma_dpotrf3_mgpu, lower, on an n-by-n matrix distributed
+    1D block-row cyclic over the sim.ngpu() devices, as magma_dpotrf_mgpu
+    calls it. Replays the driver's loop, with its queues, stream1, 2, 3,
+    and its events, 0 to 4 of each device, making the calls of sim where
+    the driver calls MAGMA and LAPACK.
+
+    @param[in,out]
+    sim         The simulator; the driver's queues map onto its nqueue queues.
+
+    @param[in]
+    n           The order of the matrix.
+
+    @param[in]
+    nb          The block size.
+
+    @param[in]
+    lookahead   1, as the driver: the owner of the next block column solves
+                its diagonal rows first on stream1 and sends them to the
+                other devices while it solves the rest.
+                0: it solves its whole part on stream2, then sends the rows.
+    @ingroup magma_sim
+*******************************************************************************/
+void magma_dpotrf3_mgpu_sim(
+    magma_sim& sim, magma_int_t n, magma_int_t nb, magma_int_t lookahead )
+{
+    const magma_int_t ngpu = sim.ngpu();
+    const magma_int_t stream1 = 0, stream2 = 1, stream3 = 2;
+    #define event( d_, i_ )  (5*(d_) + (i_))
+
+    magma_int_t j, jb, nb0, nb2, d, dd, id, j_local, j_local2;
+    magma_int_t n_local[MagmaMaxGPUs];
+    for (d = 0; d < ngpu; ++d) {
+        n_local[d] = magma_bcyclic_numroc( n, nb, d, ngpu );
+    }
+
+    for (j = 0; j < n; j += nb) {
+        id = (j/nb) % ngpu;
+        j_local = j/(nb*ngpu);
+        jb = min( nb, n-j );
+
+        /* update the diagonal block, and send it to the cpu, on stream1 */
+        if (j > 0) {
+            if (! lookahead) {
+                sim.queue_wait_event( id, stream1, event( id, 4 ));  // its rows solved on stream2
+            }
+            sim.kernel( id, stream1, MagmaSimSyrk, jb, jb, j );
+        }
+        sim.getmatrix( id, stream1, jb, jb );
+
+        /* update the off-diagonal blocks of the panel */
+        if (j > 0) {
+            d = (j/nb + 1) % ngpu;
+            for (dd = 0; dd < ngpu; ++dd) {
+                j_local2 = j_local + 1;
+                if (d > id) j_local2--;
+                nb0 = nb*j_local2;
+                if (nb0 < n_local[d]) {
+                    sim.queue_wait_event( d, stream2, (d == id ? event( d, 4 )    // own rows solved
+                                                               : event( d, 0 )));  // rows arrived
+                    sim.kernel( d, stream2, MagmaSimGemm, n_local[d] - nb0, jb, j );
+                    sim.event_record( event( d, 2 ), d, stream2 );
+                }
+                d = (d + 1) % ngpu;
+            }
+        }
+
+        /* factor the diagonal block on the cpu */
+        sim.queue_sync( id, stream1 );
+        sim.host( MagmaSimPotrf, jb, jb, 0 );
+
+        /* send it to the gpus on stream1 */
+        if (j + jb < n) {
+            d = (j/nb + 1) % ngpu;
+            for (dd = 0; dd < ngpu; ++dd) {
+                sim.setmatrix( d, stream1, jb, jb );
+                sim.event_record( event( d, 1 ), d, stream1 );
+                d = (d + 1) % ngpu;
+            }
+        }
+        else {
+            sim.setmatrix( id, stream1, jb, jb );
+            continue;
+        }
+
+        /* solve the off-diagonal blocks */
+        magma_int_t next = (j/nb + 1) % ngpu;
+        d = next;
+        for (dd = 0; dd < ngpu; ++dd) {
+            j_local2 = j_local + 1;
+            if (d > id) j_local2--;
+            nb2 = n_local[d] - j_local2*nb;
+            nb0 = min( nb, nb2 );
+            if (d == next && lookahead) {
+                /* look-ahead: the diagonal rows of the next block column */
+                if (j > 0) {
+                    sim.queue_wait_event( d, stream1, event( d, 2 ));  // gemm update
+                }
+                sim.kernel( d, stream1, MagmaSimTrsm, nb0, jb, jb );
+                sim.event_record( event( d, 4 ), d, stream1 );
+            }
+            else if (nb2 > 0) {
+                sim.queue_wait_event( d, stream2, event( d, 1 ));  // cholesky factor
+                sim.kernel( d, stream2, MagmaSimTrsm, nb2, jb, jb );
+                if (d == next) {
+                    sim.event_record( event( d, 4 ), d, stream2 );
+                }
+            }
+            d = (d + 1) % ngpu;
+        }
+
+        /* send the rows of the next block column to the cpu, and from
+           there to the other gpus, on stream3 */
+        d = next;
+        j_local2 = j_local + 1;
+        if (d > id) j_local2--;
+        nb0 = min( nb, n_local[d] - nb*j_local2 );
+        sim.queue_wait_event( d, stream3, event( d, 4 ));
+        sim.getmatrix( d, stream3, nb0, j + jb );
+        sim.event_record( event( d, 3 ), d, stream3 );
+        for (magma_int_t d2 = 0; d2 < ngpu; ++d2) {
+            if (d2 != d) {
+                sim.queue_wait_event( d2, stream3, event( d, 3 ));
+                sim.setmatrix( d2, stream3, nb0, j + jb );
+                sim.event_record( event( d2, 0 ), d2, stream3 );
+            }
+        }
+
+        /* look-ahead: the rest of the next block column, on stream2 */
+        nb2 = n_local[d] - (j_local2*nb + nb0);
+        if (lookahead && nb2 > 0) {
+            sim.queue_wait_event( d, stream2, event( d, 1 ));
+            sim.kernel( d, stream2, MagmaSimTrsm, nb2, jb, jb );
+        }
+    }
+
+    for (d = 0; d < ngpu; ++d) {
+        sim.queue_sync( d, stream1 );
+        sim.queue_sync( d, stream2 );
+        sim.queue_sync( d, stream3 );
+    }
+    #undef event
+}
+
+
+/***************************************************************************//**
+    Dry run of magma_dgetrf_mgpu on an m-by-n matrix distributed 1D block
+    column cyclic over the sim.ngpu() devices: the transposes in and out,
+    and magma_dgetrf2_mgpu between them. Replays the driver's loop, with
+    its queues 0 and 1, making the calls of sim where the driver calls
+    MAGMA and LAPACK.
+
+    @param[in,out]
+    sim         The simulator; the driver's queues map onto its nqueue queues.
+
+    @param[in]
+    m           The number of rows of the matrix.
+
+    @param[in]
+    n           The number of columns of the matrix.
+
+    @param[in]
+    nb          The block size.
+
+    @param[in]
+    lookahead   1, as the driver: the owner of the next panel updates it
+                first on queue 1 and sends it to the cpu, then updates the
+                rest of its columns on queue 0.
+                0: it updates all its columns on queue 0, then sends the
+                next panel.
+    @ingroup magma_sim
+*******************************************************************************/
+void magma_dgetrf_mgpu_sim(
+    magma_sim& sim, magma_int_t m, magma_int_t n, magma_int_t nb, magma_int_t lookahead )
+{
+    const magma_int_t ngpu = sim.ngpu();
+    magma_int_t j, d, dd, id, j_local, j_local2, rows, s, nb0, nb1;
+    magma_int_t n_local[MagmaMaxGPUs];
+    magma_int_t mindim = min( m, n );
+
+    for (d = 0; d < ngpu; ++d) {
+        n_local[d] = ((n/nb)/ngpu)*nb;
+        if (d < (n/nb) % ngpu)
+            n_local[d] += nb;
+        else if (d == (n/nb) % ngpu)
+            n_local[d] += n % nb;
+    }
+
+    /* magma_dgetrf_mgpu: transpose the matrix on each gpu */
+    for (d = 0; d < ngpu; ++d) {
+        sim.kernel( d, 1, MagmaSimTranspose, m, n_local[d], 0 );
+    }
+    for (d = 0; d < ngpu; ++d) {
+        sim.queue_sync( d, 0 );
+    }
+
+    /* magma_dgetrf2_mgpu: start sending the panel to the cpu */
+    nb0 = min( mindim, nb );
+    sim.kernel( 0, 1, MagmaSimTranspose, nb0, m, 0 );
+    sim.getmatrix( 0, 1, m, nb0 );
+
+    s = mindim / nb;
+    for (j = 0; j < s; ++j) {
+        id = j % ngpu;
+        j_local = j/ngpu;
+        rows = m - j*nb;
+
+        /* factor the panel on the cpu */
+        sim.queue_sync( id, 1 );
+        sim.host( MagmaSimGetrf, rows, nb, 0 );
+
+        /* send it to all the gpus */
+        d = (j + 1) % ngpu;
+        for (dd = 0; dd < ngpu; ++dd) {
+            sim.setmatrix( d, 1, rows, nb );
+            d = (d + 1) % ngpu;
+        }
+
+        /* apply the pivoting */
+        d = (j + 1) % ngpu;
+        for (dd = 0; dd < ngpu; ++dd) {
+            sim.kernel( d, 0, MagmaSimLaswp, nb, n_local[d], nb );
+            d = (d + 1) % ngpu;
+        }
+
+        /* update the trailing matrix, and look ahead */
+        d = (j + 1) % ngpu;
+        for (dd = 0; dd < ngpu; ++dd) {
+            if (d == id) {
+                j_local2 = j_local + 1;
+            }
+            else {
+                j_local2 = j_local;
+                if (d < id) j_local2++;
+            }
+            if (s > j + 1) {
+                nb0 = nb;
+            }
+            else {
+                nb0 = n_local[d] - nb*(s/ngpu);
+                if (d < s % ngpu) nb0 -= nb;
+            }
+            bool ahead = (lookahead && d == (j + 1) % ngpu);
+            magma_int_t queue;
+            if (ahead) {
+                /* owns the next column: update it on queue 1 */
+                nb1 = nb0;
+                queue = 1;
+                sim.queue_sync( d, 0 );
+                sim.kernel( d, 1, MagmaSimTranspose, rows, nb, 0 );
+                sim.queue_sync( d, 1 );
+            }
+            else {
+                /* update all its columns on queue 0 */
+                nb1 = n_local[d] - j_local2*nb;
+                queue = 0;
+                sim.queue_sync( d, 1 );
+                sim.kernel( d, 0, MagmaSimTranspose, rows, nb, 0 );
+            }
+            sim.kernel( d, queue, MagmaSimTrsm, nb1, nb, nb );
+            sim.kernel( d, queue, MagmaSimGemm, nb1, m - (j+1)*nb, nb );
+
+            if (d == (j + 1) % ngpu) {
+                /* transpose the next panel, and send it to the cpu on queue 1 */
+                nb0 = min( nb, mindim - (j+1)*nb );
+                if (nb0 > 0) {
+                    sim.kernel( d, queue, MagmaSimTranspose, nb0, m - (j+1)*nb, 0 );
+                    if (queue != 1) {
+                        // without look-ahead, event d marks the panel ready
+                        sim.event_record( d, d, queue );
+                        sim.queue_wait_event( d, 1, d );
+                    }
+                    sim.getmatrix( d, 1, m - (j+1)*nb, nb0 );
+                }
+            }
+            d = (d + 1) % ngpu;
+        }
+
+        /* update the rest of the columns of the gpu that looked ahead */
+        if (lookahead && j + 1 < s) {
+            magma_int_t j_local_rest = (j + 1)/ngpu;
+            d = (j + 1) % ngpu;
+            nb1 = n_local[d] - (j_local_rest + 1)*nb;
+            sim.kernel( d, 0, MagmaSimTrsm, nb1, nb, nb );
+            sim.kernel( d, 0, MagmaSimGemm, nb1, m - (j+1)*nb, nb );
+        }
+    }
+
+    /* the last, partial, panel */
+    id = s % ngpu;
+    j_local = s/ngpu;
+    nb0 = min( m - s*nb, n - s*nb );
+    rows = m - s*nb;
+    if (nb0 > 0) {
+        sim.queue_sync( id, 1 );
+        sim.host( MagmaSimGetrf, rows, nb0, 0 );
+        for (d = 0; d < ngpu; ++d) {
+            j_local2 = j_local;
+            if (d < id) j_local2++;
+            if (d == id || n_local[d] > j_local2*nb) {
+                sim.setmatrix( d, 1, rows, nb0 );
+            }
+        }
+        for (d = 0; d < ngpu; ++d) {
+            sim.kernel( d, 0, MagmaSimLaswp, nb0, n_local[d], nb0 );
+        }
+        for (d = 0; d < ngpu; ++d) {
+            sim.queue_sync( d, 0 );
+            j_local2 = j_local;
+            if (d < id) j_local2++;
+            if (d == id) {
+                nb1 = n_local[d] - j_local*nb - nb0;
+                sim.kernel( d, 1, MagmaSimTranspose, rows, nb0, 0 );
+                if (nb1 > 0) {
+                    sim.kernel( d, 1, MagmaSimTrsm, nb1, nb0, nb0 );
+                }
+            }
+            else if (n_local[d] > j_local2*nb) {
+                nb1 = n_local[d] - j_local2*nb;
+                sim.kernel( d, 1, MagmaSimTranspose, rows, nb0, 0 );
+                sim.kernel( d, 1, MagmaSimTrsm, nb1, nb0, nb0 );
+            }
+        }
+    }
+    for (d = 0; d < ngpu; ++d) {
+        sim.queue_sync( d, 0 );
+        sim.queue_sync( d, 1 );
+    }
+
+    /* magma_dgetrf_mgpu: transpose back */
+    for (d = 0; d < ngpu; ++d) {
+        sim.kernel( d, 0, MagmaSimTranspose, n_local[d], m, 0 );
+        sim.queue_sync( d, 0 );
+        sim.queue_sync( d, 1 );
+    }
+}
@@ -0,0 +1,208 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from control/ztranspose_cpu.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "transpose_host.hpp"  // includes magma_internal.h, after the STL headers
+
+#define REAL
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRANSPOSE_CPU copies and transposes an M-by-N matrix A in CPU memory
+    to the N-by-M matrix AT, e.g., to exchange data with row-major code.
+    Uses SIMD register-transpose kernels within a cache-oblivious recursion,
+    multithreaded with OpenMP; see control/transpose_host.hpp.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            The M-by-N matrix A.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @param[out]
+    AT      DOUBLE PRECISION array, dimension (LDAT,M)
+            On exit, the N-by-M matrix A^T. AT must not overlap A.
+
+    @param[in]
+    ldat    INTEGER
+            The leading dimension of the array AT.  LDAT >= max(1,N).
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magma_dtranspose_cpu(
+    magma_int_t m, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *AT, magma_int_t ldat )
+{
+    magma_int_t info = 0;
+    if (m < 0)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (lda < max(1,m))
+        info = -4;
+    else if (ldat < max(1,n))
+        info = -6;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    magma_transpose_host( false, m, n, A, lda, AT, ldat );
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRANSPOSE_CONJ_CPU copies and conjugate-transposes an M-by-N matrix A
+    in CPU memory to the N-by-M matrix AT = A^H.
+    Arguments are the same as for magma_dtranspose_cpu.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magma_dtranspose_conj_cpu(
+    magma_int_t m, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *AT, magma_int_t ldat )
+{
+    magma_int_t info = 0;
+    if (m < 0)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (lda < max(1,m))
+        info = -4;
+    else if (ldat < max(1,n))
+        info = -6;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    magma_transpose_host( true, m, n, A, lda, AT, ldat );
+}
+#endif // COMPLEX
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRANSPOSE_INPLACE_CPU transposes an M-by-N matrix A in CPU memory
+    in-place, so on exit A holds the N-by-M matrix A^T.
+    A square matrix is transposed by swapping tiles across the diagonal.
+    A non-square matrix must be stored contiguously; it is transposed by
+    following the cycles of the permutation, using O(M*N) bits of workspace,
+    and on exit has leading dimension N.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in,out]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            On entry, the M-by-N matrix A.
+            On exit, the N-by-M matrix A^T, with leading dimension LDA
+            if M == N, otherwise N.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.
+            If M == N, LDA >= max(1,N); otherwise LDA = M.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magma_dtranspose_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda )
+{
+    magma_int_t info = 0;
+    if (m < 0)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (m == n ? lda < max(1,n) : lda != m)
+        info = -4;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    magma_transpose_inplace_host( false, m, n, A, lda );
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRANSPOSE_CONJ_INPLACE_CPU conjugate-transposes an M-by-N matrix A
+    in CPU memory in-place, so on exit A holds the N-by-M matrix A^H.
+    Arguments are the same as for magma_dtranspose_inplace_cpu.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magma_dtranspose_conj_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda )
+{
+    magma_int_t info = 0;
+    if (m < 0)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (m == n ? lda < max(1,n) : lda != m)
+        info = -4;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    magma_transpose_inplace_host( true, m, n, A, lda );
+}
+#endif // COMPLEX
@@ -0,0 +1,351 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from control/ztrsm_cpu.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "trsm_host.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRTRI_DIAG_CPU inverts the NB-by-NB diagonal blocks of the triangular
+    matrix A, in CPU memory, as magmablas_dtrtri_diag does on the device,
+    with NB = 128. The blocks are inverted in parallel.
+    The result can be passed to magma_dtrsm_cpu for any number of solves
+    with the same A; see control/trsm_host.hpp.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t.
+            On entry, uplo specifies whether the matrix A is an upper or
+            lower triangular matrix as follows:
+      -     = MagmaUpper:  A is an upper triangular matrix.
+      -     = MagmaLower:  A is a  lower triangular matrix.
+
+    @param[in]
+    diag    magma_diag_t.
+            On entry, diag specifies whether or not A is unit triangular
+            as follows:
+      -     = MagmaUnit:      A is assumed to be unit triangular.
+      -     = MagmaNonUnit:   A is not assumed to be unit triangular.
+
+    @param[in]
+    n       INTEGER.
+            On entry, n specifies the order of the matrix A. N >= 0.
+
+    @param[in]
+    A       DOUBLE PRECISION array of dimension ( lda, n )
+            The triangular matrix A.
+            \n
+            If UPLO = MagmaUpper, the leading N-by-N upper triangular part of A
+            contains the upper triangular matrix, and the strictly lower
+            triangular part of A is not referenced.
+            \n
+            If UPLO = MagmaLower, the leading N-by-N lower triangular part of A
+            contains the lower triangular matrix, and the strictly upper
+            triangular part of A is not referenced.
+            \n
+            If DIAG = MagmaUnit, the diagonal elements of A are also not referenced
+            and are assumed to be 1.
+
+    @param[in]
+    lda     INTEGER.
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    invA    DOUBLE PRECISION array of dimension (NB, ceil(n/NB)*NB),
+            where NB = 128.
+            On exit, contains inverses of the NB-by-NB diagonal blocks of A.
+
+    @ingroup magma_trtri_diag
+*******************************************************************************/
+extern "C" void
+magma_dtrtri_diag_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *invA )
+{
+    magma_int_t info = 0;
+    if (uplo != MagmaLower && uplo != MagmaUpper)
+        info = -1;
+    else if (diag != MagmaNonUnit && diag != MagmaUnit)
+        info = -2;
+    else if (n < 0)
+        info = -3;
+    else if (lda < max(1,n))
+        info = -5;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (n == 0)
+        return;
+
+    trsm_host_trtri_diag( uplo, diag, n, A, lda, invA );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRSM_CPU solves one of the matrix equations on CPU memory
+        op(A)*X = alpha*B,   or
+        X*op(A) = alpha*B,
+    where alpha is a scalar, X and B are m by n matrices, A is a unit, or
+    non-unit, upper or lower triangular matrix and op(A) is one of
+        op(A) = A,   or
+        op(A) = A^T, or
+        op(A) = A^H.
+    The matrix X is overwritten on B.
+
+    As magmablas_dtrsm does on the device, the diagonal blocks of A are
+    inverted, so the solve is done by GEMMs, in parallel over the
+    right-hand sides; see control/trsm_host.hpp. If invA is given, from
+    magma_dtrtri_diag_cpu, they are not inverted again; for repeated solves
+    with the same A, such as with a Cholesky or LU factor, this saves
+    inverting them on every call.
+
+    Arguments
+    ---------
+    @param[in]
+    side    magma_side_t.
+            On entry, side specifies whether op(A) appears on the left
+            or right of X as follows:
+      -     = MagmaLeft:       op(A)*X = alpha*B.
+      -     = MagmaRight:      X*op(A) = alpha*B.
+
+    @param[in]
+    uplo    magma_uplo_t.
+            On entry, uplo specifies whether the matrix A is an upper or
+            lower triangular matrix as follows:
+      -     = MagmaUpper:  A is an upper triangular matrix.
+      -     = MagmaLower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  magma_trans_t.
+            On entry, transA specifies the form of op(A) to be used in
+            the matrix multiplication as follows:
+      -     = MagmaNoTrans:    op(A) = A.
+      -     = MagmaTrans:      op(A) = A^T.
+      -     = MagmaConjTrans:  op(A) = A^H.
+
+    @param[in]
+    diag    magma_diag_t.
+            On entry, diag specifies whether or not A is unit triangular
+            as follows:
+      -     = MagmaUnit:      A is assumed to be unit triangular.
+      -     = MagmaNonUnit:   A is not assumed to be unit triangular.
+            If invA is given, it must have been computed with the same diag.
+
+    @param[in]
+    m       INTEGER.
+            On entry, m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       INTEGER.
+            On entry, n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    alpha   DOUBLE PRECISION.
+            On entry, alpha specifies the scalar alpha. When alpha is
+            zero then A is not referenced, and B need not be set before
+            entry.
+
+    @param[in]
+    A       DOUBLE PRECISION array of dimension ( lda, k ), where k is m
+            when side = MagmaLeft and is n when side = MagmaRight.
+            The triangular matrix A, as in magma_dtrtri_diag_cpu.
+
+    @param[in]
+    lda     INTEGER.
+            On entry, lda specifies the first dimension of A.
+            When side = MagmaLeft,  lda >= max( 1, m ),
+            when side = MagmaRight, lda >= max( 1, n ).
+
+    @param[in]
+    invA    DOUBLE PRECISION array of dimension (NB, ceil(k/NB)*NB), where NB = 128,
+            from magma_dtrtri_diag_cpu with the same uplo, diag, and A;
+            or NULL, to invert the diagonal blocks in a workspace.
+
+    @param[in,out]
+    B       DOUBLE PRECISION array of dimension ( ldb, n ).
+            On entry, the m-by-n matrix B.
+            On exit, overwritten by the solution matrix X.
+
+    @param[in]
+    ldb     INTEGER.
+            On entry, ldb specifies the first dimension of B.
+            ldb >= max( 1, m ).
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magma_dtrsm_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    const double *A, magma_int_t lda,
+    const double *invA,
+    double *B, magma_int_t ldb )
+{
+    const magma_int_t nb = magma_trsm_nb;
+    magma_int_t k = (side == MagmaLeft ? m : n);
+    double *work = NULL;
+
+    magma_int_t info = 0;
+    if (side != MagmaLeft && side != MagmaRight)
+        info = -1;
+    else if (uplo != MagmaUpper && uplo != MagmaLower)
+        info = -2;
+    else if (transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans)
+        info = -3;
+    else if (diag != MagmaUnit && diag != MagmaNonUnit)
+        info = -4;
+    else if (m < 0)
+        info = -5;
+    else if (n < 0)
+        info = -6;
+    else if (lda < max(1,k))
+        info = -9;
+    else if (ldb < max(1,m))
+        info = -12;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (invA == NULL && ! MAGMA_D_EQUAL( alpha, MAGMA_D_ZERO )) {
+        if (MAGMA_SUCCESS != magma_dmalloc_cpu( &work, magma_roundup( k, nb )*nb )) {
+            // no workspace; solve by the host BLAS
+            blasf77_dtrsm( lapack_side_const(side), lapack_uplo_const(uplo),
+                           lapack_trans_const(transA), lapack_diag_const(diag),
+                           &m, &n, &alpha, A, &lda, B, &ldb );
+            return;
+        }
+        trsm_host_trtri_diag( uplo, diag, k, A, lda, work );
+        invA = work;
+    }
+
+    trsm_host( side, uplo, transA, m, n, alpha, A, lda, invA, B, ldb );
+
+    magma_free_cpu( work );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRTRI_CPU computes the inverse of an upper or lower triangular
+    matrix A, in CPU memory, as LAPACK's dtrtri does.
+
+    The diagonal blocks are inverted first, as in magma_dtrtri_diag_cpu;
+    the rest of the inverse is computed recursively by GEMM-based
+    triangular solves with them; see control/trsm_host.hpp.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  A is upper triangular;
+      -     = MagmaLower:  A is lower triangular.
+
+    @param[in]
+    diag    magma_diag_t
+      -     = MagmaNonUnit:  A is non-unit triangular;
+      -     = MagmaUnit:     A is unit triangular.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in,out]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            On entry, the triangular matrix A.  If UPLO = MagmaUpper, the
+            leading N-by-N upper triangular part of the array A contains
+            the upper triangular matrix, and the strictly lower
+            triangular part of A is not referenced.  If UPLO = MagmaLower, the
+            leading N-by-N lower triangular part of the array A contains
+            the lower triangular matrix, and the strictly upper
+            triangular part of A is not referenced.  If DIAG = MagmaUnit, the
+            diagonal elements of A are also not referenced and are
+            assumed to be 1.
+            On exit, the (triangular) inverse of the original matrix, in
+            the same storage format.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0: successful exit
+      -     < 0: if INFO = -i, the i-th argument had an illegal value
+      -     > 0: if INFO = i, A(i,i) is exactly zero.  The triangular
+                    matrix is singular and its inverse cannot be computed.
+
+    @ingroup magma_trtri
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dtrtri_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    double *A, magma_int_t lda,
+    magma_int_t *info )
+{
+    #define A(i_, j_) (A + (i_) + (j_)*lda)
+
+    const magma_int_t nb = magma_trsm_nb;
+    double *invA;
+
+    *info = 0;
+    if (uplo != MagmaLower && uplo != MagmaUpper)
+        *info = -1;
+    else if (diag != MagmaNonUnit && diag != MagmaUnit)
+        *info = -2;
+    else if (n < 0)
+        *info = -3;
+    else if (lda < max(1,n))
+        *info = -5;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    if (n == 0)
+        return *info;
+
+    // check for singularity
+    if (diag == MagmaNonUnit) {
+        for (magma_int_t j = 0; j < n; ++j) {
+            if (MAGMA_D_EQUAL( *A(j,j), MAGMA_D_ZERO )) {
+                *info = j+1;
+                return *info;
+            }
+        }
+    }
+
+    if (MAGMA_SUCCESS != magma_dmalloc_cpu( &invA, magma_roundup( n, nb )*nb )) {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+
+    trsm_host_trtri_diag( uplo, diag, n, A, lda, invA );
+    trtri_host_rec( uplo, diag, n, A, lda, invA );
+
+    magma_free_cpu( invA );
+    return *info;
+
+    #undef A
+}
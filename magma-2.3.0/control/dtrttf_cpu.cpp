@@ -0,0 +1,162 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from control/ztrttf_cpu.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "symmetric_host.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRTTF_CPU copies a triangular matrix A from standard full format (TR)
+    to rectangular full packed format (TF), as LAPACK's dtrttf does, but in
+    parallel, with cache-friendly transposes; see control/symmetric_host.hpp.
+    RFP format stores the triangle in N*(N+1)/2 elements, half the memory
+    of full format, as two full-format blocks, so routines such as LAPACK's
+    dpftrf can work on it with Level 3 BLAS.
+
+    Arguments
+    ---------
+    @param[in]
+    transr  magma_trans_t
+      -     = MagmaNoTrans:   ARF in Normal format is wanted;
+      -     = MagmaTrans:     ARF in Transpose format is wanted.
+
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  A is upper triangular;
+      -     = MagmaLower:  A is lower triangular.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            On entry, the triangular matrix A. Only the triangle given by
+            uplo is referenced.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    ARF     DOUBLE PRECISION array, dimension (N*(N+1)/2)
+            On exit, the triangle of A in RFP format: with N even and
+            TRANSR = MagmaNoTrans, an (N+1)-by-(N/2) matrix; with N odd,
+            N-by-((N+1)/2); transposed if TRANSR = MagmaTrans.
+            See LAPACK's dtrttf for the layout.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_trttf
+*******************************************************************************/
+extern "C" void
+magma_dtrttf_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *ARF,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( transr != MagmaNoTrans && transr != MagmaTrans )
+        *info = -1;
+    else if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -2;
+    else if ( n < 0 )
+        *info = -3;
+    else if ( lda < max(1,n) )
+        *info = -5;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_rfp_host( true, transr, uplo, n,
+                    const_cast< double* >( A ), lda, ARF );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTFTTR_CPU copies a triangular matrix A from rectangular full packed
+    format (TF) to standard full format (TR), as LAPACK's dtfttr does, but
+    in parallel; see magma_dtrttf_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    transr  magma_trans_t
+      -     = MagmaNoTrans:   ARF is in Normal format;
+      -     = MagmaTrans:     ARF is in Transpose format.
+
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  A is upper triangular;
+      -     = MagmaLower:  A is lower triangular.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    ARF     DOUBLE PRECISION array, dimension (N*(N+1)/2)
+            On entry, the triangle of A in RFP format.
+
+    @param[out]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            On exit, the triangle of A given by uplo. The other strict
+            triangle is not referenced.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_trttf
+*******************************************************************************/
+extern "C" void
+magma_dtfttr_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const double *ARF,
+    double *A, magma_int_t lda,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( transr != MagmaNoTrans && transr != MagmaTrans )
+        *info = -1;
+    else if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -2;
+    else if ( n < 0 )
+        *info = -3;
+    else if ( lda < max(1,n) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_rfp_host( false, transr, uplo, n,
+                    A, lda, const_cast< double* >( ARF ) );
+}
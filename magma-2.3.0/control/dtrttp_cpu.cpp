@@ -0,0 +1,147 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from control/ztrttp_cpu.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "symmetric_host.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTRTTP_CPU copies a triangular matrix A from full format (TR) to
+    standard packed format (TP), as LAPACK's dtrttp does, but in parallel
+    over columns; see control/symmetric_host.hpp. Packed format stores the
+    triangle column by column in N*(N+1)/2 elements, half the memory of
+    full format.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  A is upper triangular;
+      -     = MagmaLower:  A is lower triangular.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            On entry, the triangular matrix A. Only the triangle given by
+            uplo is referenced.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    AP      DOUBLE PRECISION array, dimension (N*(N+1)/2)
+            On exit, the triangle of A, packed columnwise:
+            if UPLO = MagmaUpper, AP(i + j*(j+1)/2) = A(i,j) for 0 <= i <= j;
+            if UPLO = MagmaLower, AP(i + j*(2n-j-1)/2) = A(i,j) for j <= i < n
+            (0-based i, j).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_trttp
+*******************************************************************************/
+extern "C" void
+magma_dtrttp_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *AP,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -4;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_packed_host_copy( false, uplo, n, AP, 0, 0, n, n,
+                            const_cast< double* >( A ), lda );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DTPTTR_CPU copies a triangular matrix A from standard packed format
+    (TP) to full format (TR), as LAPACK's dtpttr does, but in parallel
+    over columns; see magma_dtrttp_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  A is upper triangular;
+      -     = MagmaLower:  A is lower triangular.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    AP      DOUBLE PRECISION array, dimension (N*(N+1)/2)
+            On entry, the triangle of A, packed columnwise.
+
+    @param[out]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            On exit, the triangle of A given by uplo. The other strict
+            triangle is not referenced.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_trttp
+*******************************************************************************/
+extern "C" void
+magma_dtpttr_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const double *AP,
+    double *A, magma_int_t lda,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -5;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_packed_host_copy( true, uplo, n, const_cast< double* >( AP ),
+                            0, 0, n, n, A, lda );
+}
@@ -0,0 +1,294 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#include <errno.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "file_io.hpp"
+
+// If err, prints error and throws exception.
+static void check( int err )
+{
+    if ( err != 0 ) {
+        fprintf( stderr, "Error: %s (%d)\n", strerror(err), err );
+        throw std::exception();
+    }
+}
+
+
+/******************************************************************************/
+// Reads (is_write = false) or writes (is_write = true) nbytes at file offset,
+// retrying partial transfers. Returns 0 or an errno value.
+static int disk_transfer( bool is_write, int fd, char* buf, size_t nbytes, off_t offset )
+{
+    #ifdef _WIN32
+    return ENOSYS;
+    #else
+    while ( nbytes > 0 ) {
+        ssize_t count;
+        if ( is_write )
+            count = pwrite( fd, buf, nbytes, offset );
+        else
+            count = pread(  fd, buf, nbytes, offset );
+        if ( count < 0 ) {
+            if ( errno == EINTR )
+                continue;
+            return errno;
+        }
+        if ( count == 0 ) {
+            return EIO;  // read past end of file
+        }
+        buf    += count;
+        nbytes -= count;
+        offset += count;
+    }
+    return 0;
+    #endif
+}
+
+
+/***************************************************************************//**
+    Task that reads or writes one block of the matrix; see magma_file_io.
+    @ingroup magma_thread
+*******************************************************************************/
+class magma_file_task: public magma_task
+{
+public:
+    magma_file_task(
+        magma_file_io* io, int fd, off_t offset, magma_int_t lda, size_t elemsize,
+        bool is_write, magma_uplo_t uplo,
+        magma_int_t m, magma_int_t n, magma_int_t i, magma_int_t j,
+        char* B, magma_int_t ldb ):
+        io      ( io       ),
+        fd      ( fd       ),
+        offset  ( offset   ),
+        lda     ( lda      ),
+        elemsize( elemsize ),
+        is_write( is_write ),
+        uplo    ( uplo     ),
+        m( m ), n( n ), i( i ), j( j ),
+        B       ( B        ),
+        ldb     ( ldb      )
+    {}
+
+    virtual void run()
+    {
+        int err = 0;
+        if ( ! is_write && m == lda && ldb == lda ) {
+            // contiguous columns, in one transfer
+            err = disk_transfer( false, fd, B, m*n*elemsize,
+                                 offset + (i + j*lda)*elemsize );
+        }
+        else {
+            for( magma_int_t jj=0; jj < n && err == 0; ++jj ) {
+                // rows [ibegin, iend) of column jj; for writes, only the
+                // uplo part with respect to the diagonal of the whole matrix
+                magma_int_t ibegin = 0, iend = m;
+                if ( uplo == MagmaLower ) {
+                    ibegin = max( 0, min( m, j + jj - i ));
+                }
+                else if ( uplo == MagmaUpper ) {
+                    iend = max( 0, min( m, j + jj - i + 1 ));
+                }
+                if ( iend > ibegin ) {
+                    err = disk_transfer( is_write, fd,
+                                         B + (ibegin + jj*ldb)*elemsize,
+                                         (iend - ibegin)*elemsize,
+                                         offset + (i + ibegin + (j + jj)*lda)*elemsize );
+                }
+            }
+        }
+        io->request_done( err );
+    }
+
+private:
+    magma_file_io* io;
+    int          fd;
+    off_t        offset;
+    off_t        lda;
+    size_t       elemsize;
+    bool         is_write;
+    magma_uplo_t uplo;
+    off_t        m, n, i, j;
+    char*        B;
+    off_t        ldb;
+};
+
+
+/***************************************************************************//**
+    @class magma_file_io
+
+    Purpose
+    -------
+    Asynchronous reads and writes of blocks of a column-major matrix stored in
+    a file, for out-of-core factorizations such as magma_zpotrf_disk.
+
+    A single I/O thread executes requests in the order they are issued, using
+    pread and pwrite, so a request that reads into a buffer may be issued
+    right after one that writes from the same buffer. Each call returns a
+    request number; wait() blocks until that request and all earlier ones
+    have finished, so the caller can compute on one block while the next is
+    read (prefetched).
+
+    Example
+    -------
+    @code
+    magma_file_io io( fd, 0, lda, sizeof(double) );
+    magma_int_t r = io.read( m, nb, 0, j, panel, ldp );
+    // ... compute while panel is read ...
+    io.wait( r );
+    // ... use panel ...
+    io.write( MagmaFull, m, nb, 0, j, panel, ldp );
+    io.sync();
+    if ( io.error() != 0 ) { ... }
+    @endcode
+
+    @ingroup magma_thread
+*******************************************************************************/
+
+
+/***************************************************************************//**
+    Creates object and launches I/O thread.
+
+    @param[in] fd       File descriptor of matrix file, open for read and write.
+    @param[in] offset   Byte offset of A(0,0) in file.
+    @param[in] lda      Leading dimension of A in file.
+    @param[in] elemsize Bytes per element, e.g., sizeof(double).
+*******************************************************************************/
+magma_file_io::magma_file_io( int fd, magma_int_t offset, magma_int_t lda, size_t elemsize ):
+    queue   (),
+    fd      ( fd       ),
+    offset  ( offset   ),
+    lda     ( lda      ),
+    elemsize( elemsize ),
+    nrequest( 0 ),
+    ndone   ( 0 ),
+    err     ( 0 )
+{
+    check( pthread_mutex_init( &mutex, NULL ));
+    check( pthread_cond_init(  &cond,  NULL ));
+    queue.launch( 1 );
+}
+
+
+/***************************************************************************//**
+    Waits for all requests to finish, then exits I/O thread.
+*******************************************************************************/
+magma_file_io::~magma_file_io()
+{
+    queue.quit();
+    check( pthread_mutex_destroy( &mutex ));
+    check( pthread_cond_destroy( &cond ));
+}
+
+
+/***************************************************************************//**
+    Issues read of m-by-n block A(i:i+m-1, j:j+n-1) of file into B.
+
+    @param[in]  m, n    Size of block.
+    @param[in]  i, j    Position of block in matrix.
+    @param[out] B       Array of dimension (ldb,n). Must not be accessed until
+                        the request has finished.
+    @param[in]  ldb     Leading dimension of B. ldb >= m.
+
+    @return request number, for wait().
+*******************************************************************************/
+magma_int_t magma_file_io::read(
+    magma_int_t m, magma_int_t n, magma_int_t i, magma_int_t j,
+    void* B, magma_int_t ldb )
+{
+    nrequest += 1;
+    queue.push_task( new magma_file_task(
+        this, fd, offset, lda, elemsize, false, MagmaFull,
+        m, n, i, j, (char*) B, ldb ));
+    return nrequest;
+}
+
+
+/***************************************************************************//**
+    Issues write of B to m-by-n block A(i:i+m-1, j:j+n-1) of file.
+
+    @param[in] uplo     Part of the block to write:
+                        MagmaLower writes entries on or below the diagonal of A,
+                        MagmaUpper writes entries on or above the diagonal of A,
+                        MagmaFull  writes the whole block.
+    @param[in] m, n     Size of block.
+    @param[in] i, j     Position of block in matrix.
+    @param[in] B        Array of dimension (ldb,n). Must not be modified until
+                        the request has finished.
+    @param[in] ldb      Leading dimension of B. ldb >= m.
+
+    @return request number, for wait().
+*******************************************************************************/
+magma_int_t magma_file_io::write(
+    magma_uplo_t uplo,
+    magma_int_t m, magma_int_t n, magma_int_t i, magma_int_t j,
+    const void* B, magma_int_t ldb )
+{
+    nrequest += 1;
+    queue.push_task( new magma_file_task(
+        this, fd, offset, lda, elemsize, true, uplo,
+        m, n, i, j, (char*) B, ldb ));
+    return nrequest;
+}
+
+
+/***************************************************************************//**
+    Blocks until the given request, and all requests issued before it,
+    have finished.
+    @param[in] request    Request number returned by read() or write().
+*******************************************************************************/
+void magma_file_io::wait( magma_int_t request )
+{
+    check( pthread_mutex_lock( &mutex ));
+    while( ndone < request ) {
+        check( pthread_cond_wait( &cond, &mutex ));
+    }
+    check( pthread_mutex_unlock( &mutex ));
+}
+
+
+/***************************************************************************//**
+    Blocks until all requests have finished.
+*******************************************************************************/
+void magma_file_io::sync()
+{
+    wait( nrequest );
+}
+
+
+/***************************************************************************//**
+    @return errno value of the first request that failed, or 0 if none failed.
+    Only requests that have finished are reflected.
+*******************************************************************************/
+int magma_file_io::error()
+{
+    check( pthread_mutex_lock( &mutex ));
+    int result = err;
+    check( pthread_mutex_unlock( &mutex ));
+    return result;
+}
+
+
+/***************************************************************************//**
+    Called by I/O thread when a request is finished.
+    Signals threads that are waiting in wait().
+*******************************************************************************/
+void magma_file_io::request_done( int request_err )
+{
+    check( pthread_mutex_lock( &mutex ));
+    ndone += 1;
+    if ( err == 0 ) {
+        err = request_err;
+    }
+    check( pthread_cond_broadcast( &cond ));
+    check( pthread_mutex_unlock( &mutex ));
+}
@@ -0,0 +1,52 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_FILE_IO_HPP
+#define MAGMA_FILE_IO_HPP
+
+#include "thread_queue.hpp"
+
+
+/******************************************************************************/
+class magma_file_io
+{
+public:
+    magma_file_io( int fd, magma_int_t offset, magma_int_t lda, size_t elemsize );
+    ~magma_file_io();
+
+    magma_int_t read(
+        magma_int_t m, magma_int_t n, magma_int_t i, magma_int_t j,
+        void* B, magma_int_t ldb );
+
+    magma_int_t write(
+        magma_uplo_t uplo,
+        magma_int_t m, magma_int_t n, magma_int_t i, magma_int_t j,
+        const void* B, magma_int_t ldb );
+
+    void wait( magma_int_t request );
+    void sync();
+    int  error();
+
+protected:
+    friend class magma_file_task;
+    void request_done( int err );
+
+private:
+    magma_thread_queue queue;     ///<  I/O thread; executes requests in order
+    int             fd;           ///<  file descriptor of matrix file
+    magma_int_t     offset;       ///<  byte offset of A(0,0) in file
+    magma_int_t     lda;          ///<  leading dimension of A in file
+    size_t          elemsize;     ///<  bytes per element
+    magma_int_t     nrequest;     ///<  number of requests issued
+    magma_int_t     ndone;        ///<  number of requests finished
+    int             err;          ///<  errno of first failed request, or 0
+    pthread_mutex_t mutex;        ///<  mutex lock for ndone, err
+    pthread_cond_t  cond;         ///<  condition variable for changes to ndone
+};
+
+#endif        //  #ifndef MAGMA_FILE_IO_HPP
@@ -16,8 +16,9 @@
 extern "C" {
 #endif
 
-// Definition of blocking sizes for NVIDIA cards
-#ifdef HAVE_CUBLAS
+// Definition of blocking sizes for NVIDIA cards.
+// The host backend uses the same sizes; magma_getdevice_arch() returns 0 there.
+#if defined(HAVE_CUBLAS) || defined(HAVE_HOST)
 
 // =============================================================================
 /// @addtogroup magma_tuning
@@ -1126,7 +1127,7 @@ magma_int_t magma_get_zbulge_mgpu_nb( magma_int_t n )
 /// @}
 // end group magma_tuning
 
-#endif  // HAVE_CUBLAS
+#endif  // HAVE_CUBLAS || HAVE_HOST
 
 #ifdef __cplusplus
 } // extern "C"
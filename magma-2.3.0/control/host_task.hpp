@@ -0,0 +1,72 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_HOST_TASK_HPP
+#define MAGMA_HOST_TASK_HPP
+
+#ifdef HAVE_HOST
+
+#include <functional>
+
+#include "thread_queue.hpp"
+
+
+/***************************************************************************//**
+    Task wrapping an arbitrary callable, for the host backend.
+    @see magma_host_launch
+    @ingroup magma_thread
+*******************************************************************************/
+class magma_host_task: public magma_task
+{
+public:
+    magma_host_task( const std::function< void() >& func ):
+        func_( func )
+    {}
+
+    virtual void run()
+    {
+        func_();
+    }
+
+private:
+    std::function< void() > func_;
+};
+
+
+/***************************************************************************//**
+    Enqueues func on the queue's worker thread, the host backend's analog of
+    launching a kernel on a CUDA stream. Tasks on one queue execute in order.
+
+    Since func runs asynchronously, it must capture its arguments by value;
+    in particular, host arrays that the caller may modify after the launch
+    (e.g., ipiv) must be copied.
+
+    If queue is NULL, func executes immediately in the calling thread.
+
+    @param[in]
+    queue       Queue to execute in.
+
+    @param[in]
+    func        Callable with signature void().
+
+    @ingroup magma_thread
+*******************************************************************************/
+template< typename Func >
+void magma_host_launch( magma_queue_t queue, Func func )
+{
+    if ( queue == NULL ) {
+        func();
+    }
+    else {
+        queue->host_tasks()->push_task( new magma_host_task( func ));
+    }
+}
+
+#endif // HAVE_HOST
+
+#endif // MAGMA_HOST_TASK_HPP
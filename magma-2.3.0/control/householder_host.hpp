@@ -0,0 +1,445 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_HOUSEHOLDER_HOST_HPP
+#define MAGMA_HOUSEHOLDER_HOST_HPP
+
+#include <string.h>
+#include <vector>
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host Householder engine, used by magma_*geqrt3_cpu and magma_*larfb_cpu,
+    and through them by the CPU panels of the QR factorizations.
+
+    The panel is factored by the recursive QR of Elmroth and Gustavson, as
+    in LAPACK's geqrt3: the left half of the columns is factored, its block
+    reflector is applied to the right half, and the right half is factored;
+    the triangular factor T of the compact WY form
+        H = H(1) H(2) ... H(n) = I - V T V^H
+    is built on the way, T12 = -T11 V1^H V2 T22, so R, V, tau, and T come
+    out of one pass, and no separate larft re-reads V. Except at the
+    leaves (larfg on one column), the work is in GEMMs and small TRMMs. The
+    products with the tall part of V, which dominate for tall panels, are
+    split by rows over the threads: V^H B as a sum of per-thread partial
+    products, and C - V W by independent row blocks.
+
+    larfb packs V once into an m-by-k copy with explicit unit diagonal and
+    zeros above it, so each application is two full GEMMs, with no TRMM on
+    the triangle of V, and the copy is shared by all threads, which each
+    update a block of columns (from the left) or rows (from the right) of
+    C. Applying H from both sides, as in a similarity transform, reuses
+    the same packed V for the left and right applications.
+*******************************************************************************/
+
+/// rows of a panel per thread in products with its tall part, and
+/// columns (Left) or rows (Right) of C per thread in larfb
+const magma_int_t magma_householder_rows = 512;
+
+
+/******************************************************************************/
+// Constants and the host BLAS and LAPACK routines used, for each precision.
+template< typename T >
+struct householder_host_traits;
+
+template<>
+struct householder_host_traits< float >
+{
+    static float zero()    { return MAGMA_S_ZERO; }
+    static float one()     { return MAGMA_S_ONE; }
+    static float neg_one() { return MAGMA_S_NEG_ONE; }
+    static float conj( float a ) { return a; }
+
+    static void larfg( magma_int_t n, float* alpha, float* x, magma_int_t incx, float* tau )
+    {
+        lapackf77_slarfg( &n, alpha, x, &incx, tau );
+    }
+
+    static void axpy( magma_int_t n, float alpha, const float* x, float* y )
+    {
+        const magma_int_t ione = 1;
+        blasf77_saxpy( &n, &alpha, x, &ione, y, &ione );
+    }
+
+    static void gemm(
+        magma_trans_t transA, magma_trans_t transB,
+        magma_int_t m, magma_int_t n, magma_int_t k,
+        float alpha, const float* A, magma_int_t lda,
+                     const float* B, magma_int_t ldb,
+        float beta,        float* C, magma_int_t ldc )
+    {
+        blasf77_sgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    }
+
+    static void trmm(
+        magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+        magma_int_t m, magma_int_t n,
+        float alpha, const float* A, magma_int_t lda,
+                           float* B, magma_int_t ldb )
+    {
+        blasf77_strmm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( transA ), lapack_diag_const( diag ),
+                       &m, &n, &alpha, A, &lda, B, &ldb );
+    }
+};
+
+template<>
+struct householder_host_traits< double >
+{
+    static double zero()    { return MAGMA_D_ZERO; }
+    static double one()     { return MAGMA_D_ONE; }
+    static double neg_one() { return MAGMA_D_NEG_ONE; }
+    static double conj( double a ) { return a; }
+
+    static void larfg( magma_int_t n, double* alpha, double* x, magma_int_t incx, double* tau )
+    {
+        lapackf77_dlarfg( &n, alpha, x, &incx, tau );
+    }
+
+    static void axpy( magma_int_t n, double alpha, const double* x, double* y )
+    {
+        const magma_int_t ione = 1;
+        blasf77_daxpy( &n, &alpha, x, &ione, y, &ione );
+    }
+
+    static void gemm(
+        magma_trans_t transA, magma_trans_t transB,
+        magma_int_t m, magma_int_t n, magma_int_t k,
+        double alpha, const double* A, magma_int_t lda,
+                      const double* B, magma_int_t ldb,
+        double beta,        double* C, magma_int_t ldc )
+    {
+        blasf77_dgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    }
+
+    static void trmm(
+        magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+        magma_int_t m, magma_int_t n,
+        double alpha, const double* A, magma_int_t lda,
+                            double* B, magma_int_t ldb )
+    {
+        blasf77_dtrmm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( transA ), lapack_diag_const( diag ),
+                       &m, &n, &alpha, A, &lda, B, &ldb );
+    }
+};
+
+template<>
+struct householder_host_traits< magmaFloatComplex >
+{
+    static magmaFloatComplex zero()    { return MAGMA_C_ZERO; }
+    static magmaFloatComplex one()     { return MAGMA_C_ONE; }
+    static magmaFloatComplex neg_one() { return MAGMA_C_NEG_ONE; }
+    static magmaFloatComplex conj( magmaFloatComplex a ) { return MAGMA_C_CONJ( a ); }
+
+    static void larfg( magma_int_t n, magmaFloatComplex* alpha, magmaFloatComplex* x,
+                       magma_int_t incx, magmaFloatComplex* tau )
+    {
+        lapackf77_clarfg( &n, alpha, x, &incx, tau );
+    }
+
+    static void axpy( magma_int_t n, magmaFloatComplex alpha,
+                      const magmaFloatComplex* x, magmaFloatComplex* y )
+    {
+        const magma_int_t ione = 1;
+        blasf77_caxpy( &n, &alpha, x, &ione, y, &ione );
+    }
+
+    static void gemm(
+        magma_trans_t transA, magma_trans_t transB,
+        magma_int_t m, magma_int_t n, magma_int_t k,
+        magmaFloatComplex alpha, const magmaFloatComplex* A, magma_int_t lda,
+                                 const magmaFloatComplex* B, magma_int_t ldb,
+        magmaFloatComplex beta,        magmaFloatComplex* C, magma_int_t ldc )
+    {
+        blasf77_cgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    }
+
+    static void trmm(
+        magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+        magma_int_t m, magma_int_t n,
+        magmaFloatComplex alpha, const magmaFloatComplex* A, magma_int_t lda,
+                                       magmaFloatComplex* B, magma_int_t ldb )
+    {
+        blasf77_ctrmm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( transA ), lapack_diag_const( diag ),
+                       &m, &n, &alpha, A, &lda, B, &ldb );
+    }
+};
+
+template<>
+struct householder_host_traits< magmaDoubleComplex >
+{
+    static magmaDoubleComplex zero()    { return MAGMA_Z_ZERO; }
+    static magmaDoubleComplex one()     { return MAGMA_Z_ONE; }
+    static magmaDoubleComplex neg_one() { return MAGMA_Z_NEG_ONE; }
+    static magmaDoubleComplex conj( magmaDoubleComplex a ) { return MAGMA_Z_CONJ( a ); }
+
+    static void larfg( magma_int_t n, magmaDoubleComplex* alpha, magmaDoubleComplex* x,
+                       magma_int_t incx, magmaDoubleComplex* tau )
+    {
+        lapackf77_zlarfg( &n, alpha, x, &incx, tau );
+    }
+
+    static void axpy( magma_int_t n, magmaDoubleComplex alpha,
+                      const magmaDoubleComplex* x, magmaDoubleComplex* y )
+    {
+        const magma_int_t ione = 1;
+        blasf77_zaxpy( &n, &alpha, x, &ione, y, &ione );
+    }
+
+    static void gemm(
+        magma_trans_t transA, magma_trans_t transB,
+        magma_int_t m, magma_int_t n, magma_int_t k,
+        magmaDoubleComplex alpha, const magmaDoubleComplex* A, magma_int_t lda,
+                                  const magmaDoubleComplex* B, magma_int_t ldb,
+        magmaDoubleComplex beta,        magmaDoubleComplex* C, magma_int_t ldc )
+    {
+        blasf77_zgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    }
+
+    static void trmm(
+        magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+        magma_int_t m, magma_int_t n,
+        magmaDoubleComplex alpha, const magmaDoubleComplex* A, magma_int_t lda,
+                                        magmaDoubleComplex* B, magma_int_t ldb )
+    {
+        blasf77_ztrmm( lapack_side_const( side ), lapack_uplo_const( uplo ),
+                       lapack_trans_const( transA ), lapack_diag_const( diag ),
+                       &m, &n, &alpha, A, &lda, B, &ldb );
+    }
+};
+
+
+/******************************************************************************/
+// Number of blocks of at least magma_householder_rows that len is split
+// into, at most one per thread.
+static inline magma_int_t householder_host_nparts( magma_int_t len )
+{
+    #ifdef _OPENMP
+    magma_int_t nthreads = omp_get_max_threads();
+    #else
+    magma_int_t nthreads = 1;
+    #endif
+    return max( 1, min( nthreads, len / magma_householder_rows ));
+}
+
+
+/******************************************************************************/
+// C += A^H * B, for the m-by-n1 A, m-by-n2 B, and small n1-by-n2 C.
+// For tall A and B, the rows are split over the threads, each computing
+// a partial product, which are then summed into C.
+template< typename T >
+static void householder_host_gemm_ct(
+    magma_int_t m, magma_int_t n1, magma_int_t n2,
+    const T* A, magma_int_t lda,
+    const T* B, magma_int_t ldb,
+    T* C, magma_int_t ldc )
+{
+    typedef householder_host_traits< T > traits;
+    const T c_one  = traits::one();
+    const T c_zero = traits::zero();
+
+    magma_int_t nparts = householder_host_nparts( m );
+    if (nparts == 1) {
+        traits::gemm( MagmaConjTrans, MagmaNoTrans, n1, n2, m,
+                      c_one, A, lda, B, ldb, c_one, C, ldc );
+        return;
+    }
+
+    magma_int_t chunk = magma_ceildiv( m, nparts );
+    std::vector< T > W( nparts*n1*n2 );
+    #pragma omp parallel for schedule(static, 1)
+    for (magma_int_t p = 0; p < nparts; ++p) {
+        magma_int_t i  = p*chunk;
+        magma_int_t ib = min( chunk, m - i );
+        traits::gemm( MagmaConjTrans, MagmaNoTrans, n1, n2, ib,
+                      c_one, A + i, lda, B + i, ldb, c_zero, &W[ p*n1*n2 ], n1 );
+    }
+    // summed in a fixed order, so the result doesn't depend on timing
+    for (magma_int_t p = 0; p < nparts; ++p) {
+        for (magma_int_t j = 0; j < n2; ++j) {
+            traits::axpy( n1, c_one, &W[ p*n1*n2 + j*n1 ], C + j*ldc );
+        }
+    }
+}
+
+
+/******************************************************************************/
+// C -= A * B, for the tall m-by-k A, small k-by-n B, and m-by-n C,
+// split by rows over the threads.
+template< typename T >
+static void householder_host_gemm_nn(
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    const T* A, magma_int_t lda,
+    const T* B, magma_int_t ldb,
+    T* C, magma_int_t ldc )
+{
+    typedef householder_host_traits< T > traits;
+    const T c_one     = traits::one();
+    const T c_neg_one = traits::neg_one();
+
+    magma_int_t nparts = householder_host_nparts( m );
+    magma_int_t chunk  = magma_ceildiv( m, nparts );
+    #pragma omp parallel for schedule(static, 1) if (nparts > 1)
+    for (magma_int_t p = 0; p < nparts; ++p) {
+        magma_int_t i  = p*chunk;
+        magma_int_t ib = min( chunk, m - i );
+        traits::gemm( MagmaNoTrans, MagmaNoTrans, ib, n, k,
+                      c_neg_one, A + i, lda, B, ldb, c_one, C + i, ldc );
+    }
+}
+
+
+/******************************************************************************/
+// Recursive QR of the m-by-n A, m >= n, as in LAPACK's geqrt3: on exit,
+// R is above the diagonal of A, V below it (unit diagonal not stored),
+// and T, n-by-n upper triangular, is the triangular factor of H;
+// tau(i) = T(i,i). The strictly lower triangle of T is not referenced.
+template< typename T >
+static void householder_host_geqrt3(
+    magma_int_t m, magma_int_t n,
+    T* A, magma_int_t lda,
+    T* Tm, magma_int_t ldt )
+{
+    typedef householder_host_traits< T > traits;
+    const T c_one     = traits::one();
+    const T c_neg_one = traits::neg_one();
+
+    if (n == 1) {
+        traits::larfg( m, A, A + min( 1, m-1 ), 1, Tm );
+        return;
+    }
+
+    magma_int_t n1 = n/2;
+    magma_int_t n2 = n - n1;
+    T* A12 = A + n1*lda;
+    T* A21 = A + n1;
+    T* A22 = A + n1 + n1*lda;
+    T* T12 = Tm + n1*ldt;
+    T* T22 = Tm + n1 + n1*ldt;
+
+    // factor the left half, [A11; A21] = Q1 R11
+    householder_host_geqrt3( m, n1, A, lda, Tm, ldt );
+
+    // [A12; A22] = Q1^H [A12; A22] = (I - V1 T11^H V1^H) [A12; A22],
+    // with W = T11^H V1^H [A12; A22] in T12
+    for (magma_int_t j = 0; j < n2; ++j) {
+        memcpy( T12 + j*ldt, A12 + j*lda, n1*sizeof(T) );
+    }
+    traits::trmm( MagmaLeft, MagmaLower, MagmaConjTrans, MagmaUnit, n1, n2,
+                  c_one, A, lda, T12, ldt );
+    householder_host_gemm_ct( m-n1, n1, n2, A21, lda, A22, lda, T12, ldt );
+    traits::trmm( MagmaLeft, MagmaUpper, MagmaConjTrans, MagmaNonUnit, n1, n2,
+                  c_one, Tm, ldt, T12, ldt );
+    householder_host_gemm_nn( m-n1, n2, n1, A21, lda, T12, ldt, A22, lda );
+    traits::trmm( MagmaLeft, MagmaLower, MagmaNoTrans, MagmaUnit, n1, n2,
+                  c_one, A, lda, T12, ldt );
+    for (magma_int_t j = 0; j < n2; ++j) {
+        traits::axpy( n1, c_neg_one, T12 + j*ldt, A12 + j*lda );
+    }
+
+    // factor the right half, A22 = Q2 R22
+    householder_host_geqrt3( m-n1, n2, A22, lda, T22, ldt );
+
+    // T12 = -T11 V1^H V2 T22; rows n1:n of V1 are against the triangle of V2
+    for (magma_int_t j = 0; j < n2; ++j) {
+        for (magma_int_t i = 0; i < n1; ++i) {
+            T12[ i + j*ldt ] = traits::conj( A21[ j + i*lda ] );
+        }
+    }
+    traits::trmm( MagmaRight, MagmaLower, MagmaNoTrans, MagmaUnit, n1, n2,
+                  c_one, A22, lda, T12, ldt );
+    householder_host_gemm_ct( m-n, n1, n2, A + n, lda, A22 + n2, lda, T12, ldt );
+    traits::trmm( MagmaLeft, MagmaUpper, MagmaNoTrans, MagmaNonUnit, n1, n2,
+                  c_neg_one, Tm, ldt, T12, ldt );
+    traits::trmm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaNonUnit, n1, n2,
+                  c_one, T22, ldt, T12, ldt );
+}
+
+
+/******************************************************************************/
+// Copies the m-by-k unit lower trapezoid V to Vp, with leading dimension m,
+// setting its unit diagonal and the zeros above it.
+template< typename T >
+static void householder_host_pack_v(
+    magma_int_t m, magma_int_t k,
+    const T* V, magma_int_t ldv, T* Vp )
+{
+    const T c_one = householder_host_traits< T >::one();
+    for (magma_int_t j = 0; j < k; ++j) {
+        memset( Vp + j*m, 0, min( j, m )*sizeof(T) );
+        if (j < m) {
+            Vp[ j + j*m ] = c_one;
+            memcpy( Vp + j+1 + j*m, V + j+1 + j*ldv, (m - j - 1)*sizeof(T) );
+        }
+    }
+}
+
+
+/******************************************************************************/
+// Applies H = I - V T V^H, or H^H, to the m-by-n C from the left (side =
+// Left, Vp is m-by-k) or right (side = Right, Vp is n-by-k), with Vp from
+// householder_host_pack_v. Blocks of columns (Left) or rows (Right) of C
+// are updated in parallel, each with its own k-by-block workspace.
+template< typename T >
+static void householder_host_larfb(
+    magma_side_t side, magma_trans_t trans,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    const T* Vp, const T* Tm, magma_int_t ldt,
+    T* C, magma_int_t ldc )
+{
+    typedef householder_host_traits< T > traits;
+    const T c_one     = traits::one();
+    const T c_neg_one = traits::neg_one();
+    const T c_zero    = traits::zero();
+
+    magma_int_t len    = (side == MagmaLeft ? n : m);
+    magma_int_t nparts = householder_host_nparts( len );
+    magma_int_t chunk  = magma_ceildiv( len, nparts );
+
+    #pragma omp parallel for schedule(static, 1) if (nparts > 1)
+    for (magma_int_t p = 0; p < nparts; ++p) {
+        magma_int_t j  = p*chunk;
+        magma_int_t jb = min( chunk, len - j );
+        std::vector< T > W( k*jb );
+        if (side == MagmaLeft) {
+            // W = op(T) V^H C, C -= V W, where op(T) = T^H for H^H, T for H
+            T* Cj = C + j*ldc;
+            traits::gemm( MagmaConjTrans, MagmaNoTrans, k, jb, m,
+                          c_one, Vp, m, Cj, ldc, c_zero, &W[0], k );
+            traits::trmm( MagmaLeft, MagmaUpper,
+                          (trans == MagmaNoTrans ? MagmaNoTrans : MagmaConjTrans),
+                          MagmaNonUnit, k, jb, c_one, Tm, ldt, &W[0], k );
+            traits::gemm( MagmaNoTrans, MagmaNoTrans, m, jb, k,
+                          c_neg_one, Vp, m, &W[0], k, c_one, Cj, ldc );
+        }
+        else {
+            // W = C V op(T), C -= W V^H, where op(T) = T for H, T^H for H^H
+            T* Cj = C + j;
+            traits::gemm( MagmaNoTrans, MagmaNoTrans, jb, k, n,
+                          c_one, Cj, ldc, Vp, n, c_zero, &W[0], jb );
+            traits::trmm( MagmaRight, MagmaUpper,
+                          (trans == MagmaNoTrans ? MagmaNoTrans : MagmaConjTrans),
+                          MagmaNonUnit, jb, k, c_one, Tm, ldt, &W[0], jb );
+            traits::gemm( MagmaNoTrans, MagmaConjTrans, jb, n, k,
+                          c_neg_one, &W[0], jb, Vp, n, c_one, Cj, ldc );
+        }
+    }
+}
+
+#endif // MAGMA_HOUSEHOLDER_HOST_HPP
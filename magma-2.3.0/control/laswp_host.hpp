@@ -0,0 +1,255 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_LASWP_HOST_HPP
+#define MAGMA_LASWP_HOST_HPP
+
+// STL headers first; if a caller already included magma_internal.h,
+// its min, max macros are lifted around them
+#pragma push_macro("min")
+#pragma push_macro("max")
+#undef min
+#undef max
+#include <algorithm>
+#include <vector>
+#pragma pop_macro("max")
+#pragma pop_macro("min")
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host row interchange (laswp) engine, used by magmablas_*laswp* with the
+    host backend and by host drivers in place of lapackf77_*laswp.
+
+    LAPACK's laswp applies the interchanges one at a time, each across the
+    whole width. Here the sequence of interchanges is first composed into
+    the permutation it produces (magma_laswp_plan), decomposed into cycles;
+    each cycle of length L moves its rows with L+1 copies, using one
+    temporary row, instead of 3(L-1) for its L-1 swaps. The permutation is
+    then applied to blocks of columns, in parallel, with all interchanges
+    done on a block while it is in cache.
+    The moved rows are usually read right away (by trsm and gemm in LU), so
+    regular stores are used rather than streaming stores, which would evict
+    them from cache.
+*******************************************************************************/
+
+/// default number of columns in a block
+const magma_int_t magma_laswp_nb_cols = 256;
+
+
+/***************************************************************************//**
+    Permutation of rows from a sequence of interchanges:
+    for i = 0, ..., npiv-1, row k0 + i is interchanged with row
+    base + ipiv[ i*inci ] - 1 (ipiv is one based).
+    For LAPACK's laswp with pivots k1 to k2, use k0 = k1-1,
+    npiv = k2-k1+1, ipiv + (k1-1)*inci, and base = 0.
+
+    Rows are zero based. The rows that move are stored as cycles:
+    row cycle(c)[i] receives row cycle(c)[i+1], and the last row of the
+    cycle receives the first.
+*******************************************************************************/
+class magma_laswp_plan
+{
+public:
+    magma_laswp_plan(
+        magma_int_t k0, magma_int_t npiv,
+        const magma_int_t* ipiv, magma_int_t inci, magma_int_t base=0 )
+    {
+        start_.push_back( 0 );
+        if (npiv <= 0)
+            return;
+
+        // range of rows touched
+        magma_int_t lo = k0, hi = k0 + npiv - 1;
+        for (magma_int_t i = 0; i < npiv; ++i) {
+            magma_int_t p = base + ipiv[ i*inci ] - 1;
+            lo = min( lo, p );
+            hi = max( hi, p );
+        }
+
+        // src[ r - lo ] is the original row that ends up in row r
+        std::vector< magma_int_t > src( hi - lo + 1 );
+        for (magma_int_t r = lo; r <= hi; ++r)
+            src[ r - lo ] = r;
+        for (magma_int_t i = 0; i < npiv; ++i) {
+            magma_int_t p = base + ipiv[ i*inci ] - 1;
+            std::swap( src[ k0 + i - lo ], src[ p - lo ] );
+        }
+
+        // cycles; visited rows are marked by src = -1
+        for (magma_int_t r = lo; r <= hi; ++r) {
+            if (src[ r - lo ] < 0 || src[ r - lo ] == r)
+                continue;
+            magma_int_t s = r;
+            do {
+                rows_.push_back( s );
+                magma_int_t next = src[ s - lo ];
+                src[ s - lo ] = -1;
+                s = next;
+            } while (s != r);
+            start_.push_back( rows_.size() );
+        }
+    }
+
+    /// true if the interchanges leave every row in place
+    bool empty() const { return rows_.empty(); }
+
+    /// number of cycles, and the rows and length of cycle c
+    magma_int_t num_cycles() const { return start_.size() - 1; }
+    const magma_int_t* cycle( magma_int_t c ) const { return &rows_[ start_[c] ]; }
+    magma_int_t cycle_length( magma_int_t c ) const { return start_[c+1] - start_[c]; }
+
+    /// offset of each moved row, in cycle order, for a layout given by
+    /// row_offset( r ); e.g., r for column-major, r*ldda for row-major.
+    template< typename RowOffset >
+    std::vector< magma_int_t > offsets( RowOffset row_offset ) const
+    {
+        std::vector< magma_int_t > off( rows_.size() );
+        for (size_t i = 0; i < rows_.size(); ++i)
+            off[i] = row_offset( rows_[i] );
+        return off;
+    }
+
+private:
+    std::vector< magma_int_t > rows_;   // rows of all cycles, one after another
+    std::vector< magma_int_t > start_;  // cycle c is rows_[ start_[c] : start_[c+1]-1 ]
+};
+
+
+/******************************************************************************/
+// Applies plan to nj contiguous elements of each row, where row r starts at
+// A + off[r's index in the plan]; tmp has nj elements. For row-major A.
+template< typename T >
+void magma_laswp_host_rows_block(
+    const magma_laswp_plan& plan, const magma_int_t* off,
+    magma_int_t nj, T* A, T* tmp )
+{
+    const magma_int_t* o = off;
+    for (magma_int_t c = 0; c < plan.num_cycles(); ++c) {
+        magma_int_t len = plan.cycle_length( c );
+        std::copy( A + o[0], A + o[0] + nj, tmp );
+        for (magma_int_t i = 0; i < len-1; ++i)
+            std::copy( A + o[i+1], A + o[i+1] + nj, A + o[i] );
+        std::copy( tmp, tmp + nj, A + o[len-1] );
+        o += len;
+    }
+}
+
+
+/******************************************************************************/
+// Applies plan to nj columns, with stride lda, where element (r, j) is at
+// A + off[r's index in the plan] + j*lda. For column-major and tile layouts.
+template< typename T >
+void magma_laswp_host_cols_block(
+    const magma_laswp_plan& plan, const magma_int_t* off,
+    magma_int_t nj, T* A, magma_int_t lda )
+{
+    for (magma_int_t j = 0; j < nj; ++j) {
+        T* a = A + j*lda;
+        const magma_int_t* o = off;
+        for (magma_int_t c = 0; c < plan.num_cycles(); ++c) {
+            magma_int_t len = plan.cycle_length( c );
+            T t = a[ o[0] ];
+            for (magma_int_t i = 0; i < len-1; ++i)
+                a[ o[i] ] = a[ o[i+1] ];
+            a[ o[len-1] ] = t;
+            o += len;
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Applies plan to an n-column matrix AT stored row-wise (element (i,j) at
+    AT[ i*ldda + j ]), as magmablas_*laswp does, in parallel over blocks of
+    nb_cols columns.
+*******************************************************************************/
+template< typename T >
+void magma_laswp_host_rows(
+    const magma_laswp_plan& plan, magma_int_t n, T* AT, magma_int_t ldda,
+    magma_int_t nb_cols=magma_laswp_nb_cols )
+{
+    if (plan.empty() || n <= 0)
+        return;
+
+    std::vector< magma_int_t > off = plan.offsets(
+        [ldda]( magma_int_t r ) { return r*ldda; } );
+    magma_int_t nblocks = magma_ceildiv( n, nb_cols );
+    #pragma omp parallel if ( nblocks > 1 )
+    {
+        std::vector< T > tmp( nb_cols );
+        #pragma omp for schedule(static)
+        for (magma_int_t jb = 0; jb < nblocks; ++jb) {
+            magma_int_t j0 = jb*nb_cols;
+            magma_int_t nj = min( nb_cols, n - j0 );
+            magma_laswp_host_rows_block( plan, &off[0], nj, AT + j0, &tmp[0] );
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Applies plan to the n columns of A, where element (r, j) is at
+    A[ row_offset( r ) + j*lda ]; row_offset( r ) = r for column-major A,
+    as lapackf77_*laswp does. In parallel over blocks of nb_cols columns.
+*******************************************************************************/
+template< typename T, typename RowOffset >
+void magma_laswp_host_cols(
+    const magma_laswp_plan& plan, magma_int_t n, T* A, magma_int_t lda,
+    RowOffset row_offset, magma_int_t nb_cols=magma_laswp_nb_cols )
+{
+    if (plan.empty() || n <= 0)
+        return;
+
+    std::vector< magma_int_t > off = plan.offsets( row_offset );
+    magma_int_t nblocks = magma_ceildiv( n, nb_cols );
+    #pragma omp parallel for schedule(static) if ( nblocks > 1 )
+    for (magma_int_t jb = 0; jb < nblocks; ++jb) {
+        magma_int_t j0 = jb*nb_cols;
+        magma_int_t nj = min( nb_cols, n - j0 );
+        magma_laswp_host_cols_block( plan, &off[0], nj, A + j0*lda, lda );
+    }
+}
+
+template< typename T >
+void magma_laswp_host_cols(
+    const magma_laswp_plan& plan, magma_int_t n, T* A, magma_int_t lda )
+{
+    magma_laswp_host_cols( plan, n, A, lda, []( magma_int_t r ) { return r; } );
+}
+
+
+/***************************************************************************//**
+    Fused row interchanges and triangular solve, for the LU look-ahead:
+    applies plan to the n columns of A (layout as in magma_laswp_host_cols)
+    and calls trsm( j0, nj ) to solve with the diagonal block of L for
+    columns j0:j0+nj-1, one block of nb_cols columns at a time, so the solve
+    reads each block while it is in cache from the interchanges.
+    trsm is typically a lambda calling blasf77_*trsm on those columns.
+    Sequential; callers run it as one task, or on a share of the columns.
+*******************************************************************************/
+template< typename T, typename RowOffset, typename Trsm >
+void magma_laswp_trsm_host_cols(
+    const magma_laswp_plan& plan, magma_int_t n, T* A, magma_int_t lda,
+    RowOffset row_offset, Trsm trsm,
+    magma_int_t nb_cols=magma_laswp_nb_cols )
+{
+    std::vector< magma_int_t > off = plan.offsets( row_offset );
+    for (magma_int_t j0 = 0; j0 < n; j0 += nb_cols) {
+        magma_int_t nj = min( nb_cols, n - j0 );
+        if (! plan.empty())
+            magma_laswp_host_cols_block( plan, off.data(), nj, A + j0*lda, lda );
+        trsm( j0, nj );
+    }
+}
+
+#endif // MAGMA_LASWP_HOST_HPP
@@ -0,0 +1,105 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+#include <math.h>
+#include <stdlib.h>
+
+#include "lookahead.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    @param[in]
+    nt          Number of panels, i.e., block columns that are factored.
+
+    @param[in]
+    max_depth   Maximum depth; if <= 0, get_max_depth().
+*******************************************************************************/
+magma_lookahead::magma_lookahead( magma_int_t nt, magma_int_t max_depth ):
+    m_nt( nt ),
+    m_max_depth( max_depth > 0 ? max_depth : get_max_depth() ),
+    m_t( 0 ),
+    m_panel( 0 ),
+    m_flops( 0 ),
+    m_seconds( 0 ),
+    m_applied( nt, 0 )
+{}
+
+
+/***************************************************************************//**
+    @return $MAGMA_LOOKAHEAD if it is set to a positive number, else 4.
+*******************************************************************************/
+magma_int_t magma_lookahead::get_max_depth()
+{
+    magma_int_t depth = 4;
+    const char* str = getenv( "MAGMA_LOOKAHEAD" );
+    if ( str != NULL && atoi( str ) > 0 ) {
+        depth = atoi( str );
+    }
+    return depth;
+}
+
+
+/***************************************************************************//**
+    Records the time of a step's panel: its look-ahead update, transfers,
+    and factorization.
+*******************************************************************************/
+void magma_lookahead::panel( double seconds )
+{
+    m_panel = seconds;
+}
+
+
+/***************************************************************************//**
+    Records device work of known flops, to estimate the device rate.
+*******************************************************************************/
+void magma_lookahead::device( double flops, double seconds )
+{
+    if ( flops > 0 && seconds > 0 ) {
+        m_flops   += flops;
+        m_seconds += seconds;
+    }
+}
+
+
+/***************************************************************************//**
+    @return depth that the measurements call for, given the flops of the
+    next trailing update: its estimated time over the panel time, rounded
+    up, in [1, max_depth]. Before any measurement, 1.
+*******************************************************************************/
+magma_int_t magma_lookahead::depth( double update_flops ) const
+{
+    if ( m_flops <= 0 || m_panel <= 0 ) {
+        return 1;
+    }
+    double update = update_flops / (m_flops / m_seconds);
+    double ratio  = ceil( update / m_panel );
+    return magma_int_t( max( 1., min( double( m_max_depth ), ratio )));
+}
+
+
+/***************************************************************************//**
+    Ends step j, after its panel is factored.
+
+    @param[in]
+    j               Panel index, 0 <= j < nt, in increasing order.
+
+    @param[in]
+    update_flops    Flops of step j's update of the whole trailing matrix.
+
+    @return t, the first block column of step j's trailing update;
+            j+1 < t <= nt, unless j+1 = nt. If t = nt, only the columns
+            right of the last panel, if any, are left to update.
+*******************************************************************************/
+magma_int_t magma_lookahead::trailing( magma_int_t j, double update_flops )
+{
+    magma_int_t t = min( m_nt, j + 1 + depth( update_flops ));
+    m_t = max( m_t, t );
+    for( magma_int_t c = m_t; c < m_nt; ++c ) {
+        m_applied[c] = j + 1;
+    }
+    return m_t;
+}
@@ -0,0 +1,73 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_LOOKAHEAD_HPP
+#define MAGMA_LOOKAHEAD_HPP
+
+#include <vector>
+
+#include "magma_internal.h"
+
+
+/***************************************************************************//**
+    Adaptive look-ahead depth of the hybrid one-sided factorizations,
+    magma_*potrf_gpu and magma_*getrf_gpu.
+
+    At step j, the host factors panel j while the device applies it to the
+    trailing matrix. The block columns j+1, ..., t-1 form the look-ahead
+    window: the trailing update of step j skips them, and each is brought
+    up to date only just before its own panel factorization, by the panels
+    it missed. So panel j+1 waits only for trailing updates issued at least
+    depth = t - j - 1 steps earlier, and up to depth panels are in flight
+    ahead of the trailing updates.
+
+    The driver measures each step: the panel time, from issuing the
+    look-ahead update until the host has factored the panel, and the
+    device time and flops of that update. The depth follows the ratio of
+    the trailing update time, at the measured device rate, to the panel
+    time: how many panels fit in one update, from 1 to max_depth. While
+    updates dominate, the window grows, building a backlog of trailing
+    updates on the device; as the trailing matrix shrinks and panels
+    dominate, the window does not grow, but the host keeps factoring
+    panels while the device drains that backlog. The window never shrinks
+    from the right: t is nondecreasing, so block column c gets the panels
+    of steps 0, ..., applied(c)-1 from the trailing updates and the rest
+    from its look-ahead update.
+
+    The maximum depth is $MAGMA_LOOKAHEAD if set, else 4; 1 gives the
+    fixed depth-1 look-ahead.
+    @ingroup magma_lookahead
+*******************************************************************************/
+class magma_lookahead
+{
+public:
+    magma_lookahead( magma_int_t nt, magma_int_t max_depth = 0 );
+
+    static magma_int_t get_max_depth();
+
+    magma_int_t max_depth() const { return m_max_depth; }
+
+    void panel( double seconds );
+    void device( double flops, double seconds );
+    magma_int_t depth( double update_flops ) const;
+
+    magma_int_t trailing( magma_int_t j, double update_flops );
+
+    /// Number of steps whose trailing updates included block column c.
+    magma_int_t applied( magma_int_t c ) const { return m_applied[c]; }
+
+private:
+    magma_int_t m_nt;
+    magma_int_t m_max_depth;
+    magma_int_t m_t;                       // window end of the last step
+    double m_panel;                        // seconds of the last panel
+    double m_flops, m_seconds;             // device totals
+    std::vector< magma_int_t > m_applied;  // by block column
+};
+
+#endif // MAGMA_LOOKAHEAD_HPP
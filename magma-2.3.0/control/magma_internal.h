@@ -65,6 +65,10 @@
 #include "magma_operators.h"
 #include "magma_threadsetting.h"
 
+#if defined(HAVE_HOST) && defined(__cplusplus)
+class magma_thread_queue;
+#endif
+
 /***************************************************************************//**
     Define magma_queue structure, which wraps around CUDA and OpenCL queues.
     In C, this is a simple struct.
@@ -103,6 +107,12 @@ public:
     cusparseHandle_t cusparse_handle() { return cusparse__; }
     #endif
 
+    #ifdef HAVE_HOST
+    /// @return worker thread executing this queue's tasks in order;
+    /// requires the host backend. See magma_host_launch().
+    magma_thread_queue* host_tasks()   { return tasks__;    }
+    #endif
+
 protected:
     friend
     void magma_queue_create_internal(
@@ -136,6 +146,10 @@ protected:
     cublasHandle_t   cublas__;      // associated cuBLAS handle
     cusparseHandle_t cusparse__;    // associated cuSparse handle
     #endif
+
+    #if defined(HAVE_HOST) && defined(__cplusplus)
+    magma_thread_queue* tasks__;    // associated in-order worker thread
+    #endif
 };
 
 #ifdef __cplusplus
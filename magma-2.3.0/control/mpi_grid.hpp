@@ -0,0 +1,109 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_MPI_GRID_HPP
+#define MAGMA_MPI_GRID_HPP
+
+#if defined(HAVE_MPI)
+
+#include <limits.h>
+#include <algorithm>
+#include <vector>
+
+#include <mpi.h>
+
+#include "magma_internal.h"
+
+/***************************************************************************//**
+    Process grid of the distributed-memory drivers, magma_*potrf_dist and
+    magma_*getrf_dist, on a magma_bcyclic_t layout. Rank r of comm is
+    participant r, at grid row pr = r % p and grid column pc = r / p.
+    row_comm holds the q ranks of its grid row, ordered by grid column,
+    and col_comm the p ranks of its grid column, ordered by grid row, so a
+    panel travels along a grid row, or a grid column, by one broadcast.
+
+    Messages are counted in elements of type, which is elem_size bytes,
+    so the drivers need no MPI type for each precision; int_type is one
+    magma_int_t, for pivots and info.
+
+    MPI progresses non-blocking collectives only inside MPI calls, unless
+    it has a progress thread, so the drivers call progress() between the
+    local updates that the broadcasts of the next panel overlap.
+*******************************************************************************/
+class magma_mpi_grid
+{
+public:
+    magma_mpi_grid( const magma_bcyclic_t *desc, MPI_Comm comm_, size_t elem_size )
+        : comm( comm_ ),
+          p( desc->p ),
+          q( desc->q )
+    {
+        MPI_Comm_rank( comm, &rank );
+        MPI_Comm_size( comm, &nprocs );
+        pr = rank % p;
+        pc = rank / p;
+        MPI_Comm_split( comm, int(pr), int(pc), &row_comm );
+        MPI_Comm_split( comm, int(pc), int(pr), &col_comm );
+        MPI_Type_contiguous( int(elem_size), MPI_BYTE, &type );
+        MPI_Type_commit( &type );
+        MPI_Type_contiguous( int(sizeof(magma_int_t)), MPI_BYTE, &int_type );
+        MPI_Type_commit( &int_type );
+    }
+
+    ~magma_mpi_grid()
+    {
+        MPI_Type_free( &int_type );
+        MPI_Type_free( &type );
+        MPI_Comm_free( &col_comm );
+        MPI_Comm_free( &row_comm );
+    }
+
+    /// Waits for all requests, and clears them.
+    static void wait( std::vector< MPI_Request >& requests )
+    {
+        if (! requests.empty()) {
+            MPI_Waitall( int(requests.size()), &requests[0], MPI_STATUSES_IGNORE );
+            requests.clear();
+        }
+    }
+
+    /// Returns whether all requests are done, progressing them.
+    static bool progress( std::vector< MPI_Request >& requests )
+    {
+        int done = 1;
+        if (! requests.empty()) {
+            MPI_Testall( int(requests.size()), &requests[0], &done, MPI_STATUSES_IGNORE );
+        }
+        return done != 0;
+    }
+
+    /// Sets info on all ranks to the smallest positive info of any rank,
+    /// i.e., the first failure, as in LAPACK, or 0 if none failed.
+    void reduce_info( magma_int_t *info ) const
+    {
+        const long long none = LLONG_MAX;
+        long long linfo = (*info > 0 ? *info : none);
+        long long ginfo;
+        MPI_Allreduce( &linfo, &ginfo, 1, MPI_LONG_LONG, MPI_MIN, comm );
+        *info = (ginfo != none ? magma_int_t( ginfo ) : 0);
+    }
+
+    MPI_Comm comm, row_comm, col_comm;
+    MPI_Datatype type, int_type;
+    int rank, nprocs;
+    magma_int_t p, q, pr, pc;
+
+private:
+    // not copyable
+    magma_mpi_grid( const magma_mpi_grid& );
+    magma_mpi_grid& operator = ( const magma_mpi_grid& );
+};
+
+#endif // HAVE_MPI
+
+#endif // MAGMA_MPI_GRID_HPP
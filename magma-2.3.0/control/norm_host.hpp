@@ -0,0 +1,447 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_NORM_HOST_HPP
+#define MAGMA_NORM_HOST_HPP
+
+// STL headers first; if a caller already included magma_internal.h,
+// its min, max macros are lifted around them
+#pragma push_macro("min")
+#pragma push_macro("max")
+#undef min
+#undef max
+#include <cmath>
+#include <limits>
+#include <vector>
+#pragma pop_macro("max")
+#pragma pop_macro("min")
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host matrix norm engine, used by magma_*lange_cpu, magma_*lanhe_cpu,
+    magma_*lansy_cpu, and the host backend's magmablas_*lange and *lanhe.
+
+    The max, one, infinity, and Frobenius norms are computed together in
+    one pass over the matrix, in parallel over columns, each thread keeping
+    its own row sums for the infinity norm. The symmetric and Hermitian
+    versions read one triangle; each off-diagonal element is added to both
+    its column sum and its row sum, and twice to the sum of squares.
+
+    Columns are processed in chunks that stay in cache. If a chunk's
+    largest entry is in the safe range, squares are summed without scaling,
+    vectorized. Otherwise (huge, tiny, or Inf entries) the chunk takes a
+    scaled path, as in LAPACK's lassq, so the Frobenius norm never overflows
+    or underflows unless the result does. For real matrices the range is
+    checked after the vectorized loop, redoing only the sum of squares if
+    needed; for complex, |a| = sqrt( re^2 + im^2 ) may itself overflow, so
+    the range is checked first. NaN propagates to every norm, as in LAPACK.
+*******************************************************************************/
+
+/// number of elements of a column processed at a time
+const magma_int_t magma_norm_chunk = 4096;
+
+/// indices of the norms in the array returned by magma_*_all_cpu
+enum {
+    magma_norm_max = 0,
+    magma_norm_one = 1,
+    magma_norm_inf = 2,
+    magma_norm_fro = 3
+};
+
+
+/******************************************************************************/
+// Real and imaginary parts, and whether T is complex.
+template< typename T >
+struct norm_host_traits
+{
+    typedef T real_t;
+    static const bool is_complex = false;
+    static real_t re( T a ) { return a; }
+    static real_t im( T   ) { return 0; }
+};
+
+template<>
+struct norm_host_traits< magmaFloatComplex >
+{
+    typedef float real_t;
+    static const bool is_complex = true;
+    static real_t re( magmaFloatComplex a ) { return MAGMA_C_REAL( a ); }
+    static real_t im( magmaFloatComplex a ) { return MAGMA_C_IMAG( a ); }
+};
+
+template<>
+struct norm_host_traits< magmaDoubleComplex >
+{
+    typedef double real_t;
+    static const bool is_complex = true;
+    static real_t re( magmaDoubleComplex a ) { return MAGMA_Z_REAL( a ); }
+    static real_t im( magmaDoubleComplex a ) { return MAGMA_Z_IMAG( a ); }
+};
+
+
+/******************************************************************************/
+// sqrt( x^2 + y^2 ) for x, y >= 0, without overflow or underflow.
+template< typename R >
+static inline R norm_host_hypot( R x, R y )
+{
+    R w = (x > y ? x : y);
+    R z = (x > y ? y : x);
+    if (z == 0 || std::isinf( w ))
+        return w;
+    z /= w;
+    return w * std::sqrt( 1 + z*z );
+}
+
+
+/***************************************************************************//**
+    Partial norms accumulated by one thread.
+    The sum of squares is fast_ssq + scale^2 * ssq: fast_ssq is summed
+    without scaling over chunks in the safe range, and (scale, ssq) are
+    updated as in LAPACK's lassq for the other chunks.
+*******************************************************************************/
+template< typename R >
+struct norm_host_state
+{
+    R max_abs, one, fast_ssq, scale, ssq;
+    bool has_nan, has_inf;
+
+    norm_host_state():
+        max_abs( 0 ), one( 0 ), fast_ssq( 0 ), scale( 0 ), ssq( 1 ),
+        has_nan( false ), has_inf( false )
+    {}
+
+    // lower bound of entries summed without scaling; smaller squares may
+    // underflow, but then are negligible next to small^2
+    static R small()
+    {
+        return std::sqrt( (std::numeric_limits< R >::min)()
+                          / std::numeric_limits< R >::epsilon() );
+    }
+
+    // upper bound of entries summed without scaling, for count terms
+    // with weight up to 2 and complex abs^2 up to 2 max(re, im)^2
+    static R big( double count )
+    {
+        return R( std::sqrt( double( (std::numeric_limits< R >::max)() )
+                             / (4 * (count + 1)) ));
+    }
+
+    // adds weight * a^2 to the scaled sum of squares, a >= 0
+    void lassq( R a, R weight )
+    {
+        if (std::isnan( a )) {
+            has_nan = true;
+        }
+        else if (std::isinf( a )) {
+            has_inf = true;
+        }
+        else if (a > 0) {
+            if (scale < a) {
+                ssq = weight + ssq * (scale/a) * (scale/a);
+                scale = a;
+            }
+            else {
+                ssq += weight * (a/scale) * (a/scale);
+            }
+        }
+    }
+
+    // max with NaN propagation
+    static R max_nan( R a, R b )
+    {
+        return (std::isnan( a ) || a < b ? b : a);
+    }
+
+    // merges another thread's partial norms
+    void merge( const norm_host_state& s )
+    {
+        max_abs  = max_nan( max_abs, s.max_abs );
+        one      = max_nan( one, s.one );
+        fast_ssq += s.fast_ssq;
+        if (s.scale > 0) {
+            if (scale < s.scale) {
+                ssq = s.ssq + ssq * (scale/s.scale) * (scale/s.scale);
+                scale = s.scale;
+            }
+            else {
+                ssq += s.ssq * (s.scale/scale) * (s.scale/scale);
+            }
+        }
+        has_nan = has_nan || s.has_nan;
+        has_inf = has_inf || s.has_inf;
+    }
+
+    // Frobenius norm, sqrt( fast_ssq + scale^2 ssq )
+    R fro() const
+    {
+        if (has_nan || std::isnan( fast_ssq ))
+            return std::numeric_limits< R >::quiet_NaN();
+        if (has_inf)
+            return std::numeric_limits< R >::infinity();
+        return norm_host_hypot( std::sqrt( fast_ssq ), scale * std::sqrt( ssq ));
+    }
+};
+
+
+/***************************************************************************//**
+    Sum of |x(i)|, sum of squares, and max over x(0:len-1), in one vectorized
+    loop without scaling; if rowsum is not NULL, adds |x(i)| to rowsum[i].
+*******************************************************************************/
+template< typename T, bool with_rowsum >
+static inline void
+norm_host_fast(
+    magma_int_t len, const T* x,
+    typename norm_host_traits< T >::real_t* rowsum,
+    typename norm_host_traits< T >::real_t& sum,
+    typename norm_host_traits< T >::real_t& ssq,
+    typename norm_host_traits< T >::real_t& cmax )
+{
+    typedef norm_host_traits< T > traits;
+    typedef typename traits::real_t R;
+
+    R sum_ = 0, ssq_ = 0, cmax_ = 0;
+    #pragma omp simd reduction(+:sum_,ssq_) reduction(max:cmax_)
+    for (magma_int_t i = 0; i < len; ++i) {
+        R re = traits::re( x[i] ), im = traits::im( x[i] );
+        R a2 = re*re + im*im;
+        R a  = (traits::is_complex ? std::sqrt( a2 ) : std::abs( re ));
+        sum_ += a;
+        ssq_ += a2;
+        cmax_ = max( cmax_, a );
+        if (with_rowsum)
+            rowsum[i] += a;
+    }
+    sum = sum_;
+    ssq = ssq_;
+    cmax = cmax_;
+}
+
+
+/***************************************************************************//**
+    Adds a chunk x(0:len-1) of a column to the partial norms s:
+    returns the sum of |x(i)|, updates s.max_abs and the sum of squares with
+    each term weighted by weight, and if rowsum is not NULL,
+    adds |x(i)| to rowsum[i].
+*******************************************************************************/
+template< typename T >
+static typename norm_host_traits< T >::real_t
+norm_host_chunk(
+    magma_int_t len, const T* x,
+    typename norm_host_traits< T >::real_t* rowsum,
+    typename norm_host_traits< T >::real_t weight,
+    typename norm_host_traits< T >::real_t big,
+    norm_host_state< typename norm_host_traits< T >::real_t >& s )
+{
+    typedef norm_host_traits< T > traits;
+    typedef typename traits::real_t R;
+
+    R sum = 0, ssq = 0, cmax = 0;
+    if (! traits::is_complex) {
+        // |x(i)| is exact, so the sum, max, and row sums are always right;
+        // the chunk is read once, and if its max is out of the safe range,
+        // the sum of squares is redone with scaling from cache.
+        if (rowsum)
+            norm_host_fast< T, true  >( len, x, rowsum, sum, ssq, cmax );
+        else
+            norm_host_fast< T, false >( len, x, rowsum, sum, ssq, cmax );
+        if (cmax <= big && (cmax >= s.small() || cmax == 0)) {
+            s.fast_ssq += weight * ssq;
+        }
+        else {
+            for (magma_int_t i = 0; i < len; ++i)
+                s.lassq( std::abs( traits::re( x[i] )), weight );
+        }
+        s.max_abs = s.max_nan( s.max_abs, cmax );
+        return sum;
+    }
+
+    // for complex, |x(i)| itself may overflow or underflow, so first find
+    // the largest real or imaginary part; ignores NaN, which propagates below
+    R amax = 0;
+    #pragma omp simd reduction(max:amax)
+    for (magma_int_t i = 0; i < len; ++i) {
+        R a = max( std::abs( traits::re( x[i] )), std::abs( traits::im( x[i] )));
+        amax = max( amax, a );
+    }
+
+    if (amax <= big && (amax >= s.small() || amax == 0)) {
+        // safe range: vectorized, without scaling
+        if (rowsum)
+            norm_host_fast< T, true  >( len, x, rowsum, sum, ssq, cmax );
+        else
+            norm_host_fast< T, false >( len, x, rowsum, sum, ssq, cmax );
+        s.fast_ssq += weight * ssq;
+    }
+    else {
+        // scaled, one element at a time
+        for (magma_int_t i = 0; i < len; ++i) {
+            R a = norm_host_hypot( std::abs( traits::re( x[i] )),
+                                   std::abs( traits::im( x[i] )));
+            if (std::isnan( traits::re( x[i] )) || std::isnan( traits::im( x[i] )))
+                a = std::numeric_limits< R >::quiet_NaN();
+            sum += a;
+            cmax = s.max_nan( cmax, a );
+            s.lassq( a, weight );
+            if (rowsum)
+                rowsum[i] += a;
+        }
+    }
+    s.max_abs = s.max_nan( s.max_abs, cmax );
+    return sum;
+}
+
+
+/***************************************************************************//**
+    Computes the max, one, infinity, and Frobenius norms of the m-by-n
+    matrix A in one pass, storing them in values[ magma_norm_max ], etc.
+    If with_inf is false, the row sums are skipped and values[ magma_norm_inf ]
+    is not set.
+*******************************************************************************/
+template< typename T >
+void magma_norms_host(
+    magma_int_t m, magma_int_t n, const T* A, magma_int_t lda,
+    typename norm_host_traits< T >::real_t* values, bool with_inf=true )
+{
+    typedef typename norm_host_traits< T >::real_t R;
+    const R big = norm_host_state< R >::big( double(m)*n );
+
+    int nthreads = 1;
+    #ifdef _OPENMP
+    nthreads = (n > 1 ? omp_get_max_threads() : 1);
+    #endif
+    std::vector< norm_host_state< R > > states( nthreads );
+    std::vector< R > rowsums( with_inf ? size_t(m)*nthreads : 0, R(0) );
+
+    #pragma omp parallel num_threads( nthreads )
+    {
+        int t = 0;
+        #ifdef _OPENMP
+        t = omp_get_thread_num();
+        #endif
+        norm_host_state< R >& s = states[t];
+        R* rowsum = (with_inf ? &rowsums[ size_t(m)*t ] : NULL);
+
+        #pragma omp for schedule(static)
+        for (magma_int_t j = 0; j < n; ++j) {
+            R csum = 0;
+            for (magma_int_t i = 0; i < m; i += magma_norm_chunk) {
+                magma_int_t len = min( magma_norm_chunk, m - i );
+                csum += norm_host_chunk( len, A + i + j*lda,
+                                         (rowsum ? rowsum + i : NULL), R(1), big, s );
+            }
+            s.one = s.max_nan( s.one, csum );
+        }
+    }
+
+    for (int t = 1; t < nthreads; ++t)
+        states[0].merge( states[t] );
+    const norm_host_state< R >& s = states[0];
+
+    bool nan = std::isnan( s.one ) || s.has_nan || std::isnan( s.fast_ssq );
+    R nanval = std::numeric_limits< R >::quiet_NaN();
+    values[ magma_norm_max ] = (nan ? nanval : s.max_abs);
+    values[ magma_norm_one ] = (nan ? nanval : s.one);
+    values[ magma_norm_fro ] = (nan ? nanval : s.fro());
+    if (with_inf) {
+        R inf = 0;
+        for (magma_int_t i = 0; i < m; ++i) {
+            R rsum = 0;
+            for (int t = 0; t < nthreads; ++t)
+                rsum += rowsums[ i + size_t(m)*t ];
+            inf = s.max_nan( inf, rsum );
+        }
+        values[ magma_norm_inf ] = (nan ? nanval : inf);
+    }
+}
+
+
+/***************************************************************************//**
+    Computes the max, one (= infinity), and Frobenius norms of the n-by-n
+    symmetric (hermitian = false) or Hermitian (hermitian = true) matrix A,
+    reading only the triangle given by uplo, in one pass; see magma_norms_host.
+    For Hermitian A, the imaginary parts of the diagonal are assumed zero,
+    as in LAPACK's lanhe.
+*******************************************************************************/
+template< typename T >
+void magma_norms_sym_host(
+    bool hermitian, magma_uplo_t uplo,
+    magma_int_t n, const T* A, magma_int_t lda,
+    typename norm_host_traits< T >::real_t* values )
+{
+    typedef norm_host_traits< T > traits;
+    typedef typename traits::real_t R;
+    const R big = norm_host_state< R >::big( double(n)*n );
+
+    int nthreads = 1;
+    #ifdef _OPENMP
+    nthreads = (n > 1 ? omp_get_max_threads() : 1);
+    #endif
+    std::vector< norm_host_state< R > > states( nthreads );
+    std::vector< R > rowsums( size_t(n)*nthreads, R(0) );
+    std::vector< R > colsums( n );  // sum of the column's part in the triangle
+
+    #pragma omp parallel num_threads( nthreads )
+    {
+        int t = 0;
+        #ifdef _OPENMP
+        t = omp_get_thread_num();
+        #endif
+        norm_host_state< R >& s = states[t];
+        R* rowsum = &rowsums[ size_t(n)*t ];
+
+        #pragma omp for schedule(dynamic, 16)
+        for (magma_int_t j = 0; j < n; ++j) {
+            // off-diagonal rows i0:i1-1 of column j
+            magma_int_t i0 = (uplo == MagmaLower ? j+1 : 0);
+            magma_int_t i1 = (uplo == MagmaLower ? n   : j);
+            R csum = 0;
+            for (magma_int_t i = i0; i < i1; i += magma_norm_chunk) {
+                magma_int_t len = min( magma_norm_chunk, i1 - i );
+                csum += norm_host_chunk( len, A + i + j*lda, rowsum + i, R(2), big, s );
+            }
+
+            // diagonal, with weight 1
+            T ajj = A[ j + j*lda ];
+            R d = (hermitian
+                   ? std::abs( traits::re( ajj ))
+                   : norm_host_hypot( std::abs( traits::re( ajj )),
+                                      std::abs( traits::im( ajj ))));
+            if (! hermitian && std::isnan( traits::im( ajj )))
+                d = std::numeric_limits< R >::quiet_NaN();
+            s.max_abs = s.max_nan( s.max_abs, d );
+            s.lassq( d, R(1) );
+            colsums[j] = csum + d;
+        }
+    }
+
+    for (int t = 1; t < nthreads; ++t)
+        states[0].merge( states[t] );
+    const norm_host_state< R >& s = states[0];
+
+    R one = 0;
+    for (magma_int_t i = 0; i < n; ++i) {
+        R rsum = colsums[i];
+        for (int t = 0; t < nthreads; ++t)
+            rsum += rowsums[ i + size_t(n)*t ];
+        one = s.max_nan( one, rsum );
+    }
+
+    bool nan = std::isnan( one ) || s.has_nan || std::isnan( s.fast_ssq );
+    R nanval = std::numeric_limits< R >::quiet_NaN();
+    values[ magma_norm_max ] = (nan ? nanval : s.max_abs);
+    values[ magma_norm_one ] = (nan ? nanval : one);
+    values[ magma_norm_inf ] = values[ magma_norm_one ];
+    values[ magma_norm_fro ] = (nan ? nanval : s.fro());
+}
+
+#endif // MAGMA_NORM_HOST_HPP
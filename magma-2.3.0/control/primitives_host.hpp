@@ -0,0 +1,410 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_PRIMITIVES_HOST_HPP
+#define MAGMA_PRIMITIVES_HOST_HPP
+
+#include <stdint.h>
+#include <vector>
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host parallel primitives: prefix sum (scan), stream compaction (copy_if),
+    segmented reductions over the rows of a CSR matrix, histograms, and the
+    stable counting sort built on them. They are the host counterparts of
+    magmablas/prefix_sum.cu, and are used by the sparse conversions
+    (magma_*mconvert, magma_*_csr_compressor, magma_*mtranspose_cpu) and the
+    ParILU thresholding and triangle extraction
+    (magma_*parilut_thrsrm, magma_*matrix_tril, magma_*matrix_createrowptr).
+
+    The input is split into nparts contiguous parts, about one per thread,
+    that are processed in two passes: the first reduces each part (its sum,
+    or its number of kept elements), the partial results are scanned, and
+    the second pass redoes each part starting from its offset. So the work
+    is twice that of the serial loop, in two parallel sweeps, and the result
+    is the same, element for element, as the serial loop's, independent of
+    the number of threads. Parts are distributed over the threads of the
+    team with static schedules, so the result does not depend on the team
+    size OpenMP gives either. Inputs shorter than magma_primitives_nb run on
+    one thread.
+
+    CSR rows are split into parts balanced on rows plus nonzeros, i.e.,
+    along the merge path of the row pointer and the nonzeros, found by
+    binary search, so a few long rows or many empty rows do not unbalance
+    the threads, and no row is split between parts.
+
+    Functors passed in are called from several threads at once, and must
+    only write to their own output element.
+*******************************************************************************/
+
+/// number of elements per part below which a primitive runs on one thread
+const int64_t magma_primitives_nb = 8192;
+
+
+/******************************************************************************/
+// Number of parts for n elements: one per thread, with at least
+// magma_primitives_nb elements each.
+static inline int64_t primitives_host_nparts( int64_t n )
+{
+    int64_t nparts = 1;
+#ifdef _OPENMP
+    nparts = omp_get_max_threads();
+#endif
+    if (nparts > n / magma_primitives_nb)
+        nparts = n / magma_primitives_nb;
+    return (nparts < 1 ? 1 : nparts);
+}
+
+// First element of part p of nparts for n elements; part p is
+// [ primitives_host_begin( n, p, nparts ), primitives_host_begin( n, p+1, nparts ) ).
+static inline int64_t primitives_host_begin( int64_t n, int64_t p, int64_t nparts )
+{
+    return (n / nparts)*p + (p < n % nparts ? p : n % nparts);
+}
+
+// First row of part p of nparts for the CSR row pointer ptr: the first row r
+// with r + (ptr[r] - ptr[0]) >= p*(nrows + nnz)/nparts.
+template< typename I >
+int64_t primitives_host_row_begin(
+    int64_t nrows, const I* ptr, int64_t p, int64_t nparts )
+{
+    if (p >= nparts)
+        return nrows;
+    int64_t total = nrows + int64_t( ptr[nrows] - ptr[0] );
+    int64_t diag  = primitives_host_begin( total, p, nparts );
+    int64_t lo = 0, hi = nrows;
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (mid + int64_t( ptr[mid] - ptr[0] ) < diag)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+
+/***************************************************************************//**
+    Prefix sum of x[0:n-1] into y[0:n-1]: inclusive, y[i] = x[0] + ... + x[i],
+    or exclusive, y[i] = x[0] + ... + x[i-1], with y[0] = 0.
+    y may be x. Returns the sum of all n elements.
+*******************************************************************************/
+template< typename T >
+T magma_scan_host( bool inclusive, int64_t n, const T* x, T* y )
+{
+    int64_t nparts = primitives_host_nparts( n );
+    std::vector< T > sums( nparts + 1, T(0) );
+
+    #pragma omp parallel num_threads( nparts ) if (nparts > 1)
+    {
+        #pragma omp for schedule( static, 1 )
+        for (int64_t p = 0; p < nparts; ++p) {
+            int64_t i1 = primitives_host_begin( n, p+1, nparts );
+            T s = T(0);
+            for (int64_t i = primitives_host_begin( n, p, nparts ); i < i1; ++i) {
+                s += x[i];
+            }
+            sums[ p+1 ] = s;
+        }
+
+        #pragma omp single
+        for (int64_t p = 0; p < nparts; ++p) {
+            sums[ p+1 ] += sums[ p ];
+        }
+
+        #pragma omp for schedule( static, 1 )
+        for (int64_t p = 0; p < nparts; ++p) {
+            int64_t i1 = primitives_host_begin( n, p+1, nparts );
+            T s = sums[ p ];
+            if (inclusive) {
+                for (int64_t i = primitives_host_begin( n, p, nparts ); i < i1; ++i) {
+                    s += x[i];
+                    y[i] = s;
+                }
+            }
+            else {
+                for (int64_t i = primitives_host_begin( n, p, nparts ); i < i1; ++i) {
+                    T xi = x[i];
+                    y[i] = s;
+                    s += xi;
+                }
+            }
+        }
+    }
+    return sums[ nparts ];
+}
+
+
+/***************************************************************************//**
+    Stream compaction: calls emit( i, k ) for each i in [0, n) with
+    keep( i ) true, where k is the number of such i before it, so the kept
+    elements are written in order to consecutive places.
+    keep is called twice per element. Returns the number kept.
+*******************************************************************************/
+template< typename Keep, typename Emit >
+int64_t magma_copy_if_host( int64_t n, Keep keep, Emit emit )
+{
+    int64_t nparts = primitives_host_nparts( n );
+    std::vector< int64_t > counts( nparts + 1, 0 );
+
+    #pragma omp parallel num_threads( nparts ) if (nparts > 1)
+    {
+        #pragma omp for schedule( static, 1 )
+        for (int64_t p = 0; p < nparts; ++p) {
+            int64_t i1 = primitives_host_begin( n, p+1, nparts );
+            int64_t c = 0;
+            for (int64_t i = primitives_host_begin( n, p, nparts ); i < i1; ++i) {
+                c += (keep( i ) ? 1 : 0);
+            }
+            counts[ p+1 ] = c;
+        }
+
+        #pragma omp single
+        for (int64_t p = 0; p < nparts; ++p) {
+            counts[ p+1 ] += counts[ p ];
+        }
+
+        #pragma omp for schedule( static, 1 )
+        for (int64_t p = 0; p < nparts; ++p) {
+            int64_t i1 = primitives_host_begin( n, p+1, nparts );
+            int64_t k = counts[ p ];
+            for (int64_t i = primitives_host_begin( n, p, nparts ); i < i1; ++i) {
+                if (keep( i )) {
+                    emit( i, k );
+                    k += 1;
+                }
+            }
+        }
+    }
+    return counts[ nparts ];
+}
+
+
+/***************************************************************************//**
+    Segmented map over the rows of a CSR matrix with row pointer
+    ptr[0:nrows]: calls f( row, i ) for each row and each i in
+    [ptr[row], ptr[row+1]), in parallel over parts of whole rows.
+*******************************************************************************/
+template< typename I, typename F >
+void magma_csr_for_each_host( int64_t nrows, const I* ptr, F f )
+{
+    int64_t nparts = primitives_host_nparts( nrows + int64_t( ptr[nrows] - ptr[0] ) );
+
+    #pragma omp parallel for schedule( static, 1 ) num_threads( nparts ) if (nparts > 1)
+    for (int64_t p = 0; p < nparts; ++p) {
+        int64_t r1 = primitives_host_row_begin( nrows, ptr, p+1, nparts );
+        for (int64_t r = primitives_host_row_begin( nrows, ptr, p, nparts ); r < r1; ++r) {
+            for (I i = ptr[r]; i < ptr[r+1]; ++i) {
+                f( r, i );
+            }
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Segmented reduction over the rows of a CSR matrix with row pointer
+    ptr[0:nrows]: out[row] = op( ... op( op( init, value( row, ptr[row] ) ),
+    value( row, ptr[row]+1 ) ) ..., value( row, ptr[row+1]-1 ) ),
+    which is init for an empty row.
+*******************************************************************************/
+template< typename I, typename T, typename Value, typename Op >
+void magma_csr_reduce_host(
+    int64_t nrows, const I* ptr, T init, Value value, Op op, T* out )
+{
+    int64_t nparts = primitives_host_nparts( nrows + int64_t( ptr[nrows] - ptr[0] ) );
+
+    #pragma omp parallel for schedule( static, 1 ) num_threads( nparts ) if (nparts > 1)
+    for (int64_t p = 0; p < nparts; ++p) {
+        int64_t r1 = primitives_host_row_begin( nrows, ptr, p+1, nparts );
+        for (int64_t r = primitives_host_row_begin( nrows, ptr, p, nparts ); r < r1; ++r) {
+            T s = init;
+            for (I i = ptr[r]; i < ptr[r+1]; ++i) {
+                s = op( s, value( r, i ) );
+            }
+            out[r] = s;
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    First pass of the stream compaction of a CSR matrix with row pointer
+    ptr[0:nrows]: computes the row pointer newptr[0:nrows] of the matrix of
+    the elements i of each row with keep( row, i ) true, so the caller can
+    allocate it. newptr must not overlap ptr. Returns newptr[nrows].
+*******************************************************************************/
+template< typename I, typename Keep >
+I magma_csr_count_if_host( int64_t nrows, const I* ptr, Keep keep, I* newptr )
+{
+    magma_csr_reduce_host( nrows, ptr, I(0),
+        [&]( int64_t row, I i ) { return I( keep( row, i ) ? 1 : 0 ); },
+        []( I a, I b ) { return a + b; },
+        newptr + 1 );
+    newptr[0] = 0;
+    return magma_scan_host( true, nrows, newptr + 1, newptr + 1 );
+}
+
+
+/***************************************************************************//**
+    Second pass of the stream compaction of a CSR matrix: for each row
+    and i in [ptr[row], ptr[row+1]) with keep( row, i ) true, calls
+    emit( row, i, k ), where k is the place of the element in the compacted
+    matrix, whose row pointer newptr is from magma_csr_count_if_host
+    with the same keep.
+*******************************************************************************/
+template< typename I, typename Keep, typename Emit >
+void magma_csr_copy_if_host(
+    int64_t nrows, const I* ptr, Keep keep, const I* newptr, Emit emit )
+{
+    int64_t nparts = primitives_host_nparts( nrows + int64_t( ptr[nrows] - ptr[0] ) );
+
+    #pragma omp parallel for schedule( static, 1 ) num_threads( nparts ) if (nparts > 1)
+    for (int64_t p = 0; p < nparts; ++p) {
+        int64_t r1 = primitives_host_row_begin( nrows, ptr, p+1, nparts );
+        for (int64_t r = primitives_host_row_begin( nrows, ptr, p, nparts ); r < r1; ++r) {
+            I k = newptr[r];
+            for (I i = ptr[r]; i < ptr[r+1]; ++i) {
+                if (keep( r, i )) {
+                    emit( r, i, k );
+                    k += 1;
+                }
+            }
+        }
+    }
+}
+
+
+/******************************************************************************/
+// Number of parts for a histogram of n keys into nbins bins: each part
+// keeps its own counts, so parts must have at least nbins keys each.
+static inline int64_t primitives_host_nparts_bins( int64_t n, int64_t nbins )
+{
+    int64_t nparts = primitives_host_nparts( n );
+    if (nbins > 0 && nparts > n / nbins)
+        nparts = n / nbins;
+    return (nparts < 1 ? 1 : nparts);
+}
+
+
+/***************************************************************************//**
+    Histogram: counts[b] = number of i in [0, n) with key( i ) == b,
+    for b in [0, nbins). Each key must be in [0, nbins).
+    Each part of the keys is counted in its own array, without atomics,
+    and the arrays are summed in parallel over bins.
+*******************************************************************************/
+template< typename I, typename Key >
+void magma_histogram_host( int64_t n, Key key, int64_t nbins, I* counts )
+{
+    int64_t nparts = primitives_host_nparts_bins( n, nbins );
+    if (nparts == 1) {
+        for (int64_t b = 0; b < nbins; ++b) {
+            counts[b] = 0;
+        }
+        for (int64_t i = 0; i < n; ++i) {
+            counts[ key( i ) ] += 1;
+        }
+        return;
+    }
+
+    std::vector< I > local( nparts*nbins, I(0) );
+
+    #pragma omp parallel num_threads( nparts )
+    {
+        #pragma omp for schedule( static, 1 )
+        for (int64_t p = 0; p < nparts; ++p) {
+            I* c = &local[ p*nbins ];
+            int64_t i1 = primitives_host_begin( n, p+1, nparts );
+            for (int64_t i = primitives_host_begin( n, p, nparts ); i < i1; ++i) {
+                c[ key( i ) ] += 1;
+            }
+        }
+
+        #pragma omp for schedule( static )
+        for (int64_t b = 0; b < nbins; ++b) {
+            I s = 0;
+            for (int64_t p = 0; p < nparts; ++p) {
+                s += local[ p*nbins + b ];
+            }
+            counts[b] = s;
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Stable counting sort of n elements by key( i ) in [0, nbins): returns
+    the bucket pointer in ptr[0:nbins], so the elements with key b go to
+    [ptr[b], ptr[b+1]), and calls emit( i, k ) with the place k of element
+    i, where elements with the same key keep their order.
+    With keys the rows of COO entries, or the columns of CSR entries,
+    this converts COO to CSR, or CSR to CSC, i.e., transposes it.
+*******************************************************************************/
+template< typename I, typename Key, typename Emit >
+void magma_counting_sort_host( int64_t n, Key key, int64_t nbins, I* ptr, Emit emit )
+{
+    int64_t nparts = primitives_host_nparts_bins( n, nbins );
+    if (nparts == 1) {
+        magma_histogram_host( n, key, nbins, ptr + 1 );
+        ptr[0] = 0;
+        magma_scan_host( true, nbins, ptr + 1, ptr + 1 );
+        std::vector< I > next( ptr, ptr + nbins );
+        for (int64_t i = 0; i < n; ++i) {
+            emit( i, next[ key( i ) ]++ );
+        }
+        return;
+    }
+
+    // local[ p*nbins + b ] counts key b in part p, then is replaced by
+    // the place of the first such element in part p
+    std::vector< I > local( nparts*nbins, I(0) );
+
+    #pragma omp parallel num_threads( nparts )
+    {
+        #pragma omp for schedule( static, 1 )
+        for (int64_t p = 0; p < nparts; ++p) {
+            I* c = &local[ p*nbins ];
+            int64_t i1 = primitives_host_begin( n, p+1, nparts );
+            for (int64_t i = primitives_host_begin( n, p, nparts ); i < i1; ++i) {
+                c[ key( i ) ] += 1;
+            }
+        }
+
+        // scan each bin over the parts
+        #pragma omp for schedule( static )
+        for (int64_t b = 0; b < nbins; ++b) {
+            I s = 0;
+            for (int64_t p = 0; p < nparts; ++p) {
+                I c = local[ p*nbins + b ];
+                local[ p*nbins + b ] = s;
+                s += c;
+            }
+            ptr[ b+1 ] = s;
+        }
+    }
+
+    ptr[0] = 0;
+    magma_scan_host( true, nbins, ptr + 1, ptr + 1 );
+
+    #pragma omp parallel for schedule( static, 1 ) num_threads( nparts )
+    for (int64_t p = 0; p < nparts; ++p) {
+        I* c = &local[ p*nbins ];
+        int64_t i1 = primitives_host_begin( n, p+1, nparts );
+        for (int64_t i = primitives_host_begin( n, p, nparts ); i < i1; ++i) {
+            int64_t b = key( i );
+            emit( i, ptr[b] + c[b]++ );
+        }
+    }
+}
+
+#endif // MAGMA_PRIMITIVES_HOST_HPP
@@ -0,0 +1,317 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "magma_internal.h"
+#include "roofline.h"
+
+// define ROOFLINE to compile these functions, e.g.,
+// gcc -DROOFLINE -c roofline.cpp
+#ifdef ROOFLINE
+
+enum { HOST = 0, DEVICE = 1, LINK = 2 };
+
+static const char* unit_names[] = { "host", "device", "link" };
+
+
+/******************************************************************************/
+struct roofline_site
+{
+    int    unit;
+    long   calls;
+    double flops;
+    double bytes;
+    double time;
+};
+
+struct roofline_call
+{
+    std::pair< std::string, std::string > key;  // routine, site
+    int           unit;
+    double        flops;
+    double        bytes;
+    magma_queue_t queue;
+    double        start;
+};
+
+struct roofline_log
+{
+    // ordered by routine, then site
+    std::map< std::pair< std::string, std::string >, roofline_site > sites;
+
+    // open calls, innermost last
+    std::vector< roofline_call > stack;
+};
+
+// global log object
+static roofline_log glog;
+
+
+/******************************************************************************/
+void roofline_start_(
+    const char* routine, const char* site,
+    double flops, double bytes, magma_queue_t queue, bool link )
+{
+    roofline_call call;
+    call.key   = std::make_pair( std::string( routine ), std::string( site ));
+    call.unit  = (link ? LINK : (queue == NULL ? HOST : DEVICE));
+    call.flops = flops;
+    call.bytes = bytes;
+    call.queue = queue;
+    call.start = (queue == NULL ? magma_wtime() : magma_sync_wtime( queue ));
+    glog.stack.push_back( call );
+}
+
+
+/******************************************************************************/
+void roofline_end()
+{
+    if ( glog.stack.empty() ) {
+        fprintf( stderr, "Error in %s: no roofline_start is open.\n", __func__ );
+        return;
+    }
+    roofline_call& call = glog.stack.back();
+    double end = (call.queue == NULL ? magma_wtime() : magma_sync_wtime( call.queue ));
+
+    roofline_site& s = glog.sites[ call.key ];
+    if ( s.calls == 0 ) {
+        s.unit = call.unit;
+    }
+    s.calls += 1;
+    s.flops += call.flops;
+    s.bytes += call.bytes;
+    s.time  += end - call.start;
+    glog.stack.pop_back();
+}
+
+
+/******************************************************************************/
+// Peak Gflop/s and GB/s of the host, of device 0, and of its link,
+// measured in double precision. Each is the best of several runs after one
+// untimed warm-up run, which spins up the BLAS threads and the device.
+// Transfers move 128 MiB or more, well past the caches, so the bandwidths
+// are those of memory and of the link in steady state.
+struct roofline_peak
+{
+    double gflops[3];   // by unit; 0 for the link
+    double gbytes[3];
+};
+
+static void roofline_measure( roofline_peak& peak )
+{
+    const magma_int_t nb = 2048;    // gemm
+    const magma_int_t n  = 4096;    // copies, 128 MiB
+    const magma_int_t ld = n;
+    const double one = 1, zero = 0;
+    const int runs = 5;
+    double t;
+
+    for( int u = 0; u < 3; ++u ) {
+        peak.gflops[u] = 0;
+        peak.gbytes[u] = 0;
+    }
+
+    double *hA, *hB, *hC;
+    magma_dmalloc_pinned( &hA, ld*nb );
+    magma_dmalloc_pinned( &hB, ld*nb );
+    magma_dmalloc_pinned( &hC, ld*n  );
+    for( magma_int_t i = 0; i < ld*nb; ++i ) {
+        hA[i] = hB[i] = 1. / (i + 1);
+    }
+    for( magma_int_t i = 0; i < ld*n; ++i ) {
+        hC[i] = 1. / (i + 1);
+    }
+
+    // host: dgemm, and memcpy of 256 MiB, which reads and writes each byte
+    size_t size = 256*1024*1024;
+    char *src = (char*) malloc( size );
+    char *dst = (char*) malloc( size );
+    memset( src, 1, size );
+    memset( dst, 0, size );
+    for( int r = 0; r <= runs; ++r ) {
+        t = magma_wtime();
+        blasf77_dgemm( "N", "N", &nb, &nb, &nb, &one, hA, &ld, hB, &ld, &zero, hC, &ld );
+        t = magma_wtime() - t;
+        if ( r > 0 ) {
+            peak.gflops[HOST] = max( peak.gflops[HOST], FLOPS_DGEMM( nb, nb, nb ) / t / 1e9 );
+        }
+
+        t = magma_wtime();
+        memcpy( dst, src, size );
+        t = magma_wtime() - t;
+        if ( r > 0 ) {
+            peak.gbytes[HOST] = max( peak.gbytes[HOST], 2.*size / t / 1e9 );
+        }
+    }
+    free( src );
+    free( dst );
+
+    // device 0: dgemm and copymatrix; link: setmatrix from pinned memory
+    magma_queue_t queue;
+    magma_device_t cdev;
+    magma_getdevice( &cdev );
+    magma_queue_create( 0, &queue );
+
+    magmaDouble_ptr dA, dB, dC;
+    if ( magma_dmalloc( &dA, ld*n  ) == MAGMA_SUCCESS &&
+         magma_dmalloc( &dB, ld*nb ) == MAGMA_SUCCESS &&
+         magma_dmalloc( &dC, ld*n  ) == MAGMA_SUCCESS )
+    {
+        magma_dsetmatrix( n,  n,  hC, ld, dA, ld, queue );
+        magma_dsetmatrix( nb, nb, hB, ld, dB, ld, queue );
+        for( int r = 0; r <= runs; ++r ) {
+            t = magma_sync_wtime( queue );
+            magma_dgemm( MagmaNoTrans, MagmaNoTrans, nb, nb, nb,
+                         one, dA, ld, dB, ld, zero, dC, ld, queue );
+            t = magma_sync_wtime( queue ) - t;
+            if ( r > 0 ) {
+                peak.gflops[DEVICE] = max( peak.gflops[DEVICE], FLOPS_DGEMM( nb, nb, nb ) / t / 1e9 );
+            }
+
+            t = magma_sync_wtime( queue );
+            magma_dcopymatrix( n, n, dA, ld, dC, ld, queue );
+            t = magma_sync_wtime( queue ) - t;
+            if ( r > 0 ) {
+                peak.gbytes[DEVICE] = max( peak.gbytes[DEVICE], 2.*sizeof(double)*n*n / t / 1e9 );
+            }
+
+            t = magma_sync_wtime( queue );
+            magma_dsetmatrix( n, n, hC, ld, dC, ld, queue );
+            t = magma_sync_wtime( queue ) - t;
+            if ( r > 0 ) {
+                peak.gbytes[LINK] = max( peak.gbytes[LINK], sizeof(double)*n*n / t / 1e9 );
+            }
+        }
+    }
+    magma_free( dA );
+    magma_free( dB );
+    magma_free( dC );
+
+    magma_queue_destroy( queue );
+    magma_setdevice( cdev );
+
+    magma_free_pinned( hA );
+    magma_free_pinned( hB );
+    magma_free_pinned( hC );
+}
+
+
+/******************************************************************************/
+// Returns the fraction of its roof that site s achieved, unclamped, and in
+// bound whether it is link, memory, or compute bound.
+static double roofline_fraction(
+    const roofline_site& s, const roofline_peak& peak, const char** bound )
+{
+    double intensity = (s.bytes > 0 ? s.flops / s.bytes : 0);
+    double gflops    = (s.time  > 0 ? s.flops / s.time / 1e9 : 0);
+    double gbytes    = (s.time  > 0 ? s.bytes / s.time / 1e9 : 0);
+    if ( s.unit == LINK ) {
+        *bound = "link";
+        return (peak.gbytes[LINK] > 0 ? gbytes / peak.gbytes[LINK] : 0);
+    }
+    else if ( s.flops == 0 ) {
+        // data movement, e.g., transpose or laswp
+        *bound = "memory";
+        return (peak.gbytes[s.unit] > 0 ? gbytes / peak.gbytes[s.unit] : 0);
+    }
+    else {
+        double ridge = (peak.gbytes[s.unit] > 0 ? peak.gflops[s.unit] / peak.gbytes[s.unit] : 0);
+        double attainable = min( peak.gflops[s.unit], intensity * peak.gbytes[s.unit] );
+        *bound = (intensity < ridge ? "memory" : "compute");
+        return (attainable > 0 ? gflops / attainable : 0);
+    }
+}
+
+
+/******************************************************************************/
+// Prints the roofline report to stdout, or to the file named by
+// $MAGMA_ROOFLINE, then clears the counts. Called by the last magma_finalize.
+void roofline_report()
+{
+    if ( glog.sites.empty() ) {
+        return;
+    }
+    if ( ! glog.stack.empty() ) {
+        fprintf( stderr, "Error in %s: %lld roofline_start not ended.\n",
+                 __func__, (long long) glog.stack.size() );
+        glog.stack.clear();
+    }
+
+    FILE* out = stdout;
+    const char* filename = getenv( "MAGMA_ROOFLINE" );
+    if ( filename != NULL && filename[0] != '\0' ) {
+        out = fopen( filename, "w" );
+        if ( out == NULL ) {
+            fprintf( stderr, "Error in %s: can't open %s.\n", __func__, filename );
+            out = stdout;
+        }
+    }
+
+    roofline_peak peak;
+    roofline_measure( peak );
+
+    fprintf( out, "\n%% MAGMA roofline; peaks measured in double precision:\n" );
+    for( int u = HOST; u <= DEVICE; ++u ) {
+        fprintf( out, "%% %-6s  %8.1f Gflop/s  %7.1f GB/s  ridge %6.2f flop/B\n",
+                 unit_names[u], peak.gflops[u], peak.gbytes[u],
+                 peak.gbytes[u] > 0 ? peak.gflops[u] / peak.gbytes[u] : 0. );
+    }
+    fprintf( out, "%% %-6s  %8s          %7.1f GB/s\n",
+             unit_names[LINK], "", peak.gbytes[LINK] );
+    fprintf( out, "%% %%roof = achieved / min( peak, intensity * bandwidth ) of the unit,\n"
+                  "%% or achieved GB/s / bandwidth for transfers and data movement.\n" );
+    fprintf( out, "%%\n%% %-18s %-20s %-6s %8s %10s %9s %8s %10s %9s %8s %-7s %7s\n",
+             "routine", "site", "unit", "calls", "Gflop", "GB", "flop/B",
+             "time (s)", "Gflop/s", "GB/s", "bound", "% roof" );
+    fprintf( out, "%%========================================================================"
+                  "================================================================\n" );
+
+    std::map< std::pair< std::string, std::string >, roofline_site >::const_iterator it;
+    std::string last;
+    int nabove = 0;
+    for( it = glog.sites.begin(); it != glog.sites.end(); ++it ) {
+        const std::string& routine = it->first.first;
+        const std::string& site    = it->first.second;
+        const roofline_site& s     = it->second;
+        if ( ! last.empty() && routine != last ) {
+            fprintf( out, "\n" );
+        }
+        last = routine;
+
+        double intensity = (s.bytes > 0 ? s.flops / s.bytes : 0);
+        double gflops    = (s.time  > 0 ? s.flops / s.time / 1e9 : 0);
+        double gbytes    = (s.time  > 0 ? s.bytes / s.time / 1e9 : 0);
+        const char* bound;
+        double roof = roofline_fraction( s, peak, &bound );
+        bool above = (roof > 1);
+        nabove += above;
+        fprintf( out, "  %-18s %-20s %-6s %8ld %10.3f %9.3f %8.2f %10.4f %9.2f %8.2f %-7s %6.1f%%%s\n",
+                 routine.c_str(), site.c_str(), unit_names[s.unit], s.calls,
+                 s.flops / 1e9, s.bytes / 1e9, intensity, s.time,
+                 gflops, gbytes, bound, 100*min( roof, 1. ), (above ? "*" : "") );
+    }
+    if ( nabove > 0 ) {
+        fprintf( out, "%% * above the measured peak, so clamped to 100%%: the site's data fit in\n"
+                      "%%   cache, which the peaks, measured on 128 MiB or more, do not capture.\n" );
+    }
+    fprintf( out, "\n" );
+
+    if ( out != stdout ) {
+        fclose( out );
+    }
+    glog.sites.clear();
+}
+
+#endif  // ROOFLINE
@@ -0,0 +1,95 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+#ifndef ROOFLINE_H
+#define ROOFLINE_H
+
+#ifndef MAGMA_H
+#include "magma_v2.h"
+#endif
+
+#include "flops.h"
+
+// =============================================================================
+// Roofline instrumentation. A driver tags each major call, such as its
+// panel factorization, trailing update, or transfer, with the flops (from
+// flops.h) and bytes that it moves:
+//
+//     roofline_start( "update gemm", FLOPS_ZGEMM( m, n, k ),
+//                     sizeof(magmaDoubleComplex) * roofline_gemm_elems( m, n, k ),
+//                     queue );
+//     magma_zgemm( ..., queue );
+//     roofline_end();
+//
+// Calls with queue = NULL run on the host; roofline_copy_start tags a
+// transfer over the host-device link. Counts accumulate per call site, that
+// is, per routine (__func__) and site. At the last magma_finalize, the report
+// gives each site's arithmetic intensity and its achieved rate against the
+// roofline of its unit, from peaks measured then on this machine.
+//
+// Tagged are potrf_gpu, getrf_gpu, geqrf_gpu, potrf3_mgpu (for potrf_mgpu),
+// and getrf2_mgpu (for getrf_mgpu), in all precisions.
+//
+// Define ROOFLINE to compile it, e.g., add -DROOFLINE to CFLAGS and CXXFLAGS;
+// otherwise these are no-ops. Each tagged call is timed alone, its queue
+// synced before and after, so the overlap of the drivers is lost while
+// instrumented. Not thread safe.
+
+// element counts of the operands that a call reads and writes
+inline double roofline_gemm_elems( magma_int_t m, magma_int_t n, magma_int_t k )
+    { return double(m)*k + double(k)*n + 2.*m*n; }
+
+inline double roofline_syrk_elems( magma_int_t n, magma_int_t k )
+    { return double(n)*k + double(n)*n; }
+
+// triangle of order k; k = m (left) or k = n (right)
+inline double roofline_trsm_elems( magma_int_t m, magma_int_t n, magma_int_t k )
+    { return 0.5*k*k + 2.*m*n; }
+
+// panel factorization or other in-place update of an m-by-n matrix
+inline double roofline_panel_elems( magma_int_t m, magma_int_t n )
+    { return 2.*m*n; }
+
+// out-of-place transpose or copy of an m-by-n matrix
+inline double roofline_copy_elems( magma_int_t m, magma_int_t n )
+    { return 2.*m*n; }
+
+// block reflector of k m-long vectors, with its k-by-k T, applied to an
+// m-by-n matrix through an n-by-k workspace
+inline double roofline_larfb_elems( magma_int_t m, magma_int_t n, magma_int_t k )
+    { return double(m)*k + double(k)*k + 2.*m*n + 2.*n*k; }
+
+// row interchanges k1:k2 across n columns
+inline double roofline_laswp_elems( magma_int_t n, magma_int_t k1, magma_int_t k2 )
+    { return 4.*n*(k2 - k1 + 1); }
+
+
+// =============================================================================
+#ifdef ROOFLINE
+
+#define roofline_start( site, flops, bytes, queue ) \
+        roofline_start_( __func__, site, flops, bytes, queue, false )
+
+#define roofline_copy_start( site, bytes, queue ) \
+        roofline_start_( __func__, site, 0, bytes, queue, true )
+
+void roofline_start_( const char* routine, const char* site,
+                      double flops, double bytes, magma_queue_t queue, bool link );
+void roofline_end   ();
+
+void roofline_report();
+
+#else
+
+#define roofline_start(      x1, x2, x3, x4 ) ((void)(0))
+#define roofline_copy_start( x1, x2, x3     ) ((void)(0))
+#define roofline_end(                       ) ((void)(0))
+#define roofline_report(                    ) ((void)(0))
+
+#endif
+
+#endif        //  #ifndef ROOFLINE_H
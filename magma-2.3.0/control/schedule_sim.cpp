@@ -0,0 +1,531 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#include <math.h>
+#include <string.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+
+#include "schedule_sim.hpp"  // includes magma_internal.h, after the STL headers
+#include "flops.h"
+
+static const char* unit_names[] = { "host", "device", "link" };
+
+static const char* kind_names[] = {
+    "gemm", "syrk", "trsm", "potrf", "getrf", "laswp", "transpose", "copy", "none"
+};
+
+
+/***************************************************************************//**
+    Roofline defaults, for a node of two 14-core sockets and PCIe 3.0 x16
+    devices of 4.7 Tflop/s; load a model file for other hardware.
+*******************************************************************************/
+magma_sim_model::magma_sim_model()
+{
+    peak[MagmaSimHost]        = 1000;
+    peak[MagmaSimDevice]      = 4700;
+    peak[MagmaSimLink]        = 0;
+    bandwidth[MagmaSimHost]   = 120;
+    bandwidth[MagmaSimDevice] = 550;
+    bandwidth[MagmaSimLink]   = 12;
+    latency[MagmaSimHost]     = 1e-6;
+    latency[MagmaSimDevice]   = 5e-6;
+    latency[MagmaSimLink]     = 1e-5;
+}
+
+
+/******************************************************************************/
+const char* magma_sim_model::unit_name( magma_sim_unit_t unit )
+{
+    return unit_names[ unit ];
+}
+
+const char* magma_sim_model::kind_name( magma_sim_kind_t kind )
+{
+    return kind_names[ kind ];
+}
+
+
+/******************************************************************************/
+// @return index of name in names[0:n-1], or -1.
+static int lookup( const char* name, const char* names[], int n )
+{
+    for (int i = 0; i < n; ++i) {
+        if (strcmp( name, names[i] ) == 0)
+            return i;
+    }
+    return -1;
+}
+
+
+/***************************************************************************//**
+    Reads settings and calibrated entries from a model file; see
+    \ref magma_sim_model. Settings not in the file keep their values.
+    @return MAGMA_SUCCESS, MAGMA_ERR_NOT_FOUND, or, for a malformed line,
+    MAGMA_ERR_FILESYSTEM.
+*******************************************************************************/
+magma_int_t magma_sim_model::load( const char* filename )
+{
+    FILE* file = fopen( filename, "r" );
+    if (file == NULL)
+        return MAGMA_ERR_NOT_FOUND;
+
+    magma_int_t info = MAGMA_SUCCESS;
+    char line[1024], key[64], unit_str[64], kind_str[64];
+    while (fgets( line, sizeof(line), file ) != NULL) {
+        char* comment = strchr( line, '#' );
+        if (comment != NULL)
+            *comment = '\0';
+        if (sscanf( line, "%63s", key ) != 1)
+            continue;  // blank
+
+        double value;
+        long long m, n, k;
+        int unit = -1, kind = -1;
+        if (sscanf( line, "%*s %63s", unit_str ) == 1)
+            unit = lookup( unit_str, unit_names, 3 );
+        if (unit < 0) {
+            info = MAGMA_ERR_FILESYSTEM;
+        }
+        else if (strcmp( key, "time" ) == 0
+                 && sscanf( line, "%*s %*s %63s %lld %lld %lld %lf",
+                            kind_str, &m, &n, &k, &value ) == 5
+                 && (kind = lookup( kind_str, kind_names, MagmaSimNone )) >= 0) {
+            calibrate( magma_sim_unit_t( unit ), magma_sim_kind_t( kind ),
+                       magma_int_t( m ), magma_int_t( n ), magma_int_t( k ), value );
+        }
+        else if (sscanf( line, "%*s %*s %lf", &value ) == 1
+                 && strcmp( key, "peak" ) == 0) {
+            peak[ unit ] = value;
+        }
+        else if (sscanf( line, "%*s %*s %lf", &value ) == 1
+                 && strcmp( key, "bandwidth" ) == 0) {
+            bandwidth[ unit ] = value;
+        }
+        else if (sscanf( line, "%*s %*s %lf", &value ) == 1
+                 && strcmp( key, "latency" ) == 0) {
+            latency[ unit ] = value;
+        }
+        else {
+            info = MAGMA_ERR_FILESYSTEM;
+        }
+        if (info != MAGMA_SUCCESS) {
+            fprintf( stderr, "%s: cannot parse: %s", filename, line );
+            break;
+        }
+    }
+    fclose( file );
+    return info;
+}
+
+
+/***************************************************************************//**
+    Writes the settings and calibrated entries, in the format that load reads.
+    @return MAGMA_SUCCESS or MAGMA_ERR_FILESYSTEM.
+*******************************************************************************/
+magma_int_t magma_sim_model::save( const char* filename ) const
+{
+    FILE* file = fopen( filename, "w" );
+    if (file == NULL)
+        return MAGMA_ERR_FILESYSTEM;
+
+    fprintf( file, "# MAGMA schedule simulator model\n" );
+    for (int unit = MagmaSimHost; unit <= MagmaSimLink; ++unit) {
+        if (unit != MagmaSimLink)
+            fprintf( file, "peak       %-6s  %.6g\n", unit_names[unit], peak[unit] );
+        fprintf( file, "bandwidth  %-6s  %.6g\n", unit_names[unit], bandwidth[unit] );
+        fprintf( file, "latency    %-6s  %.6g\n", unit_names[unit], latency[unit] );
+    }
+    for (size_t i = 0; i < table.size(); ++i) {
+        const entry& e = table[i];
+        fprintf( file, "time       %-6s  %-9s %6lld %6lld %6lld  %.6e\n",
+                 unit_names[ e.unit ], kind_names[ e.kind ],
+                 (long long) e.m, (long long) e.n, (long long) e.k, e.seconds );
+    }
+    int err = ferror( file );
+    if (fclose( file ) != 0 || err)
+        return MAGMA_ERR_FILESYSTEM;
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    Adds a measured time to the table.
+*******************************************************************************/
+void magma_sim_model::calibrate(
+    magma_sim_unit_t unit, magma_sim_kind_t kind,
+    magma_int_t m, magma_int_t n, magma_int_t k, double seconds )
+{
+    entry e = { unit, kind, m, n, k, seconds };
+    table.push_back( e );
+}
+
+
+/******************************************************************************/
+double magma_sim_model::flops(
+    magma_sim_kind_t kind, magma_int_t m, magma_int_t n, magma_int_t k )
+{
+    switch (kind) {
+        case MagmaSimGemm:  return FLOPS_DGEMM( m, n, k );
+        case MagmaSimSyrk:  return FLOPS_DSYRK( k, n );
+        case MagmaSimTrsm:  return (k == m ? FLOPS_DTRSM( MagmaLeft,  m, n )
+                                           : FLOPS_DTRSM( MagmaRight, m, n ));
+        case MagmaSimPotrf: return FLOPS_DPOTRF( n );
+        case MagmaSimGetrf: return FLOPS_DGETRF( m, n );
+        default:            return 0;
+    }
+}
+
+
+/******************************************************************************/
+double magma_sim_model::bytes(
+    magma_sim_kind_t kind, magma_int_t m, magma_int_t n, magma_int_t k )
+{
+    const double dm = double(m), dn = double(n), dk = double(k);
+    double elems;
+    switch (kind) {
+        case MagmaSimGemm:      elems = dm*dk + dk*dn + 2*dm*dn;  break;
+        case MagmaSimSyrk:      elems = dn*dk + dn*dn;            break;
+        case MagmaSimTrsm:      elems = 0.5*dk*dk + 2*dm*dn;      break;
+        case MagmaSimPotrf:     elems = dn*dn;                    break;
+        case MagmaSimGetrf:     elems = 2*dm*dn;                  break;
+        case MagmaSimLaswp:     elems = 4*dk*dn;                  break;
+        case MagmaSimTranspose: elems = 2*dm*dn;                  break;
+        case MagmaSimCopy:      elems = dm*dn;                    break;
+        default:                elems = 0;                        break;
+    }
+    return elems * sizeof(double);
+}
+
+
+/***************************************************************************//**
+    @return seconds for the work on the unit: scaled from the nearest
+    calibrated entry, if any for the unit and kind, else the roofline.
+*******************************************************************************/
+double magma_sim_model::time(
+    magma_sim_unit_t unit, magma_sim_kind_t kind,
+    magma_int_t m, magma_int_t n, magma_int_t k ) const
+{
+    if (kind == MagmaSimNone)
+        return 0;
+
+    const double work_flops = flops( kind, m, n, k );
+    const double work_bytes = bytes( kind, m, n, k );
+
+    // nearest calibrated entry, by log distance of the sizes
+    #define log_ratio( a_, b_ ) fabs( log( double( max( 1, a_ ) ) / double( max( 1, b_ ) )))
+    const entry* best = NULL;
+    double best_dist = 0;
+    for (size_t i = 0; i < table.size(); ++i) {
+        const entry& e = table[i];
+        if (e.unit == unit && e.kind == kind) {
+            double dist = log_ratio( m, e.m ) + log_ratio( n, e.n ) + log_ratio( k, e.k );
+            if (best == NULL || dist < best_dist) {
+                best = &e;
+                best_dist = dist;
+            }
+        }
+    }
+    #undef log_ratio
+    if (best != NULL) {
+        double ref = (work_flops > 0 ? flops( kind, best->m, best->n, best->k )
+                                     : bytes( kind, best->m, best->n, best->k ));
+        double work = (work_flops > 0 ? work_flops : work_bytes);
+        return (ref > 0 ? best->seconds * work / ref : best->seconds);
+    }
+
+    double t = work_bytes / (bandwidth[unit] * 1e9);
+    if (work_flops > 0 && peak[unit] > 0) {
+        t = max( t, work_flops / (peak[unit] * 1e9) );
+    }
+    return latency[unit] + t;
+}
+
+
+/******************************************************************************/
+magma_sim::magma_sim( const magma_sim_model& model, magma_int_t ngpu, magma_int_t nqueue ):
+    m_model ( model ),
+    m_ngpu  ( ngpu ),
+    m_nqueue( max( 1, nqueue )),
+    m_tasks (),
+    m_tail  ( ngpu*m_nqueue, -1 ),
+    m_host  ( -1 ),
+    m_events()
+{}
+
+
+/******************************************************************************/
+// @return last task of the queue that the driver's queue maps to
+magma_int_t& magma_sim::tail( magma_int_t dev, magma_int_t queue )
+{
+    return m_tail[ dev*m_nqueue + min( queue, m_nqueue-1 ) ];
+}
+
+
+/******************************************************************************/
+// Adds a task on the resource (-1 for none), after the queue's last task
+// (dev < 0 for the host) and after the host's last blocking call.
+magma_int_t magma_sim::add(
+    magma_int_t resource, magma_sim_kind_t kind,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magma_int_t dev, magma_int_t queue )
+{
+    task t;
+    t.resource = resource;
+    t.kind     = kind;
+    t.flops    = magma_sim_model::flops( kind, m, n, k );
+    if (resource < 0)
+        t.cost = 0;
+    else if (resource == 0)
+        t.cost = m_model.time( MagmaSimHost, kind, m, n, k );
+    else if ((resource - 1) % 3 == 0)
+        t.cost = m_model.time( MagmaSimDevice, kind, m, n, k );
+    else
+        t.cost = m_model.time( MagmaSimLink, kind, m, n, k );
+
+    if (m_host >= 0)
+        t.deps.push_back( m_host );
+    if (dev >= 0 && tail( dev, queue ) >= 0)
+        t.deps.push_back( tail( dev, queue ));
+
+    magma_int_t id = magma_int_t( m_tasks.size() );
+    m_tasks.push_back( t );
+    if (dev >= 0)
+        tail( dev, queue ) = id;
+    return id;
+}
+
+
+/******************************************************************************/
+/// Dry run of a BLAS or auxiliary call on the device's queue.
+void magma_sim::kernel(
+    magma_int_t dev, magma_int_t queue, magma_sim_kind_t kind,
+    magma_int_t m, magma_int_t n, magma_int_t k )
+{
+    add( 1 + 3*dev, kind, m, n, k, dev, queue );
+}
+
+/// Dry run of magma_dsetmatrix_async of an m-by-n matrix on the device's queue.
+void magma_sim::setmatrix( magma_int_t dev, magma_int_t queue, magma_int_t m, magma_int_t n )
+{
+    add( 2 + 3*dev, MagmaSimCopy, m, n, 0, dev, queue );
+}
+
+/// Dry run of magma_dgetmatrix_async of an m-by-n matrix on the device's queue.
+void magma_sim::getmatrix( magma_int_t dev, magma_int_t queue, magma_int_t m, magma_int_t n )
+{
+    add( 3 + 3*dev, MagmaSimCopy, m, n, 0, dev, queue );
+}
+
+/// Dry run of a LAPACK or BLAS call on the host, which blocks the host.
+void magma_sim::host( magma_sim_kind_t kind, magma_int_t m, magma_int_t n, magma_int_t k )
+{
+    m_host = add( 0, kind, m, n, k, -1, 0 );
+}
+
+/// Dry run of magma_event_record; event is any id of the driver's events.
+void magma_sim::event_record( magma_int_t event, magma_int_t dev, magma_int_t queue )
+{
+    m_events[ event ] = tail( dev, queue );
+}
+
+/// Dry run of magma_queue_wait_event. As in MAGMA, waiting for an event
+/// that was never recorded does nothing.
+void magma_sim::queue_wait_event( magma_int_t dev, magma_int_t queue, magma_int_t event )
+{
+    std::map< magma_int_t, magma_int_t >::const_iterator iter = m_events.find( event );
+    if (iter != m_events.end() && iter->second >= 0) {
+        magma_int_t id = add( -1, MagmaSimNone, 0, 0, 0, dev, queue );
+        m_tasks[ id ].deps.push_back( iter->second );
+    }
+}
+
+/// Dry run of magma_queue_sync: the host waits for the queue.
+void magma_sim::queue_sync( magma_int_t dev, magma_int_t queue )
+{
+    magma_int_t last = tail( dev, queue );
+    if (last >= 0) {
+        m_host = add( -1, MagmaSimNone, 0, 0, 0, -1, 0 );
+        m_tasks[ m_host ].deps.push_back( last );
+    }
+}
+
+
+/******************************************************************************/
+std::string magma_sim::label( const task& t ) const
+{
+    const char* unit;
+    if (t.resource == 0)
+        unit = "host";
+    else if ((t.resource - 1) % 3 == 0)
+        unit = "dev";
+    else if ((t.resource - 1) % 3 == 1)
+        unit = "h2d";
+    else
+        unit = "d2h";
+    return std::string( unit ) + " " + magma_sim_model::kind_name( t.kind );
+}
+
+
+/***************************************************************************//**
+    Simulates the schedule. Of all tasks whose dependencies are done, the
+    one that can start first, when its resource is free, starts, ties going
+    in issue order. Start times never decrease, so no resource idles while
+    it has a task that could run.
+    @return the prediction.
+*******************************************************************************/
+magma_sim_report magma_sim::run() const
+{
+    const magma_int_t ntask = magma_int_t( m_tasks.size() );
+    const magma_int_t nres  = 1 + 3*m_ngpu;
+    const double inf = HUGE_VAL;
+
+    // successors, and count of unfinished dependencies
+    std::vector< std::vector< magma_int_t > > succ( ntask );
+    std::vector< magma_int_t > count( ntask, 0 );
+    for (magma_int_t i = 0; i < ntask; ++i) {
+        const std::vector< magma_int_t >& deps = m_tasks[i].deps;
+        count[i] = magma_int_t( deps.size() );
+        for (size_t d = 0; d < deps.size(); ++d) {
+            succ[ deps[d] ].push_back( i );
+        }
+    }
+
+    // ready tasks of each resource, by ready time, then issue order;
+    // waits and syncs use the last one, which is never busy
+    typedef std::pair< double, magma_int_t > ready_t;
+    typedef std::priority_queue< ready_t, std::vector< ready_t >, std::greater< ready_t > > ready_queue;
+    std::vector< ready_queue > ready( nres + 1 );
+    std::vector< double > avail( nres + 1, 0. );  // when each resource is free
+    std::vector< magma_int_t > last( nres + 1, -1 );
+
+    std::vector< double > start( ntask, 0. ), finish( ntask, 0. ), ready_time( ntask, 0. );
+    std::vector< magma_int_t > bound( ntask, -1 );  // task whose finish started this one
+
+    for (magma_int_t i = 0; i < ntask; ++i) {
+        if (count[i] == 0) {
+            magma_int_t r = (m_tasks[i].resource < 0 ? nres : m_tasks[i].resource);
+            ready[r].push( ready_t( 0., i ));
+        }
+    }
+
+    for (magma_int_t done = 0; done < ntask; ++done) {
+        // resource whose first ready task can start first
+        magma_int_t r_best = -1;
+        double t_best = inf;
+        magma_int_t i_best = ntask;
+        for (magma_int_t r = 0; r <= nres; ++r) {
+            if (! ready[r].empty()) {
+                double t = max( ready[r].top().first, avail[r] );
+                magma_int_t i = ready[r].top().second;
+                if (t < t_best || (t == t_best && i < i_best)) {
+                    r_best = r;
+                    t_best = t;
+                    i_best = i;
+                }
+            }
+        }
+        assert( r_best >= 0 );
+        magma_int_t i = i_best;
+        ready[ r_best ].pop();
+
+        const task& t = m_tasks[i];
+        start[i]  = t_best;
+        finish[i] = t_best + t.cost;
+        if (ready_time[i] >= avail[ r_best ] || last[ r_best ] < 0) {
+            // started when its last dependency finished
+            for (size_t d = 0; d < t.deps.size(); ++d) {
+                if (bound[i] < 0 || finish[ t.deps[d] ] > finish[ bound[i] ])
+                    bound[i] = t.deps[d];
+            }
+        }
+        else {
+            // started when its resource became free
+            bound[i] = last[ r_best ];
+        }
+        if (r_best < nres) {
+            avail[ r_best ] = finish[i];
+            last[ r_best ] = i;
+        }
+
+        for (size_t s = 0; s < succ[i].size(); ++s) {
+            magma_int_t j = succ[i][s];
+            ready_time[j] = max( ready_time[j], finish[i] );
+            if (--count[j] == 0) {
+                magma_int_t r = (m_tasks[j].resource < 0 ? nres : m_tasks[j].resource);
+                ready[r].push( ready_t( ready_time[j], j ));
+            }
+        }
+    }
+
+    magma_sim_report report;
+    report.makespan      = 0;
+    report.critical_path = 0;
+    report.flops         = 0;
+    report.ntask         = ntask;
+    report.violations    = 0;
+
+    // makespan, dependency-only critical path, and self-check of dependencies
+    std::vector< double > chain( ntask, 0. );
+    magma_int_t i_last = -1;
+    for (magma_int_t i = 0; i < ntask; ++i) {
+        const task& t = m_tasks[i];
+        report.flops += t.flops;
+        for (size_t d = 0; d < t.deps.size(); ++d) {
+            chain[i] = max( chain[i], chain[ t.deps[d] ] );
+            if (start[i] < finish[ t.deps[d] ])
+                report.violations += 1;
+        }
+        chain[i] += t.cost;
+        report.critical_path = max( report.critical_path, chain[i] );
+        if (i_last < 0 || finish[i] > finish[ i_last ])
+            i_last = i;
+    }
+    if (i_last >= 0)
+        report.makespan = finish[ i_last ];
+
+    // busy time, and self-check that each resource runs one task at a time
+    std::vector< std::vector< std::pair< double, double > > > intervals( nres );
+    for (magma_int_t i = 0; i < ntask; ++i) {
+        if (m_tasks[i].resource >= 0)
+            intervals[ m_tasks[i].resource ].push_back( std::make_pair( start[i], finish[i] ));
+    }
+    for (magma_int_t r = 0; r < nres; ++r) {
+        std::sort( intervals[r].begin(), intervals[r].end() );
+        double busy = 0;
+        for (size_t s = 0; s < intervals[r].size(); ++s) {
+            busy += intervals[r][s].second - intervals[r][s].first;
+            if (s > 0 && intervals[r][s].first < intervals[r][s-1].second)
+                report.violations += 1;
+        }
+        magma_sim_resource res;
+        char name[32];
+        if (r == 0)
+            snprintf( name, sizeof(name), "host" );
+        else
+            snprintf( name, sizeof(name), "%s %lld",
+                      ((r-1) % 3 == 0 ? "dev" : (r-1) % 3 == 1 ? "h2d" : "d2h"),
+                      (long long) (r-1)/3 );
+        res.name = name;
+        res.busy = busy;
+        res.idle = report.makespan - busy;
+        report.resources.push_back( res );
+    }
+
+    // binding chain, back from the last task to finish
+    for (magma_int_t i = i_last; i >= 0; i = bound[i]) {
+        const task& t = m_tasks[i];
+        if (t.resource >= 0 && t.cost > 0)
+            report.path[ label( t ) ] += t.cost;
+    }
+
+    return report;
+}
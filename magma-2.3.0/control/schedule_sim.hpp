@@ -0,0 +1,202 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_SCHEDULE_SIM_HPP
+#define MAGMA_SCHEDULE_SIM_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "magma_internal.h"
+
+
+/***************************************************************************//**
+    Units that run the work of a simulated schedule: the host cores, each
+    device, and each device's host link, one server per direction.
+    @ingroup magma_sim
+*******************************************************************************/
+enum magma_sim_unit_t {
+    MagmaSimHost   = 0,
+    MagmaSimDevice = 1,
+    MagmaSimLink   = 2
+};
+
+/***************************************************************************//**
+    Kinds of work in a simulated schedule, with the sizes that the cost model
+    uses for each, in double precision.
+    @ingroup magma_sim
+*******************************************************************************/
+enum magma_sim_kind_t {
+    MagmaSimGemm,       ///< m-by-n C += m-by-k A times k-by-n B
+    MagmaSimSyrk,       ///< n-by-n C += n-by-k A times its transpose (m = n)
+    MagmaSimTrsm,       ///< m-by-n B, with a k-by-k triangle, k = m (left) or n (right)
+    MagmaSimPotrf,      ///< n-by-n Cholesky (m = n)
+    MagmaSimGetrf,      ///< m-by-n LU with partial pivoting
+    MagmaSimLaswp,      ///< k row interchanges across n columns
+    MagmaSimTranspose,  ///< m-by-n out-of-place transpose
+    MagmaSimCopy,       ///< m-by-n transfer over a link
+    MagmaSimNone        ///< event wait or sync; no cost
+};
+
+
+/***************************************************************************//**
+    Cost model of \ref magma_sim: the time of a kind of work on a unit.
+
+    By default, a roofline: latency + max( flops / peak, bytes / bandwidth ),
+    with flops from control/flops.h. Calibrated entries, measured on the
+    target machine, replace it for their unit and kind: the time is that
+    of the nearest entry, in log distance of m, n, k, scaled by the ratio
+    of flops (or bytes, for kinds without flops).
+
+    A model file has one setting per line; # starts a comment.
+
+        peak       host|device         Gflop/s
+        bandwidth  host|device|link    GB/s
+        latency    host|device|link    seconds
+        time       host|device|link  kind  m n k  seconds
+
+    where kind is gemm, syrk, trsm, potrf, getrf, laswp, transpose, or copy.
+    @ingroup magma_sim
+*******************************************************************************/
+class magma_sim_model
+{
+public:
+    magma_sim_model();
+
+    magma_int_t load( const char* filename );
+    magma_int_t save( const char* filename ) const;
+
+    void   calibrate( magma_sim_unit_t unit, magma_sim_kind_t kind,
+                      magma_int_t m, magma_int_t n, magma_int_t k, double seconds );
+    double time( magma_sim_unit_t unit, magma_sim_kind_t kind,
+                 magma_int_t m, magma_int_t n, magma_int_t k ) const;
+
+    static double flops( magma_sim_kind_t kind, magma_int_t m, magma_int_t n, magma_int_t k );
+    static double bytes( magma_sim_kind_t kind, magma_int_t m, magma_int_t n, magma_int_t k );
+
+    static const char* unit_name( magma_sim_unit_t unit );
+    static const char* kind_name( magma_sim_kind_t kind );
+
+    double peak[3];       ///< Gflop/s of the host and of one device, by magma_sim_unit_t
+    double bandwidth[3];  ///< GB/s of host memory, device memory, and one link direction
+    double latency[3];    ///< seconds per call
+
+private:
+    struct entry {
+        magma_sim_unit_t unit;
+        magma_sim_kind_t kind;
+        magma_int_t m, n, k;
+        double seconds;
+    };
+    std::vector< entry > table;
+};
+
+
+/***************************************************************************//**
+    Busy and idle time of one resource of a simulated schedule.
+    @ingroup magma_sim
+*******************************************************************************/
+struct magma_sim_resource
+{
+    std::string name;   ///< "host", or "dev d", "h2d d", "d2h d"
+    double busy;        ///< seconds
+    double idle;        ///< makespan - busy
+};
+
+/***************************************************************************//**
+    Prediction of \ref magma_sim::run.
+    @ingroup magma_sim
+*******************************************************************************/
+struct magma_sim_report
+{
+    double makespan;        ///< seconds, from the first issue to the last finish
+    double critical_path;   ///< seconds, longest chain of dependencies, without contention
+    double flops;           ///< total of the simulated work
+    magma_int_t ntask;
+    magma_int_t violations; ///< schedule self-check; 0 unless the simulator is wrong
+
+    std::vector< magma_sim_resource > resources;  ///< host, then per device: dev, h2d, d2h
+
+    /// The chain that bound the makespan in the simulated schedule, by
+    /// "unit kind", e.g., "host getrf": each task on it started when a
+    /// dependency finished, or when its resource became free.
+    std::map< std::string, double > path;
+};
+
+
+/***************************************************************************//**
+    Discrete-event simulator of a hybrid schedule, for tuning nb, look-ahead,
+    queue count, and ngpu without running the driver.
+
+    A dry run of a driver, e.g., magma_dpotrf3_mgpu_sim, replays its loops
+    and makes these calls where the driver calls MAGMA, so the simulator
+    sees the driver's tasks, transfers, events and syncs in issue order.
+    As in the host backend, each queue runs its work in order; the host
+    issues in program order, waits at queue_sync, and runs host work
+    itself. A driver's queue q maps to queue min( q, nqueue-1 ), so fewer
+    queues serialize what the driver overlaps.
+
+    run() schedules the work on the resources, the host cores, and per
+    device, its compute unit and two link directions, each doing one task
+    at a time; of the tasks that are ready, the one that can start first
+    goes first, then in issue order.
+    @ingroup magma_sim
+*******************************************************************************/
+class magma_sim
+{
+public:
+    magma_sim( const magma_sim_model& model, magma_int_t ngpu, magma_int_t nqueue );
+
+    magma_int_t ngpu() const { return m_ngpu; }
+
+    void kernel( magma_int_t dev, magma_int_t queue, magma_sim_kind_t kind,
+                 magma_int_t m, magma_int_t n, magma_int_t k );
+    void setmatrix( magma_int_t dev, magma_int_t queue, magma_int_t m, magma_int_t n );
+    void getmatrix( magma_int_t dev, magma_int_t queue, magma_int_t m, magma_int_t n );
+    void host( magma_sim_kind_t kind, magma_int_t m, magma_int_t n, magma_int_t k );
+
+    void event_record( magma_int_t event, magma_int_t dev, magma_int_t queue );
+    void queue_wait_event( magma_int_t dev, magma_int_t queue, magma_int_t event );
+    void queue_sync( magma_int_t dev, magma_int_t queue );
+
+    magma_sim_report run() const;
+
+private:
+    struct task {
+        magma_int_t      resource;  // -1 for waits and syncs
+        magma_sim_kind_t kind;
+        double           cost;
+        double           flops;
+        std::vector< magma_int_t > deps;
+    };
+
+    magma_int_t add( magma_int_t resource, magma_sim_kind_t kind,
+                     magma_int_t m, magma_int_t n, magma_int_t k,
+                     magma_int_t dev, magma_int_t queue );
+    magma_int_t& tail( magma_int_t dev, magma_int_t queue );
+    std::string label( const task& t ) const;
+
+    const magma_sim_model& m_model;
+    magma_int_t m_ngpu, m_nqueue;
+    std::vector< task > m_tasks;
+    std::vector< magma_int_t > m_tail;         // last task of each queue
+    magma_int_t m_host;                        // last task of the host
+    std::map< magma_int_t, magma_int_t > m_events;  // event -> task recorded
+};
+
+
+/******************************************************************************/
+// dry runs of the drivers
+void magma_dpotrf3_mgpu_sim(
+    magma_sim& sim, magma_int_t n, magma_int_t nb, magma_int_t lookahead );
+
+void magma_dgetrf_mgpu_sim(
+    magma_sim& sim, magma_int_t m, magma_int_t n, magma_int_t nb, magma_int_t lookahead );
+
+#endif // MAGMA_SCHEDULE_SIM_HPP
@@ -0,0 +1,275 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from control/zhouseholder_cpu.cpp, normal z -> s, Wed Nov 15 00:34:20 2017
+*/
+#include "householder_host.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SGEQRT3_CPU computes a QR factorization of an M-by-N matrix A, M >= N,
+    in CPU memory, using the recursive algorithm of Elmroth and Gustavson,
+    as LAPACK's sgeqrt3 does, returning both the scalar factors tau of the
+    elementary reflectors, as sgeqrf does, and the triangular factor T of
+    the block reflector, as slarft does, from one pass over A.
+    The products with the tall part of A are in parallel; see
+    control/householder_host.hpp. Used for the CPU panels of sgeqrf.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= N.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in,out]
+    A       REAL array, dimension (LDA,N)
+            On entry, the M-by-N matrix A.
+            On exit, the elements on and above the diagonal contain the
+            N-by-N upper triangular matrix R; the elements below the
+            diagonal are the columns of V, the Householder vectors, as
+            returned by sgeqrf.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @param[out]
+    tau     REAL array, dimension (N)
+            The scalar factors of the elementary reflectors, as returned by
+            sgeqrf. They are also the diagonal of T. May be NULL.
+
+    @param[out]
+    T       REAL array, dimension (LDT,N)
+            The N-by-N upper triangular factor of the block reflector,
+            H = H(1) H(2) . . . H(n) = I - V * T * V**H.
+            The strictly lower triangular part of T is not referenced.
+
+    @param[in]
+    ldt     INTEGER
+            The leading dimension of the array T.  LDT >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_geqrf_comp
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sgeqrt3_cpu(
+    magma_int_t m, magma_int_t n,
+    float *A, magma_int_t lda,
+    float *tau,
+    float *T, magma_int_t ldt,
+    magma_int_t *info )
+{
+    *info = 0;
+    if (n < 0)
+        *info = -2;
+    else if (m < n)
+        *info = -1;
+    else if (lda < max(1,m))
+        *info = -4;
+    else if (ldt < max(1,n))
+        *info = -7;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    if (n == 0)
+        return *info;
+
+    householder_host_geqrt3( m, n, A, lda, T, ldt );
+
+    if (tau != NULL) {
+        for (magma_int_t i = 0; i < n; ++i) {
+            tau[i] = T[ i + i*ldt ];
+        }
+    }
+    return *info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLARFB_CPU applies a real block reflector H or its transpose
+    H^H to a real M-by-N matrix C, in CPU memory, from the
+    left, the right, or both sides (C = op(H) C op(H)^H, for square C).
+
+    For the usual forward, columnwise storage, as from sgeqrf or
+    magma_sgeqrt3_cpu, V is packed once, with its unit diagonal and zeros
+    made explicit, and C is updated by GEMMs in parallel over blocks of its
+    columns (left) or rows (right); applying from both sides reuses the
+    packed V. See control/householder_host.hpp. Other storage is applied by
+    LAPACK's slarfb.
+
+    Arguments
+    ---------
+    @param[in]
+    side    magma_side_t
+      -     = MagmaLeft:      apply op(H) from the Left
+      -     = MagmaRight:     apply op(H) from the Right
+      -     = MagmaBothSides: apply op(H) from the Left and op(H)^H from
+                              the Right; forward, columnwise only, M = N.
+
+    @param[in]
+    trans   magma_trans_t
+      -     = MagmaNoTrans:    op(H) = H   (No transpose)
+      -     = MagmaTrans: op(H) = H^H (Conjugate transpose)
+
+    @param[in]
+    direct  magma_direct_t
+            Indicates how H is formed from a product of elementary
+            reflectors
+      -     = MagmaForward:  H = H(1) H(2) . . . H(k)
+      -     = MagmaBackward: H = H(k) . . . H(2) H(1)
+
+    @param[in]
+    storev  magma_storev_t
+            Indicates how the vectors which define the elementary
+            reflectors are stored:
+      -     = MagmaColumnwise: Columnwise
+      -     = MagmaRowwise:    Rowwise
+
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix C.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix C.
+
+    @param[in]
+    k       INTEGER
+            The order of the matrix T (= the number of elementary
+            reflectors whose product defines the block reflector).
+
+    @param[in]
+    V       REAL array, dimension
+                (LDV,K) if STOREV = MagmaColumnwise
+                (LDV,M) if STOREV = MagmaRowwise and SIDE = MagmaLeft
+                (LDV,N) if STOREV = MagmaRowwise and SIDE = MagmaRight
+            The matrix V, as in LAPACK's slarfb.
+
+    @param[in]
+    ldv     INTEGER
+            The leading dimension of the array V.
+            If STOREV = MagmaColumnwise and SIDE = MagmaLeft, LDV >= max(1,M);
+            if STOREV = MagmaColumnwise and SIDE = MagmaRight, LDV >= max(1,N);
+            if STOREV = MagmaRowwise, LDV >= K.
+
+    @param[in]
+    T       REAL array, dimension (LDT,K)
+            The triangular k-by-k matrix T in the representation of the
+            block reflector.
+
+    @param[in]
+    ldt     INTEGER
+            The leading dimension of the array T. LDT >= K.
+
+    @param[in,out]
+    C       REAL array, dimension (LDC,N)
+            On entry, the M-by-N matrix C.
+            On exit, C is overwritten by op(H)*C, C*op(H), or
+            op(H)*C*op(H)^H.
+
+    @param[in]
+    ldc     INTEGER
+            The leading dimension of the array C. LDC >= max(1,M).
+
+    @return info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_larfb
+*******************************************************************************/
+extern "C" magma_int_t
+magma_slarfb_cpu(
+    magma_side_t side, magma_trans_t trans, magma_direct_t direct, magma_storev_t storev,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    const float *V, magma_int_t ldv,
+    const float *T, magma_int_t ldt,
+    float *C, magma_int_t ldc )
+{
+    bool compact = (direct == MagmaForward && storev == MagmaColumnwise);
+    magma_int_t nv = (side == MagmaRight ? n : m);
+    float *work;
+
+    magma_int_t info = 0;
+    if (side != MagmaLeft && side != MagmaRight && side != MagmaBothSides)
+        info = -1;
+    else if (trans != MagmaNoTrans && trans != MagmaTrans)
+        info = -2;
+    else if (direct != MagmaForward && direct != MagmaBackward)
+        info = -3;
+    else if (storev != MagmaColumnwise && storev != MagmaRowwise)
+        info = -4;
+    else if (side == MagmaBothSides && ! compact)
+        info = -4;
+    else if (m < 0)
+        info = -5;
+    else if (n < 0 || (side == MagmaBothSides && n != m))
+        info = -6;
+    else if (k < 0)
+        info = -7;
+    else if (ldv < max(1, (storev == MagmaColumnwise ? nv : k)))
+        info = -9;
+    else if (ldt < max(1,k))
+        info = -11;
+    else if (ldc < max(1,m))
+        info = -13;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if (m == 0 || n == 0 || k == 0)
+        return info;
+
+    if (! compact) {
+        magma_int_t ldwork = (side == MagmaLeft ? n : m);
+        if (MAGMA_SUCCESS != magma_smalloc_cpu( &work, ldwork*k )) {
+            info = MAGMA_ERR_HOST_ALLOC;
+            return info;
+        }
+        lapackf77_slarfb( lapack_side_const(side), lapack_trans_const(trans),
+                          lapack_direct_const(direct), lapack_storev_const(storev),
+                          &m, &n, &k, V, &ldv, T, &ldt, C, &ldc, work, &ldwork );
+        magma_free_cpu( work );
+        return info;
+    }
+
+    // the packed V, with explicit unit diagonal and zeros
+    if (MAGMA_SUCCESS != magma_smalloc_cpu( &work, nv*k )) {
+        info = MAGMA_ERR_HOST_ALLOC;
+        return info;
+    }
+    householder_host_pack_v( nv, k, V, ldv, work );
+
+    if (side == MagmaLeft || side == MagmaBothSides) {
+        householder_host_larfb( MagmaLeft, trans, m, n, k, work, T, ldt, C, ldc );
+    }
+    if (side == MagmaRight || side == MagmaBothSides) {
+        magma_trans_t trans_r = trans;
+        if (side == MagmaBothSides)
+            trans_r = (trans == MagmaNoTrans ? MagmaTrans : MagmaNoTrans);
+        householder_host_larfb( MagmaRight, trans_r, m, n, k, work, T, ldt, C, ldc );
+    }
+
+    magma_free_cpu( work );
+    return info;
+}
@@ -0,0 +1,289 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+#include "convert_host.hpp"  // includes magma_internal.h, after the STL headers
+
+// largest finite binary16, 65504, and bfloat16, 0x7f7f0000 as a float
+const float half_max     = 65504.f;
+const float bfloat16_max = 3.38953139e+38f;
+
+
+/******************************************************************************/
+// checks arguments of the conversions below; returns info
+static magma_int_t lag2h_check(
+    magma_int_t m, magma_int_t n, magma_int_t lda, magma_int_t ldb )
+{
+    magma_int_t info = 0;
+    if ( m < 0 )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( lda < max(1,m) )
+        info = -4;
+    else if ( ldb < max(1,m) )
+        info = -6;
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLAG2H_CPU converts a single-real matrix, SA, in CPU memory,
+                     to IEEE half precision (binary16) storage, HA,
+    rounding to nearest even. Columns are converted in parallel, using
+    F16C instructions if available; see control/convert_host.hpp.
+
+    Half precision is a storage format here: to compute with HA, convert
+    it back with magma_hlag2s_cpu. Entries of magnitude 65520 or more
+    round to +-Inf in HA; NaN stays NaN. INFO reports entries greater
+    than 65504, the largest finite half, as LAPACK's slag2s would.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of lines of the matrix SA.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix SA.  N >= 0.
+
+    @param[in]
+    SA      REAL array, dimension (LDSA,N)
+            On entry, the M-by-N matrix SA.
+
+    @param[in]
+    ldsa    INTEGER
+            The leading dimension of the array SA.  LDSA >= max(1,M).
+
+    @param[out]
+    HA      magmaHalf array, dimension (LDHA,N)
+            On exit, the M-by-N matrix HA.
+
+    @param[in]
+    ldha    INTEGER
+            The leading dimension of the array HA.  LDHA >= max(1,M).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+      -     > 0:  SA(i,j), with INFO = 1 + i + j*LDSA (0-based i, j), is the
+                  first entry, in column-major order, greater than 65504
+                  in magnitude.
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magma_slag2h_cpu(
+    magma_int_t m, magma_int_t n,
+    const float *SA, magma_int_t ldsa,
+    magmaHalf   *HA, magma_int_t ldha,
+    magma_int_t *info )
+{
+    *info = lag2h_check( m, n, ldsa, ldha );
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_int_t k = magma_convert_host< float, convert_host_half, true >(
+        MagmaFull, m, n, SA, ldsa, HA, ldha, 1, half_max );
+    *info = k + 1;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    HLAG2S_CPU converts a matrix in IEEE half precision storage, HA,
+                     to a single-real matrix, SA, in CPU memory.
+    The conversion is exact. See magma_slag2h_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of lines of the matrix HA.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix HA.  N >= 0.
+
+    @param[in]
+    HA      magmaHalf array, dimension (LDHA,N)
+            On entry, the M-by-N matrix HA.
+
+    @param[in]
+    ldha    INTEGER
+            The leading dimension of the array HA.  LDHA >= max(1,M).
+
+    @param[out]
+    SA      REAL array, dimension (LDSA,N)
+            On exit, the M-by-N matrix SA.
+
+    @param[in]
+    ldsa    INTEGER
+            The leading dimension of the array SA.  LDSA >= max(1,M).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magma_hlag2s_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaHalf *HA, magma_int_t ldha,
+    float           *SA, magma_int_t ldsa,
+    magma_int_t *info )
+{
+    *info = lag2h_check( m, n, ldha, ldsa );
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_convert_host< convert_host_half, float, false >(
+        MagmaFull, m, n, HA, ldha, SA, ldsa, 1, 0 );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLAG2BF_CPU converts a single-real matrix, SA, in CPU memory,
+                      to bfloat16 storage, BA, rounding to nearest even.
+    bfloat16 has the range of single precision with an 8-bit significand;
+    entries greater than its largest finite value, 0x1.fep+127, are out
+    of range and mostly round to +-Inf in BA. Otherwise as magma_slag2h_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of lines of the matrix SA.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix SA.  N >= 0.
+
+    @param[in]
+    SA      REAL array, dimension (LDSA,N)
+            On entry, the M-by-N matrix SA.
+
+    @param[in]
+    ldsa    INTEGER
+            The leading dimension of the array SA.  LDSA >= max(1,M).
+
+    @param[out]
+    BA      magmaBfloat16 array, dimension (LDBA,N)
+            On exit, the M-by-N matrix BA.
+
+    @param[in]
+    ldba    INTEGER
+            The leading dimension of the array BA.  LDBA >= max(1,M).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+      -     > 0:  SA(i,j), with INFO = 1 + i + j*LDSA (0-based i, j), is the
+                  first entry, in column-major order, out of range.
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magma_slag2bf_cpu(
+    magma_int_t m, magma_int_t n,
+    const float   *SA, magma_int_t ldsa,
+    magmaBfloat16 *BA, magma_int_t ldba,
+    magma_int_t *info )
+{
+    *info = lag2h_check( m, n, ldsa, ldba );
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_int_t k = magma_convert_host< float, convert_host_bfloat16, true >(
+        MagmaFull, m, n, SA, ldsa, BA, ldba, 1, bfloat16_max );
+    *info = k + 1;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    BFLAG2S_CPU converts a matrix in bfloat16 storage, BA,
+                      to a single-real matrix, SA, in CPU memory.
+    The conversion is exact. See magma_slag2bf_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of lines of the matrix BA.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix BA.  N >= 0.
+
+    @param[in]
+    BA      magmaBfloat16 array, dimension (LDBA,N)
+            On entry, the M-by-N matrix BA.
+
+    @param[in]
+    ldba    INTEGER
+            The leading dimension of the array BA.  LDBA >= max(1,M).
+
+    @param[out]
+    SA      REAL array, dimension (LDSA,N)
+            On exit, the M-by-N matrix SA.
+
+    @param[in]
+    ldsa    INTEGER
+            The leading dimension of the array SA.  LDSA >= max(1,M).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magma_bflag2s_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaBfloat16 *BA, magma_int_t ldba,
+    float               *SA, magma_int_t ldsa,
+    magma_int_t *info )
+{
+    *info = lag2h_check( m, n, ldba, ldsa );
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_convert_host< convert_host_bfloat16, float, false >(
+        MagmaFull, m, n, BA, ldba, SA, ldsa, 1, 0 );
+}
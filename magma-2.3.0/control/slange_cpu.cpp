@@ -0,0 +1,374 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from control/zlange_cpu.cpp, normal z -> s, Wed Nov 15 00:34:20 2017
+*/
+#include "norm_host.hpp"  // includes magma_internal.h, after the STL headers
+
+#define REAL
+
+// index into the values array of magma_norms_host, or -1 if unsupported
+static magma_int_t norm_index( magma_norm_t norm )
+{
+    switch (norm) {
+        case MagmaMaxNorm:       return magma_norm_max;
+        case MagmaOneNorm:       return magma_norm_one;
+        case MagmaInfNorm:       return magma_norm_inf;
+        case MagmaFrobeniusNorm: return magma_norm_fro;
+        default:                 return -1;
+    }
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLANGE_CPU returns the value of the one norm, or the Frobenius norm, or
+    the infinity norm, or the element of largest absolute value of a
+    complex matrix A in CPU memory, as LAPACK's slange does.
+    Unlike slange, it reads A once, in parallel; see control/norm_host.hpp.
+
+    Arguments
+    ---------
+    @param[in]
+    norm    magma_norm_t
+            Specifies the value to be returned:
+      -     = MagmaMaxNorm:       max(abs(A(i,j))), not a consistent matrix norm
+      -     = MagmaOneNorm:       norm1(A), maximum column sum
+      -     = MagmaInfNorm:       normI(A), maximum row sum
+      -     = MagmaFrobeniusNorm: normF(A), square root of sum of squares
+
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+            When M = 0, SLANGE_CPU returns zero.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+            When N = 0, SLANGE_CPU returns zero.
+
+    @param[in]
+    A       REAL array, dimension (LDA,N)
+            The M-by-N matrix A.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(M,1).
+
+    @return The norm, or, if an argument is illegal, the negative of its
+            index, as magmablas_slange does.
+
+    @ingroup magma_lange
+*******************************************************************************/
+extern "C" float
+magma_slange_cpu(
+    magma_norm_t norm, magma_int_t m, magma_int_t n,
+    const float *A, magma_int_t lda )
+{
+    magma_int_t info = 0;
+    magma_int_t k = norm_index( norm );
+    if (k < 0)
+        info = -1;
+    else if (m < 0)
+        info = -2;
+    else if (n < 0)
+        info = -3;
+    else if (lda < max(1,m))
+        info = -5;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if (m == 0 || n == 0)
+        return 0;
+
+    float values[4];
+    magma_norms_host( m, n, A, lda, values, norm == MagmaInfNorm );
+    return values[k];
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLANGE_ALL_CPU computes the max, one, infinity, and Frobenius norms of
+    a complex matrix A in CPU memory together, in one pass over A;
+    see magma_slange_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    A       REAL array, dimension (LDA,N)
+            The M-by-N matrix A.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(M,1).
+
+    @param[out]
+    values  DOUBLE PRECISION array, dimension (4)
+            On exit, the max, one, infinity, and Frobenius norms of A,
+            in that order. All are zero if M = 0 or N = 0.
+
+    @return
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value.
+
+    @ingroup magma_lange
+*******************************************************************************/
+extern "C" magma_int_t
+magma_slange_all_cpu(
+    magma_int_t m, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float values[4] )
+{
+    magma_int_t info = 0;
+    if (m < 0)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (lda < max(1,m))
+        info = -4;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if (m == 0 || n == 0) {
+        values[0] = values[1] = values[2] = values[3] = 0;
+        return info;
+    }
+
+    magma_norms_host( m, n, A, lda, values );
+    return info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLANHE_CPU returns the value of the one norm, or the Frobenius norm, or
+    the infinity norm, or the element of largest absolute value of a
+    complex symmetric matrix A in CPU memory, as LAPACK's slansy does.
+    Only the triangle given by uplo is read, once, in parallel.
+
+    Arguments
+    ---------
+    @param[in]
+    norm    magma_norm_t
+            Specifies the value to be returned, as in magma_slange_cpu.
+            For symmetric A, the one and infinity norms are equal.
+
+    @param[in]
+    uplo    magma_uplo_t
+            Whether the upper or lower triangular part of A is stored:
+      -     = MagmaUpper: upper triangular part of A is referenced
+      -     = MagmaLower: lower triangular part of A is referenced
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+            When N = 0, SLANHE_CPU returns zero.
+
+    @param[in]
+    A       REAL array, dimension (LDA,N)
+            The symmetric matrix A. The imaginary parts of the diagonal
+            are assumed to be zero.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(N,1).
+
+    @return The norm, or, if an argument is illegal, the negative of its index.
+
+    @ingroup magma_lanhe
+*******************************************************************************/
+extern "C" float
+magma_slansy_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda )
+{
+    magma_int_t info = 0;
+    magma_int_t k = norm_index( norm );
+    if (k < 0)
+        info = -1;
+    else if (uplo != MagmaLower && uplo != MagmaUpper)
+        info = -2;
+    else if (n < 0)
+        info = -3;
+    else if (lda < max(1,n))
+        info = -5;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if (n == 0)
+        return 0;
+
+    float values[4];
+    magma_norms_sym_host( true, uplo, n, A, lda, values );
+    return values[k];
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLANHE_ALL_CPU computes the max, one (= infinity), and Frobenius norms
+    of a complex symmetric matrix A in CPU memory together, reading one
+    triangle of A once; see magma_slansy_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+            Whether the upper or lower triangular part of A is stored.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    A       REAL array, dimension (LDA,N)
+            The symmetric matrix A.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(N,1).
+
+    @param[out]
+    values  DOUBLE PRECISION array, dimension (4)
+            On exit, the max, one, infinity, and Frobenius norms of A,
+            in that order.
+
+    @return
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value.
+
+    @ingroup magma_lanhe
+*******************************************************************************/
+extern "C" magma_int_t
+magma_slansy_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float values[4] )
+{
+    magma_int_t info = 0;
+    if (uplo != MagmaLower && uplo != MagmaUpper)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (lda < max(1,n))
+        info = -4;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if (n == 0) {
+        values[0] = values[1] = values[2] = values[3] = 0;
+        return info;
+    }
+
+    magma_norms_sym_host( true, uplo, n, A, lda, values );
+    return info;
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    Purpose
+    -------
+    SLANSY_CPU returns the value of the one norm, or the Frobenius norm, or
+    the infinity norm, or the element of largest absolute value of a
+    complex symmetric matrix A in CPU memory, as LAPACK's slansy does.
+    Arguments are the same as for magma_slansy_cpu.
+
+    @ingroup magma_lanhe
+*******************************************************************************/
+extern "C" float
+magma_slansy_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda )
+{
+    magma_int_t info = 0;
+    magma_int_t k = norm_index( norm );
+    if (k < 0)
+        info = -1;
+    else if (uplo != MagmaLower && uplo != MagmaUpper)
+        info = -2;
+    else if (n < 0)
+        info = -3;
+    else if (lda < max(1,n))
+        info = -5;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if (n == 0)
+        return 0;
+
+    float values[4];
+    magma_norms_sym_host( false, uplo, n, A, lda, values );
+    return values[k];
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLANSY_ALL_CPU computes the max, one (= infinity), and Frobenius norms
+    of a complex symmetric matrix A in CPU memory together.
+    Arguments are the same as for magma_slansy_all_cpu.
+
+    @ingroup magma_lanhe
+*******************************************************************************/
+extern "C" magma_int_t
+magma_slansy_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float values[4] )
+{
+    magma_int_t info = 0;
+    if (uplo != MagmaLower && uplo != MagmaUpper)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (lda < max(1,n))
+        info = -4;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+
+    if (n == 0) {
+        values[0] = values[1] = values[2] = values[3] = 0;
+        return info;
+    }
+
+    magma_norms_sym_host( false, uplo, n, A, lda, values );
+    return info;
+}
+#endif // COMPLEX
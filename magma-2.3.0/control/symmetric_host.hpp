@@ -0,0 +1,298 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_SYMMETRIC_HOST_HPP
+#define MAGMA_SYMMETRIC_HOST_HPP
+
+#include <stdint.h>
+#include <string.h>
+
+#include "transpose_host.hpp"  // includes magma_internal.h
+
+/***************************************************************************//**
+    Host symmetric-storage engine, used by magmablas_*symmetrize* with the
+    host backend, by magma_*symmetrize*_cpu, by the packed (TP) and
+    rectangular full packed (RFP, TF) conversions magma_*trttp_cpu,
+    *tpttr_cpu, *trttf_cpu, *tfttr_cpu, and by magma_*pptrf_cpu.
+
+    Everything is built from four pieces, each parallel over OpenMP threads:
+    copies of a triangle or rectangle, column by column; and transposes of
+    a rectangle, by the transpose engine (control/transpose_host.hpp), or of
+    a triangle, whose tiles off the diagonal are transposed by that engine
+    while diagonal tiles recurse by halves, down to small scalar triangles.
+    Symmetrizing is a strict triangular transpose in place.
+
+    RFP storage keeps the triangle of an n-by-n matrix in n*(n+1)/2
+    elements with no padding, as two full-storage blocks that LAPACK-style
+    routines can use directly: a trapezoid of half the columns, and the
+    remaining triangle transposed into the space above (lower) or below
+    (upper) it. With transr = ConjTrans, the whole layout is transposed.
+    Each of the eight cases (transr, uplo, n even or odd) is two or three
+    pieces, converted either way by swapping source and destination.
+
+    Packed storage keeps the triangle column by column; A(i,j) is at
+    AP[ i + j*(2n-j-1)/2 ] if lower (i >= j), AP[ i + j*(j+1)/2 ] if upper.
+    Sub-blocks are packed and unpacked column by column.
+*******************************************************************************/
+
+/// tile size of triangular transposes, distributed to the threads
+const magma_int_t magma_symmetric_nb = 256;
+
+/// order of diagonal blocks done by scalar loops in triangular transposes
+const magma_int_t magma_symmetric_nb_leaf = 32;
+
+
+/******************************************************************************/
+// Real part, as a value of the same type; sets Hermitian diagonals.
+static inline float  symmetric_host_real( float  a ) { return a; }
+static inline double symmetric_host_real( double a ) { return a; }
+
+static inline magmaFloatComplex symmetric_host_real( magmaFloatComplex a )
+{
+    return MAGMA_C_MAKE( MAGMA_C_REAL( a ), 0 );
+}
+
+static inline magmaDoubleComplex symmetric_host_real( magmaDoubleComplex a )
+{
+    return MAGMA_Z_MAKE( MAGMA_Z_REAL( a ), 0 );
+}
+
+
+/******************************************************************************/
+// Offset of A(0,j) in packed storage of an n-by-n triangle; 64-bit,
+// as n*(n+1)/2 overflows 32-bit integers for n > 65535.
+static inline int64_t packed_host_offset(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t j )
+{
+    if (uplo == MagmaLower)
+        return int64_t(j) * (2*int64_t(n) - j - 1) / 2;
+    else
+        return int64_t(j) * (j + 1) / 2;
+}
+
+
+/******************************************************************************/
+// Copies the m-by-n S to D, or only its uplo triangle (m == n) if uplo is
+// Lower or Upper, including the diagonal. In parallel over columns.
+template< typename T >
+static void symmetric_host_copy(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    const T* S, magma_int_t lds, T* D, magma_int_t ldd )
+{
+    #pragma omp parallel for schedule(dynamic, 16) if ( m*n > magma_symmetric_nb*magma_symmetric_nb )
+    for (magma_int_t j = 0; j < n; ++j) {
+        magma_int_t i1 = (uplo == MagmaLower ? j : 0);
+        magma_int_t i2 = (uplo == MagmaUpper ? j+1 : m);
+        memcpy( D + i1 + j*ldd, S + i1 + j*lds, (i2 - i1)*sizeof(T) );
+    }
+}
+
+
+/******************************************************************************/
+// D(j,i) = op( S(i,j) ) for S(i,j) in the uplo triangle of the n-by-n S,
+// off the diagonal only if Strict; op is conj if Conj. As the other triangle
+// of D is written, S and D may be the same matrix. Recurses by halves,
+// transposing the off-diagonal half by the transpose engine.
+template< typename T, bool Conj >
+static void symmetric_host_trans_rec(
+    magma_uplo_t uplo, bool strict, magma_int_t n,
+    const T* S, magma_int_t lds, T* D, magma_int_t ldd )
+{
+    if (n <= magma_symmetric_nb_leaf) {
+        for (magma_int_t j = 0; j < n; ++j) {
+            magma_int_t i1 = (uplo == MagmaLower ? j + strict : 0);
+            magma_int_t i2 = (uplo == MagmaLower ? n : j + 1 - strict);
+            for (magma_int_t i = i1; i < i2; ++i) {
+                T a = S[ i + j*lds ];
+                D[ j + i*ldd ] = (Conj ? transpose_host_traits< T >::conj( a ) : a);
+            }
+        }
+        return;
+    }
+    const int bs = transpose_host_kernel< T, Conj >::bs;
+    magma_int_t n1 = magma_roundup( n/2, bs );
+    magma_int_t n2 = n - n1;
+    symmetric_host_trans_rec< T, Conj >( uplo, strict, n1, S, lds, D, ldd );
+    symmetric_host_trans_rec< T, Conj >( uplo, strict, n2, S + n1 + n1*lds, lds,
+                                                           D + n1 + n1*ldd, ldd );
+    if (uplo == MagmaLower)
+        transpose_host_rec< T, Conj >( n2, n1, S + n1, lds, D + n1*ldd, ldd );
+    else
+        transpose_host_rec< T, Conj >( n1, n2, S + n1*lds, lds, D + n1, ldd );
+}
+
+
+/******************************************************************************/
+// Triangular transpose of the n-by-n S into D, as symmetric_host_trans_rec,
+// in parallel over tiles of the triangle.
+template< typename T, bool Conj >
+static void symmetric_host_trans(
+    magma_uplo_t uplo, bool strict, magma_int_t n,
+    const T* S, magma_int_t lds, T* D, magma_int_t ldd )
+{
+    const magma_int_t nb = magma_symmetric_nb;
+    magma_int_t nt = magma_ceildiv( n, nb );
+    #pragma omp parallel for schedule(dynamic) if ( nt > 1 )
+    for (magma_int_t k = 0; k < nt*nt; ++k) {
+        magma_int_t it = k % nt, jt = k / nt;
+        if (uplo == MagmaLower ? it < jt : it > jt)
+            continue;
+        magma_int_t i0 = it*nb, j0 = jt*nb;
+        magma_int_t ib = min( nb, n - i0 ), jb = min( nb, n - j0 );
+        if (it == jt) {
+            symmetric_host_trans_rec< T, Conj >(
+                uplo, strict, ib, S + i0 + i0*lds, lds, D + i0 + i0*ldd, ldd );
+        }
+        else {
+            transpose_host_rec< T, Conj >(
+                ib, jb, S + i0 + j0*lds, lds, D + j0 + i0*ldd, ldd );
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Symmetrizes the n-by-n A in place: copies op( the uplo triangle )^T to
+    the other triangle, where op is conj if conjugate, which also makes the
+    diagonal real, as Hermitian matrices have.
+*******************************************************************************/
+template< typename T >
+void magma_symmetrize_host(
+    bool conjugate, magma_uplo_t uplo, magma_int_t n, T* A, magma_int_t lda )
+{
+    if (conjugate) {
+        symmetric_host_trans< T, true >( uplo, true, n, A, lda, A, lda );
+        for (magma_int_t i = 0; i < n; ++i) {
+            A[ i + i*lda ] = symmetric_host_real( A[ i + i*lda ] );
+        }
+    }
+    else {
+        symmetric_host_trans< T, false >( uplo, true, n, A, lda, A, lda );
+    }
+}
+
+
+/******************************************************************************/
+// The four pieces of RFP conversions, from S to D if forward, else back.
+// Transposes back read D's triangle, which is on the opposite side.
+template< typename T >
+static void rfp_host_copy(
+    bool forward, magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    T* S, magma_int_t lds, T* D, magma_int_t ldd )
+{
+    if (forward)
+        symmetric_host_copy( uplo, m, n, S, lds, D, ldd );
+    else
+        symmetric_host_copy( uplo, m, n, D, ldd, S, lds );
+}
+
+template< typename T >
+static void rfp_host_trans(
+    bool forward, magma_uplo_t uplo, magma_int_t n,
+    T* S, magma_int_t lds, T* D, magma_int_t ldd )
+{
+    if (forward)
+        symmetric_host_trans< T, true >( uplo, false, n, S, lds, D, ldd );
+    else
+        symmetric_host_trans< T, true >( (uplo == MagmaLower ? MagmaUpper : MagmaLower),
+                                         false, n, D, ldd, S, lds );
+}
+
+template< typename T >
+static void rfp_host_trans_rect(
+    bool forward, magma_int_t m, magma_int_t n,
+    T* S, magma_int_t lds, T* D, magma_int_t ldd )
+{
+    if (forward)
+        magma_transpose_host< T, true >( m, n, S, lds, D, ldd );
+    else
+        magma_transpose_host< T, true >( n, m, D, ldd, S, lds );
+}
+
+
+/***************************************************************************//**
+    Converts the uplo triangle of the n-by-n A to RFP format ARF if to_rfp,
+    else ARF back to A. With n1 and n2 the leading and trailing halves, and
+    s = 1 if n is even (padding a row), else 0, the layout with
+    transr = NoTrans is ( n + s )-by-( (n+1)/2 ):
+      - lower, n1 = ceil(n/2): rows s:n+s hold the trapezoid A(0:n, 0:n1);
+        the triangle above, at column 1-s, holds A(n1:n, n1:n)^H.
+      - upper, n1 = floor(n/2): columns hold the trapezoid A(0:n, n1:n);
+        the triangle below, at row n2+s, holds A(0:n1, 0:n1)^H.
+    With transr = ConjTrans, ARF is the conjugate-transpose of that.
+*******************************************************************************/
+template< typename T >
+void magma_rfp_host(
+    bool to_rfp, magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    T* A, magma_int_t lda, T* ARF )
+{
+    const bool f = to_rfp;
+    magma_int_t s  = (n % 2 == 0 ? 1 : 0);
+    magma_int_t ld = (transr == MagmaNoTrans ? n + s : (n+1)/2);
+    bool trans = (transr != MagmaNoTrans);
+    if (uplo == MagmaLower) {
+        magma_int_t n1 = n - n/2, n2 = n/2;
+        T* A22 = A + n1 + n1*lda;
+        if (! trans) {
+            rfp_host_copy(  f, MagmaLower, n1, n1, A,      lda, ARF + s,      ld );
+            rfp_host_copy(  f, MagmaFull,  n2, n1, A + n1, lda, ARF + s + n1, ld );
+            rfp_host_trans( f, MagmaLower, n2,     A22,    lda, ARF + (1-s)*ld, ld );
+        }
+        else {
+            rfp_host_trans(      f, MagmaLower, n1,     A,      lda, ARF + s*ld,      ld );
+            rfp_host_trans_rect( f,             n2, n1, A + n1, lda, ARF + (s+n1)*ld, ld );
+            rfp_host_copy(       f, MagmaLower, n2, n2, A22,    lda, ARF + (1-s),     ld );
+        }
+    }
+    else {
+        magma_int_t n1 = n/2, n2 = n - n/2;
+        T* A12 = A + n1*lda;
+        T* A22 = A + n1 + n1*lda;
+        if (! trans) {
+            rfp_host_copy(  f, MagmaFull,  n1, n2, A12, lda, ARF,          ld );
+            rfp_host_copy(  f, MagmaUpper, n2, n2, A22, lda, ARF + n1,     ld );
+            rfp_host_trans( f, MagmaUpper, n1,     A,   lda, ARF + n2 + s, ld );
+        }
+        else {
+            rfp_host_trans_rect( f,             n1, n2, A12, lda, ARF,             ld );
+            rfp_host_trans(      f, MagmaUpper, n2,     A22, lda, ARF + n1*ld,     ld );
+            rfp_host_copy(       f, MagmaUpper, n1, n1, A,   lda, ARF + (n2+s)*ld, ld );
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Copies the block A(i0:i0+m, j0:j0+n) of the n-by-n triangle in packed
+    storage AP to W if unpack, else W back to AP. Only entries within the
+    uplo triangle are copied; others in W are neither read nor written.
+    In parallel over columns.
+*******************************************************************************/
+template< typename T >
+void magma_packed_host_copy(
+    bool unpack, magma_uplo_t uplo, magma_int_t nA, T* AP,
+    magma_int_t i0, magma_int_t j0, magma_int_t m, magma_int_t n,
+    T* W, magma_int_t ldw )
+{
+    #pragma omp parallel for schedule(dynamic, 16) if ( m*n > magma_symmetric_nb*magma_symmetric_nb )
+    for (magma_int_t j = 0; j < n; ++j) {
+        magma_int_t jA = j0 + j;
+        magma_int_t i1 = (uplo == MagmaLower ? max( i0, jA )     : i0);
+        magma_int_t i2 = (uplo == MagmaLower ? i0 + m : min( i0 + m, jA + 1 ));
+        if (i1 >= i2)
+            continue;
+        T* ap = AP + packed_host_offset( uplo, nA, jA ) + i1;
+        T* w  = W  + (i1 - i0) + j*ldw;
+        if (unpack)
+            memcpy( w,  ap, (i2 - i1)*sizeof(T) );
+        else
+            memcpy( ap, w,  (i2 - i1)*sizeof(T) );
+    }
+}
+
+#endif // MAGMA_SYMMETRIC_HOST_HPP
@@ -0,0 +1,385 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#include "task_scheduler.hpp"
+
+// If err, prints error and throws exception.
+static void check( int err )
+{
+    if ( err != 0 ) {
+        fprintf( stderr, "Error: %s (%d)\n", strerror(err), err );
+        throw std::exception();
+    }
+}
+
+
+/***************************************************************************//**
+    Task node in \ref magma_task_scheduler.
+    @ingroup magma_thread
+*******************************************************************************/
+class magma_task_node
+{
+public:
+    magma_task_node( const std::function< void() >& func ):
+        func ( func  ),
+        succ (),
+        ndeps( 1     ),  // held by insert until all dependencies are added
+        done ( false )
+    {}
+
+    std::function< void() >        func;   ///<  task to execute
+    std::vector< magma_task_node* > succ;   ///<  tasks that depend on this one
+    magma_int_t                    ndeps;  ///<  number of unfinished predecessors
+    bool                           done;   ///<  set when func has finished
+};
+
+
+/***************************************************************************//**
+    @class magma_task_scheduler
+
+    Purpose
+    -------
+    Implements a dynamic, dependency-driven task scheduler with work stealing,
+    for tile algorithms such as magma_zpotrf_tile.
+
+    The main thread inserts tasks in sequential order, along with the data
+    (e.g., tiles) each task reads or writes. The scheduler infers the
+    dependencies from these accesses, the same as a sequential execution:
+    a task runs after all previously inserted tasks that write data it
+    accesses, and after all previously inserted tasks that read data it
+    writes. Tasks whose dependencies are satisfied are executed by worker
+    threads as soon as possible, so, e.g., the next panel of a factorization
+    starts while the trailing update of the previous panel is in progress.
+
+    Each worker has its own queue of ready tasks. When a task finishes, tasks
+    that become ready are pushed on the queue of the thread that executed it,
+    which pops them in LIFO order to reuse data that is in its cache.
+    An idle worker steals the oldest task from another worker's queue.
+
+    The main thread can sync, waiting for all tasks to finish, and then insert
+    more tasks. When finished, the main thread calls quit or simply destructs
+    the scheduler, which will exit all worker threads.
+
+    Example
+    -------
+    @code
+    magma_task_scheduler dag;
+    dag.launch( nthread );
+    for( int k=0; k < nt; ++k ) {
+        dag.insert( { magma_task_write( A(k,k) ) },
+                    [=] { potrf( A(k,k) ); } );
+        for( int i=k+1; i < nt; ++i ) {
+            dag.insert( { magma_task_read( A(k,k) ), magma_task_write( A(i,k) ) },
+                        [=] { trsm( A(k,k), A(i,k) ); } );
+        }
+        // ...
+    }
+    dag.sync();
+    @endcode
+
+    Since tasks run asynchronously, the callable must capture its arguments
+    by value.
+
+    @see magma_thread_queue, which tracks no dependencies.
+
+    @ingroup magma_thread
+*******************************************************************************/
+
+
+/***************************************************************************//**
+    Thread's main routine, executed by pthread_create.
+    Executes ready tasks until a NULL task is returned.
+    @param[in,out] arg    worker of magma_task_scheduler.
+*******************************************************************************/
+extern "C"
+void* magma_task_scheduler_main( void* arg )
+{
+    magma_task_scheduler* dag = ((magma_task_scheduler::worker*) arg)->dag;
+    magma_int_t          tid = ((magma_task_scheduler::worker*) arg)->tid;
+    magma_task_node* node;
+
+    while( true ) {
+        node = dag->pop_task( tid );
+        if ( node == NULL ) {
+            break;
+        }
+
+        node->func();
+        dag->task_done( tid, node );
+    }
+
+    return NULL;  // implicitly does pthread_exit
+}
+
+
+/***************************************************************************//**
+    Creates scheduler with NO threads. Use launch() to create threads.
+*******************************************************************************/
+magma_task_scheduler::magma_task_scheduler():
+    workers  ( NULL  ),
+    threads  ( NULL  ),
+    nthread  ( 0     ),
+    next     ( 0     ),
+    state    (),
+    nodes    (),
+    quit_flag( false ),
+    nready   ( 0     ),
+    ntask    ( 0     )
+{
+    check( pthread_mutex_init( &graph_mutex, NULL ));
+    check( pthread_mutex_init( &mutex,       NULL ));
+    check( pthread_cond_init(  &cond,        NULL ));
+    check( pthread_cond_init(  &cond_ntask,  NULL ));
+}
+
+
+/***************************************************************************//**
+    Calls quit(), then deallocates data.
+*******************************************************************************/
+magma_task_scheduler::~magma_task_scheduler()
+{
+    quit();
+    check( pthread_mutex_destroy( &graph_mutex ));
+    check( pthread_mutex_destroy( &mutex ));
+    check( pthread_cond_destroy( &cond ));
+    check( pthread_cond_destroy( &cond_ntask ));
+}
+
+
+/***************************************************************************//**
+    Creates threads.
+    @param[in] in_nthread    Number of threads to launch.
+*******************************************************************************/
+void magma_task_scheduler::launch( magma_int_t in_nthread )
+{
+    assert( threads == NULL );  // else launch was called previously
+    nthread = in_nthread;
+    if ( nthread < 1 ) {
+        nthread = 1;
+    }
+    workers = new worker[ nthread ];
+    for( magma_int_t i=0; i < nthread; ++i ) {
+        workers[i].dag = this;
+        workers[i].tid = i;
+        check( pthread_mutex_init( &workers[i].mutex, NULL ));
+    }
+    threads = new pthread_t[ nthread ];
+    for( magma_int_t i=0; i < nthread; ++i ) {
+        check( pthread_create( &threads[i], NULL, magma_task_scheduler_main, &workers[i] ));
+    }
+}
+
+
+/***************************************************************************//**
+    Inserts task. It executes after all previously inserted tasks that it
+    depends on, as determined by data accesses, have finished.
+
+    @param[in] access   Data that func reads or writes. Data is identified by
+                        its address; for tiles, use the address of the tile.
+                        Writing data also implies reading it.
+    @param[in] func     Callable with signature void(), executed by a worker.
+                        It must capture its arguments by value.
+*******************************************************************************/
+void magma_task_scheduler::insert(
+    const std::vector< magma_task_access >& access,
+    const std::function< void() >& func )
+{
+    assert( threads != NULL );  // else launch was not called
+    magma_task_node* node = new magma_task_node( func );
+
+    check( pthread_mutex_lock( &mutex ));
+    ntask += 1;
+    check( pthread_mutex_unlock( &mutex ));
+
+    // add edges from unfinished predecessors
+    check( pthread_mutex_lock( &graph_mutex ));
+    nodes.push_back( node );
+    for( size_t a=0; a < access.size(); ++a ) {
+        data_state& s = state[ access[a].data ];
+        std::vector< magma_task_node* > pred;
+        if ( s.writer != NULL ) {
+            pred.push_back( s.writer );
+        }
+        if ( access[a].write ) {
+            // write after read
+            pred.insert( pred.end(), s.readers.begin(), s.readers.end() );
+            s.writer = node;
+            s.readers.clear();
+        }
+        else {
+            s.readers.push_back( node );
+        }
+        for( size_t p=0; p < pred.size(); ++p ) {
+            if ( pred[p] != node && ! pred[p]->done ) {
+                pred[p]->succ.push_back( node );
+                node->ndeps += 1;
+            }
+        }
+    }
+    node->ndeps -= 1;
+    bool ready = (node->ndeps == 0);
+    check( pthread_mutex_unlock( &graph_mutex ));
+
+    if ( ready ) {
+        push_ready( next, node );
+        next = (next + 1) % nthread;
+    }
+}
+
+
+/***************************************************************************//**
+    Add ready task to worker's queue.
+    Signals threads that are waiting in pop_task().
+    @param[in] tid      Index of worker.
+    @param[in] node     Task to add.
+*******************************************************************************/
+void magma_task_scheduler::push_ready( magma_int_t tid, magma_task_node* node )
+{
+    check( pthread_mutex_lock( &workers[tid].mutex ));
+    workers[tid].ready.push_back( node );
+    check( pthread_mutex_unlock( &workers[tid].mutex ));
+
+    check( pthread_mutex_lock( &mutex ));
+    nready += 1;
+    check( pthread_cond_signal( &cond ));
+    check( pthread_mutex_unlock( &mutex ));
+}
+
+
+/***************************************************************************//**
+    Get next ready task: the newest one in this worker's queue, or else the
+    oldest one stolen from another worker's queue.
+    @param[in] tid      Index of worker.
+    @return next task, blocking until a task is ready if necesary.
+    @return NULL if no task is ready *and* quit() has been called.
+*******************************************************************************/
+magma_task_node* magma_task_scheduler::pop_task( magma_int_t tid )
+{
+    // reserve one of the ready tasks
+    check( pthread_mutex_lock( &mutex ));
+    while( nready == 0 && ! quit_flag ) {
+        check( pthread_cond_wait( &cond, &mutex ));
+    }
+    if ( nready == 0 ) {
+        check( pthread_mutex_unlock( &mutex ));
+        return NULL;
+    }
+    nready -= 1;
+    check( pthread_mutex_unlock( &mutex ));
+
+    // find it; since it is reserved, some queue has it
+    magma_task_node* node = NULL;
+    while( node == NULL ) {
+        for( magma_int_t i=0; i < nthread && node == NULL; ++i ) {
+            worker& w = workers[ (tid + i) % nthread ];
+            check( pthread_mutex_lock( &w.mutex ));
+            if ( ! w.ready.empty() ) {
+                if ( i == 0 ) {
+                    node = w.ready.back();
+                    w.ready.pop_back();
+                }
+                else {
+                    node = w.ready.front();
+                    w.ready.pop_front();
+                }
+            }
+            check( pthread_mutex_unlock( &w.mutex ));
+        }
+    }
+    return node;
+}
+
+
+/***************************************************************************//**
+    Marks task as finished, releasing tasks that depend on it to this worker,
+    and decrements number of unfinished tasks.
+    Signals threads that are waiting in sync().
+    @param[in] tid      Index of worker that executed the task.
+    @param[in] node     Finished task.
+*******************************************************************************/
+void magma_task_scheduler::task_done( magma_int_t tid, magma_task_node* node )
+{
+    std::vector< magma_task_node* > ready;
+    check( pthread_mutex_lock( &graph_mutex ));
+    node->done = true;
+    for( size_t s=0; s < node->succ.size(); ++s ) {
+        node->succ[s]->ndeps -= 1;
+        if ( node->succ[s]->ndeps == 0 ) {
+            ready.push_back( node->succ[s] );
+        }
+    }
+    node->succ.clear();
+    check( pthread_mutex_unlock( &graph_mutex ));
+
+    // push in reverse, so the first successor is popped first
+    for( size_t r = ready.size(); r > 0; --r ) {
+        push_ready( tid, ready[r-1] );
+    }
+
+    check( pthread_mutex_lock( &mutex ));
+    ntask -= 1;
+    check( pthread_cond_broadcast( &cond_ntask ));
+    check( pthread_mutex_unlock( &mutex ));
+}
+
+
+/***************************************************************************//**
+    Block until all inserted tasks have finished.
+    Threads continue to be alive; more tasks can be inserted after sync.
+*******************************************************************************/
+void magma_task_scheduler::sync()
+{
+    check( pthread_mutex_lock( &mutex ));
+    while( ntask > 0 ) {
+        check( pthread_cond_wait( &cond_ntask, &mutex ));
+    }
+    check( pthread_mutex_unlock( &mutex ));
+
+    // all tasks are done; reset dependency state
+    check( pthread_mutex_lock( &graph_mutex ));
+    for( size_t i=0; i < nodes.size(); ++i ) {
+        delete nodes[i];
+    }
+    nodes.clear();
+    state.clear();
+    check( pthread_mutex_unlock( &graph_mutex ));
+}
+
+
+/***************************************************************************//**
+    Waits for all tasks to finish, then sets quit_flag, so pop_task() will
+    return NULL, telling threads to exit.
+    Waits for all threads to exit (i.e., joins them).
+    It is safe to call quit multiple times -- the first time all the threads are
+    joined; subsequent times it does nothing.
+    (Destructor also calls quit, but you may prefer to call it explicitly.)
+*******************************************************************************/
+void magma_task_scheduler::quit()
+{
+    if ( threads == NULL ) {
+        return;  // not launched, or quit previously called
+    }
+    sync();
+
+    check( pthread_mutex_lock( &mutex ));
+    quit_flag = true;
+    check( pthread_cond_broadcast( &cond ));
+    check( pthread_mutex_unlock( &mutex ));
+
+    for( magma_int_t i=0; i < nthread; ++i ) {
+        check( pthread_join( threads[i], NULL ));
+    }
+    delete[] threads;
+    threads = NULL;
+
+    for( magma_int_t i=0; i < nthread; ++i ) {
+        check( pthread_mutex_destroy( &workers[i].mutex ));
+    }
+    delete[] workers;
+    workers = NULL;
+}
@@ -0,0 +1,102 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_TASK_SCHEDULER_HPP
+#define MAGMA_TASK_SCHEDULER_HPP
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "magma_internal.h"
+
+
+/******************************************************************************/
+extern "C"
+void* magma_task_scheduler_main( void* arg );
+
+class magma_task_node;
+
+
+/***************************************************************************//**
+    Data access of a task in \ref magma_task_scheduler.
+    Use magma_task_read() and magma_task_write() to create.
+    @ingroup magma_thread
+*******************************************************************************/
+struct magma_task_access
+{
+    const void* data;   ///<  address identifying the data, e.g., a tile
+    bool        write;  ///<  true if the task writes (or reads and writes) it
+};
+
+/// @return read access of data (e.g., tile) at ptr.
+inline magma_task_access magma_task_read( const void* ptr )
+{
+    magma_task_access access = { ptr, false };
+    return access;
+}
+
+/// @return write (or read-write) access of data (e.g., tile) at ptr.
+inline magma_task_access magma_task_write( const void* ptr )
+{
+    magma_task_access access = { ptr, true };
+    return access;
+}
+
+
+/******************************************************************************/
+class magma_task_scheduler
+{
+public:
+    magma_task_scheduler();
+    ~magma_task_scheduler();
+
+    void launch( magma_int_t in_nthread );
+    void insert( const std::vector< magma_task_access >& access,
+                 const std::function< void() >& func );
+    void sync();
+    void quit();
+
+protected:
+    friend void* magma_task_scheduler_main( void* arg );
+    magma_task_node* pop_task( magma_int_t tid );
+    void push_ready( magma_int_t tid, magma_task_node* node );
+    void task_done( magma_int_t tid, magma_task_node* node );
+
+private:
+    // per-thread ready queue; owner pops from back, thieves steal from front
+    struct worker {
+        magma_task_scheduler*          dag;
+        magma_int_t                   tid;
+        std::deque< magma_task_node* > ready;
+        pthread_mutex_t               mutex;
+    };
+
+    // last writer and readers since then, for dependency tracking
+    struct data_state {
+        magma_task_node*                writer;
+        std::vector< magma_task_node* > readers;
+    };
+
+    worker*         workers;      ///<  array of nthread workers
+    pthread_t*      threads;      ///<  array of threads
+    magma_int_t     nthread;      ///<  number of threads
+    magma_int_t     next;         ///<  round-robin worker for tasks ready at insert
+    std::map< const void*, data_state > state;  ///<  dependency state of each datum
+    std::vector< magma_task_node* > nodes;       ///<  tasks inserted since last sync
+    pthread_mutex_t graph_mutex;  ///<  mutex lock for dependency graph
+    bool            quit_flag;    ///<  quit() sets this to true; after this, pop returns NULL
+    magma_int_t     nready;       ///<  number of tasks in ready queues
+    magma_int_t     ntask;        ///<  number of unfinished tasks
+    pthread_mutex_t mutex;        ///<  mutex lock for nready, ntask, quit
+    pthread_cond_t  cond;         ///<  condition variable for changes to nready and quit
+    pthread_cond_t  cond_ntask;   ///<  condition variable for changes to ntask (see sync, task_done)
+};
+
+#endif        //  #ifndef MAGMA_TASK_SCHEDULER_HPP
@@ -0,0 +1,423 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_TRANSPOSE_HOST_HPP
+#define MAGMA_TRANSPOSE_HOST_HPP
+
+#include <stdint.h>
+#include <vector>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host transpose engine, used by magmablas_*transpose* with the host
+    backend and by magma_*transpose*_cpu.
+
+    Out-of-place, the matrix is split into chunks that are distributed over
+    the OpenMP threads; each chunk is transposed by cache-oblivious recursion,
+    halving its longer side until a leaf fits in L1 cache together with its
+    transpose. Leaves are done in BS-by-BS blocks by a register-transpose
+    kernel: with AVX, 4x4 doubles (also used for single-complex, as 64-bit
+    elements) and 8x8 floats; otherwise, and for double-complex, a scalar
+    block that the compiler keeps in registers.
+
+    In-place, square matrices swap pairs of tiles across the diagonal through
+    an L1 buffer. Non-square matrices (with lda = m) follow the cycles of
+    the permutation k -> k*n mod (m*n - 1), moving each element once;
+    cycles are found first, then moved in parallel.
+*******************************************************************************/
+
+/// number of rows and columns in a chunk distributed to a thread
+const magma_int_t magma_transpose_nb_chunk = 256;
+
+/// largest leaf of the recursion, in bytes; a leaf and its transpose fit in L1
+const magma_int_t magma_transpose_leaf_bytes = 8192;
+
+/// tile size for in-place square transposes
+const magma_int_t magma_transpose_nb_inplace = 32;
+
+
+/******************************************************************************/
+// Element operation and block size per type; conj is the identity for reals.
+template< typename T >
+struct transpose_host_traits
+{
+    static const int bs = 4;
+    static T conj( T a ) { return a; }
+};
+
+template<>
+struct transpose_host_traits< float >
+{
+    static const int bs = 8;
+    static float conj( float a ) { return a; }
+};
+
+template<>
+struct transpose_host_traits< magmaFloatComplex >
+{
+    static const int bs = 4;
+    static magmaFloatComplex conj( magmaFloatComplex a ) { return MAGMA_C_CONJ( a ); }
+};
+
+template<>
+struct transpose_host_traits< magmaDoubleComplex >
+{
+    static const int bs = 4;
+    static magmaDoubleComplex conj( magmaDoubleComplex a ) { return MAGMA_Z_CONJ( a ); }
+};
+
+
+/******************************************************************************/
+// AT(0:n-1, 0:m-1) = op( A(0:m-1, 0:n-1) )^T for a block at the edge,
+// where op is conj if Conj, else the identity.
+template< typename T, bool Conj >
+static inline void transpose_host_edge(
+    magma_int_t m, magma_int_t n,
+    const T* A, magma_int_t lda, T* AT, magma_int_t ldat )
+{
+    for (magma_int_t j = 0; j < n; ++j) {
+        for (magma_int_t i = 0; i < m; ++i) {
+            T a = A[ i + j*lda ];
+            AT[ j + i*ldat ] = (Conj ? transpose_host_traits< T >::conj( a ) : a);
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Register-transpose kernel: transposes a full BS-by-BS block.
+    The generic kernel loads the block into an array the compiler keeps
+    in registers for small BS, then stores it transposed.
+*******************************************************************************/
+template< typename T, bool Conj >
+struct transpose_host_kernel
+{
+    static const int bs = transpose_host_traits< T >::bs;
+
+    static void run( const T* A, magma_int_t lda, T* AT, magma_int_t ldat )
+    {
+        T r[ bs ][ bs ];
+        for (int j = 0; j < bs; ++j)
+            for (int i = 0; i < bs; ++i)
+                r[i][j] = A[ i + j*lda ];
+        for (int i = 0; i < bs; ++i)
+            for (int j = 0; j < bs; ++j)
+                AT[ j + i*ldat ] = (Conj ? transpose_host_traits< T >::conj( r[i][j] ) : r[i][j]);
+    }
+};
+
+#if defined(__AVX__)
+
+/******************************************************************************/
+// 4x4 transpose of 64-bit elements; for single-complex, Conj flips the
+// sign of the imaginary part, the upper 32 bits of each element.
+template< bool Conj >
+static inline void transpose_host_avx_4x4(
+    const double* A, magma_int_t lda, double* AT, magma_int_t ldat )
+{
+    __m256d c0 = _mm256_loadu_pd( A );
+    __m256d c1 = _mm256_loadu_pd( A +   lda );
+    __m256d c2 = _mm256_loadu_pd( A + 2*lda );
+    __m256d c3 = _mm256_loadu_pd( A + 3*lda );
+
+    __m256d t0 = _mm256_unpacklo_pd( c0, c1 );
+    __m256d t1 = _mm256_unpackhi_pd( c0, c1 );
+    __m256d t2 = _mm256_unpacklo_pd( c2, c3 );
+    __m256d t3 = _mm256_unpackhi_pd( c2, c3 );
+
+    __m256d r0 = _mm256_permute2f128_pd( t0, t2, 0x20 );
+    __m256d r1 = _mm256_permute2f128_pd( t1, t3, 0x20 );
+    __m256d r2 = _mm256_permute2f128_pd( t0, t2, 0x31 );
+    __m256d r3 = _mm256_permute2f128_pd( t1, t3, 0x31 );
+
+    if (Conj) {
+        const __m256d sign = _mm256_castsi256_pd( _mm256_set1_epi64x( INT64_MIN ));
+        r0 = _mm256_xor_pd( r0, sign );
+        r1 = _mm256_xor_pd( r1, sign );
+        r2 = _mm256_xor_pd( r2, sign );
+        r3 = _mm256_xor_pd( r3, sign );
+    }
+    _mm256_storeu_pd( AT,          r0 );
+    _mm256_storeu_pd( AT +   ldat, r1 );
+    _mm256_storeu_pd( AT + 2*ldat, r2 );
+    _mm256_storeu_pd( AT + 3*ldat, r3 );
+}
+
+template< bool Conj >
+struct transpose_host_kernel< double, Conj >
+{
+    static const int bs = 4;
+
+    static void run( const double* A, magma_int_t lda, double* AT, magma_int_t ldat )
+    {
+        transpose_host_avx_4x4< false >( A, lda, AT, ldat );
+    }
+};
+
+template< bool Conj >
+struct transpose_host_kernel< magmaFloatComplex, Conj >
+{
+    static const int bs = 4;
+
+    static void run( const magmaFloatComplex* A, magma_int_t lda,
+                     magmaFloatComplex* AT, magma_int_t ldat )
+    {
+        transpose_host_avx_4x4< Conj >( (const double*) A, lda, (double*) AT, ldat );
+    }
+};
+
+template< bool Conj >
+struct transpose_host_kernel< float, Conj >
+{
+    static const int bs = 8;
+
+    static void run( const float* A, magma_int_t lda, float* AT, magma_int_t ldat )
+    {
+        __m256 r0 = _mm256_loadu_ps( A );
+        __m256 r1 = _mm256_loadu_ps( A +   lda );
+        __m256 r2 = _mm256_loadu_ps( A + 2*lda );
+        __m256 r3 = _mm256_loadu_ps( A + 3*lda );
+        __m256 r4 = _mm256_loadu_ps( A + 4*lda );
+        __m256 r5 = _mm256_loadu_ps( A + 5*lda );
+        __m256 r6 = _mm256_loadu_ps( A + 6*lda );
+        __m256 r7 = _mm256_loadu_ps( A + 7*lda );
+
+        __m256 t0 = _mm256_unpacklo_ps( r0, r1 );
+        __m256 t1 = _mm256_unpackhi_ps( r0, r1 );
+        __m256 t2 = _mm256_unpacklo_ps( r2, r3 );
+        __m256 t3 = _mm256_unpackhi_ps( r2, r3 );
+        __m256 t4 = _mm256_unpacklo_ps( r4, r5 );
+        __m256 t5 = _mm256_unpackhi_ps( r4, r5 );
+        __m256 t6 = _mm256_unpacklo_ps( r6, r7 );
+        __m256 t7 = _mm256_unpackhi_ps( r6, r7 );
+
+        __m256 u0 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE(1,0,1,0) );
+        __m256 u1 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE(3,2,3,2) );
+        __m256 u2 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE(1,0,1,0) );
+        __m256 u3 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE(3,2,3,2) );
+        __m256 u4 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE(1,0,1,0) );
+        __m256 u5 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE(3,2,3,2) );
+        __m256 u6 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE(1,0,1,0) );
+        __m256 u7 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE(3,2,3,2) );
+
+        _mm256_storeu_ps( AT,          _mm256_permute2f128_ps( u0, u4, 0x20 ));
+        _mm256_storeu_ps( AT +   ldat, _mm256_permute2f128_ps( u1, u5, 0x20 ));
+        _mm256_storeu_ps( AT + 2*ldat, _mm256_permute2f128_ps( u2, u6, 0x20 ));
+        _mm256_storeu_ps( AT + 3*ldat, _mm256_permute2f128_ps( u3, u7, 0x20 ));
+        _mm256_storeu_ps( AT + 4*ldat, _mm256_permute2f128_ps( u0, u4, 0x31 ));
+        _mm256_storeu_ps( AT + 5*ldat, _mm256_permute2f128_ps( u1, u5, 0x31 ));
+        _mm256_storeu_ps( AT + 6*ldat, _mm256_permute2f128_ps( u2, u6, 0x31 ));
+        _mm256_storeu_ps( AT + 7*ldat, _mm256_permute2f128_ps( u3, u7, 0x31 ));
+    }
+};
+
+#endif // __AVX__
+
+
+/******************************************************************************/
+// Transposes a leaf: full blocks by the kernel, the remainder by the edge code.
+template< typename T, bool Conj >
+static void transpose_host_leaf(
+    magma_int_t m, magma_int_t n,
+    const T* A, magma_int_t lda, T* AT, magma_int_t ldat )
+{
+    typedef transpose_host_kernel< T, Conj > kernel;
+    const int bs = kernel::bs;
+    magma_int_t m1 = (m / bs) * bs;
+    magma_int_t n1 = (n / bs) * bs;
+    for (magma_int_t j = 0; j < n1; j += bs) {
+        for (magma_int_t i = 0; i < m1; i += bs) {
+            kernel::run( A + i + j*lda, lda, AT + j + i*ldat, ldat );
+        }
+        if (m1 < m) {
+            transpose_host_edge< T, Conj >( m - m1, bs, A + m1 + j*lda, lda, AT + j + m1*ldat, ldat );
+        }
+    }
+    if (n1 < n) {
+        transpose_host_edge< T, Conj >( m, n - n1, A + n1*lda, lda, AT + n1, ldat );
+    }
+}
+
+
+/******************************************************************************/
+// Cache-oblivious recursion: halves the longer side, keeping splits on
+// multiples of the kernel's block size, until the leaf fits in L1.
+template< typename T, bool Conj >
+static void transpose_host_rec(
+    magma_int_t m, magma_int_t n,
+    const T* A, magma_int_t lda, T* AT, magma_int_t ldat )
+{
+    const int bs = transpose_host_kernel< T, Conj >::bs;
+    if (m*n*magma_int_t(sizeof(T)) <= magma_transpose_leaf_bytes
+        || (m <= bs && n <= bs))
+    {
+        transpose_host_leaf< T, Conj >( m, n, A, lda, AT, ldat );
+    }
+    else if (m >= n) {
+        magma_int_t m1 = magma_roundup( m/2, bs );
+        transpose_host_rec< T, Conj >( m1,   n, A,      lda, AT,           ldat );
+        transpose_host_rec< T, Conj >( m-m1, n, A + m1, lda, AT + m1*ldat, ldat );
+    }
+    else {
+        magma_int_t n1 = magma_roundup( n/2, bs );
+        transpose_host_rec< T, Conj >( m, n1,   A,           lda, AT,      ldat );
+        transpose_host_rec< T, Conj >( m, n-n1, A + n1*lda,  lda, AT + n1, ldat );
+    }
+}
+
+
+/***************************************************************************//**
+    Out-of-place transpose, AT = op( A )^T, where A is m-by-n and
+    op is conj if conjugate, else the identity. In parallel over chunks.
+*******************************************************************************/
+template< typename T, bool Conj >
+void magma_transpose_host(
+    magma_int_t m, magma_int_t n,
+    const T* A, magma_int_t lda, T* AT, magma_int_t ldat )
+{
+    const magma_int_t nb = magma_transpose_nb_chunk;
+    magma_int_t mt = magma_ceildiv( m, nb );
+    magma_int_t nt = magma_ceildiv( n, nb );
+    #pragma omp parallel for collapse(2) schedule(static) if ( mt*nt > 1 )
+    for (magma_int_t jt = 0; jt < nt; ++jt) {
+        for (magma_int_t it = 0; it < mt; ++it) {
+            magma_int_t i0 = it*nb, j0 = jt*nb;
+            transpose_host_rec< T, Conj >(
+                min( nb, m - i0 ), min( nb, n - j0 ),
+                A + i0 + j0*lda, lda, AT + j0 + i0*ldat, ldat );
+        }
+    }
+}
+
+template< typename T >
+void magma_transpose_host(
+    bool conjugate, magma_int_t m, magma_int_t n,
+    const T* A, magma_int_t lda, T* AT, magma_int_t ldat )
+{
+    if (conjugate)
+        magma_transpose_host< T, true  >( m, n, A, lda, AT, ldat );
+    else
+        magma_transpose_host< T, false >( m, n, A, lda, AT, ldat );
+}
+
+
+/******************************************************************************/
+// In-place transpose of a square n-by-n matrix: tile pairs (i,j), (j,i)
+// are swapped through a buffer, diagonal tiles are transposed through it.
+template< typename T, bool Conj >
+static void magma_transpose_inplace_host_square(
+    magma_int_t n, T* A, magma_int_t lda )
+{
+    const magma_int_t nb = magma_transpose_nb_inplace;
+    magma_int_t nt = magma_ceildiv( n, nb );
+    #pragma omp parallel if ( nt > 2 )
+    {
+        T work[ nb*nb ];
+        #pragma omp for schedule(dynamic)
+        for (magma_int_t jt = 0; jt < nt; ++jt) {
+            magma_int_t j0 = jt*nb, jb = min( nb, n - j0 );
+            for (magma_int_t it = 0; it <= jt; ++it) {
+                magma_int_t i0 = it*nb, ib = min( nb, n - i0 );
+                T* Aij = A + i0 + j0*lda;
+                T* Aji = A + j0 + i0*lda;
+                // work = op( A(i,j) )^T, jb-by-ib
+                transpose_host_leaf< T, Conj >( ib, jb, Aij, lda, work, nb );
+                if (it != jt) {
+                    transpose_host_leaf< T, Conj >( jb, ib, Aji, lda, Aij, lda );
+                }
+                for (magma_int_t i = 0; i < ib; ++i)
+                    for (magma_int_t j = 0; j < jb; ++j)
+                        Aji[ j + i*lda ] = work[ j + i*nb ];
+            }
+        }
+    }
+}
+
+
+/******************************************************************************/
+// In-place transpose of an m-by-n matrix stored contiguously (lda = m),
+// giving n-by-m with ldat = n, by following the cycles of the permutation:
+// position p receives the element at p*m mod (m*n - 1).
+template< typename T, bool Conj >
+static void magma_transpose_inplace_host_cycles(
+    magma_int_t m, magma_int_t n, T* A )
+{
+    const int64_t mn1 = int64_t(m)*n - 1;
+    if (mn1 <= 0) {
+        if (Conj && mn1 == 0)
+            A[0] = transpose_host_traits< T >::conj( A[0] );
+        return;
+    }
+
+    // leaders of the cycles, visited by index only; with Conj, fixed points
+    // are kept as cycles of length 1 so they get conjugated
+    std::vector< int64_t > leaders;
+    std::vector< bool > visited( mn1 + 1, false );
+    for (int64_t k = 0; k <= mn1; ++k) {
+        if (visited[k])
+            continue;
+        int64_t p = k, len = 0;
+        do {
+            visited[p] = true;
+            p = (p == mn1 ? p : (p*m) % mn1);
+            ++len;
+        } while (p != k);
+        if (len > 1 || Conj)
+            leaders.push_back( k );
+    }
+
+    magma_int_t ncycles = leaders.size();
+    #pragma omp parallel for schedule(dynamic, 16) if ( ncycles > 64 )
+    for (magma_int_t c = 0; c < ncycles; ++c) {
+        int64_t k = leaders[c], p = k;
+        T tmp = A[k];
+        while (true) {
+            int64_t s = (p == mn1 ? p : (p*m) % mn1);
+            if (s == k)
+                break;
+            A[p] = (Conj ? transpose_host_traits< T >::conj( A[s] ) : A[s]);
+            p = s;
+        }
+        A[p] = (Conj ? transpose_host_traits< T >::conj( tmp ) : tmp);
+    }
+}
+
+
+/***************************************************************************//**
+    In-place transpose, A = op( A )^T, where A is m-by-n on entry and
+    n-by-m on exit. If m == n, any lda >= n; otherwise A must be
+    contiguous, lda = m on entry and n on exit.
+*******************************************************************************/
+template< typename T >
+void magma_transpose_inplace_host(
+    bool conjugate, magma_int_t m, magma_int_t n, T* A, magma_int_t lda )
+{
+    if (m == n) {
+        if (conjugate)
+            magma_transpose_inplace_host_square< T, true  >( n, A, lda );
+        else
+            magma_transpose_inplace_host_square< T, false >( n, A, lda );
+    }
+    else {
+        if (conjugate)
+            magma_transpose_inplace_host_cycles< T, true  >( m, n, A );
+        else
+            magma_transpose_inplace_host_cycles< T, false >( m, n, A );
+    }
+}
+
+#endif // MAGMA_TRANSPOSE_HOST_HPP
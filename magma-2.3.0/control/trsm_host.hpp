@@ -0,0 +1,434 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef MAGMA_TRSM_HOST_HPP
+#define MAGMA_TRSM_HOST_HPP
+
+#include <string.h>
+#include <vector>
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host triangular solve and inverse engine, used by magma_*trsm_cpu,
+    magma_*trtri_cpu, magma_*trtri_diag_cpu, and the host backend's
+    magmablas_*trsm, *trsm_outofplace, *trsm_work, and *trtri_diag.
+
+    As magmablas_ztrsm does on the device, the nb-by-nb diagonal blocks of
+    the triangle are inverted first, in parallel, into invA, in the same
+    layout as the device's d_dinvA: block k at invA + k*nb*nb, with leading
+    dimension nb, zero outside its triangle. The solve then recurses by
+    halves, split at multiples of nb; each level is a GEMM update of the
+    second half by the first, and each leaf is the GEMM X_k = inv(A_kk)*B_k,
+    so all the flops are GEMMs. alpha is applied by the first leaf and the
+    beta of the updates, without a separate pass over B.
+
+    The right-hand sides are split into slabs, one or more per thread,
+    each solved independently with sequential GEMMs. If there are too few
+    for more than one slab (e.g., one vector), the GEMM updates are split
+    over the threads instead.
+
+    invA depends only on the triangle, so callers that solve repeatedly
+    with the same factor compute it once (magma_*trtri_diag_cpu, or
+    flag = false in magmablas_*trsm_outofplace) and pass it to each solve.
+
+    The inverse (trtri) uses the same blocks: for lower A,
+        inv(A) = [ inv(A11)                         0        ]
+                 [ -inv(A22) * A21 * inv(A11)      inv(A22)  ],
+    where A21 is replaced by two solves with the original A22 and A11,
+    which need only their inverted diagonal blocks, before recursing on
+    A11 and A22, whose leaves are copies of those blocks.
+*******************************************************************************/
+
+/// order of the inverted diagonal blocks; the device's NB, so invA has
+/// the same layout as d_dinvA of magmablas_*trsm_outofplace
+const magma_int_t magma_trsm_nb = 128;
+
+/// minimum number of right-hand sides in a slab solved by one thread
+const magma_int_t magma_trsm_nrhs = 64;
+
+
+/******************************************************************************/
+// Constants and the host BLAS and LAPACK routines used, for each precision.
+template< typename T >
+struct trsm_host_traits;
+
+template<>
+struct trsm_host_traits< float >
+{
+    static float zero()    { return MAGMA_S_ZERO; }
+    static float one()     { return MAGMA_S_ONE; }
+    static float neg_one() { return MAGMA_S_NEG_ONE; }
+    static bool is_zero( float a ) { return a == 0; }
+
+    static void gemm(
+        magma_trans_t transA, magma_trans_t transB,
+        magma_int_t m, magma_int_t n, magma_int_t k,
+        float alpha, const float* A, magma_int_t lda,
+                     const float* B, magma_int_t ldb,
+        float beta,        float* C, magma_int_t ldc )
+    {
+        blasf77_sgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    }
+
+    static void trtri(
+        magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+        float* A, magma_int_t lda, magma_int_t* info )
+    {
+        lapackf77_strtri( lapack_uplo_const( uplo ), lapack_diag_const( diag ),
+                          &n, A, &lda, info );
+    }
+};
+
+template<>
+struct trsm_host_traits< double >
+{
+    static double zero()    { return MAGMA_D_ZERO; }
+    static double one()     { return MAGMA_D_ONE; }
+    static double neg_one() { return MAGMA_D_NEG_ONE; }
+    static bool is_zero( double a ) { return a == 0; }
+
+    static void gemm(
+        magma_trans_t transA, magma_trans_t transB,
+        magma_int_t m, magma_int_t n, magma_int_t k,
+        double alpha, const double* A, magma_int_t lda,
+                      const double* B, magma_int_t ldb,
+        double beta,        double* C, magma_int_t ldc )
+    {
+        blasf77_dgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    }
+
+    static void trtri(
+        magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+        double* A, magma_int_t lda, magma_int_t* info )
+    {
+        lapackf77_dtrtri( lapack_uplo_const( uplo ), lapack_diag_const( diag ),
+                          &n, A, &lda, info );
+    }
+};
+
+template<>
+struct trsm_host_traits< magmaFloatComplex >
+{
+    static magmaFloatComplex zero()    { return MAGMA_C_ZERO; }
+    static magmaFloatComplex one()     { return MAGMA_C_ONE; }
+    static magmaFloatComplex neg_one() { return MAGMA_C_NEG_ONE; }
+    static bool is_zero( magmaFloatComplex a ) { return MAGMA_C_EQUAL( a, MAGMA_C_ZERO ); }
+
+    static void gemm(
+        magma_trans_t transA, magma_trans_t transB,
+        magma_int_t m, magma_int_t n, magma_int_t k,
+        magmaFloatComplex alpha, const magmaFloatComplex* A, magma_int_t lda,
+                                 const magmaFloatComplex* B, magma_int_t ldb,
+        magmaFloatComplex beta,        magmaFloatComplex* C, magma_int_t ldc )
+    {
+        blasf77_cgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    }
+
+    static void trtri(
+        magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+        magmaFloatComplex* A, magma_int_t lda, magma_int_t* info )
+    {
+        lapackf77_ctrtri( lapack_uplo_const( uplo ), lapack_diag_const( diag ),
+                          &n, A, &lda, info );
+    }
+};
+
+template<>
+struct trsm_host_traits< magmaDoubleComplex >
+{
+    static magmaDoubleComplex zero()    { return MAGMA_Z_ZERO; }
+    static magmaDoubleComplex one()     { return MAGMA_Z_ONE; }
+    static magmaDoubleComplex neg_one() { return MAGMA_Z_NEG_ONE; }
+    static bool is_zero( magmaDoubleComplex a ) { return MAGMA_Z_EQUAL( a, MAGMA_Z_ZERO ); }
+
+    static void gemm(
+        magma_trans_t transA, magma_trans_t transB,
+        magma_int_t m, magma_int_t n, magma_int_t k,
+        magmaDoubleComplex alpha, const magmaDoubleComplex* A, magma_int_t lda,
+                                  const magmaDoubleComplex* B, magma_int_t ldb,
+        magmaDoubleComplex beta,        magmaDoubleComplex* C, magma_int_t ldc )
+    {
+        blasf77_zgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                       &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+    }
+
+    static void trtri(
+        magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+        magmaDoubleComplex* A, magma_int_t lda, magma_int_t* info )
+    {
+        lapackf77_ztrtri( lapack_uplo_const( uplo ), lapack_diag_const( diag ),
+                          &n, A, &lda, info );
+    }
+};
+
+
+/******************************************************************************/
+// Number of threads available to the engine.
+static inline magma_int_t trsm_host_nthreads()
+{
+    #ifdef _OPENMP
+    return omp_get_max_threads();
+    #else
+    return 1;
+    #endif
+}
+
+
+/******************************************************************************/
+// Inverts the nb-by-nb diagonal blocks of the order-n uplo triangle of A
+// into invA, of length magma_roundup( n, nb )*nb, zeroing the rest of each
+// block, as magmablas_ztrtri_diag does. The blocks are inverted in
+// parallel, each by the host LAPACK trtri. With diag = Unit, the inverses
+// get explicit unit diagonals, as they are used as general matrices.
+template< typename T >
+static void trsm_host_trtri_diag(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    const T* A, magma_int_t lda, T* invA )
+{
+    const magma_int_t nb = magma_trsm_nb;
+    magma_int_t nblocks = magma_ceildiv( n, nb );
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (magma_int_t k = 0; k < nblocks; ++k) {
+        magma_int_t jb = min( nb, n - k*nb );
+        const T* Akk = A + k*nb + k*nb*lda;
+        T* Ik = invA + k*nb*nb;
+        magma_int_t info;
+
+        memset( Ik, 0, nb*nb*sizeof(T) );
+        for (magma_int_t j = 0; j < jb; ++j) {
+            magma_int_t i1 = (uplo == MagmaLower ? j : 0);
+            magma_int_t i2 = (uplo == MagmaLower ? jb : j+1);
+            memcpy( Ik + i1 + j*nb, Akk + i1 + j*lda, (i2 - i1)*sizeof(T) );
+        }
+        // a singular block leaves Inf or NaN in invA, as on the device
+        trsm_host_traits< T >::trtri( uplo, diag, jb, Ik, nb, &info );
+        if (diag == MagmaUnit) {
+            for (magma_int_t j = 0; j < jb; ++j) {
+                Ik[ j + j*nb ] = trsm_host_traits< T >::one();
+            }
+        }
+    }
+}
+
+
+/******************************************************************************/
+// C = alpha*op( A )*op( B ) + beta*C, split over the threads along the
+// larger dimension of C if par, otherwise one host BLAS gemm.
+template< typename T >
+static void trsm_host_gemm(
+    bool par,
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    T alpha, const T* A, magma_int_t lda,
+             const T* B, magma_int_t ldb,
+    T beta,        T* C, magma_int_t ldc )
+{
+    magma_int_t nthreads = trsm_host_nthreads();
+    if (! par || nthreads == 1 || max( m, n ) < 2*magma_trsm_nrhs) {
+        trsm_host_traits< T >::gemm( transA, transB, m, n, k,
+                                     alpha, A, lda, B, ldb, beta, C, ldc );
+        return;
+    }
+    bool by_cols = (n >= m);
+    magma_int_t len   = (by_cols ? n : m);
+    magma_int_t chunk = magma_roundup( magma_ceildiv( len, nthreads ), 16 );
+    magma_int_t nchunks = magma_ceildiv( len, chunk );
+
+    #pragma omp parallel for schedule(static, 1)
+    for (magma_int_t c = 0; c < nchunks; ++c) {
+        magma_int_t i  = c*chunk;
+        magma_int_t ib = min( chunk, len - i );
+        if (by_cols) {
+            const T* Bi = (transB == MagmaNoTrans ? B + i*ldb : B + i);
+            trsm_host_traits< T >::gemm( transA, transB, m, ib, k,
+                                         alpha, A, lda, Bi, ldb, beta, C + i*ldc, ldc );
+        }
+        else {
+            const T* Ai = (transA == MagmaNoTrans ? A + i : A + i*lda);
+            trsm_host_traits< T >::gemm( transA, transB, ib, n, k,
+                                         alpha, Ai, lda, B, ldb, beta, C + i, ldc );
+        }
+    }
+}
+
+
+/******************************************************************************/
+// Solves op( A )*X = alpha*B (Left) or X*op( A ) = alpha*B (Right) in place
+// of B, for the order-m triangle A, lower after op if lower, with inverted
+// diagonal blocks invA. B is m-by-nrhs (Left) or nrhs-by-m (Right).
+// W is a workspace of nb*nrhs elements for the leaves.
+template< typename T >
+static void trsm_host_rec(
+    magma_side_t side, bool lower, magma_trans_t transA,
+    magma_int_t m, magma_int_t nrhs, T alpha,
+    const T* A, magma_int_t lda, const T* invA,
+    T* B, magma_int_t ldb, T* W, bool par )
+{
+    const magma_int_t nb = magma_trsm_nb;
+    const T c_one     = trsm_host_traits< T >::one();
+    const T c_neg_one = trsm_host_traits< T >::neg_one();
+    const T c_zero    = trsm_host_traits< T >::zero();
+
+    if (m <= nb) {
+        // X = alpha * op( inv(A) ) * B, or alpha * B * op( inv(A) ), via W
+        if (side == MagmaLeft) {
+            for (magma_int_t j = 0; j < nrhs; ++j) {
+                memcpy( W + j*m, B + j*ldb, m*sizeof(T) );
+            }
+            trsm_host_gemm( par, transA, MagmaNoTrans, m, nrhs, m,
+                            alpha, invA, nb, W, m, c_zero, B, ldb );
+        }
+        else {
+            for (magma_int_t j = 0; j < m; ++j) {
+                memcpy( W + j*nrhs, B + j*ldb, nrhs*sizeof(T) );
+            }
+            trsm_host_gemm( par, MagmaNoTrans, transA, nrhs, m, m,
+                            alpha, W, nrhs, invA, nb, c_zero, B, ldb );
+        }
+        return;
+    }
+
+    magma_int_t m1 = magma_roundup( m/2, nb );
+    magma_int_t m2 = m - m1;
+    const T* A22    = A + m1 + m1*lda;
+    const T* invA22 = invA + m1*nb;
+    // blocks (2,1) and (1,2) of op( A ), to be used with transA
+    const T* opA21 = (transA == MagmaNoTrans ? A + m1 : A + m1*lda);
+    const T* opA12 = (transA == MagmaNoTrans ? A + m1*lda : A + m1);
+    // second block of B: rows (Left) or columns (Right) m1:m
+    T* B2 = (side == MagmaLeft ? B + m1 : B + m1*ldb);
+
+    if (side == MagmaLeft && lower) {
+        trsm_host_rec( side, lower, transA, m1, nrhs, alpha, A, lda, invA, B, ldb, W, par );
+        trsm_host_gemm( par, transA, MagmaNoTrans, m2, nrhs, m1,
+                        c_neg_one, opA21, lda, B, ldb, alpha, B2, ldb );
+        trsm_host_rec( side, lower, transA, m2, nrhs, c_one, A22, lda, invA22, B2, ldb, W, par );
+    }
+    else if (side == MagmaLeft) {
+        trsm_host_rec( side, lower, transA, m2, nrhs, alpha, A22, lda, invA22, B2, ldb, W, par );
+        trsm_host_gemm( par, transA, MagmaNoTrans, m1, nrhs, m2,
+                        c_neg_one, opA12, lda, B2, ldb, alpha, B, ldb );
+        trsm_host_rec( side, lower, transA, m1, nrhs, c_one, A, lda, invA, B, ldb, W, par );
+    }
+    else if (lower) {
+        trsm_host_rec( side, lower, transA, m2, nrhs, alpha, A22, lda, invA22, B2, ldb, W, par );
+        trsm_host_gemm( par, MagmaNoTrans, transA, nrhs, m1, m2,
+                        c_neg_one, B2, ldb, opA21, lda, alpha, B, ldb );
+        trsm_host_rec( side, lower, transA, m1, nrhs, c_one, A, lda, invA, B, ldb, W, par );
+    }
+    else {
+        trsm_host_rec( side, lower, transA, m1, nrhs, alpha, A, lda, invA, B, ldb, W, par );
+        trsm_host_gemm( par, MagmaNoTrans, transA, nrhs, m2, m1,
+                        c_neg_one, B, ldb, opA12, lda, alpha, B2, ldb );
+        trsm_host_rec( side, lower, transA, m2, nrhs, c_one, A22, lda, invA22, B2, ldb, W, par );
+    }
+}
+
+
+/******************************************************************************/
+// Solves op( A )*X = alpha*B (Left) or X*op( A ) = alpha*B (Right) in place
+// of the m-by-n B, with invA from trsm_host_trtri_diag; arguments as for
+// BLAS trsm. The diagonal of A is not referenced, so diag is in invA.
+template< typename T >
+static void trsm_host(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA,
+    magma_int_t m, magma_int_t n, T alpha,
+    const T* A, magma_int_t lda, const T* invA,
+    T* B, magma_int_t ldb )
+{
+    const magma_int_t nb = magma_trsm_nb;
+    if (m == 0 || n == 0)
+        return;
+
+    if (trsm_host_traits< T >::is_zero( alpha )) {
+        for (magma_int_t j = 0; j < n; ++j) {
+            memset( B + j*ldb, 0, m*sizeof(T) );
+        }
+        return;
+    }
+
+    bool lower = ((uplo == MagmaLower) == (transA == MagmaNoTrans));
+    magma_int_t order = (side == MagmaLeft ? m : n);
+    magma_int_t nrhs  = (side == MagmaLeft ? n : m);
+    magma_int_t slab  = max( magma_trsm_nrhs, magma_ceildiv( nrhs, trsm_host_nthreads() ));
+    magma_int_t nslab = magma_ceildiv( nrhs, slab );
+
+    if (nslab == 1) {
+        std::vector< T > W( nb*nrhs );
+        trsm_host_rec( side, lower, transA, order, nrhs, alpha,
+                       A, lda, invA, B, ldb, &W[0], true );
+        return;
+    }
+
+    #pragma omp parallel
+    {
+        std::vector< T > W( nb*slab );
+        #pragma omp for schedule(dynamic, 1)
+        for (magma_int_t s = 0; s < nslab; ++s) {
+            magma_int_t ns = min( slab, nrhs - s*slab );
+            T* Bs = (side == MagmaLeft ? B + s*slab*ldb : B + s*slab);
+            trsm_host_rec( side, lower, transA, order, ns, alpha,
+                           A, lda, invA, Bs, ldb, &W[0], false );
+        }
+    }
+}
+
+
+/******************************************************************************/
+// Overwrites the order-n uplo triangle of A with its inverse, given invA
+// from trsm_host_trtri_diag. The diagonal is not checked for zeros.
+template< typename T >
+static void trtri_host_rec(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    T* A, magma_int_t lda, const T* invA )
+{
+    const magma_int_t nb = magma_trsm_nb;
+    const T c_one     = trsm_host_traits< T >::one();
+    const T c_neg_one = trsm_host_traits< T >::neg_one();
+
+    if (n <= nb) {
+        // with Unit, the diagonal of A is not referenced, so not written
+        magma_int_t strict = (diag == MagmaUnit);
+        for (magma_int_t j = 0; j < n; ++j) {
+            magma_int_t i1 = (uplo == MagmaLower ? j + strict : 0);
+            magma_int_t i2 = (uplo == MagmaLower ? n : j + 1 - strict);
+            memcpy( A + i1 + j*lda, invA + i1 + j*nb, (i2 - i1)*sizeof(T) );
+        }
+        return;
+    }
+
+    magma_int_t n1 = magma_roundup( n/2, nb );
+    magma_int_t n2 = n - n1;
+    T* A22 = A + n1 + n1*lda;
+    const T* invA22 = invA + n1*nb;
+    if (uplo == MagmaLower) {
+        // A21 = -inv(A22) * A21 * inv(A11)
+        T* A21 = A + n1;
+        trsm_host( MagmaLeft,  uplo, MagmaNoTrans, n2, n1, c_neg_one, A22, lda, invA22, A21, lda );
+        trsm_host( MagmaRight, uplo, MagmaNoTrans, n2, n1, c_one,     A,   lda, invA,   A21, lda );
+    }
+    else {
+        // A12 = -inv(A11) * A12 * inv(A22)
+        T* A12 = A + n1*lda;
+        trsm_host( MagmaLeft,  uplo, MagmaNoTrans, n1, n2, c_neg_one, A,   lda, invA,   A12, lda );
+        trsm_host( MagmaRight, uplo, MagmaNoTrans, n1, n2, c_one,     A22, lda, invA22, A12, lda );
+    }
+    trtri_host_rec( uplo, diag, n1, A,   lda, invA   );
+    trtri_host_rec( uplo, diag, n2, A22, lda, invA22 );
+}
+
+#endif // MAGMA_TRSM_HOST_HPP
@@ -0,0 +1,320 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions mixed zc -> ds
+*/
+#include "convert_host.hpp"  // includes magma_internal.h, after the STL headers
+
+#define PRECISION_z
+
+// reals per element
+#if defined(PRECISION_z) || defined(PRECISION_c)
+const magma_int_t lanes = 2;
+#else
+const magma_int_t lanes = 1;
+#endif
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZLAG2C_CPU converts a double-complex matrix, A,
+                     to a single-complex matrix, SA, in CPU memory,
+    as LAPACK's zlag2c does, but in parallel, vectorized, and reporting
+    which entry overflows; see control/convert_host.hpp.
+
+    RMAX is the overflow for the SINGLE PRECISION arithmetic.
+    Unlike zlag2c, all of A is converted even if some entry is out of range;
+    such entries are rounded, which gives +-Inf in SA except within
+    half an ulp of RMAX.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of lines of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    A       COMPLEX_16 array, dimension (LDA,N)
+            On entry, the M-by-N coefficient matrix A.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @param[out]
+    SA      COMPLEX array, dimension (LDSA,N)
+            On exit, if INFO=0, the M-by-N coefficient matrix SA.
+
+    @param[in]
+    ldsa    INTEGER
+            The leading dimension of the array SA.  LDSA >= max(1,M).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+      -     > 0:  A(i,j), with INFO = 1 + i + j*LDA (0-based i, j), is the
+                  first entry, in column-major order, greater than RMAX
+                  in magnitude (in real or imaginary part, if complex).
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magma_zlag2c_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaFloatComplex *SA,       magma_int_t ldsa,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( m < 0 )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,m) )
+        *info = -4;
+    else if ( ldsa < max(1,m) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    double rmax = (double) lapackf77_slamch("O");
+    magma_int_t k = magma_convert_host< double, float, true >(
+        MagmaFull, m, n, (const double*) A, lda, (float*) SA, ldsa, lanes, rmax );
+    *info = k + 1;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CLAG2Z_CPU converts a single-complex matrix, SA,
+                     to a double-complex matrix, A, in CPU memory,
+    as LAPACK's clag2z does, but in parallel and vectorized.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of lines of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    SA      COMPLEX array, dimension (LDSA,N)
+            On entry, the M-by-N coefficient matrix SA.
+
+    @param[in]
+    ldsa    INTEGER
+            The leading dimension of the array SA.  LDSA >= max(1,M).
+
+    @param[out]
+    A       COMPLEX_16 array, dimension (LDA,N)
+            On exit, the M-by-N coefficient matrix A.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magma_clag2z_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaFloatComplex *SA, magma_int_t ldsa,
+    magmaDoubleComplex *A,       magma_int_t lda,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( m < 0 )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( ldsa < max(1,m) )
+        *info = -4;
+    else if ( lda < max(1,m) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( m == 0 || n == 0 )
+        return;
+
+    magma_convert_host< float, double, false >(
+        MagmaFull, m, n, (const float*) SA, ldsa, (double*) A, lda, lanes, 0.f );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZLAT2C_CPU converts a double-complex matrix, A,
+                     to a single-complex matrix, SA, in CPU memory.
+    Only the triangle given by uplo, including the diagonal, is converted;
+    otherwise it is as magma_zlag2c_cpu.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+            Specifies the part of the matrix A to be converted.
+      -     = MagmaUpper:      Upper triangular part
+      -     = MagmaLower:      Lower triangular part
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    A       COMPLEX_16 array, dimension (LDA,N)
+            On entry, the N-by-N coefficient matrix A.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    SA      COMPLEX array, dimension (LDSA,N)
+            On exit, if INFO=0, the triangle of SA given by uplo.
+
+    @param[in]
+    ldsa    INTEGER
+            The leading dimension of the array SA.  LDSA >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+      -     > 0:  A(i,j), with INFO = 1 + i + j*LDA (0-based i, j), is the
+                  first entry of the triangle, in column-major order,
+                  greater than RMAX in magnitude.
+
+    @ingroup magma_lat2
+*******************************************************************************/
+extern "C" void
+magma_zlat2c_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaFloatComplex *SA,       magma_int_t ldsa,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -4;
+    else if ( ldsa < max(1,n) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( n == 0 )
+        return;
+
+    double rmax = (double) lapackf77_slamch("O");
+    magma_int_t k = magma_convert_host< double, float, true >(
+        uplo, n, n, (const double*) A, lda, (float*) SA, ldsa, lanes, rmax );
+    *info = k + 1;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CLAT2Z_CPU converts a single-complex matrix, SA,
+                     to a double-complex matrix, A, in CPU memory.
+    Only the triangle given by uplo, including the diagonal, is converted.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+            Specifies the part of the matrix SA to be converted.
+      -     = MagmaUpper:      Upper triangular part
+      -     = MagmaLower:      Lower triangular part
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix SA.  N >= 0.
+
+    @param[in]
+    SA      COMPLEX array, dimension (LDSA,N)
+            On entry, the N-by-N coefficient matrix SA.
+
+    @param[in]
+    ldsa    INTEGER
+            The leading dimension of the array SA.  LDSA >= max(1,N).
+
+    @param[out]
+    A       COMPLEX_16 array, dimension (LDA,N)
+            On exit, the triangle of A given by uplo.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_lat2
+*******************************************************************************/
+extern "C" void
+magma_clat2z_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *SA, magma_int_t ldsa,
+    magmaDoubleComplex *A,       magma_int_t lda,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( ldsa < max(1,n) )
+        *info = -4;
+    else if ( lda < max(1,n) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_convert_host< float, double, false >(
+        uplo, n, n, (const float*) SA, ldsa, (double*) A, lda, lanes, 0.f );
+}
@@ -0,0 +1,156 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "symmetric_host.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZSYMMETRIZE_CPU copies the lower triangle to the upper triangle, or
+    vice-versa, to make A, in CPU memory, a general representation of a
+    symmetric matrix. In Complex, it conjugates and sets the diagonal to be
+    Real, making A Hermitian. Off-diagonal tiles are transposed in parallel,
+    by cache-friendly kernels; see control/symmetric_host.hpp.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+            Specifies the part of the matrix A that is valid on input.
+      -     = MagmaUpper:      Upper triangular part
+      -     = MagmaLower:      Lower triangular part
+
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in,out]
+    A       COMPLEX_16 array, dimension (LDA,M)
+            The M-by-M matrix A.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @ingroup magma_symmetrize
+*******************************************************************************/
+extern "C" void
+magma_zsymmetrize_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaDoubleComplex *A, magma_int_t lda )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( lda < max(1,m) )
+        info = -4;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( m == 0 )
+        return;
+
+    magma_symmetrize_host( true, uplo, m, A, lda );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZSYMMETRIZE_TILES_CPU copies the lower triangle to the upper triangle,
+    or vice-versa, for ntile tiles of A, in CPU memory, as
+    magma_zsymmetrize_cpu does for each. Tile i is A(i*mstride, i*nstride);
+    the tiles are symmetrized in parallel.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+            Specifies the part of the matrix A that is valid on input.
+      -     = MagmaUpper:      Upper triangular part
+      -     = MagmaLower:      Lower triangular part
+
+    @param[in]
+    m       INTEGER
+            The number of rows of each tile.  M >= 0.
+
+    @param[in,out]
+    A       COMPLEX_16 array, dimension (LDA,N)
+            The matrix containing the tiles.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.
+            LDA >= max(1, M + MSTRIDE*(NTILE-1)).
+
+    @param[in]
+    ntile   INTEGER
+            Number of tiles, >= 0.
+
+    @param[in]
+    mstride INTEGER
+            Row offset from start of one tile to start of next tile. MSTRIDE >= 0.
+            Either MSTRIDE >= M or NSTRIDE >= M.
+
+    @param[in]
+    nstride INTEGER
+            Column offset from start of one tile to start of next tile. NSTRIDE >= 0.
+            Either MSTRIDE >= M or NSTRIDE >= M.
+
+    @ingroup magma_symmetrize
+*******************************************************************************/
+extern "C" void
+magma_zsymmetrize_tiles_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magma_int_t ntile, magma_int_t mstride, magma_int_t nstride )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( lda < max(1,m + mstride*(ntile-1)) )
+        info = -4;
+    else if ( ntile < 0 )
+        info = -5;
+    else if ( mstride < 0 )
+        info = -6;
+    else if ( nstride < 0 )
+        info = -7;
+    else if ( mstride < m && nstride < m )  // only one must be >= m.
+        info = -6;
+
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( m == 0 || ntile == 0 )
+        return;
+
+    // large tiles are parallel inside; small ones are spread over threads
+    if ( m > magma_symmetric_nb ) {
+        for (magma_int_t k = 0; k < ntile; ++k) {
+            magma_symmetrize_host( true, uplo, m, A + k*(mstride + nstride*lda), lda );
+        }
+    }
+    else {
+        #pragma omp parallel for schedule(static)
+        for (magma_int_t k = 0; k < ntile; ++k) {
+            magma_symmetrize_host( true, uplo, m, A + k*(mstride + nstride*lda), lda );
+        }
+    }
+}
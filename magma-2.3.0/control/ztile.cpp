@@ -0,0 +1,157 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "magma_internal.h"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZGE2TILE copies an M-by-N matrix A in column-major (LAPACK) layout to
+    the tile-major layout used by the tile algorithms, e.g., magma_zpotrf_tile.
+
+    In tile-major layout, the matrix is divided into MT-by-NT tiles of size
+    NB-by-NB, where MT = ceil(M/NB) and NT = ceil(N/NB). Each tile is stored
+    contiguously, in column-major order with leading dimension NB, and tiles
+    are stored in column-major order, so tile (i,j) starts at
+    T + (i + j*MT)*NB*NB. Tiles in the last block row or column are
+    partial; only their leading part is used.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size.  NB >= 1.
+
+    @param[in]
+    A       COMPLEX_16 array, dimension (LDA,N)
+            The M-by-N matrix A in column-major layout.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @param[out]
+    T       COMPLEX_16 array, dimension (MT*NT*NB*NB)
+            On exit, the matrix A in tile-major layout.
+
+    @ingroup magma_tile
+*******************************************************************************/
+extern "C" void
+magma_zge2tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *T )
+{
+    magma_int_t info = 0;
+    if (m < 0)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (nb < 1)
+        info = -3;
+    else if (lda < max(1,m))
+        info = -5;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    magma_int_t mt = magma_ceildiv( m, nb );
+    magma_int_t nt = magma_ceildiv( n, nb );
+
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t ij = 0; ij < mt*nt; ++ij) {
+        magma_int_t i  = ij % mt;
+        magma_int_t j  = ij / mt;
+        magma_int_t ib = min( nb, m - i*nb );
+        magma_int_t jb = min( nb, n - j*nb );
+        lapackf77_zlacpy( MagmaFullStr, &ib, &jb,
+                          A + i*nb + j*nb*lda, &lda, T + ij*nb*nb, &nb );
+    }
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZTILE2GE copies an M-by-N matrix from tile-major layout back to
+    column-major (LAPACK) layout. See magma_zge2tile for the tile-major
+    layout.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size.  NB >= 1.
+
+    @param[in]
+    T       COMPLEX_16 array, dimension (MT*NT*NB*NB)
+            The matrix A in tile-major layout.
+
+    @param[out]
+    A       COMPLEX_16 array, dimension (LDA,N)
+            On exit, the M-by-N matrix A in column-major layout.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @ingroup magma_tile
+*******************************************************************************/
+extern "C" void
+magma_ztile2ge(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const magmaDoubleComplex *T,
+    magmaDoubleComplex *A, magma_int_t lda )
+{
+    magma_int_t info = 0;
+    if (m < 0)
+        info = -1;
+    else if (n < 0)
+        info = -2;
+    else if (nb < 1)
+        info = -3;
+    else if (lda < max(1,m))
+        info = -6;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    magma_int_t mt = magma_ceildiv( m, nb );
+    magma_int_t nt = magma_ceildiv( n, nb );
+
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t ij = 0; ij < mt*nt; ++ij) {
+        magma_int_t i  = ij % mt;
+        magma_int_t j  = ij / mt;
+        magma_int_t ib = min( nb, m - i*nb );
+        magma_int_t jb = min( nb, n - j*nb );
+        lapackf77_zlacpy( MagmaFullStr, &ib, &jb,
+                          T + ij*nb*nb, &nb, A + i*nb + j*nb*lda, &lda );
+    }
+}
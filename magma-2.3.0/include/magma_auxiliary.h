@@ -64,6 +64,39 @@ void magma_indices_1D_bcyclic(
     magma_int_t j0, magma_int_t j1,
     magma_int_t* dj0, magma_int_t* dj1 );
 
+// 2D block-cyclic distribution
+magma_int_t magma_bcyclic_numroc(
+    magma_int_t n, magma_int_t nb, magma_int_t iproc, magma_int_t nprocs );
+
+void magma_bcyclic_grid(
+    magma_int_t nprocs, magma_int_t *p, magma_int_t *q );
+
+magma_int_t magma_bcyclic_init(
+    magma_bcyclic_t *desc,
+    magma_int_t m, magma_int_t n, magma_int_t mb, magma_int_t nb,
+    magma_int_t p, magma_int_t q );
+
+magma_int_t magma_bcyclic_owner(
+    const magma_bcyclic_t *desc, magma_int_t i, magma_int_t j );
+
+void magma_bcyclic_local_index(
+    const magma_bcyclic_t *desc, magma_int_t i, magma_int_t j,
+    magma_int_t *dev, magma_int_t *il, magma_int_t *jl );
+
+void magma_bcyclic_global_index(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t il, magma_int_t jl,
+    magma_int_t *i, magma_int_t *j );
+
+void magma_bcyclic_local_size(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t *mloc, magma_int_t *nloc );
+
+void magma_bcyclic_local_range(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magma_int_t *il, magma_int_t *jl, magma_int_t *mloc, magma_int_t *nloc );
+
 void magma_swp2pswp(
     magma_trans_t trans, magma_int_t n,
     magma_int_t *ipiv,
@@ -362,6 +395,38 @@ magmaFloatComplex    magma_csqrt( magmaFloatComplex  x );
 magmaDoubleComplex   magma_zsqrt( magmaDoubleComplex x );
 
 
+// =============================================================================
+// half precision and bfloat16 storage, in control/slag2h_cpu.cpp
+
+void
+magma_slag2h_cpu(
+    magma_int_t m, magma_int_t n,
+    const float *SA, magma_int_t ldsa,
+    magmaHalf   *HA, magma_int_t ldha,
+    magma_int_t *info );
+
+void
+magma_hlag2s_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaHalf *HA, magma_int_t ldha,
+    float           *SA, magma_int_t ldsa,
+    magma_int_t *info );
+
+void
+magma_slag2bf_cpu(
+    magma_int_t m, magma_int_t n,
+    const float   *SA, magma_int_t ldsa,
+    magmaBfloat16 *BA, magma_int_t ldba,
+    magma_int_t *info );
+
+void
+magma_bflag2s_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaBfloat16 *BA, magma_int_t ldba,
+    float               *SA, magma_int_t ldsa,
+    magma_int_t *info );
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,6 +97,25 @@ magma_cgebrd(
     magmaFloatComplex *work, magma_int_t lwork,
     magma_int_t *info);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+magma_int_t
+magma_sgebrd_ge2gb_cpu(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    float *A, magma_int_t lda,
+    float *tauq, float *taup,
+    magma_int_t *info);
+
+magma_int_t
+magma_sgebrd_gb2bd_cpu(
+    magma_int_t n, magma_int_t nb, magma_int_t Vblksiz,
+    const float *A, magma_int_t lda,
+    float *d, float *e,
+    float *VQ, float *TAUQ,
+    float *VP, float *TAUP, magma_int_t ldv,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_cgeev(
     magma_vec_t jobvl, magma_vec_t jobvr, magma_int_t n,
@@ -168,6 +187,14 @@ magma_cgehrd2(
     magmaFloatComplex *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_cgehrd_cpu(
+    magma_int_t n, magma_int_t ilo, magma_int_t ihi,
+    magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *tau,
+    magmaFloatComplex *work, magma_int_t lwork,
+    magma_int_t *info);
+
 magma_int_t
 magma_cgelqf(
     magma_int_t m, magma_int_t n,
@@ -321,6 +348,14 @@ magma_cgeqrf_m(
     magmaFloatComplex *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_cgeqrf_disk(
+    magma_int_t m, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    magmaFloatComplex *tau,
+    magmaFloatComplex *work, magma_int_t lwork,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_cgeqrf_ooc(
@@ -330,6 +365,13 @@ magma_cgeqrf_ooc(
     magmaFloatComplex *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_cgeqrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    magmaFloatComplex *A,
+    magmaFloatComplex *T,
+    magma_int_t *info);
+
 magma_int_t
 magma_cgeqrf2_gpu(
     magma_int_t m, magma_int_t n,
@@ -375,6 +417,14 @@ magma_cgeqrs3_gpu(
     magmaFloatComplex *hwork, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_cgerbt_cpu(
+    magma_bool_t gen, magma_int_t n, magma_int_t nrhs,
+    magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *B, magma_int_t ldb,
+    magmaFloatComplex *U, magmaFloatComplex *V,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_cgerbt_gpu(
@@ -395,6 +445,17 @@ magma_cgerfs_nopiv_gpu(
     magma_int_t *iter,
     magma_int_t *info);
 
+magma_int_t
+magma_cgerfs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const magmaFloatComplex *A, magma_int_t lda,
+    const magmaFloatComplex *B, magma_int_t ldb,
+    magmaFloatComplex *X, magma_int_t ldx,
+    magmaFloatComplex *work,
+    const magmaFloatComplex *AF,
+    magma_int_t *iter,
+    magma_int_t *info);
+
 magma_int_t
 magma_cgesdd(
     magma_vec_t jobz, magma_int_t m, magma_int_t n,
@@ -409,6 +470,18 @@ magma_cgesdd(
     magma_int_t *iwork,
     magma_int_t *info);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+magma_int_t
+magma_sgesdd_2stage_cpu(
+    magma_vec_t jobz, magma_int_t m, magma_int_t n,
+    float *A, magma_int_t lda,
+    float *s,
+    float *U, magma_int_t ldu,
+    float *VT, magma_int_t ldvt,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_cgesv(
     magma_int_t n, magma_int_t nrhs,
@@ -440,6 +513,13 @@ magma_cgesv_rbt(
     magmaFloatComplex *B, magma_int_t ldb,
     magma_int_t *info);
 
+magma_int_t
+magma_cgesv_rbt_cpu(
+    magma_bool_t refine, magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *B, magma_int_t ldb,
+    magma_int_t *info);
+
 magma_int_t
 magma_cgesvd(
     magma_vec_t jobu, magma_vec_t jobvt, magma_int_t m, magma_int_t n,
@@ -475,6 +555,17 @@ magma_cgetrf(
     magma_int_t *ipiv,
     magma_int_t *info);
 
+// MPI builds only
+#if defined(HAVE_MPI)
+magma_int_t
+magma_cgetrf_dist(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex *A, const magma_bcyclic_t *desc,
+    magma_int_t *ipiv,
+    MPI_Comm comm,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_cgetrf_gpu(
     magma_int_t m, magma_int_t n,
@@ -499,6 +590,13 @@ magma_cgetrf_mgpu(
     magma_int_t *ipiv,
     magma_int_t *info);
 
+magma_int_t
+magma_cgetrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    magmaFloatComplex *A,
+    magma_int_t *ipiv,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_cgetrf2(
@@ -532,6 +630,12 @@ magma_cgetrf_nopiv_gpu(
     magmaFloatComplex_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_cgetrf_nopiv_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    magmaFloatComplex *A,
+    magma_int_t *info);
+
 magma_int_t
 magma_cgetri_gpu(
     magma_int_t n,
@@ -556,6 +660,13 @@ magma_cgetrs_nopiv_gpu(
     magmaFloatComplex_ptr dB, magma_int_t lddb,
     magma_int_t *info);
 
+magma_int_t
+magma_cgetrs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const magmaFloatComplex *A,
+    magmaFloatComplex *B, magma_int_t ldb,
+    magma_int_t *info);
+
 // ------------------------------------------------------------ zhe routines
 magma_int_t
 magma_cheevd(
@@ -994,6 +1105,12 @@ magma_chetrf_aasen(
     magmaFloatComplex *A, magma_int_t lda,
     magma_int_t *ipiv, magma_int_t *info);
 
+magma_int_t
+magma_chetrf_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex *A, magma_int_t lda,
+    magma_int_t *ipiv, magma_int_t *info);
+
 magma_int_t
 magma_chetrf_nopiv(
     magma_uplo_t uplo, magma_int_t n,
@@ -1012,6 +1129,14 @@ magma_chetrf_nopiv_gpu(
     magmaFloatComplex_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_chetrs_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    const magmaFloatComplex *A, magma_int_t lda,
+    const magma_int_t *ipiv,
+    magmaFloatComplex *B, magma_int_t ldb,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_chetrs_nopiv_gpu(
@@ -1334,6 +1459,23 @@ magma_cpotrf_gpu(
     magmaFloatComplex_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_cpotrf_disk(
+    magma_uplo_t uplo, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    magmaFloatComplex *work, magma_int_t lwork,
+    magma_int_t *info);
+
+// MPI builds only
+#if defined(HAVE_MPI)
+magma_int_t
+magma_cpotrf_dist(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex *A, const magma_bcyclic_t *desc,
+    MPI_Comm comm,
+    magma_int_t *info);
+#endif
+
 // CUDA MAGMA only
 magma_int_t
 magma_cpotrf_m(
@@ -1357,6 +1499,12 @@ magma_cpotrf_mgpu_right(
     magmaFloatComplex_ptr d_lA[], magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_cpotrf_tile(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nb,
+    magmaFloatComplex *A,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_cpotrf3_mgpu(
@@ -1388,6 +1536,12 @@ magma_cpotrs_gpu(
     magmaFloatComplex_ptr dB, magma_int_t lddb,
     magma_int_t *info);
 
+magma_int_t
+magma_cpptrf_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex *AP,
+    magma_int_t *info);
+
 // ------------------------------------------------------------ zsy routines
 #ifdef COMPLEX
 // CUDA MAGMA only
@@ -1740,6 +1894,137 @@ void magma_cq_to_panel(
     magmaFloatComplex *A, magma_int_t lda,
     magmaFloatComplex *work);
 
+void magma_cge2tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *T);
+
+void magma_ctile2ge(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const magmaFloatComplex *T,
+    magmaFloatComplex *A, magma_int_t lda);
+
+void magma_ctranspose_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *AT, magma_int_t ldat);
+
+#ifdef COMPLEX
+void magma_ctranspose_conj_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *AT, magma_int_t ldat);
+#endif
+
+void magma_ctranspose_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex *A, magma_int_t lda);
+
+#ifdef COMPLEX
+void magma_ctranspose_conj_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex *A, magma_int_t lda);
+#endif
+
+float magma_clange_cpu(
+    magma_norm_t norm, magma_int_t m, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda);
+
+magma_int_t magma_clange_all_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    float values[4]);
+
+float magma_clanhe_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda);
+
+magma_int_t magma_clanhe_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    float values[4]);
+
+#ifdef COMPLEX
+float magma_clansy_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda);
+
+magma_int_t magma_clansy_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    float values[4]);
+#endif
+
+void magma_csymmetrize_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaFloatComplex *A, magma_int_t lda);
+
+void magma_csymmetrize_tiles_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaFloatComplex *A, magma_int_t lda,
+    magma_int_t ntile, magma_int_t mstride, magma_int_t nstride);
+
+void magma_ctrttf_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *ARF,
+    magma_int_t *info);
+
+void magma_ctfttr_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *ARF,
+    magmaFloatComplex *A, magma_int_t lda,
+    magma_int_t *info);
+
+void magma_ctrttp_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *AP,
+    magma_int_t *info);
+
+void magma_ctpttr_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *AP,
+    magmaFloatComplex *A, magma_int_t lda,
+    magma_int_t *info);
+
+void magma_ctrtri_diag_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *invA);
+
+void magma_ctrsm_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    const magmaFloatComplex *A, magma_int_t lda,
+    const magmaFloatComplex *invA,
+    magmaFloatComplex *B, magma_int_t ldb);
+
+magma_int_t magma_ctrtri_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    magmaFloatComplex *A, magma_int_t lda,
+    magma_int_t *info);
+
+magma_int_t magma_cgeqrt3_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *tau,
+    magmaFloatComplex *T, magma_int_t ldt,
+    magma_int_t *info);
+
+magma_int_t magma_clarfb_cpu(
+    magma_side_t side, magma_trans_t trans, magma_direct_t direct, magma_storev_t storev,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    const magmaFloatComplex *V, magma_int_t ldv,
+    const magmaFloatComplex *T, magma_int_t ldt,
+    magmaFloatComplex *C, magma_int_t ldc);
+
+void magma_cprbt_mv_cpu(
+    magma_int_t n, magma_int_t nrhs,
+    const magmaFloatComplex *V,
+    magmaFloatComplex *B, magma_int_t ldb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -968,6 +968,41 @@ magma_cpotrf_v33_batched(
     magma_int_t *info_array,
     magma_int_t batchCount, magma_queue_t queue);
 
+  /*
+   *  LAPACK batched routines on the CPU host
+   */
+magma_int_t
+magma_cpotrf_batched_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex **A_array, magma_int_t lda,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_cgetrf_batched_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex **A_array, magma_int_t lda,
+    magma_int_t **ipiv_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_cgeqrf_batched_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex **A_array, magma_int_t lda,
+    magmaFloatComplex **tau_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+  /*
+   *  BLAS batched routines on the CPU host
+   */
+void
+magma_ctrsm_batched_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex **A_array, magma_int_t lda,
+    magmaFloatComplex **B_array, magma_int_t ldb,
+    magma_int_t batchCount );
+
 // for debugging purpose
 void 
 cset_stepinit_ipiv(
@@ -126,6 +126,39 @@ magma_chbtype3cb(magma_int_t n, magma_int_t nb,
                 magma_int_t Vblksiz, magma_int_t wantz,
                 magmaFloatComplex *work);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+void
+magma_sgbtype1cb(magma_int_t n, magma_int_t nb,
+                float *A, magma_int_t lda,
+                float *VQ, float *TAUQ,
+                float *VP, float *TAUP,
+                magma_int_t ldv,
+                magma_int_t st, magma_int_t ed, magma_int_t sweep,
+                magma_int_t Vblksiz,
+                float *work);
+
+void
+magma_sgbtype2cb(magma_int_t n, magma_int_t nb,
+                float *A, magma_int_t lda,
+                float *VQ, float *TAUQ,
+                float *VP, float *TAUP,
+                magma_int_t ldv,
+                magma_int_t st, magma_int_t ed, magma_int_t sweep,
+                magma_int_t Vblksiz,
+                float *work);
+
+void
+magma_sgbtype3cb(magma_int_t n, magma_int_t nb,
+                float *A, magma_int_t lda,
+                float *VQ, float *TAUQ,
+                float *VP, float *TAUP,
+                magma_int_t ldv,
+                magma_int_t st, magma_int_t ed, magma_int_t sweep,
+                magma_int_t Vblksiz,
+                float *work);
+#endif
+
 
 magma_int_t
 magma_cunmqr_2stage_gpu(
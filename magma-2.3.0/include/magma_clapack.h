@@ -71,9 +71,11 @@ extern "C" {
 #define lapackf77_cgehrd   FORTRAN_NAME( cgehrd, CGEHRD )
 #define lapackf77_cgelqf   FORTRAN_NAME( cgelqf, CGELQF )
 #define lapackf77_cgels    FORTRAN_NAME( cgels,  CGELS  )
+#define lapackf77_cgemqrt  FORTRAN_NAME( cgemqrt, CGEMQRT )
 #define lapackf77_cgeqlf   FORTRAN_NAME( cgeqlf, CGEQLF )
 #define lapackf77_cgeqp3   FORTRAN_NAME( cgeqp3, CGEQP3 )
 #define lapackf77_cgeqrf   FORTRAN_NAME( cgeqrf, CGEQRF )
+#define lapackf77_cgeqrt   FORTRAN_NAME( cgeqrt, CGEQRT )
 #define lapackf77_cgesdd   FORTRAN_NAME( cgesdd, CGESDD )
 #define lapackf77_cgesv    FORTRAN_NAME( cgesv,  CGESV  )
 #define lapackf77_cgesvd   FORTRAN_NAME( cgesvd, CGESVD )
@@ -128,6 +130,7 @@ extern "C" {
 #define lapackf77_cpotrf   FORTRAN_NAME( cpotrf, CPOTRF )
 #define lapackf77_cpotri   FORTRAN_NAME( cpotri, CPOTRI )
 #define lapackf77_cpotrs   FORTRAN_NAME( cpotrs, CPOTRS )
+#define lapackf77_cpptrf   FORTRAN_NAME( cpptrf, CPPTRF )
 #define lapackf77_cstedc   FORTRAN_NAME( cstedc, CSTEDC )
 #define lapackf77_cstein   FORTRAN_NAME( cstein, CSTEIN )
 #define lapackf77_cstemr   FORTRAN_NAME( cstemr, CSTEMR )
@@ -135,9 +138,15 @@ extern "C" {
 #define lapackf77_csymv    FORTRAN_NAME( csymv,  CSYMV  )
 #define lapackf77_csyr     FORTRAN_NAME( csyr,   CSYR   )
 #define lapackf77_csysv    FORTRAN_NAME( csysv,  CSYSV  )
+#define lapackf77_ctfttr   FORTRAN_NAME( ctfttr, CTFTTR )
+#define lapackf77_ctpmqrt  FORTRAN_NAME( ctpmqrt, CTPMQRT )
+#define lapackf77_ctpqrt   FORTRAN_NAME( ctpqrt, CTPQRT )
+#define lapackf77_ctpttr   FORTRAN_NAME( ctpttr, CTPTTR )
 #define lapackf77_ctrevc   FORTRAN_NAME( ctrevc, CTREVC )
 #define lapackf77_ctrevc3  FORTRAN_NAME( ctrevc3, CTREVC3 )
 #define lapackf77_ctrtri   FORTRAN_NAME( ctrtri, CTRTRI )
+#define lapackf77_ctrttf   FORTRAN_NAME( ctrttf, CTRTTF )
+#define lapackf77_ctrttp   FORTRAN_NAME( ctrttp, CTRTTP )
 #define lapackf77_cung2r   FORTRAN_NAME( cung2r, CUNG2R )
 #define lapackf77_cungbr   FORTRAN_NAME( cungbr, CUNGBR )
 #define lapackf77_cunghr   FORTRAN_NAME( cunghr, CUNGHR )
@@ -466,6 +475,15 @@ void   lapackf77_cgels(  const char *trans,
                          magmaFloatComplex *work, const magma_int_t *lwork,
                          magma_int_t *info );
 
+void   lapackf77_cgemqrt( const char *side, const char *trans,
+                         const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
+                         const magma_int_t *nb,
+                         const magmaFloatComplex *V, const magma_int_t *ldv,
+                         const magmaFloatComplex *T, const magma_int_t *ldt,
+                         magmaFloatComplex *C, const magma_int_t *ldc,
+                         magmaFloatComplex *work,
+                         magma_int_t *info );
+
 void   lapackf77_cgeqlf( const magma_int_t *m, const magma_int_t *n,
                          magmaFloatComplex *A, const magma_int_t *lda,
                          magmaFloatComplex *tau,
@@ -488,6 +506,12 @@ void   lapackf77_cgeqrf( const magma_int_t *m, const magma_int_t *n,
                          magmaFloatComplex *work, const magma_int_t *lwork,
                          magma_int_t *info );
 
+void   lapackf77_cgeqrt( const magma_int_t *m, const magma_int_t *n, const magma_int_t *nb,
+                         magmaFloatComplex *A, const magma_int_t *lda,
+                         magmaFloatComplex *T, const magma_int_t *ldt,
+                         magmaFloatComplex *work,
+                         magma_int_t *info );
+
 void   lapackf77_cgesdd( const char *jobz,
                          const magma_int_t *m, const magma_int_t *n,
                          magmaFloatComplex *A, const magma_int_t *lda,
@@ -872,6 +896,11 @@ void   lapackf77_cpotrs( const char *uplo,
                          magmaFloatComplex *B, const magma_int_t *ldb,
                          magma_int_t *info );
 
+void   lapackf77_cpptrf( const char *uplo,
+                         const magma_int_t *n,
+                         magmaFloatComplex *AP,
+                         magma_int_t *info );
+
 void   lapackf77_cstedc( const char *compz,
                          const magma_int_t *n,
                          float *d, float *e,
@@ -937,6 +966,36 @@ void   lapackf77_csysv(  const char *uplo,
 
 #endif
 
+void   lapackf77_ctfttr( const char *transr, const char *uplo,
+                         const magma_int_t *n,
+                         const magmaFloatComplex *ARF,
+                         magmaFloatComplex *A, const magma_int_t *lda,
+                         magma_int_t *info );
+
+void   lapackf77_ctpmqrt( const char *side, const char *trans,
+                         const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
+                         const magma_int_t *l, const magma_int_t *nb,
+                         const magmaFloatComplex *V, const magma_int_t *ldv,
+                         const magmaFloatComplex *T, const magma_int_t *ldt,
+                         magmaFloatComplex *A, const magma_int_t *lda,
+                         magmaFloatComplex *B, const magma_int_t *ldb,
+                         magmaFloatComplex *work,
+                         magma_int_t *info );
+
+void   lapackf77_ctpqrt( const magma_int_t *m, const magma_int_t *n,
+                         const magma_int_t *l, const magma_int_t *nb,
+                         magmaFloatComplex *A, const magma_int_t *lda,
+                         magmaFloatComplex *B, const magma_int_t *ldb,
+                         magmaFloatComplex *T, const magma_int_t *ldt,
+                         magmaFloatComplex *work,
+                         magma_int_t *info );
+
+void   lapackf77_ctpttr( const char *uplo,
+                         const magma_int_t *n,
+                         const magmaFloatComplex *AP,
+                         magmaFloatComplex *A, const magma_int_t *lda,
+                         magma_int_t *info );
+
 void   lapackf77_ctrevc( const char *side, const char *howmny,
                          // select is [in] for complex; [in,out] for real
                          #ifdef COMPLEX
@@ -975,6 +1034,18 @@ void   lapackf77_ctrtri( const char *uplo, const char *diag,
                          magmaFloatComplex *A, const magma_int_t *lda,
                          magma_int_t *info );
 
+void   lapackf77_ctrttf( const char *transr, const char *uplo,
+                         const magma_int_t *n,
+                         const magmaFloatComplex *A, const magma_int_t *lda,
+                         magmaFloatComplex *ARF,
+                         magma_int_t *info );
+
+void   lapackf77_ctrttp( const char *uplo,
+                         const magma_int_t *n,
+                         const magmaFloatComplex *A, const magma_int_t *lda,
+                         magmaFloatComplex *AP,
+                         magma_int_t *info );
+
 void   lapackf77_cung2r( const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
                          magmaFloatComplex *A, const magma_int_t *lda,
                          const magmaFloatComplex *tau,
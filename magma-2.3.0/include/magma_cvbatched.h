@@ -650,6 +650,41 @@ magmablas_clacpy_vbatched(
    */    
 magma_int_t magma_get_cpotrf_vbatched_crossover();
 
+  /*
+   *  LAPACK vbatched routines on the CPU host
+   */
+magma_int_t
+magma_cpotrf_vbatched_cpu(
+    magma_uplo_t uplo, magma_int_t *n,
+    magmaFloatComplex **A_array, magma_int_t *lda,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_cgetrf_vbatched_cpu(
+    magma_int_t *m, magma_int_t *n,
+    magmaFloatComplex **A_array, magma_int_t *lda,
+    magma_int_t **ipiv_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_cgeqrf_vbatched_cpu(
+    magma_int_t *m, magma_int_t *n,
+    magmaFloatComplex **A_array, magma_int_t *lda,
+    magmaFloatComplex **tau_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+  /*
+   *  BLAS vbatched routines on the CPU host
+   */
+void
+magma_ctrsm_vbatched_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t *m, magma_int_t *n,
+    magmaFloatComplex alpha,
+    magmaFloatComplex **A_array, magma_int_t *lda,
+    magmaFloatComplex **B_array, magma_int_t *ldb,
+    magma_int_t batchCount );
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,6 +97,25 @@ magma_dgebrd(
     double *work, magma_int_t lwork,
     magma_int_t *info);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+magma_int_t
+magma_dgebrd_ge2gb_cpu(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    double *A, magma_int_t lda,
+    double *tauq, double *taup,
+    magma_int_t *info);
+
+magma_int_t
+magma_dgebrd_gb2bd_cpu(
+    magma_int_t n, magma_int_t nb, magma_int_t Vblksiz,
+    const double *A, magma_int_t lda,
+    double *d, double *e,
+    double *VQ, double *TAUQ,
+    double *VP, double *TAUP, magma_int_t ldv,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_dgeev(
     magma_vec_t jobvl, magma_vec_t jobvr, magma_int_t n,
@@ -168,6 +187,14 @@ magma_dgehrd2(
     double *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_dgehrd_cpu(
+    magma_int_t n, magma_int_t ilo, magma_int_t ihi,
+    double *A, magma_int_t lda,
+    double *tau,
+    double *work, magma_int_t lwork,
+    magma_int_t *info);
+
 magma_int_t
 magma_dgelqf(
     magma_int_t m, magma_int_t n,
@@ -321,6 +348,14 @@ magma_dgeqrf_m(
     double *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_dgeqrf_disk(
+    magma_int_t m, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    double *tau,
+    double *work, magma_int_t lwork,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_dgeqrf_ooc(
@@ -330,6 +365,13 @@ magma_dgeqrf_ooc(
     double *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_dgeqrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    double *A,
+    double *T,
+    magma_int_t *info);
+
 magma_int_t
 magma_dgeqrf2_gpu(
     magma_int_t m, magma_int_t n,
@@ -375,6 +417,14 @@ magma_dgeqrs3_gpu(
     double *hwork, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_dgerbt_cpu(
+    magma_bool_t gen, magma_int_t n, magma_int_t nrhs,
+    double *A, magma_int_t lda,
+    double *B, magma_int_t ldb,
+    double *U, double *V,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_dgerbt_gpu(
@@ -395,6 +445,17 @@ magma_dgerfs_nopiv_gpu(
     magma_int_t *iter,
     magma_int_t *info);
 
+magma_int_t
+magma_dgerfs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const double *A, magma_int_t lda,
+    const double *B, magma_int_t ldb,
+    double *X, magma_int_t ldx,
+    double *work,
+    const double *AF,
+    magma_int_t *iter,
+    magma_int_t *info);
+
 magma_int_t
 magma_dgesdd(
     magma_vec_t jobz, magma_int_t m, magma_int_t n,
@@ -409,6 +470,18 @@ magma_dgesdd(
     magma_int_t *iwork,
     magma_int_t *info);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+magma_int_t
+magma_dgesdd_2stage_cpu(
+    magma_vec_t jobz, magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda,
+    double *s,
+    double *U, magma_int_t ldu,
+    double *VT, magma_int_t ldvt,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_dgesv(
     magma_int_t n, magma_int_t nrhs,
@@ -440,6 +513,13 @@ magma_dgesv_rbt(
     double *B, magma_int_t ldb,
     magma_int_t *info);
 
+magma_int_t
+magma_dgesv_rbt_cpu(
+    magma_bool_t refine, magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const double *A, magma_int_t lda,
+    double *B, magma_int_t ldb,
+    magma_int_t *info);
+
 magma_int_t
 magma_dgesvd(
     magma_vec_t jobu, magma_vec_t jobvt, magma_int_t m, magma_int_t n,
@@ -475,6 +555,17 @@ magma_dgetrf(
     magma_int_t *ipiv,
     magma_int_t *info);
 
+// MPI builds only
+#if defined(HAVE_MPI)
+magma_int_t
+magma_dgetrf_dist(
+    magma_int_t m, magma_int_t n,
+    double *A, const magma_bcyclic_t *desc,
+    magma_int_t *ipiv,
+    MPI_Comm comm,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_dgetrf_gpu(
     magma_int_t m, magma_int_t n,
@@ -499,6 +590,13 @@ magma_dgetrf_mgpu(
     magma_int_t *ipiv,
     magma_int_t *info);
 
+magma_int_t
+magma_dgetrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    double *A,
+    magma_int_t *ipiv,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_dgetrf2(
@@ -532,6 +630,12 @@ magma_dgetrf_nopiv_gpu(
     magmaDouble_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_dgetrf_nopiv_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    double *A,
+    magma_int_t *info);
+
 magma_int_t
 magma_dgetri_gpu(
     magma_int_t n,
@@ -556,6 +660,13 @@ magma_dgetrs_nopiv_gpu(
     magmaDouble_ptr dB, magma_int_t lddb,
     magma_int_t *info);
 
+magma_int_t
+magma_dgetrs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const double *A,
+    double *B, magma_int_t ldb,
+    magma_int_t *info);
+
 // ------------------------------------------------------------ zhe routines
 magma_int_t
 magma_dsyevd(
@@ -994,6 +1105,12 @@ magma_dsytrf_aasen(
     double *A, magma_int_t lda,
     magma_int_t *ipiv, magma_int_t *info);
 
+magma_int_t
+magma_dsytrf_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    double *A, magma_int_t lda,
+    magma_int_t *ipiv, magma_int_t *info);
+
 magma_int_t
 magma_dsytrf_nopiv(
     magma_uplo_t uplo, magma_int_t n,
@@ -1012,6 +1129,14 @@ magma_dsytrf_nopiv_gpu(
     magmaDouble_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_dsytrs_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    const double *A, magma_int_t lda,
+    const magma_int_t *ipiv,
+    double *B, magma_int_t ldb,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_dsytrs_nopiv_gpu(
@@ -1334,6 +1459,23 @@ magma_dpotrf_gpu(
     magmaDouble_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_dpotrf_disk(
+    magma_uplo_t uplo, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    double *work, magma_int_t lwork,
+    magma_int_t *info);
+
+// MPI builds only
+#if defined(HAVE_MPI)
+magma_int_t
+magma_dpotrf_dist(
+    magma_uplo_t uplo, magma_int_t n,
+    double *A, const magma_bcyclic_t *desc,
+    MPI_Comm comm,
+    magma_int_t *info);
+#endif
+
 // CUDA MAGMA only
 magma_int_t
 magma_dpotrf_m(
@@ -1357,6 +1499,12 @@ magma_dpotrf_mgpu_right(
     magmaDouble_ptr d_lA[], magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_dpotrf_tile(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nb,
+    double *A,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_dpotrf3_mgpu(
@@ -1388,6 +1536,12 @@ magma_dpotrs_gpu(
     magmaDouble_ptr dB, magma_int_t lddb,
     magma_int_t *info);
 
+magma_int_t
+magma_dpptrf_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    double *AP,
+    magma_int_t *info);
+
 // ------------------------------------------------------------ zsy routines
 #ifdef COMPLEX
 // CUDA MAGMA only
@@ -1740,6 +1894,137 @@ void magma_dq_to_panel(
     double *A, magma_int_t lda,
     double *work);
 
+void magma_dge2tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const double *A, magma_int_t lda,
+    double *T);
+
+void magma_dtile2ge(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const double *T,
+    double *A, magma_int_t lda);
+
+void magma_dtranspose_cpu(
+    magma_int_t m, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *AT, magma_int_t ldat);
+
+#ifdef COMPLEX
+void magma_dtranspose_conj_cpu(
+    magma_int_t m, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *AT, magma_int_t ldat);
+#endif
+
+void magma_dtranspose_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda);
+
+#ifdef COMPLEX
+void magma_dtranspose_conj_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda);
+#endif
+
+double magma_dlange_cpu(
+    magma_norm_t norm, magma_int_t m, magma_int_t n,
+    const double *A, magma_int_t lda);
+
+magma_int_t magma_dlange_all_cpu(
+    magma_int_t m, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double values[4]);
+
+double magma_dlansy_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda);
+
+magma_int_t magma_dlansy_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double values[4]);
+
+#ifdef COMPLEX
+double magma_dlansy_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda);
+
+magma_int_t magma_dlansy_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double values[4]);
+#endif
+
+void magma_dsymmetrize_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    double *A, magma_int_t lda);
+
+void magma_dsymmetrize_tiles_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    double *A, magma_int_t lda,
+    magma_int_t ntile, magma_int_t mstride, magma_int_t nstride);
+
+void magma_dtrttf_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *ARF,
+    magma_int_t *info);
+
+void magma_dtfttr_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const double *ARF,
+    double *A, magma_int_t lda,
+    magma_int_t *info);
+
+void magma_dtrttp_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *AP,
+    magma_int_t *info);
+
+void magma_dtpttr_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const double *AP,
+    double *A, magma_int_t lda,
+    magma_int_t *info);
+
+void magma_dtrtri_diag_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    const double *A, magma_int_t lda,
+    double *invA);
+
+void magma_dtrsm_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    const double *A, magma_int_t lda,
+    const double *invA,
+    double *B, magma_int_t ldb);
+
+magma_int_t magma_dtrtri_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    double *A, magma_int_t lda,
+    magma_int_t *info);
+
+magma_int_t magma_dgeqrt3_cpu(
+    magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda,
+    double *tau,
+    double *T, magma_int_t ldt,
+    magma_int_t *info);
+
+magma_int_t magma_dlarfb_cpu(
+    magma_side_t side, magma_trans_t trans, magma_direct_t direct, magma_storev_t storev,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    const double *V, magma_int_t ldv,
+    const double *T, magma_int_t ldt,
+    double *C, magma_int_t ldc);
+
+void magma_dprbt_mv_cpu(
+    magma_int_t n, magma_int_t nrhs,
+    const double *V,
+    double *B, magma_int_t ldb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -968,6 +968,41 @@ magma_dpotrf_v33_batched(
     magma_int_t *info_array,
     magma_int_t batchCount, magma_queue_t queue);
 
+  /*
+   *  LAPACK batched routines on the CPU host
+   */
+magma_int_t
+magma_dpotrf_batched_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    double **A_array, magma_int_t lda,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_dgetrf_batched_cpu(
+    magma_int_t m, magma_int_t n,
+    double **A_array, magma_int_t lda,
+    magma_int_t **ipiv_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_dgeqrf_batched_cpu(
+    magma_int_t m, magma_int_t n,
+    double **A_array, magma_int_t lda,
+    double **tau_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+  /*
+   *  BLAS batched routines on the CPU host
+   */
+void
+magma_dtrsm_batched_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    double alpha,
+    double **A_array, magma_int_t lda,
+    double **B_array, magma_int_t ldb,
+    magma_int_t batchCount );
+
 // for debugging purpose
 void 
 dset_stepinit_ipiv(
@@ -71,9 +71,11 @@ extern "C" {
 #define lapackf77_dgehrd   FORTRAN_NAME( dgehrd, DGEHRD )
 #define lapackf77_dgelqf   FORTRAN_NAME( dgelqf, DGELQF )
 #define lapackf77_dgels    FORTRAN_NAME( dgels,  DGELS  )
+#define lapackf77_dgemqrt  FORTRAN_NAME( dgemqrt, DGEMQRT )
 #define lapackf77_dgeqlf   FORTRAN_NAME( dgeqlf, DGEQLF )
 #define lapackf77_dgeqp3   FORTRAN_NAME( dgeqp3, DGEQP3 )
 #define lapackf77_dgeqrf   FORTRAN_NAME( dgeqrf, DGEQRF )
+#define lapackf77_dgeqrt   FORTRAN_NAME( dgeqrt, DGEQRT )
 #define lapackf77_dgesdd   FORTRAN_NAME( dgesdd, DGESDD )
 #define lapackf77_dgesv    FORTRAN_NAME( dgesv,  DGESV  )
 #define lapackf77_dgesvd   FORTRAN_NAME( dgesvd, DGESVD )
@@ -128,6 +130,7 @@ extern "C" {
 #define lapackf77_dpotrf   FORTRAN_NAME( dpotrf, DPOTRF )
 #define lapackf77_dpotri   FORTRAN_NAME( dpotri, DPOTRI )
 #define lapackf77_dpotrs   FORTRAN_NAME( dpotrs, DPOTRS )
+#define lapackf77_dpptrf   FORTRAN_NAME( dpptrf, DPPTRF )
 #define lapackf77_dstedc   FORTRAN_NAME( dstedc, DSTEDC )
 #define lapackf77_dstein   FORTRAN_NAME( dstein, DSTEIN )
 #define lapackf77_dstemr   FORTRAN_NAME( dstemr, DSTEMR )
@@ -135,9 +138,15 @@ extern "C" {
 #define lapackf77_dsymv    FORTRAN_NAME( dsymv,  DSYMV  )
 #define lapackf77_dsyr     FORTRAN_NAME( dsyr,   DSYR   )
 #define lapackf77_dsysv    FORTRAN_NAME( dsysv,  DSYSV  )
+#define lapackf77_dtfttr   FORTRAN_NAME( dtfttr, DTFTTR )
+#define lapackf77_dtpmqrt  FORTRAN_NAME( dtpmqrt, DTPMQRT )
+#define lapackf77_dtpqrt   FORTRAN_NAME( dtpqrt, DTPQRT )
+#define lapackf77_dtpttr   FORTRAN_NAME( dtpttr, DTPTTR )
 #define lapackf77_dtrevc   FORTRAN_NAME( dtrevc, DTREVC )
 #define lapackf77_dtrevc3  FORTRAN_NAME( dtrevc3, DTREVC3 )
 #define lapackf77_dtrtri   FORTRAN_NAME( dtrtri, DTRTRI )
+#define lapackf77_dtrttf   FORTRAN_NAME( dtrttf, DTRTTF )
+#define lapackf77_dtrttp   FORTRAN_NAME( dtrttp, DTRTTP )
 #define lapackf77_dorg2r   FORTRAN_NAME( dorg2r, DORG2R )
 #define lapackf77_dorgbr   FORTRAN_NAME( dorgbr, DORGBR )
 #define lapackf77_dorghr   FORTRAN_NAME( dorghr, DORGHR )
@@ -466,6 +475,15 @@ void   lapackf77_dgels(  const char *trans,
                          double *work, const magma_int_t *lwork,
                          magma_int_t *info );
 
+void   lapackf77_dgemqrt( const char *side, const char *trans,
+                         const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
+                         const magma_int_t *nb,
+                         const double *V, const magma_int_t *ldv,
+                         const double *T, const magma_int_t *ldt,
+                         double *C, const magma_int_t *ldc,
+                         double *work,
+                         magma_int_t *info );
+
 void   lapackf77_dgeqlf( const magma_int_t *m, const magma_int_t *n,
                          double *A, const magma_int_t *lda,
                          double *tau,
@@ -488,6 +506,12 @@ void   lapackf77_dgeqrf( const magma_int_t *m, const magma_int_t *n,
                          double *work, const magma_int_t *lwork,
                          magma_int_t *info );
 
+void   lapackf77_dgeqrt( const magma_int_t *m, const magma_int_t *n, const magma_int_t *nb,
+                         double *A, const magma_int_t *lda,
+                         double *T, const magma_int_t *ldt,
+                         double *work,
+                         magma_int_t *info );
+
 void   lapackf77_dgesdd( const char *jobz,
                          const magma_int_t *m, const magma_int_t *n,
                          double *A, const magma_int_t *lda,
@@ -872,6 +896,11 @@ void   lapackf77_dpotrs( const char *uplo,
                          double *B, const magma_int_t *ldb,
                          magma_int_t *info );
 
+void   lapackf77_dpptrf( const char *uplo,
+                         const magma_int_t *n,
+                         double *AP,
+                         magma_int_t *info );
+
 void   lapackf77_dstedc( const char *compz,
                          const magma_int_t *n,
                          double *d, double *e,
@@ -937,6 +966,36 @@ void   lapackf77_dsysv(  const char *uplo,
 
 #endif
 
+void   lapackf77_dtfttr( const char *transr, const char *uplo,
+                         const magma_int_t *n,
+                         const double *ARF,
+                         double *A, const magma_int_t *lda,
+                         magma_int_t *info );
+
+void   lapackf77_dtpmqrt( const char *side, const char *trans,
+                         const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
+                         const magma_int_t *l, const magma_int_t *nb,
+                         const double *V, const magma_int_t *ldv,
+                         const double *T, const magma_int_t *ldt,
+                         double *A, const magma_int_t *lda,
+                         double *B, const magma_int_t *ldb,
+                         double *work,
+                         magma_int_t *info );
+
+void   lapackf77_dtpqrt( const magma_int_t *m, const magma_int_t *n,
+                         const magma_int_t *l, const magma_int_t *nb,
+                         double *A, const magma_int_t *lda,
+                         double *B, const magma_int_t *ldb,
+                         double *T, const magma_int_t *ldt,
+                         double *work,
+                         magma_int_t *info );
+
+void   lapackf77_dtpttr( const char *uplo,
+                         const magma_int_t *n,
+                         const double *AP,
+                         double *A, const magma_int_t *lda,
+                         magma_int_t *info );
+
 void   lapackf77_dtrevc( const char *side, const char *howmny,
                          // select is [in] for real; [in,out] for real
                          #ifdef COMPLEX
@@ -975,6 +1034,18 @@ void   lapackf77_dtrtri( const char *uplo, const char *diag,
                          double *A, const magma_int_t *lda,
                          magma_int_t *info );
 
+void   lapackf77_dtrttf( const char *transr, const char *uplo,
+                         const magma_int_t *n,
+                         const double *A, const magma_int_t *lda,
+                         double *ARF,
+                         magma_int_t *info );
+
+void   lapackf77_dtrttp( const char *uplo,
+                         const magma_int_t *n,
+                         const double *A, const magma_int_t *lda,
+                         double *AP,
+                         magma_int_t *info );
+
 void   lapackf77_dorg2r( const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
                          double *A, const magma_int_t *lda,
                          const double *tau,
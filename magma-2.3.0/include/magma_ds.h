@@ -76,6 +76,36 @@ magma_dsposv_gpu(
     magma_int_t *iter,
     magma_int_t *info);
 
+// -----------------------------------------------------------------------------
+// CPU conversions, in control/dlag2s_cpu.cpp
+void
+magma_dlag2s_cpu(
+    magma_int_t m, magma_int_t n,
+    const double *A, magma_int_t lda,
+    float *SA,       magma_int_t ldsa,
+    magma_int_t *info);
+
+void
+magma_slag2d_cpu(
+    magma_int_t m, magma_int_t n,
+    const float *SA, magma_int_t ldsa,
+    double *A,       magma_int_t lda,
+    magma_int_t *info);
+
+void
+magma_dlat2s_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const double *A, magma_int_t lda,
+    float *SA,       magma_int_t ldsa,
+    magma_int_t *info);
+
+void
+magma_slat2d_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const float *SA, magma_int_t ldsa,
+    double *A,       magma_int_t lda,
+    magma_int_t *info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -97,6 +97,25 @@ magma_sgebrd(
     float *work, magma_int_t lwork,
     magma_int_t *info);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+magma_int_t
+magma_sgebrd_ge2gb_cpu(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    float *A, magma_int_t lda,
+    float *tauq, float *taup,
+    magma_int_t *info);
+
+magma_int_t
+magma_sgebrd_gb2bd_cpu(
+    magma_int_t n, magma_int_t nb, magma_int_t Vblksiz,
+    const float *A, magma_int_t lda,
+    float *d, float *e,
+    float *VQ, float *TAUQ,
+    float *VP, float *TAUP, magma_int_t ldv,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_sgeev(
     magma_vec_t jobvl, magma_vec_t jobvr, magma_int_t n,
@@ -168,6 +187,14 @@ magma_sgehrd2(
     float *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_sgehrd_cpu(
+    magma_int_t n, magma_int_t ilo, magma_int_t ihi,
+    float *A, magma_int_t lda,
+    float *tau,
+    float *work, magma_int_t lwork,
+    magma_int_t *info);
+
 magma_int_t
 magma_sgelqf(
     magma_int_t m, magma_int_t n,
@@ -321,6 +348,14 @@ magma_sgeqrf_m(
     float *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_sgeqrf_disk(
+    magma_int_t m, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    float *tau,
+    float *work, magma_int_t lwork,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_sgeqrf_ooc(
@@ -330,6 +365,13 @@ magma_sgeqrf_ooc(
     float *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_sgeqrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    float *A,
+    float *T,
+    magma_int_t *info);
+
 magma_int_t
 magma_sgeqrf2_gpu(
     magma_int_t m, magma_int_t n,
@@ -375,6 +417,14 @@ magma_sgeqrs3_gpu(
     float *hwork, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_sgerbt_cpu(
+    magma_bool_t gen, magma_int_t n, magma_int_t nrhs,
+    float *A, magma_int_t lda,
+    float *B, magma_int_t ldb,
+    float *U, float *V,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_sgerbt_gpu(
@@ -395,6 +445,17 @@ magma_sgerfs_nopiv_gpu(
     magma_int_t *iter,
     magma_int_t *info);
 
+magma_int_t
+magma_sgerfs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const float *A, magma_int_t lda,
+    const float *B, magma_int_t ldb,
+    float *X, magma_int_t ldx,
+    float *work,
+    const float *AF,
+    magma_int_t *iter,
+    magma_int_t *info);
+
 magma_int_t
 magma_sgesdd(
     magma_vec_t jobz, magma_int_t m, magma_int_t n,
@@ -409,6 +470,18 @@ magma_sgesdd(
     magma_int_t *iwork,
     magma_int_t *info);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+magma_int_t
+magma_sgesdd_2stage_cpu(
+    magma_vec_t jobz, magma_int_t m, magma_int_t n,
+    float *A, magma_int_t lda,
+    float *s,
+    float *U, magma_int_t ldu,
+    float *VT, magma_int_t ldvt,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_sgesv(
     magma_int_t n, magma_int_t nrhs,
@@ -440,6 +513,13 @@ magma_sgesv_rbt(
     float *B, magma_int_t ldb,
     magma_int_t *info);
 
+magma_int_t
+magma_sgesv_rbt_cpu(
+    magma_bool_t refine, magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const float *A, magma_int_t lda,
+    float *B, magma_int_t ldb,
+    magma_int_t *info);
+
 magma_int_t
 magma_sgesvd(
     magma_vec_t jobu, magma_vec_t jobvt, magma_int_t m, magma_int_t n,
@@ -475,6 +555,17 @@ magma_sgetrf(
     magma_int_t *ipiv,
     magma_int_t *info);
 
+// MPI builds only
+#if defined(HAVE_MPI)
+magma_int_t
+magma_sgetrf_dist(
+    magma_int_t m, magma_int_t n,
+    float *A, const magma_bcyclic_t *desc,
+    magma_int_t *ipiv,
+    MPI_Comm comm,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_sgetrf_gpu(
     magma_int_t m, magma_int_t n,
@@ -499,6 +590,13 @@ magma_sgetrf_mgpu(
     magma_int_t *ipiv,
     magma_int_t *info);
 
+magma_int_t
+magma_sgetrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    float *A,
+    magma_int_t *ipiv,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_sgetrf2(
@@ -532,6 +630,12 @@ magma_sgetrf_nopiv_gpu(
     magmaFloat_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_sgetrf_nopiv_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    float *A,
+    magma_int_t *info);
+
 magma_int_t
 magma_sgetri_gpu(
     magma_int_t n,
@@ -556,6 +660,13 @@ magma_sgetrs_nopiv_gpu(
     magmaFloat_ptr dB, magma_int_t lddb,
     magma_int_t *info);
 
+magma_int_t
+magma_sgetrs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const float *A,
+    float *B, magma_int_t ldb,
+    magma_int_t *info);
+
 // ------------------------------------------------------------ zhe routines
 magma_int_t
 magma_ssyevd(
@@ -994,6 +1105,12 @@ magma_ssytrf_aasen(
     float *A, magma_int_t lda,
     magma_int_t *ipiv, magma_int_t *info);
 
+magma_int_t
+magma_ssytrf_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    float *A, magma_int_t lda,
+    magma_int_t *ipiv, magma_int_t *info);
+
 magma_int_t
 magma_ssytrf_nopiv(
     magma_uplo_t uplo, magma_int_t n,
@@ -1012,6 +1129,14 @@ magma_ssytrf_nopiv_gpu(
     magmaFloat_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_ssytrs_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    const float *A, magma_int_t lda,
+    const magma_int_t *ipiv,
+    float *B, magma_int_t ldb,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_ssytrs_nopiv_gpu(
@@ -1334,6 +1459,23 @@ magma_spotrf_gpu(
     magmaFloat_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_spotrf_disk(
+    magma_uplo_t uplo, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    float *work, magma_int_t lwork,
+    magma_int_t *info);
+
+// MPI builds only
+#if defined(HAVE_MPI)
+magma_int_t
+magma_spotrf_dist(
+    magma_uplo_t uplo, magma_int_t n,
+    float *A, const magma_bcyclic_t *desc,
+    MPI_Comm comm,
+    magma_int_t *info);
+#endif
+
 // CUDA MAGMA only
 magma_int_t
 magma_spotrf_m(
@@ -1357,6 +1499,12 @@ magma_spotrf_mgpu_right(
     magmaFloat_ptr d_lA[], magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_spotrf_tile(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nb,
+    float *A,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_spotrf3_mgpu(
@@ -1388,6 +1536,12 @@ magma_spotrs_gpu(
     magmaFloat_ptr dB, magma_int_t lddb,
     magma_int_t *info);
 
+magma_int_t
+magma_spptrf_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    float *AP,
+    magma_int_t *info);
+
 // ------------------------------------------------------------ zsy routines
 #ifdef COMPLEX
 // CUDA MAGMA only
@@ -1740,6 +1894,137 @@ void magma_sq_to_panel(
     float *A, magma_int_t lda,
     float *work);
 
+void magma_sge2tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const float *A, magma_int_t lda,
+    float *T);
+
+void magma_stile2ge(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const float *T,
+    float *A, magma_int_t lda);
+
+void magma_stranspose_cpu(
+    magma_int_t m, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float *AT, magma_int_t ldat);
+
+#ifdef COMPLEX
+void magma_stranspose_conj_cpu(
+    magma_int_t m, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float *AT, magma_int_t ldat);
+#endif
+
+void magma_stranspose_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    float *A, magma_int_t lda);
+
+#ifdef COMPLEX
+void magma_stranspose_conj_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    float *A, magma_int_t lda);
+#endif
+
+float magma_slange_cpu(
+    magma_norm_t norm, magma_int_t m, magma_int_t n,
+    const float *A, magma_int_t lda);
+
+magma_int_t magma_slange_all_cpu(
+    magma_int_t m, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float values[4]);
+
+float magma_slansy_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda);
+
+magma_int_t magma_slansy_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float values[4]);
+
+#ifdef COMPLEX
+float magma_slansy_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda);
+
+magma_int_t magma_slansy_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float values[4]);
+#endif
+
+void magma_ssymmetrize_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    float *A, magma_int_t lda);
+
+void magma_ssymmetrize_tiles_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    float *A, magma_int_t lda,
+    magma_int_t ntile, magma_int_t mstride, magma_int_t nstride);
+
+void magma_strttf_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float *ARF,
+    magma_int_t *info);
+
+void magma_stfttr_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const float *ARF,
+    float *A, magma_int_t lda,
+    magma_int_t *info);
+
+void magma_strttp_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float *AP,
+    magma_int_t *info);
+
+void magma_stpttr_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const float *AP,
+    float *A, magma_int_t lda,
+    magma_int_t *info);
+
+void magma_strtri_diag_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    const float *A, magma_int_t lda,
+    float *invA);
+
+void magma_strsm_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    float alpha,
+    const float *A, magma_int_t lda,
+    const float *invA,
+    float *B, magma_int_t ldb);
+
+magma_int_t magma_strtri_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    float *A, magma_int_t lda,
+    magma_int_t *info);
+
+magma_int_t magma_sgeqrt3_cpu(
+    magma_int_t m, magma_int_t n,
+    float *A, magma_int_t lda,
+    float *tau,
+    float *T, magma_int_t ldt,
+    magma_int_t *info);
+
+magma_int_t magma_slarfb_cpu(
+    magma_side_t side, magma_trans_t trans, magma_direct_t direct, magma_storev_t storev,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    const float *V, magma_int_t ldv,
+    const float *T, magma_int_t ldt,
+    float *C, magma_int_t ldc);
+
+void magma_sprbt_mv_cpu(
+    magma_int_t n, magma_int_t nrhs,
+    const float *V,
+    float *B, magma_int_t ldb);
+
 #ifdef __cplusplus
 }
 #endif
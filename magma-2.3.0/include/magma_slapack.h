@@ -71,9 +71,11 @@ extern "C" {
 #define lapackf77_sgehrd   FORTRAN_NAME( sgehrd, SGEHRD )
 #define lapackf77_sgelqf   FORTRAN_NAME( sgelqf, SGELQF )
 #define lapackf77_sgels    FORTRAN_NAME( sgels,  SGELS  )
+#define lapackf77_sgemqrt  FORTRAN_NAME( sgemqrt, SGEMQRT )
 #define lapackf77_sgeqlf   FORTRAN_NAME( sgeqlf, SGEQLF )
 #define lapackf77_sgeqp3   FORTRAN_NAME( sgeqp3, SGEQP3 )
 #define lapackf77_sgeqrf   FORTRAN_NAME( sgeqrf, SGEQRF )
+#define lapackf77_sgeqrt   FORTRAN_NAME( sgeqrt, SGEQRT )
 #define lapackf77_sgesdd   FORTRAN_NAME( sgesdd, SGESDD )
 #define lapackf77_sgesv    FORTRAN_NAME( sgesv,  SGESV  )
 #define lapackf77_sgesvd   FORTRAN_NAME( sgesvd, SGESVD )
@@ -128,6 +130,7 @@ extern "C" {
 #define lapackf77_spotrf   FORTRAN_NAME( spotrf, SPOTRF )
 #define lapackf77_spotri   FORTRAN_NAME( spotri, SPOTRI )
 #define lapackf77_spotrs   FORTRAN_NAME( spotrs, SPOTRS )
+#define lapackf77_spptrf   FORTRAN_NAME( spptrf, SPPTRF )
 #define lapackf77_sstedc   FORTRAN_NAME( sstedc, SSTEDC )
 #define lapackf77_sstein   FORTRAN_NAME( sstein, SSTEIN )
 #define lapackf77_sstemr   FORTRAN_NAME( sstemr, SSTEMR )
@@ -135,9 +138,15 @@ extern "C" {
 #define lapackf77_ssymv    FORTRAN_NAME( ssymv,  SSYMV  )
 #define lapackf77_ssyr     FORTRAN_NAME( ssyr,   SSYR   )
 #define lapackf77_ssysv    FORTRAN_NAME( ssysv,  SSYSV  )
+#define lapackf77_stfttr   FORTRAN_NAME( stfttr, STFTTR )
+#define lapackf77_stpmqrt  FORTRAN_NAME( stpmqrt, STPMQRT )
+#define lapackf77_stpqrt   FORTRAN_NAME( stpqrt, STPQRT )
+#define lapackf77_stpttr   FORTRAN_NAME( stpttr, STPTTR )
 #define lapackf77_strevc   FORTRAN_NAME( strevc, STREVC )
 #define lapackf77_strevc3  FORTRAN_NAME( strevc3, STREVC3 )
 #define lapackf77_strtri   FORTRAN_NAME( strtri, STRTRI )
+#define lapackf77_strttf   FORTRAN_NAME( strttf, STRTTF )
+#define lapackf77_strttp   FORTRAN_NAME( strttp, STRTTP )
 #define lapackf77_sorg2r   FORTRAN_NAME( sorg2r, SORG2R )
 #define lapackf77_sorgbr   FORTRAN_NAME( sorgbr, SORGBR )
 #define lapackf77_sorghr   FORTRAN_NAME( sorghr, SORGHR )
@@ -466,6 +475,15 @@ void   lapackf77_sgels(  const char *trans,
                          float *work, const magma_int_t *lwork,
                          magma_int_t *info );
 
+void   lapackf77_sgemqrt( const char *side, const char *trans,
+                         const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
+                         const magma_int_t *nb,
+                         const float *V, const magma_int_t *ldv,
+                         const float *T, const magma_int_t *ldt,
+                         float *C, const magma_int_t *ldc,
+                         float *work,
+                         magma_int_t *info );
+
 void   lapackf77_sgeqlf( const magma_int_t *m, const magma_int_t *n,
                          float *A, const magma_int_t *lda,
                          float *tau,
@@ -488,6 +506,12 @@ void   lapackf77_sgeqrf( const magma_int_t *m, const magma_int_t *n,
                          float *work, const magma_int_t *lwork,
                          magma_int_t *info );
 
+void   lapackf77_sgeqrt( const magma_int_t *m, const magma_int_t *n, const magma_int_t *nb,
+                         float *A, const magma_int_t *lda,
+                         float *T, const magma_int_t *ldt,
+                         float *work,
+                         magma_int_t *info );
+
 void   lapackf77_sgesdd( const char *jobz,
                          const magma_int_t *m, const magma_int_t *n,
                          float *A, const magma_int_t *lda,
@@ -872,6 +896,11 @@ void   lapackf77_spotrs( const char *uplo,
                          float *B, const magma_int_t *ldb,
                          magma_int_t *info );
 
+void   lapackf77_spptrf( const char *uplo,
+                         const magma_int_t *n,
+                         float *AP,
+                         magma_int_t *info );
+
 void   lapackf77_sstedc( const char *compz,
                          const magma_int_t *n,
                          float *d, float *e,
@@ -937,6 +966,36 @@ void   lapackf77_ssysv(  const char *uplo,
 
 #endif
 
+void   lapackf77_stfttr( const char *transr, const char *uplo,
+                         const magma_int_t *n,
+                         const float *ARF,
+                         float *A, const magma_int_t *lda,
+                         magma_int_t *info );
+
+void   lapackf77_stpmqrt( const char *side, const char *trans,
+                         const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
+                         const magma_int_t *l, const magma_int_t *nb,
+                         const float *V, const magma_int_t *ldv,
+                         const float *T, const magma_int_t *ldt,
+                         float *A, const magma_int_t *lda,
+                         float *B, const magma_int_t *ldb,
+                         float *work,
+                         magma_int_t *info );
+
+void   lapackf77_stpqrt( const magma_int_t *m, const magma_int_t *n,
+                         const magma_int_t *l, const magma_int_t *nb,
+                         float *A, const magma_int_t *lda,
+                         float *B, const magma_int_t *ldb,
+                         float *T, const magma_int_t *ldt,
+                         float *work,
+                         magma_int_t *info );
+
+void   lapackf77_stpttr( const char *uplo,
+                         const magma_int_t *n,
+                         const float *AP,
+                         float *A, const magma_int_t *lda,
+                         magma_int_t *info );
+
 void   lapackf77_strevc( const char *side, const char *howmny,
                          // select is [in] for real; [in,out] for real
                          #ifdef COMPLEX
@@ -975,6 +1034,18 @@ void   lapackf77_strtri( const char *uplo, const char *diag,
                          float *A, const magma_int_t *lda,
                          magma_int_t *info );
 
+void   lapackf77_strttf( const char *transr, const char *uplo,
+                         const magma_int_t *n,
+                         const float *A, const magma_int_t *lda,
+                         float *ARF,
+                         magma_int_t *info );
+
+void   lapackf77_strttp( const char *uplo,
+                         const magma_int_t *n,
+                         const float *A, const magma_int_t *lda,
+                         float *AP,
+                         magma_int_t *info );
+
 void   lapackf77_sorg2r( const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
                          float *A, const magma_int_t *lda,
                          const float *tau,
@@ -650,6 +650,41 @@ magmablas_slacpy_vbatched(
    */    
 magma_int_t magma_get_spotrf_vbatched_crossover();
 
+  /*
+   *  LAPACK vbatched routines on the CPU host
+   */
+magma_int_t
+magma_spotrf_vbatched_cpu(
+    magma_uplo_t uplo, magma_int_t *n,
+    float **A_array, magma_int_t *lda,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_sgetrf_vbatched_cpu(
+    magma_int_t *m, magma_int_t *n,
+    float **A_array, magma_int_t *lda,
+    magma_int_t **ipiv_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_sgeqrf_vbatched_cpu(
+    magma_int_t *m, magma_int_t *n,
+    float **A_array, magma_int_t *lda,
+    float **tau_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+  /*
+   *  BLAS vbatched routines on the CPU host
+   */
+void
+magma_strsm_vbatched_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t *m, magma_int_t *n,
+    float alpha,
+    float **A_array, magma_int_t *lda,
+    float **B_array, magma_int_t *ldb,
+    magma_int_t batchCount );
+
 #ifdef __cplusplus
 }
 #endif
@@ -12,6 +12,11 @@
 #include <stdint.h>
 #include <assert.h>
 
+// the distributed-memory drivers, magma_*_dist, take an MPI communicator
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
 
 // for backwards compatability
 #ifdef HAVE_clAmdBlas
@@ -19,7 +24,7 @@
 #endif
 
 // each implementation of MAGMA defines HAVE_* appropriately.
-#if ! defined(HAVE_CUBLAS) && ! defined(HAVE_clBLAS) && ! defined(HAVE_MIC)
+#if ! defined(HAVE_CUBLAS) && ! defined(HAVE_clBLAS) && ! defined(HAVE_MIC) && ! defined(HAVE_HOST)
 #define HAVE_CUBLAS
 #endif
 
@@ -190,11 +195,110 @@ typedef double real_Double_t;
     #define MAGMA_C_ABS1(a)       (fabs((a).real()) + fabs((a).imag()))
     #define MAGMA_C_CONJ(a)       conj(a)
 
+    #ifdef __cplusplus
+    }
+    #endif
+#elif defined(HAVE_HOST)
+    // host backend: the "device" is a group of CPU cores, device memory is
+    // ordinary (NUMA-local) host memory, and each queue is a worker thread
+    // executing its tasks in order. See interface_host/interface.cpp.
+
+    // CUDA function qualifiers used in inline functions of MAGMA headers
+    #ifndef __host__
+    #define __host__
+    #endif
+    #ifndef __device__
+    #define __device__
+    #endif
+
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    // opaque queue and event structures
+    struct magma_queue;
+    struct magma_event;
+    typedef struct magma_queue* magma_queue_t;
+    typedef struct magma_event* magma_event_t;
+    typedef magma_int_t         magma_device_t;
+
+    // same layout as cuDoubleComplex and Fortran COMPLEX*16,
+    // so MAGMA_Z_REAL etc. work the same as with CUDA
+    typedef struct { double x, y; } magmaDoubleComplex;
+    typedef struct { float  x, y; } magmaFloatComplex;
+
+    static inline magmaDoubleComplex magma_host_zmake( double r, double i )
+    {
+        magmaDoubleComplex z;
+        z.x = r;
+        z.y = i;
+        return z;
+    }
+
+    static inline magmaDoubleComplex magma_host_zmul( magmaDoubleComplex a, magmaDoubleComplex b )
+    {
+        return magma_host_zmake( a.x*b.x - a.y*b.y, a.x*b.y + a.y*b.x );
+    }
+
+    // scaled division, as in cuCdiv, to avoid unnecessary overflow
+    static inline magmaDoubleComplex magma_host_zdiv( magmaDoubleComplex a, magmaDoubleComplex b )
+    {
+        double s  = (b.x < 0 ? -b.x : b.x) + (b.y < 0 ? -b.y : b.y);
+        double ar = a.x / s, ai = a.y / s;
+        double br = b.x / s, bi = b.y / s;
+        double t  = 1.0 / (br*br + bi*bi);
+        return magma_host_zmake( (ar*br + ai*bi)*t, (ai*br - ar*bi)*t );
+    }
+
+    static inline magmaFloatComplex magma_host_cmake( float r, float i )
+    {
+        magmaFloatComplex c;
+        c.x = r;
+        c.y = i;
+        return c;
+    }
+
+    static inline magmaFloatComplex magma_host_cmul( magmaFloatComplex a, magmaFloatComplex b )
+    {
+        return magma_host_cmake( a.x*b.x - a.y*b.y, a.x*b.y + a.y*b.x );
+    }
+
+    static inline magmaFloatComplex magma_host_cdiv( magmaFloatComplex a, magmaFloatComplex b )
+    {
+        float s  = (b.x < 0 ? -b.x : b.x) + (b.y < 0 ? -b.y : b.y);
+        float ar = a.x / s, ai = a.y / s;
+        float br = b.x / s, bi = b.y / s;
+        float t  = 1.0f / (br*br + bi*bi);
+        return magma_host_cmake( (ar*br + ai*bi)*t, (ai*br - ar*bi)*t );
+    }
+
+    #define MAGMA_Z_MAKE(r,i)     magma_host_zmake(r, i)
+    #define MAGMA_Z_REAL(a)       (a).x
+    #define MAGMA_Z_IMAG(a)       (a).y
+    #define MAGMA_Z_ADD(a, b)     MAGMA_Z_MAKE((a).x + (b).x, (a).y + (b).y)
+    #define MAGMA_Z_SUB(a, b)     MAGMA_Z_MAKE((a).x - (b).x, (a).y - (b).y)
+    #define MAGMA_Z_MUL(a, b)     magma_host_zmul(a, b)
+    #define MAGMA_Z_DIV(a, b)     magma_host_zdiv(a, b)
+    #define MAGMA_Z_ABS(a)        magma_cabs(a)
+    #define MAGMA_Z_ABS1(a)       (fabs((a).x) + fabs((a).y))
+    #define MAGMA_Z_CONJ(a)       MAGMA_Z_MAKE((a).x, -(a).y)
+
+    #define MAGMA_C_MAKE(r,i)     magma_host_cmake(r, i)
+    #define MAGMA_C_REAL(a)       (a).x
+    #define MAGMA_C_IMAG(a)       (a).y
+    #define MAGMA_C_ADD(a, b)     MAGMA_C_MAKE((a).x + (b).x, (a).y + (b).y)
+    #define MAGMA_C_SUB(a, b)     MAGMA_C_MAKE((a).x - (b).x, (a).y - (b).y)
+    #define MAGMA_C_MUL(a, b)     magma_host_cmul(a, b)
+    #define MAGMA_C_DIV(a, b)     magma_host_cdiv(a, b)
+    #define MAGMA_C_ABS(a)        magma_cabsf(a)
+    #define MAGMA_C_ABS1(a)       (fabsf((a).x) + fabsf((a).y))
+    #define MAGMA_C_CONJ(a)       MAGMA_C_MAKE((a).x, -(a).y)
+
     #ifdef __cplusplus
     }
     #endif
 #else
-    #error "One of HAVE_CUBLAS, HAVE_clBLAS, or HAVE_MIC must be defined. For example, add -DHAVE_CUBLAS to CFLAGS, or #define HAVE_CUBLAS before #include <magma.h>. In MAGMA, this happens in Makefile."
+    #error "One of HAVE_CUBLAS, HAVE_clBLAS, HAVE_MIC, or HAVE_HOST must be defined. For example, add -DHAVE_CUBLAS to CFLAGS, or #define HAVE_CUBLAS before #include <magma.h>. In MAGMA, this happens in Makefile."
 #endif
 
 #ifdef __cplusplus
@@ -265,6 +369,11 @@ extern "C" {
 double magma_cabs ( magmaDoubleComplex x );
 float  magma_cabsf( magmaFloatComplex  x );
 
+// 16-bit storage formats, used by magma_slag2h_cpu and friends;
+// values are bit patterns, not arithmetic types
+typedef unsigned short magmaHalf;      // IEEE binary16
+typedef unsigned short magmaBfloat16;  // bfloat16, upper half of a float
+
 #if defined(HAVE_clBLAS)
     // OpenCL uses opaque memory references on GPU
     typedef cl_mem magma_ptr;
@@ -304,6 +413,23 @@ float  magma_cabsf( magmaFloatComplex  x );
 #endif
 
 
+// =============================================================================
+// 2D block-cyclic distribution
+
+// Describes an m-by-n matrix distributed in mb-by-nb tiles over a p-by-q
+// grid of participants (devices, NUMA nodes with the host backend, or MPI
+// ranks with the magma_*_dist drivers), 2D block cyclic, as in ScaLAPACK. Participant d = pr + pc*p, at row pr
+// and column pc of the grid, stores its tiles in a local column-major
+// matrix with leading dimension ldd. See control/bcyclic.cpp.
+typedef struct magma_bcyclic
+{
+    magma_int_t m, n;    ///< global size
+    magma_int_t mb, nb;  ///< tile size
+    magma_int_t p, q;    ///< grid of p*q participants
+    magma_int_t ldd;     ///< leading dimension of the local matrices
+} magma_bcyclic_t;
+
+
 // =============================================================================
 // MAGMA constants
 
@@ -340,7 +466,7 @@ float  magma_cabsf( magmaFloatComplex  x );
 #define MAGMA_ERR_ALLOCATION       -106     // unused
 #define MAGMA_ERR_INTERNAL_LIMIT   -107     // unused
 #define MAGMA_ERR_UNALLOCATED      -108     // unused
-#define MAGMA_ERR_FILESYSTEM       -109     // unused
+#define MAGMA_ERR_FILESYSTEM       -109     ///< file read or write failed
 #define MAGMA_ERR_UNEXPECTED       -110     // unused
 #define MAGMA_ERR_SEQUENCE_FLUSHED -111     // unused
 #define MAGMA_ERR_HOST_ALLOC       -112     ///< could not malloc CPU host memory
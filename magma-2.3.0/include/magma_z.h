@@ -97,6 +97,25 @@ magma_zgebrd(
     magmaDoubleComplex *work, magma_int_t lwork,
     magma_int_t *info);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+magma_int_t
+magma_dgebrd_ge2gb_cpu(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    double *A, magma_int_t lda,
+    double *tauq, double *taup,
+    magma_int_t *info);
+
+magma_int_t
+magma_dgebrd_gb2bd_cpu(
+    magma_int_t n, magma_int_t nb, magma_int_t Vblksiz,
+    const double *A, magma_int_t lda,
+    double *d, double *e,
+    double *VQ, double *TAUQ,
+    double *VP, double *TAUP, magma_int_t ldv,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_zgeev(
     magma_vec_t jobvl, magma_vec_t jobvr, magma_int_t n,
@@ -168,6 +187,14 @@ magma_zgehrd2(
     magmaDoubleComplex *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_zgehrd_cpu(
+    magma_int_t n, magma_int_t ilo, magma_int_t ihi,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *tau,
+    magmaDoubleComplex *work, magma_int_t lwork,
+    magma_int_t *info);
+
 magma_int_t
 magma_zgelqf(
     magma_int_t m, magma_int_t n,
@@ -321,6 +348,14 @@ magma_zgeqrf_m(
     magmaDoubleComplex *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_zgeqrf_disk(
+    magma_int_t m, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    magmaDoubleComplex *tau,
+    magmaDoubleComplex *work, magma_int_t lwork,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_zgeqrf_ooc(
@@ -330,6 +365,13 @@ magma_zgeqrf_ooc(
     magmaDoubleComplex *work, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_zgeqrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    magmaDoubleComplex *A,
+    magmaDoubleComplex *T,
+    magma_int_t *info);
+
 magma_int_t
 magma_zgeqrf2_gpu(
     magma_int_t m, magma_int_t n,
@@ -375,6 +417,14 @@ magma_zgeqrs3_gpu(
     magmaDoubleComplex *hwork, magma_int_t lwork,
     magma_int_t *info);
 
+magma_int_t
+magma_zgerbt_cpu(
+    magma_bool_t gen, magma_int_t n, magma_int_t nrhs,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *B, magma_int_t ldb,
+    magmaDoubleComplex *U, magmaDoubleComplex *V,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_zgerbt_gpu(
@@ -395,6 +445,17 @@ magma_zgerfs_nopiv_gpu(
     magma_int_t *iter,
     magma_int_t *info);
 
+magma_int_t
+magma_zgerfs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    const magmaDoubleComplex *B, magma_int_t ldb,
+    magmaDoubleComplex *X, magma_int_t ldx,
+    magmaDoubleComplex *work,
+    const magmaDoubleComplex *AF,
+    magma_int_t *iter,
+    magma_int_t *info);
+
 magma_int_t
 magma_zgesdd(
     magma_vec_t jobz, magma_int_t m, magma_int_t n,
@@ -409,6 +470,18 @@ magma_zgesdd(
     magma_int_t *iwork,
     magma_int_t *info);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+magma_int_t
+magma_dgesdd_2stage_cpu(
+    magma_vec_t jobz, magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda,
+    double *s,
+    double *U, magma_int_t ldu,
+    double *VT, magma_int_t ldvt,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_zgesv(
     magma_int_t n, magma_int_t nrhs,
@@ -440,6 +513,13 @@ magma_zgesv_rbt(
     magmaDoubleComplex *B, magma_int_t ldb,
     magma_int_t *info);
 
+magma_int_t
+magma_zgesv_rbt_cpu(
+    magma_bool_t refine, magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *B, magma_int_t ldb,
+    magma_int_t *info);
+
 magma_int_t
 magma_zgesvd(
     magma_vec_t jobu, magma_vec_t jobvt, magma_int_t m, magma_int_t n,
@@ -475,6 +555,17 @@ magma_zgetrf(
     magma_int_t *ipiv,
     magma_int_t *info);
 
+// MPI builds only
+#if defined(HAVE_MPI)
+magma_int_t
+magma_zgetrf_dist(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex *A, const magma_bcyclic_t *desc,
+    magma_int_t *ipiv,
+    MPI_Comm comm,
+    magma_int_t *info);
+#endif
+
 magma_int_t
 magma_zgetrf_gpu(
     magma_int_t m, magma_int_t n,
@@ -499,6 +590,13 @@ magma_zgetrf_mgpu(
     magma_int_t *ipiv,
     magma_int_t *info);
 
+magma_int_t
+magma_zgetrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    magmaDoubleComplex *A,
+    magma_int_t *ipiv,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_zgetrf2(
@@ -532,6 +630,12 @@ magma_zgetrf_nopiv_gpu(
     magmaDoubleComplex_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_zgetrf_nopiv_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    magmaDoubleComplex *A,
+    magma_int_t *info);
+
 magma_int_t
 magma_zgetri_gpu(
     magma_int_t n,
@@ -556,6 +660,13 @@ magma_zgetrs_nopiv_gpu(
     magmaDoubleComplex_ptr dB, magma_int_t lddb,
     magma_int_t *info);
 
+magma_int_t
+magma_zgetrs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const magmaDoubleComplex *A,
+    magmaDoubleComplex *B, magma_int_t ldb,
+    magma_int_t *info);
+
 // ------------------------------------------------------------ zhe routines
 magma_int_t
 magma_zheevd(
@@ -994,6 +1105,12 @@ magma_zhetrf_aasen(
     magmaDoubleComplex *A, magma_int_t lda,
     magma_int_t *ipiv, magma_int_t *info);
 
+magma_int_t
+magma_zhetrf_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magma_int_t *ipiv, magma_int_t *info);
+
 magma_int_t
 magma_zhetrf_nopiv(
     magma_uplo_t uplo, magma_int_t n,
@@ -1012,6 +1129,14 @@ magma_zhetrf_nopiv_gpu(
     magmaDoubleComplex_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_zhetrs_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    const magma_int_t *ipiv,
+    magmaDoubleComplex *B, magma_int_t ldb,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_zhetrs_nopiv_gpu(
@@ -1334,6 +1459,23 @@ magma_zpotrf_gpu(
     magmaDoubleComplex_ptr dA, magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_zpotrf_disk(
+    magma_uplo_t uplo, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    magmaDoubleComplex *work, magma_int_t lwork,
+    magma_int_t *info);
+
+// MPI builds only
+#if defined(HAVE_MPI)
+magma_int_t
+magma_zpotrf_dist(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDoubleComplex *A, const magma_bcyclic_t *desc,
+    MPI_Comm comm,
+    magma_int_t *info);
+#endif
+
 // CUDA MAGMA only
 magma_int_t
 magma_zpotrf_m(
@@ -1357,6 +1499,12 @@ magma_zpotrf_mgpu_right(
     magmaDoubleComplex_ptr d_lA[], magma_int_t ldda,
     magma_int_t *info);
 
+magma_int_t
+magma_zpotrf_tile(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nb,
+    magmaDoubleComplex *A,
+    magma_int_t *info);
+
 // CUDA MAGMA only
 magma_int_t
 magma_zpotrf3_mgpu(
@@ -1388,6 +1536,12 @@ magma_zpotrs_gpu(
     magmaDoubleComplex_ptr dB, magma_int_t lddb,
     magma_int_t *info);
 
+magma_int_t
+magma_zpptrf_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDoubleComplex *AP,
+    magma_int_t *info);
+
 // ------------------------------------------------------------ zsy routines
 #ifdef COMPLEX
 // CUDA MAGMA only
@@ -1740,6 +1894,137 @@ void magma_zq_to_panel(
     magmaDoubleComplex *A, magma_int_t lda,
     magmaDoubleComplex *work);
 
+void magma_zge2tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *T);
+
+void magma_ztile2ge(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    const magmaDoubleComplex *T,
+    magmaDoubleComplex *A, magma_int_t lda);
+
+void magma_ztranspose_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *AT, magma_int_t ldat);
+
+#ifdef COMPLEX
+void magma_ztranspose_conj_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *AT, magma_int_t ldat);
+#endif
+
+void magma_ztranspose_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex *A, magma_int_t lda);
+
+#ifdef COMPLEX
+void magma_ztranspose_conj_inplace_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex *A, magma_int_t lda);
+#endif
+
+double magma_zlange_cpu(
+    magma_norm_t norm, magma_int_t m, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda);
+
+magma_int_t magma_zlange_all_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    double values[4]);
+
+double magma_zlanhe_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda);
+
+magma_int_t magma_zlanhe_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    double values[4]);
+
+#ifdef COMPLEX
+double magma_zlansy_cpu(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda);
+
+magma_int_t magma_zlansy_all_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    double values[4]);
+#endif
+
+void magma_zsymmetrize_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaDoubleComplex *A, magma_int_t lda);
+
+void magma_zsymmetrize_tiles_cpu(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magma_int_t ntile, magma_int_t mstride, magma_int_t nstride);
+
+void magma_ztrttf_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *ARF,
+    magma_int_t *info);
+
+void magma_ztfttr_cpu(
+    magma_trans_t transr, magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *ARF,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magma_int_t *info);
+
+void magma_ztrttp_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *AP,
+    magma_int_t *info);
+
+void magma_ztpttr_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *AP,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magma_int_t *info);
+
+void magma_ztrtri_diag_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *invA);
+
+void magma_ztrsm_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    const magmaDoubleComplex *invA,
+    magmaDoubleComplex *B, magma_int_t ldb);
+
+magma_int_t magma_ztrtri_cpu(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magma_int_t *info);
+
+magma_int_t magma_zgeqrt3_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *tau,
+    magmaDoubleComplex *T, magma_int_t ldt,
+    magma_int_t *info);
+
+magma_int_t magma_zlarfb_cpu(
+    magma_side_t side, magma_trans_t trans, magma_direct_t direct, magma_storev_t storev,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    const magmaDoubleComplex *V, magma_int_t ldv,
+    const magmaDoubleComplex *T, magma_int_t ldt,
+    magmaDoubleComplex *C, magma_int_t ldc);
+
+void magma_zprbt_mv_cpu(
+    magma_int_t n, magma_int_t nrhs,
+    const magmaDoubleComplex *V,
+    magmaDoubleComplex *B, magma_int_t ldb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -968,6 +968,41 @@ magma_zpotrf_v33_batched(
     magma_int_t *info_array,
     magma_int_t batchCount, magma_queue_t queue);
 
+  /*
+   *  LAPACK batched routines on the CPU host
+   */
+magma_int_t
+magma_zpotrf_batched_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDoubleComplex **A_array, magma_int_t lda,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_zgetrf_batched_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex **A_array, magma_int_t lda,
+    magma_int_t **ipiv_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+magma_int_t
+magma_zgeqrf_batched_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex **A_array, magma_int_t lda,
+    magmaDoubleComplex **tau_array,
+    magma_int_t *info_array, magma_int_t batchCount );
+
+  /*
+   *  BLAS batched routines on the CPU host
+   */
+void
+magma_ztrsm_batched_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex **A_array, magma_int_t lda,
+    magmaDoubleComplex **B_array, magma_int_t ldb,
+    magma_int_t batchCount );
+
 // for debugging purpose
 void 
 zset_stepinit_ipiv(
@@ -126,6 +126,39 @@ magma_zhbtype3cb(magma_int_t n, magma_int_t nb,
                 magma_int_t Vblksiz, magma_int_t wantz,
                 magmaDoubleComplex *work);
 
+#ifdef REAL
+// only applicable to real [sd] precisions
+void
+magma_dgbtype1cb(magma_int_t n, magma_int_t nb,
+                double *A, magma_int_t lda,
+                double *VQ, double *TAUQ,
+                double *VP, double *TAUP,
+                magma_int_t ldv,
+                magma_int_t st, magma_int_t ed, magma_int_t sweep,
+                magma_int_t Vblksiz,
+                double *work);
+
+void
+magma_dgbtype2cb(magma_int_t n, magma_int_t nb,
+                double *A, magma_int_t lda,
+                double *VQ, double *TAUQ,
+                double *VP, double *TAUP,
+                magma_int_t ldv,
+                magma_int_t st, magma_int_t ed, magma_int_t sweep,
+                magma_int_t Vblksiz,
+                double *work);
+
+void
+magma_dgbtype3cb(magma_int_t n, magma_int_t nb,
+                double *A, magma_int_t lda,
+                double *VQ, double *TAUQ,
+                double *VP, double *TAUP,
+                magma_int_t ldv,
+                magma_int_t st, magma_int_t ed, magma_int_t sweep,
+                magma_int_t Vblksiz,
+                double *work);
+#endif
+
 
 magma_int_t
 magma_zunmqr_2stage_gpu(
@@ -76,6 +76,36 @@ magma_zcposv_gpu(
     magma_int_t *iter,
     magma_int_t *info);
 
+// -----------------------------------------------------------------------------
+// CPU conversions, in control/zlag2c_cpu.cpp
+void
+magma_zlag2c_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaFloatComplex *SA,       magma_int_t ldsa,
+    magma_int_t *info);
+
+void
+magma_clag2z_cpu(
+    magma_int_t m, magma_int_t n,
+    const magmaFloatComplex *SA, magma_int_t ldsa,
+    magmaDoubleComplex *A,       magma_int_t lda,
+    magma_int_t *info);
+
+void
+magma_zlat2c_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    magmaFloatComplex *SA,       magma_int_t ldsa,
+    magma_int_t *info);
+
+void
+magma_clat2z_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    const magmaFloatComplex *SA, magma_int_t ldsa,
+    magmaDoubleComplex *A,       magma_int_t lda,
+    magma_int_t *info);
+
 #ifdef __cplusplus
 }
 #endif
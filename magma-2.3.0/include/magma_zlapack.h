@@ -71,9 +71,11 @@ extern "C" {
 #define lapackf77_zgehrd   FORTRAN_NAME( zgehrd, ZGEHRD )
 #define lapackf77_zgelqf   FORTRAN_NAME( zgelqf, ZGELQF )
 #define lapackf77_zgels    FORTRAN_NAME( zgels,  ZGELS  )
+#define lapackf77_zgemqrt  FORTRAN_NAME( zgemqrt, ZGEMQRT )
 #define lapackf77_zgeqlf   FORTRAN_NAME( zgeqlf, ZGEQLF )
 #define lapackf77_zgeqp3   FORTRAN_NAME( zgeqp3, ZGEQP3 )
 #define lapackf77_zgeqrf   FORTRAN_NAME( zgeqrf, ZGEQRF )
+#define lapackf77_zgeqrt   FORTRAN_NAME( zgeqrt, ZGEQRT )
 #define lapackf77_zgesdd   FORTRAN_NAME( zgesdd, ZGESDD )
 #define lapackf77_zgesv    FORTRAN_NAME( zgesv,  ZGESV  )
 #define lapackf77_zgesvd   FORTRAN_NAME( zgesvd, ZGESVD )
@@ -128,6 +130,7 @@ extern "C" {
 #define lapackf77_zpotrf   FORTRAN_NAME( zpotrf, ZPOTRF )
 #define lapackf77_zpotri   FORTRAN_NAME( zpotri, ZPOTRI )
 #define lapackf77_zpotrs   FORTRAN_NAME( zpotrs, ZPOTRS )
+#define lapackf77_zpptrf   FORTRAN_NAME( zpptrf, ZPPTRF )
 #define lapackf77_zstedc   FORTRAN_NAME( zstedc, ZSTEDC )
 #define lapackf77_zstein   FORTRAN_NAME( zstein, ZSTEIN )
 #define lapackf77_zstemr   FORTRAN_NAME( zstemr, ZSTEMR )
@@ -135,9 +138,15 @@ extern "C" {
 #define lapackf77_zsymv    FORTRAN_NAME( zsymv,  ZSYMV  )
 #define lapackf77_zsyr     FORTRAN_NAME( zsyr,   ZSYR   )
 #define lapackf77_zsysv    FORTRAN_NAME( zsysv,  ZSYSV  )
+#define lapackf77_ztfttr   FORTRAN_NAME( ztfttr, ZTFTTR )
+#define lapackf77_ztpmqrt  FORTRAN_NAME( ztpmqrt, ZTPMQRT )
+#define lapackf77_ztpqrt   FORTRAN_NAME( ztpqrt, ZTPQRT )
+#define lapackf77_ztpttr   FORTRAN_NAME( ztpttr, ZTPTTR )
 #define lapackf77_ztrevc   FORTRAN_NAME( ztrevc, ZTREVC )
 #define lapackf77_ztrevc3  FORTRAN_NAME( ztrevc3, ZTREVC3 )
 #define lapackf77_ztrtri   FORTRAN_NAME( ztrtri, ZTRTRI )
+#define lapackf77_ztrttf   FORTRAN_NAME( ztrttf, ZTRTTF )
+#define lapackf77_ztrttp   FORTRAN_NAME( ztrttp, ZTRTTP )
 #define lapackf77_zung2r   FORTRAN_NAME( zung2r, ZUNG2R )
 #define lapackf77_zungbr   FORTRAN_NAME( zungbr, ZUNGBR )
 #define lapackf77_zunghr   FORTRAN_NAME( zunghr, ZUNGHR )
@@ -466,6 +475,15 @@ void   lapackf77_zgels(  const char *trans,
                          magmaDoubleComplex *work, const magma_int_t *lwork,
                          magma_int_t *info );
 
+void   lapackf77_zgemqrt( const char *side, const char *trans,
+                         const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
+                         const magma_int_t *nb,
+                         const magmaDoubleComplex *V, const magma_int_t *ldv,
+                         const magmaDoubleComplex *T, const magma_int_t *ldt,
+                         magmaDoubleComplex *C, const magma_int_t *ldc,
+                         magmaDoubleComplex *work,
+                         magma_int_t *info );
+
 void   lapackf77_zgeqlf( const magma_int_t *m, const magma_int_t *n,
                          magmaDoubleComplex *A, const magma_int_t *lda,
                          magmaDoubleComplex *tau,
@@ -488,6 +506,12 @@ void   lapackf77_zgeqrf( const magma_int_t *m, const magma_int_t *n,
                          magmaDoubleComplex *work, const magma_int_t *lwork,
                          magma_int_t *info );
 
+void   lapackf77_zgeqrt( const magma_int_t *m, const magma_int_t *n, const magma_int_t *nb,
+                         magmaDoubleComplex *A, const magma_int_t *lda,
+                         magmaDoubleComplex *T, const magma_int_t *ldt,
+                         magmaDoubleComplex *work,
+                         magma_int_t *info );
+
 void   lapackf77_zgesdd( const char *jobz,
                          const magma_int_t *m, const magma_int_t *n,
                          magmaDoubleComplex *A, const magma_int_t *lda,
@@ -872,6 +896,11 @@ void   lapackf77_zpotrs( const char *uplo,
                          magmaDoubleComplex *B, const magma_int_t *ldb,
                          magma_int_t *info );
 
+void   lapackf77_zpptrf( const char *uplo,
+                         const magma_int_t *n,
+                         magmaDoubleComplex *AP,
+                         magma_int_t *info );
+
 void   lapackf77_zstedc( const char *compz,
                          const magma_int_t *n,
                          double *d, double *e,
@@ -937,6 +966,36 @@ void   lapackf77_zsysv(  const char *uplo,
 
 #endif
 
+void   lapackf77_ztfttr( const char *transr, const char *uplo,
+                         const magma_int_t *n,
+                         const magmaDoubleComplex *ARF,
+                         magmaDoubleComplex *A, const magma_int_t *lda,
+                         magma_int_t *info );
+
+void   lapackf77_ztpmqrt( const char *side, const char *trans,
+                         const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
+                         const magma_int_t *l, const magma_int_t *nb,
+                         const magmaDoubleComplex *V, const magma_int_t *ldv,
+                         const magmaDoubleComplex *T, const magma_int_t *ldt,
+                         magmaDoubleComplex *A, const magma_int_t *lda,
+                         magmaDoubleComplex *B, const magma_int_t *ldb,
+                         magmaDoubleComplex *work,
+                         magma_int_t *info );
+
+void   lapackf77_ztpqrt( const magma_int_t *m, const magma_int_t *n,
+                         const magma_int_t *l, const magma_int_t *nb,
+                         magmaDoubleComplex *A, const magma_int_t *lda,
+                         magmaDoubleComplex *B, const magma_int_t *ldb,
+                         magmaDoubleComplex *T, const magma_int_t *ldt,
+                         magmaDoubleComplex *work,
+                         magma_int_t *info );
+
+void   lapackf77_ztpttr( const char *uplo,
+                         const magma_int_t *n,
+                         const magmaDoubleComplex *AP,
+                         magmaDoubleComplex *A, const magma_int_t *lda,
+                         magma_int_t *info );
+
 void   lapackf77_ztrevc( const char *side, const char *howmny,
                          // select is [in] for complex; [in,out] for real
                          #ifdef COMPLEX
@@ -975,6 +1034,18 @@ void   lapackf77_ztrtri( const char *uplo, const char *diag,
                          magmaDoubleComplex *A, const magma_int_t *lda,
                          magma_int_t *info );
 
+void   lapackf77_ztrttf( const char *transr, const char *uplo,
+                         const magma_int_t *n,
+                         const magmaDoubleComplex *A, const magma_int_t *lda,
+                         magmaDoubleComplex *ARF,
+                         magma_int_t *info );
+
+void   lapackf77_ztrttp( const char *uplo,
+                         const magma_int_t *n,
+                         const magmaDoubleComplex *A, const magma_int_t *lda,
+                         magmaDoubleComplex *AP,
+                         magma_int_t *info );
+
 void   lapackf77_zung2r( const magma_int_t *m, const magma_int_t *n, const magma_int_t *k,
                          magmaDoubleComplex *A, const magma_int_t *lda,
                          const magmaDoubleComplex *tau,
@@ -125,6 +125,44 @@ magma_csetmatrix_1D_row_bcyclic(
     magmaFloatComplex_ptr    dA[], magma_int_t ldda,
     magma_queue_t queue[] );
 
+void
+magma_csetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    const magmaFloatComplex *hA, magma_int_t lda,
+    magmaFloatComplex_ptr   dA[],
+    magma_queue_t queues[] );
+
+void
+magma_cgetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    magmaFloatComplex_const_ptr const dA[],
+    magmaFloatComplex                *hA, magma_int_t lda,
+    magma_queue_t queues[] );
+
+void
+magma_credistribute_2D_bcyclic(
+    const magma_bcyclic_t *descA,
+    magmaFloatComplex_const_ptr const dA[],
+    const magma_bcyclic_t *descB,
+    magmaFloatComplex_ptr             dB[],
+    magma_queue_t queues[] );
+
+magma_int_t
+magma_cpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaFloatComplex_const_ptr dA,
+    magmaFloatComplex_ptr       dbuf,
+    magma_queue_t queue );
+
+magma_int_t
+magma_cunpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaFloatComplex_const_ptr dbuf,
+    magmaFloatComplex_ptr       dA,
+    magma_queue_t queue );
+
 void
 magmablas_cgetmatrix_transpose_mgpu(
     magma_int_t ngpu,
@@ -811,6 +849,13 @@ magmablas_ctrsm_work(
     magmaFloatComplex_ptr d_dinvA, magma_int_t dinvA_length,
     magma_queue_t queue );
 
+void
+magmablas_cpotrs_trsm(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue );
+
 
   /*
    * Wrappers for platform independence.
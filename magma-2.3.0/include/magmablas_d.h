@@ -125,6 +125,44 @@ magma_dsetmatrix_1D_row_bcyclic(
     magmaDouble_ptr    dA[], magma_int_t ldda,
     magma_queue_t queue[] );
 
+void
+magma_dsetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    const double *hA, magma_int_t lda,
+    magmaDouble_ptr   dA[],
+    magma_queue_t queues[] );
+
+void
+magma_dgetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    magmaDouble_const_ptr const dA[],
+    double                *hA, magma_int_t lda,
+    magma_queue_t queues[] );
+
+void
+magma_dredistribute_2D_bcyclic(
+    const magma_bcyclic_t *descA,
+    magmaDouble_const_ptr const dA[],
+    const magma_bcyclic_t *descB,
+    magmaDouble_ptr             dB[],
+    magma_queue_t queues[] );
+
+magma_int_t
+magma_dpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaDouble_const_ptr dA,
+    magmaDouble_ptr       dbuf,
+    magma_queue_t queue );
+
+magma_int_t
+magma_dunpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaDouble_const_ptr dbuf,
+    magmaDouble_ptr       dA,
+    magma_queue_t queue );
+
 void
 magmablas_dgetmatrix_transpose_mgpu(
     magma_int_t ngpu,
@@ -811,6 +849,13 @@ magmablas_dtrsm_work(
     magmaDouble_ptr d_dinvA, magma_int_t dinvA_length,
     magma_queue_t queue );
 
+void
+magmablas_dpotrs_trsm(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue );
+
 
   /*
    * Wrappers for platform independence.
@@ -125,6 +125,44 @@ magma_ssetmatrix_1D_row_bcyclic(
     magmaFloat_ptr    dA[], magma_int_t ldda,
     magma_queue_t queue[] );
 
+void
+magma_ssetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    const float *hA, magma_int_t lda,
+    magmaFloat_ptr   dA[],
+    magma_queue_t queues[] );
+
+void
+magma_sgetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    magmaFloat_const_ptr const dA[],
+    float                *hA, magma_int_t lda,
+    magma_queue_t queues[] );
+
+void
+magma_sredistribute_2D_bcyclic(
+    const magma_bcyclic_t *descA,
+    magmaFloat_const_ptr const dA[],
+    const magma_bcyclic_t *descB,
+    magmaFloat_ptr             dB[],
+    magma_queue_t queues[] );
+
+magma_int_t
+magma_spackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaFloat_const_ptr dA,
+    magmaFloat_ptr       dbuf,
+    magma_queue_t queue );
+
+magma_int_t
+magma_sunpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaFloat_const_ptr dbuf,
+    magmaFloat_ptr       dA,
+    magma_queue_t queue );
+
 void
 magmablas_sgetmatrix_transpose_mgpu(
     magma_int_t ngpu,
@@ -811,6 +849,13 @@ magmablas_strsm_work(
     magmaFloat_ptr d_dinvA, magma_int_t dinvA_length,
     magma_queue_t queue );
 
+void
+magmablas_spotrs_trsm(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    magmaFloat_const_ptr dA, magma_int_t ldda,
+    magmaFloat_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue );
+
 
   /*
    * Wrappers for platform independence.
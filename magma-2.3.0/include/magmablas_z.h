@@ -125,6 +125,44 @@ magma_zsetmatrix_1D_row_bcyclic(
     magmaDoubleComplex_ptr    dA[], magma_int_t ldda,
     magma_queue_t queue[] );
 
+void
+magma_zsetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    const magmaDoubleComplex *hA, magma_int_t lda,
+    magmaDoubleComplex_ptr   dA[],
+    magma_queue_t queues[] );
+
+void
+magma_zgetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    magmaDoubleComplex_const_ptr const dA[],
+    magmaDoubleComplex                *hA, magma_int_t lda,
+    magma_queue_t queues[] );
+
+void
+magma_zredistribute_2D_bcyclic(
+    const magma_bcyclic_t *descA,
+    magmaDoubleComplex_const_ptr const dA[],
+    const magma_bcyclic_t *descB,
+    magmaDoubleComplex_ptr             dB[],
+    magma_queue_t queues[] );
+
+magma_int_t
+magma_zpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA,
+    magmaDoubleComplex_ptr       dbuf,
+    magma_queue_t queue );
+
+magma_int_t
+magma_zunpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dbuf,
+    magmaDoubleComplex_ptr       dA,
+    magma_queue_t queue );
+
 void
 magmablas_zgetmatrix_transpose_mgpu(
     magma_int_t ngpu,
@@ -811,6 +849,13 @@ magmablas_ztrsm_work(
     magmaDoubleComplex_ptr d_dinvA, magma_int_t dinvA_length,
     magma_queue_t queue );
 
+void
+magmablas_zpotrs_trsm(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue );
+
 
   /*
    * Wrappers for platform independence.
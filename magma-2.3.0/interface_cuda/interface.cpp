@@ -39,6 +39,7 @@
 
 #include "magma_internal.h"
 #include "error.h"
+#include "roofline.h"
 
 #ifdef HAVE_CUBLAS
 
@@ -247,6 +248,13 @@ magma_finalize()
 {
     magma_int_t info = 0;
 
+    #ifdef ROOFLINE
+    // report while the devices are still available
+    if ( g_init == 1 ) {
+        roofline_report();
+    }
+    #endif
+
     g_mutex.lock();
     {
         if ( g_init <= 0 ) {
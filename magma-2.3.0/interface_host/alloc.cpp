@@ -0,0 +1,363 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <map>
+#include <mutex>  // requires C++11
+
+#if defined(HAVE_NUMA)
+#include <numa.h>
+#endif
+
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+#include "error.h"
+#include "host_device.h"
+
+#ifdef HAVE_HOST
+
+// With the host backend, device memory is host memory on the NUMA node of
+// the current device. With libnuma (HAVE_NUMA), it is bound to that node with
+// numa_alloc_onnode; otherwise it relies on the kernel's first-touch policy:
+// the memory is zeroed by a worker thread bound to the device's cores.
+// Pinned memory is ordinary host memory, since copies are memcpy.
+
+
+#ifdef DEBUG_MEMORY
+std::mutex                g_pointers_mutex;
+std::map< void*, size_t > g_pointers_dev;
+std::map< void*, size_t > g_pointers_cpu;
+std::map< void*, size_t > g_pointers_pin;
+#endif
+
+#if defined(HAVE_NUMA)
+// numa_free requires the size
+static std::mutex                g_numa_mutex;
+static std::map< void*, size_t > g_numa_sizes;
+#endif
+
+
+/***************************************************************************//**
+    Allocates memory on the current device, i.e., in host memory local to
+    the device's cores.
+    Use magma_free() to free this memory.
+
+    @param[out]
+    ptrPtr  On output, set to the pointer that was allocated.
+            NULL on failure.
+
+    @param[in]
+    size    Size in bytes to allocate. If size = 0, allocates some minimal size.
+
+    @return MAGMA_SUCCESS
+    @return MAGMA_ERR_DEVICE_ALLOC on failure
+
+    Type-safe versions avoid the need for a (void**) cast and explicit sizeof.
+    @see magma_smalloc
+    @see magma_dmalloc
+    @see magma_cmalloc
+    @see magma_zmalloc
+    @see magma_imalloc
+    @see magma_index_malloc
+
+    @ingroup magma_malloc
+*******************************************************************************/
+extern "C" magma_int_t
+magma_malloc( magma_ptr* ptrPtr, size_t size )
+{
+    // malloc and free sometimes don't work for size=0, so allocate some minimal size
+    if ( size == 0 )
+        size = sizeof(magmaDoubleComplex);
+
+    magma_device_t dev;
+    magma_getdevice( &dev );
+
+    *ptrPtr = NULL;
+    #if defined(HAVE_NUMA)
+    if ( numa_available() >= 0 ) {
+        *ptrPtr = numa_alloc_onnode( size, int(magma_host_device_node( dev )) );
+        if ( *ptrPtr == NULL ) {
+            return MAGMA_ERR_DEVICE_ALLOC;
+        }
+        g_numa_mutex.lock();
+        g_numa_sizes[ *ptrPtr ] = size;
+        g_numa_mutex.unlock();
+    }
+    #endif
+
+    if ( *ptrPtr == NULL ) {
+        if ( posix_memalign( ptrPtr, 64, size ) != 0 ) {
+            *ptrPtr = NULL;
+            return MAGMA_ERR_DEVICE_ALLOC;
+        }
+        // first touch from a thread bound to the device's cores
+        magma_queue_t queue;
+        magma_queue_create( dev, &queue );
+        void* ptr = *ptrPtr;
+        magma_host_launch( queue, [ptr, size]() {
+            memset( ptr, 0, size );
+        });
+        magma_queue_destroy( queue );
+    }
+
+    #ifdef DEBUG_MEMORY
+    g_pointers_mutex.lock();
+    g_pointers_dev[ *ptrPtr ] = size;
+    g_pointers_mutex.unlock();
+    #endif
+
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    @fn magma_free( ptr )
+
+    Frees device memory previously allocated by magma_malloc().
+    As in CUDA, this does not wait for queues that may still use ptr;
+    sync them first.
+
+    @param[in]
+    ptr     Pointer to free.
+
+    @return MAGMA_SUCCESS
+    @return MAGMA_ERR_INVALID_PTR on failure
+
+    @ingroup magma_malloc
+*******************************************************************************/
+extern "C" magma_int_t
+magma_free_internal( magma_ptr ptr,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+
+    #ifdef DEBUG_MEMORY
+    g_pointers_mutex.lock();
+    if ( ptr != NULL && g_pointers_dev.count( ptr ) == 0 ) {
+        fprintf( stderr, "magma_free( %p ) that wasn't allocated with magma_malloc.\n", ptr );
+    }
+    else {
+        g_pointers_dev.erase( ptr );
+    }
+    g_pointers_mutex.unlock();
+    #endif
+
+    if ( ptr == NULL ) {
+        return MAGMA_SUCCESS;
+    }
+
+    #if defined(HAVE_NUMA)
+    size_t size = 0;
+    g_numa_mutex.lock();
+    std::map< void*, size_t >::iterator iter = g_numa_sizes.find( ptr );
+    if ( iter != g_numa_sizes.end() ) {
+        size = iter->second;
+        g_numa_sizes.erase( iter );
+    }
+    g_numa_mutex.unlock();
+    if ( size > 0 ) {
+        numa_free( ptr, size );
+        return MAGMA_SUCCESS;
+    }
+    #endif
+
+    free( ptr );
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    Allocate size bytes on CPU.
+    The purpose of using this instead of malloc is to properly align arrays
+    for vector (SSE, AVX) instructions. The default implementation uses
+    posix_memalign (on Linux, MacOS, etc.) or _aligned_malloc (on Windows)
+    to align memory to a 64 byte boundary (typical cache line size).
+    Use magma_free_cpu() to free this memory.
+
+    @param[out]
+    ptrPtr  On output, set to the pointer that was allocated.
+            NULL on failure.
+
+    @param[in]
+    size    Size in bytes to allocate. If size = 0, allocates some minimal size.
+
+    @return MAGMA_SUCCESS
+    @return MAGMA_ERR_HOST_ALLOC on failure
+
+    Type-safe versions avoid the need for a (void**) cast and explicit sizeof.
+    @see magma_smalloc_cpu
+    @see magma_dmalloc_cpu
+    @see magma_cmalloc_cpu
+    @see magma_zmalloc_cpu
+    @see magma_imalloc_cpu
+    @see magma_index_malloc_cpu
+
+    @ingroup magma_malloc_cpu
+*******************************************************************************/
+extern "C" magma_int_t
+magma_malloc_cpu( void** ptrPtr, size_t size )
+{
+    // malloc and free sometimes don't work for size=0, so allocate some minimal size
+    if ( size == 0 )
+        size = sizeof(magmaDoubleComplex);
+#if 1
+#if defined( _WIN32 ) || defined( _WIN64 )
+    *ptrPtr = _aligned_malloc( size, 64 );
+    if ( *ptrPtr == NULL ) {
+        return MAGMA_ERR_HOST_ALLOC;
+    }
+#else
+    int err = posix_memalign( ptrPtr, 64, size );
+    if ( err != 0 ) {
+        *ptrPtr = NULL;
+        return MAGMA_ERR_HOST_ALLOC;
+    }
+#endif
+#else
+    *ptrPtr = malloc( size );
+    if ( *ptrPtr == NULL ) {
+        return MAGMA_ERR_HOST_ALLOC;
+    }
+#endif
+
+    #ifdef DEBUG_MEMORY
+    g_pointers_mutex.lock();
+    g_pointers_cpu[ *ptrPtr ] = size;
+    g_pointers_mutex.unlock();
+    #endif
+
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    Frees CPU memory previously allocated by magma_malloc_cpu().
+    The default implementation uses free(),
+    which works for both malloc and posix_memalign.
+    For Windows, _aligned_free() is used.
+
+    @param[in]
+    ptr     Pointer to free.
+
+    @return MAGMA_SUCCESS
+    @return MAGMA_ERR_INVALID_PTR on failure
+
+    @ingroup magma_malloc_cpu
+*******************************************************************************/
+extern "C" magma_int_t
+magma_free_cpu( void* ptr )
+{
+    #ifdef DEBUG_MEMORY
+    g_pointers_mutex.lock();
+    if ( ptr != NULL && g_pointers_cpu.count( ptr ) == 0 ) {
+        fprintf( stderr, "magma_free_cpu( %p ) that wasn't allocated with magma_malloc_cpu.\n", ptr );
+    }
+    else {
+        g_pointers_cpu.erase( ptr );
+    }
+    g_pointers_mutex.unlock();
+    #endif
+
+#if defined( _WIN32 ) || defined( _WIN64 )
+    _aligned_free( ptr );
+#else
+    free( ptr );
+#endif
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    Allocates memory on the CPU in "pinned" memory.
+    With the host backend, there is no DMA engine, so this is ordinary
+    aligned host memory.
+    Use magma_free_pinned() to free this memory.
+
+    @param[out]
+    ptrPtr  On output, set to the pointer that was allocated.
+            NULL on failure.
+
+    @param[in]
+    size    Size in bytes to allocate. If size = 0, allocates some minimal size.
+
+    @return MAGMA_SUCCESS
+    @return MAGMA_ERR_HOST_ALLOC on failure
+
+    Type-safe versions avoid the need for a (void**) cast and explicit sizeof.
+    @see magma_smalloc_pinned
+    @see magma_dmalloc_pinned
+    @see magma_cmalloc_pinned
+    @see magma_zmalloc_pinned
+    @see magma_imalloc_pinned
+    @see magma_index_malloc_pinned
+
+    @ingroup magma_malloc_pinned
+*******************************************************************************/
+extern "C" magma_int_t
+magma_malloc_pinned( void** ptrPtr, size_t size )
+{
+    // malloc and free sometimes don't work for size=0, so allocate some minimal size
+    if ( size == 0 )
+        size = sizeof(magmaDoubleComplex);
+    if ( posix_memalign( ptrPtr, 64, size ) != 0 ) {
+        *ptrPtr = NULL;
+        return MAGMA_ERR_HOST_ALLOC;
+    }
+
+    #ifdef DEBUG_MEMORY
+    g_pointers_mutex.lock();
+    g_pointers_pin[ *ptrPtr ] = size;
+    g_pointers_mutex.unlock();
+    #endif
+
+    return MAGMA_SUCCESS;
+}
+
+
+/***************************************************************************//**
+    @fn magma_free_pinned( ptr )
+
+    Frees CPU pinned memory previously allocated by magma_malloc_pinned().
+
+    @param[in]
+    ptr     Pointer to free.
+
+    @return MAGMA_SUCCESS
+    @return MAGMA_ERR_INVALID_PTR on failure
+
+    @ingroup magma_malloc_pinned
+*******************************************************************************/
+extern "C" magma_int_t
+magma_free_pinned_internal( void* ptr,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+
+    #ifdef DEBUG_MEMORY
+    g_pointers_mutex.lock();
+    if ( ptr != NULL && g_pointers_pin.count( ptr ) == 0 ) {
+        fprintf( stderr, "magma_free_pinned( %p ) that wasn't allocated with magma_malloc_pinned.\n", ptr );
+    }
+    else {
+        g_pointers_pin.erase( ptr );
+    }
+    g_pointers_mutex.unlock();
+    #endif
+
+    free( ptr );
+    return MAGMA_SUCCESS;
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,361 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+#include <string.h>
+
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+#include "error.h"
+
+#ifdef HAVE_HOST
+
+// Generic, type-independent routines to copy data.
+// Type-safe versions which avoid the user needing sizeof(...) are in headers;
+// see magma_{s,d,c,z,i,index_}{set,get,copy}{matrix,vector}
+//
+// With the host backend, set, get, and copy are all memcpy between host
+// arrays, executed by the queue's worker thread; the set/get/copy routines
+// differ only in documentation. For arguments, see interface_cuda/copy_v2.cpp.
+// If source and destination are the same array with the same stride,
+// as happens when the application passes its own array as "device" memory,
+// nothing is copied.
+// The synchronous versions require a queue, as with CUDA; the async
+// versions accept a NULL queue, which copies immediately.
+
+
+/******************************************************************************/
+// Copies a vector of n elements, each elemSize bytes.
+static void
+magma_host_copyvector(
+    magma_int_t n, magma_int_t elemSize,
+    const void* x_src, magma_int_t incx,
+    void*       y_dst, magma_int_t incy )
+{
+    if ( n <= 0 || (x_src == y_dst && incx == incy) ) {
+        return;
+    }
+    const char* x = (const char*) x_src;
+    char*       y = (char*)       y_dst;
+    if ( incx == 1 && incy == 1 ) {
+        memmove( y, x, n*elemSize );
+    }
+    else {
+        for( magma_int_t i=0; i < n; ++i ) {
+            memcpy( &y[ i*incy*elemSize ], &x[ i*incx*elemSize ], elemSize );
+        }
+    }
+}
+
+
+/******************************************************************************/
+// Copies an m-by-n matrix, each element elemSize bytes.
+// Large matrices are copied in parallel over columns.
+static void
+magma_host_copymatrix(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    const void* A_src, magma_int_t lda,
+    void*       B_dst, magma_int_t ldb )
+{
+    if ( m <= 0 || n <= 0 || (A_src == B_dst && lda == ldb) ) {
+        return;
+    }
+    const char* A = (const char*) A_src;
+    char*       B = (char*)       B_dst;
+    if ( (m == lda && m == ldb) || n == 1 ) {
+        memmove( B, A, m*n*elemSize );
+        return;
+    }
+    // columns are each at least one page in the parallel case
+    const magma_int_t col_bytes = m*elemSize;
+    #pragma omp parallel for schedule(static) if ( col_bytes * n >= 1048576 )
+    for( magma_int_t j=0; j < n; ++j ) {
+        memcpy( &B[ j*ldb*elemSize ], &A[ j*lda*elemSize ], col_bytes );
+    }
+}
+
+/***************************************************************************//**
+    @fn magma_setvector( n, elemSize, hx_src, incx, dy_dst, incy, queue )
+
+    Copy vector hx_src on CPU host to dy_dst on host device.
+    This version synchronizes the queue after the transfer.
+
+    @ingroup magma_setvector
+*******************************************************************************/
+extern "C" void
+magma_setvector_internal(
+    magma_int_t n, magma_int_t elemSize,
+    void const* hx_src, magma_int_t incx,
+    magma_ptr   dy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_setvector_async_internal( n, elemSize, hx_src, incx, dy_dst, incy, queue, func, file, line );
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_setvector_async( n, elemSize, hx_src, incx, dy_dst, incy, queue )
+
+    Copy vector hx_src on CPU host to dy_dst on host device.
+    This version is asynchronous: it returns before the transfer finishes.
+
+    @ingroup magma_setvector
+*******************************************************************************/
+extern "C" void
+magma_setvector_async_internal(
+    magma_int_t n, magma_int_t elemSize,
+    void const* hx_src, magma_int_t incx,
+    magma_ptr   dy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+    magma_host_launch( queue, [=]() {
+        magma_host_copyvector( n, elemSize, hx_src, incx, dy_dst, incy );
+    });
+}
+
+
+/***************************************************************************//**
+    @fn magma_getvector( n, elemSize, dx_src, incx, hy_dst, incy, queue )
+
+    Copy vector dx_src on host device to hy_dst on CPU host.
+    This version synchronizes the queue after the transfer.
+
+    @ingroup magma_getvector
+*******************************************************************************/
+extern "C" void
+magma_getvector_internal(
+    magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dx_src, magma_int_t incx,
+    void*           hy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_getvector_async_internal( n, elemSize, dx_src, incx, hy_dst, incy, queue, func, file, line );
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_getvector_async( n, elemSize, dx_src, incx, hy_dst, incy, queue )
+
+    Copy vector dx_src on host device to hy_dst on CPU host.
+    This version is asynchronous: it returns before the transfer finishes.
+
+    @ingroup magma_getvector
+*******************************************************************************/
+extern "C" void
+magma_getvector_async_internal(
+    magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dx_src, magma_int_t incx,
+    void*           hy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+    magma_host_launch( queue, [=]() {
+        magma_host_copyvector( n, elemSize, dx_src, incx, hy_dst, incy );
+    });
+}
+
+
+/***************************************************************************//**
+    @fn magma_copyvector( n, elemSize, dx_src, incx, dy_dst, incy, queue )
+
+    Copy vector dx_src to dy_dst, both on host devices.
+    This version synchronizes the queue after the transfer.
+
+    @ingroup magma_copyvector
+*******************************************************************************/
+extern "C" void
+magma_copyvector_internal(
+    magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dx_src, magma_int_t incx,
+    magma_ptr       dy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_copyvector_async_internal( n, elemSize, dx_src, incx, dy_dst, incy, queue, func, file, line );
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_copyvector_async( n, elemSize, dx_src, incx, dy_dst, incy, queue )
+
+    Copy vector dx_src to dy_dst, both on host devices.
+    This version is asynchronous: it returns before the transfer finishes.
+
+    @ingroup magma_copyvector
+*******************************************************************************/
+extern "C" void
+magma_copyvector_async_internal(
+    magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dx_src, magma_int_t incx,
+    magma_ptr       dy_dst, magma_int_t incy,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+    magma_host_launch( queue, [=]() {
+        magma_host_copyvector( n, elemSize, dx_src, incx, dy_dst, incy );
+    });
+}
+
+
+/***************************************************************************//**
+    @fn magma_setmatrix( m, n, elemSize, hA_src, lda, dB_dst, lddb, queue )
+
+    Copy all or part of matrix hA_src on CPU host to dB_dst on host device.
+    This version synchronizes the queue after the transfer.
+
+    @ingroup magma_setmatrix
+*******************************************************************************/
+extern "C" void
+magma_setmatrix_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    void const* hA_src, magma_int_t lda,
+    magma_ptr   dB_dst, magma_int_t lddb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_setmatrix_async_internal( m, n, elemSize, hA_src, lda, dB_dst, lddb, queue, func, file, line );
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_setmatrix_async( m, n, elemSize, hA_src, lda, dB_dst, lddb, queue )
+
+    Copy all or part of matrix hA_src on CPU host to dB_dst on host device.
+    This version is asynchronous: it returns before the transfer finishes.
+
+    @ingroup magma_setmatrix
+*******************************************************************************/
+extern "C" void
+magma_setmatrix_async_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    void const* hA_src, magma_int_t lda,
+    magma_ptr   dB_dst, magma_int_t lddb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+    magma_host_launch( queue, [=]() {
+        magma_host_copymatrix( m, n, elemSize, hA_src, lda, dB_dst, lddb );
+    });
+}
+
+
+/***************************************************************************//**
+    @fn magma_getmatrix( m, n, elemSize, dA_src, ldda, hB_dst, ldb, queue )
+
+    Copy all or part of matrix dA_src on host device to hB_dst on CPU host.
+    This version synchronizes the queue after the transfer.
+
+    @ingroup magma_getmatrix
+*******************************************************************************/
+extern "C" void
+magma_getmatrix_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dA_src, magma_int_t ldda,
+    void*           hB_dst, magma_int_t ldb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_getmatrix_async_internal( m, n, elemSize, dA_src, ldda, hB_dst, ldb, queue, func, file, line );
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_getmatrix_async( m, n, elemSize, dA_src, ldda, hB_dst, ldb, queue )
+
+    Copy all or part of matrix dA_src on host device to hB_dst on CPU host.
+    This version is asynchronous: it returns before the transfer finishes.
+
+    @ingroup magma_getmatrix
+*******************************************************************************/
+extern "C" void
+magma_getmatrix_async_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dA_src, magma_int_t ldda,
+    void*           hB_dst, magma_int_t ldb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+    magma_host_launch( queue, [=]() {
+        magma_host_copymatrix( m, n, elemSize, dA_src, ldda, hB_dst, ldb );
+    });
+}
+
+
+/***************************************************************************//**
+    @fn magma_copymatrix( m, n, elemSize, dA_src, ldda, dB_dst, lddb, queue )
+
+    Copy all or part of matrix dA_src to dB_dst, both on host devices.
+    This version synchronizes the queue after the transfer.
+
+    @ingroup magma_copymatrix
+*******************************************************************************/
+extern "C" void
+magma_copymatrix_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dA_src, magma_int_t ldda,
+    magma_ptr       dB_dst, magma_int_t lddb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    assert( queue != NULL );
+    magma_copymatrix_async_internal( m, n, elemSize, dA_src, ldda, dB_dst, lddb, queue, func, file, line );
+    magma_queue_sync_internal( queue, func, file, line );
+}
+
+
+/***************************************************************************//**
+    @fn magma_copymatrix_async( m, n, elemSize, dA_src, ldda, dB_dst, lddb, queue )
+
+    Copy all or part of matrix dA_src to dB_dst, both on host devices.
+    This version is asynchronous: it returns before the transfer finishes.
+
+    @ingroup magma_copymatrix
+*******************************************************************************/
+extern "C" void
+magma_copymatrix_async_internal(
+    magma_int_t m, magma_int_t n, magma_int_t elemSize,
+    magma_const_ptr dA_src, magma_int_t ldda,
+    magma_ptr       dB_dst, magma_int_t lddb,
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+    magma_host_launch( queue, [=]() {
+        magma_host_copymatrix( m, n, elemSize, dA_src, ldda, dB_dst, lddb );
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,23 @@
+#ifndef HOST_DEVICE_H
+#define HOST_DEVICE_H
+
+#include "magma_types.h"
+
+// Internal routines of the host backend, shared between interface.cpp
+// and alloc.cpp. A host "device" is a contiguous group of CPU cores;
+// see magma_init() in interface.cpp.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+magma_int_t magma_host_device_node( magma_device_t device );
+
+magma_int_t magma_host_device_cores(
+    magma_device_t device, magma_int_t* first_core );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_DEVICE_H
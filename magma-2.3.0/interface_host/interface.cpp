@@ -0,0 +1,716 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <map>
+#include <mutex>               // requires C++11
+#include <condition_variable>  // requires C++11
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(MAGMA_WITH_MKL)
+#include <mkl_service.h>
+#endif
+
+#if defined(HAVE_NUMA)
+#include <numa.h>
+#endif
+
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+#include "magma_threadsetting.h"
+#include "affinity.h"
+#include "error.h"
+#include "roofline.h"
+#include "host_device.h"
+
+#ifdef HAVE_HOST
+
+// The host backend implements MAGMA's device and queue abstractions on the
+// CPU, so that the _gpu drivers run, and can be tested, without a GPU.
+//   - A "device" is a contiguous group of CPU cores. The number of devices
+//     is set by the environment variable MAGMA_NUM_HOST_DEVICES (default 1);
+//     the cores given by magma_get_parallel_numthreads() are split evenly.
+//   - "Device memory" is ordinary host memory, allocated on the device's
+//     NUMA node (see alloc.cpp).
+//   - A queue is an in-order worker thread (magma_thread_queue with one
+//     thread), bound to its device's cores, that executes the BLAS and
+//     copies enqueued on it (see magma_host_launch in host_task.hpp).
+//     Threaded BLAS called by the worker uses the device's cores.
+
+#ifdef DEBUG_MEMORY
+extern std::mutex                g_pointers_mutex;
+extern std::map< void*, size_t > g_pointers_dev;
+extern std::map< void*, size_t > g_pointers_cpu;
+extern std::map< void*, size_t > g_pointers_pin;
+
+extern "C" void
+magma_warn_leaks( const std::map< void*, size_t >& pointers, const char* type );
+#endif
+
+
+// -----------------------------------------------------------------------------
+// globals
+static std::mutex g_mutex;
+
+// count of (init - finalize) calls
+static int g_init = 0;
+
+// current device; each thread has its own current device, as in CUDA
+static thread_local magma_device_t g_current_device = 0;
+
+
+// -----------------------------------------------------------------------------
+// host devices, set by magma_init()
+struct magma_device_info
+{
+    size_t memory;
+    magma_int_t first_core;
+    magma_int_t ncores;
+    magma_int_t numa_node;
+};
+
+int g_magma_devices_cnt = 0;
+struct magma_device_info* g_magma_devices = NULL;
+
+
+// -----------------------------------------------------------------------------
+// events are counters: record enqueues a task that advances `completed`
+// to the ticket that record issued; waiting blocks until `completed`
+// reaches the last ticket issued before the wait.
+struct magma_event
+{
+    std::mutex              mutex;
+    std::condition_variable cond;
+    long long               recorded;
+    long long               completed;
+};
+
+
+// =============================================================================
+// initialization
+
+/***************************************************************************//**
+    Initializes the MAGMA library.
+    Partitions the CPU cores into host devices.
+
+    Every magma_init call must be paired with a magma_finalize call.
+    Only one thread needs to call magma_init and magma_finalize,
+    but every thread may call it. If n threads call magma_init,
+    the n-th call to magma_finalize will release resources.
+
+    Set MAGMA_NUM_HOST_DEVICES before calling magma_init to change the
+    number of devices.
+
+    @retval MAGMA_SUCCESS
+    @retval MAGMA_ERR_HOST_ALLOC
+
+    @see magma_finalize
+
+    @ingroup magma_init
+*******************************************************************************/
+extern "C" magma_int_t
+magma_init()
+{
+    magma_int_t info = 0;
+
+    g_mutex.lock();
+    {
+        if ( g_init == 0 ) {
+            magma_int_t ncores = magma_get_parallel_numthreads();
+            magma_int_t ndevices = 1;
+            const char* str = getenv( "MAGMA_NUM_HOST_DEVICES" );
+            if ( str != NULL ) {
+                ndevices = atoi( str );
+            }
+            ndevices = max( 1, min( ndevices, ncores ));
+
+            size_t size = ndevices * sizeof(struct magma_device_info);
+            magma_malloc_cpu( (void**) &g_magma_devices, size );
+            if ( g_magma_devices == NULL ) {
+                info = MAGMA_ERR_HOST_ALLOC;
+                goto cleanup;
+            }
+            g_magma_devices_cnt = int(ndevices);
+
+            size_t memory = size_t( sysconf( _SC_PHYS_PAGES )) * sysconf( _SC_PAGESIZE );
+            for( int dev=0; dev < g_magma_devices_cnt; ++dev ) {
+                magma_int_t first = (dev    ) * ncores / ndevices;
+                magma_int_t last  = (dev + 1) * ncores / ndevices;
+                g_magma_devices[dev].first_core = first;
+                g_magma_devices[dev].ncores     = last - first;
+                g_magma_devices[dev].memory     = memory / ndevices;
+                g_magma_devices[dev].numa_node  = 0;
+                #if defined(HAVE_NUMA)
+                if ( numa_available() >= 0 ) {
+                    g_magma_devices[dev].numa_node = max( 0, numa_node_of_cpu( int(first) ));
+                }
+                #endif
+            }
+        }
+cleanup:
+        g_init += 1;  // increment (init - finalize) count
+    }
+    g_mutex.unlock();
+
+    return info;
+}
+
+
+/***************************************************************************//**
+    Frees information used by the MAGMA library.
+    @see magma_init
+
+    @ingroup magma_init
+*******************************************************************************/
+extern "C" magma_int_t
+magma_finalize()
+{
+    magma_int_t info = 0;
+
+    #ifdef ROOFLINE
+    // report while the devices are still available
+    if ( g_init == 1 ) {
+        roofline_report();
+    }
+    #endif
+
+    g_mutex.lock();
+    {
+        if ( g_init <= 0 ) {
+            info = MAGMA_ERR_NOT_INITIALIZED;
+        }
+        else {
+            g_init -= 1;  // decrement (init - finalize) count
+            if ( g_init == 0 ) {
+                info = 0;
+
+                if ( g_magma_devices != NULL ) {
+                    magma_free_cpu( g_magma_devices );
+                    g_magma_devices = NULL;
+                    g_magma_devices_cnt = 0;
+                }
+
+                #ifdef DEBUG_MEMORY
+                magma_warn_leaks( g_pointers_dev, "device" );
+                magma_warn_leaks( g_pointers_cpu, "CPU" );
+                magma_warn_leaks( g_pointers_pin, "CPU pinned" );
+                #endif
+            }
+        }
+    }
+    g_mutex.unlock();
+
+    return info;
+}
+
+
+// =============================================================================
+// testing and debugging support
+
+#ifdef DEBUG_MEMORY
+/***************************************************************************//**
+    If DEBUG_MEMORY is defined at compile time, prints warnings when
+    magma_finalize() is called for any device, CPU, or CPU pinned
+    allocations that were not freed.
+
+    @param[in]
+    pointers    Hash table mapping allocated pointers to size.
+
+    @param[in]
+    type        String describing type of pointers (device, CPU, etc.)
+
+    @ingroup magma_testing
+*******************************************************************************/
+extern "C" void
+magma_warn_leaks( const std::map< void*, size_t >& pointers, const char* type )
+{
+    if ( pointers.size() > 0 ) {
+        fprintf( stderr, "Warning: MAGMA detected memory leak of %llu %s pointers:\n",
+                 (long long unsigned) pointers.size(), type );
+        std::map< void*, size_t >::const_iterator iter;
+        for( iter = pointers.begin(); iter != pointers.end(); ++iter ) {
+            fprintf( stderr, "    pointer %p, size %lu\n", iter->first, iter->second );
+        }
+    }
+}
+#endif
+
+
+/***************************************************************************//**
+    Print MAGMA version, LAPACK/BLAS library version,
+    host devices, number of threads, date, etc.
+    Used in testing.
+    @ingroup magma_testing
+*******************************************************************************/
+extern "C" void
+magma_print_environment()
+{
+    magma_int_t major, minor, micro;
+    magma_version( &major, &minor, &micro );
+    printf( "%% MAGMA %lld.%lld.%lld %s compiled for host backend, %lld-bit magma_int_t, %lld-bit pointer.\n",
+            (long long) major, (long long) minor, (long long) micro,
+            MAGMA_VERSION_STAGE,
+            (long long) (8*sizeof(magma_int_t)),
+            (long long) (8*sizeof(void*)) );
+
+#if defined(_OPENMP)
+    int omp_threads = 0;
+    #pragma omp parallel
+    {
+        omp_threads = omp_get_num_threads();
+    }
+    printf( "%% OpenMP threads %d. ", omp_threads );
+#else
+    printf( "%% MAGMA not compiled with OpenMP. " );
+#endif
+
+#if defined(MAGMA_WITH_MKL)
+    MKLVersion mkl_version;
+    mkl_get_version( &mkl_version );
+    printf( "MKL %d.%d.%d, MKL threads %d. ",
+            mkl_version.MajorVersion,
+            mkl_version.MinorVersion,
+            mkl_version.UpdateVersion,
+            mkl_get_max_threads() );
+#endif
+
+    printf( "\n" );
+
+    // print devices
+    for( int dev = 0; dev < g_magma_devices_cnt; ++dev ) {
+        printf( "%% device %d: cores %lld-%lld, NUMA node %lld, %.1f MiB memory\n",
+                dev,
+                (long long) g_magma_devices[dev].first_core,
+                (long long) (g_magma_devices[dev].first_core + g_magma_devices[dev].ncores - 1),
+                (long long) g_magma_devices[dev].numa_node,
+                g_magma_devices[dev].memory / (1024.*1024.) );
+    }
+
+    time_t t = time( NULL );
+    printf( "%% %s", ctime( &t ));
+}
+
+
+/***************************************************************************//**
+    For debugging purposes, determines whether a pointer points to CPU or GPU memory.
+    With the host backend, device memory is host memory, so this always
+    returns 0.
+
+    @param[in] A    pointer to test
+
+    @return  0:  A is a host pointer.
+
+    @ingroup magma_util
+*******************************************************************************/
+extern "C" magma_int_t
+magma_is_devptr( const void* A )
+{
+    MAGMA_UNUSED( A );
+    return 0;
+}
+
+
+// =============================================================================
+// device support
+
+/***************************************************************************//**
+    Returns CUDA architecture capability for the current device.
+    With the host backend, there is no CUDA architecture, so this returns 0;
+    tuning routines treat this as the oldest architecture.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" magma_int_t
+magma_getdevice_arch()
+{
+    return 0;
+}
+
+
+/***************************************************************************//**
+    Fills in devices array with the available devices.
+
+    @param[out]
+    devices     Array of dimension (size).
+                On output, devices[0, ..., num_dev-1] contain device IDs.
+                Entries >= num_dev are not touched.
+
+    @param[in]
+    size        Dimension of the array devices.
+
+    @param[out]
+    num_dev     Number of devices, limited to size.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" void
+magma_getdevices(
+    magma_device_t* devices,
+    magma_int_t  size,
+    magma_int_t* num_dev )
+{
+    int cnt = min( g_magma_devices_cnt, int(size) );
+    for( int i = 0; i < cnt; ++i ) {
+        devices[i] = i;
+    }
+    *num_dev = cnt;
+}
+
+
+/***************************************************************************//**
+    Get the current device.
+
+    @param[out]
+    device      On output, device ID of the current device.
+                Each thread has its own current device.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" void
+magma_getdevice( magma_device_t* device )
+{
+    *device = g_current_device;
+}
+
+
+/***************************************************************************//**
+    Set the current device.
+
+    @param[in]
+    device      Device ID to set as the current device.
+                Each thread has its own current device.
+
+    @ingroup magma_device
+*******************************************************************************/
+extern "C" void
+magma_setdevice( magma_device_t device )
+{
+    if ( device < 0 || device >= g_magma_devices_cnt ) {
+        check_error( MAGMA_ERR_ILLEGAL_VALUE );
+        return;
+    }
+    g_current_device = device;
+}
+
+
+/***************************************************************************//**
+    @param[in]
+    queue           Queue to query.
+
+    @return         Amount of memory in bytes available on the device
+                    associated with the queue.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C" size_t
+magma_mem_size( magma_queue_t queue )
+{
+    magma_device_t dev = magma_queue_get_device( queue );
+    size_t avail = size_t( sysconf( _SC_AVPHYS_PAGES )) * sysconf( _SC_PAGESIZE );
+    #if defined(HAVE_NUMA)
+    if ( numa_available() >= 0 ) {
+        long long node_free = 0;
+        numa_node_size64( int(magma_host_device_node( dev )), &node_free );
+        avail = size_t( node_free );
+    }
+    #endif
+    return min( avail, g_magma_devices[dev].memory );
+}
+
+
+/******************************************************************************/
+// @return NUMA node of the device's cores; 0 if unknown.
+extern "C" magma_int_t
+magma_host_device_node( magma_device_t device )
+{
+    if ( device < 0 || device >= g_magma_devices_cnt ) {
+        return 0;
+    }
+    return g_magma_devices[device].numa_node;
+}
+
+
+/******************************************************************************/
+// @return number of cores in the device; sets first_core to the first one.
+extern "C" magma_int_t
+magma_host_device_cores( magma_device_t device, magma_int_t* first_core )
+{
+    if ( device < 0 || device >= g_magma_devices_cnt ) {
+        *first_core = 0;
+        return 1;
+    }
+    *first_core = g_magma_devices[device].first_core;
+    return g_magma_devices[device].ncores;
+}
+
+
+// =============================================================================
+// queue support
+
+/***************************************************************************//**
+    @param[in]
+    queue       Queue to query.
+
+    @return Device ID associated with the MAGMA queue.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C"
+magma_int_t
+magma_queue_get_device( magma_queue_t queue )
+{
+    return queue->device();
+}
+
+
+/******************************************************************************/
+// First task executed by each queue's worker thread: binds it to the
+// device's cores (unless MAGMA_NOAFFINITY) and limits threaded BLAS
+// called from it to that many threads.
+static void
+magma_host_queue_bind( magma_device_t device )
+{
+    magma_int_t first;
+    magma_int_t ncores = magma_host_device_cores( device, &first );
+
+    #ifndef MAGMA_NOAFFINITY
+    affinity_set set;
+    for( magma_int_t core = first; core < first + ncores; ++core ) {
+        set.add( int(core) );
+    }
+    if ( set.set_affinity() != 0 ) {
+        fprintf( stderr, "%s: cannot bind queue to cores %lld-%lld\n", __func__,
+                 (long long) first, (long long) (first + ncores - 1) );
+    }
+    #endif
+
+    magma_set_omp_numthreads( ncores );
+    #if defined(MAGMA_WITH_MKL)
+    mkl_set_num_threads_local( int(ncores) );
+    #endif
+}
+
+
+/***************************************************************************//**
+    @fn magma_queue_create( device, queue_ptr )
+
+    magma_queue_create( device, queue_ptr ) is the preferred alias to this
+    function.
+
+    Creates a new MAGMA queue, with an in-order worker thread bound to the
+    device's cores.
+
+    @param[in]
+    device          Device to create queue on.
+
+    @param[out]
+    queue_ptr       On output, the newly created queue.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C" void
+magma_queue_create_internal(
+    magma_device_t device, magma_queue_t* queue_ptr,
+    const char* func, const char* file, int line )
+{
+    magma_queue_t queue;
+    magma_malloc_cpu( (void**)&queue, sizeof(*queue) );
+    assert( queue != NULL );
+    *queue_ptr = queue;
+
+    if ( device < 0 || device >= g_magma_devices_cnt ) {
+        check_xerror( MAGMA_ERR_ILLEGAL_VALUE, func, file, line );
+        device = 0;
+    }
+
+    queue->own__    = 0;
+    queue->device__ = device;
+    queue->tasks__  = new magma_thread_queue;
+    queue->tasks__->launch( 1 );
+
+    magma_host_launch( queue, [device]() {
+        magma_host_queue_bind( device );
+    });
+}
+
+
+/***************************************************************************//**
+    @fn magma_queue_destroy( queue )
+
+    Destroys a queue, freeing its resources.
+    Waits for tasks already enqueued to finish.
+
+    @param[in]
+    queue           Queue to destroy.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C" void
+magma_queue_destroy_internal(
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+
+    if ( queue != NULL ) {
+        // ~magma_thread_queue calls quit, which waits for queued tasks
+        delete queue->tasks__;
+        queue->tasks__  = NULL;
+        queue->device__ = -1;
+        magma_free_cpu( queue );
+    }
+}
+
+
+/***************************************************************************//**
+    @fn magma_queue_sync( queue )
+
+    Synchronizes with a queue. The CPU blocks until all operations on the queue
+    are finished.
+
+    @param[in]
+    queue           Queue to synchronize.
+
+    @ingroup magma_queue
+*******************************************************************************/
+extern "C" void
+magma_queue_sync_internal(
+    magma_queue_t queue,
+    const char* func, const char* file, int line )
+{
+    MAGMA_UNUSED( func );
+    MAGMA_UNUSED( file );
+    MAGMA_UNUSED( line );
+
+    // a NULL queue executes synchronously, so there is nothing to wait for
+    if ( queue != NULL ) {
+        queue->host_tasks()->sync();
+    }
+}
+
+
+// =============================================================================
+// event support
+
+/***************************************************************************//**
+    Creates an event.
+
+    @param[in]
+    event           On output, the newly created event.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_create( magma_event_t* event )
+{
+    *event = new magma_event;
+    (*event)->recorded  = 0;
+    (*event)->completed = 0;
+}
+
+
+/***************************************************************************//**
+    Destroys an event, freeing its resources.
+
+    @param[in]
+    event           Event to destroy.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_destroy( magma_event_t event )
+{
+    delete event;
+}
+
+
+/***************************************************************************//**
+    Records an event into the queue's execution stream.
+    The event will trigger when all previous operations on this queue finish.
+
+    @param[in]
+    event           Event to record.
+
+    @param[in]
+    queue           Queue to execute in.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_record( magma_event_t event, magma_queue_t queue )
+{
+    long long ticket;
+    {
+        std::lock_guard< std::mutex > lock( event->mutex );
+        ticket = ++event->recorded;
+    }
+    magma_host_launch( queue, [event, ticket]() {
+        std::lock_guard< std::mutex > lock( event->mutex );
+        event->completed = max( event->completed, ticket );
+        event->cond.notify_all();
+    });
+}
+
+
+/***************************************************************************//**
+    Synchronizes with an event. The CPU blocks until the event triggers.
+
+    @param[in]
+    event           Event to synchronize with.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_event_sync( magma_event_t event )
+{
+    std::unique_lock< std::mutex > lock( event->mutex );
+    long long ticket = event->recorded;
+    while ( event->completed < ticket ) {
+        event->cond.wait( lock );
+    }
+}
+
+
+/***************************************************************************//**
+    Synchronizes a queue with an event. The queue blocks until the event
+    triggers. The CPU does not block.
+
+    @param[in]
+    event           Event to synchronize with.
+
+    @param[in]
+    queue           Queue to synchronize.
+
+    @ingroup magma_event
+*******************************************************************************/
+extern "C" void
+magma_queue_wait_event( magma_queue_t queue, magma_event_t event )
+{
+    long long ticket;
+    {
+        std::lock_guard< std::mutex > lock( event->mutex );
+        ticket = event->recorded;
+    }
+    magma_host_launch( queue, [event, ticket]() {
+        std::unique_lock< std::mutex > lock( event->mutex );
+        while ( event->completed < ticket ) {
+            event->cond.wait( lock );
+        }
+    });
+}
+
+#endif // HAVE_HOST
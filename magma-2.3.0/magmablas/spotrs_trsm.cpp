@@ -0,0 +1,96 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas/zpotrs_trsm.cpp, normal z -> s, Sat Oct 17 12:40:05 2026
+*/
+#include "magma_internal.h"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    spotrs_trsm does the two triangular solves of spotrs, overwriting B
+    with the solution X of A*X = B, where A = U**H*U or A = L*L**H is
+    the Cholesky factorization computed by spotrf.
+
+    On the GPU, these are two magma_strsm calls. The host backend version
+    inverts the diagonal blocks of the factor once for both solves; see
+    magmablas_host/spotrs_trsm.cpp.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  dA holds the upper triangular factor U;
+      -     = MagmaLower:  dA holds the lower triangular factor L.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    nrhs    INTEGER
+            The number of right hand sides, i.e., the number of columns
+            of the matrix B.  NRHS >= 0.
+
+    @param[in]
+    dA      REAL array on the GPU, dimension (LDDA,N)
+            The triangular factor U or L from spotrf.
+
+    @param[in]
+    ldda    INTEGER
+            The leading dimension of the array A.  LDDA >= max(1,N).
+
+    @param[in,out]
+    dB      REAL array on the GPU, dimension (LDDB,NRHS)
+            On entry, the right hand side matrix B.
+            On exit, the solution matrix X.
+
+    @param[in]
+    lddb    INTEGER
+            The leading dimension of the array B.  LDDB >= max(1,N).
+
+    @param[in]
+    queue   magma_queue_t
+            Queue to execute in.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magmablas_spotrs_trsm(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    magmaFloat_const_ptr dA, magma_int_t ldda,
+    magmaFloat_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    const float c_one = MAGMA_S_ONE;
+
+    magma_int_t info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( nrhs < 0 )
+        info = -3;
+    else if ( ldda < max(1, n) )
+        info = -5;
+    else if ( lddb < max(1, n) )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if ( uplo == MagmaUpper ) {
+        magma_strsm( MagmaLeft, MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+        magma_strsm( MagmaLeft, MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+    }
+    else {
+        magma_strsm( MagmaLeft, MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+        magma_strsm( MagmaLeft, MagmaLower, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+    }
+}
@@ -295,3 +295,339 @@ magma_zgetmatrix_1D_row_bcyclic(
     
     magma_setdevice( cdevice );
 }
+
+
+// =============================================================================
+// 2D block cyclic; see magma_bcyclic_t and control/bcyclic.cpp.
+// Participant d's local matrix is dA[d], with leading dimension desc->ldd,
+// and its transfers are on queues[d], on that queue's device, so several
+// participants may share a device. With the host backend, each participant's
+// data is written by the worker of its queue's device, hence in the memory
+// of that device's NUMA node.
+
+#ifdef HAVE_clBLAS
+    #define dL( dA_, dev, i_, j_ )  dA_[dev], ((i_) + (j_)*ldd)
+#else
+    #define dL( dA_, dev, i_, j_ ) (dA_[dev] + (i_) + (j_)*ldd)
+#endif
+
+
+/***************************************************************************//**
+    Copy matrix hA on CPU host to dA, which is distributed 2D block cyclic
+    over the p*q participants of desc.
+
+    @param[in]  desc    Descriptor of the distribution of the m-by-n matrix.
+    @param[in]  hA      The m-by-n matrix A on the CPU, of dimension (lda,n).
+    @param[in]  lda     Leading dimension of matrix hA. lda >= m.
+    @param[out] dA      Array of p*q pointers, one per participant, each to its
+                        local matrix, of dimension (desc->ldd,nloc), where nloc
+                        is from magma_bcyclic_local_size.
+    @param[in]  queues  Array of dimension (p*q), with one queue per participant.
+
+    @ingroup magma_setmatrix_bcyclic
+*******************************************************************************/
+extern "C" void
+magma_zsetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    const magmaDoubleComplex *hA, magma_int_t lda,
+    magmaDoubleComplex_ptr   *dA,
+    magma_queue_t queues[] )
+{
+    magma_int_t info = 0;
+    if ( desc == NULL )
+        info = -1;
+    else if ( lda < desc->m )
+        info = -3;
+    
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+    
+    magma_int_t i, j, ib, jb, dev, il, jl;
+    magma_int_t ldd = desc->ldd;
+    
+    magma_device_t cdevice;
+    magma_getdevice( &cdevice );
+    
+    for( j = 0; j < desc->n; j += desc->nb ) {
+        jb = min( desc->nb, desc->n - j );
+        for( i = 0; i < desc->m; i += desc->mb ) {
+            ib = min( desc->mb, desc->m - i );
+            magma_bcyclic_local_index( desc, i, j, &dev, &il, &jl );
+            magma_setdevice( magma_queue_get_device( queues[dev] ));
+            magma_zsetmatrix_async( ib, jb,
+                                    hA(i,j), lda,
+                                    dL( dA, dev, il, jl ), ldd,
+                                    queues[dev] );
+        }
+    }
+    
+    for( dev=0; dev < desc->p*desc->q; ++dev ) {
+        magma_setdevice( magma_queue_get_device( queues[dev] ));
+        magma_queue_sync( queues[dev] );
+    }
+    
+    magma_setdevice( cdevice );
+}
+
+
+/***************************************************************************//**
+    Copy matrix dA, which is distributed 2D block cyclic over the p*q
+    participants of desc, to hA on CPU host.
+
+    @param[in]  desc    Descriptor of the distribution of the m-by-n matrix.
+    @param[in]  dA      Array of p*q pointers, one per participant, each to its
+                        local matrix, of dimension (desc->ldd,nloc), where nloc
+                        is from magma_bcyclic_local_size.
+    @param[out] hA      The m-by-n matrix A on the CPU, of dimension (lda,n).
+    @param[in]  lda     Leading dimension of matrix hA. lda >= m.
+    @param[in]  queues  Array of dimension (p*q), with one queue per participant.
+
+    @ingroup magma_getmatrix_bcyclic
+*******************************************************************************/
+extern "C" void
+magma_zgetmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc,
+    magmaDoubleComplex_const_ptr const *dA,
+    magmaDoubleComplex                 *hA, magma_int_t lda,
+    magma_queue_t queues[] )
+{
+    magma_int_t info = 0;
+    if ( desc == NULL )
+        info = -1;
+    else if ( lda < desc->m )
+        info = -4;
+    
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+    
+    magma_int_t i, j, ib, jb, dev, il, jl;
+    magma_int_t ldd = desc->ldd;
+    
+    magma_device_t cdevice;
+    magma_getdevice( &cdevice );
+    
+    for( j = 0; j < desc->n; j += desc->nb ) {
+        jb = min( desc->nb, desc->n - j );
+        for( i = 0; i < desc->m; i += desc->mb ) {
+            ib = min( desc->mb, desc->m - i );
+            magma_bcyclic_local_index( desc, i, j, &dev, &il, &jl );
+            magma_setdevice( magma_queue_get_device( queues[dev] ));
+            magma_zgetmatrix_async( ib, jb,
+                                    dL( dA, dev, il, jl ), ldd,
+                                    hA(i,j), lda,
+                                    queues[dev] );
+        }
+    }
+    
+    for( dev=0; dev < desc->p*desc->q; ++dev ) {
+        magma_setdevice( magma_queue_get_device( queues[dev] ));
+        magma_queue_sync( queues[dev] );
+    }
+    
+    magma_setdevice( cdevice );
+}
+
+
+/***************************************************************************//**
+    Copy matrix dA, distributed 2D block cyclic as descA, to dB, distributed
+    as descB, e.g., from a 1D column layout to a 2D one, or to a different
+    tile size. Each piece of A within both a tile of descA and a tile of
+    descB is copied directly from its owner in A to its owner in B, on the
+    queue of its owner in B.
+    dA must be ready, i.e., its participants' queues synchronized.
+
+    @param[in]  descA   Descriptor of the distribution of the m-by-n matrix A.
+    @param[in]  dA      Array of pA*qA pointers to the local matrices of A.
+    @param[in]  descB   Descriptor of the distribution of B, with the same
+                        m and n as descA.
+    @param[out] dB      Array of pB*qB pointers to the local matrices of B.
+    @param[in]  queues  Array of dimension max(pA*qA, pB*qB), with one queue
+                        per participant.
+
+    @ingroup magma_setmatrix_bcyclic
+*******************************************************************************/
+extern "C" void
+magma_zredistribute_2D_bcyclic(
+    const magma_bcyclic_t *descA,
+    magmaDoubleComplex_const_ptr const *dA,
+    const magma_bcyclic_t *descB,
+    magmaDoubleComplex_ptr             *dB,
+    magma_queue_t queues[] )
+{
+    magma_int_t info = 0;
+    if ( descA == NULL )
+        info = -1;
+    else if ( descB == NULL || descB->m != descA->m || descB->n != descA->n )
+        info = -3;
+    
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+    
+    magma_int_t m = descA->m, n = descA->n;
+    magma_int_t i, j, i1, j1, devA, ilA, jlA, devB, ilB, jlB;
+    magma_int_t ldda = descA->ldd, lddb = descB->ldd;
+    
+    magma_device_t cdevice;
+    magma_getdevice( &cdevice );
+    
+    // pieces bounded by the tile boundaries of both layouts
+    for( j = 0; j < n; j = j1 ) {
+        j1 = min( n, min( (j/descA->nb + 1)*descA->nb,
+                          (j/descB->nb + 1)*descB->nb ));
+        for( i = 0; i < m; i = i1 ) {
+            i1 = min( m, min( (i/descA->mb + 1)*descA->mb,
+                              (i/descB->mb + 1)*descB->mb ));
+            magma_bcyclic_local_index( descA, i, j, &devA, &ilA, &jlA );
+            magma_bcyclic_local_index( descB, i, j, &devB, &ilB, &jlB );
+            magma_setdevice( magma_queue_get_device( queues[devB] ));
+            #ifdef HAVE_clBLAS
+            magma_zcopymatrix_async( i1 - i, j1 - j,
+                                     dA[devA], ilA + jlA*ldda, ldda,
+                                     dB[devB], ilB + jlB*lddb, lddb,
+                                     queues[devB] );
+            #else
+            magma_zcopymatrix_async( i1 - i, j1 - j,
+                                     dA[devA] + ilA + jlA*ldda, ldda,
+                                     dB[devB] + ilB + jlB*lddb, lddb,
+                                     queues[devB] );
+            #endif
+        }
+    }
+    
+    for( devB=0; devB < descB->p*descB->q; ++devB ) {
+        magma_setdevice( magma_queue_get_device( queues[devB] ));
+        magma_queue_sync( queues[devB] );
+    }
+    
+    magma_setdevice( cdevice );
+}
+
+
+/***************************************************************************//**
+    Pack the part of the global submatrix A(i:i+m-1, j:j+n-1) that is on
+    participant dev into the contiguous message dbuf, e.g., for a send to
+    another node. The part is one local submatrix (see
+    magma_bcyclic_local_range), of mloc-by-nloc, so dbuf is mloc-by-nloc,
+    column-major, with leading dimension mloc: the tiles in local order.
+
+    @param[in]  desc    Descriptor of the distribution of A.
+    @param[in]  dev     Participant, 0 <= dev < p*q.
+    @param[in]  i       First global row of the submatrix.    i >= 0.
+    @param[in]  j       First global column of the submatrix. j >= 0.
+    @param[in]  m       Rows    of the submatrix. m >= 0, i+m <= desc->m.
+    @param[in]  n       Columns of the submatrix. n >= 0, j+n <= desc->n.
+    @param[in]  dA      Local matrix of dev, of dimension (desc->ldd,nloc).
+    @param[out] dbuf    Message, of dimension at least mloc*nloc, on the same
+                        device as dA.
+    @param[in]  queue   Queue to execute in.
+
+    @return Number of elements packed, mloc*nloc, or < 0 on argument error.
+
+    @ingroup magma_getmatrix_bcyclic
+*******************************************************************************/
+extern "C" magma_int_t
+magma_zpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA,
+    magmaDoubleComplex_ptr       dbuf,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( desc == NULL )
+        info = -1;
+    else if ( dev < 0 || dev >= desc->p*desc->q )
+        info = -2;
+    else if ( i < 0 )
+        info = -3;
+    else if ( j < 0 )
+        info = -4;
+    else if ( m < 0 || i+m > desc->m )
+        info = -5;
+    else if ( n < 0 || j+n > desc->n )
+        info = -6;
+    
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+    
+    magma_int_t il, jl, mloc, nloc;
+    magma_int_t ldd = desc->ldd;
+    magma_bcyclic_local_range( desc, dev, i, j, m, n, &il, &jl, &mloc, &nloc );
+    if (mloc > 0 && nloc > 0) {
+        #ifdef HAVE_clBLAS
+        magma_zcopymatrix( mloc, nloc, dA, il + jl*ldd, ldd, dbuf, 0, mloc, queue );
+        #else
+        magma_zcopymatrix( mloc, nloc, dA + il + jl*ldd, ldd, dbuf, mloc, queue );
+        #endif
+    }
+    return mloc*nloc;
+}
+
+
+/***************************************************************************//**
+    Unpack the contiguous message dbuf, packed by magma_zpackmatrix_2D_bcyclic
+    with the same arguments, into the part of the global submatrix
+    A(i:i+m-1, j:j+n-1) that is on participant dev.
+
+    @param[in]  desc    Descriptor of the distribution of A.
+    @param[in]  dev     Participant, 0 <= dev < p*q.
+    @param[in]  i       First global row of the submatrix.    i >= 0.
+    @param[in]  j       First global column of the submatrix. j >= 0.
+    @param[in]  m       Rows    of the submatrix. m >= 0, i+m <= desc->m.
+    @param[in]  n       Columns of the submatrix. n >= 0, j+n <= desc->n.
+    @param[in]  dbuf    Message, of dimension mloc*nloc, on the same device
+                        as dA.
+    @param[out] dA      Local matrix of dev, of dimension (desc->ldd,nloc).
+    @param[in]  queue   Queue to execute in.
+
+    @return Number of elements unpacked, mloc*nloc, or < 0 on argument error.
+
+    @ingroup magma_setmatrix_bcyclic
+*******************************************************************************/
+extern "C" magma_int_t
+magma_zunpackmatrix_2D_bcyclic(
+    const magma_bcyclic_t *desc, magma_int_t dev,
+    magma_int_t i, magma_int_t j, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dbuf,
+    magmaDoubleComplex_ptr       dA,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( desc == NULL )
+        info = -1;
+    else if ( dev < 0 || dev >= desc->p*desc->q )
+        info = -2;
+    else if ( i < 0 )
+        info = -3;
+    else if ( j < 0 )
+        info = -4;
+    else if ( m < 0 || i+m > desc->m )
+        info = -5;
+    else if ( n < 0 || j+n > desc->n )
+        info = -6;
+    
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+    
+    magma_int_t il, jl, mloc, nloc;
+    magma_int_t ldd = desc->ldd;
+    magma_bcyclic_local_range( desc, dev, i, j, m, n, &il, &jl, &mloc, &nloc );
+    if (mloc > 0 && nloc > 0) {
+        #ifdef HAVE_clBLAS
+        magma_zcopymatrix( mloc, nloc, dbuf, 0, mloc, dA, il + jl*ldd, ldd, queue );
+        #else
+        magma_zcopymatrix( mloc, nloc, dbuf, mloc, dA + il + jl*ldd, ldd, queue );
+        #endif
+    }
+    return mloc*nloc;
+}
@@ -0,0 +1,59 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zgemm.cpp, normal z -> c, Sat Oct 17 05:51:32 2026
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "gemm_template_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CGEMM performs one of the matrix-matrix operations
+    
+        C = alpha*op( A )*op( B ) + beta*C,
+    
+    Host backend version; for arguments, see magmablas/cgemm_fermi.cu.
+    Shapes for which gemm_config_host.hpp selects a version of
+    gemm_template_host, such as the tall-skinny and short-wide products of
+    panel and checksum updates whose large operand fits in cache (see
+    gemm_host_shape), run that single threaded on the queue;
+    others are magma_cgemm, i.e., the host BLAS gemm executed on the queue.
+
+    @ingroup magma_gemm
+*******************************************************************************/
+extern "C" void
+magmablas_cgemm(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaFloatComplex alpha,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_const_ptr dB, magma_int_t lddb,
+    magmaFloatComplex beta,
+    magmaFloatComplex_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    int version = gemm_host_tuned< magmaFloatComplex >::version( gemm_host_shape< magmaFloatComplex >( m, n, k ));
+    if (version == 0) {
+        magma_cgemm( transA, transB, m, n, k,
+                     alpha, dA, ldda,
+                            dB, lddb,
+                     beta,  dC, lddc, queue );
+    }
+    else {
+        magma_host_launch( queue, [=]() {
+            gemm_host_run( version, transA, transB, m, n, k,
+                           alpha, dA, ldda,
+                                  dB, lddb,
+                           beta,  dC, lddc );
+        });
+    }
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,68 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions mixed zc -> ds
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "convert_host.hpp"
+
+#define PRECISION_z
+
+// reals per element
+#if defined(PRECISION_z) || defined(PRECISION_c)
+const magma_int_t lanes = 2;
+#else
+const magma_int_t lanes = 1;
+#endif
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CLAG2Z converts a single-complex matrix, SA,
+                 to a double-complex matrix, A.
+    Host backend version; for arguments, see magmablas/clag2z.cu.
+    Uses the host conversion engine, as magma_clag2z_cpu.
+
+    @ingroup magma_lag2
+*******************************************************************************/
+extern "C" void
+magmablas_clag2z(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex_const_ptr SA, magma_int_t ldsa,
+    magmaDoubleComplex_ptr       A, magma_int_t lda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( m < 0 )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( ldsa < max(1,m) )
+        *info = -4;
+    else if ( lda < max(1,m) )
+        *info = -6;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    magma_host_launch( queue, [=]() {
+        magma_convert_host< float, double, false >(
+            MagmaFull, m, n, (const float*) SA, ldsa, (double*) A, lda, lanes, 0.f );
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,42 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zswap.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose:
+    =============
+    Swap vector x and y; \f$ x <-> y \f$.
+    Host backend version; for arguments, see magmablas/cswap.cu.
+
+    @ingroup magma_swap
+*******************************************************************************/
+extern "C" void
+magmablas_cswap(
+    magma_int_t n,
+    magmaFloatComplex_ptr dx, magma_int_t incx,
+    magmaFloatComplex_ptr dy, magma_int_t incy,
+    magma_queue_t queue )
+{
+    if ( n <= 0 )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        for( magma_int_t i = 0; i < n; ++i ) {
+            magmaFloatComplex tmp = dx[ i*incx ];
+            dx[ i*incx ] = dy[ i*incy ];
+            dy[ i*incy ] = tmp;
+        }
+    });
+}
+
+#endif // HAVE_HOST
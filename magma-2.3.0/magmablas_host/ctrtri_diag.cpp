@@ -0,0 +1,58 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/ztrtri_diag.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+
+       File named ctrtri_diag.cpp to avoid name conflict with src/ctrtri.o
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "trsm_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ctrtri_diag inverts the NB x NB diagonal blocks of A.
+    Host backend version; for arguments, see magmablas/ctrtri_diag.cu.
+    The blocks are inverted in parallel on the queue's cores, each by the
+    host LAPACK ctrtri, into the same d_dinvA layout as on the GPU, with
+    NB = 128; see control/trsm_host.hpp.
+
+    @ingroup magma_trtri_diag
+*******************************************************************************/
+extern "C" void
+magmablas_ctrtri_diag(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t n,
+    magmaFloatComplex_const_ptr dA, magma_int_t ldda,
+    magmaFloatComplex_ptr d_dinvA,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if (uplo != MagmaLower && uplo != MagmaUpper)
+        info = -1;
+    else if (diag != MagmaNonUnit && diag != MagmaUnit)
+        info = -2;
+    else if (n < 0)
+        info = -3;
+    else if (ldda < n)
+        info = -5;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    if (n == 0)
+        return;
+
+    magma_host_launch( queue, [=]() {
+        trsm_host_trtri_diag( uplo, diag, n, dA, ldda, d_dinvA );
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,37 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zaxpycp.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    adds   x += r  --and--
+    copies r = b
+    Host backend version; see magmablas/daxpycp.cu.
+*******************************************************************************/
+extern "C" void
+magmablas_daxpycp(
+    magma_int_t m,
+    magmaDouble_ptr r,
+    magmaDouble_ptr x,
+    magmaDouble_const_ptr b,
+    magma_queue_t queue )
+{
+    magma_host_launch( queue, [=]() {
+        #pragma omp parallel for simd schedule(static) if ( m >= 65536 )
+        for( magma_int_t i = 0; i < m; ++i ) {
+            x[i] = MAGMA_D_ADD( x[i], r[i] );
+            r[i] = b[i];
+        }
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,59 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zgemm.cpp, normal z -> d, Sat Oct 17 05:51:32 2026
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "gemm_template_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGEMM performs one of the matrix-matrix operations
+    
+        C = alpha*op( A )*op( B ) + beta*C,
+    
+    Host backend version; for arguments, see magmablas/dgemm_fermi.cu.
+    Shapes for which gemm_config_host.hpp selects a version of
+    gemm_template_host, such as the tall-skinny and short-wide products of
+    panel and checksum updates whose large operand fits in cache (see
+    gemm_host_shape), run that single threaded on the queue;
+    others are magma_dgemm, i.e., the host BLAS gemm executed on the queue.
+
+    @ingroup magma_gemm
+*******************************************************************************/
+extern "C" void
+magmablas_dgemm(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    double alpha,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_const_ptr dB, magma_int_t lddb,
+    double beta,
+    magmaDouble_ptr       dC, magma_int_t lddc,
+    magma_queue_t queue )
+{
+    int version = gemm_host_tuned< double >::version( gemm_host_shape< double >( m, n, k ));
+    if (version == 0) {
+        magma_dgemm( transA, transB, m, n, k,
+                     alpha, dA, ldda,
+                            dB, lddb,
+                     beta,  dC, lddc, queue );
+    }
+    else {
+        magma_host_launch( queue, [=]() {
+            gemm_host_run( version, transA, transB, m, n, k,
+                           alpha, dA, ldda,
+                                  dB, lddb,
+                           beta,  dC, lddc );
+        });
+    }
+}
+
+#endif // HAVE_HOST
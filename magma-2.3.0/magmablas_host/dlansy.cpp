@@ -0,0 +1,110 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zlanhe.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "norm_host.hpp"
+
+#define REAL
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DLANHE returns the value of the one norm, or the Frobenius norm, or
+    the infinity norm, or the element of largest absolute value of a
+    complex symmetric matrix A.
+    Host backend version; for arguments, see magmablas/dlansy.cu.
+    Uses the host norm engine in control/norm_host.hpp, which also supports
+    NORM = MagmaFrobeniusNorm; dwork is not used, but lwork is checked
+    as on the GPU.
+
+    @ingroup magma_lanhe
+*******************************************************************************/
+extern "C" double
+magmablas_dlansy(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr dwork, magma_int_t lwork,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( ! (norm == MagmaInfNorm || norm == MagmaMaxNorm || norm == MagmaOneNorm
+            || norm == MagmaFrobeniusNorm) )
+        info = -1;
+    else if ( uplo != MagmaUpper && uplo != MagmaLower )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < n )
+        info = -5;
+    else if ( norm != MagmaFrobeniusNorm && lwork < n )
+        info = -7;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+    
+    /* Quick return */
+    if ( n == 0 )
+        return 0;
+
+    magma_queue_sync( queue );
+    return magma_dlansy_cpu( norm, uplo, n, dA, ldda );
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    Purpose
+    -------
+    DLANSY returns the value of the one norm, or the Frobenius norm, or
+    the infinity norm, or the element of largest absolute value of a
+    complex symmetric matrix A.
+    Host backend version; arguments are the same as for magmablas_dlansy.
+    There is no GPU version.
+
+    @ingroup magma_lanhe
+*******************************************************************************/
+extern "C" double
+magmablas_dlansy(
+    magma_norm_t norm, magma_uplo_t uplo, magma_int_t n,
+    magmaDouble_const_ptr dA, magma_int_t ldda,
+    magmaDouble_ptr dwork, magma_int_t lwork,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( ! (norm == MagmaInfNorm || norm == MagmaMaxNorm || norm == MagmaOneNorm
+            || norm == MagmaFrobeniusNorm) )
+        info = -1;
+    else if ( uplo != MagmaUpper && uplo != MagmaLower )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < n )
+        info = -5;
+    else if ( norm != MagmaFrobeniusNorm && lwork < n )
+        info = -7;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return info;
+    }
+    
+    /* Quick return */
+    if ( n == 0 )
+        return 0;
+
+    magma_queue_sync( queue );
+    return magma_dlansy_cpu( norm, uplo, n, dA, ldda );
+}
+#endif // COMPLEX
+
+#endif // HAVE_HOST
@@ -0,0 +1,179 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zlaswp.cpp, normal z -> d, Sat Oct 17 05:51:32 2026
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "laswp_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose:
+    =============
+    DLASWP performs a series of row interchanges on the matrix A.
+    One row interchange is initiated for each of rows K1 through K2 of A.
+    
+    ** Unlike LAPACK, here A is stored row-wise (hence dAT). **
+    Otherwise, this is identical to LAPACK's interface.
+    
+    Host backend version; for arguments, see magmablas/dlaswp.cu.
+    The interchanges are composed into a permutation (magma_laswp_plan)
+    before this returns, so the caller may modify ipiv while they are
+    still queued; the permutation is applied by cycles, in parallel over
+    blocks of columns (see laswp_host.hpp).
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_dlaswp(
+    magma_int_t n,
+    magmaDouble_ptr dAT, magma_int_t ldda,
+    magma_int_t k1, magma_int_t k2,
+    const magma_int_t *ipiv, magma_int_t inci,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( n > ldda )
+        info = -3;
+    else if ( k1 < 1 )
+        info = -4;
+    else if ( k2 < 1 )
+        info = -5;
+    else if ( inci <= 0 )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( n == 0 || k2 < k1 )
+        return;
+
+    // ipiv is on the CPU, so compose the interchanges now
+    magma_laswp_plan plan( k1-1, k2-k1+1, ipiv + (k1-1)*inci, inci );
+    if ( plan.empty() )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_laswp_host_rows( plan, n, dAT, ldda );
+    });
+}
+
+
+/***************************************************************************//**
+    Purpose:
+    =============
+    DLASWPX performs a series of row interchanges on the matrix A.
+    One row interchange is initiated for each of rows K1 through K2 of A.
+    
+    ** Unlike LAPACK, here A is stored either row-wise or column-wise,
+       depending on ldx and ldy. **
+    Otherwise, this is identical to LAPACK's interface.
+    
+    Host backend version; for arguments, see magmablas/dlaswp.cu.
+    As magmablas_dlaswp, for row-wise (ldy = 1) or column-wise (ldx = 1)
+    storage; other strides are applied element by element.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_dlaswpx(
+    magma_int_t n,
+    magmaDouble_ptr dA, magma_int_t ldx, magma_int_t ldy,
+    magma_int_t k1, magma_int_t k2,
+    const magma_int_t *ipiv, magma_int_t inci,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( k1 < 0 )
+        info = -4;
+    else if ( k2 < 0 || k2 < k1 )
+        info = -5;
+    else if ( inci <= 0 )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( n == 0 || k1 < 1 )
+        return;
+
+    magma_laswp_plan plan( k1-1, k2-k1+1, ipiv + (k1-1)*inci, inci );
+    if ( plan.empty() )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        if ( ldy == 1 ) {
+            magma_laswp_host_rows( plan, n, dA, ldx );
+        }
+        else {
+            magma_laswp_host_cols( plan, n, dA, ldy,
+                                   [ldx]( magma_int_t r ) { return r*ldx; } );
+        }
+    });
+}
+
+
+/***************************************************************************//**
+    Purpose:
+    =============
+    DLASWP2 performs a series of row interchanges on the matrix A.
+    One row interchange is initiated for each of rows K1 through K2 of A.
+    
+    ** Unlike LAPACK, here A is stored row-wise (hence dAT). **
+    Otherwise, this is identical to LAPACK's interface.
+    
+    Here, d_ipiv is passed in device memory, and as for the device version,
+    its entries are relative to row K1: d_ipiv[ (k-K1)*inci ] = L implies
+    rows k and K1-1+L are interchanged.
+    Host backend version; for arguments, see magmablas/dlaswp.cu.
+    Since d_ipiv may be set by earlier work on the queue, the permutation
+    is composed when the interchanges execute.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_dlaswp2(
+    magma_int_t n,
+    magmaDouble_ptr dAT, magma_int_t ldda,
+    magma_int_t k1, magma_int_t k2,
+    magmaInt_const_ptr d_ipiv, magma_int_t inci,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( k1 < 0 )
+        info = -4;
+    else if ( k2 < 0 || k2 < k1 )
+        info = -5;
+    else if ( inci <= 0 )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( n == 0 || k1 < 1 )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_laswp_plan plan( k1-1, k2-k1+1, d_ipiv, inci, k1-1 );
+        magma_laswp_host_rows( plan, n, dAT, ldda );
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,73 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zlat2c.cpp, mixed zc -> ds, Wed Nov 15 00:34:20 2017
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "convert_host.hpp"
+
+#define PRECISION_d
+
+// reals per element
+#if defined(PRECISION_z) || defined(PRECISION_c)
+const magma_int_t lanes = 2;
+#else
+const magma_int_t lanes = 1;
+#endif
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DLAT2S converts a double-real matrix, A,
+                 to a single-real matrix, SA.
+    Only the triangle given by uplo, including the diagonal, is converted.
+    Host backend version; for arguments, see magmablas/dlat2s.cu.
+    Uses the host conversion engine; see magma_dlat2s_cpu, which also
+    reports which entry is out of range. Here, as on the GPU, INFO = 1.
+
+    @ingroup magma_lat2
+*******************************************************************************/
+extern "C" void
+magmablas_dlat2s(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDouble_const_ptr  A, magma_int_t lda,
+    magmaFloat_ptr        SA, magma_int_t ldsa,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -4;
+    else if ( ldsa < max(1,n) )
+        *info = -6;
+    
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( n == 0 ) {
+        return;
+    }
+    
+    double rmax = (double)lapackf77_slamch("O");
+
+    // info is needed on return, so run synchronously
+    magma_queue_sync( queue );
+    magma_int_t k = magma_convert_host< double, float, true >(
+        uplo, n, n, (const double*) A, lda, (float*) SA, ldsa, lanes, rmax );
+    *info = (k >= 0);
+}
+
+#endif // HAVE_HOST
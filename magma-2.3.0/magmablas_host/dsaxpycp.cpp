@@ -0,0 +1,39 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zcaxpycp.cpp, mixed zc -> ds, Wed Nov 15 00:34:20 2017
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    adds   x += r (including conversion to double)  --and--
+    copies w = b
+    Host backend version; see magmablas/dsaxpycp.cu.
+*******************************************************************************/
+extern "C" void
+magmablas_dsaxpycp(
+    magma_int_t m,
+    magmaFloat_ptr r,
+    magmaDouble_ptr x,
+    magmaDouble_const_ptr b,
+    magmaDouble_ptr w,
+    magma_queue_t queue )
+{
+    magma_host_launch( queue, [=]() {
+        #pragma omp parallel for simd schedule(static) if ( m >= 65536 )
+        for( magma_int_t i = 0; i < m; ++i ) {
+            x[i] = MAGMA_D_ADD( x[i], MAGMA_D_MAKE( MAGMA_D_REAL( r[i] ),
+                                                    MAGMA_D_IMAG( r[i] ) ) );
+            w[i] = b[i];
+        }
+    });
+}
+
+#endif // HAVE_HOST
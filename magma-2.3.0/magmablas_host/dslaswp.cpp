@@ -0,0 +1,61 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zclaswp.cpp, mixed zc -> ds, Wed Nov 15 00:34:20 2017
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    Row ipiv[i] of A is cast to single precision in row i of SA (incx >= 0), or
+    row ipiv[i] of SA is cast to double precision in row i of A (incx < 0),
+    for 0 <= i < M, as in the GPU version.
+    Host backend version; for arguments, see magmablas/dslaswp.cu.
+    Columns are gathered in parallel.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_dslaswp(
+    magma_int_t n,
+    magmaDouble_ptr A, magma_int_t lda,
+    magmaFloat_ptr SA, magma_int_t ldsa,
+    magma_int_t m,
+    const magma_int_t *ipiv, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_launch( queue, [=]() {
+        if (incx >= 0) {
+            #pragma omp parallel for schedule(static) if ( m*n >= 65536 )
+            for( magma_int_t j = 0; j < n; ++j ) {
+                const double *Aj = A  + j*lda;
+                float       *SAj = SA + j*ldsa;
+                for( magma_int_t i = 0; i < m; ++i ) {
+                    double tmp = Aj[ ipiv[i] ];
+                    SAj[i] = MAGMA_S_MAKE( MAGMA_D_REAL( tmp ), MAGMA_D_IMAG( tmp ));
+                }
+            }
+        }
+        else {
+            #pragma omp parallel for schedule(static) if ( m*n >= 65536 )
+            for( magma_int_t j = 0; j < n; ++j ) {
+                double      *Aj = A  + j*lda;
+                const float *SAj = SA + j*ldsa;
+                for( magma_int_t i = 0; i < m; ++i ) {
+                    float tmp = SAj[ ipiv[i] ];
+                    Aj[i] = MAGMA_D_MAKE( MAGMA_S_REAL( tmp ), MAGMA_S_IMAG( tmp ));
+                }
+            }
+        }
+    });
+}
+
+#endif // HAVE_HOST
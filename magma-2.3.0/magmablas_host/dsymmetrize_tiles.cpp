@@ -0,0 +1,62 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zsymmetrize_tiles.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "symmetric_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DSYMMETRIZE_TILES copies lower triangle to upper triangle, or vice-versa,
+    to make some blocks of dA into general representations of a symmetric block.
+    Host backend version; for arguments, see magmablas/dsymmetrize_tiles.cu.
+    Calls magma_dsymmetrize_tiles_cpu, which uses the host symmetric-storage
+    engine in control/symmetric_host.hpp.
+
+    @ingroup magma_symmetrize
+*******************************************************************************/
+extern "C" void
+magmablas_dsymmetrize_tiles(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaDouble_ptr dA, magma_int_t ldda,
+    magma_int_t ntile, magma_int_t mstride, magma_int_t nstride,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( ldda < max(1,m + mstride*(ntile-1)) )
+        info = -5;
+    else if ( ntile < 0 )
+        info = -6;
+    else if ( mstride < 0 )
+        info = -7;
+    else if ( nstride < 0 )
+        info = -8;
+    else if ( mstride < m && nstride < m )  // only one must be >= m.
+        info = -7;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+    
+    if ( m == 0 || ntile == 0 )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_dsymmetrize_tiles_cpu( uplo, m, dA, ldda, ntile, mstride, nstride );
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,291 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef GEMM_CONFIG_HOST_HPP
+#define GEMM_CONFIG_HOST_HPP
+
+// included by gemm_template_host.hpp
+
+#include "magma_threadsetting.h"
+
+/***************************************************************************//**
+    Configurations (versions) of gemm_template_host, and the version used
+    for each shape class; testing_zgemm_host_tune times every version on
+    each shape class and prints this table for the machine it runs on.
+
+    Version 0 is the host BLAS gemm.
+    Versions 1-3 have the register blocks of the AVX2 / AVX-512 kernels
+    (8x4 double, 16x4 double or float, 32x4 float); the others use the
+    generic kernel, with blocks for tall-skinny (small NR), short-wide
+    (small MR), and complex shapes.
+    Version 8 is gemm_template_host_direct, which does not pack the large
+    operand, for shapes with one small dimension.
+*******************************************************************************/
+const int gemm_host_nversions = 9;
+
+template< typename T, int V > struct gemm_host_version;
+
+//                                                      MR  NR   MC   KC    NC
+template< typename T > struct gemm_host_version< T, 1 >
+    : gemm_host_config<  8,  4, 128, 256, 1024 > {};
+template< typename T > struct gemm_host_version< T, 2 >
+    : gemm_host_config< 16,  4, 128, 256, 1024 > {};
+template< typename T > struct gemm_host_version< T, 3 >
+    : gemm_host_config< 32,  4, 128, 256, 1024 > {};
+template< typename T > struct gemm_host_version< T, 4 >
+    : gemm_host_config<  8,  2, 256, 512, 1024 > {};
+template< typename T > struct gemm_host_version< T, 5 >
+    : gemm_host_config< 16,  1, 256, 512, 1024 > {};
+template< typename T > struct gemm_host_version< T, 6 >
+    : gemm_host_config<  2,  8,  64, 512, 1024 > {};
+template< typename T > struct gemm_host_version< T, 7 >
+    : gemm_host_config<  4,  4,  64, 256,  512 > {};
+
+//                                                             IB
+template< typename T > struct gemm_host_version< T, 8 >
+    : gemm_host_direct_config< 256 > {};
+
+
+/***************************************************************************//**
+    Shape classes of an m-by-n-by-k GEMM.
+    gemm_host_small is for all dimensions small, as in batched GEMMs;
+    the others are for one small dimension, as in panel updates
+    (small n or k) and in ABFT checksum updates (small m or n).
+    A one-small-dimension class also requires its large operand, A for
+    small n, B for small m, C for small k, to fit in gemm_host_l2_bytes;
+    larger products are general, so they go to the threaded host BLAS
+    rather than a single-threaded template.
+*******************************************************************************/
+enum gemm_host_shape_t {
+    gemm_host_general = 0,
+    gemm_host_small   = 1,
+    gemm_host_small_m = 2,
+    gemm_host_small_n = 3,
+    gemm_host_small_k = 4,
+    gemm_host_nshapes = 5
+};
+
+// per-core L2 cache, as on most current x86 server cores
+const double gemm_host_l2_bytes = 1024*1024;
+
+template< typename T >
+static inline gemm_host_shape_t
+gemm_host_shape( magma_int_t m, magma_int_t n, magma_int_t k )
+{
+    const double l2 = gemm_host_l2_bytes / sizeof(T);
+    if (m <= 32 && n <= 32 && k <= 32)
+        return gemm_host_small;
+    else if (n <= 8 && double(m)*k <= l2)
+        return gemm_host_small_n;
+    else if (m <= 8 && double(k)*n <= l2)
+        return gemm_host_small_m;
+    else if (k <= 8 && double(m)*n <= l2)
+        return gemm_host_small_k;
+    else
+        return gemm_host_general;
+}
+
+
+/***************************************************************************//**
+    Version for each shape class, in the order of gemm_host_shape_t:
+    general, small, small m, small n, small k.
+    General is always version 0, the only one that is multithreaded.
+    Tuned with testing_zgemm_host_tune, -march=native, on one core of an
+    AVX-512 Xeon with OpenBLAS, which is faster than the template except
+    for the in-cache tall-skinny products (small n) in complex. With more
+    BLAS threads, a weaker host BLAS, or other flags or machines, rerun the
+    tuner; the kernels of versions 1-3 exist only when compiled with
+    -mavx2 -mfma or -mavx512f (e.g., -march=native).
+*******************************************************************************/
+template< typename T > struct gemm_host_tuned;
+
+template<> struct gemm_host_tuned< double > {
+    static int version( gemm_host_shape_t shape )
+    {
+        static const int v[ gemm_host_nshapes ] = { 0, 0, 0, 0, 0 };
+        return v[ shape ];
+    }
+};
+
+template<> struct gemm_host_tuned< float > {
+    static int version( gemm_host_shape_t shape )
+    {
+        static const int v[ gemm_host_nshapes ] = { 0, 0, 0, 0, 0 };
+        return v[ shape ];
+    }
+};
+
+template<> struct gemm_host_tuned< magmaDoubleComplex > {
+    static int version( gemm_host_shape_t shape )
+    {
+        static const int v[ gemm_host_nshapes ] = { 0, 0, 0, 8, 0 };
+        return v[ shape ];
+    }
+};
+
+template<> struct gemm_host_tuned< magmaFloatComplex > {
+    static int version( gemm_host_shape_t shape )
+    {
+        static const int v[ gemm_host_nshapes ] = { 0, 0, 0, 8, 0 };
+        return v[ shape ];
+    }
+};
+
+
+/******************************************************************************/
+// host BLAS gemm, version 0
+static inline void
+gemm_host_blas(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    double alpha, const double* A, magma_int_t lda,
+                  const double* B, magma_int_t ldb,
+    double beta,        double* C, magma_int_t ldc )
+{
+    blasf77_dgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                   &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+static inline void
+gemm_host_blas(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    float alpha, const float* A, magma_int_t lda,
+                 const float* B, magma_int_t ldb,
+    float beta,        float* C, magma_int_t ldc )
+{
+    blasf77_sgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                   &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+static inline void
+gemm_host_blas(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha, const magmaDoubleComplex* A, magma_int_t lda,
+                              const magmaDoubleComplex* B, magma_int_t ldb,
+    magmaDoubleComplex beta,        magmaDoubleComplex* C, magma_int_t ldc )
+{
+    blasf77_zgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                   &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+static inline void
+gemm_host_blas(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaFloatComplex alpha, const magmaFloatComplex* A, magma_int_t lda,
+                             const magmaFloatComplex* B, magma_int_t ldb,
+    magmaFloatComplex beta,        magmaFloatComplex* C, magma_int_t ldc )
+{
+    blasf77_cgemm( lapack_trans_const( transA ), lapack_trans_const( transB ),
+                   &m, &n, &k, &alpha, A, &lda, B, &ldb, &beta, C, &ldc );
+}
+
+
+/******************************************************************************/
+// Runs version V of gemm_template_host on one matrix, allocating the workspace.
+template< typename T, int V >
+void gemm_host_run_version(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    T alpha, const T* A, magma_int_t lda,
+             const T* B, magma_int_t ldb,
+    T beta,        T* C, magma_int_t ldc )
+{
+    typedef gemm_host_version< T, V > Config;
+    std::vector< T > work( max( 1, Config::lwork( m, n, k )));
+    gemm_host_run_config< T >(
+        Config(), transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, &work[0] );
+}
+
+
+/***************************************************************************//**
+    C = alpha*op(A)*op(B) + beta*C with the given version
+    (gemm_host_tuned< T >::version( gemm_host_shape< T >( m, n, k )) by default).
+    Single threaded except for version 0, which uses the threads of the
+    host BLAS.
+*******************************************************************************/
+template< typename T >
+void gemm_host_run(
+    int version,
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    T alpha, const T* A, magma_int_t lda,
+             const T* B, magma_int_t ldb,
+    T beta,        T* C, magma_int_t ldc )
+{
+    switch (version) {
+        case 1: gemm_host_run_version< T, 1 >( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); break;
+        case 2: gemm_host_run_version< T, 2 >( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); break;
+        case 3: gemm_host_run_version< T, 3 >( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); break;
+        case 4: gemm_host_run_version< T, 4 >( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); break;
+        case 5: gemm_host_run_version< T, 5 >( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); break;
+        case 6: gemm_host_run_version< T, 6 >( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); break;
+        case 7: gemm_host_run_version< T, 7 >( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); break;
+        case 8: gemm_host_run_version< T, 8 >( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc ); break;
+        default:
+            gemm_host_blas( transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc );
+            break;
+    }
+}
+
+
+/***************************************************************************//**
+    Batched and variable size batched GEMM with the given version; see
+    gemm_template_host_batched. Version 0 calls the host BLAS on each
+    matrix, with the matrices distributed over the OpenMP threads.
+*******************************************************************************/
+template< typename T >
+void gemm_host_run_batched(
+    int version,
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, const magma_int_t* m_array,
+    magma_int_t n, const magma_int_t* n_array,
+    magma_int_t k, const magma_int_t* k_array,
+    T alpha, T const * const * A_array, magma_int_t lda, const magma_int_t* lda_array,
+             T const * const * B_array, magma_int_t ldb, const magma_int_t* ldb_array,
+    T beta,  T**               C_array, magma_int_t ldc, const magma_int_t* ldc_array,
+    magma_int_t batchCount )
+{
+    #define GEMM_HOST_BATCHED( V ) \
+        gemm_template_host_batched< T, gemm_host_version< T, V > >( \
+            transA, transB, m, m_array, n, n_array, k, k_array, \
+            alpha, A_array, lda, lda_array, B_array, ldb, ldb_array, \
+            beta, C_array, ldc, ldc_array, batchCount )
+
+    switch (version) {
+        case 1: GEMM_HOST_BATCHED( 1 ); break;
+        case 2: GEMM_HOST_BATCHED( 2 ); break;
+        case 3: GEMM_HOST_BATCHED( 3 ); break;
+        case 4: GEMM_HOST_BATCHED( 4 ); break;
+        case 5: GEMM_HOST_BATCHED( 5 ); break;
+        case 6: GEMM_HOST_BATCHED( 6 ); break;
+        case 7: GEMM_HOST_BATCHED( 7 ); break;
+        case 8: GEMM_HOST_BATCHED( 8 ); break;
+        default: {
+            magma_int_t nthreads = magma_get_lapack_numthreads();
+            magma_set_lapack_numthreads( 1 );
+            #pragma omp parallel for schedule(dynamic) num_threads( min( nthreads, batchCount ))
+            for (magma_int_t s = 0; s < batchCount; ++s) {
+                gemm_host_blas( transA, transB,
+                                (m_array ? m_array[s] : m),
+                                (n_array ? n_array[s] : n),
+                                (k_array ? k_array[s] : k),
+                                alpha, A_array[s], (lda_array ? lda_array[s] : lda),
+                                       B_array[s], (ldb_array ? ldb_array[s] : ldb),
+                                beta,  C_array[s], (ldc_array ? ldc_array[s] : ldc) );
+            }
+            magma_set_lapack_numthreads( nthreads );
+            break;
+        }
+    }
+    #undef GEMM_HOST_BATCHED
+}
+
+#endif // GEMM_CONFIG_HOST_HPP
@@ -0,0 +1,554 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef GEMM_TEMPLATE_HOST_HPP
+#define GEMM_TEMPLATE_HOST_HPP
+
+#include <vector>
+
+#include "magma_internal.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/***************************************************************************//**
+    Host counterpart of gemm_template_device.cuh: a GEMM parameterized at
+    compile time, used by magmablas_*gemm, magmablas_*gemm_batched, and
+    magmablas_*gemm_vbatched with the host backend.
+
+    C = alpha*op(A)*op(B) + beta*C is computed in the usual way for caches:
+    op(B) is packed in KC-by-NC blocks of NR-wide column panels,
+    op(A) (times alpha) in MC-by-KC blocks of MR-tall row panels, and an
+    MR-by-NR micro-kernel accumulates each tile of C in registers.
+    The register block (MR, NR) and cache blocks (MC, KC, NC) form a
+    configuration; gemm_config_host.hpp lists the configurations (versions)
+    and which one each shape class uses, as the gemm_config headers do
+    for the device kernels.
+
+    The micro-kernels are in gemm_template_host_defs.hpp: a generic one for
+    any type and (MR, NR), and AVX2 / AVX-512 ones for real precisions that
+    are compiled in when the compiler targets those instruction sets.
+*******************************************************************************/
+
+/******************************************************************************/
+template< typename T > struct gemm_host_traits;
+
+template<> struct gemm_host_traits< double > {
+    static double make( double r ) { return r; }
+};
+
+template<> struct gemm_host_traits< float > {
+    static float make( double r ) { return float( r ); }
+};
+
+template<> struct gemm_host_traits< magmaDoubleComplex > {
+    static magmaDoubleComplex make( double r ) { return MAGMA_Z_MAKE( r, 0 ); }
+};
+
+template<> struct gemm_host_traits< magmaFloatComplex > {
+    static magmaFloatComplex make( double r ) { return MAGMA_C_MAKE( float( r ), 0 ); }
+};
+
+
+/***************************************************************************//**
+    Configuration of the template: register block MR-by-NR, and cache
+    blocks MC-by-KC of op(A) and KC-by-NC of op(B).
+    MC must be a multiple of MR, and NC a multiple of NR.
+*******************************************************************************/
+template< int MR_, int NR_, int MC_, int KC_, int NC_ >
+struct gemm_host_config
+{
+    static const int MR = MR_;
+    static const int NR = NR_;
+    static const int MC = MC_;
+    static const int KC = KC_;
+    static const int NC = NC_;
+
+    /// size of the packed block of op(A), in elements, for an m-by-n-by-k GEMM
+    static magma_int_t lwork_A( magma_int_t m, magma_int_t k )
+        { return magma_roundup( min( MC, m ), MR ) * min( KC, k ); }
+
+    /// workspace, in elements, for the packed blocks of an m-by-n-by-k GEMM
+    static magma_int_t lwork( magma_int_t m, magma_int_t n, magma_int_t k )
+        { return lwork_A( m, k ) + min( KC, k ) * magma_roundup( min( NC, n ), NR ); }
+};
+
+
+/***************************************************************************//**
+    Configuration of the direct template, for shapes with one small
+    dimension: only the small operand(s) are copied, and the large one is
+    read once, in place; IB is the block of rows of C kept in cache.
+*******************************************************************************/
+template< int IB_ >
+struct gemm_host_direct_config
+{
+    static const int IB = IB_;
+
+    /// workspace, in elements, for the copied operands of an m-by-n-by-k GEMM
+    static magma_int_t lwork( magma_int_t m, magma_int_t n, magma_int_t k )
+    {
+        if (n <= m && n <= k)
+            return k*n;        // small n: op(B)
+        else if (m <= k)
+            return m*k;        // small m: op(A)^T
+        else
+            return m*k + k*n;  // small k: op(A) and op(B)
+    }
+};
+
+#include "gemm_template_host_defs.hpp"
+
+
+/******************************************************************************/
+// C = beta*C, setting C to zero if beta = 0.
+template< typename T >
+void gemm_host_scale_C(
+    magma_int_t m, magma_int_t n, T beta, T* C, magma_int_t ldc )
+{
+    const T zero = gemm_host_traits< T >::make( 0 );
+    const T one  = gemm_host_traits< T >::make( 1 );
+    if (beta == zero) {
+        for (magma_int_t j = 0; j < n; ++j)
+            for (magma_int_t i = 0; i < m; ++i)
+                C[ i + j*ldc ] = zero;
+    }
+    else if (beta != one) {
+        for (magma_int_t j = 0; j < n; ++j)
+            for (magma_int_t i = 0; i < m; ++i)
+                C[ i + j*ldc ] *= beta;
+    }
+}
+
+
+/******************************************************************************/
+// Y = alpha*X, alpha*X^T, alpha*conj(X), or alpha*X^H, where Y is rows-by-cols.
+template< typename T >
+void gemm_host_copy(
+    bool trans, bool conjugate, magma_int_t rows, magma_int_t cols, T alpha,
+    const T* X, magma_int_t ldx, T* Y, magma_int_t ldy )
+{
+    for (magma_int_t c = 0; c < cols; ++c) {
+        T* y = Y + c*ldy;
+        if (! trans) {
+            const T* x = X + c*ldx;
+            if (conjugate) {
+                for (magma_int_t r = 0; r < rows; ++r)
+                    y[r] = alpha * conj( x[r] );
+            }
+            else {
+                for (magma_int_t r = 0; r < rows; ++r)
+                    y[r] = alpha * x[r];
+            }
+        }
+        else {
+            const T* x = X + c;
+            if (conjugate) {
+                for (magma_int_t r = 0; r < rows; ++r)
+                    y[r] = alpha * conj( x[ r*ldx ] );
+            }
+            else {
+                for (magma_int_t r = 0; r < rows; ++r)
+                    y[r] = alpha * x[ r*ldx ];
+            }
+        }
+    }
+}
+
+
+/******************************************************************************/
+// x^T y, with 4 partial sums so the additions overlap.
+template< typename T >
+T gemm_host_dot( magma_int_t k, const T* x, const T* y )
+{
+    const T zero = gemm_host_traits< T >::make( 0 );
+    T s0 = zero, s1 = zero, s2 = zero, s3 = zero;
+    magma_int_t p = 0;
+    for (; p + 4 <= k; p += 4) {
+        s0 += x[p  ] * y[p  ];
+        s1 += x[p+1] * y[p+1];
+        s2 += x[p+2] * y[p+2];
+        s3 += x[p+3] * y[p+3];
+    }
+    for (; p < k; ++p)
+        s0 += x[p] * y[p];
+    return (s0 + s1) + (s2 + s3);
+}
+
+
+/***************************************************************************//**
+    Packs op(A)(0:mc-1, 0:kc-1), scaled by alpha, into row panels of height
+    MR: element (i,p) goes to Ap[ (i/MR)*MR*kc + p*MR + i%MR ].
+    The last panel is padded with zeros.
+*******************************************************************************/
+template< typename T, int MR >
+void gemm_host_pack_A(
+    magma_trans_t transA, magma_int_t mc, magma_int_t kc, T alpha,
+    const T* A, magma_int_t lda, T* Ap )
+{
+    const T zero = gemm_host_traits< T >::make( 0 );
+    for (magma_int_t ir = 0; ir < mc; ir += MR) {
+        magma_int_t mr = min( MR, mc - ir );
+        T* ap = Ap + ir*kc;
+        if (transA == MagmaNoTrans) {
+            for (magma_int_t p = 0; p < kc; ++p) {
+                const T* a = A + ir + p*lda;
+                for (magma_int_t i = 0; i < mr; ++i)
+                    ap[ p*MR + i ] = alpha * a[i];
+                for (magma_int_t i = mr; i < MR; ++i)
+                    ap[ p*MR + i ] = zero;
+            }
+        }
+        else {
+            for (magma_int_t p = 0; p < kc; ++p) {
+                for (magma_int_t i = mr; i < MR; ++i)
+                    ap[ p*MR + i ] = zero;
+            }
+            for (magma_int_t i = 0; i < mr; ++i) {
+                const T* a = A + (ir + i)*lda;
+                if (transA == MagmaConjTrans) {
+                    for (magma_int_t p = 0; p < kc; ++p)
+                        ap[ p*MR + i ] = alpha * conj( a[p] );
+                }
+                else {
+                    for (magma_int_t p = 0; p < kc; ++p)
+                        ap[ p*MR + i ] = alpha * a[p];
+                }
+            }
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    Packs op(B)(0:kc-1, 0:nc-1) into column panels of width NR:
+    element (p,j) goes to Bp[ (j/NR)*NR*kc + p*NR + j%NR ].
+    The last panel is padded with zeros.
+*******************************************************************************/
+template< typename T, int NR >
+void gemm_host_pack_B(
+    magma_trans_t transB, magma_int_t kc, magma_int_t nc,
+    const T* B, magma_int_t ldb, T* Bp )
+{
+    const T zero = gemm_host_traits< T >::make( 0 );
+    for (magma_int_t jr = 0; jr < nc; jr += NR) {
+        magma_int_t nr = min( NR, nc - jr );
+        T* bp = Bp + jr*kc;
+        if (transB == MagmaNoTrans) {
+            for (magma_int_t j = 0; j < nr; ++j) {
+                const T* b = B + (jr + j)*ldb;
+                for (magma_int_t p = 0; p < kc; ++p)
+                    bp[ p*NR + j ] = b[p];
+            }
+            for (magma_int_t p = 0; p < kc; ++p) {
+                for (magma_int_t j = nr; j < NR; ++j)
+                    bp[ p*NR + j ] = zero;
+            }
+        }
+        else {
+            for (magma_int_t p = 0; p < kc; ++p) {
+                const T* b = B + jr + p*ldb;
+                if (transB == MagmaConjTrans) {
+                    for (magma_int_t j = 0; j < nr; ++j)
+                        bp[ p*NR + j ] = conj( b[j] );
+                }
+                else {
+                    for (magma_int_t j = 0; j < nr; ++j)
+                        bp[ p*NR + j ] = b[j];
+                }
+                for (magma_int_t j = nr; j < NR; ++j)
+                    bp[ p*NR + j ] = zero;
+            }
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    C = alpha*op(A)*op(B) + beta*C for one matrix, single threaded, with
+    configuration Config. Arguments are as for blasf77_*gemm and are not
+    checked. work has Config::lwork( m, n, k ) elements.
+*******************************************************************************/
+template< typename T, typename Config >
+void gemm_template_host(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    T alpha, const T* A, magma_int_t lda,
+             const T* B, magma_int_t ldb,
+    T beta,        T* C, magma_int_t ldc,
+    T* work )
+{
+    const int MR = Config::MR, NR = Config::NR;
+    const int MC = Config::MC, KC = Config::KC, NC = Config::NC;
+    const T zero = gemm_host_traits< T >::make( 0 );
+
+    if (m <= 0 || n <= 0)
+        return;
+
+    // C = beta*C once; the micro-kernels then accumulate into C
+    gemm_host_scale_C( m, n, beta, C, ldc );
+    if (k <= 0 || alpha == zero)
+        return;
+
+    T* Ap = work;
+    T* Bp = work + Config::lwork_A( m, k );
+    for (magma_int_t jc = 0; jc < n; jc += NC) {
+        magma_int_t nc = min( NC, n - jc );
+        for (magma_int_t pc = 0; pc < k; pc += KC) {
+            magma_int_t kc = min( KC, k - pc );
+            const T* Bjc = (transB == MagmaNoTrans ? B + pc + jc*ldb : B + jc + pc*ldb);
+            gemm_host_pack_B< T, NR >( transB, kc, nc, Bjc, ldb, Bp );
+
+            for (magma_int_t ic = 0; ic < m; ic += MC) {
+                magma_int_t mc = min( MC, m - ic );
+                const T* Aic = (transA == MagmaNoTrans ? A + ic + pc*lda : A + pc + ic*lda);
+                gemm_host_pack_A< T, MR >( transA, mc, kc, alpha, Aic, lda, Ap );
+
+                for (magma_int_t jr = 0; jr < nc; jr += NR) {
+                    magma_int_t nr = min( NR, nc - jr );
+                    for (magma_int_t ir = 0; ir < mc; ir += MR) {
+                        magma_int_t mr = min( MR, mc - ir );
+                        gemm_host_kernel< T, MR, NR >::run(
+                            kc, Ap + ir*kc, Bp + jr*kc,
+                            C + (ic + ir) + (jc + jr)*ldc, ldc, mr, nr );
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/***************************************************************************//**
+    C = alpha*op(A)*op(B) + beta*C for one matrix, single threaded, without
+    packing the large operand, for shapes with one small dimension, where
+    the GEMM is bound by reading that operand (or C) from memory:
+      - small n: alpha*op(B) is copied; C is updated in blocks of IB rows,
+        reading each column of A once (or as dot products, if A is transposed);
+      - small m: alpha*op(A)^T is copied; each column of C is a set of dot
+        products with a column of B (or is accumulated over a block of IB
+        rows of B, if B is transposed);
+      - small k: both operands are copied, and C is updated column by column.
+    The case is chosen by the smallest dimension, so any shape is correct.
+    work has gemm_host_direct_config< IB >::lwork( m, n, k ) elements.
+*******************************************************************************/
+template< typename T, int IB >
+void gemm_template_host_direct(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    T alpha, const T* A, magma_int_t lda,
+             const T* B, magma_int_t ldb,
+    T beta,        T* C, magma_int_t ldc,
+    T* work )
+{
+    const T zero = gemm_host_traits< T >::make( 0 );
+    const T one  = gemm_host_traits< T >::make( 1 );
+
+    if (m <= 0 || n <= 0)
+        return;
+
+    gemm_host_scale_C( m, n, beta, C, ldc );
+    if (k <= 0 || alpha == zero)
+        return;
+
+    if (n <= m && n <= k) {
+        // small n: Bs = alpha*op(B), k-by-n
+        T* Bs = work;
+        gemm_host_copy( transB != MagmaNoTrans, transB == MagmaConjTrans,
+                        k, n, alpha, B, ldb, Bs, k );
+        if (transA == MagmaNoTrans) {
+            // 4 columns of A per pass over the block of C
+            for (magma_int_t ib = 0; ib < m; ib += IB) {
+                magma_int_t mb = min( IB, m - ib );
+                magma_int_t p = 0;
+                for (; p + 4 <= k; p += 4) {
+                    const T* a0 = A + ib + p*lda;
+                    const T* a1 = a0 + lda;
+                    const T* a2 = a1 + lda;
+                    const T* a3 = a2 + lda;
+                    for (magma_int_t j = 0; j < n; ++j) {
+                        const T* b = Bs + p + j*k;
+                        T b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3];
+                        T* c = C + ib + j*ldc;
+                        #pragma omp simd
+                        for (magma_int_t i = 0; i < mb; ++i)
+                            c[i] += a0[i]*b0 + a1[i]*b1 + a2[i]*b2 + a3[i]*b3;
+                    }
+                }
+                for (; p < k; ++p) {
+                    const T* a = A + ib + p*lda;
+                    for (magma_int_t j = 0; j < n; ++j) {
+                        T b = Bs[ p + j*k ];
+                        T* c = C + ib + j*ldc;
+                        #pragma omp simd
+                        for (magma_int_t i = 0; i < mb; ++i)
+                            c[i] += a[i] * b;
+                    }
+                }
+            }
+        }
+        else {
+            // row i of op(A) is column i of A
+            for (magma_int_t i = 0; i < m; ++i) {
+                const T* a = A + i*lda;
+                for (magma_int_t j = 0; j < n; ++j) {
+                    const T* b = Bs + j*k;
+                    if (transA == MagmaConjTrans) {
+                        T s = zero;
+                        for (magma_int_t p = 0; p < k; ++p)
+                            s += conj( a[p] ) * b[p];
+                        C[ i + j*ldc ] += s;
+                    }
+                    else {
+                        C[ i + j*ldc ] += gemm_host_dot( k, a, b );
+                    }
+                }
+            }
+        }
+    }
+    else if (m <= k) {
+        // small m: As = alpha*op(A)^T, k-by-m, so rows of op(A) are contiguous
+        T* As = work;
+        gemm_host_copy( transA == MagmaNoTrans, transA == MagmaConjTrans,
+                        k, m, alpha, A, lda, As, k );
+        if (transB == MagmaNoTrans) {
+            for (magma_int_t j = 0; j < n; ++j) {
+                const T* b = B + j*ldb;
+                for (magma_int_t i = 0; i < m; ++i) {
+                    C[ i + j*ldc ] += gemm_host_dot( k, As + i*k, b );
+                }
+            }
+        }
+        else {
+            // column j of op(B) is row j of B; accumulate IB columns of C at once
+            T acc[ IB ];
+            for (magma_int_t jb = 0; jb < n; jb += IB) {
+                magma_int_t nb = min( IB, n - jb );
+                for (magma_int_t i = 0; i < m; ++i) {
+                    const T* a = As + i*k;
+                    for (magma_int_t j = 0; j < nb; ++j)
+                        acc[j] = zero;
+                    for (magma_int_t p = 0; p < k; ++p) {
+                        const T* b = B + jb + p*ldb;
+                        T ap = a[p];
+                        if (transB == MagmaConjTrans) {
+                            for (magma_int_t j = 0; j < nb; ++j)
+                                acc[j] += ap * conj( b[j] );
+                        }
+                        else {
+                            #pragma omp simd
+                            for (magma_int_t j = 0; j < nb; ++j)
+                                acc[j] += ap * b[j];
+                        }
+                    }
+                    for (magma_int_t j = 0; j < nb; ++j)
+                        C[ i + (jb + j)*ldc ] += acc[j];
+                }
+            }
+        }
+    }
+    else {
+        // small k: As = alpha*op(A), m-by-k; Bs = op(B), k-by-n
+        T* As = work;
+        T* Bs = work + m*k;
+        gemm_host_copy( transA != MagmaNoTrans, transA == MagmaConjTrans,
+                        m, k, alpha, A, lda, As, m );
+        gemm_host_copy( transB != MagmaNoTrans, transB == MagmaConjTrans,
+                        k, n, one, B, ldb, Bs, k );
+        for (magma_int_t j = 0; j < n; ++j) {
+            for (magma_int_t ib = 0; ib < m; ib += IB) {
+                magma_int_t mb = min( IB, m - ib );
+                T* c = C + ib + j*ldc;
+                for (magma_int_t p = 0; p < k; ++p) {
+                    const T* a = As + ib + p*m;
+                    T b = Bs[ p + j*k ];
+                    #pragma omp simd
+                    for (magma_int_t i = 0; i < mb; ++i)
+                        c[i] += a[i] * b;
+                }
+            }
+        }
+    }
+}
+
+
+/******************************************************************************/
+// Runs gemm_template_host or gemm_template_host_direct, depending on the
+// type of configuration.
+template< typename T, int MR, int NR, int MC, int KC, int NC >
+void gemm_host_run_config(
+    const gemm_host_config< MR, NR, MC, KC, NC >&,
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    T alpha, const T* A, magma_int_t lda,
+             const T* B, magma_int_t ldb,
+    T beta,        T* C, magma_int_t ldc,
+    T* work )
+{
+    gemm_template_host< T, gemm_host_config< MR, NR, MC, KC, NC > >(
+        transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, work );
+}
+
+template< typename T, int IB >
+void gemm_host_run_config(
+    const gemm_host_direct_config< IB >&,
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    T alpha, const T* A, magma_int_t lda,
+             const T* B, magma_int_t ldb,
+    T beta,        T* C, magma_int_t ldc,
+    T* work )
+{
+    gemm_template_host_direct< T, IB >(
+        transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, work );
+}
+
+
+/***************************************************************************//**
+    Batched and variable size batched GEMM: each matrix is done by
+    gemm_template_host (or gemm_template_host_direct), and the matrices are distributed over the OpenMP
+    threads, each with its own workspace.
+    For a fixed size batch, m_array, ..., ldc_array are NULL;
+    otherwise they give the sizes of each matrix.
+*******************************************************************************/
+template< typename T, typename Config >
+void gemm_template_host_batched(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, const magma_int_t* m_array,
+    magma_int_t n, const magma_int_t* n_array,
+    magma_int_t k, const magma_int_t* k_array,
+    T alpha, T const * const * A_array, magma_int_t lda, const magma_int_t* lda_array,
+             T const * const * B_array, magma_int_t ldb, const magma_int_t* ldb_array,
+    T beta,  T**               C_array, magma_int_t ldc, const magma_int_t* ldc_array,
+    magma_int_t batchCount )
+{
+    magma_int_t nthreads = min( magma_get_parallel_numthreads(), batchCount );
+    #pragma omp parallel num_threads( nthreads )
+    {
+        std::vector< T > work;
+        #pragma omp for schedule(dynamic)
+        for (magma_int_t s = 0; s < batchCount; ++s) {
+            magma_int_t ms = (m_array ? m_array[s] : m);
+            magma_int_t ns = (n_array ? n_array[s] : n);
+            magma_int_t ks = (k_array ? k_array[s] : k);
+            magma_int_t lwork = max( 1, Config::lwork( ms, ns, ks ));
+            if (magma_int_t( work.size() ) < lwork)
+                work.resize( lwork );
+            gemm_host_run_config< T >(
+                Config(), transA, transB, ms, ns, ks,
+                alpha, A_array[s], (lda_array ? lda_array[s] : lda),
+                       B_array[s], (ldb_array ? ldb_array[s] : ldb),
+                beta,  C_array[s], (ldc_array ? ldc_array[s] : ldc),
+                &work[0] );
+        }
+    }
+}
+
+#include "gemm_config_host.hpp"
+
+#endif // GEMM_TEMPLATE_HOST_HPP
@@ -0,0 +1,274 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+
+#ifndef GEMM_TEMPLATE_HOST_DEFS_HPP
+#define GEMM_TEMPLATE_HOST_DEFS_HPP
+
+// included by gemm_template_host.hpp
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+/***************************************************************************//**
+    Micro-kernel of gemm_template_host:
+        C(0:mr-1, 0:nr-1) += Ap * Bp,
+    where Ap is an MR-by-kc row panel packed by gemm_host_pack_A,
+    Bp is a kc-by-NR column panel packed by gemm_host_pack_B,
+    and mr <= MR, nr <= NR for tiles at the edges of C.
+
+    The generic kernel accumulates in an MR-by-NR array, vectorized along
+    its longer side; the compiler keeps it in registers for small blocks.
+*******************************************************************************/
+template< typename T, int MR, int NR >
+struct gemm_host_kernel
+{
+    static void run(
+        magma_int_t kc, const T* Ap, const T* Bp,
+        T* C, magma_int_t ldc, magma_int_t mr, magma_int_t nr )
+    {
+        const T zero = gemm_host_traits< T >::make( 0 );
+        T ab[ NR ][ MR ];
+        for (int j = 0; j < NR; ++j)
+            for (int i = 0; i < MR; ++i)
+                ab[j][i] = zero;
+
+        for (magma_int_t p = 0; p < kc; ++p) {
+            const T* a = Ap + p*MR;
+            const T* b = Bp + p*NR;
+            if (MR >= NR) {
+                for (int j = 0; j < NR; ++j) {
+                    T bj = b[j];
+                    #pragma omp simd
+                    for (int i = 0; i < MR; ++i)
+                        ab[j][i] += a[i] * bj;
+                }
+            }
+            else {
+                for (int i = 0; i < MR; ++i) {
+                    T ai = a[i];
+                    #pragma omp simd
+                    for (int j = 0; j < NR; ++j)
+                        ab[j][i] += ai * b[j];
+                }
+            }
+        }
+
+        for (magma_int_t j = 0; j < nr; ++j)
+            for (magma_int_t i = 0; i < mr; ++i)
+                C[ i + j*ldc ] += ab[j][i];
+    }
+};
+
+
+/******************************************************************************/
+// Adds the accumulated tile ab (column major, leading dimension MR) to an
+// edge tile of C.
+template< typename T, int MR >
+static inline void gemm_host_kernel_edge(
+    const T* ab, T* C, magma_int_t ldc, magma_int_t mr, magma_int_t nr )
+{
+    for (magma_int_t j = 0; j < nr; ++j)
+        for (magma_int_t i = 0; i < mr; ++i)
+            C[ i + j*ldc ] += ab[ i + j*MR ];
+}
+
+
+#if defined(__AVX2__) && defined(__FMA__)
+/******************************************************************************/
+// AVX2: 8x4 double, 16x4 float; two vectors per column of the tile.
+// The accumulators are separate variables, rather than arrays, so that they
+// stay in registers without relying on the compiler unrolling loops (-O2).
+template<>
+struct gemm_host_kernel< double, 8, 4 >
+{
+    static void run(
+        magma_int_t kc, const double* Ap, const double* Bp,
+        double* C, magma_int_t ldc, magma_int_t mr, magma_int_t nr )
+    {
+        __m256d c00 = _mm256_setzero_pd(), c10 = _mm256_setzero_pd();
+        __m256d c01 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+        __m256d c02 = _mm256_setzero_pd(), c12 = _mm256_setzero_pd();
+        __m256d c03 = _mm256_setzero_pd(), c13 = _mm256_setzero_pd();
+        for (magma_int_t p = 0; p < kc; ++p) {
+            __m256d a0 = _mm256_loadu_pd( Ap + p*8     );
+            __m256d a1 = _mm256_loadu_pd( Ap + p*8 + 4 );
+            __m256d b;
+            b = _mm256_broadcast_sd( Bp + p*4     );
+            c00 = _mm256_fmadd_pd( a0, b, c00 );
+            c10 = _mm256_fmadd_pd( a1, b, c10 );
+            b = _mm256_broadcast_sd( Bp + p*4 + 1 );
+            c01 = _mm256_fmadd_pd( a0, b, c01 );
+            c11 = _mm256_fmadd_pd( a1, b, c11 );
+            b = _mm256_broadcast_sd( Bp + p*4 + 2 );
+            c02 = _mm256_fmadd_pd( a0, b, c02 );
+            c12 = _mm256_fmadd_pd( a1, b, c12 );
+            b = _mm256_broadcast_sd( Bp + p*4 + 3 );
+            c03 = _mm256_fmadd_pd( a0, b, c03 );
+            c13 = _mm256_fmadd_pd( a1, b, c13 );
+        }
+        double ab[ 8*4 ];
+        _mm256_storeu_pd( ab,      c00 );  _mm256_storeu_pd( ab +  4, c10 );
+        _mm256_storeu_pd( ab +  8, c01 );  _mm256_storeu_pd( ab + 12, c11 );
+        _mm256_storeu_pd( ab + 16, c02 );  _mm256_storeu_pd( ab + 20, c12 );
+        _mm256_storeu_pd( ab + 24, c03 );  _mm256_storeu_pd( ab + 28, c13 );
+        if (mr == 8 && nr == 4) {
+            for (int j = 0; j < 4; ++j) {
+                double* cj = C + j*ldc;
+                _mm256_storeu_pd( cj,     _mm256_add_pd( _mm256_loadu_pd( cj     ), _mm256_loadu_pd( ab + j*8     )));
+                _mm256_storeu_pd( cj + 4, _mm256_add_pd( _mm256_loadu_pd( cj + 4 ), _mm256_loadu_pd( ab + j*8 + 4 )));
+            }
+        }
+        else {
+            gemm_host_kernel_edge< double, 8 >( ab, C, ldc, mr, nr );
+        }
+    }
+};
+
+template<>
+struct gemm_host_kernel< float, 16, 4 >
+{
+    static void run(
+        magma_int_t kc, const float* Ap, const float* Bp,
+        float* C, magma_int_t ldc, magma_int_t mr, magma_int_t nr )
+    {
+        __m256 c00 = _mm256_setzero_ps(), c10 = _mm256_setzero_ps();
+        __m256 c01 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+        __m256 c02 = _mm256_setzero_ps(), c12 = _mm256_setzero_ps();
+        __m256 c03 = _mm256_setzero_ps(), c13 = _mm256_setzero_ps();
+        for (magma_int_t p = 0; p < kc; ++p) {
+            __m256 a0 = _mm256_loadu_ps( Ap + p*16     );
+            __m256 a1 = _mm256_loadu_ps( Ap + p*16 + 8 );
+            __m256 b;
+            b = _mm256_broadcast_ss( Bp + p*4     );
+            c00 = _mm256_fmadd_ps( a0, b, c00 );
+            c10 = _mm256_fmadd_ps( a1, b, c10 );
+            b = _mm256_broadcast_ss( Bp + p*4 + 1 );
+            c01 = _mm256_fmadd_ps( a0, b, c01 );
+            c11 = _mm256_fmadd_ps( a1, b, c11 );
+            b = _mm256_broadcast_ss( Bp + p*4 + 2 );
+            c02 = _mm256_fmadd_ps( a0, b, c02 );
+            c12 = _mm256_fmadd_ps( a1, b, c12 );
+            b = _mm256_broadcast_ss( Bp + p*4 + 3 );
+            c03 = _mm256_fmadd_ps( a0, b, c03 );
+            c13 = _mm256_fmadd_ps( a1, b, c13 );
+        }
+        float ab[ 16*4 ];
+        _mm256_storeu_ps( ab,      c00 );  _mm256_storeu_ps( ab +  8, c10 );
+        _mm256_storeu_ps( ab + 16, c01 );  _mm256_storeu_ps( ab + 24, c11 );
+        _mm256_storeu_ps( ab + 32, c02 );  _mm256_storeu_ps( ab + 40, c12 );
+        _mm256_storeu_ps( ab + 48, c03 );  _mm256_storeu_ps( ab + 56, c13 );
+        if (mr == 16 && nr == 4) {
+            for (int j = 0; j < 4; ++j) {
+                float* cj = C + j*ldc;
+                _mm256_storeu_ps( cj,     _mm256_add_ps( _mm256_loadu_ps( cj     ), _mm256_loadu_ps( ab + j*16     )));
+                _mm256_storeu_ps( cj + 8, _mm256_add_ps( _mm256_loadu_ps( cj + 8 ), _mm256_loadu_ps( ab + j*16 + 8 )));
+            }
+        }
+        else {
+            gemm_host_kernel_edge< float, 16 >( ab, C, ldc, mr, nr );
+        }
+    }
+};
+#endif // __AVX2__ && __FMA__
+
+
+#if defined(__AVX512F__)
+/******************************************************************************/
+// AVX-512: 16x4 double, 32x4 float; two vectors per column of the tile.
+// Edge tiles use masked loads and stores for the rows.
+template<>
+struct gemm_host_kernel< double, 16, 4 >
+{
+    static void run(
+        magma_int_t kc, const double* Ap, const double* Bp,
+        double* C, magma_int_t ldc, magma_int_t mr, magma_int_t nr )
+    {
+        __m512d c00 = _mm512_setzero_pd(), c10 = _mm512_setzero_pd();
+        __m512d c01 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+        __m512d c02 = _mm512_setzero_pd(), c12 = _mm512_setzero_pd();
+        __m512d c03 = _mm512_setzero_pd(), c13 = _mm512_setzero_pd();
+        for (magma_int_t p = 0; p < kc; ++p) {
+            __m512d a0 = _mm512_loadu_pd( Ap + p*16     );
+            __m512d a1 = _mm512_loadu_pd( Ap + p*16 + 8 );
+            __m512d b;
+            b = _mm512_set1_pd( Bp[ p*4     ] );
+            c00 = _mm512_fmadd_pd( a0, b, c00 );
+            c10 = _mm512_fmadd_pd( a1, b, c10 );
+            b = _mm512_set1_pd( Bp[ p*4 + 1 ] );
+            c01 = _mm512_fmadd_pd( a0, b, c01 );
+            c11 = _mm512_fmadd_pd( a1, b, c11 );
+            b = _mm512_set1_pd( Bp[ p*4 + 2 ] );
+            c02 = _mm512_fmadd_pd( a0, b, c02 );
+            c12 = _mm512_fmadd_pd( a1, b, c12 );
+            b = _mm512_set1_pd( Bp[ p*4 + 3 ] );
+            c03 = _mm512_fmadd_pd( a0, b, c03 );
+            c13 = _mm512_fmadd_pd( a1, b, c13 );
+        }
+        __mmask8 m0 = (__mmask8) ((1u << min( mr, 8 )) - 1);
+        __mmask8 m1 = (__mmask8) ((1u << max( mr - 8, 0 )) - 1);
+        #define GEMM_HOST_UPDATE( j, c0, c1 )                                                         \
+            if (j < nr) {                                                                              \
+                double* cj = C + j*ldc;                                                                \
+                _mm512_mask_storeu_pd( cj,     m0, _mm512_add_pd( _mm512_maskz_loadu_pd( m0, cj     ), c0 )); \
+                _mm512_mask_storeu_pd( cj + 8, m1, _mm512_add_pd( _mm512_maskz_loadu_pd( m1, cj + 8 ), c1 )); \
+            }
+        GEMM_HOST_UPDATE( 0, c00, c10 );
+        GEMM_HOST_UPDATE( 1, c01, c11 );
+        GEMM_HOST_UPDATE( 2, c02, c12 );
+        GEMM_HOST_UPDATE( 3, c03, c13 );
+        #undef GEMM_HOST_UPDATE
+    }
+};
+
+template<>
+struct gemm_host_kernel< float, 32, 4 >
+{
+    static void run(
+        magma_int_t kc, const float* Ap, const float* Bp,
+        float* C, magma_int_t ldc, magma_int_t mr, magma_int_t nr )
+    {
+        __m512 c00 = _mm512_setzero_ps(), c10 = _mm512_setzero_ps();
+        __m512 c01 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+        __m512 c02 = _mm512_setzero_ps(), c12 = _mm512_setzero_ps();
+        __m512 c03 = _mm512_setzero_ps(), c13 = _mm512_setzero_ps();
+        for (magma_int_t p = 0; p < kc; ++p) {
+            __m512 a0 = _mm512_loadu_ps( Ap + p*32      );
+            __m512 a1 = _mm512_loadu_ps( Ap + p*32 + 16 );
+            __m512 b;
+            b = _mm512_set1_ps( Bp[ p*4     ] );
+            c00 = _mm512_fmadd_ps( a0, b, c00 );
+            c10 = _mm512_fmadd_ps( a1, b, c10 );
+            b = _mm512_set1_ps( Bp[ p*4 + 1 ] );
+            c01 = _mm512_fmadd_ps( a0, b, c01 );
+            c11 = _mm512_fmadd_ps( a1, b, c11 );
+            b = _mm512_set1_ps( Bp[ p*4 + 2 ] );
+            c02 = _mm512_fmadd_ps( a0, b, c02 );
+            c12 = _mm512_fmadd_ps( a1, b, c12 );
+            b = _mm512_set1_ps( Bp[ p*4 + 3 ] );
+            c03 = _mm512_fmadd_ps( a0, b, c03 );
+            c13 = _mm512_fmadd_ps( a1, b, c13 );
+        }
+        __mmask16 m0 = (__mmask16) ((1u << min( mr, 16 )) - 1);
+        __mmask16 m1 = (__mmask16) ((1u << max( mr - 16, 0 )) - 1);
+        #define GEMM_HOST_UPDATE( j, c0, c1 )                                                           \
+            if (j < nr) {                                                                                \
+                float* cj = C + j*ldc;                                                                   \
+                _mm512_mask_storeu_ps( cj,      m0, _mm512_add_ps( _mm512_maskz_loadu_ps( m0, cj      ), c0 )); \
+                _mm512_mask_storeu_ps( cj + 16, m1, _mm512_add_ps( _mm512_maskz_loadu_ps( m1, cj + 16 ), c1 )); \
+            }
+        GEMM_HOST_UPDATE( 0, c00, c10 );
+        GEMM_HOST_UPDATE( 1, c01, c11 );
+        GEMM_HOST_UPDATE( 2, c02, c12 );
+        GEMM_HOST_UPDATE( 3, c03, c13 );
+        #undef GEMM_HOST_UPDATE
+    }
+};
+#endif // __AVX512F__
+
+#endif // GEMM_TEMPLATE_HOST_DEFS_HPP
@@ -0,0 +1,69 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/clat2z.cpp, mixed zc -> ds, Wed Nov 15 00:34:20 2017
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "convert_host.hpp"
+
+#define PRECISION_d
+
+// reals per element
+#if defined(PRECISION_z) || defined(PRECISION_c)
+const magma_int_t lanes = 2;
+#else
+const magma_int_t lanes = 1;
+#endif
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SLAT2D converts a single-real matrix, SA,
+                 to a double-real matrix, A.
+    Only the triangle given by uplo, including the diagonal, is converted.
+    Host backend version; for arguments, see magmablas/slat2d.cu.
+    Uses the host conversion engine, as magma_slat2d_cpu.
+
+    @ingroup magma_lat2
+*******************************************************************************/
+extern "C" void
+magmablas_slat2d(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloat_const_ptr SA, magma_int_t ldsa,
+    magmaDouble_ptr      A,  magma_int_t lda,
+    magma_queue_t queue,
+    magma_int_t *info )
+{
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+    else if ( lda < max(1,n) )
+        *info = -4;
+    else if ( ldsa < max(1,n) )
+        *info = -6;
+    
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return; //*info;
+    }
+
+    /* quick return */
+    if ( n == 0 ) {
+        return;
+    }
+
+    magma_host_launch( queue, [=]() {
+        magma_convert_host< float, double, false >(
+            uplo, n, n, (const float*) SA, ldsa, (double*) A, lda, lanes, 0.f );
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,75 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/zpotrs_trsm.cpp, normal z -> s, Sat Oct 17 12:40:05 2026
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "trsm_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    spotrs_trsm does the two triangular solves of spotrs.
+    Host backend version; for arguments, see magmablas/spotrs_trsm.cpp.
+    Both solves are with the same factor, so its diagonal blocks are
+    inverted once, into a workspace of magma_trsm_nb columns, and used by
+    both; the solves are then by GEMMs, in parallel on the queue's cores.
+    See control/trsm_host.hpp.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magmablas_spotrs_trsm(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    magmaFloat_const_ptr dA, magma_int_t ldda,
+    magmaFloat_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaUpper && uplo != MagmaLower )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( nrhs < 0 )
+        info = -3;
+    else if ( ldda < max(1, n) )
+        info = -5;
+    else if ( lddb < max(1, n) )
+        info = -7;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    // quick return if possible.
+    if (n == 0 || nrhs == 0)
+        return;
+
+    magma_host_launch( queue, [=]() {
+        const float c_one = MAGMA_S_ONE;
+        magma_trans_t trans1 = (uplo == MagmaUpper ? MagmaConjTrans : MagmaNoTrans);
+        magma_trans_t trans2 = (uplo == MagmaUpper ? MagmaNoTrans : MagmaConjTrans);
+
+        // without the workspace, each solve inverts its own blocks,
+        // or falls back to the host BLAS
+        float *invA = NULL;
+        magma_smalloc_cpu( &invA, magma_roundup( n, magma_trsm_nb )*magma_trsm_nb );
+        if (invA != NULL) {
+            trsm_host_trtri_diag( uplo, MagmaNonUnit, n, dA, ldda, invA );
+        }
+        magma_strsm_cpu( MagmaLeft, uplo, trans1, MagmaNonUnit, n, nrhs,
+                         c_one, dA, ldda, invA, dB, lddb );
+        magma_strsm_cpu( MagmaLeft, uplo, trans2, MagmaNonUnit, n, nrhs,
+                         c_one, dA, ldda, invA, dB, lddb );
+        magma_free_cpu( invA );
+    });
+}
+
+#endif // HAVE_HOST
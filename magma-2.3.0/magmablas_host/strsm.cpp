@@ -0,0 +1,226 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from magmablas_host/ztrsm.cpp, normal z -> s, Sat Oct 17 05:51:32 2026
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "trsm_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    strsm_outofplace solves one of the matrix equations
+
+        op(A)*X = alpha*B,   or
+        X*op(A) = alpha*B,
+
+    Host backend version; for arguments, see magmablas/strsm.cu.
+    As on the GPU, if flag is true, the diagonal blocks of A are inverted
+    into d_dinvA; otherwise, d_dinvA from an earlier call with the same A
+    is used. The solve is by GEMMs with them, in parallel on the queue's
+    cores; see control/trsm_host.hpp. B is copied to X and solved there,
+    so B is not changed.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magmablas_strsm_outofplace(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    float alpha,
+    magmaFloat_const_ptr dA, magma_int_t ldda,
+    magmaFloat_ptr       dB, magma_int_t lddb,
+    magmaFloat_ptr       dX, magma_int_t lddx,
+    magma_int_t flag,
+    magmaFloat_ptr d_dinvA, magma_int_t dinvA_length,
+    magma_queue_t queue )
+{
+    magma_int_t nrowA = (side == MagmaLeft ? m : n);
+    magma_int_t min_dinvA_length = magma_roundup( nrowA, magma_trsm_nb )*magma_trsm_nb;
+
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -2;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -3;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -4;
+    } else if (m < 0) {
+        info = -5;
+    } else if (n < 0) {
+        info = -6;
+    } else if (dA == NULL) {
+        info = -8;
+    } else if (ldda < max(1,nrowA)) {
+        info = -9;
+    } else if (dB == NULL) {
+        info = -10;
+    } else if (lddb < max(1,m)) {
+        info = -11;
+    } else if (dX == NULL) {
+        info = -12;
+    } else if (lddx < max(1,m)) {
+        info = -13;
+    } else if (d_dinvA == NULL) {
+        info = -15;
+    } else if (dinvA_length < min_dinvA_length) {
+        info = -16;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    // quick return if possible.
+    if (m == 0 || n == 0)
+        return;
+
+    magma_host_launch( queue, [=]() {
+        if (flag) {
+            trsm_host_trtri_diag( uplo, diag, nrowA, dA, ldda, d_dinvA );
+        }
+        lapackf77_slacpy( "Full", &m, &n, dB, &lddb, dX, &lddx );
+        trsm_host( side, uplo, transA, m, n, alpha, dA, ldda, d_dinvA, dX, lddx );
+    });
+}
+
+
+/***************************************************************************//**
+    Similar to magmablas_strsm_outofplace(), but the result is in dB,
+    as in classical strsm interface.
+    Host backend version; B is solved in place, so dX is not used.
+    @see magmablas_strsm_outofplace
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magmablas_strsm_work(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    float alpha,
+    magmaFloat_const_ptr dA, magma_int_t ldda,
+    magmaFloat_ptr       dB, magma_int_t lddb,
+    magmaFloat_ptr       dX, magma_int_t lddx,
+    magma_int_t flag,
+    magmaFloat_ptr d_dinvA, magma_int_t dinvA_length,
+    magma_queue_t queue )
+{
+    magma_int_t nrowA = (side == MagmaLeft ? m : n);
+    magma_int_t min_dinvA_length = magma_roundup( nrowA, magma_trsm_nb )*magma_trsm_nb;
+
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -2;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -3;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -4;
+    } else if (m < 0) {
+        info = -5;
+    } else if (n < 0) {
+        info = -6;
+    } else if (dA == NULL) {
+        info = -8;
+    } else if (ldda < max(1,nrowA)) {
+        info = -9;
+    } else if (dB == NULL) {
+        info = -10;
+    } else if (lddb < max(1,m)) {
+        info = -11;
+    } else if (lddx < max(1,m)) {
+        info = -13;
+    } else if (d_dinvA == NULL) {
+        info = -15;
+    } else if (dinvA_length < min_dinvA_length) {
+        info = -16;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    // quick return if possible.
+    if (m == 0 || n == 0)
+        return;
+
+    magma_host_launch( queue, [=]() {
+        if (flag) {
+            trsm_host_trtri_diag( uplo, diag, nrowA, dA, ldda, d_dinvA );
+        }
+        trsm_host( side, uplo, transA, m, n, alpha, dA, ldda, d_dinvA, dB, lddb );
+    });
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    strsm solves one of the matrix equations
+
+        op(A)*X = alpha*B,   or
+        X*op(A) = alpha*B,
+
+    Host backend version; for arguments, see magmablas/strsm.cu.
+    This is magma_strsm_cpu executed on the queue, which inverts the
+    diagonal blocks of A in a workspace and solves by GEMMs, in parallel
+    on the queue's cores. To reuse the inverted blocks over several
+    solves, use magmablas_strsm_work.
+
+    @ingroup magma_trsm
+*******************************************************************************/
+extern "C" void
+magmablas_strsm(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    float alpha,
+    magmaFloat_const_ptr dA, magma_int_t ldda,
+    magmaFloat_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t nrowA = (side == MagmaLeft ? m : n);
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -2;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -3;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -4;
+    } else if (m < 0) {
+        info = -5;
+    } else if (n < 0) {
+        info = -6;
+    } else if (dA == NULL) {
+        info = -8;
+    } else if (ldda < max(1,nrowA)) {
+        info = -9;
+    } else if (dB == NULL) {
+        info = -10;
+    } else if (lddb < max(1,m)) {
+        info = -11;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    magma_host_launch( queue, [=]() {
+        magma_strsm_cpu( side, uplo, transA, diag, m, n,
+                         alpha, dA, ldda, NULL, dB, lddb );
+    });
+}
+
+#endif // HAVE_HOST
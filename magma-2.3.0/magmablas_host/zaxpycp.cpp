@@ -0,0 +1,37 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    adds   x += r  --and--
+    copies r = b
+    Host backend version; see magmablas/zaxpycp.cu.
+*******************************************************************************/
+extern "C" void
+magmablas_zaxpycp(
+    magma_int_t m,
+    magmaDoubleComplex_ptr r,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_const_ptr b,
+    magma_queue_t queue )
+{
+    magma_host_launch( queue, [=]() {
+        #pragma omp parallel for simd schedule(static) if ( m >= 65536 )
+        for( magma_int_t i = 0; i < m; ++i ) {
+            x[i] = MAGMA_Z_ADD( x[i], r[i] );
+            r[i] = b[i];
+        }
+    });
+}
+
+#endif // HAVE_HOST
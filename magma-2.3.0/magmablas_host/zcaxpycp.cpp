@@ -0,0 +1,39 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions mixed zc -> ds
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    adds   x += r (including conversion to double)  --and--
+    copies w = b
+    Host backend version; see magmablas/zcaxpycp.cu.
+*******************************************************************************/
+extern "C" void
+magmablas_zcaxpycp(
+    magma_int_t m,
+    magmaFloatComplex_ptr r,
+    magmaDoubleComplex_ptr x,
+    magmaDoubleComplex_const_ptr b,
+    magmaDoubleComplex_ptr w,
+    magma_queue_t queue )
+{
+    magma_host_launch( queue, [=]() {
+        #pragma omp parallel for simd schedule(static) if ( m >= 65536 )
+        for( magma_int_t i = 0; i < m; ++i ) {
+            x[i] = MAGMA_Z_ADD( x[i], MAGMA_Z_MAKE( MAGMA_Z_REAL( r[i] ),
+                                                    MAGMA_Z_IMAG( r[i] ) ) );
+            w[i] = b[i];
+        }
+    });
+}
+
+#endif // HAVE_HOST
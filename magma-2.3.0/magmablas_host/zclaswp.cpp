@@ -0,0 +1,61 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions mixed zc -> ds
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    Row ipiv[i] of A is cast to single precision in row i of SA (incx >= 0), or
+    row ipiv[i] of SA is cast to double precision in row i of A (incx < 0),
+    for 0 <= i < M, as in the GPU version.
+    Host backend version; for arguments, see magmablas/zclaswp.cu.
+    Columns are gathered in parallel.
+
+    @ingroup magma_laswp
+*******************************************************************************/
+extern "C" void
+magmablas_zclaswp(
+    magma_int_t n,
+    magmaDoubleComplex_ptr A, magma_int_t lda,
+    magmaFloatComplex_ptr SA, magma_int_t ldsa,
+    magma_int_t m,
+    const magma_int_t *ipiv, magma_int_t incx,
+    magma_queue_t queue )
+{
+    magma_host_launch( queue, [=]() {
+        if (incx >= 0) {
+            #pragma omp parallel for schedule(static) if ( m*n >= 65536 )
+            for( magma_int_t j = 0; j < n; ++j ) {
+                const magmaDoubleComplex *Aj = A  + j*lda;
+                magmaFloatComplex       *SAj = SA + j*ldsa;
+                for( magma_int_t i = 0; i < m; ++i ) {
+                    magmaDoubleComplex tmp = Aj[ ipiv[i] ];
+                    SAj[i] = MAGMA_C_MAKE( MAGMA_Z_REAL( tmp ), MAGMA_Z_IMAG( tmp ));
+                }
+            }
+        }
+        else {
+            #pragma omp parallel for schedule(static) if ( m*n >= 65536 )
+            for( magma_int_t j = 0; j < n; ++j ) {
+                magmaDoubleComplex      *Aj = A  + j*lda;
+                const magmaFloatComplex *SAj = SA + j*ldsa;
+                for( magma_int_t i = 0; i < m; ++i ) {
+                    magmaFloatComplex tmp = SAj[ ipiv[i] ];
+                    Aj[i] = MAGMA_Z_MAKE( MAGMA_C_REAL( tmp ), MAGMA_C_IMAG( tmp ));
+                }
+            }
+        }
+    });
+}
+
+#endif // HAVE_HOST
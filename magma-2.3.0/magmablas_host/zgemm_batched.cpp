@@ -0,0 +1,207 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "gemm_template_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZGEMM_BATCHED performs one of the matrix-matrix operations
+
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i,
+
+    for a batch of matrices of the same size.
+    Host backend version; for arguments, see magmablas/zgemm_batched_core.cu.
+    Each matrix is done by the version of gemm_template_host that
+    gemm_config_host.hpp selects for its shape, or by the host BLAS gemm,
+    and the matrices are distributed over the OpenMP threads.
+    The pointer arrays are read when the task executes on the queue.
+
+    @ingroup magma_gemm_batched
+*******************************************************************************/
+extern "C" void
+magmablas_zgemm_batched(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex const * const * dA_array, magma_int_t ldda,
+    magmaDoubleComplex const * const * dB_array, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex **dC_array, magma_int_t lddc,
+    magma_int_t batchCount, magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if      ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans )
+        info = -1;
+    else if ( transB != MagmaNoTrans && transB != MagmaTrans && transB != MagmaConjTrans )
+        info = -2;
+    else if ( m < 0 )
+        info = -3;
+    else if ( n < 0 )
+        info = -4;
+    else if ( k < 0 )
+        info = -5;
+    else if ( transA == MagmaNoTrans ? ldda < m : ldda < k )
+        info = -8;
+    else if ( transB == MagmaNoTrans ? lddb < k : lddb < n )
+        info = -10;
+    else if ( lddc < m )
+        info = -13;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( m <= 0 || n <= 0 || batchCount <= 0 )
+        return;
+
+    int version = gemm_host_tuned< magmaDoubleComplex >::version( gemm_host_shape< magmaDoubleComplex >( m, n, k ));
+    magma_host_launch( queue, [=]() {
+        gemm_host_run_batched( version, transA, transB,
+                               m, NULL, n, NULL, k, NULL,
+                               alpha, dA_array, ldda, NULL,
+                                      dB_array, lddb, NULL,
+                               beta,  dC_array, lddc, NULL,
+                               batchCount );
+    });
+}
+
+
+/***************************************************************************//**
+    Host backend version of magma_zgemm_batched; without cuBLAS, this is
+    magmablas_zgemm_batched.
+
+    @ingroup magma_gemm_batched
+*******************************************************************************/
+extern "C" void
+magma_zgemm_batched(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t m, magma_int_t n, magma_int_t k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex const * const * dA_array, magma_int_t ldda,
+    magmaDoubleComplex const * const * dB_array, magma_int_t lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex **dC_array, magma_int_t lddc,
+    magma_int_t batchCount, magma_queue_t queue )
+{
+    magmablas_zgemm_batched(
+            transA, transB, m, n, k,
+            alpha, dA_array, ldda,
+                   dB_array, lddb,
+            beta,  dC_array, lddc,
+            batchCount, queue );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZGEMM_VBATCHED performs one of the matrix-matrix operations
+
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i,
+
+    for a batch of matrices of variable sizes m[i], n[i], k[i].
+    Host backend version; for arguments, see magmablas/zgemm_vbatched.cpp.
+    The version of gemm_template_host is selected for the largest
+    dimensions in the batch. Unlike the device version, the size arrays
+    need not have an extra element at the end.
+
+    @ingroup magma_gemm_batched
+*******************************************************************************/
+extern "C" void
+magmablas_zgemm_vbatched_nocheck(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t* m, magma_int_t* n, magma_int_t* k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex const * const * dA_array, magma_int_t* ldda,
+    magmaDoubleComplex const * const * dB_array, magma_int_t* lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex **dC_array, magma_int_t* lddc,
+    magma_int_t batchCount, magma_queue_t queue )
+{
+    if ( batchCount <= 0 )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_int_t max_m = 0, max_n = 0, max_k = 0;
+        for (magma_int_t i = 0; i < batchCount; ++i) {
+            max_m = max( max_m, m[i] );
+            max_n = max( max_n, n[i] );
+            max_k = max( max_k, k[i] );
+        }
+        int version = gemm_host_tuned< magmaDoubleComplex >::version(
+                          gemm_host_shape< magmaDoubleComplex >( max_m, max_n, max_k ));
+        gemm_host_run_batched( version, transA, transB,
+                               0, m, 0, n, 0, k,
+                               alpha, dA_array, 0, ldda,
+                                      dB_array, 0, lddb,
+                               beta,  dC_array, 0, lddc,
+                               batchCount );
+    });
+}
+
+
+/***************************************************************************//**
+    Checks the arguments, then calls magmablas_zgemm_vbatched_nocheck.
+    Since the size arrays are host memory, the check runs when called,
+    before the work is enqueued.
+
+    @ingroup magma_gemm_batched
+*******************************************************************************/
+extern "C" void
+magmablas_zgemm_vbatched(
+    magma_trans_t transA, magma_trans_t transB,
+    magma_int_t* m, magma_int_t* n, magma_int_t* k,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex const * const * dA_array, magma_int_t* ldda,
+    magmaDoubleComplex const * const * dB_array, magma_int_t* lddb,
+    magmaDoubleComplex beta,
+    magmaDoubleComplex **dC_array, magma_int_t* lddc,
+    magma_int_t batchCount, magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if      ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans )
+        info = -1;
+    else if ( transB != MagmaNoTrans && transB != MagmaTrans && transB != MagmaConjTrans )
+        info = -2;
+    else if ( batchCount < 0 )
+        info = -14;
+    for (magma_int_t i = 0; i < batchCount && info == 0; ++i) {
+        if ( m[i] < 0 )
+            info = -3;
+        else if ( n[i] < 0 )
+            info = -4;
+        else if ( k[i] < 0 )
+            info = -5;
+        else if ( transA == MagmaNoTrans ? ldda[i] < max(1,m[i]) : ldda[i] < max(1,k[i]) )
+            info = -8;
+        else if ( transB == MagmaNoTrans ? lddb[i] < max(1,k[i]) : lddb[i] < max(1,n[i]) )
+            info = -10;
+        else if ( lddc[i] < max(1,m[i]) )
+            info = -13;
+    }
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    magmablas_zgemm_vbatched_nocheck(
+            transA, transB,
+            m, n, k,
+            alpha, dA_array, ldda,
+                   dB_array, lddb,
+            beta,  dC_array, lddc,
+            batchCount, queue );
+}
+
+#endif // HAVE_HOST
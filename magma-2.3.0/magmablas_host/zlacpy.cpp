@@ -0,0 +1,72 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include <string.h>
+
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZLACPY copies all or part of a two-dimensional matrix dA to another
+    matrix dB.
+    Host backend version; for arguments, see magmablas/zlacpy.cu.
+    Columns are copied in parallel.
+
+    @ingroup magma_lacpy
+*******************************************************************************/
+extern "C" void
+magmablas_zlacpy(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr       dB, magma_int_t lddb,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper && uplo != MagmaFull )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < max(1,m))
+        info = -5;
+    else if ( lddb < max(1,m))
+        info = -7;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+    
+    // nothing to do if dA and dB are the same array
+    if ( m == 0 || n == 0 || (dA == dB && ldda == lddb) ) {
+        return;
+    }
+
+    magma_host_launch( queue, [=]() {
+        #pragma omp parallel for schedule(static) if ( m*n >= 65536 )
+        for( magma_int_t j = 0; j < n; ++j ) {
+            magma_int_t ibegin = 0, iend = m;
+            if ( uplo == MagmaLower )
+                ibegin = min( j, m );
+            else if ( uplo == MagmaUpper )
+                iend = min( j+1, m );
+            if ( iend > ibegin ) {
+                memcpy( &dB[ ibegin + j*lddb ], &dA[ ibegin + j*ldda ],
+                        (iend - ibegin)*sizeof(magmaDoubleComplex) );
+            }
+        }
+    });
+}
+
+#endif // HAVE_HOST
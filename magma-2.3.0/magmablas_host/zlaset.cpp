@@ -0,0 +1,70 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZLASET initializes a 2-D array A to DIAG on the diagonal and
+    OFFDIAG on the off-diagonals.
+    Host backend version; for arguments, see magmablas/zlaset.cu.
+    Columns are set in parallel.
+
+    @ingroup magma_laset
+*******************************************************************************/
+extern "C"
+void magmablas_zlaset(
+    magma_uplo_t uplo, magma_int_t m, magma_int_t n,
+    magmaDoubleComplex offdiag, magmaDoubleComplex diag,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper && uplo != MagmaFull )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( n < 0 )
+        info = -3;
+    else if ( ldda < max(1,m) )
+        info = -7;
+    
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+    
+    if ( m == 0 || n == 0 ) {
+        return;
+    }
+
+    magma_host_launch( queue, [=]() {
+        #pragma omp parallel for schedule(static) if ( m*n >= 65536 )
+        for( magma_int_t j = 0; j < n; ++j ) {
+            // off-diagonal part of column j
+            magma_int_t ibegin = 0, iend = m;
+            if ( uplo == MagmaLower )
+                ibegin = min( j+1, m );
+            else if ( uplo == MagmaUpper )
+                iend = min( j, m );
+            for( magma_int_t i = ibegin; i < iend; ++i ) {
+                if ( i != j )
+                    dA[ i + j*ldda ] = offdiag;
+            }
+            if ( j < m )
+                dA[ j + j*ldda ] = diag;
+        }
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,88 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include <vector>
+
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "laswp_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Blocked version: swap several pairs of lines.
+    Row k of dA, for k = i1-1, ..., i2-1, is swapped with row
+    ipiv[ k*inci ] - 1 - offset of dB, unless ipiv[ k*inci ] = k+1.
+    Host backend version; for arguments, see magmablas/zswapblk.cu.
+    The swaps involve two matrices, so they do not compose into one
+    permutation as in magmablas_zlaswp; all swaps are done on one block of
+    columns at a time, in parallel over blocks.
+
+    @ingroup magma_swapblk
+*******************************************************************************/
+extern "C" void
+magmablas_zswapblk(
+    magma_order_t order, magma_int_t n,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magmaDoubleComplex_ptr dB, magma_int_t lddb,
+    magma_int_t i1, magma_int_t i2,
+    const magma_int_t *ipiv, magma_int_t inci, magma_int_t offset,
+    magma_queue_t queue )
+{
+    /* Quick return */
+    if ( n == 0 || i2 < i1 )
+        return;
+
+    // pairs (row of dA, row of dB), copied now since ipiv is on the CPU
+    std::vector< magma_int_t > pairs;
+    for( magma_int_t k = i1-1; k < i2; ++k ) {
+        magma_int_t im = ipiv[ k*inci ] - 1;
+        if ( k != im ) {
+            pairs.push_back( k );
+            pairs.push_back( im - offset );
+        }
+    }
+    if ( pairs.empty() )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_int_t npairs  = pairs.size() / 2;
+        magma_int_t nblocks = magma_ceildiv( n, magma_laswp_nb_cols );
+        #pragma omp parallel for schedule(static) if ( nblocks > 1 )
+        for( magma_int_t jb = 0; jb < nblocks; ++jb ) {
+            magma_int_t j0 = jb*magma_laswp_nb_cols;
+            magma_int_t nj = min( magma_laswp_nb_cols, n - j0 );
+            if ( order == MagmaColMajor ) {
+                // rows are strided; swap within each column
+                for( magma_int_t j = j0; j < j0 + nj; ++j ) {
+                    magmaDoubleComplex *A = dA + j*ldda;
+                    magmaDoubleComplex *B = dB + j*lddb;
+                    for( magma_int_t p = 0; p < npairs; ++p ) {
+                        magmaDoubleComplex tmp = A[ pairs[2*p] ];
+                        A[ pairs[2*p] ]   = B[ pairs[2*p+1] ];
+                        B[ pairs[2*p+1] ] = tmp;
+                    }
+                }
+            }
+            else {
+                // rows are contiguous
+                for( magma_int_t p = 0; p < npairs; ++p ) {
+                    magmaDoubleComplex *A = dA + pairs[2*p  ]*ldda + j0;
+                    magmaDoubleComplex *B = dB + pairs[2*p+1]*lddb + j0;
+                    for( magma_int_t j = 0; j < nj; ++j ) {
+                        magmaDoubleComplex tmp = A[j];
+                        A[j] = B[j];
+                        B[j] = tmp;
+                    }
+                }
+            }
+        }
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,74 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "magma_internal.h"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    zswapdblk swaps diagonal blocks of size nb x nb between matrices
+    dA and dB. It swaps nblocks = n/nb blocks.
+    Host backend version; for arguments, see magmablas/zswapdblk.cu.
+    Blocks are swapped in parallel.
+
+    @ingroup magma_swapdblk
+*******************************************************************************/
+extern "C" void
+magmablas_zswapdblk(
+    magma_int_t n, magma_int_t nb,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda, magma_int_t inca,
+    magmaDoubleComplex_ptr dB, magma_int_t lddb, magma_int_t incb,
+    magma_queue_t queue )
+{
+    magma_int_t nblocks = n / nb;
+
+    magma_int_t info = 0;
+    if (n < 0) {
+        info = -1;
+    } else if (nb < 1) {
+        info = -2;
+    } else if (ldda < (nblocks-1)*nb*inca + nb) {
+        info = -4;
+    } else if (inca < 0) {
+        info = -5;
+    } else if (lddb < (nblocks-1)*nb*incb + nb) {
+        info = -7;
+    } else if (incb < 0) {
+        info = -8;
+    }
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( nblocks == 0 ) {
+        return;
+    }
+
+    magma_host_launch( queue, [=]() {
+        #pragma omp parallel for schedule(static) if ( nblocks*nb*nb >= 65536 )
+        for( magma_int_t k = 0; k < nblocks; ++k ) {
+            magmaDoubleComplex *A = dA + k*nb*(ldda + inca);
+            magmaDoubleComplex *B = dB + k*nb*(lddb + incb);
+            for( magma_int_t j = 0; j < nb; ++j ) {
+                for( magma_int_t i = 0; i < nb; ++i ) {
+                    magmaDoubleComplex tmp = A[ i + j*ldda ];
+                    A[ i + j*ldda ] = B[ i + j*lddb ];
+                    B[ i + j*lddb ] = tmp;
+                }
+            }
+        }
+    });
+}
+
+#endif // HAVE_HOST
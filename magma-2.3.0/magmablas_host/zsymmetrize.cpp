@@ -0,0 +1,52 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "symmetric_host.hpp"
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZSYMMETRIZE copies lower triangle to upper triangle, or vice-versa,
+    to make dA a general representation of a symmetric matrix.
+    Host backend version; for arguments, see magmablas/zsymmetrize.cu.
+    Uses the host symmetric-storage engine in control/symmetric_host.hpp.
+
+    @ingroup magma_symmetrize
+*******************************************************************************/
+extern "C" void
+magmablas_zsymmetrize(
+    magma_uplo_t uplo, magma_int_t m,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        info = -1;
+    else if ( m < 0 )
+        info = -2;
+    else if ( ldda < max(1,m) )
+        info = -4;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+    
+    if ( m == 0 )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_symmetrize_host( true, uplo, m, dA, ldda );
+    });
+}
+
+#endif // HAVE_HOST
@@ -0,0 +1,169 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "host_task.hpp"  // before magma_internal.h, which defines min, max
+#include "transpose_host.hpp"
+
+#define COMPLEX
+
+#ifdef HAVE_HOST
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ztranspose copies and transposes a matrix dA to matrix dAT.
+    Host backend version; for arguments, see magmablas/ztranspose.cu.
+    Uses the host transpose engine in control/transpose_host.hpp.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magmablas_ztranspose(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA,  magma_int_t ldda,
+    magmaDoubleComplex_ptr       dAT, magma_int_t lddat,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( m < 0 )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( ldda < m )
+        info = -4;
+    else if ( lddat < n )
+        info = -6;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+    
+    /* Quick return */
+    if ( (m == 0) || (n == 0) )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_transpose_host( false, m, n, dA, ldda, dAT, lddat );
+    });
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    Purpose
+    -------
+    ztranspose_conj copies and conjugate-transposes a matrix dA to matrix dAT.
+    Host backend version; for arguments, see magmablas/ztranspose_conj.cu.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magmablas_ztranspose_conj(
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex_const_ptr dA,  magma_int_t ldda,
+    magmaDoubleComplex_ptr       dAT, magma_int_t lddat,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( m < 0 )
+        info = -1;
+    else if ( n < 0 )
+        info = -2;
+    else if ( ldda < m )
+        info = -4;
+    else if ( lddat < n )
+        info = -6;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+    
+    /* Quick return */
+    if ( (m == 0) || (n == 0) )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_transpose_host( true, m, n, dA, ldda, dAT, lddat );
+    });
+}
+#endif // COMPLEX
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ztranspose_inplace transposes a square N-by-N matrix in-place.
+    Host backend version; for arguments, see magmablas/ztranspose_inplace.cu.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magmablas_ztranspose_inplace(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( ldda < n )
+        info = -3;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_transpose_inplace_host( false, n, n, dA, ldda );
+    });
+}
+
+
+#ifdef COMPLEX
+/***************************************************************************//**
+    Purpose
+    -------
+    ztranspose_conj_inplace conjugate-transposes a square N-by-N matrix in-place.
+    Host backend version; for arguments, see magmablas/ztranspose_conj_inplace.cu.
+
+    @ingroup magma_transpose
+*******************************************************************************/
+extern "C" void
+magmablas_ztranspose_conj_inplace(
+    magma_int_t n,
+    magmaDoubleComplex_ptr dA, magma_int_t ldda,
+    magma_queue_t queue )
+{
+    magma_int_t info = 0;
+    if ( n < 0 )
+        info = -1;
+    else if ( ldda < n )
+        info = -3;
+    
+    if ( info != 0 ) {
+        magma_xerbla( __func__, -(info) );
+        return;  //info;
+    }
+
+    if ( n == 0 )
+        return;
+
+    magma_host_launch( queue, [=]() {
+        magma_transpose_inplace_host( true, n, n, dA, ldda );
+    });
+}
+#endif // COMPLEX
+
+#endif // HAVE_HOST
@@ -55,11 +55,8 @@ magma_vector_clag2z(
         y->nnz = x.nnz;
         CHECK( magma_zmalloc_cpu( &y->val, x.num_rows ));
 
-        magma_int_t one= 1;
-        magma_int_t info;
-        lapackf77_clag2z( &x.num_rows, &one,
-                       x.dval, &x.num_rows,
-                       y->val, &x.num_rows, &info);
+        magma_clag2z_cpu( x.num_rows, 1, x.val, x.num_rows,
+                          y->val, x.num_rows, &info );
         return MAGMA_SUCCESS;
     }
     else
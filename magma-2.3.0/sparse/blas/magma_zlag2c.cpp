@@ -55,11 +55,8 @@ magma_vector_zlag2c(
         y->nnz = x.nnz;
         magma_cmalloc_cpu( &y->val, x.num_rows );
 
-        magma_int_t one= 1;
-        magma_int_t info;
-        lapackf77_zlag2c( &x.num_rows, &one,
-                       x.dval, &x.num_rows,
-                       y->val, &x.num_rows, &info);
+        magma_zlag2c_cpu( x.num_rows, 1, x.val, x.num_rows,
+                          y->val, x.num_rows, &info );
         return MAGMA_SUCCESS;
     }
     else
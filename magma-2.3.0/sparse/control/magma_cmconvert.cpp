@@ -8,6 +8,7 @@
        @generated from sparse/control/magma_zmconvert.cpp, normal z -> c, Wed Nov 15 00:34:25 2017
        @author Hartwig Anzt
 */
+#include "primitives_host.hpp"  // includes magma_internal.h, after the STL headers
 #include "magmasparse_internal.h"
 
 #include <cuda.h>  // for CUDA_VERSION
@@ -70,45 +71,30 @@ magma_c_csr_compressor(
 {
     magma_int_t info = 0;
 
-    magma_index_t i,j, nnz_new=0, (*row_nnz)=NULL, nnz_this_row;
-    CHECK( magma_index_malloc_cpu( &(row_nnz), (*n) ));
+    // keep the nonzeros
+    auto keep = [=]( magma_int_t i, magma_index_t j ) {
+        return (MAGMA_C_REAL((*val)[j]) != 0) || (MAGMA_C_IMAG((*val)[j]) != 0);
+    };
+    magma_index_t nnz_new;
+
     CHECK( magma_index_malloc_cpu( rown, *n+1 ));
-    for( i=0; i<*n; i++ ) {
-        (*rown)[i] = nnz_new;
-        nnz_this_row = 0;
-        for( j=(*row)[i]; j<(*row)[i+1]; j++ ) {
-            if ( (MAGMA_C_REAL((*val)[j]) != 0) || (MAGMA_C_IMAG((*val)[j]) != 0) ) {
-                nnz_new++;
-                nnz_this_row++;
-            }
-        }
-        row_nnz[i] = nnz_this_row;
-    }
-    (*rown)[*n] = nnz_new;
+    nnz_new = magma_csr_count_if_host( *n, *row, keep, *rown );
 
     CHECK( magma_cmalloc_cpu( valn, nnz_new ));
     CHECK( magma_index_malloc_cpu( coln, nnz_new ));
 
-    nnz_new = 0;
-    for( i=0; i<*n; i++ ) {
-        for( j=(*row)[i]; j<(*row)[i+1]; j++ ) {
-            if ( MAGMA_C_REAL((*val)[j]) != 0 ) {
-                (*valn)[nnz_new]= (*val)[j];
-                (*coln)[nnz_new]= (*col)[j];
-                nnz_new++;
-            }
-        }
-    }
-
+    magma_csr_copy_if_host( *n, *row, keep, *rown,
+        [&]( magma_int_t i, magma_index_t j, magma_index_t k ) {
+            (*valn)[k] = (*val)[j];
+            (*coln)[k] = (*col)[j];
+        });
 
 cleanup:
     if ( info != 0 ) {
-        magma_free_cpu( valn );
-        magma_free_cpu( coln );
-        magma_free_cpu( rown );
+        magma_free_cpu( *valn );
+        magma_free_cpu( *coln );
+        magma_free_cpu( *rown );
     }
-    magma_free_cpu( row_nnz );
-    row_nnz = NULL;
     return info;
 }
 
@@ -245,42 +231,21 @@ magma_cmconvert(
                 B->true_nnz = A.true_nnz;
                 B->diameter = A.diameter;
 
-                magma_int_t numzeros=0;
-                for( magma_int_t i=0; i < A.num_rows; i++) {
-                    for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
-                        if ( A.col[j] <= i) {
-                            numzeros++;
-                        }
-                    }
-                }
-                B->nnz = numzeros;
-                CHECK( magma_cmalloc_cpu( &B->val, numzeros ));
+                bool unity = (B->diagorder_type == Magma_UNITY);
+                auto lower = [&]( magma_int_t i, magma_index_t j ) {
+                    return A.col[j] <= i;
+                };
                 CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
-                CHECK( magma_index_malloc_cpu( &B->col, numzeros ));
+                B->nnz = magma_csr_count_if_host( A.num_rows, A.row, lower, B->row );
+                CHECK( magma_cmalloc_cpu( &B->val, B->nnz ));
+                CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
 
-                numzeros=0;
-                for( magma_int_t i=0; i < A.num_rows; i++) {
-                    B->row[i]=numzeros;
-                    for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
-                        if ( A.col[j] < i) {
-                            B->val[numzeros] = A.val[j];
-                            B->col[numzeros] = A.col[j];
-                            numzeros++;
-                        }
-                        else if ( A.col[j] == i &&
-                                        B->diagorder_type == Magma_UNITY) {
-                            B->val[numzeros] = MAGMA_C_MAKE(1.0, 0.0);
-                            B->col[numzeros] = A.col[j];
-                            numzeros++;
-                        }
-                        else if ( A.col[j] == i ) {
-                            B->val[numzeros] = A.val[j];
-                            B->col[numzeros] = A.col[j];
-                            numzeros++;
-                        }
-                    }
-                }
-                B->row[B->num_rows] = numzeros;
+                magma_csr_copy_if_host( A.num_rows, A.row, lower, B->row,
+                    [&]( magma_int_t i, magma_index_t j, magma_index_t k ) {
+                        B->val[k] = ( A.col[j] == i && unity
+                                      ? MAGMA_C_MAKE(1.0, 0.0) : A.val[j] );
+                        B->col[k] = A.col[j];
+                    });
             }
 
             // CSR to CSRU
@@ -293,31 +258,19 @@ magma_cmconvert(
                 B->num_cols = A.num_cols;
                 B->diameter = A.diameter;
                 B->fill_mode = MagmaUpper;
-                magma_int_t numzeros=0;
-                for( magma_int_t i=0; i < A.num_rows; i++) {
-                    for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
-                        if ( A.col[j] >= i) {
-                            numzeros++;
-                        }
-                    }
-                }
-                B->nnz = numzeros;
-                CHECK( magma_cmalloc_cpu( &B->val, numzeros ));
+                auto upper = [&]( magma_int_t i, magma_index_t j ) {
+                    return A.col[j] >= i;
+                };
                 CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
-                CHECK( magma_index_malloc_cpu( &B->col, numzeros ));
+                B->nnz = magma_csr_count_if_host( A.num_rows, A.row, upper, B->row );
+                CHECK( magma_cmalloc_cpu( &B->val, B->nnz ));
+                CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
 
-                numzeros=0;
-                for( magma_int_t i=0; i < A.num_rows; i++) {
-                    B->row[i]=numzeros;
-                    for( magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
-                        if ( A.col[j] >= i) {
-                            B->val[numzeros] = A.val[j];
-                            B->col[numzeros] = A.col[j];
-                            numzeros++;
-                        }
-                    }
-                }
-                B->row[B->num_rows] = numzeros;
+                magma_csr_copy_if_host( A.num_rows, A.row, upper, B->row,
+                    [&]( magma_int_t i, magma_index_t j, magma_index_t k ) {
+                        B->val[k] = A.val[j];
+                        B->col[k] = A.col[j];
+                    });
             }
 
             // CSR to CSRD (diagonal elements first)
@@ -359,14 +312,14 @@ magma_cmconvert(
                 CHECK( magma_cmconvert( A, B, Magma_CSR, Magma_CSR, queue ));
                 B->storage_type = Magma_COO;
 
-                magma_free_cpu( B->row );
-                CHECK( magma_index_malloc_cpu( &B->row, A.nnz ));
+                // the row indices go to rowidx, as magma_cmtransfer and
+                // COO to CSR expect; row keeps the CSR row pointer
+                CHECK( magma_index_malloc_cpu( &B->rowidx, A.nnz ));
 
-                for(magma_int_t i=0; i < A.num_rows; i++) {
-                    for(magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
-                        B->row[j] = i;
-                    }
-                }
+                magma_csr_for_each_host( A.num_rows, A.row,
+                    [&]( magma_int_t i, magma_index_t j ) {
+                        B->rowidx[j] = i;
+                    });
             }
 
             // CSR to CSRCOO
@@ -376,11 +329,10 @@ magma_cmconvert(
 
                 CHECK( magma_index_malloc_cpu( &B->rowidx, A.nnz ));
 
-                for(magma_int_t i=0; i < A.num_rows; i++) {
-                    for(magma_int_t j=A.row[i]; j < A.row[i+1]; j++) {
+                magma_csr_for_each_host( A.num_rows, A.row,
+                    [&]( magma_int_t i, magma_index_t j ) {
                         B->rowidx[j] = i;
-                    }
-                }
+                    });
             }
 
             // CSR to CSRLIST
@@ -1537,36 +1489,25 @@ magma_cmconvert(
                 B->max_nnz_row = A.max_nnz_row;
                 B->diameter = A.diameter;
 
-                // conversion
+                // conversion: compact the rows of the row-major A,
+                // seen as CSR with all entries
+                auto nonzero = [&]( magma_int_t i, magma_index_t j ) {
+                    return MAGMA_C_REAL(A.val[j]) != 0.0;
+                };
+                CHECK( magma_index_malloc_cpu( &row_tmp, A.num_rows+1 ));
+                for( magma_int_t i=0; i < A.num_rows+1; i++ )
+                    row_tmp[i] = i*A.num_cols;
 
-                B->nnz=0;
-                for( magma_int_t i=0; i<(A.num_rows)*(A.num_cols); i++ ) {
-                    if ( MAGMA_C_REAL(A.val[i]) != 0.0 )
-                        (B->nnz)++;
-                }
-                CHECK( magma_cmalloc_cpu( &B->val, B->nnz));
                 CHECK( magma_index_malloc_cpu( &B->row, B->num_rows+1 ));
+                B->nnz = magma_csr_count_if_host( A.num_rows, row_tmp, nonzero, B->row );
+                CHECK( magma_cmalloc_cpu( &B->val, B->nnz));
                 CHECK( magma_index_malloc_cpu( &B->col, B->nnz ));
 
-                magma_int_t i = 0;
-                magma_int_t j = 0;
-                magma_int_t k = 0;
-
-                for(i=0; i<(A.num_rows)*(A.num_cols); i++)
-                {
-                    if ( i%(B->num_cols) == 0 )
-                    {
-                        (B->row)[k] = j;
-                        k++;
-                    }
-                    if ( MAGMA_C_REAL(A.val[i]) != 0 )
-                    {
-                        (B->val)[j] = A.val[i];
-                        (B->col)[j] = i%(B->num_cols);
-                        j++;
-                    }
-                }
-                (B->row)[B->num_rows]=B->nnz;
+                magma_csr_copy_if_host( A.num_rows, row_tmp, nonzero, B->row,
+                    [&]( magma_int_t i, magma_index_t j, magma_index_t k ) {
+                        B->val[k] = A.val[j];
+                        B->col[k] = j - i*A.num_cols;
+                    });
 
                 //printf( "done\n" );
             }
@@ -1582,11 +1523,29 @@ magma_cmconvert(
 
             // COO to CSR
             else if ( old_format == Magma_COO ) {
-                CHECK( magma_cmtransfer(A, &dA, Magma_CPU, Magma_DEV, queue ) );
-                CHECK( magma_cmconvert(dA, &dB, Magma_COO, Magma_CSR, queue ) );
-                magma_cmfree( &dA, queue );
-                CHECK( magma_cmtransfer(dB, B, Magma_DEV, Magma_CPU, queue ) );
-                magma_cmfree( &dB, queue );
+                // fill in information for B
+                B->storage_type = Magma_CSR;
+                B->memory_location = A.memory_location;
+                B->fill_mode = A.fill_mode;
+                B->num_rows = A.num_rows; B->true_nnz = A.true_nnz;
+                B->num_cols = A.num_cols;
+                B->nnz = A.nnz;
+                B->max_nnz_row = A.max_nnz_row;
+                B->diameter = A.diameter;
+
+                CHECK( magma_cmalloc_cpu( &B->val, A.nnz ));
+                CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
+                CHECK( magma_index_malloc_cpu( &B->col, A.nnz ));
+
+                // stable counting sort by row, as cusparseXcoosortByRow
+                // on the device: the entries of a row keep their order
+                magma_counting_sort_host( A.nnz,
+                    [&]( magma_int_t j ) { return A.rowidx[j]; },
+                    A.num_rows, B->row,
+                    [&]( magma_int_t j, magma_index_t k ) {
+                        B->val[k] = A.val[j];
+                        B->col[k] = A.col[j];
+                    });
             }
 
             else {
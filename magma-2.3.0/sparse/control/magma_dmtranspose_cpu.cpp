@@ -10,6 +10,7 @@
 
 */
 #include <cstdlib>
+#include "primitives_host.hpp"  // includes magma_internal.h, after the STL headers
 #include "magmasparse_internal.h"
 
 
@@ -27,13 +28,6 @@ magma_d_mtrans_template(
 {
     magma_int_t info = 0;
     
-    magma_index_t *linked_list;
-    magma_index_t *row_ptr;
-    magma_index_t *last_rowel;
-    
-    // magma_int_t num_threads;
-    // magma_int_t el_per_block;
-    
     B->storage_type = A.storage_type;
     B->memory_location = A.memory_location;
     
@@ -41,9 +35,6 @@ magma_d_mtrans_template(
     B->num_cols = A.num_cols;
     B->nnz      = A.nnz;
     
-    CHECK( magma_index_malloc_cpu( &linked_list, A.nnz ));
-    CHECK( magma_index_malloc_cpu( &row_ptr, A.num_rows ));
-    CHECK( magma_index_malloc_cpu( &last_rowel, A.num_rows ));
     CHECK( magma_index_malloc_cpu( &B->row, A.num_rows+1 ));
     CHECK( magma_index_malloc_cpu( &B->rowidx, A.nnz ));
     CHECK( magma_index_malloc_cpu( &B->col, A.nnz ));
@@ -53,66 +44,18 @@ magma_d_mtrans_template(
     
     CHECK( magma_dmatrix_addrowindex(&A, queue) );
     
-    //#pragma omp parallel
-    // {
-    //     num_threads = omp_get_max_threads();
-    // }
-    
-    //#pragma omp parallel for
-    for( magma_int_t i=0; i<A.num_rows; i++ ){
-        row_ptr[i] = -1;
-    }
-    //#pragma omp parallel for
-    for( magma_int_t i=0; i<A.num_rows+1; i++ ){
-        B->row[i] = 0;
-    }
-    
-    //el_per_block = magma_ceildiv( A.num_rows, num_threads );
-
-    //#pragma omp parallel
-    {
-        // magma_int_t id = omp_get_thread_num();
-        for(magma_int_t i=0; i<A.nnz; i++ ){
-            magma_index_t row = A.col[ i ];
-            //if( (row < (id+1)*el_per_block) && (row >=(id)*el_per_block)  ){
-            {
-                if( row_ptr[row] == -1 ){
-                    row_ptr[ row ] = i;
-                    linked_list[ i ] = 0;
-                    last_rowel[ row ] = i;
-                } else {
-                    linked_list[ last_rowel[ row ] ] = i;
-                    linked_list[ i ] = 0;
-                    last_rowel[ row ] = i;
-                }
-                B->row[row+1] = B->row[row+1] + 1;
-            }
-        }
-    }
-    
-    // new rowptr
-    B->row[0]=0;   
-    magma_dmatrix_createrowptr( B->num_rows, B->row, queue );
-    
-
-    assert( B->row[B->num_rows] == A.nnz );
-    
-    //#pragma omp parallel for
-    for( magma_int_t row=0; row<A.num_rows; row++){
-        magma_int_t el = row_ptr[row];
-        if( el>-1 ) {
-            for( magma_int_t i=B->row[row]; i<B->row[row+1]; i++ ){
-                op(A.val[el], B->val[i]);
-                B->col[i] = A.rowidx[el];
-                el = linked_list[el];
-            }
-        }
-    }
+    // stable counting sort of the elements by column: the new row pointer
+    // is the column histogram's prefix sum, and each new row gets its
+    // elements in the order of the old rows
+    magma_counting_sort_host( A.nnz,
+        [&]( magma_int_t i ) { return A.col[i]; },
+        B->num_rows, B->row,
+        [&]( magma_int_t i, magma_index_t k ) {
+            op(A.val[i], B->val[k]);
+            B->col[k] = A.rowidx[i];
+        });
     
 cleanup:
-    magma_free_cpu( row_ptr );
-    magma_free_cpu( last_rowel );
-    magma_free_cpu( linked_list );
     magma_free_cpu( A.rowidx );
     return info;
 }
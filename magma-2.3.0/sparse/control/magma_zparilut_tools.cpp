@@ -10,6 +10,7 @@
 
 */
 
+#include "primitives_host.hpp"  // includes magma_internal.h, after the STL headers
 #include "magmasparse_internal.h"
 #ifdef _OPENMP
 #include <omp.h>
@@ -240,6 +241,14 @@ magma_zparilut_thrsrm(
 {
     magma_int_t info = 0;
     
+    // keep the diagonal, and the elements on the kept side of the threshold
+    double bound = *thrs;
+    auto keep = [=]( magma_int_t row, magma_index_t i ) {
+        return A->col[i] == row
+            || ( order == 1 ? MAGMA_Z_ABS(A->val[i]) > bound
+                            : MAGMA_Z_ABS(A->val[i]) < bound );
+    };
+    
     magma_z_matrix B={Magma_CSR};
     B.num_rows = A->num_rows;
     B.num_cols = A->num_cols;
@@ -248,82 +257,21 @@ magma_zparilut_thrsrm(
     
     CHECK( magma_index_malloc_cpu( &B.row, A->num_rows+1 ) );
     
-    
-    if( order == 1 ){
-    // set col for values smaller threshold to -1
-        #pragma omp parallel for
-        for( magma_int_t row=0; row<A->num_rows; row++){
-            magma_int_t rm = 0;
-            magma_int_t el = 0;
-            
-            for( magma_int_t i=A->row[row]; i<A->row[row+1]; i++ ){
-                if( MAGMA_Z_ABS(A->val[i]) <= *thrs ){
-                    if( A->col[i]!=row ){
-                        //printf("remove (%d %d) >> %.4e\n", row, A->col[i], A->val[i]);
-                        // magma_int_t col = A->col[i];
-                        A->col[i] = -1; // cheaper than val  
-                        rm++;
-                    } else {
-                        ;
-                    }
-                } else {
-                    el++;    
-                }
-            }
-            B.row[row+1] = el;
-        }
-    } else {
-        #pragma omp parallel for
-        for( magma_int_t row=0; row<A->num_rows; row++){
-            magma_int_t rm = 0;
-            magma_int_t el = 0;
-            
-            for( magma_int_t i=A->row[row]; i<A->row[row+1]; i++ ){
-                if( MAGMA_Z_ABS(A->val[i]) >= *thrs ){
-                    if( A->col[i]!=row ){
-                        //printf("remove (%d %d) >> %.4e\n", row, A->col[i], A->val[i]);
-                        // magma_int_t col = A->col[i];
-                        A->col[i] = -1; // cheaper than val  
-                        rm++;
-                    } else {
-                        ;
-                    }
-                } else {
-                    el++;    
-                }
-            }
-            B.row[row+1] = el;
-        }
-    }
-    
     // new row pointer
-    B.row[ 0 ] = 0;
-    CHECK( magma_zmatrix_createrowptr( B.num_rows, B.row, queue ) );
-    B.nnz = B.row[ B.num_rows ];
+    B.nnz = magma_csr_count_if_host( A->num_rows, A->row, keep, B.row );
     
     // allocate new arrays
     CHECK( magma_zmalloc_cpu( &B.val, B.nnz ) );
     CHECK( magma_index_malloc_cpu( &B.rowidx, B.nnz ) );
     CHECK( magma_index_malloc_cpu( &B.col, B.nnz ) );
     
-    #pragma omp parallel for
-    for( magma_int_t row=0; row<A->num_rows; row++){
-        magma_index_t offset_old = A->row[row];
-        magma_index_t offset_new = B.row[row];
-        magma_index_t end_old = A->row[row+1];
-        magma_int_t count = 0;
-        for(magma_int_t i=offset_old; i<end_old; i++){
-            if( A->col[i] > -1 ){ // copy this element
-                B.col[ offset_new + count ] = A->col[i];
-                B.val[ offset_new + count ] = A->val[i];
-                B.rowidx[ offset_new + count ] = row;
-                count++;
-
-            }
-        }
-    }
+    magma_csr_copy_if_host( A->num_rows, A->row, keep, B.row,
+        [&]( magma_int_t row, magma_index_t i, magma_index_t k ) {
+            B.col[ k ] = A->col[i];
+            B.val[ k ] = A->val[i];
+            B.rowidx[ k ] = row;
+        });
     
-
     // finally, swap the matrices
     CHECK( magma_zmatrix_swap( &B, A, queue) );
 
@@ -374,6 +322,16 @@ magma_zparilut_thrsrm_U(
 {
     magma_int_t info = 0;
     
+    // keep the diagonal, and the elements that, scaled by the diagonal of L
+    // in their column, are on the kept side of the threshold
+    double bound = *thrs;
+    auto keep = [=]( magma_int_t row, magma_index_t i ) {
+        magmaDoubleComplex Lscal = L.val[L.row[A->col[i]+1]-1];
+        return A->col[i] == row
+            || ( order == 1 ? MAGMA_Z_ABS(A->val[i]*Lscal) > bound
+                            : MAGMA_Z_ABS(A->val[i]*Lscal) < bound );
+    };
+    
     magma_z_matrix B={Magma_CSR};
     B.num_rows = A->num_rows;
     B.num_cols = A->num_cols;
@@ -382,81 +340,21 @@ magma_zparilut_thrsrm_U(
     
     CHECK( magma_index_malloc_cpu( &B.row, A->num_rows+1 ) );
     
-    
-    if( order == 1 ){
-    // set col for values smaller threshold to -1
-        #pragma omp parallel for
-        for( magma_int_t row=0; row<A->num_rows; row++){
-            magma_int_t rm = 0;
-            magma_int_t el = 0;
-            
-            for( magma_int_t i=A->row[row]; i<A->row[row+1]; i++ ){
-                magmaDoubleComplex Lscal = L.val[L.row[A->col[i]+1]-1];
-                if( MAGMA_Z_ABS(A->val[i]*Lscal) <= *thrs ){
-                    if( A->col[i]!=row ){
-                        //printf("remove (%d %d) >> %.4e\n", row, A->col[i], A->val[i]);
-                        // magma_int_t col = A->col[i];
-                        A->col[i] = -1; // cheaper than val  
-                        rm++;
-                    } else {
-                        ;
-                    }
-                } else {
-                    el++;    
-                }
-            }
-            B.row[row+1] = el;
-        }
-    } else {
-        #pragma omp parallel for
-        for( magma_int_t row=0; row<A->num_rows; row++){
-            magma_int_t rm = 0;
-            magma_int_t el = 0;
-            
-            for( magma_int_t i=A->row[row]; i<A->row[row+1]; i++ ){
-                magmaDoubleComplex Lscal = L.val[L.row[A->col[i]+1]-1];
-                if( MAGMA_Z_ABS(A->val[i]*Lscal) >= *thrs ){
-                    if( A->col[i]!=row ){
-                        //printf("remove (%d %d) >> %.4e\n", row, A->col[i], A->val[i]);
-                        // magma_int_t col = A->col[i];
-                        A->col[i] = -1; // cheaper than val  
-                        rm++;
-                    } else {
-                        ;
-                    }
-                } else {
-                    el++;    
-                }
-            }
-            B.row[row+1] = el;
-        }
-    }
-    
     // new row pointer
-    B.row[ 0 ] = 0;
-    CHECK( magma_zmatrix_createrowptr( B.num_rows, B.row, queue ) );
-    B.nnz = B.row[ B.num_rows ];
+    B.nnz = magma_csr_count_if_host( A->num_rows, A->row, keep, B.row );
     
     // allocate new arrays
     CHECK( magma_zmalloc_cpu( &B.val, B.nnz ) );
     CHECK( magma_index_malloc_cpu( &B.rowidx, B.nnz ) );
     CHECK( magma_index_malloc_cpu( &B.col, B.nnz ) );
     
-    #pragma omp parallel for
-    for( magma_int_t row=0; row<A->num_rows; row++){
-        magma_index_t offset_old = A->row[row];
-        magma_index_t offset_new = B.row[row];
-        magma_index_t end_old = A->row[row+1];
-        magma_int_t count = 0;
-        for(magma_int_t i=offset_old; i<end_old; i++){
-            if( A->col[i] > -1 ){ // copy this element
-                B.col[ offset_new + count ] = A->col[i];
-                B.val[ offset_new + count ] = A->val[i];
-                B.rowidx[ offset_new + count ] = row;
-                count++;
-            }
-        }
-    }
+    magma_csr_copy_if_host( A->num_rows, A->row, keep, B.row,
+        [&]( magma_int_t row, magma_index_t i, magma_index_t k ) {
+            B.col[ k ] = A->col[i];
+            B.val[ k ] = A->val[i];
+            B.rowidx[ k ] = row;
+        });
+    
     // finally, swap the matrices
     CHECK( magma_zmatrix_swap( &B, A, queue) );
     
@@ -628,6 +526,11 @@ magma_zparilut_rmselected(
 {
     magma_int_t info = 0;
     
+    // keep the elements not marked for removal
+    auto keep = [=]( magma_int_t row, magma_index_t i ) {
+        return A->col[i] > -1;
+    };
+    
     magma_z_matrix B={Magma_CSR};
     B.num_rows = A->num_rows;
     B.num_cols = A->num_cols;
@@ -650,43 +553,21 @@ magma_zparilut_rmselected(
         }
     }
     
-    // get new rowpointer for B
-    #pragma omp parallel for
-    for( magma_int_t row=0; row<A->num_rows; row++){
-        magma_int_t loc_count = 0;
-        for( magma_int_t i=A->row[row]; i<A->row[row+1]; i++ ){
-            if( A->col[i] > -1 ){
-                loc_count++;    
-            }
-        }
-        B.row[row+1] = loc_count;
-    }
-    
     // new row pointer
-    B.row[ 0 ] = 0;
-    CHECK( magma_zmatrix_createrowptr( B.num_rows, B.row, queue ) );
-    B.nnz = B.row[ B.num_rows ];
+    B.nnz = magma_csr_count_if_host( A->num_rows, A->row, keep, B.row );
     
     // allocate new arrays
     CHECK( magma_zmalloc_cpu( &B.val, B.nnz ) );
     CHECK( magma_index_malloc_cpu( &B.rowidx, B.nnz ) );
     CHECK( magma_index_malloc_cpu( &B.col, B.nnz ) );
     
-    #pragma omp parallel for
-    for( magma_int_t row=0; row<A->num_rows; row++){
-        magma_index_t offset_old = A->row[row];
-        magma_index_t offset_new = B.row[row];
-        magma_index_t end_old = A->row[row+1];
-        magma_int_t count = 0;
-        for(magma_int_t i=offset_old; i<end_old; i++){
-            if( A->col[i] > -1 ){ // copy this element
-                B.col[ offset_new + count ] = A->col[i];
-                B.val[ offset_new + count ] = A->val[i];
-                B.rowidx[ offset_new + count ] = row;
-                count++;
-            }
-        }
-    }
+    magma_csr_copy_if_host( A->num_rows, A->row, keep, B.row,
+        [&]( magma_int_t row, magma_index_t i, magma_index_t k ) {
+            B.col[ k ] = A->col[i];
+            B.val[ k ] = A->val[i];
+            B.rowidx[ k ] = row;
+        });
+    
     // finally, swap the matrices
     CHECK( magma_zmatrix_swap( &B, A, queue) );
     
@@ -1625,72 +1506,10 @@ magma_zmatrix_createrowptr(
     magma_queue_t queue )
 {
     magma_int_t info = 0;
-    magma_index_t *offset=NULL;//, *new_row;
-    
-    magma_int_t el_per_block, num_threads;
-    magma_int_t loc_offset = 0;
     
-  //  CHECK( magma_index_malloc_cpu( &new_row, n+1 ));
-  //  for( magma_int_t i = 0; i<n+1; i++ ){
-  //      new_row[ i ] = row[ i ];
-  //  }
+    // in-place inclusive scan of the counts; see control/primitives_host.hpp
+    magma_scan_host( true, n, row+1, row+1 );
     
-#ifdef _OPENMP
-    #pragma omp parallel
-    {
-        num_threads = omp_get_max_threads();
-    }
-#else
-    num_threads = 1;
-#endif
-    CHECK( magma_index_malloc_cpu( &offset, num_threads+1 ));
-    el_per_block = magma_ceildiv( n, num_threads );
-    
-    #pragma omp parallel
-    {
-#ifdef _OPENMP
-    magma_int_t id = omp_get_thread_num();
-#else
-    magma_int_t id = 0;
-#endif
-        magma_int_t start = (id)*el_per_block;
-        magma_int_t end = min((id+1)*el_per_block, n);
-        
-        magma_int_t loc_nz = 0;
-        for(magma_int_t i=start; i<end; i++ ){
-            loc_nz = loc_nz + row[i+1];
-            row[i+1] = loc_nz;
-        }
-        offset[id+1] = loc_nz;
-    }
-    
-    for( magma_int_t i=1; i<num_threads; i++ ){
-        magma_int_t start = (i)*el_per_block;
-        magma_int_t end = min((i+1)*el_per_block, n);
-        loc_offset = loc_offset + offset[i];
-        #pragma omp parallel for
-        for(magma_int_t j=start; j<end; j++ ){
-            row[j+1] = row[j+1]+loc_offset;        
-        }
-    }
-    
-    
-    
-   // for debugging
-  // nnz = 0;
-  // for( magma_int_t i = 0; i<n; i++ ){
-  //     nnz=nnz + new_row[ i+1 ];
-  //     new_row[ i+1 ] = nnz;
-  // }
-  // for( magma_int_t i = 0; i<n; i++ ){
-  //     if( row[i] != new_row[i] )
-  //         printf(" row[%d]: %d <<>> %d\n", i, row[i], new_row[i]);
-  //     assert( row[i] == new_row[i] );
-  // }
-    
-cleanup:
-    magma_free_cpu( offset );
-    //magma_free_cpu( new_row );
     return info;
 }
 
@@ -2303,55 +2122,30 @@ magma_zmatrix_tril(
 {
     magma_int_t info = 0;
     
+    auto keep = [=]( magma_int_t row, magma_index_t i ) {
+        return A.col[i] <= row;
+    };
+    
     U->num_rows = A.num_rows;
     U->num_cols = A.num_cols;
     U->storage_type = Magma_CSR;
     U->memory_location = Magma_CPU;
     
-    CHECK( magma_index_malloc_cpu( &U->row, A.num_rows+1 ) );
-    #pragma omp parallel for
-    for( magma_int_t row=0; row<A.num_rows; row++){
-        magma_int_t nz = 0;
-        
-        for( magma_int_t i=A.row[row]; i<A.row[row+1]; i++ ){
-            magma_index_t col = A.col[i];
-            if( col <= row ){
-                nz++;    
-            } else {
-                i=A.row[row+1];   
-            }
-        }
-        U->row[row+1] = nz;
-    }
-    
     // new row pointer
-    U->row[ 0 ] = 0;
-    CHECK( magma_zmatrix_createrowptr( U->num_rows, U->row, queue ) );
-    U->nnz = U->row[ U->num_rows ];
+    CHECK( magma_index_malloc_cpu( &U->row, A.num_rows+1 ) );
+    U->nnz = magma_csr_count_if_host( A.num_rows, A.row, keep, U->row );
     
     // allocate memory
     CHECK( magma_zmalloc_cpu( &U->val, U->nnz ) );
     CHECK( magma_index_malloc_cpu( &U->col, U->nnz ) );
     
     // copy
-    #pragma omp parallel for
-    for( magma_int_t row=0; row<A.num_rows; row++){
-        magma_int_t nz = 0;
-        magma_int_t offset = U->row[row];
-        
-        for( magma_int_t i=A.row[row]; i<A.row[row+1]; i++ ){
-            magma_index_t col = A.col[i];
-            if( col <= row ){
-                U->col[offset+nz] = col;
-                U->val[offset+nz] = A.val[i];
-                nz++;    
-            } else {
-                i=A.row[row+1];    
-            }
-        }
-    }
+    magma_csr_copy_if_host( A.num_rows, A.row, keep, U->row,
+        [&]( magma_int_t row, magma_index_t i, magma_index_t k ) {
+            U->col[ k ] = A.col[i];
+            U->val[ k ] = A.val[i];
+        });
     
-
 cleanup:
     return info;
 }
@@ -2396,54 +2190,29 @@ magma_zmatrix_triu(
 {
     magma_int_t info = 0;
     
+    auto keep = [=]( magma_int_t row, magma_index_t i ) {
+        return A.col[i] >= row;
+    };
+    
     U->num_rows = A.num_rows;
     U->num_cols = A.num_cols;
     U->storage_type = Magma_CSR;
     U->memory_location = Magma_CPU;
     
-    CHECK( magma_index_malloc_cpu( &U->row, A.num_rows+1 ) );
-    #pragma omp parallel for
-    for( magma_int_t row=0; row<A.num_rows; row++){
-        magma_int_t nz = 0;
-        
-        for( magma_int_t i=A.row[row]; i<A.row[row+1]; i++ ){
-            magma_index_t col = A.col[i];
-            if( col >= row ){
-                nz++;    
-            } else {
-                ;    
-            }
-        }
-        U->row[row+1] = nz;
-    }
-    
     // new row pointer
-    U->row[ 0 ] = 0;
-    CHECK( magma_zmatrix_createrowptr( U->num_rows, U->row, queue ) );
-    U->nnz = U->row[ U->num_rows ];
-    
+    CHECK( magma_index_malloc_cpu( &U->row, A.num_rows+1 ) );
+    U->nnz = magma_csr_count_if_host( A.num_rows, A.row, keep, U->row );
     
     // allocate memory
     CHECK( magma_zmalloc_cpu( &U->val, U->nnz ) );
     CHECK( magma_index_malloc_cpu( &U->col, U->nnz ) );
     
     // copy
-    #pragma omp parallel for
-    for( magma_int_t row=0; row<A.num_rows; row++){
-        magma_int_t nz = 0;
-        magma_int_t offset = U->row[row];
-        
-        for( magma_int_t i=A.row[row]; i<A.row[row+1]; i++ ){
-            magma_index_t col = A.col[i];
-            if( col >= row ){
-                U->col[offset+nz] = col;
-                U->val[offset+nz] = A.val[i];
-                nz++;    
-            } else {
-                ;    
-            }
-        }
-    }
+    magma_csr_copy_if_host( A.num_rows, A.row, keep, U->row,
+        [&]( magma_int_t row, magma_index_t i, magma_index_t k ) {
+            U->col[ k ] = A.col[i];
+            U->val[ k ] = A.val[i];
+        });
     
 cleanup:
     return info;
@@ -174,12 +174,9 @@ magma_cgeqrf2_gpu(
             }
             
             magma_queue_sync( queues[1] );  // wait to get work(i)
-            lapackf77_cgeqrf( &rows, &ib, work(i), &ldwork, &tau[i], hwork, &lhwork, info );
-            // Form the triangular factor of the block reflector in hwork
-            // H = H(i) H(i+1) . . . H(i+ib-1)
-            lapackf77_clarft( MagmaForwardStr, MagmaColumnwiseStr,
-                              &rows, &ib,
-                              work(i), &ldwork, &tau[i], hwork, &ib );
+            // Factor the panel and form the triangular factor of the
+            // block reflector H = H(i) H(i+1) . . . H(i+ib-1) in hwork
+            magma_cgeqrt3_cpu( rows, ib, work(i), ldwork, &tau[i], hwork, ib, info );
             
             // set  the upper triangle of panel (V) to identity
             magma_cpanel_to_q( MagmaUpper, ib, work(i), ldwork, hwork+ib*ib );
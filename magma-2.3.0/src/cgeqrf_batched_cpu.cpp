@@ -0,0 +1,253 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgeqrf_batched_cpu.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+
+*/
+#include "batched_compact.hpp"  // includes magma_internal.h after <algorithm>
+
+/******************************************************************************/
+// Common code for magma_cgeqrf_batched_cpu and magma_cgeqrf_vbatched_cpu;
+// m_array, n_array, and lda_array are NULL for a fixed size batch.
+static void
+magma_cgeqrf_batched_cpu_core(
+    magma_int_t m, const magma_int_t *m_array,
+    magma_int_t n, const magma_int_t *n_array,
+    magmaFloatComplex **A_array,
+    magma_int_t lda, const magma_int_t *lda_array,
+    magmaFloatComplex **tau_array,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    typedef magmaFloatComplex T;
+    const int L = magma_compact_traits< T >::lanes;
+
+    magma_compact_groups groups;
+    magma_compact_make_groups( batchCount, L, m, n, m_array, n_array, groups );
+
+    magma_compact_parallel_groups< T >( groups,
+        [&]( const magma_int_t* idx, magma_int_t count, std::vector< T >& work )
+        {
+            magma_int_t mk = (m_array ? m_array[ idx[0] ] : m);
+            magma_int_t nk = (n_array ? n_array[ idx[0] ] : n);
+            magma_int_t minmn = min( mk, nk );
+            T* ptr[ L ];
+            magma_int_t ld[ L ];
+            for (magma_int_t l = 0; l < count; ++l) {
+                ptr[l] = A_array[ idx[l] ];
+                ld[l]  = (lda_array ? lda_array[ idx[l] ] : lda);
+                info_array[ idx[l] ] = 0;
+            }
+            if (minmn <= 0)
+                return;
+
+            if (mk > magma_compact_max_size || nk > magma_compact_max_size) {
+                T query;
+                magma_int_t lwork = -1;
+                lapackf77_cgeqrf( &mk, &nk, ptr[0], &ld[0], tau_array[ idx[0] ],
+                                  &query, &lwork, &info_array[ idx[0] ] );
+                lwork = magma_int_t( MAGMA_C_REAL( query ));
+                work.resize( lwork );
+                for (magma_int_t l = 0; l < count; ++l) {
+                    lapackf77_cgeqrf( &mk, &nk, ptr[l], &ld[l], tau_array[ idx[l] ],
+                                      &work[0], &lwork, &info_array[ idx[l] ] );
+                }
+                return;
+            }
+
+            // matrix, then compact tau in the workspace
+            work.resize( (mk*nk + minmn)*L );
+            T* Ac   = &work[0];
+            T* tauc = Ac + mk*nk*L;
+
+            magma_compact_pack( MagmaNoTrans, mk, nk, ptr, ld, count, Ac, false );
+            if (mk == nk) {
+                magma_compact_dispatch< magma_compact_nt_max, magma_geqrf_compact_kernel< T > >
+                    ::run( nk, nk, Ac, tauc );
+            }
+            else {
+                magma_geqrf_compact_kernel< T >::template run< 0 >( mk, nk, Ac, tauc );
+            }
+            magma_compact_unpack( MagmaNoTrans, MagmaFull, mk, nk, Ac, ptr, ld, count );
+            for (magma_int_t l = 0; l < count; ++l) {
+                T* tau = tau_array[ idx[l] ];
+                for (magma_int_t j = 0; j < minmn; ++j) {
+                    tau[j] = tauc[ j*L + l ];
+                }
+            }
+        });
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CGEQRF_BATCHED_CPU computes a QR factorization of a batch of complex
+    M-by-N matrices A_i = Q_i * R_i, on the CPU host.
+
+    For M, N <= 64, groups of matrices are interleaved in SIMD lanes (the
+    compact layout of batched_compact.hpp) and factored together by
+    unblocked Householder QR, with a kernel specialized at compile time for
+    square matrices of order N <= 32. Larger matrices are factored one at a
+    time by LAPACK. Matrices are distributed over the OpenMP threads.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of each matrix A_i.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of each matrix A_i.  N >= 0.
+
+    @param[in,out]
+    A_array Array of pointers, dimension (batchCount).
+            Each is a COMPLEX array A_i, dimension (LDA,N).
+            On entry, the M-by-N matrix A_i.
+            On exit, the elements on and above the diagonal of the array
+            contain the min(M,N)-by-N upper trapezoidal matrix R_i; the
+            elements below the diagonal, with the array tau_i, represent
+            the unitary matrix Q_i as a product of min(m,n) elementary
+            reflectors, as returned by cgeqrf.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of each A_i.  LDA >= max(1,M).
+
+    @param[out]
+    tau_array   Array of pointers, dimension (batchCount).
+            Each is a COMPLEX array tau_i, dimension (min(M,N)).
+            The scalar factors of the elementary reflectors.
+
+    @param[out]
+    info_array  Array of INTEGERs, dimension (batchCount), for each matrix:
+      -     = 0:  successful exit
+
+    @param[in]
+    batchCount  INTEGER
+                The number of matrices to operate on.
+
+    @return
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value.
+
+    @ingroup magma_geqrf_batched
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cgeqrf_batched_cpu(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex **A_array, magma_int_t lda,
+    magmaFloatComplex **tau_array,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    magma_int_t arginfo = 0;
+    if (m < 0) {
+        arginfo = -1;
+    } else if (n < 0) {
+        arginfo = -2;
+    } else if (lda < max(1,m)) {
+        arginfo = -4;
+    } else if (batchCount < 0) {
+        arginfo = -7;
+    }
+    if (arginfo != 0) {
+        magma_xerbla( __func__, -(arginfo) );
+        return arginfo;
+    }
+
+    /* Quick return if possible */
+    if (batchCount == 0)
+        return arginfo;
+
+    magma_cgeqrf_batched_cpu_core( m, NULL, n, NULL, A_array, lda, NULL,
+                                   tau_array, info_array, batchCount );
+    return arginfo;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CGEQRF_VBATCHED_CPU computes a QR factorization of a batch of complex
+    matrices A_i of variable sizes, on the CPU host.
+    See magma_cgeqrf_batched_cpu.
+
+    The matrices are sorted into size classes, the matrices of the same
+    dimensions, and each class is factored as a fixed size batch.
+
+    Arguments
+    ---------
+    @param[in]
+    m       Array of INTEGERs, dimension (batchCount).
+            The number of rows of each matrix A_i.  M[i] >= 0.
+
+    @param[in]
+    n       Array of INTEGERs, dimension (batchCount).
+            The number of columns of each matrix A_i.  N[i] >= 0.
+
+    @param[in,out]
+    A_array Array of pointers, dimension (batchCount).
+            Each is a COMPLEX array A_i, dimension (LDA[i],N[i]).
+            On entry, the matrix A_i. On exit, R_i and the reflectors of Q_i.
+
+    @param[in]
+    lda     Array of INTEGERs, dimension (batchCount).
+            The leading dimension of each A_i.  LDA[i] >= max(1,M[i]).
+
+    @param[out]
+    tau_array   Array of pointers, dimension (batchCount).
+            Each is a COMPLEX array tau_i, dimension (min(M[i],N[i])).
+            The scalar factors of the elementary reflectors.
+
+    @param[out]
+    info_array  Array of INTEGERs, dimension (batchCount), for each matrix:
+      -     = 0:  successful exit
+
+    @param[in]
+    batchCount  INTEGER
+                The number of matrices to operate on.
+
+    @return
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value,
+                  for at least one matrix.
+
+    @ingroup magma_geqrf_batched
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cgeqrf_vbatched_cpu(
+    magma_int_t *m, magma_int_t *n,
+    magmaFloatComplex **A_array, magma_int_t *lda,
+    magmaFloatComplex **tau_array,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    magma_int_t arginfo = 0;
+    if (batchCount < 0) {
+        arginfo = -7;
+    }
+    for (magma_int_t i = 0; i < batchCount && arginfo == 0; ++i) {
+        if (m[i] < 0) {
+            arginfo = -1;
+        } else if (n[i] < 0) {
+            arginfo = -2;
+        } else if (lda[i] < max(1,m[i])) {
+            arginfo = -4;
+        }
+    }
+    if (arginfo != 0) {
+        magma_xerbla( __func__, -(arginfo) );
+        return arginfo;
+    }
+
+    /* Quick return if possible */
+    if (batchCount == 0)
+        return arginfo;
+
+    magma_cgeqrf_batched_cpu_core( 0, m, 0, n, A_array, 0, lda,
+                                   tau_array, info_array, batchCount );
+    return arginfo;
+}
@@ -0,0 +1,253 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgeqrf_disk.cpp, normal z -> c, Sat Oct 17 06:08:49 2026
+*/
+#include "file_io.hpp"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CGEQRF_DISK computes a QR factorization of a COMPLEX M-by-N matrix A
+    that is stored in a file: A = Q * R. This is an out-of-core version,
+    similar to magma_cgeqrf_ooc, but for matrices that do not fit in host
+    memory.
+
+    This is a left-looking algorithm, computed on the CPU host. The matrix is
+    processed in panels of NW columns, where NW is determined by LWORK. Each
+    panel is read once, updated by the Householder reflectors of the previous
+    panels, factored, and written back once. Previous panels are re-read
+    from the file, while the next one is prefetched, except the immediately
+    preceding panel, which is still in memory. A separate I/O thread does
+    all reads and writes (see magma_file_io), overlapping them with the
+    computation.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    fd      INTEGER
+            File descriptor, open for reading and writing, of a file that
+            contains the COMPLEX array A, dimension (LDA,N), in column-major
+            order, in native binary format.
+    \n
+            On entry, the M-by-N matrix A.
+            On exit, the elements on and above the diagonal of the array
+            contain the min(M,N)-by-N upper trapezoidal matrix R (R is
+            upper triangular if m >= n); the elements below the diagonal,
+            with the array TAU, represent the orthogonal matrix Q as a
+            product of min(m,n) elementary reflectors (see Further
+            Details).
+
+    @param[in]
+    offset  INTEGER
+            Byte offset of A(0,0) in the file, e.g., to skip a header.
+            OFFSET >= 0.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @param[out]
+    tau     COMPLEX array, dimension (min(M,N))
+            The scalar factors of the elementary reflectors (see Further
+            Details).
+
+    @param[out]
+    work    (workspace) COMPLEX array, dimension (MAX(1,LWORK))
+            On exit, if INFO = 0, WORK[0] returns the minimum LWORK.
+
+    @param[in]
+    lwork   INTEGER
+            The dimension of the array WORK.  LWORK >= (4*M + 2*NB)*NB,
+            where NB can be obtained through magma_get_zgeqrf_nb( M, N ).
+            Panels are NW columns wide, the largest multiple of NB such
+            that (4*M + 2*NW)*NW <= LWORK, so a larger LWORK means less I/O.
+    \n
+            If LWORK = -1, then a workspace query is assumed; the routine
+            only calculates the minimum size of the WORK array, returns
+            this value as the first entry of the WORK array, and no error
+            message related to LWORK is issued.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed
+                  or a read or write of the file failed (MAGMA_ERR_FILESYSTEM).
+
+    Further Details
+    ---------------
+    The matrix Q is represented as a product of elementary reflectors
+
+        Q = H(1) H(2) . . . H(k), where k = min(m,n).
+
+    Each H(i) has the form
+
+        H(i) = I - tau * v * v'
+
+    where tau is a complex scalar, and v is a complex vector with
+    v(1:i-1) = 0 and v(i) = 1; v(i+1:m) is stored on exit in A(i+1:m,i),
+    and tau in TAU(i).
+
+    @ingroup magma_geqrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cgeqrf_disk(
+    magma_int_t m, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    magmaFloatComplex *tau,
+    magmaFloatComplex *work, magma_int_t lwork,
+    magma_int_t *info )
+{
+    #define P(i_, j_)  (P + (i_) + (j_)*ldp)
+
+    /* Local variables */
+    magma_int_t nb = magma_get_zgeqrf_nb( m, n );
+    magma_int_t lwkopt = (4*max(1,m) + 2*nb)*nb;
+    work[0] = magma_cmake_lwork( lwkopt );
+    bool lquery = (lwork == -1);
+
+    /* Check arguments */
+    *info = 0;
+    if (m < 0) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (fd < 0) {
+        *info = -3;
+    } else if (offset < 0) {
+        *info = -4;
+    } else if (lda < max(1,m)) {
+        *info = -5;
+    } else if (lwork < lwkopt && ! lquery) {
+        *info = -8;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+    else if (lquery) {
+        return *info;
+    }
+
+    /* Quick return */
+    magma_int_t min_mn = min( m, n );
+    if ( min_mn == 0 )
+        return *info;
+
+    // panel width; buffers for 2 panels and 2 previous panels, each m x nw,
+    // plus T and larfb workspace, each nw x nw
+    magma_int_t ldp = m;
+    magma_int_t nw  = (lwork / (4*ldp)) / nb * nb;
+    while (nw > nb && (4*ldp + 2*nw)*nw > lwork) {
+        nw -= nb;
+    }
+    nw = min( n, nw );
+    magmaFloatComplex *panel[2] = { work,            work +   ldp*nw };
+    magmaFloatComplex *block[2] = { work + 2*ldp*nw, work + 3*ldp*nw };
+    magmaFloatComplex *T        =   work + 4*ldp*nw;
+    magmaFloatComplex *W        =   T    +   nw*nw;
+
+    // workspace for panel factorization
+    magma_int_t lhwork = -1, iinfo;
+    magmaFloatComplex query[1];
+    lapackf77_cgeqrf( &m, &nw, work, &ldp, tau, query, &lhwork, &iinfo );
+    lhwork = magma_int_t( MAGMA_C_REAL( query[0] ));
+    magmaFloatComplex *hwork;
+    if (MAGMA_SUCCESS != magma_cmalloc_cpu( &hwork, lhwork )) {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+
+    magma_file_io io( fd, offset, lda, sizeof(magmaFloatComplex) );
+    magma_int_t rpanel, rblock[2] = { 0, 0 };
+    magma_int_t j, jb, k;
+
+    // read first panel
+    rpanel = io.read( m, nw, 0, 0, panel[0], ldp );
+
+    for (j = 0; j < n; j += nw) {
+        jb = min( nw, n-j );
+        magmaFloatComplex *P    = panel[ (j/nw) % 2 ];      // current panel, A(0:m, j:j+jb)
+        magmaFloatComplex *prev = panel[ (j/nw + 1) % 2 ];  // previous panel, in memory
+        magma_int_t jn  = j + nw;  // next panel
+        magma_int_t jnb = min( nw, n-jn );
+
+        // Previous panels that have reflectors are 0, ..., nprev-1.
+        // Unless m <= j - nw, the last of these is prev, still in memory;
+        // the others, 0, ..., ndisk-1, are read from disk.
+        magma_int_t nprev = magma_ceildiv( min( j, min_mn ), nw );
+        magma_int_t ndisk = (nprev == j/nw ? nprev-1 : nprev);
+
+        // Prefetch first previous panel, V(0:m, 0:nw).
+        if (ndisk >= 1)
+            rblock[0] = io.read( m, min( nw, m ), 0, 0, block[0], ldp );
+        io.wait( rpanel );
+        if (io.error() != 0)
+            break;
+
+        // Apply Q(k)**H of previous panels, ascending.
+        for (k = 0; k < nprev; ++k) {
+            magma_int_t k0 = k*nw;
+            magma_int_t mk = m - k0;
+            magma_int_t kb = min( nw, mk );  // number of reflectors in panel k
+            magmaFloatComplex *V;           // V(k0:m, k0:k0+kb)
+            if (k < ndisk) {
+                if (k+1 < ndisk) {
+                    magma_int_t k1 = k0 + nw;
+                    rblock[(k+1) % 2] = io.read( m - k1, min( nw, m - k1 ), k1, k1,
+                                                 block[(k+1) % 2], ldp );
+                }
+                io.wait( rblock[ k % 2 ] );
+                if (io.error() != 0)
+                    break;
+                V = block[ k % 2 ];
+            }
+            else {
+                V = prev + k0;
+            }
+            lapackf77_clarft( MagmaForwardStr, MagmaColumnwiseStr,
+                              &mk, &kb, V, &ldp, &tau[k0], T, &nw );
+            lapackf77_clarfb( MagmaLeftStr, MagmaConjTransStr,
+                              MagmaForwardStr, MagmaColumnwiseStr,
+                              &mk, &jb, &kb,
+                              V, &ldp, T, &nw,
+                              P(k0,0), &ldp, W, &jb );
+        }
+        if (io.error() != 0)
+            break;
+
+        // prev is no longer needed, and the I/O thread finishes writing
+        // it before reading into it, so prefetch next panel now
+        if (jn < n)
+            rpanel = io.read( m, jnb, 0, jn, prev, ldp );
+
+        // factor panel
+        if (j < m) {
+            magma_int_t mj = m - j;
+            lapackf77_cgeqrf( &mj, &jb, P(j,0), &ldp, &tau[j], hwork, &lhwork, &iinfo );
+        }
+        io.write( MagmaFull, m, jb, 0, j, P, ldp );
+    }
+
+    io.sync();
+    if (io.error() != 0) {
+        *info = MAGMA_ERR_FILESYSTEM;
+    }
+
+    magma_free_cpu( hwork );
+
+    return *info;
+} /* magma_cgeqrf_disk */
@@ -186,19 +186,14 @@ magma_cgeqrf2_mgpu(
                                     queues[panel_dev][1] );
             magma_queue_sync( queues[panel_dev][1] );
 
-            // Factor panel
-            lapackf77_cgeqrf( &rows, &ib, hpanel(i), &ldhpanel, tau+i,
-                              hwork, &lhwork, info );
+            // Factor panel and form the triangular factor of the block
+            // reflector H = H(i) H(i+1) . . . H(i+ib-1) in hwork
+            magma_cgeqrt3_cpu( rows, ib, hpanel(i), ldhpanel, tau+i,
+                               hwork, ib, info );
             if ( *info != 0 ) {
                 fprintf( stderr, "error %lld\n", (long long) *info );
             }
 
-            // Form the triangular factor of the block reflector
-            // H = H(i) H(i+1) . . . H(i+ib-1)
-            lapackf77_clarft( MagmaForwardStr, MagmaColumnwiseStr,
-                              &rows, &ib,
-                              hpanel(i), &ldhpanel, tau+i, hwork, &ib );
-
             magma_cpanel_to_q( MagmaUpper, ib, hpanel(i), ldhpanel, hwork + ib*ib );
             // Send the current panel back to the GPUs
             for( dev=0; dev < ngpu; dev++ ) {
@@ -0,0 +1,200 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgeqrf_tile.cpp, normal z -> c, Sat Oct 17 06:16:06 2026
+*/
+#include "task_scheduler.hpp"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CGEQRF_TILE computes a QR factorization of a COMPLEX M-by-N matrix A
+    stored in tile-major layout: A = Q * R.
+
+    This is a tile algorithm, computed on the CPU host. For each tile column
+    k, geqrt factors the diagonal tile, and tsqrt eliminates each tile below
+    it, coupling it with the triangle R(k,k); unmqr and tsmqr apply the
+    corresponding block reflectors to the tiles to the right. Each is a task
+    (using LAPACK's geqrt, gemqrt, tpqrt, and tpmqrt), and
+    magma_task_scheduler executes tasks as soon as the tiles they depend on
+    are ready. Since elimination is tile-by-tile, Q is not the same product
+    of reflectors as in LAPACK's cgeqrf, though R is the same up to signs.
+    Use magma_cge2tile and magma_ctile2ge to convert to and from LAPACK layout.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size.  NB >= 1.
+
+    @param[in,out]
+    A       COMPLEX array, dimension (MT*NT*NB*NB), where MT = ceil(M/NB)
+            and NT = ceil(N/NB).
+            On entry, the M-by-N matrix A in tile-major layout
+            (see magma_cge2tile).
+            On exit, the elements on and above the diagonal of the array
+            contain the min(M,N)-by-N upper trapezoidal matrix R (R is
+            upper triangular if m >= n); the elements below the diagonal
+            of the diagonal tiles, and the tiles below the diagonal tiles,
+            contain the Householder vectors of geqrt and tsqrt.
+
+    @param[out]
+    T       COMPLEX array, dimension (MT*NT*NB*NB), in tile-major layout.
+            On exit, tile T(k,k) contains the triangular factor of the block
+            reflector from geqrt on A(k,k), and tile T(i,k), i > k, contains
+            the triangular factor from tsqrt on A(k,k) and A(i,k).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+
+    @ingroup magma_geqrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cgeqrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    magmaFloatComplex *A,
+    magmaFloatComplex *T,
+    magma_int_t *info )
+{
+    #define A(i_, j_)  (A + ((i_) + (j_)*mt)*nb*nb)
+    #define T(i_, j_)  (T + ((i_) + (j_)*mt)*nb*nb)
+
+    /* Constants */
+    const magma_int_t izero = 0;
+
+    /* Check arguments */
+    *info = 0;
+    if (m < 0) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (nb < 1) {
+        *info = -3;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (m == 0 || n == 0)
+        return *info;
+
+    magma_int_t mt = magma_ceildiv( m, nb );
+    magma_int_t nt = magma_ceildiv( n, nb );
+
+    // workspace for each thread's kernels, nb*nb each
+    magma_int_t nthread = magma_get_parallel_numthreads();
+    magmaFloatComplex *work;
+    if (MAGMA_SUCCESS != magma_cmalloc_cpu( &work, nthread*nb*nb )) {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+
+    // tasks run single-threaded BLAS
+    magma_int_t lapack_threads = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+
+    // Kernels get a workspace from a free list, since tasks do not know
+    // which thread executes them.
+    std::vector< magmaFloatComplex* > free_work;
+    for (magma_int_t t = 0; t < nthread; ++t) {
+        free_work.push_back( work + t*nb*nb );
+    }
+    pthread_mutex_t work_mutex;
+    pthread_mutex_init( &work_mutex, NULL );
+    auto get_work = [&]() {
+        pthread_mutex_lock( &work_mutex );
+        magmaFloatComplex *W = free_work.back();
+        free_work.pop_back();
+        pthread_mutex_unlock( &work_mutex );
+        return W;
+    };
+    auto put_work = [&]( magmaFloatComplex *W ) {
+        pthread_mutex_lock( &work_mutex );
+        free_work.push_back( W );
+        pthread_mutex_unlock( &work_mutex );
+    };
+
+    magma_task_scheduler dag;
+    dag.launch( nthread );
+
+    for (magma_int_t k = 0; k < min( mt, nt ); ++k) {
+        magma_int_t mb = min( nb, m - k*nb );  // rows in A(k,k)
+        magma_int_t kb = min( nb, n - k*nb );  // cols in A(k,k)
+        magma_int_t ib = min( mb, kb );        // number of reflectors in A(k,k)
+
+        // factor diagonal tile, A(k,k) = Q(k,k) R(k,k)
+        dag.insert( { magma_task_write( A(k,k) ), magma_task_write( T(k,k) ) }, [=] {
+            magmaFloatComplex *W = get_work();
+            magma_int_t iinfo;
+            lapackf77_cgeqrt( &mb, &kb, &ib, A(k,k), &nb, T(k,k), &nb, W, &iinfo );
+            put_work( W );
+        });
+
+        // A(k,j) = Q(k,k)^H A(k,j)
+        for (magma_int_t j = k+1; j < nt; ++j) {
+            magma_int_t jb = min( nb, n - j*nb );
+            dag.insert( { magma_task_read( A(k,k) ), magma_task_read( T(k,k) ),
+                          magma_task_write( A(k,j) ) }, [=] {
+                magmaFloatComplex *W = get_work();
+                magma_int_t iinfo;
+                lapackf77_cgemqrt( MagmaLeftStr, Magma_ConjTransStr, &mb, &jb, &ib, &ib,
+                                   A(k,k), &nb, T(k,k), &nb, A(k,j), &nb, W, &iinfo );
+                put_work( W );
+            });
+        }
+
+        for (magma_int_t i = k+1; i < mt; ++i) {
+            magma_int_t mi = min( nb, m - i*nb );
+
+            // eliminate A(i,k), [ R(k,k); A(i,k) ] = Q(i,k) [ R(k,k); 0 ]
+            dag.insert( { magma_task_write( A(k,k) ), magma_task_write( A(i,k) ),
+                          magma_task_write( T(i,k) ) }, [=] {
+                magmaFloatComplex *W = get_work();
+                magma_int_t iinfo;
+                lapackf77_ctpqrt( &mi, &kb, &izero, &kb, A(k,k), &nb, A(i,k), &nb,
+                                  T(i,k), &nb, W, &iinfo );
+                put_work( W );
+            });
+
+            // [ A(k,j); A(i,j) ] = Q(i,k)^H [ A(k,j); A(i,j) ]
+            for (magma_int_t j = k+1; j < nt; ++j) {
+                magma_int_t jb = min( nb, n - j*nb );
+                dag.insert( { magma_task_read( A(i,k) ), magma_task_read( T(i,k) ),
+                              magma_task_write( A(k,j) ), magma_task_write( A(i,j) ) }, [=] {
+                    magmaFloatComplex *W = get_work();
+                    magma_int_t iinfo;
+                    lapackf77_ctpmqrt( MagmaLeftStr, Magma_ConjTransStr, &mi, &jb, &kb, &izero, &kb,
+                                       A(i,k), &nb, T(i,k), &nb, A(k,j), &nb, A(i,j), &nb,
+                                       W, &iinfo );
+                    put_work( W );
+                });
+            }
+        }
+    }
+
+    dag.sync();
+    dag.quit();
+    magma_set_lapack_numthreads( lapack_threads );
+
+    pthread_mutex_destroy( &work_mutex );
+    magma_free_cpu( work );
+
+    return *info;
+} /* magma_cgeqrf_tile */
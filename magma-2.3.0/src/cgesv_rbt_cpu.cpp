@@ -0,0 +1,192 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgesv_rbt_cpu.cpp, normal z -> c, Sat Oct 17 06:21:21 2026
+
+*/
+#include "magma_internal.h"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CGESV_RBT_CPU solves a system of linear equations
+        A * X = B
+    where A is a general N-by-N matrix and X and B are N-by-NRHS matrices.
+    This is the host version of CGESV_RBT, computed entirely on the CPU.
+    Random Butterfly Tranformation is applied on A and B (magma_cgerbt_cpu),
+    then the tile LU decomposition with no pivoting (magma_cgetrf_nopiv_tile)
+    is used to factor A as
+        A = L * U,
+    where L is unit lower triangular, and U is
+    upper triangular.  The factored form of A is then used to solve the
+    system of equations A * X = B.
+    The solution can then be improved using iterative refinement
+    (magma_cgerfs_nopiv_tile).
+
+    Since no pivots are searched, the panel of the LU factorization does not
+    synchronize the threads, as it does in partial pivoting.
+
+    Arguments
+    ---------
+    @param[in]
+    refine  magma_bool_t
+            Specifies if iterative refinement is to be applied to improve the solution.
+      -     = MagmaTrue:   Iterative refinement is applied.
+      -     = MagmaFalse:  Iterative refinement is not applied.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    nrhs    INTEGER
+            The number of right hand sides, i.e., the number of columns
+            of the matrix B.  NRHS >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size of the LU factorization.  NB >= 1.
+
+    @param[in]
+    A       COMPLEX array, dimension (LDA,N).
+            The N-by-N coefficient matrix A. It is not modified.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[in,out]
+    B       COMPLEX array, dimension (LDB,NRHS)
+            On entry, the right hand side matrix B.
+            On exit, the solution matrix X.
+
+    @param[in]
+    ldb     INTEGER
+            The leading dimension of the array B.  LDB >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+      -     > 0:  if INFO = i, U(i,i) of the randomized matrix is exactly
+                  zero, so the solution could not be computed.
+
+    @ingroup magma_gesv_rbt
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cgesv_rbt_cpu(
+    magma_bool_t refine, magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const magmaFloatComplex *A, magma_int_t lda,
+    magmaFloatComplex *B, magma_int_t ldb,
+    magma_int_t *info)
+{
+    /* Constants */
+    const magmaFloatComplex c_zero = MAGMA_C_ZERO;
+    const magmaFloatComplex c_one  = MAGMA_C_ONE;
+
+    /* Local variables */
+    magma_int_t nn = magma_roundup( n, 4 );  // butterflies need a multiple of 4
+    magma_int_t nt = magma_ceildiv( nn, nb );
+    magmaFloatComplex *hu=NULL, *hv=NULL, *hA=NULL, *hB=NULL, *hX=NULL,
+                       *hT=NULL, *work=NULL;
+    magma_int_t iter;
+
+    /* Function Body */
+    *info = 0;
+    if ( ! (refine == MagmaTrue) &&
+         ! (refine == MagmaFalse) ) {
+        *info = -1;
+    }
+    else if (n < 0) {
+        *info = -2;
+    } else if (nrhs < 0) {
+        *info = -3;
+    } else if (nb < 1) {
+        *info = -4;
+    } else if (lda < max(1,n)) {
+        *info = -6;
+    } else if (ldb < max(1,n)) {
+        *info = -8;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return if possible */
+    if (nrhs == 0 || n == 0)
+        return *info;
+
+    if (MAGMA_SUCCESS != magma_cmalloc_cpu( &hu, 2*nn ) ||
+        MAGMA_SUCCESS != magma_cmalloc_cpu( &hv, 2*nn ) ||
+        MAGMA_SUCCESS != magma_cmalloc_cpu( &hA, nn*nn ) ||
+        MAGMA_SUCCESS != magma_cmalloc_cpu( &hB, nn*nrhs ) ||
+        MAGMA_SUCCESS != magma_cmalloc_cpu( &hT, nt*nt*nb*nb ))
+    {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        goto cleanup;
+    }
+    if (refine == MagmaTrue) {
+        if (MAGMA_SUCCESS != magma_cmalloc_cpu( &hX,   nn*nrhs ) ||
+            MAGMA_SUCCESS != magma_cmalloc_cpu( &work, nn*nrhs ))
+        {
+            *info = MAGMA_ERR_HOST_ALLOC;
+            goto cleanup;
+        }
+    }
+    else {
+        hX = hB;
+    }
+
+    /* Pad A with the identity, and B with zeros */
+    lapackf77_claset( MagmaFullStr, &nn, &nn,   &c_zero, &c_one,  hA, &nn );
+    lapackf77_claset( MagmaFullStr, &nn, &nrhs, &c_zero, &c_zero, hB, &nn );
+    lapackf77_clacpy( MagmaFullStr, &n, &n,    A, &lda, hA, &nn );
+    lapackf77_clacpy( MagmaFullStr, &n, &nrhs, B, &ldb, hB, &nn );
+
+    magma_cgerbt_cpu( MagmaTrue, nn, nrhs, hA, nn, hB, nn, hu, hv, info );
+    if (*info != 0) {
+        goto cleanup;
+    }
+
+    /* Solve the system U^TAV.y = U^T.b; the randomized A and b in
+       LAPACK layout are kept for the refinement */
+    magma_cge2tile( nn, nn, nb, hA, nn, hT );
+    if (refine == MagmaTrue) {
+        lapackf77_clacpy( MagmaFullStr, &nn, &nrhs, hB, &nn, hX, &nn );
+    }
+    magma_cgetrf_nopiv_tile( nn, nn, nb, hT, info );
+    if (*info != 0) {
+        goto cleanup;
+    }
+    magma_cgetrs_nopiv_tile( nn, nrhs, nb, hT, hX, nn, info );
+
+    /* Iterative refinement */
+    if (refine == MagmaTrue) {
+        magma_cgerfs_nopiv_tile( nn, nrhs, nb, hA, nn, hB, nn, hX, nn, work, hT, &iter, info );
+    }
+
+    /* The solution of A.x = b is Vy */
+    magma_cprbt_mv_cpu( nn, nrhs, hv, hX, nn );
+
+    lapackf77_clacpy( MagmaFullStr, &n, &nrhs, hX, &nn, B, &ldb );
+
+cleanup:
+    magma_free_cpu( hu );
+    magma_free_cpu( hv );
+    magma_free_cpu( hA );
+    magma_free_cpu( hB );
+    magma_free_cpu( hT );
+
+    if (refine == MagmaTrue) {
+        magma_free_cpu( hX );
+        magma_free_cpu( work );
+    }
+
+    return *info;
+}
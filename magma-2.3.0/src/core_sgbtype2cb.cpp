@@ -0,0 +1,138 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/core_dgbtype2cb.cpp, normal d -> s, Wed Nov 15 00:34:20 2017
+
+*/
+#include "magma_internal.h"
+
+
+// band storage with 2*nb diagonals above and nb below the main diagonal
+#define A(m,n)   (A + lda * (n) + ((m)-(n)) + 2*nb)
+
+/***************************************************************************//**
+ *
+ * @ingroup magma_gbtype2cb
+ *
+ *  magma_sgbtype2cb is a kernel that will operate on a region (triangle) of data
+ *  bounded by st and ed, for the reduction of an upper band matrix to upper
+ *  bidiagonal form. This kernel applies the left update remaining from the
+ *  type1 or type3 to the next nb columns, A(st:ed,ed+1:ed+nb). This creates
+ *  a bulge, whose first row is eliminated by a right Householder reflector,
+ *  which is then applied to the rows of the bulge, A(st+1:ed,ed+1:ed+nb).
+ *  The following magma_sgbtype3cb applies it to the next diagonal block.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A.
+ *
+ * @param[in] nb
+ *          The size of the band.
+ *
+ * @param[in, out] A
+ *          A pointer to the matrix A of size (3*nb+1)-by-n, stored as in
+ *          magma_sgbtype1cb.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A. lda >= max(1,3*nb+1)
+ *
+ * @param[in] VQ
+ *          REAL array, dimension (ldv*blkcnt*Vblksiz).
+ *          The left Householder reflectors, as stored by the previous kernel.
+ *
+ * @param[in] TAUQ
+ *          REAL array, dimension (blkcnt*Vblksiz).
+ *          The scalar factors of the left Householder reflectors.
+ *
+ * @param[out] VP
+ *          REAL array, dimension (ldv*blkcnt*Vblksiz).
+ *          The right Householder reflectors are stored in this array.
+ *
+ * @param[out] TAUP
+ *          REAL array, dimension (blkcnt*Vblksiz).
+ *          The scalar factors of the right Householder reflectors.
+ *
+ * @param[in] ldv
+ *          The leading dimension of VQ and VP. ldv >= nb + Vblksiz.
+ *
+ * @param[in] st
+ *          A pointer to the start index where this kernel will operate.
+ *
+ * @param[in] ed
+ *          A pointer to the end index where this kernel will operate.
+ *
+ * @param[in] sweep
+ *          The sweep number that is eliminated. it serve to calculate the
+ *          pointer to the position where to store the Vs and Ts.
+ *
+ * @param[in] Vblksiz
+ *          constant which correspond to the blocking used when applying the Vs.
+ *          it serve to calculate the pointer to the position where to store the
+ *          Vs and Ts.
+ *
+ * @param[in] work
+ *          Workspace of size nb.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// TYPE 2-BAND Upper-rowwise-Householder
+
+extern "C" void
+magma_sgbtype2cb(magma_int_t n, magma_int_t nb,
+                float *A, magma_int_t lda,
+                float *VQ, float *TAUQ,
+                float *VP, float *TAUP,
+                magma_int_t ldv,
+                magma_int_t st, magma_int_t ed, magma_int_t sweep,
+                magma_int_t Vblksiz,
+                float *work)
+{
+    magma_int_t J1, J2, len, lem, len1, lem1, ldx;
+    magma_int_t vpos, taupos;
+
+    magma_int_t ione = 1;
+    float c_one    =  MAGMA_S_ONE;
+
+    magma_bulge_findVTAUpos(n, nb, Vblksiz, sweep, st, ldv, &vpos, &taupos);
+
+    ldx = lda-1;
+    J1  = ed+1;
+    J2  = min(ed+nb,n-1);
+    len = ed-st+1;
+    lem = J2-J1+1;
+
+    if ( lem <= 0 )
+        return;
+
+    /* Apply remaining left commming from the top block */
+    lapackf77_slarfx( "L", &len, &lem, VQ+vpos, TAUQ+taupos, A(st, J1), &ldx, work );
+
+    if ( lem > 1 ) {
+        magma_bulge_findVTAUpos(n, nb, Vblksiz, sweep, J1, ldv, &vpos, &taupos);
+
+        /* Remove the first row of the created bulge */
+        lem1 = lem-1;
+        *(VP+vpos) = c_one;
+        blasf77_scopy( &lem1, A(st, J1+1), &ldx, VP+vpos+1, &ione );
+        for (magma_int_t j = J1+1; j <= J2; ++j) {
+            *A(st, j) = MAGMA_S_ZERO;
+        }
+        lapackf77_slarfg( &lem, A(st, J1), VP+vpos+1, &ione, TAUP+taupos );
+
+        /*
+         * Apply right on A(st+1:ed,J1:J2)
+         * We decrease len because we start at row st+1 instead of st.
+         * row st is the row that has been removed;
+         */
+        len1 = len-1;
+        lapackf77_slarfx( "R", &len1, &lem, VP+vpos, TAUP+taupos, A(st+1, J1), &ldx, work );
+    }
+}
+
+#undef A
@@ -0,0 +1,122 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/core_dgbtype3cb.cpp, normal d -> s, Wed Nov 15 00:34:20 2017
+
+*/
+#include "magma_internal.h"
+
+
+// band storage with 2*nb diagonals above and nb below the main diagonal
+#define A(m,n)   (A + lda * (n) + ((m)-(n)) + 2*nb)
+
+/***************************************************************************//**
+ *
+ * @ingroup magma_gbtype3cb
+ *
+ *  magma_sgbtype3cb is a kernel that will operate on a region (triangle) of data
+ *  bounded by st and ed, for the reduction of an upper band matrix to upper
+ *  bidiagonal form. This kernel applies the right reflector created by the
+ *  previous magma_sgbtype2cb to the diagonal block A(st:ed,st:ed), then
+ *  eliminates the column st created below the diagonal by a left reflector,
+ *  applied to A(st:ed,st+1:ed).
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrix A.
+ *
+ * @param[in] nb
+ *          The size of the band.
+ *
+ * @param[in, out] A
+ *          A pointer to the matrix A of size (3*nb+1)-by-n, stored as in
+ *          magma_sgbtype1cb.
+ *
+ * @param[in] lda
+ *          The leading dimension of the matrix A. lda >= max(1,3*nb+1)
+ *
+ * @param[out] VQ
+ *          REAL array, dimension (ldv*blkcnt*Vblksiz).
+ *          The left Householder reflectors are stored in this array.
+ *
+ * @param[out] TAUQ
+ *          REAL array, dimension (blkcnt*Vblksiz).
+ *          The scalar factors of the left Householder reflectors.
+ *
+ * @param[in] VP
+ *          REAL array, dimension (ldv*blkcnt*Vblksiz).
+ *          The right Householder reflectors, as stored by the previous kernel.
+ *
+ * @param[in] TAUP
+ *          REAL array, dimension (blkcnt*Vblksiz).
+ *          The scalar factors of the right Householder reflectors.
+ *
+ * @param[in] ldv
+ *          The leading dimension of VQ and VP. ldv >= nb + Vblksiz.
+ *
+ * @param[in] st
+ *          A pointer to the start index where this kernel will operate.
+ *
+ * @param[in] ed
+ *          A pointer to the end index where this kernel will operate.
+ *
+ * @param[in] sweep
+ *          The sweep number that is eliminated. it serve to calculate the
+ *          pointer to the position where to store the Vs and Ts.
+ *
+ * @param[in] Vblksiz
+ *          constant which correspond to the blocking used when applying the Vs.
+ *          it serve to calculate the pointer to the position where to store the
+ *          Vs and Ts.
+ *
+ * @param[in] work
+ *          Workspace of size nb.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// TYPE 3-BAND Upper-rowwise-Householder
+
+extern "C" void
+magma_sgbtype3cb(magma_int_t n, magma_int_t nb,
+                float *A, magma_int_t lda,
+                float *VQ, float *TAUQ,
+                float *VP, float *TAUP,
+                magma_int_t ldv,
+                magma_int_t st, magma_int_t ed, magma_int_t sweep,
+                magma_int_t Vblksiz,
+                float *work)
+{
+    magma_int_t len, len1, ldx;
+    magma_int_t vpos, taupos;
+
+    magma_int_t ione = 1;
+    float c_one    =  MAGMA_S_ONE;
+
+    magma_bulge_findVTAUpos(n, nb, Vblksiz, sweep, st, ldv, &vpos, &taupos);
+
+    ldx = lda-1;
+    len = ed-st+1;
+
+    /* Apply right on A(st:ed,st:ed) */
+    lapackf77_slarfx( "R", &len, &len, VP+vpos, TAUP+taupos, A(st, st), &ldx, work );
+
+    if ( len > 1 ) {
+        /* Eliminate the created col at st */
+        len1 = len-1;
+        *(VQ+vpos) = c_one;
+        memcpy( VQ+vpos+1, A(st+1, st), len1*sizeof(float) );
+        memset( A(st+1, st), 0, len1*sizeof(float) );
+        lapackf77_slarfg( &len, A(st, st), VQ+vpos+1, &ione, TAUQ+taupos );
+
+        /* Apply left on A(st:ed,st+1:ed) */
+        lapackf77_slarfx( "L", &len, &len1, VQ+vpos, TAUQ+taupos, A(st, st+1), &ldx, work );
+    }
+}
+
+#undef A
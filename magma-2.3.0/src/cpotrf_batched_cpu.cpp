@@ -0,0 +1,236 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zpotrf_batched_cpu.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+
+*/
+#include "batched_compact.hpp"  // includes magma_internal.h after <algorithm>
+
+/******************************************************************************/
+// Common code for magma_cpotrf_batched_cpu and magma_cpotrf_vbatched_cpu;
+// n_array and lda_array are NULL for a fixed size batch.
+static void
+magma_cpotrf_batched_cpu_core(
+    magma_uplo_t uplo,
+    magma_int_t n, const magma_int_t *n_array,
+    magmaFloatComplex **A_array,
+    magma_int_t lda, const magma_int_t *lda_array,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    typedef magmaFloatComplex T;
+    const int L = magma_compact_traits< T >::lanes;
+    const char* uplo_ = lapack_uplo_const( uplo );
+    // the kernel factors the lower triangle; the upper one is packed as U^H
+    magma_trans_t op = (uplo == MagmaLower ? MagmaNoTrans : MagmaConjTrans);
+
+    magma_compact_groups groups;
+    magma_compact_make_groups( batchCount, L, n, n, n_array, n_array, groups );
+
+    magma_compact_parallel_groups< T >( groups,
+        [&]( const magma_int_t* idx, magma_int_t count, std::vector< T >& work )
+        {
+            magma_int_t nk = (n_array ? n_array[ idx[0] ] : n);
+            T* ptr[ L ];
+            magma_int_t ld[ L ], linfo[ L ];
+            for (magma_int_t l = 0; l < L; ++l) {
+                linfo[l] = 0;
+            }
+            for (magma_int_t l = 0; l < count; ++l) {
+                ptr[l] = A_array[ idx[l] ];
+                ld[l]  = (lda_array ? lda_array[ idx[l] ] : lda);
+                info_array[ idx[l] ] = 0;
+            }
+            if (nk <= 0)
+                return;
+
+            if (nk > magma_compact_max_size) {
+                for (magma_int_t l = 0; l < count; ++l) {
+                    lapackf77_cpotrf( uplo_, &nk, ptr[l], &ld[l], &info_array[ idx[l] ] );
+                }
+                return;
+            }
+
+            work.resize( nk*nk*L );
+            magma_compact_pack( op, nk, nk, ptr, ld, count, &work[0], true );
+            magma_compact_dispatch< magma_compact_nt_max, magma_potrf_compact_kernel< T > >
+                ::run( nk, &work[0], linfo );
+            magma_compact_unpack( op, MagmaLower, nk, nk, &work[0], ptr, ld, count );
+            for (magma_int_t l = 0; l < count; ++l) {
+                info_array[ idx[l] ] = linfo[l];
+            }
+        });
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CPOTRF_BATCHED_CPU computes the Cholesky factorization of a batch of
+    complex Hermitian positive definite matrices A_i, on the CPU host:
+
+        A_i = U_i**H * U_i,  if UPLO = MagmaUpper, or
+        A_i = L_i  * L_i**H, if UPLO = MagmaLower,
+
+    where U_i is an upper triangular matrix and L_i is lower triangular.
+
+    For N <= 64, groups of matrices are interleaved in SIMD lanes (the
+    compact layout of batched_compact.hpp) and factored together, with a
+    kernel specialized at compile time for N <= 32; this avoids the per-call
+    overhead of LAPACK on small matrices. Larger matrices are factored one
+    at a time by LAPACK. Matrices are distributed over the OpenMP threads.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  Upper triangle of A_i is stored;
+      -     = MagmaLower:  Lower triangle of A_i is stored.
+
+    @param[in]
+    n       INTEGER
+            The order of each matrix A_i.  N >= 0.
+
+    @param[in,out]
+    A_array Array of pointers, dimension (batchCount).
+            Each is a COMPLEX array A_i, dimension (LDA,N).
+            On entry, the Hermitian matrix A_i; only its uplo triangle is
+            referenced. On exit, if INFO_ARRAY[i] = 0, the factor U_i or L_i
+            from the Cholesky factorization.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of each A_i.  LDA >= max(1,N).
+
+    @param[out]
+    info_array  Array of INTEGERs, dimension (batchCount), for each matrix:
+      -     = 0:  successful exit
+      -     > 0:  if INFO = i, the leading minor of order i is not
+                  positive definite, and the factorization could not be
+                  completed.
+
+    @param[in]
+    batchCount  INTEGER
+                The number of matrices to operate on.
+
+    @return
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value.
+
+    @ingroup magma_potrf_batched
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cpotrf_batched_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex **A_array, magma_int_t lda,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    magma_int_t arginfo = 0;
+    if (uplo != MagmaUpper && uplo != MagmaLower) {
+        arginfo = -1;
+    } else if (n < 0) {
+        arginfo = -2;
+    } else if (lda < max(1,n)) {
+        arginfo = -4;
+    } else if (batchCount < 0) {
+        arginfo = -6;
+    }
+    if (arginfo != 0) {
+        magma_xerbla( __func__, -(arginfo) );
+        return arginfo;
+    }
+
+    /* Quick return if possible */
+    if (batchCount == 0)
+        return arginfo;
+
+    magma_cpotrf_batched_cpu_core( uplo, n, NULL, A_array, lda, NULL,
+                                   info_array, batchCount );
+    return arginfo;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CPOTRF_VBATCHED_CPU computes the Cholesky factorization of a batch of
+    complex Hermitian positive definite matrices A_i of variable sizes,
+    on the CPU host. See magma_cpotrf_batched_cpu.
+
+    The matrices are sorted into size classes, the matrices of the same
+    order, and each class is factored as a fixed size batch.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  Upper triangle of A_i is stored;
+      -     = MagmaLower:  Lower triangle of A_i is stored.
+
+    @param[in]
+    n       Array of INTEGERs, dimension (batchCount).
+            The order of each matrix A_i.  N[i] >= 0.
+
+    @param[in,out]
+    A_array Array of pointers, dimension (batchCount).
+            Each is a COMPLEX array A_i, dimension (LDA[i],N[i]).
+            On entry, the Hermitian matrix A_i. On exit, if
+            INFO_ARRAY[i] = 0, the factor U_i or L_i.
+
+    @param[in]
+    lda     Array of INTEGERs, dimension (batchCount).
+            The leading dimension of each A_i.  LDA[i] >= max(1,N[i]).
+
+    @param[out]
+    info_array  Array of INTEGERs, dimension (batchCount), for each matrix:
+      -     = 0:  successful exit
+      -     > 0:  if INFO = i, the leading minor of order i is not
+                  positive definite, and the factorization could not be
+                  completed.
+
+    @param[in]
+    batchCount  INTEGER
+                The number of matrices to operate on.
+
+    @return
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value,
+                  for at least one matrix.
+
+    @ingroup magma_potrf_batched
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cpotrf_vbatched_cpu(
+    magma_uplo_t uplo, magma_int_t *n,
+    magmaFloatComplex **A_array, magma_int_t *lda,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    magma_int_t arginfo = 0;
+    if (uplo != MagmaUpper && uplo != MagmaLower) {
+        arginfo = -1;
+    } else if (batchCount < 0) {
+        arginfo = -6;
+    }
+    for (magma_int_t i = 0; i < batchCount && arginfo == 0; ++i) {
+        if (n[i] < 0) {
+            arginfo = -2;
+        } else if (lda[i] < max(1,n[i])) {
+            arginfo = -4;
+        }
+    }
+    if (arginfo != 0) {
+        magma_xerbla( __func__, -(arginfo) );
+        return arginfo;
+    }
+
+    /* Quick return if possible */
+    if (batchCount == 0)
+        return arginfo;
+
+    magma_cpotrf_batched_cpu_core( uplo, 0, n, A_array, 0, lda,
+                                   info_array, batchCount );
+    return arginfo;
+}
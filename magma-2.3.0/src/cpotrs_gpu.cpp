@@ -65,9 +65,6 @@ magma_cpotrs_gpu(
     magmaFloatComplex_ptr dB, magma_int_t lddb,
     magma_int_t *info)
 {
-    // Constants
-    const magmaFloatComplex c_one = MAGMA_C_ONE;
-
     *info = 0;
     if ( uplo != MagmaUpper && uplo != MagmaLower )
         *info = -1;
@@ -99,8 +96,7 @@ magma_cpotrs_gpu(
             magma_ctrsv( MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, dA, ldda, dB, 1, queue );
             magma_ctrsv( MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, dA, ldda, dB, 1, queue );
         } else {
-            magma_ctrsm( MagmaLeft, MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
-            magma_ctrsm( MagmaLeft, MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+            magmablas_cpotrs_trsm( MagmaUpper, n, nrhs, dA, ldda, dB, lddb, queue );
         }
     }
     else {
@@ -108,8 +104,7 @@ magma_cpotrs_gpu(
             magma_ctrsv( MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, dA, ldda, dB, 1, queue );
             magma_ctrsv( MagmaLower, MagmaConjTrans, MagmaNonUnit, n, dA, ldda, dB, 1, queue );
         } else {
-            magma_ctrsm( MagmaLeft, MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
-            magma_ctrsm( MagmaLeft, MagmaLower, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+            magmablas_cpotrs_trsm( MagmaLower, n, nrhs, dA, ldda, dB, lddb, queue );
         }
     }
 
@@ -0,0 +1,175 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zpptrf_cpu.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+*/
+#include "symmetric_host.hpp"  // includes magma_internal.h, after the STL headers
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    CPPTRF_CPU computes the Cholesky factorization of a Hermitian positive
+    definite matrix A stored in packed format, in CPU memory, as LAPACK's
+    cpptrf does, but blocked, using Level 3 BLAS.
+
+    The factorization has the form
+        A = U**H * U,   if UPLO = MagmaUpper, or
+        A = L  * L**H,  if UPLO = MagmaLower,
+    where U is an upper triangular matrix and L is lower triangular.
+
+    Packed format halves the memory of full format. This is a left-looking
+    algorithm: each block column of L (block row of U) is unpacked into a
+    workspace of N*NB elements, updated by GEMM and HERK with the previous
+    block columns, unpacked in turn into a second such workspace, then
+    factored by cpotrf and ctrsm and packed back. Blocks are packed and
+    unpacked in parallel; see control/symmetric_host.hpp.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  Upper triangle of A is stored;
+      -     = MagmaLower:  Lower triangle of A is stored.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in,out]
+    AP      COMPLEX array, dimension (N*(N+1)/2)
+            On entry, the upper or lower triangle of the Hermitian matrix
+            A, packed columnwise in a linear array, as in LAPACK; see
+            magma_ctrttp_cpu.
+            On exit, if INFO = 0, the triangular factor U or L from the
+            Cholesky factorization A = U**H*U or A = L*L**H, in the same
+            storage format as A.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+      -     > 0:  if INFO = i, the leading minor of order i is not
+                  positive definite, and the factorization could not be
+                  completed.
+
+    @ingroup magma_potrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_cpptrf_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaFloatComplex *AP,
+    magma_int_t *info )
+{
+    #define W(i_, j_)  (W + (i_) + (j_)*ldw)
+    #define V(i_, j_)  (V + (i_) + (j_)*ldv)
+
+    const magmaFloatComplex c_one     = MAGMA_C_ONE;
+    const magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
+    const float d_one     =  1.0;
+    const float d_neg_one = -1.0;
+    const char* uplo_ = lapack_uplo_const( uplo );
+    bool lower = (uplo == MagmaLower);
+
+    *info = 0;
+    if ( uplo != MagmaLower && uplo != MagmaUpper )
+        *info = -1;
+    else if ( n < 0 )
+        *info = -2;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    if ( n == 0 )
+        return *info;
+
+    magma_int_t nb = magma_get_cpotrf_nb( n );
+    if ( nb <= 1 || nb >= n ) {
+        lapackf77_cpptrf( uplo_, &n, AP, info );
+        return *info;
+    }
+
+    // W holds the current block column (lower) or row (upper);
+    // V a previous one, whose update of W is applied.
+    magmaFloatComplex *W, *V;
+    if (MAGMA_SUCCESS != magma_cmalloc_cpu( &W, 2*n*nb )) {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+    V = W + n*nb;
+
+    for (magma_int_t j = 0; j < n && *info == 0; j += nb) {
+        magma_int_t jb = min( nb, n - j );
+        magma_int_t mj = n - j;        // length of block column or row
+        magma_int_t rj = mj - jb;      // part below (right of) the diagonal block
+        magma_int_t ldw, ldv;
+        if (lower) {
+            // W = A(j:n, j:j+jb), mj-by-jb
+            ldw = mj;
+            magma_packed_host_copy( true, uplo, n, AP, j, j, mj, jb, W, ldw );
+            for (magma_int_t k = 0; k < j; k += nb) {
+                magma_int_t kb = min( nb, j - k );
+                // V = L(j:n, k:k+kb)
+                ldv = mj;
+                magma_packed_host_copy( true, uplo, n, AP, j, k, mj, kb, V, ldv );
+                blasf77_cherk( uplo_, "NoTrans", &jb, &kb,
+                               &d_neg_one, V,        &ldv,
+                               &d_one,     W,        &ldw );
+                if (rj > 0) {
+                    blasf77_cgemm( "NoTrans", "ConjTrans", &rj, &jb, &kb,
+                                   &c_neg_one, V(jb,0), &ldv,
+                                               V,       &ldv,
+                                   &c_one,     W(jb,0), &ldw );
+                }
+            }
+            lapackf77_cpotrf( uplo_, &jb, W, &ldw, info );
+            if (*info == 0 && rj > 0) {
+                blasf77_ctrsm( MagmaRightStr, MagmaLowerStr, MagmaConjTransStr, MagmaNonUnitStr,
+                               &rj, &jb, &c_one, W, &ldw, W(jb,0), &ldw );
+            }
+            magma_packed_host_copy( false, uplo, n, AP, j, j, mj, jb, W, ldw );
+        }
+        else {
+            // W = A(j:j+jb, j:n), jb-by-mj
+            ldw = jb;
+            magma_packed_host_copy( true, uplo, n, AP, j, j, jb, mj, W, ldw );
+            for (magma_int_t k = 0; k < j; k += nb) {
+                magma_int_t kb = min( nb, j - k );
+                // V = U(k:k+kb, j:n)
+                ldv = kb;
+                magma_packed_host_copy( true, uplo, n, AP, k, j, kb, mj, V, ldv );
+                blasf77_cherk( uplo_, "ConjTrans", &jb, &kb,
+                               &d_neg_one, V,        &ldv,
+                               &d_one,     W,        &ldw );
+                if (rj > 0) {
+                    blasf77_cgemm( "ConjTrans", "NoTrans", &jb, &rj, &kb,
+                                   &c_neg_one, V,        &ldv,
+                                               V(0,jb),  &ldv,
+                                   &c_one,     W(0,jb),  &ldw );
+                }
+            }
+            lapackf77_cpotrf( uplo_, &jb, W, &ldw, info );
+            if (*info == 0 && rj > 0) {
+                blasf77_ctrsm( MagmaLeftStr, MagmaUpperStr, MagmaConjTransStr, MagmaNonUnitStr,
+                               &jb, &rj, &c_one, W, &ldw, W(0,jb), &ldw );
+            }
+            magma_packed_host_copy( false, uplo, n, AP, j, j, jb, mj, W, ldw );
+        }
+        if (*info > 0) {
+            *info += j;
+        }
+    }
+
+    magma_free_cpu( W );
+    return *info;
+
+    #undef W
+    #undef V
+}
@@ -0,0 +1,299 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal d -> s
+
+*/
+#include "magma_internal.h"
+#include "magma_bulge.h"
+#include "magma_dbulge.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// progress table of the static scheduler, as in magma_dsytrd_sb2st;
+// the flush makes the kernel's updates of A visible before the signal.
+#define myss_cond_set(m, val) \
+do { \
+    _Pragma("omp flush") \
+    prog[(m)] = (val); \
+} while(0)
+
+#define myss_cond_wait(m, val) \
+do { \
+    while (prog[(m)] != (val)) \
+    { \
+        magma_yield(); \
+    } \
+    _Pragma("omp flush") \
+} while(0)
+
+
+/******************************************************************************/
+// Static bulge chasing schedule of magma_dtile_bulge_parallel in
+// magma_dsytrd_sb2st, with grsiz = 1: task myid of sweep sweepid is
+// type1 (myid == 1), type2 (even), or type3 (odd), and waits on the task
+// before it in the same sweep and on the task shift ahead in the previous one.
+static void magma_dtile_bulge_gb2bd_parallel(
+    magma_int_t my_core_id, magma_int_t cores_num,
+    double *A, magma_int_t lda,
+    double *VQ, double *TAUQ,
+    double *VP, double *TAUP, magma_int_t ldv,
+    magma_int_t n, magma_int_t nb, magma_int_t nbtiles,
+    magma_int_t Vblksiz, volatile magma_int_t *prog)
+{
+    magma_int_t sweepid, myid, shift, stt, st, ed, stind, edind;
+    magma_int_t blklastind, colpt;
+    magma_int_t i, j;
+    magma_int_t coreid;
+    magma_int_t colpercore, allcoresnb;
+    double *work;
+
+    if (n <= 0)
+        return;
+
+    shift      = 3;
+    colpercore = nb;
+    allcoresnb = min( cores_num, max( nbtiles, 1 ) );
+    if (my_core_id >= allcoresnb)
+        return;
+
+    magma_dmalloc_cpu(&work, nb);
+
+    stt = 1;
+    for (i = 1; i <= n-1; i++) {
+        ed = i;
+        if (stt > ed) break;
+        for (magma_int_t m = 1; m <= shift; m++) {
+            st = stt;
+            for (sweepid = st; sweepid <= ed; sweepid++) {
+                myid = (i-sweepid)*shift + m;
+                if (myid%2 == 0) {
+                    colpt      = (myid/2)*nb+1+sweepid-1;
+                    stind      = colpt-nb+1;
+                    edind      = min(colpt,n);
+                    blklastind = colpt;
+                } else {
+                    colpt      = ((myid+1)/2)*nb + 1 +sweepid -1;
+                    stind      = colpt-nb+1;
+                    edind      = min(colpt,n);
+                    if ( (stind >= edind-1) && (edind == n) )
+                        blklastind=n;
+                    else
+                        blklastind=0;
+                }
+                coreid = (stind/colpercore)%allcoresnb;
+
+                if (my_core_id == coreid) {
+                    if (myid == 1) {
+                        myss_cond_wait(myid+shift-1, sweepid-1);
+                        magma_dgbtype1cb(n, nb, A, lda, VQ, TAUQ, VP, TAUP, ldv, stind-1, edind-1, sweepid-1, Vblksiz, work);
+                        myss_cond_set(myid, sweepid);
+
+                        if (blklastind >= (n-1)) {
+                            for (j = 1; j <= shift; j++)
+                                myss_cond_set(myid+j, sweepid);
+                        }
+                    } else {
+                        myss_cond_wait(myid-1,       sweepid);
+                        myss_cond_wait(myid+shift-1, sweepid-1);
+                        if (myid%2 == 0) {
+                            magma_dgbtype2cb(n, nb, A, lda, VQ, TAUQ, VP, TAUP, ldv, stind-1, edind-1, sweepid-1, Vblksiz, work);
+                        } else {
+                            magma_dgbtype3cb(n, nb, A, lda, VQ, TAUQ, VP, TAUP, ldv, stind-1, edind-1, sweepid-1, Vblksiz, work);
+                        }
+                        myss_cond_set(myid, sweepid);
+                        if (blklastind >= (n-1)) {
+                            for (j = 1; j <= shift+allcoresnb; j++)
+                                myss_cond_set(myid+j, sweepid);
+                        }
+                    }
+                }
+
+                if (blklastind >= (n-1)) {
+                    stt++;
+                }
+            } /* END for sweepid=st:ed */
+        } /* END for m=1:shift */
+    } /* END for i=1:n-1 */
+
+    magma_free_cpu(work);
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGEBRD_GB2BD_CPU reduces a real upper band matrix B with NB
+    superdiagonals to upper bidiagonal form by orthogonal transformations,
+    on the CPU host:
+        Q2**T * B * P2 = bidiag( D, E ).
+    This is the second stage of the two-stage reduction to bidiagonal form,
+    after magma_dgebrd_ge2gb_cpu.
+
+    The band is copied to a work array with 2*NB superdiagonals and NB
+    subdiagonals to hold the bulges, which are chased by the
+    magma_dgbtype[123]cb kernels with the static pipelined schedule of the
+    symmetric bulge chasing, magma_dsytrd_sb2st, over the OpenMP threads.
+    The Householder reflectors of Q2 and P2 are stored in VQ and VP in the
+    layout of the symmetric bulge chasing, given by magma_bulge_findVTAUpos,
+    so they are applied by the same blocked back transformation.
+
+    Arguments
+    ---------
+    @param[in]
+    n       INTEGER
+            The order of the matrix B.  N >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The bandwidth of B.  1 <= NB, and NB < N if N > 1.
+
+    @param[in]
+    Vblksiz INTEGER
+            The number of sweeps that are grouped in a block of reflectors
+            for the back transformation.  1 <= Vblksiz <= NB.
+
+    @param[in]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            The upper band matrix B, in the diagonal and the first NB
+            superdiagonals of the leading N-by-N part of A.
+            The rest of A is not referenced. A is not modified.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    d       DOUBLE PRECISION array, dimension (N)
+            The diagonal elements of the bidiagonal matrix.
+
+    @param[out]
+    e       DOUBLE PRECISION array, dimension (max(1,N-1))
+            The superdiagonal elements of the bidiagonal matrix.
+
+    @param[out]
+    VQ      DOUBLE PRECISION array, dimension (LDV*blkcnt*Vblksiz)
+            The Householder vectors of Q2, where blkcnt is given by
+            magma_bulge_get_blkcnt.
+
+    @param[out]
+    TAUQ    DOUBLE PRECISION array, dimension (blkcnt*Vblksiz)
+            The scalar factors of the Householder reflectors of Q2.
+
+    @param[out]
+    VP      DOUBLE PRECISION array, dimension (LDV*blkcnt*Vblksiz)
+            The Householder vectors of P2.
+
+    @param[out]
+    TAUP    DOUBLE PRECISION array, dimension (blkcnt*Vblksiz)
+            The scalar factors of the Householder reflectors of P2.
+
+    @param[in]
+    ldv     INTEGER
+            The leading dimension of VQ and VP.  LDV >= NB + Vblksiz.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+
+    @ingroup magma_gebrd
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dgebrd_gb2bd_cpu(
+    magma_int_t n, magma_int_t nb, magma_int_t Vblksiz,
+    const double *A, magma_int_t lda,
+    double *d, double *e,
+    double *VQ, double *TAUQ,
+    double *VP, double *TAUP, magma_int_t ldv,
+    magma_int_t *info)
+{
+    #define A(i_, j_)  (A  + (i_) + (j_)*lda)
+    #define AB(i_, j_) (AB + (i_) - (j_) + 2*nb + (j_)*ldab)
+
+    double *AB = NULL;
+    volatile magma_int_t *prog = NULL;
+    magma_int_t ldab, nbtiles, blkcnt, threads;
+
+    *info = 0;
+    if (n < 0) {
+        *info = -1;
+    } else if (nb < 1 || (n > 1 && nb >= n)) {
+        *info = -2;
+    } else if (Vblksiz < 1 || Vblksiz > nb) {
+        *info = -3;
+    } else if (lda < max(1,n)) {
+        *info = -5;
+    } else if (ldv < nb + Vblksiz) {
+        *info = -12;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return if possible */
+    if (n == 0)
+        return *info;
+
+    ldab    = 3*nb+1;
+    nbtiles = magma_ceildiv( n, nb );
+    blkcnt  = magma_bulge_get_blkcnt( n, nb, Vblksiz );
+    threads = magma_get_parallel_numthreads();
+    if (MAGMA_SUCCESS != magma_dmalloc_cpu( &AB, ldab*n ) ||
+        MAGMA_SUCCESS != magma_malloc_cpu( (void**) &prog, (2*nbtiles+threads+10)*sizeof(magma_int_t) ))
+    {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        goto cleanup;
+    }
+
+    memset( AB, 0, ldab*n*sizeof(double) );
+    for (magma_int_t j = 0; j < n; ++j) {
+        magma_int_t i0 = max( 0, j-nb );
+        memcpy( AB(i0,j), A(i0,j), (j-i0+1)*sizeof(double) );
+    }
+    memset( (void *) prog, 0, (2*nbtiles+threads+10)*sizeof(magma_int_t) );
+    memset( VQ,   0, ldv*blkcnt*Vblksiz*sizeof(double) );
+    memset( VP,   0, ldv*blkcnt*Vblksiz*sizeof(double) );
+    memset( TAUQ, 0, blkcnt*Vblksiz*sizeof(double) );
+    memset( TAUP, 0, blkcnt*Vblksiz*sizeof(double) );
+
+    magma_int_t mklth;
+    mklth = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads(1);
+
+    #pragma omp parallel num_threads(threads)
+    {
+        #ifdef _OPENMP
+        magma_int_t tid = omp_get_thread_num();
+        magma_int_t nth = omp_get_num_threads();
+        #else
+        magma_int_t tid = 0;
+        magma_int_t nth = 1;
+        #endif
+        magma_dtile_bulge_gb2bd_parallel( tid, nth, AB, ldab, VQ, TAUQ, VP, TAUP, ldv,
+                                          n, nb, nbtiles, Vblksiz, prog );
+    }
+
+    magma_set_lapack_numthreads( mklth );
+
+    /* store the resulting diagonal and superdiagonal in d and e */
+    for (magma_int_t i = 0; i < n-1; ++i) {
+        d[i] = *AB(i,i);
+        e[i] = *AB(i,i+1);
+    }
+    d[n-1] = *AB(n-1,n-1);
+
+cleanup:
+    magma_free_cpu( AB );
+    magma_free_cpu( (void *) prog );
+
+    return *info;
+} /* magma_dgebrd_gb2bd_cpu */
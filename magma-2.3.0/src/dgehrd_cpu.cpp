@@ -0,0 +1,461 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgehrd_cpu.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "task_scheduler.hpp"
+
+#define REAL
+
+/******************************************************************************/
+// Host version of magma_dlahr2. Reduces the first nb columns of A, from
+// row k, returning V and T of the block reflector I - V T V', and the rows
+// k:n-1 of Y = A V. Unlike magma_dlahr2, A is both the panel and the
+// trailing matrix, so Y and V are kept apart from A.
+// The matrix-vector products with the trailing matrix, which dominate,
+// are split by rows over npanel OpenMP threads.
+// A is the n-by-(n-k) panel and trailing matrix, i.e., A(0,k) of the
+// matrix being reduced; V is (n-k)-by-nb, with rows 0:nb-1 zeroed on entry.
+static void
+dlahr2_cpu(
+    magma_int_t n, magma_int_t k, magma_int_t nb,
+    double *A, magma_int_t lda,
+    double *V, magma_int_t ldv,
+    double *tau,
+    double *T, magma_int_t ldt,
+    double *Y, magma_int_t ldy,
+    magma_int_t npanel )
+{
+    #define A(i_,j_) (A + (i_) + (j_)*lda)
+    #define V(i_,j_) (V + (i_) + (j_)*ldv)
+    #define Y(i_,j_) (Y + (i_) + (j_)*ldy)
+    #define T(i_,j_) (T + (i_) + (j_)*ldt)
+
+    const double c_zero    = MAGMA_D_ZERO;
+    const double c_one     = MAGMA_D_ONE;
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const magma_int_t ione = 1;
+
+    magma_int_t n_k_i_1, n_k = n - k;
+    double scale;
+    double ei = MAGMA_D_ZERO;
+
+    // rows of the matrix-vector product per thread
+    magma_int_t mb = magma_roundup( magma_ceildiv( n_k, npanel ), 16 );
+
+    for (magma_int_t i = 0; i < nb; ++i) {
+        n_k_i_1 = n - k - i - 1;
+
+        if (i > 0) {
+            // Update A(k:n-1,i); Update i-th column of A - Y * T * V'
+            // as in magma_dlahr2, using last column of T as workspace, w.
+            // w(0:i-1, nb-1) = VA(k+i, 0:i-1)'
+            blasf77_dcopy( &i,
+                           A(k+i,0),  &lda,
+                           T(0,nb-1), &ione );
+            #ifdef COMPLEX
+            lapackf77_dlacgv( &i, T(0,nb-1), &ione );
+            #endif
+
+            // w = T(0:i-1, 0:i-1) * w
+            blasf77_dtrmv( "Upper", "No trans", "No trans", &i,
+                           T(0,0),    &ldt,
+                           T(0,nb-1), &ione );
+
+            // A(k:n-1, i) -= Y(k:n-1, 0:i-1) * w
+            blasf77_dgemv( "No trans", &n_k, &i,
+                           &c_neg_one, Y(k,0),    &ldy,
+                                       T(0,nb-1), &ione,
+                           &c_one,     A(k,i),    &ione );
+
+            // Apply I - V * T' * V' to this column b from the left
+            // w := b1 = A(k+1:k+i, i)
+            blasf77_dcopy( &i,
+                           A(k+1,i),  &ione,
+                           T(0,nb-1), &ione );
+
+            // w := V1' * b1 = VA(k+1:k+i, 0:i-1)' * w
+            blasf77_dtrmv( "Lower", "Conj", "Unit", &i,
+                           A(k+1,0),  &lda,
+                           T(0,nb-1), &ione );
+
+            // w := w + V2'*b2 = w + VA(k+i+1:n-1, 0:i-1)' * A(k+i+1:n-1, i)
+            blasf77_dgemv( "Conj", &n_k_i_1, &i,
+                           &c_one, A(k+i+1,0), &lda,
+                                   A(k+i+1,i), &ione,
+                           &c_one, T(0,nb-1),  &ione );
+
+            // w := T'*w = T(0:i-1, 0:i-1)' * w
+            blasf77_dtrmv( "Upper", "Conj", "Non-unit", &i,
+                           T(0,0),    &ldt,
+                           T(0,nb-1), &ione );
+
+            // b2 := b2 - V2*w = A(k+i+1:n-1, i) - VA(k+i+1:n-1, 0:i-1) * w
+            blasf77_dgemv( "No trans", &n_k_i_1, &i,
+                           &c_neg_one, A(k+i+1,0), &lda,
+                                       T(0,nb-1),  &ione,
+                           &c_one,     A(k+i+1,i), &ione );
+
+            // w := V1*w = VA(k+1:k+i, 0:i-1) * w
+            blasf77_dtrmv( "Lower", "No trans", "Unit", &i,
+                           A(k+1,0),  &lda,
+                           T(0,nb-1), &ione );
+
+            // b1 := b1 - w = A(k+1:k+i, i) - w
+            blasf77_daxpy( &i,
+                           &c_neg_one, T(0,nb-1), &ione,
+                                       A(k+1,i),  &ione );
+
+            // Restore diagonal element, saved during previous iteration
+            *A(k+i,i-1) = ei;
+        }
+
+        // Generate the elementary reflector H(i) to annihilate A(k+i+1:n-1,i)
+        lapackf77_dlarfg( &n_k_i_1,
+                          A(k+i+1,i),
+                          A(k+i+2,i), &ione, &tau[i] );
+        // Save diagonal element and set to one, to simplify multiplying by V
+        ei = *A(k+i+1,i);
+        *A(k+i+1,i) = c_one;
+
+        // V(i+1:n-k-1, i) = VA(k+i+1:n-1, i)
+        blasf77_dcopy( &n_k_i_1,
+                       A(k+i+1,i), &ione,
+                       V(i+1,i),   &ione );
+
+        // Compute Y(k:n-1, i) = A(k:n-1, i+1:n-k-1) * V(i+1:n-k-1, i),
+        // one block of rows per thread
+        #pragma omp parallel for num_threads( npanel ) schedule( static )
+        for (magma_int_t r = 0; r < n_k; r += mb) {
+            magma_int_t ib = min( mb, n_k - r );
+            blasf77_dgemv( "No trans", &ib, &n_k_i_1,
+                           &c_one,  A(k+r,i+1), &lda,
+                                    V(i+1,i),   &ione,
+                           &c_zero, Y(k+r,i),   &ione );
+        }
+
+        // Compute T(0:i,i) = [ -tau T V' vi ]
+        //                    [  tau         ]
+        // T(0:i-1, i) = -tau VA(k+i+1:n-1, 0:i-1)' VA(k+i+1:n-1, i)
+        scale = MAGMA_D_NEGATE( tau[i] );
+        blasf77_dgemv( "Conj", &n_k_i_1, &i,
+                       &scale,  A(k+i+1,0), &lda,
+                                A(k+i+1,i), &ione,
+                       &c_zero, T(0,i),     &ione );
+        // T(0:i-1, i) = T(0:i-1, 0:i-1) * T(0:i-1, i)
+        blasf77_dtrmv( "Upper", "No trans", "Non-unit", &i,
+                       T(0,0), &ldt,
+                       T(0,i), &ione );
+        *T(i,i) = tau[i];
+    }
+    // Restore diagonal element
+    *A(k+nb,nb-1) = ei;
+
+    #undef A
+    #undef V
+    #undef Y
+    #undef T
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGEHRD_CPU reduces a DOUBLE PRECISION general matrix A to upper Hessenberg form H by
+    an orthogonal similarity transformation:  Q' * A * Q = H .
+    This is the host version of DGEHRD2, computed entirely on the CPU.
+
+    Each panel is reduced as in magma_dlahr2, with the matrix-vector
+    products with the trailing matrix split over a group of threads.
+    Meanwhile, the other threads run the Level 3 BLAS updates of
+    magma_dlahru as tasks: the right update of the rows above the panel is
+    off the critical path, and lags up to two panels behind, so it overlaps
+    the next panels. W = V T' is formed once per panel and used for both
+    the right and left updates.
+
+    Arguments
+    ---------
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    ilo     INTEGER
+    @param[in]
+    ihi     INTEGER
+            It is assumed that A is already upper triangular in rows
+            and columns 1:ILO-1 and IHI+1:N. ILO and IHI are normally
+            set by a previous call to ZGEBAL; otherwise they should be
+            set to 1 and N respectively. See Further Details.
+            1 <= ILO <= IHI <= N, if N > 0; ILO=1 and IHI=0, if N=0.
+
+    @param[in,out]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            On entry, the N-by-N general matrix to be reduced.
+            On exit, the upper triangle and the first subdiagonal of A
+            are overwritten with the upper Hessenberg matrix H, and the
+            elements below the first subdiagonal, with the array TAU,
+            represent the orthogonal matrix Q as a product of elementary
+            reflectors. See Further Details.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    tau     DOUBLE PRECISION array, dimension (N-1)
+            The scalar factors of the elementary reflectors (see Further
+            Details). Elements 1:ILO-1 and IHI:N-1 of TAU are set to
+            zero.
+
+    @param[out]
+    work    (workspace) DOUBLE PRECISION array, dimension (LWORK)
+            On exit, if INFO = 0, WORK[0] returns the optimal LWORK.
+
+    @param[in]
+    lwork   INTEGER
+            The length of the array WORK.  LWORK >= max(1,N).
+            For optimum performance LWORK >= N*NB, where NB is the
+            optimal blocksize.
+            The blocked code allocates its own workspace.
+    \n
+            If LWORK = -1, then a workspace query is assumed; the routine
+            only calculates the optimal size of the WORK array, returns
+            this value as the first entry of the WORK array, and no error
+            message related to LWORK is issued by XERBLA.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+
+    Further Details
+    ---------------
+    The matrix Q is represented as a product of (ihi-ilo) elementary
+    reflectors
+
+       Q = H(ilo) H(ilo+1) . . . H(ihi-1).
+
+    Each H(i) has the form
+
+       H(i) = I - tau * v * v'
+
+    where tau is a real scalar, and v is a real vector with
+    v(1:i) = 0, v(i+1) = 1 and v(ihi+1:n) = 0; v(i+2:ihi) is stored on
+    exit in A(i+2:ihi,i), and tau in TAU(i).
+
+    See magma_dgehrd2 for an illustration of the contents of A on exit.
+
+    @ingroup magma_gehrd
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dgehrd_cpu(
+    magma_int_t n, magma_int_t ilo, magma_int_t ihi,
+    double *A, magma_int_t lda,
+    double *tau,
+    double *work, magma_int_t lwork,
+    magma_int_t *info)
+{
+    #define A(i_,j_) (A + (i_) + (j_)*lda)
+
+    // Constants
+    const double c_one     = MAGMA_D_ONE;
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const double c_zero    = MAGMA_D_ZERO;
+    const magma_int_t lookahead = 2;  // panels the top updates may lag
+
+    // Local variables
+    magma_int_t nb = magma_get_dgehrd_nb( n );
+
+    magma_int_t i, nh, iws;
+    magma_int_t iinfo;
+    magma_int_t lquery;
+
+    *info = 0;
+    iws = n*nb;
+    work[0] = magma_dmake_lwork( iws );
+
+    lquery = (lwork == -1);
+    if (n < 0) {
+        *info = -1;
+    } else if (ilo < 1 || ilo > max(1,n)) {
+        *info = -2;
+    } else if (ihi < min(ilo,n) || ihi > n) {
+        *info = -3;
+    } else if (lda < max(1,n)) {
+        *info = -5;
+    } else if (lwork < max(1,n) && ! lquery) {
+        *info = -8;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+    else if (lquery)
+        return *info;
+
+    // Adjust from 1-based indexing
+    ilo -= 1;
+
+    // Quick return if possible
+    nh = ihi - ilo;
+    if (nh <= 1) {
+        work[0] = c_one;
+        return *info;
+    }
+
+    // If not enough workspace, use unblocked code
+    if ( lwork < iws ) {
+        nb = 1;
+    }
+
+    if (nb == 1 || nb > nh) {
+        // Use unblocked code below
+        i = ilo;
+    }
+    else {
+        // Use blocked code
+        magma_int_t nbuf = lookahead + 1;
+        magma_int_t ldv  = n;
+        magma_int_t nt   = magma_ceildiv( n - ilo, nb );  // column blocks from ilo
+
+        // workspace, for each of nbuf panels in flight:
+        //   ldv*nb for V, ldv*nb for W = V T', n*nb for Y = A V, nb*nb for T;
+        // and, shared, n*nb for Ym = A V above the panel, nb*n for Z = V' A
+        double *hwork;
+        if (MAGMA_SUCCESS != magma_dmalloc_cpu( &hwork, nbuf*(3*n*nb + nb*nb) + 2*n*nb )) {
+            *info = MAGMA_ERR_HOST_ALLOC;
+            return *info;
+        }
+        double *Ym = hwork + nbuf*(3*n*nb + nb*nb);
+        double *Z  = Ym + n*nb;
+        magma_int_t ldz = nb;
+
+        // T is upper triangular; its lower triangle stays zero
+        lapackf77_dlaset( "Full", &nb, &nb, &c_zero, &c_zero, hwork + nbuf*3*n*nb, &nb );
+        for (magma_int_t b = 1; b < nbuf; ++b) {
+            lapackf77_dlacpy( "Full", &nb, &nb, hwork + nbuf*3*n*nb, &nb,
+                              hwork + nbuf*3*n*nb + b*nb*nb, &nb );
+        }
+
+        // Set elements 0:ILO-1 and IHI-1:N-2 of TAU to zero
+        for (i = 0; i < ilo; ++i)
+            tau[i] = c_zero;
+
+        for (i = max(0,ihi-1); i < n-1; ++i)
+            tau[i] = c_zero;
+
+        // Split threads into a group for the panel, which is bandwidth bound,
+        // and workers for the updates; the worker that runs the panel
+        // is the panel group's first thread.
+        magma_int_t nthread = magma_get_parallel_numthreads();
+        magma_int_t npanel  = max( 1, nthread/2 );
+        magma_int_t lapack_threads = magma_get_lapack_numthreads();
+        magma_set_lapack_numthreads( 1 );
+
+        magma_task_scheduler dag;
+        dag.launch( max( 1, nthread - npanel + 1 ));
+
+        // dependencies are tracked on the rows ilo:ihi-1 of each block column
+        // (from the diagonal down, in the active part), and on each block of
+        // tb rows above the panels
+        magma_int_t tb = 4*nb;
+        std::vector< char > colkey( nt ), topkey( magma_ceildiv( n, tb ) + 1 );
+        std::vector< magma_task_access > access;
+
+        for (i = ilo; i < ihi-1 - nb; i += nb) {
+            magma_int_t k  = (i - ilo) / nb;     // block column of panel
+            magma_int_t b  = k % nbuf;
+            magma_int_t nk = ihi - i;            // rows in V, W, and active part
+            double *V  = hwork + b*3*n*nb;
+            double *W  = V + n*nb;
+            double *Y  = W + n*nb;
+            double *T  = hwork + nbuf*3*n*nb + b*nb*nb;
+            double *tau_i = &tau[i];
+
+            // Reduce columns i:i+nb-1 to Hessenberg form, returning the
+            // matrices V and T of the block reflector H = I - V*T*V',
+            // Y = A*V, and W = V*T'.
+            // Reads the active part of all later block columns.
+            access.clear();
+            access.push_back( magma_task_write( V ));
+            access.push_back( magma_task_write( &colkey[k] ));
+            for (magma_int_t c = k+1; c < nt && ilo + c*nb < ihi; ++c) {
+                access.push_back( magma_task_read( &colkey[c] ));
+            }
+            dag.insert( access, [=] {
+                lapackf77_dlaset( "Full", &nb, &nb, &c_zero, &c_zero, V, &ldv );
+                dlahr2_cpu( ihi, i, nb, A(0,i), lda, V, ldv, tau_i, T, nb, Y, n, npanel );
+                blasf77_dgemm( "No trans", "Conj", &nk, &nb, &nb,
+                               &c_one,  V, &ldv,
+                                        T, &nb,
+                               &c_zero, W, &ldv );
+            });
+
+            // Left and right updates of the active part, rows i:ihi-1,
+            // one block column at a time. These are on the critical path.
+            for (magma_int_t c = k+1; c < nt; ++c) {
+                magma_int_t j  = ilo + c*nb;
+                magma_int_t jb = min( nb, n - j );
+                magma_int_t jr = max( 0, min( jb, ihi - j ));  // columns < ihi
+                dag.insert( { magma_task_read( V ), magma_task_write( &colkey[c] ) }, [=] {
+                    // on right, A := A Q = A - A V T V'
+                    // Ag = Ag - Y W' = A(i:ihi-1, j:j+jr-1) - Y * W(j-i:j-i+jr-1, :)'
+                    if (jr > 0) {
+                        blasf77_dgemm( "No trans", "Conj", &nk, &jr, &nb,
+                                       &c_neg_one, Y + i,     &n,
+                                                   W + (j-i), &ldv,
+                                       &c_one,     A(i,j), &lda );
+                    }
+                    // on left, A := Q' A = A - V T' V' A
+                    // Z = V' A(i:ihi-1, j:j+jb-1);  Ag2 = Ag2 - W Z
+                    blasf77_dgemm( "Conj", "No trans", &nb, &jb, &nk,
+                                   &c_one,  V,      &ldv,
+                                            A(i,j), &lda,
+                                   &c_zero, Z + j*ldz, &ldz );
+                    blasf77_dgemm( "No trans", "No trans", &nk, &jb, &nb,
+                                   &c_neg_one, W,         &ldv,
+                                               Z + j*ldz, &ldz,
+                                   &c_one,     A(i,j),    &lda );
+                });
+            }
+
+            // Right update of the rows above the panel, A(0:i-1, i:ihi-1),
+            // in blocks of tb rows. These can lag behind the next panels.
+            for (magma_int_t r = 0; r < i; r += tb) {
+                magma_int_t rb = min( tb, i - r );
+                dag.insert( { magma_task_read( V ), magma_task_write( &topkey[r/tb] ) }, [=] {
+                    // Ym = Am V = A(r:r+rb-1, i:ihi-1) * V
+                    blasf77_dgemm( "No trans", "No trans", &rb, &nb, &nk,
+                                   &c_one,  A(r,i), &lda,
+                                            V,      &ldv,
+                                   &c_zero, Ym + r, &n );
+                    // Am = Am - Ym W'
+                    blasf77_dgemm( "No trans", "Conj", &rb, &nk, &nb,
+                                   &c_neg_one, Ym + r, &n,
+                                               W,      &ldv,
+                                   &c_one,     A(r,i), &lda );
+                });
+            }
+        }
+
+        dag.sync();
+        dag.quit();
+        magma_set_lapack_numthreads( lapack_threads );
+
+        magma_free_cpu( hwork );
+    }
+
+    // Use unblocked code to reduce the rest of the matrix
+    // add 1 to i for 1-based index
+    i += 1;
+    lapackf77_dgehd2(&n, &i, &ihi, A, &lda, tau, work, &iinfo);
+    work[0] = magma_dmake_lwork( iws );
+
+    return *info;
+} /* magma_dgehrd_cpu */
@@ -216,12 +216,9 @@ magma_dgeqrf(
             }
             
             magma_int_t rows = m-i;
-            lapackf77_dgeqrf( &rows, &ib, A(i,i), &lda, tau+i, work, &lwork, info );
-            
-            /* Form the triangular factor of the block reflector
-               H = H(i) H(i+1) . . . H(i+ib-1) */
-            lapackf77_dlarft( MagmaForwardStr, MagmaColumnwiseStr,
-                              &rows, &ib, A(i,i), &lda, tau+i, work, &ib );
+            /* Factor the panel and form the triangular factor of the
+               block reflector H = H(i) H(i+1) . . . H(i+ib-1) in work */
+            magma_dgeqrt3_cpu( rows, ib, A(i,i), lda, tau+i, work, ib, info );
             
             magma_dpanel_to_q( MagmaUpper, ib, A(i,i), lda, work+ib*ib );
             
@@ -0,0 +1,238 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgerfs_nopiv_tile.cpp, normal z -> d, Sat Oct 17 06:21:21 2026
+
+*/
+#include "magma_internal.h"
+
+#define BWDMAX 1.0
+#define ITERMAX 30
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGERFS_NOPIV_TILE improves the computed solution to a system of linear
+    equations, on the CPU host. This is the host version of
+    DGERFS_NOPIV_GPU, using the tile factors of DGETRF_NOPIV_TILE.
+
+    The iterative refinement process is stopped if
+        ITER > ITERMAX
+    or for all the RHS we have:
+        RNRM < SQRT(n)*XNRM*ANRM*EPS*BWDMAX
+    where
+        o ITER is the number of the current iteration in the iterative
+          refinement process
+        o RNRM is the infinity-norm of the residual
+        o XNRM is the infinity-norm of the solution
+        o ANRM is the infinity-operator-norm of the matrix A
+        o EPS is the machine epsilon returned by DLAMCH('Epsilon')
+    The value ITERMAX and BWDMAX are fixed to 30 and 1.0D+00 respectively.
+
+    Arguments
+    ---------
+    @param[in]
+    n       INTEGER
+            The number of linear equations, i.e., the order of the
+            matrix A.  N >= 0.
+
+    @param[in]
+    nrhs    INTEGER
+            The number of right hand sides, i.e., the number of columns
+            of the matrix B.  NRHS >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size of AF.  NB >= 1.
+
+    @param[in]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            The N-by-N coefficient matrix A, in LAPACK layout.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[in]
+    B       DOUBLE PRECISION array, dimension (LDB,NRHS)
+            The N-by-NRHS right hand side matrix B.
+
+    @param[in]
+    ldb     INTEGER
+            The leading dimension of the array B.  LDB >= max(1,N).
+
+    @param[in,out]
+    X       DOUBLE PRECISION array, dimension (LDX,NRHS)
+            On entry, the solution matrix X, as computed by
+            DGETRS_NOPIV_TILE.  On exit, the improved solution matrix X.
+
+    @param[in]
+    ldx     INTEGER
+            The leading dimension of the array X.  LDX >= max(1,N).
+
+    @param
+    work    (workspace) DOUBLE PRECISION array, dimension (N*NRHS)
+            This array is used to hold the residual vectors.
+
+    @param[in]
+    AF      DOUBLE PRECISION array, dimension (NT*NT*NB*NB), where NT = ceil(N/NB).
+            The factors L and U from the factorization A = L*U, in
+            tile-major layout, as computed by DGETRF_NOPIV_TILE.
+
+    @param[out]
+    iter    INTEGER
+      -     < 0: iterative refinement has failed
+        +        -3 : failure of DGETRS_NOPIV_TILE
+        +        -31: stop the iterative refinement after the 30th iteration
+      -     > 0: iterative refinement has been successfully used.
+                 Returns the number of iterations
+
+    @param[out]
+    info   INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if info = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+
+    @ingroup magma_gerfs_nopiv
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dgerfs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const double *A, magma_int_t lda,
+    const double *B, magma_int_t ldb,
+    double *X, magma_int_t ldx,
+    double *work,
+    const double *AF,
+    magma_int_t *iter,
+    magma_int_t *info)
+{
+    #define X(i,j)     (X + (i) + (j)*ldx)
+    #define R(i,j)     (R + (i) + (j)*ldr)
+
+    /* Constants */
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const double c_one     = MAGMA_D_ONE;
+    const magma_int_t ione = 1;
+
+    /* Local variables */
+    double *R;
+    double Anrm, Xnrm, Rnrm, cte, eps, *rwork;
+    magma_int_t i, j, iiter, ldr;
+
+    /* Check arguments */
+    *iter = 0;
+    *info = 0;
+    if ( n < 0 )
+        *info = -1;
+    else if ( nrhs < 0 )
+        *info = -2;
+    else if ( nb < 1 )
+        *info = -3;
+    else if ( lda < max(1,n))
+        *info = -5;
+    else if ( ldb < max(1,n))
+        *info = -7;
+    else if ( ldx < max(1,n))
+        *info = -9;
+
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    if ( n == 0 || nrhs == 0 )
+        return *info;
+
+    if (MAGMA_SUCCESS != magma_dmalloc_cpu( &rwork, n )) {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+
+    ldr = n;
+    R   = work;
+
+    eps  = lapackf77_dlamch("Epsilon");
+    Anrm = lapackf77_dlange( "I", &n, &n, A, &lda, rwork );
+    cte  = Anrm * eps * magma_dsqrt( (double) n ) * BWDMAX;
+
+    // residual R = B - A*X
+    lapackf77_dlacpy( MagmaFullStr, &n, &nrhs, B, &ldb, R, &ldr );
+    blasf77_dgemm( MagmaNoTransStr, MagmaNoTransStr, &n, &nrhs, &n,
+                   &c_neg_one, A, &lda,
+                               X, &ldx,
+                   &c_one,     R, &ldr );
+
+    for( j=0; j < nrhs; j++ ) {
+        i = blasf77_idamax( &n, X(0,j), &ione ) - 1;
+        Xnrm = MAGMA_D_ABS( *X(i,j) );
+
+        i = blasf77_idamax( &n, R(0,j), &ione ) - 1;
+        Rnrm = MAGMA_D_ABS( *R(i,j) );
+        if ( Rnrm >  Xnrm*cte ) {
+            goto refinement;
+        }
+    }
+
+    *iter = 0;
+    goto cleanup;
+
+refinement:
+    for( iiter=1; iiter < ITERMAX; ) {
+        *info = 0;
+        // solve AF*Y = R, overwriting R
+        magma_dgetrs_nopiv_tile( n, nrhs, nb, AF, R, ldr, info );
+        if (*info != 0) {
+            *iter = -3;
+            goto cleanup;
+        }
+
+        // Add correction and setup residual
+        // X += R  --and--
+        // R = B
+        for( j=0; j < nrhs; j++ ) {
+            blasf77_daxpy( &n, &c_one, R(0,j), &ione, X(0,j), &ione );
+        }
+        lapackf77_dlacpy( MagmaFullStr, &n, &nrhs, B, &ldb, R, &ldr );
+
+        // residual R = B - A*X
+        blasf77_dgemm( MagmaNoTransStr, MagmaNoTransStr, &n, &nrhs, &n,
+                       &c_neg_one, A, &lda,
+                                   X, &ldx,
+                       &c_one,     R, &ldr );
+
+        /*  Check whether the nrhs normwise backward errors satisfy the
+         *  stopping criterion. If yes, set ITER=IITER > 0 and return. */
+        for( j=0; j < nrhs; j++ ) {
+            i = blasf77_idamax( &n, X(0,j), &ione ) - 1;
+            Xnrm = MAGMA_D_ABS( *X(i,j) );
+
+            i = blasf77_idamax( &n, R(0,j), &ione ) - 1;
+            Rnrm = MAGMA_D_ABS( *R(i,j) );
+            if ( Rnrm >  Xnrm*cte ) {
+                goto L20;
+            }
+        }
+
+        /*  If we are here, the nrhs normwise backward errors satisfy
+         *  the stopping criterion, we are good to exit. */
+        *iter = iiter;
+        goto cleanup;
+
+      L20:
+        iiter++;
+    }
+
+    /* If we are at this place of the code, this is because we have
+     * performed ITER=ITERMAX iterations and never satisified the
+     * stopping criterion. Set up the ITER flag accordingly. */
+    *iter = -ITERMAX - 1;
+
+cleanup:
+    magma_free_cpu( rwork );
+
+    return *info;
+}
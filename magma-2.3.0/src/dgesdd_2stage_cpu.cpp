@@ -0,0 +1,421 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal d -> s
+
+*/
+#include "magma_internal.h"
+#include "magma_bulge.h"
+#include "magma_dbulge.h"
+
+
+/******************************************************************************/
+// Computes the triangular factors T of the blocks of Householder reflectors
+// stored by magma_dgebrd_gb2bd_cpu, as magma_dtile_bulge_computeT_parallel
+// in magma_dsytrd_sb2st. The blocks are independent.
+static void magma_dtile_bulge_computeT_cpu(
+    double *V, magma_int_t ldv, double *TAU,
+    double *T, magma_int_t ldt,
+    magma_int_t n, magma_int_t nb, magma_int_t Vblksiz)
+{
+    if (n <= 1)
+        return;
+
+    magma_int_t nt = magma_ceildiv( n-1, Vblksiz );
+
+    #pragma omp parallel for schedule(dynamic)
+    for (magma_int_t blkj = nt-1; blkj >= 0; blkj--) {
+        magma_int_t Vm, Vn, mt, myrow, mycol, vpos, taupos, tpos, blkid;
+        /* the index of the first row on the top of block (blkj) */
+        magma_int_t firstrow = blkj * Vblksiz + 1;
+        /* find the number of tile for this block */
+        if ( blkj == nt-1 )
+            mt = magma_ceildiv( n -  firstrow,    nb );
+        else
+            mt = magma_ceildiv( n - (firstrow+1), nb );
+        for (magma_int_t blki = mt; blki > 0; blki--) {
+            /* calculate the size of each losange of Vs = (Vm,Vn) */
+            myrow = firstrow + (mt-blki)*nb;
+            mycol = blkj*Vblksiz;
+            Vm = min( nb+Vblksiz-1, n-myrow );
+            if ( ( blkj == nt-1 ) && ( blki == mt ) ) {
+                Vn = min( Vblksiz, Vm );
+            } else {
+                Vn = min( Vblksiz, Vm-1 );
+            }
+            magma_bulge_findVTAUTpos( n, nb, Vblksiz, mycol, myrow, ldv, ldt,
+                                      &vpos, &taupos, &tpos, &blkid );
+            if ( ( Vm > 0 ) && ( Vn > 0 ) ) {
+                lapackf77_dlarft( "F", "C", &Vm, &Vn, V+vpos, &ldv, TAU+taupos, T+tpos, &ldt );
+            }
+        }
+    }
+}
+
+
+/******************************************************************************/
+// Computes E = Q2 * E, where Q2 is given by the Householder reflectors stored
+// by magma_dgebrd_gb2bd_cpu and their T factors. This is the MagmaLeft case
+// of magma_dtile_bulge_applyQ in magma_dbulge_back; the columns of E are
+// split over the threads in chunks of nb_loc columns.
+static void magma_dtile_bulge_applyQ_cpu(
+    magma_int_t n, magma_int_t ne, magma_int_t nb, magma_int_t Vblksiz,
+    double *E, magma_int_t lde,
+    double *V, magma_int_t ldv,
+    double *T, magma_int_t ldt)
+{
+    #define E(i_, j_) (E + (i_) + (j_)*lde)
+
+    if (n <= 1 || ne <= 0)
+        return;
+
+    const magma_int_t nb_loc = 128;
+    magma_int_t nbGblk  = magma_ceildiv( n-1, Vblksiz );
+    magma_int_t nbchunk = magma_ceildiv( ne, nb_loc );
+
+    #pragma omp parallel
+    {
+        double *work;
+        magma_dmalloc_cpu( &work, nb_loc*Vblksiz );
+
+        #pragma omp for schedule(dynamic)
+        for (magma_int_t i = 0; i < nbchunk; i++) {
+            magma_int_t ib_loc = min( nb_loc, ne - i*nb_loc );
+            for (magma_int_t bg = nbGblk; bg > 0; bg--) {
+                magma_int_t firstcolj = (bg-1)*Vblksiz + 1;
+                magma_int_t rownbm    = magma_ceildiv( n-(firstcolj+1), nb );
+                if (bg == nbGblk) rownbm = magma_ceildiv( n-firstcolj, nb );
+                for (magma_int_t j = rownbm; j > 0; j--) {
+                    magma_int_t vlen = 0, vnb = 0, vpos, tpos;
+                    magma_int_t colj = (bg-1)*Vblksiz;
+                    magma_int_t fst  = (rownbm-j)*nb + colj + 1;
+                    for (magma_int_t k = 0; k < Vblksiz; k++) {
+                        colj = (bg-1)*Vblksiz + k;
+                        magma_int_t st = (rownbm-j)*nb + colj + 1;
+                        magma_int_t ed = min( st+nb-1, n-1 );
+                        if (st > ed)
+                            break;
+                        if ((st == ed) && (colj != n-2))
+                            break;
+                        vlen = ed-fst+1;
+                        vnb  = k+1;
+                    }
+                    magma_int_t colst = (bg-1)*Vblksiz;
+                    magma_bulge_findVTpos( n, nb, Vblksiz, colst, fst, ldv, ldt, &vpos, &tpos );
+                    if ((vlen > 0) && (vnb > 0)) {
+                        lapackf77_dlarfb( "L", "N", "F", "C", &vlen, &ib_loc, &vnb,
+                                          V+vpos, &ldv, T+tpos, &ldt,
+                                          E(fst, i*nb_loc), &lde, work, &ib_loc );
+                    }
+                }
+            }
+        }
+
+        magma_free_cpu( work );
+    }
+
+    #undef E
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGESDD_2STAGE_CPU computes the singular value decomposition (SVD) of a
+    real M-by-N matrix A, optionally computing the left and right singular
+    vectors, on the CPU host. The SVD is written
+        A = U * SIGMA * transpose(V)
+    as in magma_dgesdd.
+
+    The reduction to bidiagonal form is done in two stages: A is reduced
+    to upper band form with level 3 BLAS (magma_dgebrd_ge2gb_cpu), then the
+    band is reduced to bidiagonal form by parallel bulge chasing
+    (magma_dgebrd_gb2bd_cpu). The bidiagonal SVD is computed by
+    divide-and-conquer (dbdsdc), and the singular vectors are back
+    transformed by the reflectors of the second stage, applied in blocks of
+    Vblksiz reflectors with dlarfb as in the two-stage symmetric
+    eigensolvers, then by those of the first stage (dormqr, dormlq).
+    If M < N, the SVD of A**T is computed.
+
+    Arguments
+    ---------
+    @param[in]
+    jobz    magma_vec_t
+            Specifies options for computing all or part of the matrix U:
+      -     = MagmaAllVec:  all M columns of U and all N rows of V**T are
+                            returned in the arrays U and VT;
+      -     = MagmaSomeVec: the first min(M,N) columns of U and
+                            the first min(M,N) rows of V**T are
+                            returned in the arrays U and VT;
+      -     = MagmaNoVec:   no columns of U or rows of V**T are computed.
+            MagmaOverwriteVec is not supported.
+
+    @param[in]
+    m       INTEGER
+            The number of rows of the input matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the input matrix A.  N >= 0.
+
+    @param[in,out]
+    A       DOUBLE PRECISION array, dimension (LDA,N)
+            On entry, the M-by-N matrix A.
+            On exit, the contents of A are destroyed.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @param[out]
+    s       DOUBLE PRECISION array, dimension (min(M,N))
+            The singular values of A, sorted so that S(i) >= S(i + 1).
+
+    @param[out]
+    U       DOUBLE PRECISION array, dimension (LDU,UCOL)
+            UCOL = M if JOBZ = MagmaAllVec;
+            UCOL = min(M,N) if JOBZ = MagmaSomeVec.
+      -     If JOBZ = MagmaAllVec, U contains the M-by-M orthogonal matrix U;
+      -     if JOBZ = MagmaSomeVec, U contains the first min(M,N) columns of U
+            (the left singular vectors, stored columnwise);
+      -     if JOBZ = MagmaNoVec, U is not referenced.
+
+    @param[in]
+    ldu     INTEGER
+            The leading dimension of the array U.  LDU >= 1; if
+            JOBZ = MagmaSomeVec or MagmaAllVec, LDU >= M.
+
+    @param[out]
+    VT      DOUBLE PRECISION array, dimension (LDVT,N)
+      -     If JOBZ = MagmaAllVec, VT contains the N-by-N orthogonal matrix V**T;
+      -     if JOBZ = MagmaSomeVec, VT contains the first min(M,N) rows of
+            V**T (the right singular vectors, stored rowwise);
+      -     if JOBZ = MagmaNoVec, VT is not referenced.
+
+    @param[in]
+    ldvt    INTEGER
+            The leading dimension of the array VT.  LDVT >= 1; if
+            JOBZ = MagmaAllVec, LDVT >= N;
+            if JOBZ = MagmaSomeVec, LDVT >= min(M,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit.
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+      -     > 0:  DBDSDC did not converge, updating process failed.
+
+    @ingroup magma_gesdd
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dgesdd_2stage_cpu(
+    magma_vec_t jobz, magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda,
+    double *s,
+    double *U, magma_int_t ldu,
+    double *VT, magma_int_t ldvt,
+    magma_int_t *info)
+{
+    #define A(i_, j_)  (A  + (i_) + (j_)*lda)
+    #define U(i_, j_)  (U  + (i_) + (j_)*ldu)
+    #define VT(i_, j_) (VT + (i_) + (j_)*ldvt)
+    #define W(i_, j_)  (W  + (i_) + (j_)*ldw)
+
+    /* Constants */
+    const double c_zero = MAGMA_D_ZERO;
+    const double c_one  = MAGMA_D_ONE;
+    const magma_int_t ione     = 1;
+    const magma_int_t ineg_one = -1;
+
+    /* Local variables */
+    magma_int_t minmn = min( m, n );
+    bool wntqa  = (jobz == MagmaAllVec);
+    bool wntqs  = (jobz == MagmaSomeVec);
+    bool wntqn  = (jobz == MagmaNoVec);
+    bool wntvec = wntqa || wntqs;
+
+    double *tauq=NULL, *taup=NULL, *e=NULL, *VQ=NULL, *VP=NULL,
+           *TAUQ=NULL, *TAUP=NULL, *TQ=NULL, *TP=NULL,
+           *Ub=NULL, *W=NULL, *At=NULL, *work=NULL;
+    magma_int_t *iwork=NULL;
+    magma_int_t nb, Vblksiz, ldv, ldt, ldw, blkcnt, sizTAU2, sizT2, sizV2;
+    magma_int_t threads, lwork, ncu, iinfo;
+    double lwkopt;
+
+    /* Function Body */
+    *info = 0;
+    if (! (wntqa || wntqs || wntqn)) {
+        *info = -1;
+    } else if (m < 0) {
+        *info = -2;
+    } else if (n < 0) {
+        *info = -3;
+    } else if (lda < max(1,m)) {
+        *info = -5;
+    } else if (ldu < 1 || (wntvec && ldu < m)) {
+        *info = -8;
+    } else if (ldvt < 1 || (wntqa && ldvt < n) || (wntqs && ldvt < minmn)) {
+        *info = -10;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return if possible */
+    if (m == 0 || n == 0)
+        return *info;
+
+    /* If M < N, compute the SVD of A**T = V * SIGMA * U**T */
+    if (m < n) {
+        magma_int_t ldut  = n;
+        magma_int_t ldvtt = m;
+        magma_int_t ncut  = (wntqa ? n : m);
+        double *Ut = NULL, *VTt = NULL;
+        if (MAGMA_SUCCESS != magma_dmalloc_cpu( &At,  n*m ) ||
+            MAGMA_SUCCESS != magma_dmalloc_cpu( &Ut,  (wntvec ? ldut*ncut : 1) ) ||
+            MAGMA_SUCCESS != magma_dmalloc_cpu( &VTt, (wntvec ? ldvtt*m : 1) ))
+        {
+            *info = MAGMA_ERR_HOST_ALLOC;
+        }
+        else {
+            for (magma_int_t j = 0; j < n; ++j) {
+                blasf77_dcopy( &m, A(0,j), &ione, At + j, &n );
+            }
+            magma_dgesdd_2stage_cpu( jobz, n, m, At, n, s, Ut, ldut, VTt, ldvtt, info );
+            if (*info == 0 && wntvec) {
+                for (magma_int_t j = 0; j < m; ++j) {
+                    blasf77_dcopy( &m, VTt + j, &ldvtt, U(0,j), &ione );
+                }
+                for (magma_int_t j = 0; j < n; ++j) {
+                    blasf77_dcopy( &ncut, Ut + j, &ldut, VT(0,j), &ione );
+                }
+            }
+        }
+        magma_free_cpu( At );
+        magma_free_cpu( Ut );
+        magma_free_cpu( VTt );
+        return *info;
+    }
+
+    /* Now m >= n */
+    threads = magma_get_parallel_numthreads();
+    nb      = magma_get_dbulge_nb( n, threads );
+    nb      = max( 1, min( nb, n-1 ));
+    Vblksiz = magma_get_dbulge_vblksiz( n, nb, threads );
+    ldv     = nb + Vblksiz;
+    ldt     = Vblksiz;
+    magma_dbulge_getstg2size( n, nb, 1, Vblksiz, ldv, ldt,
+                              &blkcnt, &sizTAU2, &sizT2, &sizV2 );
+    ldw = n;
+    ncu = (wntqa ? m : n);
+
+    /* workspace for dbdsdc, and for dormqr and dormlq, from a query */
+    lwork = (wntvec ? 3*n*n + 4*n : 4*n);
+    if (wntvec) {
+        lapackf77_dormqr( "L", "N", &m, &ncu, &n, A, &lda, A, U, &ldu,
+                          &lwkopt, &ineg_one, &iinfo );
+        lwork = max( lwork, magma_int_t( lwkopt ));
+        lapackf77_dormlq( "L", "T", &n, &n, &n, A, &lda, A, W, &ldw,
+                          &lwkopt, &ineg_one, &iinfo );
+        lwork = max( lwork, magma_int_t( lwkopt ));
+    }
+
+    if (MAGMA_SUCCESS != magma_dmalloc_cpu( &tauq,  n ) ||
+        MAGMA_SUCCESS != magma_dmalloc_cpu( &taup,  n ) ||
+        MAGMA_SUCCESS != magma_dmalloc_cpu( &e,     n ) ||
+        MAGMA_SUCCESS != magma_dmalloc_cpu( &VQ,    max( 1, sizV2 )) ||
+        MAGMA_SUCCESS != magma_dmalloc_cpu( &VP,    max( 1, sizV2 )) ||
+        MAGMA_SUCCESS != magma_dmalloc_cpu( &TAUQ,  max( 1, sizTAU2 )) ||
+        MAGMA_SUCCESS != magma_dmalloc_cpu( &TAUP,  max( 1, sizTAU2 )) ||
+        MAGMA_SUCCESS != magma_dmalloc_cpu( &work,  lwork ) ||
+        MAGMA_SUCCESS != magma_imalloc_cpu( &iwork, 8*n ))
+    {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        goto cleanup;
+    }
+    if (wntvec) {
+        if (MAGMA_SUCCESS != magma_dmalloc_cpu( &TQ, max( 1, sizT2 )) ||
+            MAGMA_SUCCESS != magma_dmalloc_cpu( &TP, max( 1, sizT2 )) ||
+            MAGMA_SUCCESS != magma_dmalloc_cpu( &Ub, n*n ) ||
+            MAGMA_SUCCESS != magma_dmalloc_cpu( &W,  ldw*n ))
+        {
+            *info = MAGMA_ERR_HOST_ALLOC;
+            goto cleanup;
+        }
+    }
+
+    /* Stage 1: reduce A to upper band form, Q1**T A P1 = B */
+    magma_dgebrd_ge2gb_cpu( m, n, nb, A, lda, tauq, taup, info );
+    if (*info != 0)
+        goto cleanup;
+
+    /* Stage 2: reduce the band to bidiagonal form, Q2**T B P2 = bidiag(s, e) */
+    magma_dgebrd_gb2bd_cpu( n, nb, Vblksiz, A, lda, s, e,
+                            VQ, TAUQ, VP, TAUP, ldv, info );
+    if (*info != 0)
+        goto cleanup;
+
+    if (wntqn) {
+        /* singular values only */
+        lapackf77_dbdsdc( "U", "N", &n, s, e, NULL, &ione, NULL, &ione,
+                          NULL, NULL, work, iwork, info );
+        goto cleanup;
+    }
+
+    /* SVD of the bidiagonal, bidiag = Ub S VbT, with VbT in W */
+    lapackf77_dbdsdc( "U", "I", &n, s, e, Ub, &n, W, &ldw,
+                      NULL, NULL, work, iwork, info );
+    if (*info != 0)
+        goto cleanup;
+
+    /* T factors of the blocks of reflectors of Q2 and P2 */
+    magma_dtile_bulge_computeT_cpu( VQ, ldv, TAUQ, TQ, ldt, n, nb, Vblksiz );
+    magma_dtile_bulge_computeT_cpu( VP, ldv, TAUP, TP, ldt, n, nb, Vblksiz );
+
+    /* U = Q1 * [ Q2 Ub, 0; 0, I ] */
+    lapackf77_dlaset( "F", &m, &ncu, &c_zero, &c_one, U, &ldu );
+    lapackf77_dlacpy( "F", &n, &n, Ub, &n, U, &ldu );
+    magma_dtile_bulge_applyQ_cpu( n, n, nb, Vblksiz, U, ldu, VQ, ldv, TQ, ldt );
+    lapackf77_dormqr( "L", "N", &m, &ncu, &n, A, &lda, tauq, U, &ldu,
+                      work, &lwork, &iinfo );
+
+    /* V = P1 * P2 * Vb, with P1 = diag( I, Q_lq**T ); then VT = V**T */
+    for (magma_int_t j = 0; j < n; ++j) {
+        for (magma_int_t i = 0; i < j; ++i) {
+            double tmp = *W(i,j);
+            *W(i,j) = *W(j,i);
+            *W(j,i) = tmp;
+        }
+    }
+    magma_dtile_bulge_applyQ_cpu( n, n, nb, Vblksiz, W, ldw, VP, ldv, TP, ldt );
+    if (n > nb) {
+        magma_int_t nq = n - nb;
+        lapackf77_dormlq( "L", "T", &nq, &n, &nq, A(0,nb), &lda, taup,
+                          W(nb,0), &ldw, work, &lwork, &iinfo );
+    }
+    for (magma_int_t j = 0; j < n; ++j) {
+        blasf77_dcopy( &n, W(0,j), &ione, VT(j,0), &ldvt );
+    }
+
+cleanup:
+    magma_free_cpu( tauq  );
+    magma_free_cpu( taup  );
+    magma_free_cpu( e     );
+    magma_free_cpu( VQ    );
+    magma_free_cpu( VP    );
+    magma_free_cpu( TAUQ  );
+    magma_free_cpu( TAUP  );
+    magma_free_cpu( TQ    );
+    magma_free_cpu( TP    );
+    magma_free_cpu( Ub    );
+    magma_free_cpu( W     );
+    magma_free_cpu( work  );
+    magma_free_cpu( iwork );
+
+    return *info;
+} /* magma_dgesdd_2stage_cpu */
@@ -0,0 +1,263 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgetrf_batched_cpu.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+
+*/
+#include "batched_compact.hpp"  // includes magma_internal.h after <algorithm>
+
+/******************************************************************************/
+// Common code for magma_dgetrf_batched_cpu and magma_dgetrf_vbatched_cpu;
+// m_array, n_array, and lda_array are NULL for a fixed size batch.
+static void
+magma_dgetrf_batched_cpu_core(
+    magma_int_t m, const magma_int_t *m_array,
+    magma_int_t n, const magma_int_t *n_array,
+    double **A_array,
+    magma_int_t lda, const magma_int_t *lda_array,
+    magma_int_t **ipiv_array,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    typedef double T;
+    const int L = magma_compact_traits< T >::lanes;
+
+    magma_compact_groups groups;
+    magma_compact_make_groups( batchCount, L, m, n, m_array, n_array, groups );
+
+    magma_compact_parallel_groups< T >( groups,
+        [&]( const magma_int_t* idx, magma_int_t count, std::vector< T >& work )
+        {
+            magma_int_t mk = (m_array ? m_array[ idx[0] ] : m);
+            magma_int_t nk = (n_array ? n_array[ idx[0] ] : n);
+            magma_int_t minmn = min( mk, nk );
+            T* ptr[ L ];
+            magma_int_t ld[ L ], linfo[ L ];
+            for (magma_int_t l = 0; l < L; ++l) {
+                linfo[l] = 0;
+            }
+            for (magma_int_t l = 0; l < count; ++l) {
+                ptr[l] = A_array[ idx[l] ];
+                ld[l]  = (lda_array ? lda_array[ idx[l] ] : lda);
+                info_array[ idx[l] ] = 0;
+            }
+            if (minmn <= 0)
+                return;
+
+            if (mk > magma_compact_max_size || nk > magma_compact_max_size) {
+                for (magma_int_t l = 0; l < count; ++l) {
+                    lapackf77_dgetrf( &mk, &nk, ptr[l], &ld[l], ipiv_array[ idx[l] ],
+                                      &info_array[ idx[l] ] );
+                }
+                return;
+            }
+
+            // matrix, then compact pivots in the workspace
+            magma_int_t lwork = mk*nk*L + magma_ceildiv( minmn*L*sizeof(magma_int_t), sizeof(T) );
+            work.resize( lwork );
+            T* Ac = &work[0];
+            magma_int_t* ipivc = (magma_int_t*) (Ac + mk*nk*L);
+
+            magma_compact_pack( MagmaNoTrans, mk, nk, ptr, ld, count, Ac, true );
+            if (mk == nk) {
+                magma_compact_dispatch< magma_compact_nt_max, magma_getrf_compact_kernel< T > >
+                    ::run( nk, nk, Ac, ipivc, linfo );
+            }
+            else {
+                magma_getrf_compact_kernel< T >::template run< 0 >( mk, nk, Ac, ipivc, linfo );
+            }
+            magma_compact_unpack( MagmaNoTrans, MagmaFull, mk, nk, Ac, ptr, ld, count );
+            for (magma_int_t l = 0; l < count; ++l) {
+                magma_int_t* ipiv = ipiv_array[ idx[l] ];
+                for (magma_int_t j = 0; j < minmn; ++j) {
+                    ipiv[j] = ipivc[ j*L + l ];
+                }
+                info_array[ idx[l] ] = linfo[l];
+            }
+        });
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGETRF_BATCHED_CPU computes an LU factorization of a batch of general
+    M-by-N matrices A_i using partial pivoting with row interchanges, on the
+    CPU host.
+
+    The factorization has the form
+        A_i = P_i * L_i * U_i
+    where P_i is a permutation matrix, L_i is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U_i is upper
+    triangular (upper trapezoidal if m < n).
+
+    For M, N <= 64, groups of matrices are interleaved in SIMD lanes (the
+    compact layout of batched_compact.hpp) and factored together, with a
+    kernel specialized at compile time for square matrices of order
+    N <= 32. Larger matrices are factored one at a time by LAPACK.
+    Matrices are distributed over the OpenMP threads.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of each matrix A_i.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of each matrix A_i.  N >= 0.
+
+    @param[in,out]
+    A_array Array of pointers, dimension (batchCount).
+            Each is a DOUBLE PRECISION array A_i, dimension (LDA,N).
+            On entry, the M-by-N matrix to be factored.
+            On exit, the factors L_i and U_i from the factorization
+            A_i = P_i*L_i*U_i; the unit diagonal elements of L_i are not stored.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of each A_i.  LDA >= max(1,M).
+
+    @param[out]
+    ipiv_array  Array of pointers, dimension (batchCount).
+            Each is an INTEGER array, dimension (min(M,N)).
+            The pivot indices; for 1 <= j <= min(M,N), row j of the matrix
+            was interchanged with row IPIV(j).
+
+    @param[out]
+    info_array  Array of INTEGERs, dimension (batchCount), for each matrix:
+      -     = 0:  successful exit
+      -     > 0:  if INFO = i, U(i,i) is exactly zero. The factorization
+                  has been completed, but the factor U is exactly
+                  singular, and division by zero will occur if it is used
+                  to solve a system of equations.
+
+    @param[in]
+    batchCount  INTEGER
+                The number of matrices to operate on.
+
+    @return
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value.
+
+    @ingroup magma_getrf_batched
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dgetrf_batched_cpu(
+    magma_int_t m, magma_int_t n,
+    double **A_array, magma_int_t lda,
+    magma_int_t **ipiv_array,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    magma_int_t arginfo = 0;
+    if (m < 0) {
+        arginfo = -1;
+    } else if (n < 0) {
+        arginfo = -2;
+    } else if (lda < max(1,m)) {
+        arginfo = -4;
+    } else if (batchCount < 0) {
+        arginfo = -7;
+    }
+    if (arginfo != 0) {
+        magma_xerbla( __func__, -(arginfo) );
+        return arginfo;
+    }
+
+    /* Quick return if possible */
+    if (batchCount == 0)
+        return arginfo;
+
+    magma_dgetrf_batched_cpu_core( m, NULL, n, NULL, A_array, lda, NULL,
+                                   ipiv_array, info_array, batchCount );
+    return arginfo;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGETRF_VBATCHED_CPU computes an LU factorization with partial pivoting
+    of a batch of general matrices A_i of variable sizes, on the CPU host.
+    See magma_dgetrf_batched_cpu.
+
+    The matrices are sorted into size classes, the matrices of the same
+    dimensions, and each class is factored as a fixed size batch.
+
+    Arguments
+    ---------
+    @param[in]
+    m       Array of INTEGERs, dimension (batchCount).
+            The number of rows of each matrix A_i.  M[i] >= 0.
+
+    @param[in]
+    n       Array of INTEGERs, dimension (batchCount).
+            The number of columns of each matrix A_i.  N[i] >= 0.
+
+    @param[in,out]
+    A_array Array of pointers, dimension (batchCount).
+            Each is a DOUBLE PRECISION array A_i, dimension (LDA[i],N[i]).
+            On entry, the matrix to be factored.
+            On exit, the factors L_i and U_i.
+
+    @param[in]
+    lda     Array of INTEGERs, dimension (batchCount).
+            The leading dimension of each A_i.  LDA[i] >= max(1,M[i]).
+
+    @param[out]
+    ipiv_array  Array of pointers, dimension (batchCount).
+            Each is an INTEGER array, dimension (min(M[i],N[i])).
+            The pivot indices.
+
+    @param[out]
+    info_array  Array of INTEGERs, dimension (batchCount), for each matrix:
+      -     = 0:  successful exit
+      -     > 0:  if INFO = i, U(i,i) is exactly zero.
+
+    @param[in]
+    batchCount  INTEGER
+                The number of matrices to operate on.
+
+    @return
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value,
+                  for at least one matrix.
+
+    @ingroup magma_getrf_batched
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dgetrf_vbatched_cpu(
+    magma_int_t *m, magma_int_t *n,
+    double **A_array, magma_int_t *lda,
+    magma_int_t **ipiv_array,
+    magma_int_t *info_array, magma_int_t batchCount )
+{
+    magma_int_t arginfo = 0;
+    if (batchCount < 0) {
+        arginfo = -7;
+    }
+    for (magma_int_t i = 0; i < batchCount && arginfo == 0; ++i) {
+        if (m[i] < 0) {
+            arginfo = -1;
+        } else if (n[i] < 0) {
+            arginfo = -2;
+        } else if (lda[i] < max(1,m[i])) {
+            arginfo = -4;
+        }
+    }
+    if (arginfo != 0) {
+        magma_xerbla( __func__, -(arginfo) );
+        return arginfo;
+    }
+
+    /* Quick return if possible */
+    if (batchCount == 0)
+        return arginfo;
+
+    magma_dgetrf_batched_cpu_core( 0, m, 0, n, A_array, 0, lda,
+                                   ipiv_array, info_array, batchCount );
+    return arginfo;
+}
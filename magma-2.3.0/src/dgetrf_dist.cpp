@@ -0,0 +1,380 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgetrf_dist.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+#include "mpi_grid.hpp"  // includes magma_internal.h, after the STL headers
+
+#if defined(HAVE_MPI)
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGETRF_DIST computes an LU factorization of a general M-by-N matrix A
+    distributed over the ranks of an MPI communicator, using partial
+    pivoting with row interchanges, so A may be larger than the memory of
+    one node.
+
+    The factorization has the form
+        A = P * L * U
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U is upper
+    triangular (upper trapezoidal if m < n).
+
+    A is distributed 2D block cyclic (see magma_bcyclic_t) over the p-by-q
+    grid of the ranks of comm; rank r is participant r. At step k, the grid
+    column that owns block column k gathers the panel on the owner of the
+    diagonal tile, which factors it with LAPACK and scatters it back. The
+    pivots go to all ranks, and each grid row gets its rows of L by a
+    broadcast along the grid row. Each grid column applies the row
+    interchanges to its columns by exchanging the rows involved, the grid
+    row that owns block row k solves for its part of U, which is broadcast
+    along each grid column, and every rank updates its part of the
+    trailing matrix with one local GEMM. The broadcasts of L and of the
+    pivots are non-blocking. With look-ahead, the grid column that owns
+    block column k+1 updates it first, and factors and starts sending
+    panel k+1, before the rest of the update of step k, which the transfer
+    of panel k+1 then overlaps.
+
+    With BACKEND = host, each rank's BLAS uses its own cores; running
+    several ranks on one node, MPI's shared-memory transport stands in for
+    the network. Requires MAGMA built with -DHAVE_MPI.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  0 <= M <= desc->m.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  0 <= N <= desc->n.
+
+    @param[in,out]
+    A       DOUBLE PRECISION array on each rank, dimension (desc->ldd, NLOC),
+            with NLOC from magma_bcyclic_local_size.
+            On entry, this rank's part of the M-by-N matrix A.
+            On exit, this rank's part of the factors L and U from the
+            factorization A = P*L*U; the unit diagonal elements of L are
+            not stored.
+
+    @param[in]
+    desc    magma_bcyclic_t*
+            The distribution of A, with square tiles, desc->mb = desc->nb,
+            over p*q = the size of comm ranks; see magma_bcyclic_init.
+            M-by-N A is the leading part of the desc->m-by-desc->n matrix.
+
+    @param[out]
+    ipiv    INTEGER array on each rank, dimension (min(M,N))
+            The pivot indices, the same on all ranks; for 1 <= i <= min(M,N),
+            row i of the matrix was interchanged with row IPIV(i).
+
+    @param[in]
+    comm    MPI_Comm
+            The ranks over which A is distributed. All of them must call
+            DGETRF_DIST.
+
+    @param[out]
+    info    INTEGER, the same on all ranks.
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+      -     > 0:  if INFO = i, U(i,i) is exactly zero. The factorization
+                  has been completed, but the factor U is exactly
+                  singular, and division by zero will occur if it is used
+                  to solve a system of equations.
+
+    @ingroup magma_getrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dgetrf_dist(
+    magma_int_t m, magma_int_t n,
+    double *A, const magma_bcyclic_t *desc,
+    magma_int_t *ipiv,
+    MPI_Comm comm,
+    magma_int_t *info )
+{
+    #define A(i_, j_)  (A + (i_) + (j_)*ldda)
+
+    /* Constants */
+    const double c_one     = MAGMA_D_ONE;
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const magma_int_t ione = 1;
+
+    int nprocs;
+    MPI_Comm_size( comm, &nprocs );
+
+    /* Check arguments */
+    *info = 0;
+    if (desc == NULL || m < 0 || m > desc->m) {
+        *info = -1;
+    } else if (n < 0 || n > desc->n) {
+        *info = -2;
+    } else if (A == NULL) {
+        *info = -3;
+    } else if (desc->mb != desc->nb || desc->p * desc->q != nprocs) {
+        *info = -4;
+    } else if (ipiv == NULL && min( m, n ) > 0) {
+        *info = -5;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (m == 0 || n == 0)
+        return *info;
+
+    magma_mpi_grid grid( desc, comm, sizeof(double) );
+    const magma_int_t nb = desc->nb, p = grid.p, q = grid.q;
+    const magma_int_t pr = grid.pr, pc = grid.pc;
+    const magma_int_t ldda  = desc->ldd;
+    const magma_int_t min_mn = min( m, n );
+    const magma_int_t kt    = magma_ceildiv( min_mn, nb );
+    const magma_int_t mloc  = magma_bcyclic_numroc( m, nb, pr, p );
+    const magma_int_t nloc  = magma_bcyclic_numroc( n, nb, pc, q );
+
+    // rows of the panel of step k, from its diagonal tile down, on grid row s
+    auto panel_rows = [&]( magma_int_t k, magma_int_t s ) {
+        return magma_bcyclic_numroc( m, nb, s, p )
+             - magma_bcyclic_numroc( k*nb, nb, s, p );
+    };
+
+    // Workspace:
+    // W:    this rank's rows of panels k and k+1, which are in flight at
+    //       once, contiguous with ld = panel_rows( k, pr ); also the part
+    //       of the panel this rank sends to, and gets back from, the owner
+    //       of the diagonal tile.
+    // U:    this grid column's part of block row k of U, kb-by-nloc.
+    // G, P: on the owner of the diagonal tile, the gathered panel, by
+    //       grid rows, and the panel in global row order, for getrf.
+    // R:    the up to 2*kb rows involved in the interchanges of a step,
+    //       gathered, followed by the ones this rank owns.
+    const magma_int_t slot = max( 1, magma_bcyclic_numroc( m, nb, 0, p ) ) * nb;
+    const magma_int_t lwork = 2*slot + nb*max( 1, nloc ) + 2*m*nb + 4*nb*max( 1, nloc );
+    double *work = NULL;
+    magma_int_t failed = (MAGMA_SUCCESS != magma_dmalloc_cpu( &work, lwork ));
+    // all ranks return if any failed to allocate
+    grid.reduce_info( &failed );
+    if (failed) {
+        magma_free_cpu( work );
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+    double *U = work + 2*slot;
+    double *G = U + nb*max( 1, nloc );
+    double *P = G + m*nb;
+    double *R = P + m*nb;
+
+    auto W = [&]( magma_int_t k ) {
+        return work + (k % 2)*slot;
+    };
+
+    std::vector< int > counts( p ), displs( p );
+    std::vector< magma_int_t > rows;
+
+    // requests of the broadcasts of L and of the pivots of each panel in flight
+    std::vector< MPI_Request > requests[2];
+
+    // -------------------------
+    // Factors panel k on the owner of its diagonal tile, and starts the
+    // broadcasts of the pivots to all ranks and of L along grid rows.
+    auto panel = [&]( magma_int_t k ) {
+        magma_int_t kb  = min( nb, n - k*nb );
+        magma_int_t mk  = m - k*nb;
+        magma_int_t kp  = min( mk, kb );
+        magma_int_t il0 = magma_bcyclic_numroc( k*nb, nb, pr, p );
+        magma_int_t jl  = magma_bcyclic_numroc( k*nb, nb, pc, q );
+        magma_int_t mw  = mloc - il0;
+        magma_int_t ldw = max( 1, mw );
+        magma_int_t root = (k % p) + (k % q)*p;
+        if (pc == k % q) {
+            lapackf77_dlacpy( MagmaFullStr, &mw, &kb, A(il0, jl), &ldda, W( k ), &ldw );
+            magma_int_t total = 0;
+            for (magma_int_t s = 0; s < p; ++s) {
+                counts[s] = int( panel_rows( k, s )*kb );
+                displs[s] = int( total );
+                total += counts[s];
+            }
+            MPI_Gatherv( W( k ), int(mw*kb), grid.type,
+                         G, &counts[0], &displs[0], grid.type, int(k % p), grid.col_comm );
+            if (pr == k % p) {
+                // G has grid row s's rows at displs[s]; tile i of the
+                // panel is tile (i - k) of P
+                for (magma_int_t i = k; i*nb < m; ++i) {
+                    magma_int_t s   = i % p;
+                    magma_int_t ib  = min( nb, m - i*nb );
+                    magma_int_t lds = panel_rows( k, s );
+                    magma_int_t off = magma_bcyclic_numroc( i*nb, nb, s, p )
+                                    - magma_bcyclic_numroc( k*nb, nb, s, p );
+                    lapackf77_dlacpy( MagmaFullStr, &ib, &kb, G + displs[s] + off, &lds,
+                                      P + (i - k)*nb, &mk );
+                }
+                magma_int_t iinfo;
+                lapackf77_dgetrf( &mk, &kb, P, &mk, ipiv + k*nb, &iinfo );
+                if (iinfo > 0 && *info == 0) {
+                    *info = iinfo + k*nb;
+                }
+                for (magma_int_t i = 0; i < kp; ++i) {
+                    ipiv[ k*nb + i ] += k*nb;
+                }
+                for (magma_int_t i = k; i*nb < m; ++i) {
+                    magma_int_t s   = i % p;
+                    magma_int_t ib  = min( nb, m - i*nb );
+                    magma_int_t lds = panel_rows( k, s );
+                    magma_int_t off = magma_bcyclic_numroc( i*nb, nb, s, p )
+                                    - magma_bcyclic_numroc( k*nb, nb, s, p );
+                    lapackf77_dlacpy( MagmaFullStr, &ib, &kb, P + (i - k)*nb, &mk,
+                                      G + displs[s] + off, &lds );
+                }
+            }
+            MPI_Scatterv( G, &counts[0], &displs[0], grid.type,
+                          W( k ), int(mw*kb), grid.type, int(k % p), grid.col_comm );
+            lapackf77_dlacpy( MagmaFullStr, &mw, &kb, W( k ), &ldw, A(il0, jl), &ldda );
+        }
+        MPI_Request request;
+        MPI_Ibcast( ipiv + k*nb, int(kp), grid.int_type, int(root), comm, &request );
+        requests[k % 2].push_back( request );
+        MPI_Ibcast( W( k ), int(mw*kb), grid.type, int(k % q), grid.row_comm, &request );
+        requests[k % 2].push_back( request );
+    };
+
+    // -------------------------
+    // Applies the interchanges of step k to this rank's columns outside
+    // panel k. Each grid column gathers the rows involved, in all its
+    // columns, on all its ranks, which then store the rows they own in
+    // their new places.
+    auto swap = [&]( magma_int_t k ) {
+        magma_int_t kb = min( nb, n - k*nb );
+        magma_int_t kp = min( m - k*nb, kb );
+        rows.clear();
+        for (magma_int_t i = 0; i < kp; ++i) {
+            rows.push_back( k*nb + i );
+            rows.push_back( ipiv[ k*nb + i ] - 1 );
+        }
+        std::sort( rows.begin(), rows.end() );
+        rows.erase( std::unique( rows.begin(), rows.end() ), rows.end() );
+        magma_int_t nr = rows.size();
+
+        // src[i] is the row that moves to rows[i]
+        std::vector< magma_int_t > src( rows );
+        for (magma_int_t i = 0; i < kp; ++i) {
+            magma_int_t i1 = std::lower_bound( rows.begin(), rows.end(), k*nb + i ) - rows.begin();
+            magma_int_t i2 = std::lower_bound( rows.begin(), rows.end(), ipiv[ k*nb + i ] - 1 )
+                           - rows.begin();
+            std::swap( src[i1], src[i2] );
+        }
+
+        // pack the rows this rank owns, in order, row-wise
+        double *Rmine = R + nr*nloc;
+        magma_int_t nmine = 0;
+        for (magma_int_t s = 0; s < p; ++s) {
+            counts[s] = 0;
+        }
+        for (magma_int_t i = 0; i < nr; ++i) {
+            magma_int_t s = (rows[i] / nb) % p;
+            counts[s] += int(nloc);
+            if (s == pr) {
+                magma_int_t il = (rows[i] / (nb*p))*nb + rows[i] % nb;
+                blasf77_dcopy( &nloc, A(il, 0), &ldda, Rmine + nmine*nloc, &ione );
+                nmine += 1;
+            }
+        }
+        displs[0] = 0;
+        for (magma_int_t s = 1; s < p; ++s) {
+            displs[s] = displs[s-1] + counts[s-1];
+        }
+        MPI_Allgatherv( Rmine, int(nmine*nloc), grid.type,
+                        R, &counts[0], &displs[0], grid.type, grid.col_comm );
+
+        // R has grid row s's rows at displs[s], in the order of rows
+        std::vector< magma_int_t > pos( nr );
+        std::vector< int > next( displs );
+        for (magma_int_t i = 0; i < nr; ++i) {
+            magma_int_t s = (rows[i] / nb) % p;
+            pos[i] = next[s];
+            next[s] += int(nloc);
+        }
+        magma_int_t jl0 = magma_bcyclic_numroc( k*nb,     nb, pc, q );
+        magma_int_t jl1 = magma_bcyclic_numroc( min( n, (k+1)*nb ), nb, pc, q );
+        magma_int_t n2  = nloc - jl1;
+        for (magma_int_t i = 0; i < nr; ++i) {
+            if ((rows[i] / nb) % p == pr && src[i] != rows[i]) {
+                magma_int_t il = (rows[i] / (nb*p))*nb + rows[i] % nb;
+                magma_int_t is = std::lower_bound( rows.begin(), rows.end(), src[i] ) - rows.begin();
+                blasf77_dcopy( &jl0, R + pos[is],       &ione, A(il, 0),   &ldda );
+                blasf77_dcopy( &n2,  R + pos[is] + jl1, &ione, A(il, jl1), &ldda );
+            }
+        }
+    };
+
+    // -------------------------
+    // Solves for block row k of U, on grid row k % p, and broadcasts
+    // it along each grid column.
+    auto solve = [&]( magma_int_t k ) {
+        magma_int_t kb  = min( nb, n - k*nb );
+        magma_int_t kp  = min( m - k*nb, kb );
+        magma_int_t il0 = magma_bcyclic_numroc( k*nb,     nb, pr, p );
+        magma_int_t jl1 = magma_bcyclic_numroc( min( n, (k+1)*nb ), nb, pc, q );
+        magma_int_t n1  = nloc - jl1;
+        magma_int_t ldw = max( 1, mloc - il0 );
+        if (pr == k % p) {
+            // A(k, k+1:n) = L(k,k)^{-1} A(k, k+1:n)
+            blasf77_dtrsm( MagmaLeftStr, MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr,
+                           &kp, &n1, &c_one, W( k ), &ldw, A(il0, jl1), &ldda );
+            lapackf77_dlacpy( MagmaFullStr, &kp, &n1, A(il0, jl1), &ldda, U, &kp );
+        }
+        MPI_Bcast( U, int(kp*n1), grid.type, int(k % p), grid.col_comm );
+    };
+
+    // -------------------------
+    // Updates this rank's part of local columns jl to jl+nj of the
+    // trailing matrix, A(k+1:m, j) -= L(k+1:m, k) U(k, j).
+    auto update = [&]( magma_int_t k, magma_int_t jl, magma_int_t nj ) {
+        magma_int_t kb  = min( nb, n - k*nb );
+        magma_int_t kp  = min( m - k*nb, kb );
+        magma_int_t il0 = magma_bcyclic_numroc( k*nb,     nb, pr, p );
+        magma_int_t il1 = magma_bcyclic_numroc( min( m, (k+1)*nb ), nb, pr, p );
+        magma_int_t jl1 = magma_bcyclic_numroc( min( n, (k+1)*nb ), nb, pc, q );
+        magma_int_t m1  = mloc - il1;
+        magma_int_t ldw = max( 1, mloc - il0 );
+        blasf77_dgemm( MagmaNoTransStr, MagmaNoTransStr, &m1, &nj, &kp,
+                       &c_neg_one, W( k ) + (il1 - il0), &ldw, U + (jl - jl1)*kp, &kp,
+                       &c_one,     A(il1, jl), &ldda );
+    };
+
+    panel( 0 );
+    for (magma_int_t k = 0; k < kt; ++k) {
+        grid.wait( requests[k % 2] );
+        swap( k );
+        solve( k );
+
+        // look-ahead: update and factor panel k+1, and start sending it
+        magma_int_t jl = magma_bcyclic_numroc( min( n, (k+1)*nb ), nb, pc, q );
+        if (k+1 < kt) {
+            if (pc == (k+1) % q) {
+                magma_int_t jb = min( nb, n - (k+1)*nb );
+                update( k, jl, jb );
+                jl += jb;
+            }
+            panel( k+1 );
+        }
+
+        // rest of the trailing matrix, while panel k+1 is in flight
+        for (; jl < nloc; jl += nb) {
+            update( k, jl, min( nb, nloc - jl ));
+            grid.progress( requests[(k+1) % 2] );
+        }
+    }
+
+    magma_free_cpu( work );
+    grid.reduce_info( info );
+
+    return *info;
+} /* magma_dgetrf_dist */
+
+#endif // HAVE_MPI
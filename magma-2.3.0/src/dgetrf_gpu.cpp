@@ -11,7 +11,8 @@
        @generated from src/zgetrf_gpu.cpp, normal z -> d, Wed Nov 15 00:34:18 2017
 
 */
-#include "magma_internal.h"
+#include "lookahead.hpp"  // includes magma_internal.h, after the STL headers
+#include "roofline.h"
 
 /***************************************************************************//**
     Purpose
@@ -26,6 +27,9 @@
     triangular (upper trapezoidal if m < n).
 
     This is the right-looking Level 3 BLAS version of the algorithm.
+    The CPU factors each panel while the GPU updates the trailing matrix,
+    with an adaptive look-ahead of up to $MAGMA_LOOKAHEAD panels
+    (default 4); see magma_lookahead.
     
     Arguments
     ---------
@@ -87,6 +91,8 @@ magma_dgetrf_gpu(
     magma_int_t iinfo, nb;
     magma_int_t maxm, maxn, minmn;
     magma_int_t i, j, jb, rows, lddat, ldwork;
+    magma_int_t a, c, nt, p, t;
+    double flops, time;
     magmaDouble_ptr dAT=NULL, dAP=NULL;
     double *work=NULL;
 
@@ -144,7 +150,10 @@ magma_dgetrf_gpu(
         if ( m == n ) {
             dAT = dA;
             lddat = ldda;
+            roofline_start( "transpose", 0,
+                            sizeof(double) * roofline_copy_elems( m, m ), queues[0] );
             magmablas_dtranspose_inplace( m, dAT(0,0), lddat, queues[0] );
+            roofline_end();
         }
         else {
             lddat = maxn;  // N-by-M
@@ -152,7 +161,10 @@ magma_dgetrf_gpu(
                 *info = MAGMA_ERR_DEVICE_ALLOC;
                 goto cleanup;
             }
+            roofline_start( "transpose", 0,
+                            sizeof(double) * roofline_copy_elems( m, n ), queues[0] );
             magmablas_dtranspose( m, n, dA(0,0), ldda, dAT(0,0), lddat, queues[0] );
+            roofline_end();
         }
         magma_queue_sync( queues[0] );  // finish transpose
 
@@ -162,94 +174,132 @@ magma_dgetrf_gpu(
             goto cleanup;
         }
 
-        for( j=0; j < minmn-nb; j += nb ) {
-            // get j-th panel from device
-            magmablas_dtranspose( nb, m-j, dAT(j,j), lddat, dAP(0,0), maxm, queues[1] );
-            magma_queue_sync( queues[1] );  // wait for transpose
-            magma_dgetmatrix_async( m-j, nb, dAP(0,0), maxm, work, ldwork, queues[0] );
+        /* queues[0] brings each block column up to date with the panels
+           that the trailing updates skipped, and moves the panels to and
+           from the CPU; queues[1] runs the trailing updates, which skip
+           the look-ahead window. The row interchanges of each panel are
+           applied to the columns left of it at the end. */
+        nt = magma_ceildiv( minmn, nb );
+        magma_lookahead lookahead( nt );
+        std::vector< magma_event_t > panel_done( nt ), update_done( nt );
+        for( c=0; c < nt; ++c ) {
+            magma_event_create( &panel_done[c] );
+            magma_event_create( &update_done[c] );
+        }
+
+        for( c=0; c < nt; ++c ) {
+            j    = c*nb;
+            jb   = min( nb, minmn-j );
+            rows = m - j;
 
-            if ( j > 0 ) {
+            // apply panels a, ..., c-1 to block column c, once the last
+            // trailing update that included it is done
+            a = lookahead.applied( c );
+            if ( a > 0 ) {
+                magma_event_sync( update_done[a-1] );
+            }
+            time  = magma_wtime();
+            flops = 0;
+            for( p = a*nb; p < j; p += nb ) {
+                roofline_start( "lookahead laswp", 0,
+                                sizeof(double) * roofline_laswp_elems( jb, p + 1, p + nb ), queues[0] );
+                magmablas_dlaswp( jb, dAT(0,j), lddat, p + 1, p + nb, ipiv, 1, queues[0] );
+                roofline_end();
+                roofline_start( "lookahead trsm", FLOPS_DTRSM( MagmaRight, jb, nb ),
+                                sizeof(double) * roofline_trsm_elems( jb, nb, nb ), queues[0] );
                 magma_dtrsm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaUnit,
-                             n-(j+nb), nb,
-                             c_one, dAT(j-nb, j-nb), lddat,
-                                    dAT(j-nb, j+nb), lddat, queues[1] );
+                             jb, nb,
+                             c_one, dAT(p, p), lddat,
+                                    dAT(p, j), lddat, queues[0] );
+                roofline_end();
+                roofline_start( "lookahead gemm", FLOPS_DGEMM( jb, m-(p+nb), nb ),
+                                sizeof(double) * roofline_gemm_elems( jb, m-(p+nb), nb ), queues[0] );
                 magma_dgemm( MagmaNoTrans, MagmaNoTrans,
-                             n-(j+nb), m-j, nb,
-                             c_neg_one, dAT(j-nb, j+nb), lddat,
-                                        dAT(j,    j-nb), lddat,
-                             c_one,     dAT(j,    j+nb), lddat, queues[1] );
+                             jb, m-(p+nb), nb,
+                             c_neg_one, dAT(p,    j), lddat,
+                                        dAT(p+nb, p), lddat,
+                             c_one,     dAT(p+nb, j), lddat, queues[0] );
+                roofline_end();
+                flops += FLOPS_DTRSM( MagmaRight, jb, nb ) + FLOPS_DGEMM( jb, m-(p+nb), nb );
             }
 
-            // do the cpu part
-            rows = m - j;
+            // get c-th panel from device
+            roofline_start( "panel transpose", 0,
+                            sizeof(double) * roofline_copy_elems( jb, rows ), queues[0] );
+            magmablas_dtranspose( jb, rows, dAT(j,j), lddat, dAP(0,0), maxm, queues[0] );
+            roofline_end();
+            roofline_copy_start( "getmatrix panel", sizeof(double) * rows*jb, queues[0] );
+            magma_dgetmatrix_async( rows, jb, dAP(0,0), maxm, work, ldwork, queues[0] );
+            roofline_end();
             magma_queue_sync( queues[0] );  // wait to get work
-            lapackf77_dgetrf( &rows, &nb, work, &ldwork, ipiv+j, &iinfo );
+            lookahead.device( flops, magma_wtime() - time );
+
+            // do the cpu part
+            roofline_start( "panel getrf", FLOPS_DGETRF( rows, jb ),
+                            sizeof(double) * roofline_panel_elems( rows, jb ), NULL );
+            lapackf77_dgetrf( &rows, &jb, work, &ldwork, ipiv+j, &iinfo );
+            roofline_end();
+            lookahead.panel( magma_wtime() - time );
             if ( *info == 0 && iinfo > 0 )
                 *info = iinfo + j;
 
-            // send j-th panel to device
-            magma_dsetmatrix_async( m-j, nb, work, ldwork, dAP, maxm, queues[0] );
-
-            for( i=j; i < j + nb; ++i ) {
+            for( i=j; i < j + jb; ++i ) {
                 ipiv[i] += j;
             }
-            magmablas_dlaswp( n, dAT(0,0), lddat, j + 1, j + nb, ipiv, 1, queues[1] );
 
-            magma_queue_sync( queues[0] );  // wait to set dAP
-            magmablas_dtranspose( m-j, nb, dAP(0,0), maxm, dAT(j,j), lddat, queues[1] );
+            // send c-th panel to device
+            roofline_copy_start( "setmatrix panel", sizeof(double) * rows*jb, queues[0] );
+            magma_dsetmatrix_async( rows, jb, work, ldwork, dAP(0,0), maxm, queues[0] );
+            roofline_end();
+            roofline_start( "panel transpose", 0,
+                            sizeof(double) * roofline_copy_elems( rows, jb ), queues[0] );
+            magmablas_dtranspose( rows, jb, dAP(0,0), maxm, dAT(j,j), lddat, queues[0] );
+            roofline_end();
+            magma_event_record( panel_done[c], queues[0] );
 
-            // do the small non-parallel computations (next panel update)
-            if ( j + nb < minmn - nb ) {
-                magma_dtrsm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaUnit,
-                             nb, nb,
-                             c_one, dAT(j, j   ), lddat,
-                                    dAT(j, j+nb), lddat, queues[1] );
-                magma_dgemm( MagmaNoTrans, MagmaNoTrans,
-                             nb, m-(j+nb), nb,
-                             c_neg_one, dAT(j,    j+nb), lddat,
-                                        dAT(j+nb, j   ), lddat,
-                             c_one,     dAT(j+nb, j+nb), lddat, queues[1] );
-            }
-            else {
+            // apply panel to trailing matrix right of the look-ahead window,
+            // including any columns right of the last panel
+            t = lookahead.trailing( c, FLOPS_DTRSM( MagmaRight, n-(j+jb), jb )
+                                     + FLOPS_DGEMM( n-(j+jb), m-(j+jb), jb ) );
+            t = (t < nt ? t*nb : minmn);
+            if ( t < n ) {
+                magma_queue_wait_event( queues[1], panel_done[c] );
+                roofline_start( "update laswp", 0,
+                                sizeof(double) * roofline_laswp_elems( n-t, j + 1, j + jb ), queues[1] );
+                magmablas_dlaswp( n-t, dAT(0,t), lddat, j + 1, j + jb, ipiv, 1, queues[1] );
+                roofline_end();
+                roofline_start( "update trsm", FLOPS_DTRSM( MagmaRight, n-t, jb ),
+                                sizeof(double) * roofline_trsm_elems( n-t, jb, jb ), queues[1] );
                 magma_dtrsm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaUnit,
-                             n-(j+nb), nb,
-                             c_one, dAT(j, j   ), lddat,
-                                    dAT(j, j+nb), lddat, queues[1] );
-                magma_dgemm( MagmaNoTrans, MagmaNoTrans,
-                             n-(j+nb), m-(j+nb), nb,
-                             c_neg_one, dAT(j,    j+nb), lddat,
-                                        dAT(j+nb, j   ), lddat,
-                             c_one,     dAT(j+nb, j+nb), lddat, queues[1] );
+                             n-t, jb,
+                             c_one, dAT(j, j), lddat,
+                                    dAT(j, t), lddat, queues[1] );
+                roofline_end();
+                if ( j + jb < m ) {
+                    roofline_start( "update gemm", FLOPS_DGEMM( n-t, m-(j+jb), jb ),
+                                    sizeof(double) * roofline_gemm_elems( n-t, m-(j+jb), jb ), queues[1] );
+                    magma_dgemm( MagmaNoTrans, MagmaNoTrans,
+                                 n-t, m-(j+jb), jb,
+                                 c_neg_one, dAT(j,    t), lddat,
+                                            dAT(j+jb, j), lddat,
+                                 c_one,     dAT(j+jb, t), lddat, queues[1] );
+                    roofline_end();
+                }
+                magma_event_record( update_done[c], queues[1] );
             }
         }
 
-        jb = min( m-j, n-j );
-        if ( jb > 0 ) {
-            rows = m - j;
-            
-            magmablas_dtranspose( jb, rows, dAT(j,j), lddat, dAP(0,0), maxm, queues[1] );
-            magma_dgetmatrix( rows, jb, dAP(0,0), maxm, work, ldwork, queues[1] );
-            
-            // do the cpu part
-            lapackf77_dgetrf( &rows, &jb, work, &ldwork, ipiv+j, &iinfo );
-            if ( *info == 0 && iinfo > 0 )
-                *info = iinfo + j;
-            
-            for( i=j; i < j + jb; ++i ) {
-                ipiv[i] += j;
-            }
-            magmablas_dlaswp( n, dAT(0,0), lddat, j + 1, j + jb, ipiv, 1, queues[1] );
-            
-            // send j-th panel to device
-            magma_dsetmatrix( rows, jb, work, ldwork, dAP(0,0), maxm, queues[1] );
-            magmablas_dtranspose( rows, jb, dAP(0,0), maxm, dAT(j,j), lddat, queues[1] );
-            
-            magma_dtrsm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaUnit,
-                         n-j-jb, jb,
-                         c_one, dAT(j,j),    lddat,
-                                dAT(j,j+jb), lddat, queues[1] );
+        // apply the row interchanges of each panel to the columns left of it
+        magma_queue_wait_event( queues[1], panel_done[nt-1] );
+        for( c=1; c < nt; ++c ) {
+            j  = c*nb;
+            jb = min( nb, minmn-j );
+            roofline_start( "laswp", 0,
+                            sizeof(double) * roofline_laswp_elems( j, j + 1, j + jb ), queues[1] );
+            magmablas_dlaswp( j, dAT(0,0), lddat, j + 1, j + jb, ipiv, 1, queues[1] );
+            roofline_end();
         }
-        
+
         // undo transpose
         if ( m == n ) {
             magmablas_dtranspose_inplace( m, dAT(0,0), lddat, queues[1] );
@@ -257,6 +307,12 @@ magma_dgetrf_gpu(
         else {
             magmablas_dtranspose( n, m, dAT(0,0), lddat, dA(0,0), ldda, queues[1] );
         }
+
+        magma_queue_sync( queues[1] );
+        for( c=0; c < nt; ++c ) {
+            magma_event_destroy( panel_done[c] );
+            magma_event_destroy( update_done[c] );
+        }
     }
     
 cleanup:
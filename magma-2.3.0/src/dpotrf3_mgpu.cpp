@@ -10,6 +10,7 @@
 */
 #include "magma_internal.h"
 #include "trace.h"
+#include "roofline.h"
 //#include "abft_printer.h"
 //#include <cmath>
 // #include <iostream>
@@ -208,19 +209,7 @@ magma_dpotrf3_mgpu(
     /* initialization */
     for( d=0; d < ngpu; d++ ) {
         /* local-n and local-ld */
-        if (upper) {
-            n_local[d] = (n/(nb*ngpu))*nb;
-            if (d < (n/nb)%ngpu)
-                n_local[d] += nb;
-            else if (d == (n/nb)%ngpu)
-                n_local[d] += n%nb;
-        } else {
-            n_local[d] = (m/(nb*ngpu))*nb;
-            if (d < (m/nb)%ngpu)
-                n_local[d] += nb;
-            else if (d == (m/nb)%ngpu)
-                n_local[d] += m%nb;
-        }
+        n_local[d] = magma_bcyclic_numroc( (upper ? n : m), nb, d, ngpu );
     }
 
     // /* flags */
@@ -417,19 +406,24 @@ magma_dpotrf3_mgpu(
             magma_setdevice(id);
             if ( j > 0 ) {
                 trace_gpu_start( id, stream1, "syrk", "syrk" );
+                roofline_start( "update syrk", FLOPS_DSYRK( j, jb ),
+                                sizeof(double) * roofline_syrk_elems( jb, j ), queues[id][stream1] );
                 magma_dsyrk(MagmaUpper, MagmaConjTrans, jb, j,
                             d_neg_one, dlA(id, 0, nb*j_local), ldda,
                             d_one,     dlA(id, j, nb*j_local), ldda,
                             queues[id][stream1]);
+                roofline_end();
                 trace_gpu_end( id, stream1 );
             }
             
             /* send the diagonal to cpu on stream1 */
             trace_gpu_start( id, stream1, "comm", "D to CPU" );
+            roofline_copy_start( "getmatrix diag", sizeof(double) * jb*jb, queues[id][stream1] );
             magma_dgetmatrix_async( jb, jb,
                                     dlA(id, j, nb*j_local), ldda,
                                     Aup(j,j),               lda,
                                     queues[id][stream1] );
+            roofline_end();
             trace_gpu_end( id, stream1 );
 
             /* update off-diagonal blocks in the panel */
@@ -454,12 +448,15 @@ magma_dpotrf3_mgpu(
                             magma_queue_wait_event( queues[d][stream2], events[d][0] ); // rows arrived at gpu
                         }
                         trace_gpu_start( d, stream2, "gemm", "gemm" );
+                        roofline_start( "update gemm", FLOPS_DGEMM( jb, n_local[d]-nb0, j ),
+                                        sizeof(double) * roofline_gemm_elems( jb, n_local[d]-nb0, j ), queues[d][stream2] );
                         magma_dgemm(MagmaConjTrans, MagmaNoTrans,
                                     jb, n_local[d]-nb0, j,
                                     c_neg_one, dlpanel,        ldpanel,
                                                dlA(d, 0, nb0), ldda,
                                     c_one,     dlA(d, j, nb0), ldda,
                                     queues[d][stream2]);
+                        roofline_end();
                         trace_gpu_end( d, stream2 );
                         magma_event_record( events[d][2], queues[d][stream2] );
                     }
@@ -471,7 +468,10 @@ magma_dpotrf3_mgpu(
             magma_setdevice(id);
             magma_queue_sync( queues[id][stream1] );
             trace_cpu_start( 0, "getrf", "getrf" );
+            roofline_start( "panel potrf", FLOPS_DPOTRF( jb ),
+                            sizeof(double) * roofline_panel_elems( jb, jb ), NULL );
             lapackf77_dpotrf(MagmaUpperStr, &jb, Aup(j,j), &lda, info);
+            roofline_end();
             trace_cpu_end( 0 );
             if (*info != 0) {
                 *info = *info + j;
@@ -491,10 +491,12 @@ magma_dpotrf3_mgpu(
                     }
                     magma_setdevice(d);
                     trace_gpu_start( d, stream1, "comm", "comm" );
+                    roofline_copy_start( "setmatrix diag", sizeof(double) * jb*jb, queues[d][stream1] );
                     magma_dsetmatrix_async( jb, jb,
                                             Aup(j,j), lda,
                                             dlpanel,  ldpanel,
                                             queues[d][stream1] );
+                    roofline_end();
                     trace_gpu_end( d, stream1 );
                     magma_event_record( events[d][1], queues[d][stream1] );
                     d = (d+1)%ngpu;
@@ -502,10 +504,12 @@ magma_dpotrf3_mgpu(
             } else {
                 magma_setdevice(id);
                 trace_gpu_start( id, stream1, "comm", "comm" );
+                roofline_copy_start( "setmatrix diag", sizeof(double) * jb*jb, queues[id][stream1] );
                 magma_dsetmatrix_async( jb, jb,
                                         Aup(j,j),               lda,
                                         dlA(id, j, nb*j_local), ldda,
                                         queues[id][stream1] );
+                roofline_end();
                 trace_gpu_end( id, stream1 );
             }
             
@@ -531,6 +535,8 @@ magma_dpotrf3_mgpu(
                         nb0 = min(nb, nb2);
                         magma_queue_wait_event( queues[d][stream1], events[d][2] ); // wait for gemm update
                         trace_gpu_start( d, stream1, "trsm", "trsm" );
+                        roofline_start( "lookahead trsm", FLOPS_DTRSM( MagmaLeft, jb, nb0 ),
+                                        sizeof(double) * roofline_trsm_elems( jb, nb0, jb ), queues[d][stream1] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(DTRSM_WORK)
                             //magmablas_dlaset( MagmaFull, trsm_nb, trsm_n, c_zero, c_zero, dinvA(d,0), trsm_nb );
                             //magmablas_dlaset( MagmaFull, nb0,     jb,     c_zero, c_zero, dx(d,0), nb0 );
@@ -550,12 +556,15 @@ magma_dpotrf3_mgpu(
                                          dlA(d, j, nb*j_local2), ldda,
                                          queues[d][stream1] );
                         #endif
+                        roofline_end();
                         magma_event_record( events[d][4], queues[d][stream1] );
                         trace_gpu_end( d, stream1 );
                     } else if ( nb2 > 0 ) {
                         /* update all the blocks on stream2 */
                         magma_queue_wait_event( queues[d][stream2], events[d][1] ); // wait for cholesky factor
                         trace_gpu_start( d, stream2, "trsm", "trsm" );
+                        roofline_start( "update trsm", FLOPS_DTRSM( MagmaLeft, jb, nb2 ),
+                                        sizeof(double) * roofline_trsm_elems( jb, nb2, jb ), queues[d][stream2] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(DTRSM_WORK)
                             //magmablas_dlaset( MagmaFull, trsm_nb, trsm_n, c_zero, c_zero, dinvA(d,0), trsm_nb );
                             //magmablas_dlaset( MagmaFull, nb2,     jb,     c_zero, c_zero, dx(d,0), nb2 );
@@ -575,6 +584,7 @@ magma_dpotrf3_mgpu(
                                          dlA(d, j, nb*j_local2), ldda,
                                          queues[d][stream2] );
                         #endif
+                        roofline_end();
                         trace_gpu_end( d, stream2 );
                     }
                     d = (d+1)%ngpu;
@@ -597,10 +607,12 @@ magma_dpotrf3_mgpu(
                     magma_queue_wait_event( queues[d][stream3], events[d][4] );
                 
                     trace_gpu_start( d, stream3, "comm", "row to CPU" );
+                    roofline_copy_start( "getmatrix row", sizeof(double) * (j+jb)*nb0, queues[d][stream3] );
                     magma_dgetmatrix_async( (j+jb), nb0,
                                             dlA(d, 0, nb*j_local2), ldda,
                                             Aup(0,j+jb),            lda,
                                             queues[d][stream3] );
+                    roofline_end();
                     trace_gpu_end( d, stream3 );
                     magma_event_record( events[d][3], queues[d][stream3] );
                     /* needed on pluto */
@@ -613,10 +625,12 @@ magma_dpotrf3_mgpu(
                             magma_setdevice(d2);
                             trace_gpu_start( d2, stream3, "comm", "row to GPUs" );
                             magma_queue_wait_event( queues[d2][stream3], events[d][3] ); // rows arrived at cpu on stream3
+                            roofline_copy_start( "setmatrix row", sizeof(double) * (j+jb)*nb0, queues[d2][stream3] );
                             magma_dsetmatrix_async( j+jb, nb0,
                                                     Aup(0,j+jb),       lda,
                                                     dlP(d2,nb,0,buf2), lddp,
                                                     queues[d2][stream3] );
+                            roofline_end();
                             trace_gpu_end( d2, stream3 );
                             magma_event_record( events[d2][0], queues[d2][stream3] );
                         }
@@ -635,6 +649,8 @@ magma_dpotrf3_mgpu(
                         }
                         magma_setdevice(d);
                         trace_gpu_start( d, stream2, "trsm", "trsm" );
+                        roofline_start( "update trsm", FLOPS_DTRSM( MagmaLeft, jb, nb2 ),
+                                        sizeof(double) * roofline_trsm_elems( jb, nb2, jb ), queues[d][stream2] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(DTRSM_WORK)
                             bool flag = 0;
                             if (flag == 0) {
@@ -659,6 +675,7 @@ magma_dpotrf3_mgpu(
                                          dlA(d, j, nb*j_local2+nb0), ldda,
                                          queues[d][stream2] );
                         #endif
+                        roofline_end();
                         trace_gpu_end( d, stream2 );
                     }
                 }
@@ -681,17 +698,22 @@ magma_dpotrf3_mgpu(
             /* Update the current diagonal block on stream1 */
             magma_setdevice(id);
             if ( j > 0 ) {
+                roofline_start( "update syrk", FLOPS_DSYRK( j, jb ),
+                                sizeof(double) * roofline_syrk_elems( jb, j ), queues[id][stream1] );
                 magma_dsyrk( MagmaLower, MagmaNoTrans, jb, j,
                              d_neg_one, dlA(id, nb*j_local, 0), ldda,
                              d_one,     dlA(id, nb*j_local, j), ldda,
                              queues[id][stream1] );
+                roofline_end();
             }
 
             /* send the diagonal to cpu on stream1 */
+            roofline_copy_start( "getmatrix diag", sizeof(double) * jb*jb, queues[id][stream1] );
             magma_dgetmatrix_async( jb, jb,
                                     dlA(id, nb*j_local, j), ldda,
                                     Alo(j,j),               lda,
                                     queues[id][stream1] );
+            roofline_end();
 
             /* update off-diagonal blocks of the panel */
             if ( j > 0 ) {
@@ -712,12 +734,15 @@ magma_dpotrf3_mgpu(
                             ldpanel = nb;
                             magma_queue_wait_event( queues[d][stream2], events[d][0] ); // rows arrived at gpu
                         }
+                        roofline_start( "update gemm", FLOPS_DGEMM( n_local[d]-nb0, jb, j ),
+                                        sizeof(double) * roofline_gemm_elems( n_local[d]-nb0, jb, j ), queues[d][stream2] );
                         magma_dgemm( MagmaNoTrans, MagmaConjTrans,
                                      n_local[d]-nb0, jb, j,
                                      c_neg_one, dlA(d, nb0, 0), ldda,
                                                 dlpanel,        ldpanel,
                                      c_one,     dlA(d, nb0, j), ldda,
                                      queues[d][stream2] );
+                        roofline_end();
                         magma_event_record( events[d][2], queues[d][stream2] );
                     }
                     d = (d+1)%ngpu;
@@ -727,7 +752,10 @@ magma_dpotrf3_mgpu(
             /* wait for the panel and factorized it on cpu */
             magma_setdevice(id);
             magma_queue_sync( queues[id][stream1] );
+            roofline_start( "panel potrf", FLOPS_DPOTRF( jb ),
+                            sizeof(double) * roofline_panel_elems( jb, jb ), NULL );
             lapackf77_dpotrf(MagmaLowerStr, &jb, Alo(j,j), &lda, info);
+            roofline_end();
             if (*info != 0) {
                 *info = *info + j;
                 break;
@@ -745,19 +773,23 @@ magma_dpotrf3_mgpu(
                         ldpanel = nb;
                     }
                     magma_setdevice(d);
+                    roofline_copy_start( "setmatrix diag", sizeof(double) * jb*jb, queues[d][stream1] );
                     magma_dsetmatrix_async( jb, jb,
                                             Alo(j,j), lda,
                                             dlpanel,  ldpanel,
                                             queues[d][stream1] );
+                    roofline_end();
                     magma_event_record( events[d][1], queues[d][stream1] );
                     d = (d+1)%ngpu;
                 }
             } else {
                 magma_setdevice(id);
+                roofline_copy_start( "setmatrix diag", sizeof(double) * jb*jb, queues[id][stream1] );
                 magma_dsetmatrix_async( jb, jb,
                                         Alo(j,j),               lda,
                                         dlA(id, nb*j_local, j), ldda,
                                         queues[id][stream1] );
+                roofline_end();
             }
 
             /* panel factorize the off-diagonal */
@@ -780,6 +812,8 @@ magma_dpotrf3_mgpu(
                     magma_setdevice(d);
                     if ( j+nb < n && d == (j/nb+1)%ngpu ) { /* owns next column, look-ahead next block on stream1 */
                         if ( j > 0 ) magma_queue_wait_event( queues[d][stream1], events[d][2] ); // wait for gemm update
+                        roofline_start( "lookahead trsm", FLOPS_DTRSM( MagmaRight, nb0, jb ),
+                                        sizeof(double) * roofline_trsm_elems( nb0, jb, jb ), queues[d][stream1] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(DTRSM_WORK)
                             //magmablas_dlaset( MagmaFull, trsm_nb, trsm_n, c_zero, c_zero, dinvA(d,0), trsm_nb );
                             //magmablas_dlaset( MagmaFull, nb0,     jb,     c_zero, c_zero, dx(d,0), nb0 );
@@ -799,10 +833,13 @@ magma_dpotrf3_mgpu(
                                          dlA(d, nb*j_local2, j), ldda,
                                          queues[d][stream1] );
                         #endif
+                        roofline_end();
                         magma_event_record( events[d][4], queues[d][stream1] );
                     } else if ( nb2 > 0 ) { /* other gpus updating all the blocks on stream2 */
                         /* update the entire column */
                         magma_queue_wait_event( queues[d][stream2], events[d][1] ); // wait for the cholesky factor
+                        roofline_start( "update trsm", FLOPS_DTRSM( MagmaRight, nb2, jb ),
+                                        sizeof(double) * roofline_trsm_elems( nb2, jb, jb ), queues[d][stream2] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(DTRSM_WORK)
                             //magmablas_dlaset( MagmaFull, trsm_nb, trsm_n, c_zero, c_zero, dinvA(d,0), trsm_nb );
                             //magmablas_dlaset( MagmaFull, nb2,     jb,     c_zero, c_zero, dx(d,0), nb2 );
@@ -820,6 +857,7 @@ magma_dpotrf3_mgpu(
                                          dlA(d, nb*j_local2, j), ldda,
                                          queues[d][stream2] );
                         #endif
+                        roofline_end();
                     }
                     d = (d+1)%ngpu;
                 } /* end for d */
@@ -861,10 +899,12 @@ magma_dpotrf3_mgpu(
                     // lookahead done
                     magma_setdevice(d);
                     magma_queue_wait_event( queues[d][stream3], events[d][4] );
+                    roofline_copy_start( "getmatrix row", sizeof(double) * nb0*(j+jb), queues[d][stream3] );
                     magma_dgetmatrix_async( nb0, j+jb,
                                             dlA(d, nb*j_local2, 0), ldda,
                                             Alo(j+jb,0),            lda,
                                             queues[d][stream3] );
+                    roofline_end();
                     magma_event_record( events[d][3], queues[d][stream3] );
                     /* syn on rows on CPU, seem to be needed on Pluto */
                     //magma_queue_sync( queues[d][stream3] );
@@ -875,10 +915,12 @@ magma_dpotrf3_mgpu(
                         if ( d2 != d ) {
                             magma_setdevice(d2);
                             magma_queue_wait_event( queues[d2][stream3], events[d][3] ); // getmatrix done
+                            roofline_copy_start( "setmatrix row", sizeof(double) * nb0*(j+jb), queues[d2][stream3] );
                             magma_dsetmatrix_async( nb0, j+jb,
                                                     Alo(j+jb,0),        lda,
                                                     dlPT(d2,0,nb,buf2), nb, // first nbxnb reserved for diagonal block
                                                     queues[d2][stream3] );
+                            roofline_end();
                             magma_event_record( events[d2][0], queues[d2][stream3] );
                         }
                     }
@@ -896,6 +938,8 @@ magma_dpotrf3_mgpu(
                         }
                         magma_setdevice(d);
                         /* update the remaining blocks in the column */
+                        roofline_start( "update trsm", FLOPS_DTRSM( MagmaRight, nb2, jb ),
+                                        sizeof(double) * roofline_trsm_elems( nb2, jb, jb ), queues[d][stream2] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(DTRSM_WORK)
                             bool flag = 0;
                             if (flag == 0) {
@@ -920,6 +964,7 @@ magma_dpotrf3_mgpu(
                                          dlA(d, nb*j_local2+nb0, j), ldda,
                                          queues[d][stream2] );
                         #endif
+                        roofline_end();
                     }
                 }
             }
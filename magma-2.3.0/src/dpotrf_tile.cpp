@@ -0,0 +1,183 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zpotrf_tile.cpp, normal z -> d, Sat Oct 17 06:16:06 2026
+*/
+#include "task_scheduler.hpp"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DPOTRF_TILE computes the Cholesky factorization of a real symmetric
+    positive definite matrix A stored in tile-major layout.
+
+    The factorization has the form
+        A = U**H * U,  if uplo = MagmaUpper, or
+        A = L  * L**H, if uplo = MagmaLower,
+    where U is an upper triangular matrix and L is lower triangular.
+
+    This is a tile algorithm, computed on the CPU host. Each tile operation
+    (potrf, trsm, syrk, gemm) is a task; tasks are executed by
+    magma_get_parallel_numthreads() threads as soon as the tiles they depend
+    on are ready, using magma_task_scheduler. Since each tile is contiguous,
+    tasks do not suffer the TLB and cache conflicts of large LDA.
+    Use magma_dge2tile and magma_dtile2ge to convert to and from LAPACK layout.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  Upper triangle of A is stored;
+      -     = MagmaLower:  Lower triangle of A is stored.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size.  NB >= 1.
+
+    @param[in,out]
+    A       DOUBLE PRECISION array, dimension (NT*NT*NB*NB), where NT = ceil(N/NB).
+            On entry, the symmetric matrix A in tile-major layout
+            (see magma_dge2tile). If uplo = MagmaUpper, the tiles on and
+            above the diagonal contain the upper triangular part of A, and
+            the strictly lower triangular part is not referenced.
+            If uplo = MagmaLower, the tiles on and below the diagonal
+            contain the lower triangular part of A, and the strictly upper
+            triangular part is not referenced.
+    \n
+            On exit, if INFO = 0, the factor U or L from the Cholesky
+            factorization A = U**H * U or A = L * L**H.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+      -     > 0:  if INFO = i, the leading minor of order i is not
+                  positive definite, and the factorization could not be
+                  completed.
+
+    @ingroup magma_potrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_dpotrf_tile(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nb,
+    double *A,
+    magma_int_t *info )
+{
+    #define A(i_, j_)  (A + ((i_) + (j_)*nt)*nb*nb)
+
+    /* Constants */
+    const double c_one     = MAGMA_D_ONE;
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const double             d_one     =  1.0;
+    const double             d_neg_one = -1.0;
+
+    /* Check arguments */
+    *info = 0;
+    if (uplo != MagmaUpper && uplo != MagmaLower) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (nb < 1) {
+        *info = -3;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (n == 0)
+        return *info;
+
+    magma_int_t nt = magma_ceildiv( n, nb );
+
+    // tasks run single-threaded BLAS
+    magma_int_t lapack_threads = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+
+    magma_task_scheduler dag;
+    dag.launch( magma_get_parallel_numthreads() );
+
+    for (magma_int_t k = 0; k < nt; ++k) {
+        magma_int_t kb = min( nb, n - k*nb );
+
+        // factor diagonal tile
+        dag.insert( { magma_task_write( A(k,k) ) }, [=] {
+            if (*info == 0) {
+                magma_int_t iinfo;
+                lapackf77_dpotrf( lapack_uplo_const( uplo ), &kb, A(k,k), &nb, &iinfo );
+                if (iinfo > 0) {
+                    *info = iinfo + k*nb;
+                }
+            }
+        });
+
+        if (uplo == MagmaUpper) {
+            // A(k,j) = U(k,k)^{-H} A(k,j)
+            for (magma_int_t j = k+1; j < nt; ++j) {
+                magma_int_t jb = min( nb, n - j*nb );
+                dag.insert( { magma_task_read( A(k,k) ), magma_task_write( A(k,j) ) }, [=] {
+                    blasf77_dtrsm( MagmaLeftStr, MagmaUpperStr, MagmaConjTransStr, MagmaNonUnitStr,
+                                   &kb, &jb, &c_one, A(k,k), &nb, A(k,j), &nb );
+                });
+            }
+            // update trailing matrix, A(i,j) -= A(k,i)^H A(k,j)
+            for (magma_int_t j = k+1; j < nt; ++j) {
+                magma_int_t jb = min( nb, n - j*nb );
+                dag.insert( { magma_task_read( A(k,j) ), magma_task_write( A(j,j) ) }, [=] {
+                    blasf77_dsyrk( MagmaUpperStr, MagmaConjTransStr, &jb, &kb,
+                                   &d_neg_one, A(k,j), &nb, &d_one, A(j,j), &nb );
+                });
+                for (magma_int_t i = k+1; i < j; ++i) {
+                    dag.insert( { magma_task_read( A(k,i) ), magma_task_read( A(k,j) ),
+                                  magma_task_write( A(i,j) ) }, [=] {
+                        blasf77_dgemm( MagmaConjTransStr, MagmaNoTransStr, &nb, &jb, &kb,
+                                       &c_neg_one, A(k,i), &nb, A(k,j), &nb,
+                                       &c_one,     A(i,j), &nb );
+                    });
+                }
+            }
+        }
+        else {
+            // A(i,k) = A(i,k) L(k,k)^{-H}
+            for (magma_int_t i = k+1; i < nt; ++i) {
+                magma_int_t ib = min( nb, n - i*nb );
+                dag.insert( { magma_task_read( A(k,k) ), magma_task_write( A(i,k) ) }, [=] {
+                    blasf77_dtrsm( MagmaRightStr, MagmaLowerStr, MagmaConjTransStr, MagmaNonUnitStr,
+                                   &ib, &kb, &c_one, A(k,k), &nb, A(i,k), &nb );
+                });
+            }
+            // update trailing matrix, A(i,j) -= A(i,k) A(j,k)^H
+            for (magma_int_t j = k+1; j < nt; ++j) {
+                magma_int_t jb = min( nb, n - j*nb );
+                dag.insert( { magma_task_read( A(j,k) ), magma_task_write( A(j,j) ) }, [=] {
+                    blasf77_dsyrk( MagmaLowerStr, MagmaNoTransStr, &jb, &kb,
+                                   &d_neg_one, A(j,k), &nb, &d_one, A(j,j), &nb );
+                });
+                for (magma_int_t i = j+1; i < nt; ++i) {
+                    magma_int_t ib = min( nb, n - i*nb );
+                    dag.insert( { magma_task_read( A(i,k) ), magma_task_read( A(j,k) ),
+                                  magma_task_write( A(i,j) ) }, [=] {
+                        blasf77_dgemm( MagmaNoTransStr, MagmaConjTransStr, &ib, &jb, &kb,
+                                       &c_neg_one, A(i,k), &nb, A(j,k), &nb,
+                                       &c_one,     A(i,j), &nb );
+                    });
+                }
+            }
+        }
+    }
+
+    dag.sync();
+    dag.quit();
+    magma_set_lapack_numthreads( lapack_threads );
+
+    return *info;
+} /* magma_dpotrf_tile */
@@ -65,9 +65,6 @@ magma_dpotrs_gpu(
     magmaDouble_ptr dB, magma_int_t lddb,
     magma_int_t *info)
 {
-    // Constants
-    const double c_one = MAGMA_D_ONE;
-
     *info = 0;
     if ( uplo != MagmaUpper && uplo != MagmaLower )
         *info = -1;
@@ -99,8 +96,7 @@ magma_dpotrs_gpu(
             magma_dtrsv( MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, dA, ldda, dB, 1, queue );
             magma_dtrsv( MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, dA, ldda, dB, 1, queue );
         } else {
-            magma_dtrsm( MagmaLeft, MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
-            magma_dtrsm( MagmaLeft, MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+            magmablas_dpotrs_trsm( MagmaUpper, n, nrhs, dA, ldda, dB, lddb, queue );
         }
     }
     else {
@@ -108,8 +104,7 @@ magma_dpotrs_gpu(
             magma_dtrsv( MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, dA, ldda, dB, 1, queue );
             magma_dtrsv( MagmaLower, MagmaConjTrans, MagmaNonUnit, n, dA, ldda, dB, 1, queue );
         } else {
-            magma_dtrsm( MagmaLeft, MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
-            magma_dtrsm( MagmaLeft, MagmaLower, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+            magmablas_dpotrs_trsm( MagmaLower, n, nrhs, dA, ldda, dB, lddb, queue );
         }
     }
 
@@ -276,11 +276,11 @@ magma_int_t magma_dtrevc3(
         return *info;
     }
     
-    // Use blocked version (2) if sufficient workspace.
+    // Use blocked version (2) of back-transform if sufficient workspace.
     // Requires 1 vector for 1-norms, and 2*nb vectors for x and Q*x.
     // Zero-out the workspace to avoid potential NaN propagation.
     nb = 2;
-    if ( lwork >= n + 2*n*nbmin ) {
+    if ( over && lwork >= n + 2*n*nbmin ) {
         version = 2;
         nb = (lwork - n) / (2*n);
         nb = min( nb, nbmax );
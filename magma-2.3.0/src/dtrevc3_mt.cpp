@@ -10,6 +10,7 @@
 
        @precisions normal d -> s
 */
+#include "task_scheduler.hpp"
 #include "thread_queue.hpp"
 #include "magma_timer.h"
 
@@ -111,6 +112,601 @@ private:
 };
 
 
+// ---------------------------------------------
+// Blocked multi-shift solves and pipelined back-transform,
+// used by version 2 when back-transforming (howmany = MagmaBacktransVec).
+// Eigenvectors are computed for a group of consecutive eigenvalues at once.
+// Each vector is solved with one diagonal block of T at a time; then the
+// rest of the right-hand sides of all vectors in the group are updated
+// with a GEMM, as in xLATRS, but for many shifts.
+
+// Sets the constants to control overflow, as in dlaqtrsd.
+static void
+trevc_overflow_constants(
+    magma_int_t n, double *ulp, double *smlnum, double *bignum )
+{
+    double unfl = lapackf77_dlamch( "Safe minimum" );
+    double ovfl = 1. / unfl;
+    lapackf77_dlabad( &unfl, &ovfl );
+    *ulp    = lapackf77_dlamch( "Precision" );
+    *smlnum = unfl*( n / *ulp );
+    *bignum = (1. - *ulp) / *smlnum;
+}
+
+
+// Returns the eigenvalue (wr, wi) of the diagonal block of T at row k,
+// and the number nw of columns in its eigenvector (1 real, 2 complex).
+static magma_int_t
+trevc_eigenvalue(
+    magma_int_t k, magma_int_t k1,
+    const double *T, magma_int_t ldt,
+    double *wr, double *wi )
+{
+    #define T(i_,j_) (T + (i_) + (j_)*ldt)
+    *wr = *T(k,k);
+    *wi = 0.;
+    if ( k+1 < k1 && *T(k+1,k) != 0. ) {
+        *wi = sqrt( fabs(*T(k,k+1)) ) * sqrt( fabs(*T(k+1,k)) );
+        return 2;
+    }
+    return 1;
+    #undef T
+}
+
+
+// Solves [ T(lo:hi,lo:hi) - (wr + i*wi) ]*x(lo:hi) = scale*x(lo:hi) for one
+// right eigenvector x, stored in nw columns, then updates x(lo:hi) only;
+// rows above lo are updated by the caller. Same as the loop in dlaqtrsd.
+// The block [lo,hi) must not split a 2x2 diagonal block of T.
+static void
+trevc_block_right(
+    magma_int_t n, magma_int_t lo, magma_int_t hi,
+    const double *T, magma_int_t ldt, const double *cnorm,
+    double wr, double wi, double smin, double bignum,
+    double *x, magma_int_t ldx )
+{
+    #define T(i_,j_) (T + (i_) + (j_)*ldt)
+    #define x(i_,j_) (x + (i_) + (j_)*ldx)
+    #define W(i_,j_) (W + (i_) + (j_)*2)
+
+    const magma_int_t c_false = false;
+    const magma_int_t ione = 1;
+    const magma_int_t itwo = 2;
+    const double c_one = 1.;
+
+    magma_int_t nw = (wi == 0. ? 1 : 2);
+    magma_int_t c, ierr, j, j1, len, nr, r;
+    double beta, scale, xnorm, tmp;
+    double W[4] = { 0., 0., 0., 0. };
+
+    for( j=hi-1; j >= lo; j = j1-1 ) {
+        j1 = j;
+        if ( j > lo && *T(j,j-1) != 0. ) {
+            j1 = j - 1;
+        }
+        nr = j - j1 + 1;
+        magma_dlaln2(
+            c_false, nr, nw, smin, c_one,
+            T(j1,j1), ldt, c_one, c_one, x(j1,0), ldx,
+            wr, wi, W, itwo, &scale, &xnorm, &ierr );
+
+        // Scale W to avoid overflow when updating the right-hand side.
+        if ( xnorm > 1. ) {
+            beta = max( cnorm[j1], cnorm[j] );
+            if ( beta > bignum / xnorm ) {
+                for( r=0; r < 4; ++r ) {
+                    W[r] /= xnorm;
+                }
+                scale /= xnorm;
+            }
+        }
+
+        // Scale if necessary
+        if ( scale != 1. ) {
+            for( c=0; c < nw; ++c ) {
+                blasf77_dscal( &n, &scale, x(0,c), &ione );
+            }
+        }
+
+        // Update the right-hand side within the block
+        len = j1 - lo;
+        for( c=0; c < nw; ++c ) {
+            for( r=0; r < nr; ++r ) {
+                *x(j1+r,c) = *W(r,c);
+                tmp = -(*W(r,c));
+                blasf77_daxpy( &len, &tmp, T(lo,j1+r), &ione, x(lo,c), &ione );
+            }
+        }
+    }
+
+    #undef T
+    #undef x
+    #undef W
+}
+
+
+// Solves [ T(lo:hi,lo:hi) - (wr + i*wi) ]**T * x(lo:hi) = scale*x(lo:hi) for
+// one left eigenvector x, stored in nw columns; rows below hi are updated by
+// the caller. Same as the loop in dlaqtrsd.
+// The block [lo,hi) must not split a 2x2 diagonal block of T.
+static void
+trevc_block_left(
+    magma_int_t n, magma_int_t lo, magma_int_t hi,
+    const double *T, magma_int_t ldt, const double *cnorm,
+    double wr, double wi, double smin, double bignum,
+    double *x, magma_int_t ldx )
+{
+    #define T(i_,j_) (T + (i_) + (j_)*ldt)
+    #define x(i_,j_) (x + (i_) + (j_)*ldx)
+    #define W(i_,j_) (W + (i_) + (j_)*2)
+
+    const magma_int_t ione = 1;
+    const magma_int_t itwo = 2;
+    const double c_one = 1.;
+
+    magma_int_t nw = (wi == 0. ? 1 : 2);
+    magma_int_t c, ierr, j, j2, len, nr, r;
+    double beta, rec, scale, xnorm, vmax, vcrit;
+    double W[4] = { 0., 0., 0., 0. };
+
+    vmax  = c_one;
+    vcrit = bignum;
+    for( j=lo; j < hi; j = j2+1 ) {
+        j2 = j;
+        if ( j < hi-1 && *T(j+1,j) != 0. ) {
+            j2 = j + 1;
+        }
+        nr = j2 - j + 1;
+
+        // Scale if necessary to avoid overflow when forming
+        // the right-hand side.
+        beta = max( cnorm[j], cnorm[j2] );
+        if ( beta > vcrit ) {
+            rec = c_one / vmax;
+            for( c=0; c < nw; ++c ) {
+                blasf77_dscal( &n, &rec, x(0,c), &ione );
+            }
+            vmax  = c_one;
+            vcrit = bignum;
+        }
+
+        len = j - lo;
+        for( c=0; c < nw; ++c ) {
+            for( r=0; r < nr; ++r ) {
+                *x(j+r,c) -= magma_cblas_ddot( len, T(lo,j+r), ione, x(lo,c), ione );
+            }
+        }
+
+        magma_dlaln2(
+            (nr == 2), nr, nw, smin, c_one,
+            T(j,j), ldt, c_one, c_one, x(j,0), ldx,
+            wr, -wi, W, itwo, &scale, &xnorm, &ierr );
+
+        // Scale if necessary
+        if ( scale != 1. ) {
+            for( c=0; c < nw; ++c ) {
+                blasf77_dscal( &n, &scale, x(0,c), &ione );
+            }
+        }
+        for( c=0; c < nw; ++c ) {
+            for( r=0; r < nr; ++r ) {
+                *x(j+r,c) = *W(r,c);
+                vmax = max( fabs(*W(r,c)), vmax );
+            }
+        }
+        vcrit = bignum / vmax;
+    }
+
+    #undef T
+    #undef x
+    #undef W
+}
+
+
+// Scales the nw columns of x so that updating x(blo:bhi) -= M * x(ulo:uhi),
+// where M has infinity-norm at most tbnd, cannot overflow.
+static void
+trevc_protect_update(
+    magma_int_t n, magma_int_t nw,
+    magma_int_t ulo, magma_int_t uhi,
+    magma_int_t blo, magma_int_t bhi,
+    double tbnd, double bignum,
+    double *x, magma_int_t ldx )
+{
+    const magma_int_t ione = 1;
+    magma_int_t c, i;
+    double xnrm = 0., bnrm = 0., rec;
+    for( c=0; c < nw; ++c ) {
+        for( i=ulo; i < uhi; ++i ) {
+            xnrm = max( xnrm, fabs( x[i + c*ldx] ));
+        }
+        for( i=blo; i < bhi; ++i ) {
+            bnrm = max( bnrm, fabs( x[i + c*ldx] ));
+        }
+    }
+    if ( (xnrm > 1. && tbnd > (bignum - bnrm) / xnrm) ||
+         (xnrm <= 1. && tbnd*xnrm > bignum - bnrm) ) {
+        rec = 0.5 / (bnrm / bignum + (xnrm / bignum) * tbnd);
+        for( c=0; c < nw; ++c ) {
+            blasf77_dscal( &n, &rec, x + c*ldx, &ione );
+        }
+    }
+}
+
+
+// Computes the right eigenvectors of T for eigenvalues k0:k1, in the n-by-(k1-k0)
+// matrix X, using row blocks of size about bs.
+// The group [k0,k1) must not split a complex conjugate pair.
+static void
+trevc_solve_right(
+    magma_int_t n, magma_int_t k0, magma_int_t k1, magma_int_t bs,
+    const double *T, magma_int_t ldt, const double *cnorm,
+    double *X, magma_int_t ldx )
+{
+    #define T(i_,j_) (T + (i_) + (j_)*ldt)
+    #define X(i_,j_) (X + (i_) + (j_)*ldx)
+    #define x(i_,j_) (x + (i_) + (j_)*ldx)
+
+    const double c_zero    = 0.;
+    const double c_one     = 1.;
+    const double c_neg_one = -1.;
+
+    magma_int_t nc = k1 - k0;
+    magma_int_t j, k, lo, hi, nw;
+    double bignum, smin, smlnum, tbnd, ulp, wi, wr, *x;
+
+    trevc_overflow_constants( n, &ulp, &smlnum, &bignum );
+
+    // Form the right-hand sides, and solve with the diagonal block
+    // T(k0:k1, k0:k1) of the group.
+    lapackf77_dlaset( "F", &n, &nc, &c_zero, &c_zero, X, &ldx );
+    for( k=k0; k < k1; k += nw ) {
+        x = X(0,k-k0);
+        nw = trevc_eigenvalue( k, k1, T, ldt, &wr, &wi );
+        smin = max( ulp*(fabs(wr) + fabs(wi)), smlnum );
+        if ( nw == 1 ) {
+            *x(k,0) = c_one;
+            for( j=k0; j < k; ++j ) {
+                *x(j,0) = -(*T(j,k));
+            }
+        }
+        else {
+            if ( fabs(*T(k,k+1)) >= fabs(*T(k+1,k)) ) {
+                *x(k,  0) = c_one;
+                *x(k+1,1) = wi / *T(k,k+1);
+            }
+            else {
+                *x(k,  0) = -wi / *T(k+1,k);
+                *x(k+1,1) = c_one;
+            }
+            for( j=k0; j < k; ++j ) {
+                *x(j,0) = -(*x(k,  0)) * (*T(j,k));
+                *x(j,1) = -(*x(k+1,1)) * (*T(j,k+1));
+            }
+        }
+        trevc_block_right( n, k0, k, T, ldt, cnorm, wr, wi, smin, bignum, x, ldx );
+    }
+
+    // Update the rows above the solved block for all vectors with GEMM,
+    // then solve each vector with the next diagonal block up.
+    lo = k0;
+    hi = k1;
+    while ( lo > 0 ) {
+        tbnd = 0.;
+        for( j=lo; j < hi; ++j ) {
+            tbnd += cnorm[j];
+        }
+        for( k=k0; k < k1; k += nw ) {
+            nw = trevc_eigenvalue( k, k1, T, ldt, &wr, &wi );
+            trevc_protect_update( n, nw, lo, hi, 0, lo, tbnd, bignum, X(0,k-k0), ldx );
+        }
+        magma_int_t kb = hi - lo;
+        blasf77_dgemm( "N", "N", &lo, &nc, &kb,
+                       &c_neg_one, T(0,lo), &ldt,
+                                   X(lo,0), &ldx,
+                       &c_one,     X(0,0),  &ldx );
+
+        hi = lo;
+        lo = max( 0, hi - bs );
+        if ( lo > 0 && *T(lo,lo-1) != c_zero ) {
+            lo -= 1;
+        }
+        for( k=k0; k < k1; k += nw ) {
+            nw = trevc_eigenvalue( k, k1, T, ldt, &wr, &wi );
+            smin = max( ulp*(fabs(wr) + fabs(wi)), smlnum );
+            trevc_block_right( n, lo, hi, T, ldt, cnorm, wr, wi, smin, bignum,
+                               X(0,k-k0), ldx );
+        }
+    }
+
+    #undef T
+    #undef X
+    #undef x
+}
+
+
+// Computes the left eigenvectors of T for eigenvalues k0:k1, in the n-by-(k1-k0)
+// matrix X, using row blocks of size about bs.
+// The group [k0,k1) must not split a complex conjugate pair.
+static void
+trevc_solve_left(
+    magma_int_t n, magma_int_t k0, magma_int_t k1, magma_int_t bs,
+    const double *T, magma_int_t ldt, const double *cnorm,
+    double *X, magma_int_t ldx )
+{
+    #define T(i_,j_) (T + (i_) + (j_)*ldt)
+    #define X(i_,j_) (X + (i_) + (j_)*ldx)
+    #define x(i_,j_) (x + (i_) + (j_)*ldx)
+
+    const double c_zero    = 0.;
+    const double c_one     = 1.;
+    const double c_neg_one = -1.;
+
+    magma_int_t nc = k1 - k0;
+    magma_int_t j, k, lo, hi, nw, mb, kb;
+    double bignum, smin, smlnum, tbnd, ulp, wi, wr, *x;
+
+    trevc_overflow_constants( n, &ulp, &smlnum, &bignum );
+
+    // Form the right-hand sides, and solve with the diagonal block
+    // T(k0:k1, k0:k1) of the group.
+    lapackf77_dlaset( "F", &n, &nc, &c_zero, &c_zero, X, &ldx );
+    for( k=k0; k < k1; k += nw ) {
+        x = X(0,k-k0);
+        nw = trevc_eigenvalue( k, k1, T, ldt, &wr, &wi );
+        smin = max( ulp*(fabs(wr) + fabs(wi)), smlnum );
+        if ( nw == 1 ) {
+            *x(k,0) = c_one;
+            for( j=k+1; j < k1; ++j ) {
+                *x(j,0) = -(*T(k,j));
+            }
+        }
+        else {
+            if ( fabs(*T(k,k+1)) >= fabs(*T(k+1,k)) ) {
+                *x(k,  0) = wi / *T(k,k+1);
+                *x(k+1,1) = c_one;
+            }
+            else {
+                *x(k,  0) = c_one;
+                *x(k+1,1) = -wi / *T(k+1,k);
+            }
+            for( j=k+2; j < k1; ++j ) {
+                *x(j,0) = -(*x(k,  0)) * (*T(k,  j));
+                *x(j,1) = -(*x(k+1,1)) * (*T(k+1,j));
+            }
+        }
+        trevc_block_left( n, k+nw, k1, T, ldt, cnorm, wr, wi, smin, bignum, x, ldx );
+    }
+
+    // Update the rows below the solved block for all vectors with GEMM,
+    // then solve each vector with the next diagonal block down.
+    lo = k0;
+    hi = k1;
+    while ( hi < n ) {
+        tbnd = 0.;
+        for( j=hi; j < n; ++j ) {
+            tbnd = max( tbnd, cnorm[j] );
+        }
+        for( k=k0; k < k1; k += nw ) {
+            nw = trevc_eigenvalue( k, k1, T, ldt, &wr, &wi );
+            trevc_protect_update( n, nw, lo, hi, hi, n, tbnd, bignum, X(0,k-k0), ldx );
+        }
+        mb = n - hi;
+        kb = hi - lo;
+        blasf77_dgemm( "T", "N", &mb, &nc, &kb,
+                       &c_neg_one, T(lo,hi), &ldt,
+                                   X(lo,0),  &ldx,
+                       &c_one,     X(hi,0),  &ldx );
+
+        lo = hi;
+        hi = min( n, lo + bs );
+        if ( hi < n && *T(hi,hi-1) != c_zero ) {
+            hi += 1;
+        }
+        for( k=k0; k < k1; k += nw ) {
+            nw = trevc_eigenvalue( k, k1, T, ldt, &wr, &wi );
+            smin = max( ulp*(fabs(wr) + fabs(wi)), smlnum );
+            trevc_block_left( n, lo, hi, T, ldt, cnorm, wr, wi, smin, bignum,
+                              X(0,k-k0), ldx );
+        }
+    }
+
+    #undef T
+    #undef X
+    #undef x
+}
+
+
+// Normalizes the n-by-(k1-k0) eigenvectors in Y, for eigenvalues k0:k1,
+// so the element of largest magnitude has magnitude 1.
+static void
+trevc_normalize(
+    magma_int_t n, magma_int_t k0, magma_int_t k1,
+    const double *T, magma_int_t ldt,
+    double *Y, magma_int_t ldy )
+{
+    const magma_int_t ione = 1;
+    magma_int_t i, k, nw;
+    double emax, remax, wr, wi;
+    for( k=k0; k < k1; k += nw ) {
+        double *y = Y + (k-k0)*ldy;
+        nw = trevc_eigenvalue( k, k1, T, ldt, &wr, &wi );
+        if ( nw == 1 ) {
+            i = blasf77_idamax( &n, y, &ione ) - 1;  // subtract 1; i is 0-based
+            remax = 1. / fabs( y[i] );
+        }
+        else {
+            emax = 0.;
+            for( i=0; i < n; ++i ) {
+                emax = max( emax, fabs( y[i] ) + fabs( y[i + ldy] ));
+            }
+            remax = 1. / emax;
+            blasf77_dscal( &n, &remax, y + ldy, &ione );
+        }
+        blasf77_dscal( &n, &remax, y, &ione );
+    }
+}
+
+
+// Version 2 with back-transform. The eigenvectors are computed in blocks of
+// nb/2 vectors, double buffered in work: while one block is back-transformed
+// by GEMMs, Q*X, the next block is solved in the other buffer. Each block is
+// split into groups solved by trevc_solve_right/left, one task per group.
+// Dependencies are tracked on the columns of the x buffers, the row chunks of
+// the Q*x buffers, and the blocks of columns of VR and VL, which are read as
+// Q by the GEMMs of earlier blocks before being overwritten.
+static void
+trevc_pipelined(
+    magma_int_t rightv, magma_int_t leftv, magma_int_t n,
+    const double *T, magma_int_t ldt,
+    double *VL, magma_int_t ldvl,
+    double *VR, magma_int_t ldvr,
+    double *work, magma_int_t nb )
+{
+    #define T(i_,j_)    (T    + (i_) + (j_)*ldt)
+    #define work(i_,j_) (work + (i_) + (j_)*n)
+
+    const double c_zero = 0.;
+    const double c_one  = 1.;
+    const magma_int_t bs = 64;  // row block size of the solves
+
+    magma_int_t nbh = nb / 2;   // vectors per buffer
+    const double *cnorm = work(0,0);
+
+    magma_int_t nthread = magma_get_parallel_numthreads();
+    magma_int_t lapack_nthread = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+
+    // vectors per solve task; enough groups to keep the threads busy
+    magma_int_t gw = max( 4, magma_ceildiv( nbh, nthread ));
+
+    // gemm_nb = N/thread, rounded up to multiple of 16,
+    // but avoid multiples of page size, e.g., 512*8 bytes = 4096.
+    magma_int_t gemm_nb = magma_roundup( magma_ceildiv( n, nthread ), 16 );
+    if ( gemm_nb % 512 == 0 ) {
+        gemm_nb += 32;
+    }
+
+    magma_task_scheduler dag;
+    dag.launch( nthread );
+
+    std::vector< magma_task_access > access;
+    magma_int_t buf = 0;
+    for( magma_int_t side = 0; side < 2; ++side ) {
+        bool right = (side == 0);
+        if ( (right && ! rightv) || (! right && ! leftv) ) {
+            continue;
+        }
+        double *V = (right ? VR : VL);
+        magma_int_t ldv = (right ? ldvr : ldvl);
+
+        // Blocks of at most nbh eigenvalues, not splitting conjugate pairs;
+        // right vectors go from the bottom up, left vectors from the top down.
+        // Block i is [bound[i+1], bound[i]) for right, [bound[i], bound[i+1]) for left.
+        std::vector< magma_int_t > bound;
+        if ( right ) {
+            magma_int_t k1 = n;
+            bound.push_back( k1 );
+            while ( k1 > 0 ) {
+                magma_int_t k0 = max( 0, k1 - nbh );
+                if ( k0 > 0 && *T(k0,k0-1) != c_zero ) {
+                    k0 += 1;
+                }
+                bound.push_back( k0 );
+                k1 = k0;
+            }
+        }
+        else {
+            magma_int_t k0 = 0;
+            bound.push_back( k0 );
+            while ( k0 < n ) {
+                magma_int_t k1 = min( n, k0 + nbh );
+                if ( k1 < n && *T(k1,k1-1) != c_zero ) {
+                    k1 -= 1;
+                }
+                bound.push_back( k1 );
+                k0 = k1;
+            }
+        }
+        magma_int_t nblock = bound.size() - 1;
+
+        for( magma_int_t i = 0; i < nblock; ++i ) {
+            magma_int_t k0 = (right ? bound[i+1] : bound[i]  );
+            magma_int_t k1 = (right ? bound[i]   : bound[i+1]);
+            magma_int_t nc = k1 - k0;
+            magma_int_t b  = buf % 2;
+            double *X = work(0, 1 + b*nbh);
+            double *Y = work(0, 1 + nb + b*nbh);
+            buf += 1;
+
+            // solve groups of vectors into X
+            for( magma_int_t g0 = k0, g1; g0 < k1; g0 = g1 ) {
+                g1 = min( k1, g0 + gw );
+                if ( g1 < k1 && *T(g1,g1-1) != c_zero ) {
+                    g1 += 1;
+                }
+                access.clear();
+                for( magma_int_t j = g0; j < g1; ++j ) {
+                    access.push_back( magma_task_write( X + (j-k0)*n ));
+                }
+                double *Xg = X + (g0-k0)*n;
+                if ( right ) {
+                    dag.insert( access, [=] {
+                        trevc_solve_right( n, g0, g1, bs, T, ldt, cnorm, Xg, n );
+                    });
+                }
+                else {
+                    dag.insert( access, [=] {
+                        trevc_solve_left( n, g0, g1, bs, T, ldt, cnorm, Xg, n );
+                    });
+                }
+            }
+
+            // back-transform Y = Q*X, split into block rows.
+            // Right vectors use Q(:,0:k1), left vectors use Q(:,k0:n),
+            // which are the columns of blocks i, ..., nblock-1.
+            magma_int_t q0 = (right ? 0  : k0);
+            magma_int_t nq = (right ? k1 : n - k0);
+            for( magma_int_t ii = 0; ii < n; ii += gemm_nb ) {
+                magma_int_t ib = min( gemm_nb, n - ii );
+                access.clear();
+                for( magma_int_t j = 0; j < nc; ++j ) {
+                    access.push_back( magma_task_read( X + j*n ));
+                }
+                for( magma_int_t j = i; j < nblock; ++j ) {
+                    access.push_back( magma_task_read( V + bound[j+(right ? 1 : 0)]*ldv ));
+                }
+                access.push_back( magma_task_write( Y + ii ));
+                dag.insert( access, [=] {
+                    blasf77_dgemm( "N", "N", &ib, &nc, &nq,
+                                   &c_one,  V + ii + q0*ldv, &ldv,
+                                            X + q0,          &n,
+                                   &c_zero, Y + ii,          &n );
+                });
+            }
+
+            // normalize and copy to V(:,k0:k1)
+            access.clear();
+            for( magma_int_t ii = 0; ii < n; ii += gemm_nb ) {
+                access.push_back( magma_task_read( Y + ii ));
+            }
+            access.push_back( magma_task_write( V + k0*ldv ));
+            dag.insert( access, [=] {
+                trevc_normalize( n, k0, k1, T, ldt, Y, n );
+                lapackf77_dlacpy( "F", &n, &nc, Y, &n, V + k0*ldv, &ldv );
+            });
+        }
+    }
+
+    dag.sync();
+    dag.quit();
+    magma_set_lapack_numthreads( lapack_nthread );
+
+    #undef T
+    #undef work
+}
+
+
 /***************************************************************************//**
     Purpose
     -------
@@ -136,6 +732,11 @@ private:
 
     This uses a Level 3 BLAS version of the back transformation.
     This uses a multi-threaded (mt) implementation.
+    When back-transforming with sufficient workspace, eigenvectors for
+    groups of eigenvalues are computed together by blocked multi-shift
+    triangular solves, which update with GEMM, and the GEMM back transform
+    of each block of nb/2 vectors starts as soon as that block is solved,
+    overlapping the solves of the next block.
 
     Arguments
     ---------
@@ -372,11 +973,11 @@ magma_int_t magma_dtrevc3_mt(
         return *info;
     }
     
-    // Use blocked version (2) if sufficient workspace.
+    // Use blocked version (2) of back-transform if sufficient workspace.
     // Requires 1 vector for 1-norms, and 2*nb vectors for x and Q*x.
     // Zero-out the workspace to avoid potential NaN propagation.
     nb = 2;
-    if ( lwork >= n + 2*n*nbmin ) {
+    if ( over && lwork >= n + 2*n*nbmin ) {
         version = 2;
         nb = (lwork - n) / (2*n);
         nb = min( nb, nbmax );
@@ -397,6 +998,11 @@ magma_int_t magma_dtrevc3_mt(
         }
     }
         
+    if ( over && version == 2 ) {
+        trevc_pipelined( rightv, leftv, n, T, ldt, VL, ldvl, VR, ldvr, work, nb );
+        return *info;
+    }
+
     // launch threads -- each single-threaded MKL
     magma_int_t nthread = magma_get_parallel_numthreads();
     magma_int_t lapack_nthread = magma_get_lapack_numthreads();
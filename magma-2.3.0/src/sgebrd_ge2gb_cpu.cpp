@@ -0,0 +1,174 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/dgebrd_ge2gb_cpu.cpp, normal d -> s, Wed Nov 15 00:34:20 2017
+
+*/
+#include "magma_internal.h"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    DGEBRD_GE2GB_CPU reduces a general real M-by-N matrix A, with M >= N,
+    to upper band form B with NB superdiagonals, by an orthogonal
+    transformation, on the CPU host:
+        Q1**T * A * P1 = B.
+    This is the first stage of the two-stage reduction to bidiagonal form;
+    the band is then reduced to bidiagonal form by magma_sgebrd_gb2bd_cpu.
+
+    Each step factors a block column of NB columns by QR, and the block
+    row to the right of its diagonal block by LQ, and applies both to the
+    trailing matrix with level 3 BLAS (dlarfb), split over the threads by
+    block columns for the left update and block rows for the right update.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= N.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The bandwidth of B.  NB >= 1.
+
+    @param[in,out]
+    A       REAL array, dimension (LDA,N)
+            On entry, the M-by-N general matrix to be reduced.
+            On exit, the diagonal and the first NB superdiagonals are
+            overwritten with the upper band matrix B. The elements below
+            the diagonal, with the array TAUQ, represent the orthogonal
+            matrix Q1 as a product of N elementary reflectors, as returned
+            by dgeqrf. The elements above the NB-th superdiagonal, with the
+            array TAUP, represent the orthogonal matrix P1: the submatrix
+            A(1:N-NB,NB+1:N) holds N-NB elementary reflectors, as returned
+            by dgelqf, such that P1 = diag( I, Q_lq**T ).
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,M).
+
+    @param[out]
+    tauq    REAL array, dimension (N)
+            The scalar factors of the elementary reflectors which
+            represent the orthogonal matrix Q1.
+
+    @param[out]
+    taup    REAL array, dimension (max(1,N-NB))
+            The scalar factors of the elementary reflectors which
+            represent the orthogonal matrix P1.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+
+    @ingroup magma_gebrd
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sgebrd_ge2gb_cpu(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    float *A, magma_int_t lda,
+    float *tauq, float *taup,
+    magma_int_t *info)
+{
+    #define A(i_, j_) (A + (i_) + (j_)*lda)
+
+    /* Local variables */
+    float *T = NULL, *work = NULL;
+    magma_int_t nthread, lwork, ldt, iinfo;
+
+    /* Function Body */
+    *info = 0;
+    if (n < 0) {
+        *info = -2;
+    } else if (m < n) {
+        *info = -1;
+    } else if (nb < 1) {
+        *info = -3;
+    } else if (lda < max(1,m)) {
+        *info = -5;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return if possible */
+    if (n == 0)
+        return *info;
+
+    nthread = magma_get_parallel_numthreads();
+    ldt   = nb;
+    // each thread needs nb columns of dlarfb workspace for its block of
+    // at most m rows or columns; dgeqrf and dgelqf use the same, as nb*m >= m
+    lwork = nb*m;
+    if (MAGMA_SUCCESS != magma_smalloc_cpu( &T,    ldt*nb ) ||
+        MAGMA_SUCCESS != magma_smalloc_cpu( &work, lwork*nthread ))
+    {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        goto cleanup;
+    }
+
+    magma_int_t mklth;
+    mklth = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads(1);
+
+    for (magma_int_t k = 0; k < n; k += nb) {
+        magma_int_t kb = min( nb, n-k );
+        magma_int_t mk = m-k;
+        magma_int_t nk = n-k-kb;
+
+        /* QR of the block column A(k:m, k:k+kb) */
+        magma_set_lapack_numthreads( mklth );
+        lapackf77_sgeqrf( &mk, &kb, A(k,k), &lda, tauq+k, work, &lwork, &iinfo );
+        magma_set_lapack_numthreads(1);
+        if (nk <= 0)
+            break;
+
+        /* A(k:m, k+kb:n) = Q**T A(k:m, k+kb:n), by block columns */
+        lapackf77_slarft( "F", "C", &mk, &kb, A(k,k), &lda, tauq+k, T, &ldt );
+        magma_int_t cb = magma_roundup( magma_ceildiv( nk, nthread ), 32 );
+        #pragma omp parallel for schedule(static) num_threads(nthread)
+        for (magma_int_t j = k+kb; j < n; j += cb) {
+            magma_int_t jb = min( cb, n-j );
+            float *wk = work + lwork*((j-k-kb)/cb);
+            lapackf77_slarfb( "L", "T", "F", "C", &mk, &jb, &kb,
+                              A(k,k), &lda, T, &ldt, A(k,j), &lda, wk, &jb );
+        }
+
+        /* LQ of the block row A(k:k+kb, k+kb:n) */
+        magma_int_t kl = min( kb, nk );
+        magma_set_lapack_numthreads( mklth );
+        lapackf77_sgelqf( &kb, &nk, A(k,k+kb), &lda, taup+k, work, &lwork, &iinfo );
+        magma_set_lapack_numthreads(1);
+
+        /* A(k+kb:m, k+kb:n) = A(k+kb:m, k+kb:n) Q**T, by block rows */
+        magma_int_t mr = m-k-kb;
+        lapackf77_slarft( "F", "R", &nk, &kl, A(k,k+kb), &lda, taup+k, T, &ldt );
+        magma_int_t rb = magma_roundup( magma_ceildiv( mr, nthread ), 32 );
+        #pragma omp parallel for schedule(static) num_threads(nthread)
+        for (magma_int_t i = k+kb; i < m; i += rb) {
+            magma_int_t ib = min( rb, m-i );
+            float *wk = work + lwork*((i-k-kb)/rb);
+            lapackf77_slarfb( "R", "N", "F", "R", &ib, &nk, &kl,
+                              A(k,k+kb), &lda, T, &ldt, A(i,k+kb), &lda, wk, &ib );
+        }
+    }
+
+    magma_set_lapack_numthreads( mklth );
+
+cleanup:
+    magma_free_cpu( T );
+    magma_free_cpu( work );
+
+    return *info;
+} /* magma_sgebrd_ge2gb_cpu */
@@ -11,6 +11,7 @@
        @generated from src/zgeqrf_gpu.cpp, normal z -> s, Wed Nov 15 00:34:18 2017
 */
 #include "magma_internal.h"
+#include "roofline.h"
 
 /***************************************************************************//**
     Auxiliary function: "A" is pointer to the current panel holding the
@@ -208,30 +209,37 @@ magma_sgeqrf_gpu(
             rows = m - i;
             
             // get i-th panel from device
+            roofline_copy_start( "getmatrix panel", sizeof(float) * rows*ib, queues[1] );
             magma_sgetmatrix_async( rows, ib,
                                     dA(i,i), ldda,
                                     work,    ldwork, queues[1] );
+            roofline_end();
             if (i > 0) {
                 // Apply H^H to A(i:m,i+2*ib:n) from the left
                 cols = n - old_i - 2*old_ib;
+                roofline_start( "update larfb", FLOPS_SORMQR( m-old_i, cols, old_ib, MagmaLeft ),
+                                sizeof(float) * roofline_larfb_elems( m-old_i, cols, old_ib ), queues[0] );
                 magma_slarfb_gpu( MagmaLeft, MagmaConjTrans, MagmaForward, MagmaColumnwise,
                                   m-old_i, cols, old_ib,
                                   dA(old_i, old_i         ), ldda, dT(old_i), nb,
                                   dA(old_i, old_i+2*old_ib), ldda, dwork(0),  lddwork, queues[0] );
+                roofline_end();
                 
                 // Fix the diagonal block
+                roofline_copy_start( "setmatrix R", sizeof(float) * old_ib*old_ib, queues[0] );
                 magma_ssetmatrix_async( old_ib, old_ib,
                                         R,         old_ib,
                                         dR(old_i), old_ib, queues[0] );
+                roofline_end();
             }
             
             magma_queue_sync( queues[1] );  // wait to get work(i)
-            lapackf77_sgeqrf( &rows, &ib, work, &ldwork, &tau[i], hwork, &lhwork, info );
-            // Form the triangular factor of the block reflector in hwork
-            // H = H(i) H(i+1) . . . H(i+ib-1)
-            lapackf77_slarft( MagmaForwardStr, MagmaColumnwiseStr,
-                              &rows, &ib,
-                              work, &ldwork, &tau[i], hwork, &ib );
+            // Factor the panel and form the triangular factor of the
+            // block reflector H = H(i) H(i+1) . . . H(i+ib-1) in hwork
+            roofline_start( "panel geqrt3", FLOPS_SGEQRF( rows, ib ),
+                            sizeof(float) * roofline_panel_elems( rows, ib ), NULL );
+            magma_sgeqrt3_cpu( rows, ib, work, ldwork, &tau[i], hwork, ib, info );
+            roofline_end();
             
             // wait for previous trailing matrix update (above) to finish with R
             magma_queue_sync( queues[0] );
@@ -241,35 +249,47 @@ magma_sgeqrf_gpu(
             ssplit_diag_block_invert( ib, work, ldwork, R );
             
             // send i-th V matrix to device
+            roofline_copy_start( "setmatrix panel", sizeof(float) * rows*ib, queues[1] );
             magma_ssetmatrix( rows, ib,
                               work, ldwork,
                               dA(i,i), ldda, queues[1] );
+            roofline_end();
             
             if (i + ib < n) {
                 // send T matrix to device
+                roofline_copy_start( "setmatrix T", sizeof(float) * ib*ib, queues[1] );
                 magma_ssetmatrix( ib, ib,
                                   hwork, ib,
                                   dT(i), nb, queues[1] );
+                roofline_end();
                 
                 if (i+nb < minmn-nb) {
                     // Apply H^H to A(i:m,i+ib:i+2*ib) from the left
+                    roofline_start( "lookahead larfb", FLOPS_SORMQR( rows, ib, ib, MagmaLeft ),
+                                    sizeof(float) * roofline_larfb_elems( rows, ib, ib ), queues[1] );
                     magma_slarfb_gpu( MagmaLeft, MagmaConjTrans, MagmaForward, MagmaColumnwise,
                                       rows, ib, ib,
                                       dA(i, i   ), ldda, dT(i),  nb,
                                       dA(i, i+ib), ldda, dwork(0), lddwork, queues[1] );
+                    roofline_end();
                     // wait for larfb to finish with dwork before larfb in next iteration starts
                     magma_queue_sync( queues[1] );
                 }
                 else {
                     // Apply H^H to A(i:m,i+ib:n) from the left
+                    roofline_start( "update larfb", FLOPS_SORMQR( rows, n-i-ib, ib, MagmaLeft ),
+                                    sizeof(float) * roofline_larfb_elems( rows, n-i-ib, ib ), queues[1] );
                     magma_slarfb_gpu( MagmaLeft, MagmaConjTrans, MagmaForward, MagmaColumnwise,
                                       rows, n-i-ib, ib,
                                       dA(i, i   ), ldda, dT(i),  nb,
                                       dA(i, i+ib), ldda, dwork(0), lddwork, queues[1] );
+                    roofline_end();
                     // Fix the diagonal block
+                    roofline_copy_start( "setmatrix R", sizeof(float) * ib*ib, queues[1] );
                     magma_ssetmatrix( ib, ib,
                                       R,     ib,
                                       dR(i), ib, queues[1] );
+                    roofline_end();
                 }
                 old_i  = i;
                 old_ib = ib;
@@ -283,11 +303,18 @@ magma_sgeqrf_gpu(
     if (i < minmn) {
         rows = m-i;
         cols = n-i;
+        roofline_copy_start( "getmatrix last", sizeof(float) * rows*cols, queues[1] );
         magma_sgetmatrix( rows, cols, dA(i, i), ldda, work, rows, queues[1] );
+        roofline_end();
         // see comments for lwork above
         lhwork = lwork - rows*cols;
+        roofline_start( "last geqrf", FLOPS_SGEQRF( rows, cols ),
+                        sizeof(float) * roofline_panel_elems( rows, cols ), NULL );
         lapackf77_sgeqrf( &rows, &cols, work, &rows, &tau[i], &work[rows*cols], &lhwork, info );
+        roofline_end();
+        roofline_copy_start( "setmatrix last", sizeof(float) * rows*cols, queues[1] );
         magma_ssetmatrix( rows, cols, work, rows, dA(i, i), ldda, queues[1] );
+        roofline_end();
     }
         
     magma_queue_destroy( queues[0] );
@@ -0,0 +1,316 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgerbt_cpu.cpp, normal z -> s, Sat Oct 17 06:21:20 2026
+*/
+#include "magma_internal.h"
+
+
+/******************************************************************************/
+static void
+init_butterfly(
+        magma_int_t n,
+        float* u, float* v)
+{
+    magma_int_t i;
+    float u1, v1;
+    for (i=0; i < n; ++i) {
+        u1 = exp( (rand()/(float)RAND_MAX - 0.5)/10 );
+        v1 = exp( (rand()/(float)RAND_MAX - 0.5)/10 );
+        u[i] = MAGMA_S_MAKE( u1, u1 );
+        v[i] = MAGMA_S_MAKE( v1, v1 );
+    }
+}
+
+
+/******************************************************************************/
+// One elementary butterfly on a 2x2 set of elements,
+// [ a00 a01; a10 a11 ] = diag(u0,u1) * H * [ a00 a01; a10 a11 ] * H * diag(v0,v1),
+// where H = [ 1 1; 1 -1 ]. Same as magmablas_selementary_multiplication_kernel.
+static inline void
+elementary_butterfly(
+    float &a00, float &a01,
+    float &a10, float &a11,
+    float u0, float u1,
+    float v0, float v1 )
+{
+    float b1 = a00 + a01;
+    float b2 = a10 + a11;
+    float b3 = a00 - a01;
+    float b4 = a10 - a11;
+    a00 = u0 * v0 * (b1 + b2);
+    a01 = u0 * v1 * (b3 + b4);
+    a10 = u1 * v0 * (b1 - b2);
+    a11 = u1 * v1 * (b3 - b4);
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SGERBT_CPU randomizes a system of linear equations A * X = B using a
+    depth 2 partial Random Butterfly Transformation (PRBT), on the CPU host:
+        A = U^T * A * V,  B = U^T * B.
+    After solving the randomized system (U^T A V) Y = U^T B with LU without
+    pivoting, e.g., magma_sgetrf_nopiv_tile, the solution is X = V * Y,
+    computed by magma_sprbt_mv_cpu.
+
+    This is the host version of magma_sgerbt_gpu, and uses the same
+    representation for U and V, so the two give the same transformation.
+    Element (i,j) of the result depends on the 4x4 elements of A in rows
+    i + {0, 1, 2, 3}*n/4 and columns j + {0, 1, 2, 3}*n/4, so both levels of
+    the recursive butterfly are applied to them at once, while they are in
+    registers. This makes a single pass over A, reading it by columns.
+
+    Arguments
+    ---------
+    @param[in]
+    gen     magma_bool_t
+     -         = MagmaTrue:     new matrices are generated for U and V
+     -         = MagmaFalse:    matrices U and V given as parameter are used
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  n >= 0, and n must be a multiple of 4.
+            (Pad A with the identity to get such an n; see magma_sgesv_rbt_cpu.)
+
+    @param[in]
+    nrhs    INTEGER
+            The number of right hand sides, i.e., the number of columns
+            of the matrix B.  nrhs >= 0.
+
+    @param[in,out]
+    A       REAL array, dimension (LDA,n).
+            On entry, the n-by-n matrix A.
+            On exit, the randomized matrix U^T * A * V.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,n).
+
+    @param[in,out]
+    B       REAL array, dimension (LDB,nrhs)
+            On entry, the right hand side matrix B.
+            On exit, the randomized right hand side U^T * B.
+
+    @param[in]
+    ldb     INTEGER
+            The leading dimension of the array B.  LDB >= max(1,n).
+
+    @param[in,out]
+    U       REAL array, dimension (2,n)
+            Random butterfly matrix, if gen = MagmaTrue U is generated and returned as output;
+            else we use U given as input.
+
+    @param[in,out]
+    V       REAL array, dimension (2,n)
+            Random butterfly matrix, if gen = MagmaTrue V is generated and returned as output;
+            else we use V given as input.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_gerbt
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sgerbt_cpu(
+    magma_bool_t gen, magma_int_t n, magma_int_t nrhs,
+    float *A, magma_int_t lda,
+    float *B, magma_int_t ldb,
+    float *U, float *V,
+    magma_int_t *info)
+{
+    #define A(i_, j_) (A + (i_) + (j_)*lda)
+    #define B(i_, j_) (B + (i_) + (j_)*ldb)
+
+    /* Function Body */
+    *info = 0;
+    if ( ! (gen == MagmaTrue) &&
+         ! (gen == MagmaFalse) ) {
+        *info = -1;
+    }
+    else if (n < 0 || n % 4 != 0) {
+        *info = -2;
+    } else if (nrhs < 0) {
+        *info = -3;
+    } else if (lda < max(1,n)) {
+        *info = -5;
+    } else if (ldb < max(1,n)) {
+        *info = -7;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return if possible */
+    if (n == 0)
+        return *info;
+
+    /* Initialize Butterfly matrix */
+    if (gen == MagmaTrue)
+        init_butterfly( 2*n, U, V );
+
+    // U1, V1 are the outer level (order n); U2, V2 the inner level,
+    // two butterflies of order n/2.
+    const float *U1 = U, *U2 = U + n;
+    const float *V1 = V, *V2 = V + n;
+    magma_int_t q = n/4;
+
+    /* A = U1^T U2^T A V2 V1, one 4x4 block of elements at a time */
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t j = 0; j < q; ++j) {
+        float v1[4], v2[4], a[4][4];
+        for (magma_int_t c = 0; c < 4; ++c) {
+            v1[c] = V1[j + c*q];
+            v2[c] = V2[j + c*q];
+        }
+        for (magma_int_t i = 0; i < q; ++i) {
+            float u1[4], u2[4];
+            for (magma_int_t r = 0; r < 4; ++r) {
+                u1[r] = U1[i + r*q];
+                u2[r] = U2[i + r*q];
+                for (magma_int_t c = 0; c < 4; ++c) {
+                    a[r][c] = *A(i + r*q, j + c*q);
+                }
+            }
+            // inner level: butterflies of order n/2 on each quadrant
+            for (magma_int_t r = 0; r < 4; r += 2) {
+                for (magma_int_t c = 0; c < 4; c += 2) {
+                    elementary_butterfly( a[r][c],   a[r][c+1],
+                                          a[r+1][c], a[r+1][c+1],
+                                          u2[r], u2[r+1], v2[c], v2[c+1] );
+                }
+            }
+            // outer level: butterfly of order n
+            for (magma_int_t r = 0; r < 2; ++r) {
+                for (magma_int_t c = 0; c < 2; ++c) {
+                    elementary_butterfly( a[r][c],   a[r][c+2],
+                                          a[r+2][c], a[r+2][c+2],
+                                          u1[r], u1[r+2], v1[c], v1[c+2] );
+                }
+            }
+            for (magma_int_t r = 0; r < 4; ++r) {
+                for (magma_int_t c = 0; c < 4; ++c) {
+                    *A(i + r*q, j + c*q) = a[r][c];
+                }
+            }
+        }
+    }
+
+    /* B = U1^T U2^T B */
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t j = 0; j < nrhs; ++j) {
+        for (magma_int_t i = 0; i < q; ++i) {
+            float b[4], a1, a2;
+            for (magma_int_t r = 0; r < 4; ++r) {
+                b[r] = *B(i + r*q, j);
+            }
+            for (magma_int_t r = 0; r < 4; r += 2) {
+                a1 = b[r] + b[r+1];
+                a2 = b[r] - b[r+1];
+                b[r]   = U2[i + r*q]     * a1;
+                b[r+1] = U2[i + (r+1)*q] * a2;
+            }
+            for (magma_int_t r = 0; r < 2; ++r) {
+                a1 = b[r] + b[r+2];
+                a2 = b[r] - b[r+2];
+                b[r]   = U1[i + r*q]     * a1;
+                b[r+2] = U1[i + (r+2)*q] * a2;
+            }
+            for (magma_int_t r = 0; r < 4; ++r) {
+                *B(i + r*q, j) = b[r];
+            }
+        }
+    }
+
+    return *info;
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SPRBT_MV_CPU computes B = V * B, on the CPU host, to recover the solution
+    of A * X = B from the solution of the system randomized by
+    magma_sgerbt_cpu. This is the host version of magmablas_sprbt_mv.
+
+    Arguments
+    ---------
+    @param[in]
+    n       INTEGER
+            The number of rows of B.  n >= 0, and n must be a multiple of 4.
+
+    @param[in]
+    nrhs    INTEGER
+            The number of columns of B.  nrhs >= 0.
+
+    @param[in]
+    V       REAL array, dimension (2,n)
+            The random butterfly matrix V, as returned by magma_sgerbt_cpu.
+
+    @param[in,out]
+    B       REAL array, dimension (LDB,nrhs)
+            On entry, the solution Y of the randomized system.
+            On exit, V * Y.
+
+    @param[in]
+    ldb     INTEGER
+            The leading dimension of the array B.  LDB >= max(1,n).
+
+    @ingroup magma_gerbt
+*******************************************************************************/
+extern "C" void
+magma_sprbt_mv_cpu(
+    magma_int_t n, magma_int_t nrhs,
+    const float *V,
+    float *B, magma_int_t ldb )
+{
+    magma_int_t info = 0;
+    if (n < 0 || n % 4 != 0)
+        info = -1;
+    else if (nrhs < 0)
+        info = -2;
+    else if (ldb < max(1,n))
+        info = -5;
+
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    const float *V1 = V, *V2 = V + n;
+    magma_int_t q = n/4;
+
+    /* B = V2 V1 B */
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t j = 0; j < nrhs; ++j) {
+        for (magma_int_t i = 0; i < q; ++i) {
+            float b[4], a1, a2;
+            for (magma_int_t r = 0; r < 4; ++r) {
+                b[r] = *B(i + r*q, j);
+            }
+            for (magma_int_t r = 0; r < 2; ++r) {
+                a1 = V1[i + r*q]     * b[r];
+                a2 = V1[i + (r+2)*q] * b[r+2];
+                b[r]   = a1 + a2;
+                b[r+2] = a1 - a2;
+            }
+            for (magma_int_t r = 0; r < 4; r += 2) {
+                a1 = V2[i + r*q]     * b[r];
+                a2 = V2[i + (r+1)*q] * b[r+1];
+                b[r]   = a1 + a2;
+                b[r+1] = a1 - a2;
+            }
+            for (magma_int_t r = 0; r < 4; ++r) {
+                *B(i + r*q, j) = b[r];
+            }
+        }
+    }
+}
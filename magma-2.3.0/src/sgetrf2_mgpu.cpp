@@ -11,6 +11,7 @@
 #include "magma_internal.h"
 
 #include "trace.h"
+#include "roofline.h"
 #include "magma_timer.h"
 //#include "../testing/flops.h"
 
@@ -174,11 +175,16 @@ magma_sgetrf2_mgpu(
     nb0 = min(mindim, nb);
     magma_setdevice(0);
     trace_gpu_start( 0, 1, "comm", "get" );
+    roofline_start( "panel transpose", 0,
+                    sizeof(float) * roofline_copy_elems( nb0, m ), queues[0][1] );
     magmablas_stranspose( nb0, m, dAT(0,0,0), lddat, d_lAP[0], maxm, queues[0][1] );
+    roofline_end();
+    roofline_copy_start( "getmatrix panel", sizeof(float) * m*nb0, queues[0][1] );
     magma_sgetmatrix_async( m, nb0,
                             d_lAP[0], maxm,
                             W(0),     ldw, 
                             queues[0][1] );
+    roofline_end();
     trace_gpu_end( 0, 1 );
 
     /* ---------------------------------------------------------------------- */
@@ -201,7 +207,10 @@ magma_sgetrf2_mgpu(
         
         /* j-th panel factorization */
         trace_cpu_start( 0, "getrf", "getrf" );
+        roofline_start( "panel getrf", FLOPS_SGETRF( rows, nb ),
+                        sizeof(float) * roofline_panel_elems( rows, nb ), NULL );
         lapackf77_sgetrf( &rows, &nb, W(j), &ldw, ipiv+j*nb, &iinfo);
+        roofline_end();
         if ( (*info == 0) && (iinfo > 0) ) {
             *info = iinfo + j*nb;
         }
@@ -212,10 +221,12 @@ magma_sgetrf2_mgpu(
         for( dd=0; dd < ngpu; dd++ ) {
             magma_setdevice(d);
             trace_gpu_start( 0, 1, "comm", "set" );
+            roofline_copy_start( "setmatrix panel", sizeof(float) * rows*nb, queues[d][1] );
             magma_ssetmatrix_async( rows, nb,
                                     W(j),     ldw,
                                     &d_lAP[d][(j%h)*nb*maxm], cols,
                                     queues[d][1] );
+            roofline_end();
             trace_gpu_end( 0, 1 );
             d = (d+1) % ngpu;
         }
@@ -231,8 +242,11 @@ magma_sgetrf2_mgpu(
                     ipiv[i] += j*nb;
                 }
             }
+            roofline_start( "laswp", 0,
+                            sizeof(float) * roofline_laswp_elems( lddat, j*nb + 1, j*nb + nb ), queues[d][0] );
             magmablas_slaswp( lddat, dAT(d,0,0), lddat, j*nb + 1, j*nb + nb, ipiv, 1, 
                               queues[d][0] );
+            roofline_end();
             trace_gpu_end( d, 1 );
             d = (d+1) % ngpu;
         }
@@ -275,8 +289,11 @@ magma_sgetrf2_mgpu(
                 magma_queue_sync(queues[d][0]);
                 trace_gpu_start( d, 1, "gemm", "gemm" );
                 /* transpose panel on GPU */
+                roofline_start( "panel transpose", 0,
+                                sizeof(float) * roofline_copy_elems( rows, nb ), queue );
                 magmablas_stranspose( rows, nb, &d_lAP[d][(j%h)*nb*maxm], cols, panel_local[d], ldpan[d], 
                                       queue );
+                roofline_end();
                 /* sync for remaining update */
                 magma_queue_sync(queues[d][1]);
             } else {
@@ -288,22 +305,31 @@ magma_sgetrf2_mgpu(
                 magma_queue_sync(queues[d][1]);
                 trace_gpu_start( d, 0, "gemm", "gemm" );
                 /* transpose panel on GPU */
+                roofline_start( "panel transpose", 0,
+                                sizeof(float) * roofline_copy_elems( rows, nb ), queue );
                 magmablas_stranspose( rows, nb, &d_lAP[d][(j%h)*nb*maxm], cols, panel_local[d], ldpan[d], 
                                       queue );
+                roofline_end();
             }
             
             /* gpu updating the trailing matrix */
+            roofline_start( "update trsm", FLOPS_STRSM( MagmaRight, nb1, nb ),
+                            sizeof(float) * roofline_trsm_elems( nb1, nb, nb ), queue );
             magma_strsm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaUnit,
                          nb1, nb, c_one,
                          panel_local[d],       ldpan[d],
                          dAT(d, j, j_local2), lddat,
                          queue );
+            roofline_end();
+            roofline_start( "update gemm", FLOPS_SGEMM( nb1, m-(j+1)*nb, nb ),
+                            sizeof(float) * roofline_gemm_elems( nb1, m-(j+1)*nb, nb ), queue );
             magma_sgemm( MagmaNoTrans, MagmaNoTrans,
                          nb1, m-(j+1)*nb, nb,
                          c_neg_one, dAT(d, j,   j_local2),         lddat,
                                     &(panel_local[d][nb*ldpan[d]]), ldpan[d],
                          c_one,     dAT(d, j+1, j_local2),         lddat,
                          queue );
+            roofline_end();
         
             if ( d == (j+1) % ngpu ) {
                 /* Set the local index where the current panel is */
@@ -317,15 +343,20 @@ magma_sgetrf2_mgpu(
                 if ( nb0 > 0 ) {
                     /* transpose the panel for sending it to cpu */
                     trace_gpu_start( d, 1, "comm", "get" );
+                    roofline_start( "panel transpose", 0,
+                                    sizeof(float) * roofline_copy_elems( nb0, m-(j+1)*nb ), queue );
                     magmablas_stranspose( nb0, m-(j+1)*nb, dAT(d,loff,j_local_lookahead), lddat, 
                                           &d_lAP[d][((j+1)%h)*nb*maxm], ldda,
                                           queue );
+                    roofline_end();
              
                     /* send the panel to cpu */
+                    roofline_copy_start( "getmatrix panel", sizeof(float) * cols_lookahead*nb0, queues[d][1] );
                     magma_sgetmatrix_async( cols_lookahead, nb0,
                                             &d_lAP[d][((j+1)%h)*nb*maxm], ldda,
                                             W(j+1), ldw, 
                                             queues[d][1] );
+                    roofline_end();
 
                     trace_gpu_end( d, 1 );
                 }
@@ -345,17 +376,23 @@ magma_sgetrf2_mgpu(
             magma_setdevice(d);
             trace_gpu_start( d, 0, "gemm", "gemm" );
 
+            roofline_start( "update trsm", FLOPS_STRSM( MagmaRight, n_local[d]-(j_local_rest+1)*nb, nb ),
+                            sizeof(float) * roofline_trsm_elems( n_local[d]-(j_local_rest+1)*nb, nb, nb ), queues[d][0] );
             magma_strsm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaUnit,
                          n_local[d] - (j_local_rest+1)*nb, nb,
                          c_one, panel_local[d],       ldpan[d],
                                 dAT(d,j,j_local_rest+1),  lddat,
                         queues[d][0] );
+            roofline_end();
+            roofline_start( "update gemm", FLOPS_SGEMM( n_local[d]-(j_local_rest+1)*nb, rows_rest, nb ),
+                            sizeof(float) * roofline_gemm_elems( n_local[d]-(j_local_rest+1)*nb, rows_rest, nb ), queues[d][0] );
             magma_sgemm( MagmaNoTrans, MagmaNoTrans,
                          n_local[d]-(j_local_rest+1)*nb, rows_rest, nb,
                          c_neg_one, dAT(d,j,j_local_rest+1),            lddat,
                                     &(panel_local[d][nb*ldpan[d]]), ldpan[d],
                          c_one,     dAT(d,j+1,  j_local_rest+1),        lddat,
                          queues[d][0] );
+            roofline_end();
             trace_gpu_end( d, 0 );
         }
     } /* end of for j=1..s */
@@ -379,7 +416,10 @@ magma_sgetrf2_mgpu(
         magma_queue_sync( queues[id][1] );
     
         /* factor on cpu */
+        roofline_start( "panel getrf", FLOPS_SGETRF( rows, nb0 ),
+                        sizeof(float) * roofline_panel_elems( rows, nb0 ), NULL );
         lapackf77_sgetrf( &rows, &nb0, W(s), &ldw, ipiv+s*nb, &iinfo);
+        roofline_end();
         if ( (*info == 0) && (iinfo > 0) )
             *info = iinfo + s*nb;
         
@@ -390,10 +430,12 @@ magma_sgetrf2_mgpu(
             if ( d < id ) j_local2 ++;
             
             if ( d == id || n_local[d] > j_local2*nb ) {
+                roofline_copy_start( "setmatrix panel", sizeof(float) * rows*nb0, queues[d][1] );
                 magma_ssetmatrix_async( rows, nb0,
                                         W(s), ldw,
                                         &d_lAP[d][(s%h)*nb*maxm], cols, 
                                         queues[d][1] );
+                roofline_end();
             }
         }
         
@@ -404,8 +446,11 @@ magma_sgetrf2_mgpu(
                     ipiv[i] += s*nb;
                 }
             }
+            roofline_start( "laswp", 0,
+                            sizeof(float) * roofline_laswp_elems( lddat, s*nb + 1, s*nb + nb0 ), queues[d][0] );
             magmablas_slaswp( lddat, dAT(d,0,0), lddat, s*nb + 1, s*nb + nb0, ipiv, 1, 
                               queues[d][0] );
+            roofline_end();
         }
         
         for( d=0; d < ngpu; d++ ) {
@@ -423,15 +468,21 @@ magma_sgetrf2_mgpu(
                 /* next column */
                 nb1 = n_local[d] - j_local*nb-nb0;
                 
+                roofline_start( "panel transpose", 0,
+                                sizeof(float) * roofline_copy_elems( rows, nb0 ), queues[d][1] );
                 magmablas_stranspose( rows, nb0, &d_lAP[d][(s%h)*nb*maxm], cols, panel_local[d], lddat,
                                       queues[d][1] );
+                roofline_end();
                 
                 if ( nb1 > 0 ) {
+                    roofline_start( "update trsm", FLOPS_STRSM( MagmaRight, nb1, nb0 ),
+                                    sizeof(float) * roofline_trsm_elems( nb1, nb0, nb0 ), queues[d][1] );
                     magma_strsm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaUnit,
                                  nb1, nb0, c_one,
                                  panel_local[d],        lddat,
                                  dAT(d,s,j_local)+nb0, lddat,
                                  queues[d][1] );
+                    roofline_end();
                 }
             } else if ( n_local[d] > j_local2*nb ) {
                 /* the panel belongs to another gpu */
@@ -440,13 +491,19 @@ magma_sgetrf2_mgpu(
                 /* next column */
                 nb1 = n_local[d] - j_local2*nb;
                 
+                roofline_start( "panel transpose", 0,
+                                sizeof(float) * roofline_copy_elems( rows, nb0 ), queues[d][1] );
                 magmablas_stranspose( rows, nb0, &d_lAP[d][(s%h)*nb*maxm], cols, panel_local[d], nb, 
                                       queues[d][1] );
+                roofline_end();
+                roofline_start( "update trsm", FLOPS_STRSM( MagmaRight, nb1, nb0 ),
+                                sizeof(float) * roofline_trsm_elems( nb1, nb0, nb0 ), queues[d][1] );
                 magma_strsm( MagmaRight, MagmaUpper, MagmaNoTrans, MagmaUnit,
                              nb1, nb0, c_one,
                              panel_local[d],     nb,
                              dAT(d,s,j_local2), lddat,
                              queues[d][1] );
+                roofline_end();
             }
         }
     } /* if ( nb0 > 0 ) */
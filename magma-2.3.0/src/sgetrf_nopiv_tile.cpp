@@ -0,0 +1,159 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgetrf_nopiv_tile.cpp, normal z -> s, Sat Oct 17 06:21:21 2026
+*/
+#include "task_scheduler.hpp"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SGETRF_NOPIV_TILE computes an LU factorization of a general M-by-N
+    matrix A stored in tile-major layout, without pivoting.
+
+    The factorization has the form
+        A = L * U
+    where L is lower triangular with unit diagonal elements (lower
+    trapezoidal if m > n), and U is upper triangular (upper trapezoidal
+    if m < n).
+
+    This is a tile algorithm, computed on the CPU host. Without pivoting,
+    the panel is no longer a synchronization point: getrf of the diagonal
+    tile, trsm of each tile in its row and column, and gemm of each tile of
+    the trailing matrix are all separate tasks, which magma_task_scheduler
+    executes as soon as the tiles they depend on are ready.
+    This is stable only for matrices that do not need pivoting, such as
+    diagonally dominant ones, or after a Random Butterfly Transformation
+    (see magma_sgesv_rbt_cpu).
+    Use magma_sge2tile and magma_stile2ge to convert to and from LAPACK layout.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size.  NB >= 1.
+
+    @param[in,out]
+    A       REAL array, dimension (MT*NT*NB*NB), where MT = ceil(M/NB)
+            and NT = ceil(N/NB).
+            On entry, the M-by-N matrix to be factored, in tile-major layout
+            (see magma_sge2tile).
+            On exit, the factors L and U from the factorization
+            A = L*U; the unit diagonal elements of L are not stored.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+      -     > 0:  if INFO = i, U(i,i) is exactly zero. The factorization
+                  has been completed, but the factor U is exactly
+                  singular, and division by zero will occur if it is used
+                  to solve a system of equations.
+
+    @ingroup magma_getrf_nopiv
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sgetrf_nopiv_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    float *A,
+    magma_int_t *info )
+{
+    #define A(i_, j_)  (A + ((i_) + (j_)*mt)*nb*nb)
+
+    /* Constants */
+    const float c_one     = MAGMA_S_ONE;
+    const float c_neg_one = MAGMA_S_NEG_ONE;
+
+    /* Check arguments */
+    *info = 0;
+    if (m < 0) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (nb < 1) {
+        *info = -3;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (m == 0 || n == 0)
+        return *info;
+
+    magma_int_t mt = magma_ceildiv( m, nb );
+    magma_int_t nt = magma_ceildiv( n, nb );
+
+    // tasks run single-threaded BLAS
+    magma_int_t lapack_threads = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+
+    magma_task_scheduler dag;
+    dag.launch( magma_get_parallel_numthreads() );
+
+    for (magma_int_t k = 0; k < min( mt, nt ); ++k) {
+        magma_int_t mb = min( nb, m - k*nb );  // rows in A(k,k)
+        magma_int_t kb = min( nb, n - k*nb );  // cols in A(k,k)
+        magma_int_t ib = min( mb, kb );
+
+        // factor diagonal tile, A(k,k) = L(k,k) U(k,k)
+        dag.insert( { magma_task_write( A(k,k) ) }, [=] {
+            magma_int_t iinfo;
+            magma_sgetrf_nopiv( mb, kb, A(k,k), nb, &iinfo );
+            if (iinfo > 0 && *info == 0) {
+                *info = iinfo + k*nb;
+            }
+        });
+
+        // A(k,j) = L(k,k)^{-1} A(k,j)
+        for (magma_int_t j = k+1; j < nt; ++j) {
+            magma_int_t jb = min( nb, n - j*nb );
+            dag.insert( { magma_task_read( A(k,k) ), magma_task_write( A(k,j) ) }, [=] {
+                blasf77_strsm( MagmaLeftStr, MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr,
+                               &ib, &jb, &c_one, A(k,k), &nb, A(k,j), &nb );
+            });
+        }
+
+        // A(i,k) = A(i,k) U(k,k)^{-1}
+        for (magma_int_t i = k+1; i < mt; ++i) {
+            magma_int_t mi = min( nb, m - i*nb );
+            dag.insert( { magma_task_read( A(k,k) ), magma_task_write( A(i,k) ) }, [=] {
+                blasf77_strsm( MagmaRightStr, MagmaUpperStr, MagmaNoTransStr, MagmaNonUnitStr,
+                               &mi, &ib, &c_one, A(k,k), &nb, A(i,k), &nb );
+            });
+        }
+
+        // update trailing matrix, A(i,j) -= A(i,k) A(k,j)
+        for (magma_int_t j = k+1; j < nt; ++j) {
+            magma_int_t jb = min( nb, n - j*nb );
+            for (magma_int_t i = k+1; i < mt; ++i) {
+                magma_int_t mi = min( nb, m - i*nb );
+                dag.insert( { magma_task_read( A(i,k) ), magma_task_read( A(k,j) ),
+                              magma_task_write( A(i,j) ) }, [=] {
+                    blasf77_sgemm( MagmaNoTransStr, MagmaNoTransStr, &mi, &jb, &kb,
+                                   &c_neg_one, A(i,k), &nb, A(k,j), &nb,
+                                   &c_one,     A(i,j), &nb );
+                });
+            }
+        }
+    }
+
+    dag.sync();
+    dag.quit();
+    magma_set_lapack_numthreads( lapack_threads );
+
+    return *info;
+} /* magma_sgetrf_nopiv_tile */
@@ -0,0 +1,221 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgetrf_tile.cpp, normal z -> s, Sat Oct 17 06:16:06 2026
+*/
+#include "task_scheduler.hpp"
+#include "laswp_host.hpp"
+
+/******************************************************************************/
+// offset of global row r in a tile column of tile-major A
+struct magma_tile_row_offset
+{
+    magma_int_t nb;
+    magma_int_t operator() ( magma_int_t r ) const
+        { return (r/nb)*nb*nb + r % nb; }
+};
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SGETRF_TILE computes an LU factorization of a general M-by-N matrix A
+    stored in tile-major layout, using partial pivoting with row interchanges.
+
+    The factorization has the form
+        A = P * L * U
+    where P is a permutation matrix, L is lower triangular with unit
+    diagonal elements (lower trapezoidal if m > n), and U is upper
+    triangular (upper trapezoidal if m < n).
+
+    This is a tile algorithm, computed on the CPU host. The pivot search is
+    over the whole tile column: each panel task factors one column of tiles,
+    so the result is the same as LAPACK's partial pivoting. Row interchanges
+    plus trsm for each tile column, and gemm for each tile of the trailing
+    matrix, are separate tasks. magma_task_scheduler executes tasks as soon as
+    the tiles they depend on are ready, so panels are factored while earlier
+    trailing updates proceed.
+    Use magma_sge2tile and magma_stile2ge to convert to and from LAPACK layout.
+
+    Arguments
+    ---------
+    @param[in]
+    m       INTEGER
+            The number of rows of the matrix A.  M >= 0.
+
+    @param[in]
+    n       INTEGER
+            The number of columns of the matrix A.  N >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size.  NB >= 1.
+
+    @param[in,out]
+    A       REAL array, dimension (MT*NT*NB*NB), where MT = ceil(M/NB)
+            and NT = ceil(N/NB).
+            On entry, the M-by-N matrix to be factored, in tile-major layout
+            (see magma_sge2tile).
+            On exit, the factors L and U from the factorization
+            A = P*L*U; the unit diagonal elements of L are not stored.
+
+    @param[out]
+    ipiv    INTEGER array, dimension (min(M,N))
+            The pivot indices; for 1 <= i <= min(M,N), row i of the
+            matrix was interchanged with row IPIV(i).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+      -     > 0:  if INFO = i, U(i,i) is exactly zero. The factorization
+                  has been completed, but the factor U is exactly
+                  singular, and division by zero will occur if it is used
+                  to solve a system of equations.
+
+    @ingroup magma_getrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sgetrf_tile(
+    magma_int_t m, magma_int_t n, magma_int_t nb,
+    float *A,
+    magma_int_t *ipiv,
+    magma_int_t *info )
+{
+    #define A(i_, j_)  (A + ((i_) + (j_)*mt)*nb*nb)
+
+    /* Constants */
+    const float c_one     = MAGMA_S_ONE;
+    const float c_neg_one = MAGMA_S_NEG_ONE;
+
+    /* Check arguments */
+    *info = 0;
+    if (m < 0) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (nb < 1) {
+        *info = -3;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (m == 0 || n == 0)
+        return *info;
+
+    magma_int_t mt = magma_ceildiv( m, nb );
+    magma_int_t nt = magma_ceildiv( n, nb );
+
+    // column-major workspace for panels; panel tasks are serialized
+    // by their dependencies, so one suffices
+    float *work;
+    if (MAGMA_SUCCESS != magma_smalloc_cpu( &work, m*nb )) {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+
+    // tasks run single-threaded BLAS
+    magma_int_t lapack_threads = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+
+    magma_task_scheduler dag;
+    dag.launch( magma_get_parallel_numthreads() );
+
+    for (magma_int_t k = 0; k < min( mt, nt ); ++k) {
+        magma_int_t mk   = m - k*nb;            // rows in panel
+        magma_int_t kb   = min( nb, n - k*nb );  // cols in panel
+        magma_int_t npiv = min( mk, kb );
+        magma_int_t *kpiv = ipiv + k*nb;         // also identifies pivots for dependencies
+
+        // factor panel A(k:mt, k) in work, with pivoting over the whole column
+        std::vector< magma_task_access > access;
+        for (magma_int_t i = k; i < mt; ++i) {
+            access.push_back( magma_task_write( A(i,k) ));
+        }
+        access.push_back( magma_task_write( kpiv ));
+        dag.insert( access, [=] {
+            for (magma_int_t i = k; i < mt; ++i) {
+                magma_int_t ib = min( nb, m - i*nb );
+                lapackf77_slacpy( MagmaFullStr, &ib, &kb, A(i,k), &nb,
+                                  work + (i-k)*nb, &mk );
+            }
+            magma_int_t iinfo;
+            lapackf77_sgetrf( &mk, &kb, work, &mk, kpiv, &iinfo );
+            if (iinfo > 0 && *info == 0) {
+                *info = iinfo + k*nb;
+            }
+            for (magma_int_t ii = 0; ii < npiv; ++ii) {
+                kpiv[ii] += k*nb;
+            }
+            for (magma_int_t i = k; i < mt; ++i) {
+                magma_int_t ib = min( nb, m - i*nb );
+                lapackf77_slacpy( MagmaFullStr, &ib, &kb, work + (i-k)*nb, &mk,
+                                  A(i,k), &nb );
+            }
+        });
+
+        // apply interchanges to L, to the left
+        for (magma_int_t j = 0; j < k; ++j) {
+            access.clear();
+            access.push_back( magma_task_read( kpiv ));
+            for (magma_int_t i = k; i < mt; ++i) {
+                access.push_back( magma_task_write( A(i,j) ));
+            }
+            dag.insert( access, [=] {
+                magma_laswp_plan plan( k*nb, npiv, kpiv, 1 );
+                std::vector< magma_int_t > off = plan.offsets( magma_tile_row_offset{ nb } );
+                magma_laswp_host_cols_block( plan, off.data(), nb, A(0,j), nb );
+            });
+        }
+
+        // apply interchanges to the right, and A(k,j) = L(k,k)^{-1} A(k,j)
+        for (magma_int_t j = k+1; j < nt; ++j) {
+            magma_int_t jb = min( nb, n - j*nb );
+            access.clear();
+            access.push_back( magma_task_read( kpiv ));
+            access.push_back( magma_task_read( A(k,k) ));
+            for (magma_int_t i = k; i < mt; ++i) {
+                access.push_back( magma_task_write( A(i,j) ));
+            }
+            dag.insert( access, [=] {
+                magma_laswp_plan plan( k*nb, npiv, kpiv, 1 );
+                magma_laswp_trsm_host_cols(
+                    plan, jb, A(0,j), nb, magma_tile_row_offset{ nb },
+                    [&]( magma_int_t j0, magma_int_t nj ) {
+                        blasf77_strsm( MagmaLeftStr, MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr,
+                                       &npiv, &nj, &c_one, A(k,k), &nb, A(k,j) + j0*nb, &nb );
+                    });
+            });
+        }
+
+        // update trailing matrix, A(i,j) -= A(i,k) A(k,j)
+        for (magma_int_t j = k+1; j < nt; ++j) {
+            magma_int_t jb = min( nb, n - j*nb );
+            for (magma_int_t i = k+1; i < mt; ++i) {
+                magma_int_t ib = min( nb, m - i*nb );
+                dag.insert( { magma_task_read( A(i,k) ), magma_task_read( A(k,j) ),
+                              magma_task_write( A(i,j) ) }, [=] {
+                    blasf77_sgemm( MagmaNoTransStr, MagmaNoTransStr, &ib, &jb, &kb,
+                                   &c_neg_one, A(i,k), &nb, A(k,j), &nb,
+                                   &c_one,     A(i,j), &nb );
+                });
+            }
+        }
+    }
+
+    dag.sync();
+    dag.quit();
+    magma_set_lapack_numthreads( lapack_threads );
+
+    magma_free_cpu( work );
+
+    return *info;
+} /* magma_sgetrf_tile */
@@ -0,0 +1,149 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zgetrs_nopiv_tile.cpp, normal z -> s, Sat Oct 17 06:21:21 2026
+*/
+#include "task_scheduler.hpp"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SGETRS_NOPIV_TILE solves a system of linear equations
+        A * X = B
+    with a general N-by-N matrix A using the LU factorization computed by
+    SGETRF_NOPIV_TILE, on the CPU host.
+
+    The factors are in tile-major layout, while B is in LAPACK layout.
+    B is divided into NB-by-NB blocks, and each trsm on a diagonal tile and
+    gemm on an off-diagonal tile is a task in magma_task_scheduler, so
+    several right hand sides, or several block rows, are solved in parallel.
+
+    Arguments
+    ---------
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    nrhs    INTEGER
+            The number of right hand sides, i.e., the number of columns
+            of the matrix B.  NRHS >= 0.
+
+    @param[in]
+    nb      INTEGER
+            The tile size.  NB >= 1.
+
+    @param[in]
+    A       REAL array, dimension (NT*NT*NB*NB), where NT = ceil(N/NB).
+            The factors L and U from the factorization A = L*U, in
+            tile-major layout, as computed by SGETRF_NOPIV_TILE.
+
+    @param[in,out]
+    B       REAL array, dimension (LDB,NRHS)
+            On entry, the right hand side matrix B.
+            On exit, the solution matrix X.
+
+    @param[in]
+    ldb     INTEGER
+            The leading dimension of the array B.  LDB >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+
+    @ingroup magma_getrs_nopiv
+*******************************************************************************/
+extern "C" magma_int_t
+magma_sgetrs_nopiv_tile(
+    magma_int_t n, magma_int_t nrhs, magma_int_t nb,
+    const float *A,
+    float *B, magma_int_t ldb,
+    magma_int_t *info )
+{
+    #define A(i_, j_)  (A + ((i_) + (j_)*nt)*nb*nb)
+    #define B(i_, j_)  (B + (i_)*nb + (j_)*nb*ldb)
+
+    /* Constants */
+    const float c_one     = MAGMA_S_ONE;
+    const float c_neg_one = MAGMA_S_NEG_ONE;
+
+    /* Check arguments */
+    *info = 0;
+    if (n < 0) {
+        *info = -1;
+    } else if (nrhs < 0) {
+        *info = -2;
+    } else if (nb < 1) {
+        *info = -3;
+    } else if (ldb < max(1,n)) {
+        *info = -6;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (n == 0 || nrhs == 0)
+        return *info;
+
+    magma_int_t nt = magma_ceildiv( n,    nb );
+    magma_int_t jt = magma_ceildiv( nrhs, nb );
+
+    // tasks run single-threaded BLAS
+    magma_int_t lapack_threads = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+
+    magma_task_scheduler dag;
+    dag.launch( magma_get_parallel_numthreads() );
+
+    for (magma_int_t j = 0; j < jt; ++j) {
+        magma_int_t jb = min( nb, nrhs - j*nb );
+
+        // solve L Y = B
+        for (magma_int_t k = 0; k < nt; ++k) {
+            magma_int_t kb = min( nb, n - k*nb );
+            dag.insert( { magma_task_read( A(k,k) ), magma_task_write( B(k,j) ) }, [=] {
+                blasf77_strsm( MagmaLeftStr, MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr,
+                               &kb, &jb, &c_one, A(k,k), &nb, B(k,j), &ldb );
+            });
+            for (magma_int_t i = k+1; i < nt; ++i) {
+                magma_int_t ib = min( nb, n - i*nb );
+                dag.insert( { magma_task_read( A(i,k) ), magma_task_read( B(k,j) ),
+                              magma_task_write( B(i,j) ) }, [=] {
+                    blasf77_sgemm( MagmaNoTransStr, MagmaNoTransStr, &ib, &jb, &kb,
+                                   &c_neg_one, A(i,k), &nb, B(k,j), &ldb,
+                                   &c_one,     B(i,j), &ldb );
+                });
+            }
+        }
+
+        // solve U X = Y
+        for (magma_int_t k = nt-1; k >= 0; --k) {
+            magma_int_t kb = min( nb, n - k*nb );
+            dag.insert( { magma_task_read( A(k,k) ), magma_task_write( B(k,j) ) }, [=] {
+                blasf77_strsm( MagmaLeftStr, MagmaUpperStr, MagmaNoTransStr, MagmaNonUnitStr,
+                               &kb, &jb, &c_one, A(k,k), &nb, B(k,j), &ldb );
+            });
+            for (magma_int_t i = 0; i < k; ++i) {
+                dag.insert( { magma_task_read( A(i,k) ), magma_task_read( B(k,j) ),
+                              magma_task_write( B(i,j) ) }, [=] {
+                    blasf77_sgemm( MagmaNoTransStr, MagmaNoTransStr, &nb, &jb, &kb,
+                                   &c_neg_one, A(i,k), &nb, B(k,j), &ldb,
+                                   &c_one,     B(i,j), &ldb );
+                });
+            }
+        }
+    }
+
+    dag.sync();
+    dag.quit();
+    magma_set_lapack_numthreads( lapack_threads );
+
+    return *info;
+} /* magma_sgetrs_nopiv_tile */
@@ -10,6 +10,7 @@
 */
 #include "magma_internal.h"
 #include "trace.h"
+#include "roofline.h"
 
 #define PRECISION_s
 
@@ -204,19 +205,7 @@ magma_spotrf3_mgpu(
     /* initialization */
     for( d=0; d < ngpu; d++ ) {
         /* local-n and local-ld */
-        if (upper) {
-            n_local[d] = (n/(nb*ngpu))*nb;
-            if (d < (n/nb)%ngpu)
-                n_local[d] += nb;
-            else if (d == (n/nb)%ngpu)
-                n_local[d] += n%nb;
-        } else {
-            n_local[d] = (m/(nb*ngpu))*nb;
-            if (d < (m/nb)%ngpu)
-                n_local[d] += nb;
-            else if (d == (m/nb)%ngpu)
-                n_local[d] += m%nb;
-        }
+        n_local[d] = magma_bcyclic_numroc( (upper ? n : m), nb, d, ngpu );
     }
 
     /* == initialize the trace */
@@ -240,19 +229,24 @@ magma_spotrf3_mgpu(
             magma_setdevice(id);
             if ( j > 0 ) {
                 trace_gpu_start( id, stream1, "syrk", "syrk" );
+                roofline_start( "update syrk", FLOPS_SSYRK( j, jb ),
+                                sizeof(float) * roofline_syrk_elems( jb, j ), queues[id][stream1] );
                 magma_ssyrk(MagmaUpper, MagmaConjTrans, jb, j,
                             d_neg_one, dlA(id, 0, nb*j_local), ldda,
                             d_one,     dlA(id, j, nb*j_local), ldda,
                             queues[id][stream1]);
+                roofline_end();
                 trace_gpu_end( id, stream1 );
             }
             
             /* send the diagonal to cpu on stream1 */
             trace_gpu_start( id, stream1, "comm", "D to CPU" );
+            roofline_copy_start( "getmatrix diag", sizeof(float) * jb*jb, queues[id][stream1] );
             magma_sgetmatrix_async( jb, jb,
                                     dlA(id, j, nb*j_local), ldda,
                                     Aup(j,j),               lda,
                                     queues[id][stream1] );
+            roofline_end();
             trace_gpu_end( id, stream1 );
 
             /* update off-diagonal blocks in the panel */
@@ -277,12 +271,15 @@ magma_spotrf3_mgpu(
                             magma_queue_wait_event( queues[d][stream2], events[d][0] ); // rows arrived at gpu
                         }
                         trace_gpu_start( d, stream2, "gemm", "gemm" );
+                        roofline_start( "update gemm", FLOPS_SGEMM( jb, n_local[d]-nb0, j ),
+                                        sizeof(float) * roofline_gemm_elems( jb, n_local[d]-nb0, j ), queues[d][stream2] );
                         magma_sgemm(MagmaConjTrans, MagmaNoTrans,
                                     jb, n_local[d]-nb0, j,
                                     c_neg_one, dlpanel,        ldpanel,
                                                dlA(d, 0, nb0), ldda,
                                     c_one,     dlA(d, j, nb0), ldda,
                                     queues[d][stream2]);
+                        roofline_end();
                         trace_gpu_end( d, stream2 );
                         magma_event_record( events[d][2], queues[d][stream2] );
                     }
@@ -294,7 +291,10 @@ magma_spotrf3_mgpu(
             magma_setdevice(id);
             magma_queue_sync( queues[id][stream1] );
             trace_cpu_start( 0, "getrf", "getrf" );
+            roofline_start( "panel potrf", FLOPS_SPOTRF( jb ),
+                            sizeof(float) * roofline_panel_elems( jb, jb ), NULL );
             lapackf77_spotrf(MagmaUpperStr, &jb, Aup(j,j), &lda, info);
+            roofline_end();
             trace_cpu_end( 0 );
             if (*info != 0) {
                 *info = *info + j;
@@ -314,10 +314,12 @@ magma_spotrf3_mgpu(
                     }
                     magma_setdevice(d);
                     trace_gpu_start( d, stream1, "comm", "comm" );
+                    roofline_copy_start( "setmatrix diag", sizeof(float) * jb*jb, queues[d][stream1] );
                     magma_ssetmatrix_async( jb, jb,
                                             Aup(j,j), lda,
                                             dlpanel,  ldpanel,
                                             queues[d][stream1] );
+                    roofline_end();
                     trace_gpu_end( d, stream1 );
                     magma_event_record( events[d][1], queues[d][stream1] );
                     d = (d+1)%ngpu;
@@ -325,10 +327,12 @@ magma_spotrf3_mgpu(
             } else {
                 magma_setdevice(id);
                 trace_gpu_start( id, stream1, "comm", "comm" );
+                roofline_copy_start( "setmatrix diag", sizeof(float) * jb*jb, queues[id][stream1] );
                 magma_ssetmatrix_async( jb, jb,
                                         Aup(j,j),               lda,
                                         dlA(id, j, nb*j_local), ldda,
                                         queues[id][stream1] );
+                roofline_end();
                 trace_gpu_end( id, stream1 );
             }
             
@@ -354,6 +358,8 @@ magma_spotrf3_mgpu(
                         nb0 = min(nb, nb2);
                         magma_queue_wait_event( queues[d][stream1], events[d][2] ); // wait for gemm update
                         trace_gpu_start( d, stream1, "trsm", "trsm" );
+                        roofline_start( "lookahead trsm", FLOPS_STRSM( MagmaLeft, jb, nb0 ),
+                                        sizeof(float) * roofline_trsm_elems( jb, nb0, jb ), queues[d][stream1] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(STRSM_WORK)
                             //magmablas_slaset( MagmaFull, trsm_nb, trsm_n, c_zero, c_zero, dinvA(d,0), trsm_nb );
                             //magmablas_slaset( MagmaFull, nb0,     jb,     c_zero, c_zero, dx(d,0), nb0 );
@@ -373,12 +379,15 @@ magma_spotrf3_mgpu(
                                          dlA(d, j, nb*j_local2), ldda,
                                          queues[d][stream1] );
                         #endif
+                        roofline_end();
                         magma_event_record( events[d][4], queues[d][stream1] );
                         trace_gpu_end( d, stream1 );
                     } else if ( nb2 > 0 ) {
                         /* update all the blocks on stream2 */
                         magma_queue_wait_event( queues[d][stream2], events[d][1] ); // wait for cholesky factor
                         trace_gpu_start( d, stream2, "trsm", "trsm" );
+                        roofline_start( "update trsm", FLOPS_STRSM( MagmaLeft, jb, nb2 ),
+                                        sizeof(float) * roofline_trsm_elems( jb, nb2, jb ), queues[d][stream2] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(STRSM_WORK)
                             //magmablas_slaset( MagmaFull, trsm_nb, trsm_n, c_zero, c_zero, dinvA(d,0), trsm_nb );
                             //magmablas_slaset( MagmaFull, nb2,     jb,     c_zero, c_zero, dx(d,0), nb2 );
@@ -398,6 +407,7 @@ magma_spotrf3_mgpu(
                                          dlA(d, j, nb*j_local2), ldda,
                                          queues[d][stream2] );
                         #endif
+                        roofline_end();
                         trace_gpu_end( d, stream2 );
                     }
                     d = (d+1)%ngpu;
@@ -420,10 +430,12 @@ magma_spotrf3_mgpu(
                     magma_queue_wait_event( queues[d][stream3], events[d][4] );
                 
                     trace_gpu_start( d, stream3, "comm", "row to CPU" );
+                    roofline_copy_start( "getmatrix row", sizeof(float) * (j+jb)*nb0, queues[d][stream3] );
                     magma_sgetmatrix_async( (j+jb), nb0,
                                             dlA(d, 0, nb*j_local2), ldda,
                                             Aup(0,j+jb),            lda,
                                             queues[d][stream3] );
+                    roofline_end();
                     trace_gpu_end( d, stream3 );
                     magma_event_record( events[d][3], queues[d][stream3] );
                     /* needed on pluto */
@@ -436,10 +448,12 @@ magma_spotrf3_mgpu(
                             magma_setdevice(d2);
                             trace_gpu_start( d2, stream3, "comm", "row to GPUs" );
                             magma_queue_wait_event( queues[d2][stream3], events[d][3] ); // rows arrived at cpu on stream3
+                            roofline_copy_start( "setmatrix row", sizeof(float) * (j+jb)*nb0, queues[d2][stream3] );
                             magma_ssetmatrix_async( j+jb, nb0,
                                                     Aup(0,j+jb),       lda,
                                                     dlP(d2,nb,0,buf2), lddp,
                                                     queues[d2][stream3] );
+                            roofline_end();
                             trace_gpu_end( d2, stream3 );
                             magma_event_record( events[d2][0], queues[d2][stream3] );
                         }
@@ -458,6 +472,8 @@ magma_spotrf3_mgpu(
                         }
                         magma_setdevice(d);
                         trace_gpu_start( d, stream2, "trsm", "trsm" );
+                        roofline_start( "update trsm", FLOPS_STRSM( MagmaLeft, jb, nb2 ),
+                                        sizeof(float) * roofline_trsm_elems( jb, nb2, jb ), queues[d][stream2] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(STRSM_WORK)
                             bool flag = 0;
                             if (flag == 0) {
@@ -482,6 +498,7 @@ magma_spotrf3_mgpu(
                                          dlA(d, j, nb*j_local2+nb0), ldda,
                                          queues[d][stream2] );
                         #endif
+                        roofline_end();
                         trace_gpu_end( d, stream2 );
                     }
                 }
@@ -504,17 +521,22 @@ magma_spotrf3_mgpu(
             /* Update the current diagonal block on stream1 */
             magma_setdevice(id);
             if ( j > 0 ) {
+                roofline_start( "update syrk", FLOPS_SSYRK( j, jb ),
+                                sizeof(float) * roofline_syrk_elems( jb, j ), queues[id][stream1] );
                 magma_ssyrk( MagmaLower, MagmaNoTrans, jb, j,
                              d_neg_one, dlA(id, nb*j_local, 0), ldda,
                              d_one,     dlA(id, nb*j_local, j), ldda,
                              queues[id][stream1] );
+                roofline_end();
             }
 
             /* send the diagonal to cpu on stream1 */
+            roofline_copy_start( "getmatrix diag", sizeof(float) * jb*jb, queues[id][stream1] );
             magma_sgetmatrix_async( jb, jb,
                                     dlA(id, nb*j_local, j), ldda,
                                     Alo(j,j),               lda,
                                     queues[id][stream1] );
+            roofline_end();
 
             /* update off-diagonal blocks of the panel */
             if ( j > 0 ) {
@@ -535,12 +557,15 @@ magma_spotrf3_mgpu(
                             ldpanel = nb;
                             magma_queue_wait_event( queues[d][stream2], events[d][0] ); // rows arrived at gpu
                         }
+                        roofline_start( "update gemm", FLOPS_SGEMM( n_local[d]-nb0, jb, j ),
+                                        sizeof(float) * roofline_gemm_elems( n_local[d]-nb0, jb, j ), queues[d][stream2] );
                         magma_sgemm( MagmaNoTrans, MagmaConjTrans,
                                      n_local[d]-nb0, jb, j,
                                      c_neg_one, dlA(d, nb0, 0), ldda,
                                                 dlpanel,        ldpanel,
                                      c_one,     dlA(d, nb0, j), ldda,
                                      queues[d][stream2] );
+                        roofline_end();
                         magma_event_record( events[d][2], queues[d][stream2] );
                     }
                     d = (d+1)%ngpu;
@@ -550,7 +575,10 @@ magma_spotrf3_mgpu(
             /* wait for the panel and factorized it on cpu */
             magma_setdevice(id);
             magma_queue_sync( queues[id][stream1] );
+            roofline_start( "panel potrf", FLOPS_SPOTRF( jb ),
+                            sizeof(float) * roofline_panel_elems( jb, jb ), NULL );
             lapackf77_spotrf(MagmaLowerStr, &jb, Alo(j,j), &lda, info);
+            roofline_end();
             if (*info != 0) {
                 *info = *info + j;
                 break;
@@ -568,19 +596,23 @@ magma_spotrf3_mgpu(
                         ldpanel = nb;
                     }
                     magma_setdevice(d);
+                    roofline_copy_start( "setmatrix diag", sizeof(float) * jb*jb, queues[d][stream1] );
                     magma_ssetmatrix_async( jb, jb,
                                             Alo(j,j), lda,
                                             dlpanel,  ldpanel,
                                             queues[d][stream1] );
+                    roofline_end();
                     magma_event_record( events[d][1], queues[d][stream1] );
                     d = (d+1)%ngpu;
                 }
             } else {
                 magma_setdevice(id);
+                roofline_copy_start( "setmatrix diag", sizeof(float) * jb*jb, queues[id][stream1] );
                 magma_ssetmatrix_async( jb, jb,
                                         Alo(j,j),               lda,
                                         dlA(id, nb*j_local, j), ldda,
                                         queues[id][stream1] );
+                roofline_end();
             }
 
             /* panel factorize the off-diagonal */
@@ -603,6 +635,8 @@ magma_spotrf3_mgpu(
                     magma_setdevice(d);
                     if ( j+nb < n && d == (j/nb+1)%ngpu ) { /* owns next column, look-ahead next block on stream1 */
                         if ( j > 0 ) magma_queue_wait_event( queues[d][stream1], events[d][2] ); // wait for gemm update
+                        roofline_start( "lookahead trsm", FLOPS_STRSM( MagmaRight, nb0, jb ),
+                                        sizeof(float) * roofline_trsm_elems( nb0, jb, jb ), queues[d][stream1] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(STRSM_WORK)
                             //magmablas_slaset( MagmaFull, trsm_nb, trsm_n, c_zero, c_zero, dinvA(d,0), trsm_nb );
                             //magmablas_slaset( MagmaFull, nb0,     jb,     c_zero, c_zero, dx(d,0), nb0 );
@@ -622,10 +656,13 @@ magma_spotrf3_mgpu(
                                          dlA(d, nb*j_local2, j), ldda,
                                          queues[d][stream1] );
                         #endif
+                        roofline_end();
                         magma_event_record( events[d][4], queues[d][stream1] );
                     } else if ( nb2 > 0 ) { /* other gpus updating all the blocks on stream2 */
                         /* update the entire column */
                         magma_queue_wait_event( queues[d][stream2], events[d][1] ); // wait for the cholesky factor
+                        roofline_start( "update trsm", FLOPS_STRSM( MagmaRight, nb2, jb ),
+                                        sizeof(float) * roofline_trsm_elems( nb2, jb, jb ), queues[d][stream2] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(STRSM_WORK)
                             //magmablas_slaset( MagmaFull, trsm_nb, trsm_n, c_zero, c_zero, dinvA(d,0), trsm_nb );
                             //magmablas_slaset( MagmaFull, nb2,     jb,     c_zero, c_zero, dx(d,0), nb2 );
@@ -643,6 +680,7 @@ magma_spotrf3_mgpu(
                                          dlA(d, nb*j_local2, j), ldda,
                                          queues[d][stream2] );
                         #endif
+                        roofline_end();
                     }
                     d = (d+1)%ngpu;
                 } /* end for d */
@@ -684,10 +722,12 @@ magma_spotrf3_mgpu(
                     // lookahead done
                     magma_setdevice(d);
                     magma_queue_wait_event( queues[d][stream3], events[d][4] );
+                    roofline_copy_start( "getmatrix row", sizeof(float) * nb0*(j+jb), queues[d][stream3] );
                     magma_sgetmatrix_async( nb0, j+jb,
                                             dlA(d, nb*j_local2, 0), ldda,
                                             Alo(j+jb,0),            lda,
                                             queues[d][stream3] );
+                    roofline_end();
                     magma_event_record( events[d][3], queues[d][stream3] );
                     /* syn on rows on CPU, seem to be needed on Pluto */
                     //magma_queue_sync( queues[d][stream3] );
@@ -698,10 +738,12 @@ magma_spotrf3_mgpu(
                         if ( d2 != d ) {
                             magma_setdevice(d2);
                             magma_queue_wait_event( queues[d2][stream3], events[d][3] ); // getmatrix done
+                            roofline_copy_start( "setmatrix row", sizeof(float) * nb0*(j+jb), queues[d2][stream3] );
                             magma_ssetmatrix_async( nb0, j+jb,
                                                     Alo(j+jb,0),        lda,
                                                     dlPT(d2,0,nb,buf2), nb, // first nbxnb reserved for diagonal block
                                                     queues[d2][stream3] );
+                            roofline_end();
                             magma_event_record( events[d2][0], queues[d2][stream3] );
                         }
                     }
@@ -719,6 +761,8 @@ magma_spotrf3_mgpu(
                         }
                         magma_setdevice(d);
                         /* update the remaining blocks in the column */
+                        roofline_start( "update trsm", FLOPS_STRSM( MagmaRight, nb2, jb ),
+                                        sizeof(float) * roofline_trsm_elems( nb2, jb, jb ), queues[d][stream2] );
                         #if (defined(PRECISION_d) || defined(PRECISION_s)) && defined(STRSM_WORK)
                             bool flag = 0;
                             if (flag == 0) {
@@ -743,6 +787,7 @@ magma_spotrf3_mgpu(
                                          dlA(d, nb*j_local2+nb0, j), ldda,
                                          queues[d][stream2] );
                         #endif
+                        roofline_end();
                     }
                 }
             }
@@ -0,0 +1,323 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zpotrf_disk.cpp, normal z -> s, Sat Oct 17 06:08:49 2026
+*/
+#include "file_io.hpp"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SPOTRF_DISK computes the Cholesky factorization of a real symmetric
+    positive definite matrix A that is stored in a file, for matrices that
+    do not fit in host memory.
+
+    The factorization has the form
+        A = U**H * U,  if uplo = MagmaUpper, or
+        A = L  * L**H, if uplo = MagmaLower,
+    where U is an upper triangular matrix and L is lower triangular.
+
+    This is a left-looking, out-of-core version of the algorithm, computed
+    on the CPU host. The matrix is processed in panels of NW columns, where NW
+    is determined by LWORK. Each panel is read once, updated by the previous
+    panels, factored, and written back once. Previous panels are re-read
+    from the file, while the next one is prefetched, except the immediately
+    preceding panel, which is still in memory. A separate I/O thread does
+    all reads and writes (see magma_file_io), overlapping them with the
+    computation.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  Upper triangle of A is stored;
+      -     = MagmaLower:  Lower triangle of A is stored.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    fd      INTEGER
+            File descriptor, open for reading and writing, of a file that
+            contains the REAL array A, dimension (LDA,N), in column-major
+            order, in native binary format.
+    \n
+            On entry, the symmetric matrix A.  If uplo = MagmaUpper, the leading
+            N-by-N upper triangular part of A contains the upper
+            triangular part of the matrix A, and the strictly lower
+            triangular part of A is not referenced.  If uplo = MagmaLower, the
+            leading N-by-N lower triangular part of A contains the lower
+            triangular part of the matrix A, and the strictly upper
+            triangular part of A is not referenced.
+    \n
+            On exit, if INFO = 0, the factor U or L from the Cholesky
+            factorization A = U**H * U or A = L * L**H. The strictly lower
+            (if uplo = MagmaUpper) or upper (if uplo = MagmaLower) triangular
+            part of A in the file is not modified.
+
+    @param[in]
+    offset  INTEGER
+            Byte offset of A(0,0) in the file, e.g., to skip a header.
+            OFFSET >= 0.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    work    (workspace) REAL array, dimension (MAX(1,LWORK))
+            On exit, if INFO = 0, WORK[0] returns the minimum LWORK.
+
+    @param[in]
+    lwork   INTEGER
+            The dimension of the array WORK.  LWORK >= 4*N*NB,
+            where NB can be obtained through magma_get_zpotrf_nb( N ).
+            Panels are NW = (LWORK / (4*N)) columns wide, rounded down to
+            a multiple of NB, so a larger LWORK means less I/O.
+    \n
+            If LWORK = -1, then a workspace query is assumed; the routine
+            only calculates the minimum size of the WORK array, returns
+            this value as the first entry of the WORK array, and no error
+            message related to LWORK is issued.
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as a read or write of the
+                  file failed (MAGMA_ERR_FILESYSTEM).
+      -     > 0:  if INFO = i, the leading minor of order i is not
+                  positive definite, and the factorization could not be
+                  completed.
+
+    @ingroup magma_potrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_spotrf_disk(
+    magma_uplo_t uplo, magma_int_t n,
+    int fd, magma_int_t offset, magma_int_t lda,
+    float *work, magma_int_t lwork,
+    magma_int_t *info )
+{
+    #define P(i_, j_)  (P + (i_) + (j_)*ldp)
+    #define B(i_, j_)  (B + (i_) + (j_)*ldp)
+
+    /* Constants */
+    const float c_one     = MAGMA_S_ONE;
+    const float c_neg_one = MAGMA_S_NEG_ONE;
+    const float d_one     =  1.0;
+    const float d_neg_one = -1.0;
+
+    /* Local variables */
+    bool upper = (uplo == MagmaUpper);
+    magma_int_t nb = magma_get_zpotrf_nb( n );
+    magma_int_t lwkopt = 4*max(1,n)*nb;
+    work[0] = magma_smake_lwork( lwkopt );
+    bool lquery = (lwork == -1);
+
+    /* Check arguments */
+    *info = 0;
+    if (! upper && uplo != MagmaLower) {
+        *info = -1;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (fd < 0) {
+        *info = -3;
+    } else if (offset < 0) {
+        *info = -4;
+    } else if (lda < max(1,n)) {
+        *info = -5;
+    } else if (lwork < lwkopt && ! lquery) {
+        *info = -7;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+    else if (lquery) {
+        return *info;
+    }
+
+    /* Quick return */
+    if ( n == 0 )
+        return *info;
+
+    // panel width; buffers for 2 panels and 2 previous panels, each n x nw
+    magma_int_t ldp = n;
+    magma_int_t nw  = min( n, (lwork / (4*ldp)) / nb * nb );
+    float *panel[2] = { work,          work +   ldp*nw };
+    float *block[2] = { work + 2*ldp*nw, work + 3*ldp*nw };
+
+    magma_file_io io( fd, offset, lda, sizeof(float) );
+    magma_int_t rpanel, rblock[2] = { 0, 0 };
+    magma_int_t j, jb, k, iinfo;
+
+    // read first panel
+    if (upper)
+        rpanel = io.read( nw, nw, 0, 0, panel[0], ldp );
+    else
+        rpanel = io.read( n,  nw, 0, 0, panel[0], ldp );
+
+    for (j = 0; j < n; j += nw) {
+        jb = min( nw, n-j );
+        float *P    = panel[ (j/nw) % 2 ];      // current panel
+        float *prev = panel[ (j/nw + 1) % 2 ];  // previous panel, in memory
+        magma_int_t nprev = j / nw;  // previous panels on disk are 0, ..., nprev-2
+        magma_int_t jn    = j + nw;  // next panel
+        magma_int_t jnb   = min( nw, n-jn );
+
+        if (upper) {
+            //========================================================
+            // Compute the Cholesky factorization A = U**H * U.
+            // Panel P is A(0:j+jb, j:j+jb).
+            // Prefetch first previous panel, U(0:nw, 0:nw).
+            if (nprev >= 2)
+                rblock[0] = io.read( nw, nw, 0, 0, block[0], ldp );
+            io.wait( rpanel );
+            if (io.error() != 0)
+                break;
+
+            // Solve U(0:j, 0:j)**H * P(0:j) = A(0:j, j:j+jb),
+            // by block rows, ascending.
+            for (k = 0; k < nprev-1; ++k) {
+                magma_int_t k0 = k*nw;
+                float *B = block[ k % 2 ];
+                // prefetch next previous panel
+                if (k+1 < nprev-1)
+                    rblock[(k+1) % 2] = io.read( k0 + 2*nw, nw, 0, k0 + nw, block[(k+1) % 2], ldp );
+                io.wait( rblock[ k % 2 ] );
+                if (io.error() != 0)
+                    break;
+                if (k0 > 0) {
+                    blasf77_sgemm( MagmaConjTransStr, MagmaNoTransStr, &nw, &jb, &k0,
+                                   &c_neg_one, B(0,0),  &ldp,
+                                               P(0,0),  &ldp,
+                                   &c_one,     P(k0,0), &ldp );
+                }
+                blasf77_strsm( MagmaLeftStr, MagmaUpperStr, MagmaConjTransStr, MagmaNonUnitStr,
+                               &nw, &jb, &c_one,
+                               B(k0,0), &ldp,
+                               P(k0,0), &ldp );
+            }
+            if (io.error() != 0)
+                break;
+            if (nprev >= 1) {
+                magma_int_t k0 = j - nw;
+                float *B = prev;
+                if (k0 > 0) {
+                    blasf77_sgemm( MagmaConjTransStr, MagmaNoTransStr, &nw, &jb, &k0,
+                                   &c_neg_one, B(0,0),  &ldp,
+                                               P(0,0),  &ldp,
+                                   &c_one,     P(k0,0), &ldp );
+                }
+                blasf77_strsm( MagmaLeftStr, MagmaUpperStr, MagmaConjTransStr, MagmaNonUnitStr,
+                               &nw, &jb, &c_one,
+                               B(k0,0), &ldp,
+                               P(k0,0), &ldp );
+            }
+
+            // prev is no longer needed, and the I/O thread finishes writing
+            // it before reading into it, so prefetch next panel now
+            if (jn < n)
+                rpanel = io.read( jn + jnb, jnb, 0, jn, prev, ldp );
+
+            // update and factor diagonal block
+            if (j > 0) {
+                blasf77_ssyrk( MagmaUpperStr, MagmaConjTransStr, &jb, &j,
+                               &d_neg_one, P(0,0), &ldp,
+                               &d_one,     P(j,0), &ldp );
+            }
+            lapackf77_spotrf( MagmaUpperStr, &jb, P(j,0), &ldp, &iinfo );
+            if (iinfo != 0) {
+                *info = iinfo + j;
+                break;
+            }
+            io.write( MagmaUpper, j + jb, jb, 0, j, P, ldp );
+        }
+        else {
+            //========================================================
+            // Compute the Cholesky factorization A = L * L**H.
+            // Panel P is A(j:n, j:j+jb).
+            magma_int_t mj = n - j;
+
+            // Prefetch first previous panel, L(j:n, 0:nw).
+            if (nprev >= 2)
+                rblock[0] = io.read( mj, nw, j, 0, block[0], ldp );
+            io.wait( rpanel );
+            if (io.error() != 0)
+                break;
+
+            // Update P -= L(j:n, k) * L(j:j+jb, k)**H for previous panels k.
+            // Updates commute, so start with the previous panel, in memory.
+            if (nprev >= 1) {
+                float *B = prev + nw;  // L(j:n, j-nw:j)
+                blasf77_ssyrk( MagmaLowerStr, MagmaNoTransStr, &jb, &nw,
+                               &d_neg_one, B(0,0), &ldp,
+                               &d_one,     P(0,0), &ldp );
+                if (mj > jb) {
+                    magma_int_t mjb = mj - jb;
+                    blasf77_sgemm( MagmaNoTransStr, MagmaConjTransStr, &mjb, &jb, &nw,
+                                   &c_neg_one, B(jb,0), &ldp,
+                                               B(0,0),  &ldp,
+                                   &c_one,     P(jb,0), &ldp );
+                }
+            }
+
+            // prev is no longer needed, and the I/O thread finishes writing
+            // it before reading into it, so prefetch next panel once
+            // the previous panels are requested
+            if (nprev < 2 && jn < n)
+                rpanel = io.read( n - jn, jnb, jn, jn, prev, ldp );
+
+            for (k = 0; k < nprev-1; ++k) {
+                float *B = block[ k % 2 ];
+                if (k+1 < nprev-1)
+                    rblock[(k+1) % 2] = io.read( mj, nw, j, (k+1)*nw, block[(k+1) % 2], ldp );
+                else if (jn < n)
+                    rpanel = io.read( n - jn, jnb, jn, jn, prev, ldp );
+                io.wait( rblock[ k % 2 ] );
+                if (io.error() != 0)
+                    break;
+                blasf77_ssyrk( MagmaLowerStr, MagmaNoTransStr, &jb, &nw,
+                               &d_neg_one, B(0,0), &ldp,
+                               &d_one,     P(0,0), &ldp );
+                if (mj > jb) {
+                    magma_int_t mjb = mj - jb;
+                    blasf77_sgemm( MagmaNoTransStr, MagmaConjTransStr, &mjb, &jb, &nw,
+                                   &c_neg_one, B(jb,0), &ldp,
+                                               B(0,0),  &ldp,
+                                   &c_one,     P(jb,0), &ldp );
+                }
+            }
+            if (io.error() != 0)
+                break;
+
+            // factor diagonal block and solve for the rest of the panel
+            lapackf77_spotrf( MagmaLowerStr, &jb, P(0,0), &ldp, &iinfo );
+            if (iinfo != 0) {
+                *info = iinfo + j;
+                break;
+            }
+            if (mj > jb) {
+                magma_int_t mjb = mj - jb;
+                blasf77_strsm( MagmaRightStr, MagmaLowerStr, MagmaConjTransStr, MagmaNonUnitStr,
+                               &mjb, &jb, &c_one,
+                               P(0,0),  &ldp,
+                               P(jb,0), &ldp );
+            }
+            io.write( MagmaLower, mj, jb, j, j, P, ldp );
+        }
+    }
+
+    io.sync();
+    if (io.error() != 0) {
+        *info = MAGMA_ERR_FILESYSTEM;
+    }
+
+    return *info;
+} /* magma_spotrf_disk */
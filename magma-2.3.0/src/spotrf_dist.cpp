@@ -0,0 +1,278 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from src/zpotrf_dist.cpp, normal z -> s, Wed Nov 15 00:34:20 2017
+*/
+#include "mpi_grid.hpp"  // includes magma_internal.h, after the STL headers
+
+#if defined(HAVE_MPI)
+
+/***************************************************************************//**
+    Purpose
+    -------
+    SPOTRF_DIST computes the Cholesky factorization of a real symmetric
+    positive definite matrix A distributed over the ranks of an MPI
+    communicator, so A may be larger than the memory of one node.
+
+    The factorization has the form
+        A = L  * L**H,
+    where L is lower triangular.
+
+    A is distributed 2D block cyclic (see magma_bcyclic_t) over the p-by-q
+    grid of the ranks of comm; rank r is participant r. At step k, the grid
+    column that owns block column k factors the diagonal tile and solves
+    the panel below it. Each rank of that grid column broadcasts its part
+    of the panel along its grid row, and then each rank broadcasts the part
+    it received along its grid column, so every rank has the rows of the
+    panel that match its rows and its columns, and updates its part of the
+    trailing matrix with local BLAS. All broadcasts are non-blocking. With
+    look-ahead, the grid column that owns block column k+1 updates it first,
+    and factors and starts sending panel k+1, before the rest of the update
+    of step k, which the transfer of panel k+1 then overlaps.
+
+    With BACKEND = host, each rank's BLAS uses its own cores; running
+    several ranks on one node, MPI's shared-memory transport stands in for
+    the network. Requires MAGMA built with -DHAVE_MPI.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaLower:  Lower triangle of A is stored.
+            MagmaUpper is not currently supported.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  0 <= N <= desc->n.
+
+    @param[in,out]
+    A       REAL array on each rank, dimension (desc->ldd, NLOC),
+            with NLOC from magma_bcyclic_local_size.
+            On entry, this rank's part of the symmetric matrix A; the
+            strictly upper triangular part of A is not referenced.
+    \n
+            On exit, if INFO = 0, this rank's part of the factor L.
+
+    @param[in]
+    desc    magma_bcyclic_t*
+            The distribution of A, with square tiles, desc->mb = desc->nb,
+            over p*q = the size of comm ranks; see magma_bcyclic_init.
+            N-by-N A is the leading part of the desc->m-by-desc->n matrix.
+
+    @param[in]
+    comm    MPI_Comm
+            The ranks over which A is distributed. All of them must call
+            SPOTRF_DIST.
+
+    @param[out]
+    info    INTEGER, the same on all ranks.
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+      -     > 0:  if INFO = i, the leading minor of order i is not
+                  positive definite, and the factorization could not be
+                  completed. The remaining steps still run, on meaningless
+                  data, so all ranks make the same MPI calls.
+
+    @ingroup magma_potrf
+*******************************************************************************/
+extern "C" magma_int_t
+magma_spotrf_dist(
+    magma_uplo_t uplo, magma_int_t n,
+    float *A, const magma_bcyclic_t *desc,
+    MPI_Comm comm,
+    magma_int_t *info )
+{
+    #define A(i_, j_)  (A + (i_) + (j_)*ldda)
+
+    /* Constants */
+    const float c_one     = MAGMA_S_ONE;
+    const float c_neg_one = MAGMA_S_NEG_ONE;
+    const float             d_one     =  1.0;
+    const float             d_neg_one = -1.0;
+
+    int nprocs;
+    MPI_Comm_size( comm, &nprocs );
+
+    /* Check arguments */
+    *info = 0;
+    if (uplo != MagmaLower) {
+        *info = -1;
+    } else if (desc == NULL || n < 0 || n > desc->m || n > desc->n) {
+        *info = -2;
+    } else if (A == NULL) {
+        *info = -3;
+    } else if (desc->mb != desc->nb || desc->p * desc->q != nprocs) {
+        *info = -4;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (n == 0)
+        return *info;
+
+    magma_mpi_grid grid( desc, comm, sizeof(float) );
+    const magma_int_t nb = desc->nb, p = grid.p, q = grid.q;
+    const magma_int_t pr = grid.pr, pc = grid.pc;
+    const magma_int_t ldda = desc->ldd;
+    const magma_int_t nt   = magma_ceildiv( n, nb );
+    const magma_int_t mloc = magma_bcyclic_numroc( n, nb, pr, p );
+
+    // rows of the panel below the diagonal tile of step k on grid row s
+    auto panel_rows = [&]( magma_int_t k, magma_int_t s ) {
+        return magma_bcyclic_numroc( n, nb, s, p )
+             - magma_bcyclic_numroc( min( n, (k+1)*nb ), nb, s, p );
+    };
+
+    // Panels k and k+1 are in flight at once, so there are two panel
+    // buffers, each with a slot for each grid row. Slot s holds the panel
+    // rows on grid row s, contiguous with ld = panel_rows( k, s ); this
+    // rank's slot, s = pr, is the part sent along its grid row.
+    const magma_int_t slot = max( 1, magma_bcyclic_numroc( n, nb, 0, p ) ) * nb;
+    float *work = NULL, *Lkk;
+    magma_int_t failed = (MAGMA_SUCCESS != magma_smalloc_cpu( &work, 2*p*slot + nb*nb ));
+    // all ranks return if any failed to allocate
+    grid.reduce_info( &failed );
+    if (failed) {
+        magma_free_cpu( work );
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+    Lkk = work + 2*p*slot;
+
+    auto W = [&]( magma_int_t k, magma_int_t s ) {
+        return work + ((k % 2)*p + s)*slot;
+    };
+
+    // requests of the row broadcast, and of the column broadcasts, of
+    // each panel in flight, and whether its column broadcasts started
+    std::vector< MPI_Request > row_req[2], col_req[2];
+    bool col_started[2] = { false, false };
+
+    // -------------------------
+    // Factors the diagonal tile of step k and solves the panel below it,
+    // on grid column k % q, and starts the row broadcast of the panel.
+    auto panel = [&]( magma_int_t k ) {
+        magma_int_t kb  = min( nb, n - k*nb );
+        magma_int_t il0 = magma_bcyclic_numroc( k*nb,     nb, pr, p );
+        magma_int_t il1 = magma_bcyclic_numroc( min( n, (k+1)*nb ), nb, pr, p );
+        magma_int_t jl  = magma_bcyclic_numroc( k*nb,     nb, pc, q );
+        magma_int_t m1  = mloc - il1;
+        magma_int_t iinfo;
+        if (pc == k % q) {
+            if (pr == k % p) {
+                lapackf77_spotrf( MagmaLowerStr, &kb, A(il0, jl), &ldda, &iinfo );
+                if (iinfo > 0 && *info == 0) {
+                    *info = iinfo + k*nb;
+                }
+                lapackf77_slacpy( MagmaLowerStr, &kb, &kb, A(il0, jl), &ldda, Lkk, &kb );
+            }
+            MPI_Bcast( Lkk, int(kb*kb), grid.type, int(k % p), grid.col_comm );
+            // A(k+1:n, k) = A(k+1:n, k) L(k,k)^{-H}
+            blasf77_strsm( MagmaRightStr, MagmaLowerStr, MagmaConjTransStr, MagmaNonUnitStr,
+                           &m1, &kb, &c_one, Lkk, &kb, A(il1, jl), &ldda );
+            magma_int_t ldw = max( 1, m1 );
+            lapackf77_slacpy( MagmaFullStr, &m1, &kb, A(il1, jl), &ldda, W( k, pr ), &ldw );
+        }
+        MPI_Request request;
+        MPI_Ibcast( W( k, pr ), int(m1*kb), grid.type, int(k % q), grid.row_comm, &request );
+        row_req[k % 2].push_back( request );
+        col_started[k % 2] = false;
+    };
+
+    // -------------------------
+    // Once the row broadcast of panel k is done, starts the column
+    // broadcasts, from each grid row, of the part it received.
+    auto start_col = [&]( magma_int_t k ) {
+        if (! col_started[k % 2] && grid.progress( row_req[k % 2] )) {
+            magma_int_t kb = min( nb, n - k*nb );
+            for (magma_int_t s = 0; s < p; ++s) {
+                MPI_Request request;
+                MPI_Ibcast( W( k, s ), int(panel_rows( k, s )*kb), grid.type,
+                            int(s), grid.col_comm, &request );
+                col_req[k % 2].push_back( request );
+            }
+            col_started[k % 2] = true;
+        }
+    };
+
+    // progresses panel k, in flight during local updates
+    auto progress = [&]( magma_int_t k ) {
+        start_col( k );
+        if (col_started[k % 2]) {
+            grid.progress( col_req[k % 2] );
+        }
+    };
+
+    // waits for all of panel k
+    auto finish = [&]( magma_int_t k ) {
+        grid.wait( row_req[k % 2] );
+        start_col( k );
+        grid.wait( col_req[k % 2] );
+    };
+
+    // -------------------------
+    // Updates this rank's part of block column j >= k+1 with panel k,
+    // A(j:n, j) -= L(j:n, k) L(j, k)^H.
+    auto update = [&]( magma_int_t k, magma_int_t j ) {
+        magma_int_t kb  = min( nb, n - k*nb );
+        magma_int_t jb  = min( nb, n - j*nb );
+        magma_int_t s   = j % p;
+        magma_int_t il1 = magma_bcyclic_numroc( min( n, (k+1)*nb ), nb, pr, p );
+        magma_int_t ilj = magma_bcyclic_numroc( j*nb,     nb, pr, p );
+        magma_int_t jl  = magma_bcyclic_numroc( j*nb,     nb, pc, q );
+        magma_int_t ldw = max( 1, mloc - il1 );
+        magma_int_t lds = panel_rows( k, s );
+        // L(j:n, k) from this rank's slot; L(j, k) from grid row s
+        float *Li = W( k, pr ) + (ilj - il1);
+        float *Lj = W( k, s )
+                               + (magma_bcyclic_numroc( j*nb, nb, s, p )
+                                - magma_bcyclic_numroc( min( n, (k+1)*nb ), nb, s, p ));
+        magma_int_t mi = mloc - ilj;
+        if (pr == s) {
+            // diagonal tile
+            blasf77_ssyrk( MagmaLowerStr, MagmaNoTransStr, &jb, &kb,
+                           &d_neg_one, Li, &ldw, &d_one, A(ilj, jl), &ldda );
+            Li += jb;
+            ilj += jb;
+            mi  -= jb;
+        }
+        blasf77_sgemm( MagmaNoTransStr, MagmaConjTransStr, &mi, &jb, &kb,
+                       &c_neg_one, Li, &ldw, Lj, &lds,
+                       &c_one,     A(ilj, jl), &ldda );
+    };
+
+    panel( 0 );
+    for (magma_int_t k = 0; k < nt; ++k) {
+        finish( k );
+
+        // look-ahead: update and factor panel k+1, and start sending it
+        if (k+1 < nt) {
+            if (pc == (k+1) % q) {
+                update( k, k+1 );
+            }
+            panel( k+1 );
+        }
+
+        // rest of the trailing matrix, while panel k+1 is in flight
+        for (magma_int_t j = k+2; j < nt; ++j) {
+            if (pc == j % q) {
+                update( k, j );
+                progress( k+1 );
+            }
+        }
+    }
+
+    magma_free_cpu( work );
+    grid.reduce_info( info );
+
+    return *info;
+} /* magma_spotrf_dist */
+
+#endif // HAVE_MPI
@@ -10,7 +10,8 @@
        
        @generated from src/zpotrf_gpu.cpp, normal z -> s, Wed Nov 15 00:34:18 2017
 */
-#include "magma_internal.h"
+#include "lookahead.hpp"  // includes magma_internal.h, after the STL headers
+#include "roofline.h"
 
 // === Define what BLAS to use ============================================
     #undef  magma_strsm
@@ -28,7 +29,10 @@
         dA = L  * L**H,  if UPLO = MagmaLower,
     where U is an upper triangular matrix and L is lower triangular.
 
-    This is the block version of the algorithm, calling Level 3 BLAS.
+    This is the right-looking block version of the algorithm, calling
+    Level 3 BLAS. The CPU factors each diagonal block while the GPU updates
+    the trailing matrix, with an adaptive look-ahead of up to
+    $MAGMA_LOOKAHEAD panels (default 4); see magma_lookahead.
 
     Arguments
     ---------
@@ -92,8 +96,9 @@ magma_spotrf_gpu(
     const char* uplo_ = lapack_uplo_const( uplo );
     bool upper = (uplo == MagmaUpper);
     
-    magma_int_t j, jb, nb;
+    magma_int_t j, jb, nb, nt, c, a, k, t;
     float *work;
+    float flops, time;
 
     *info = 0;
     if (! upper && uplo != MagmaLower) {
@@ -128,98 +133,142 @@ magma_spotrf_gpu(
         magma_ssetmatrix( n, n, work, n, dA(0,0), ldda, queues[0] );
     }
     else {
-        /* Use blocked code. */
-        if (upper) {
-            //=========================================================
-            /* Compute the Cholesky factorization A = U'*U. */
-            for (j=0; j < n; j += nb) {
-                // apply all previous updates to diagonal block,
-                // then transfer it to CPU
-                jb = min( nb, n-j );
-                magma_ssyrk( MagmaUpper, MagmaConjTrans, jb, j,
-                             d_neg_one, dA(0, j), ldda,
-                             d_one,     dA(j, j), ldda, queues[1] );
-                
-                magma_queue_sync( queues[1] );
-                magma_sgetmatrix_async( jb, jb,
-                                        dA(j, j), ldda,
-                                        work,     jb, queues[0] );
-                
-                // apply all previous updates to block row right of diagonal block
-                if (j+jb < n) {
-                    magma_sgemm( MagmaConjTrans, MagmaNoTrans,
-                                 jb, n-j-jb, j,
-                                 c_neg_one, dA(0, j   ), ldda,
-                                            dA(0, j+jb), ldda,
-                                 c_one,     dA(j, j+jb), ldda, queues[1] );
+        /* Use blocked code.
+           queues[0] brings each block column (row, if upper) up to date with
+           the panels that the trailing updates skipped, transfers the
+           diagonal block, and applies it; queues[1] runs the trailing
+           updates, which skip the look-ahead window. */
+        nt = magma_ceildiv( n, nb );
+        magma_lookahead lookahead( nt );
+        std::vector< magma_event_t > panel_done( nt ), update_done( nt );
+        for (c=0; c < nt; ++c) {
+            magma_event_create( &panel_done[c] );
+            magma_event_create( &update_done[c] );
+        }
+        
+        for (c=0; c < nt; ++c) {
+            j  = c*nb;
+            jb = min( nb, n-j );
+            
+            // apply panels a, ..., c-1 to block column c, once the last
+            // trailing update that included it is done
+            a = lookahead.applied( c );
+            if (a > 0) {
+                magma_event_sync( update_done[a-1] );
+            }
+            time  = magma_wtime();
+            flops = 0;
+            if (a < c) {
+                k = j - a*nb;
+                flops = FLOPS_SSYRK( k, jb ) + FLOPS_SGEMM( n-j-jb, jb, k );
+                roofline_start( "lookahead syrk", FLOPS_SSYRK( k, jb ),
+                                sizeof(float) * roofline_syrk_elems( jb, k ), queues[0] );
+                if (upper) {
+                    magma_ssyrk( MagmaUpper, MagmaConjTrans, jb, k,
+                                 d_neg_one, dA(a*nb, j), ldda,
+                                 d_one,     dA(j,    j), ldda, queues[0] );
                 }
-                
-                // simultaneous with above sgemm, transfer diagonal block,
-                // factor it on CPU, and test for positive definiteness
-                magma_queue_sync( queues[0] );
-                lapackf77_spotrf( MagmaUpperStr, &jb, work, &jb, info );
-                magma_ssetmatrix_async( jb, jb,
-                                        work,     jb,
-                                        dA(j, j), ldda, queues[1] );
-                if (*info != 0) {
-                    *info = *info + j;
-                    break;
+                else {
+                    magma_ssyrk( MagmaLower, MagmaNoTrans, jb, k,
+                                 d_neg_one, dA(j, a*nb), ldda,
+                                 d_one,     dA(j, j   ), ldda, queues[0] );
                 }
-                
-                // apply diagonal block to block row right of diagonal block
+                roofline_end();
                 if (j+jb < n) {
+                    roofline_start( "lookahead gemm", FLOPS_SGEMM( n-j-jb, jb, k ),
+                                    sizeof(float) * roofline_gemm_elems( n-j-jb, jb, k ), queues[0] );
+                    if (upper) {
+                        magma_sgemm( MagmaConjTrans, MagmaNoTrans,
+                                     jb, n-j-jb, k,
+                                     c_neg_one, dA(a*nb, j   ), ldda,
+                                                dA(a*nb, j+jb), ldda,
+                                     c_one,     dA(j,    j+jb), ldda, queues[0] );
+                    }
+                    else {
+                        magma_sgemm( MagmaNoTrans, MagmaConjTrans,
+                                     n-j-jb, jb, k,
+                                     c_neg_one, dA(j+jb, a*nb), ldda,
+                                                dA(j,    a*nb), ldda,
+                                     c_one,     dA(j+jb, j   ), ldda, queues[0] );
+                    }
+                    roofline_end();
+                }
+            }
+            
+            // transfer diagonal block, factor it on CPU,
+            // and test for positive definiteness
+            roofline_copy_start( "getmatrix diag", sizeof(float) * jb*jb, queues[0] );
+            magma_sgetmatrix_async( jb, jb,
+                                    dA(j, j), ldda,
+                                    work,     jb, queues[0] );
+            roofline_end();
+            magma_queue_sync( queues[0] );
+            lookahead.device( flops, magma_wtime() - time );
+            
+            roofline_start( "panel potrf", FLOPS_SPOTRF( jb ),
+                            sizeof(float) * roofline_panel_elems( jb, jb ), NULL );
+            lapackf77_spotrf( uplo_, &jb, work, &jb, info );
+            roofline_end();
+            lookahead.panel( magma_wtime() - time );
+            
+            roofline_copy_start( "setmatrix diag", sizeof(float) * jb*jb, queues[0] );
+            magma_ssetmatrix_async( jb, jb,
+                                    work,     jb,
+                                    dA(j, j), ldda, queues[0] );
+            roofline_end();
+            if (*info != 0) {
+                *info = *info + j;
+                break;
+            }
+            
+            // apply diagonal block to block row right of (column below) it
+            if (j+jb < n) {
+                roofline_start( "panel trsm", FLOPS_STRSM( MagmaLeft, jb, n-j-jb ),
+                                sizeof(float) * roofline_trsm_elems( jb, n-j-jb, jb ), queues[0] );
+                if (upper) {
                     magma_strsm( MagmaLeft, MagmaUpper, MagmaConjTrans, MagmaNonUnit,
                                  jb, n-j-jb,
                                  c_one, dA(j, j),    ldda,
-                                        dA(j, j+jb), ldda, queues[1] );
+                                        dA(j, j+jb), ldda, queues[0] );
                 }
-            }
-        }
-        else {
-            //=========================================================
-            // Compute the Cholesky factorization A = L*L'.
-            for (j=0; j < n; j += nb) {
-                // apply all previous updates to diagonal block,
-                // then transfer it to CPU
-                jb = min( nb, n-j );
-                magma_ssyrk( MagmaLower, MagmaNoTrans, jb, j,
-                             d_neg_one, dA(j, 0), ldda,
-                             d_one,     dA(j, j), ldda, queues[1] );
-                
-                magma_queue_sync( queues[1] );
-                magma_sgetmatrix_async( jb, jb,
-                                        dA(j, j), ldda,
-                                        work,     jb, queues[0] );
-                
-                // apply all previous updates to block column below diagonal block
-                if (j+jb < n) {
-                    magma_sgemm( MagmaNoTrans, MagmaConjTrans,
-                                 n-j-jb, jb, j,
-                                 c_neg_one, dA(j+jb, 0), ldda,
-                                            dA(j,    0), ldda,
-                                 c_one,     dA(j+jb, j), ldda, queues[1] );
-                }
-                
-                // simultaneous with above sgemm, transfer diagonal block,
-                // factor it on CPU, and test for positive definiteness
-                magma_queue_sync( queues[0] );
-                lapackf77_spotrf( MagmaLowerStr, &jb, work, &jb, info );
-                magma_ssetmatrix_async( jb, jb,
-                                        work,     jb,
-                                        dA(j, j), ldda, queues[1] );
-                if (*info != 0) {
-                    *info = *info + j;
-                    break;
-                }
-                
-                // apply diagonal block to block column below diagonal
-                if (j+jb < n) {
+                else {
                     magma_strsm( MagmaRight, MagmaLower, MagmaConjTrans, MagmaNonUnit,
                                  n-j-jb, jb,
                                  c_one, dA(j,    j), ldda,
-                                        dA(j+jb, j), ldda, queues[1] );
+                                        dA(j+jb, j), ldda, queues[0] );
                 }
+                roofline_end();
             }
+            magma_event_record( panel_done[c], queues[0] );
+            
+            // apply panel to trailing matrix right of the look-ahead window
+            if (c+1 < nt) {
+                t = lookahead.trailing( c, FLOPS_SSYRK( jb, n-j-jb ) ) * nb;
+                if (t < n) {
+                    magma_queue_wait_event( queues[1], panel_done[c] );
+                    roofline_start( "update syrk", FLOPS_SSYRK( jb, n-t ),
+                                    sizeof(float) * roofline_syrk_elems( n-t, jb ), queues[1] );
+                    if (upper) {
+                        magma_ssyrk( MagmaUpper, MagmaConjTrans, n-t, jb,
+                                     d_neg_one, dA(j, t), ldda,
+                                     d_one,     dA(t, t), ldda, queues[1] );
+                    }
+                    else {
+                        magma_ssyrk( MagmaLower, MagmaNoTrans, n-t, jb,
+                                     d_neg_one, dA(t, j), ldda,
+                                     d_one,     dA(t, t), ldda, queues[1] );
+                    }
+                    roofline_end();
+                    magma_event_record( update_done[c], queues[1] );
+                }
+            }
+        }
+        
+        magma_queue_sync( queues[0] );
+        magma_queue_sync( queues[1] );
+        for (c=0; c < nt; ++c) {
+            magma_event_destroy( panel_done[c] );
+            magma_event_destroy( update_done[c] );
         }
     }
     
@@ -92,8 +92,8 @@ magma_spotrf_mgpu(
     } else if (n < 0) {
         *info = -2;
     } else if (!upper) {
-        lddp = nb*(n/(nb*ngpu));
-        if ( n%(nb*ngpu) != 0 ) lddp += min(nb, n-ngpu*lddp);
+        // local rows on GPU 0, which has the most
+        lddp = magma_bcyclic_numroc( n, nb, 0, ngpu );
         if ( ldda < lddp ) *info = -4;
     } else if ( ldda < n ) {
         *info = -4;
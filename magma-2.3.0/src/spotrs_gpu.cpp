@@ -65,9 +65,6 @@ magma_spotrs_gpu(
     magmaFloat_ptr dB, magma_int_t lddb,
     magma_int_t *info)
 {
-    // Constants
-    const float c_one = MAGMA_S_ONE;
-
     *info = 0;
     if ( uplo != MagmaUpper && uplo != MagmaLower )
         *info = -1;
@@ -99,8 +96,7 @@ magma_spotrs_gpu(
             magma_strsv( MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, dA, ldda, dB, 1, queue );
             magma_strsv( MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, dA, ldda, dB, 1, queue );
         } else {
-            magma_strsm( MagmaLeft, MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
-            magma_strsm( MagmaLeft, MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+            magmablas_spotrs_trsm( MagmaUpper, n, nrhs, dA, ldda, dB, lddb, queue );
         }
     }
     else {
@@ -108,8 +104,7 @@ magma_spotrs_gpu(
             magma_strsv( MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, dA, ldda, dB, 1, queue );
             magma_strsv( MagmaLower, MagmaConjTrans, MagmaNonUnit, n, dA, ldda, dB, 1, queue );
         } else {
-            magma_strsm( MagmaLeft, MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
-            magma_strsm( MagmaLeft, MagmaLower, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+            magmablas_spotrs_trsm( MagmaLower, n, nrhs, dA, ldda, dB, lddb, queue );
         }
     }
 
@@ -8,6 +8,10 @@
        @generated from src/zhetrf_nopiv_cpu.cpp, normal z -> s, Wed Nov 15 00:34:19 2017
  
 */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "magma_internal.h"
 
 #define REAL
@@ -19,18 +23,65 @@
 
 
 /******************************************************************************/
-// TODO: change alpha and beta to be float, per BLAS, instead of float-real
-// trailing submatrix update with inner-blocking
+// Blocking for ssyrk_d. Each thread updates block_nb columns of C at a time,
+// using block_kb columns of A (rows of A for upper) per pass, in tiles of
+// kernel_mr x kernel_nr.
+static const magma_int_t kernel_mr = 8;
+static const magma_int_t kernel_nr = 4;
+static const magma_int_t block_nb  = 64;   // multiple of kernel_nr
+static const magma_int_t block_kb  = 256;
+
+
+/******************************************************************************/
+// micro-kernel for ssyrk_d: AB = Ap*Bp, where Ap is a packed kernel_mr x k
+// panel and Bp is a packed k x kernel_nr panel, both stored k-major.
+// AB is kernel_mr x kernel_nr, column-major.
+// The inner loop is contiguous and of fixed length, so it vectorizes.
+static void ssyrk_d_kernel(
+    magma_int_t k,
+    const float *Ap,
+    const float *Bp,
+    float *AB)
+{
+    float ab[ kernel_mr*kernel_nr ];
+    for (magma_int_t i=0; i < kernel_mr*kernel_nr; i++) {
+        ab[i] = MAGMA_S_ZERO;
+    }
+    for (magma_int_t l=0; l < k; l++) {
+        for (magma_int_t j=0; j < kernel_nr; j++) {
+            float b = Bp[j];
+            for (magma_int_t i=0; i < kernel_mr; i++) {
+                ab[i + j*kernel_mr] += Ap[i] * b;
+            }
+        }
+        Ap += kernel_mr;
+        Bp += kernel_nr;
+    }
+    for (magma_int_t i=0; i < kernel_mr*kernel_nr; i++) {
+        AB[i] = ab[i];
+    }
+}
+
+
+/******************************************************************************/
+// trailing submatrix update with inner-blocking,
+//     C = beta*C + alpha*A*D*A^H  for lower, where A is m x n,
+//     C = beta*C + alpha*A^H*D*A  for upper, where A is n x m,
+// for m x m symmetric C and n x n diagonal D. Only the uplo triangle of C
+// is referenced.
+//
+// Block columns of C are updated in parallel. For each one, alpha*D*A^H
+// (alpha*D*A for upper) is packed into contiguous panels, fusing the scaling
+// into the packing, then multiplied by packed panels of A (A^H for upper)
+// in a GEMM-style micro-kernel. Tiles outside the triangle are skipped.
 magma_int_t ssyrk_d(
     magma_uplo_t uplo, magma_int_t m, magma_int_t n,
     float alpha, float *A, magma_int_t lda,
     float beta,  float *C, magma_int_t ldc,
     float *D, magma_int_t incD)
 {
-    magma_int_t i, j, k;
-    float *Aik;
-    float *Dkk;
-    float *Akj;
+    const float c_zero = MAGMA_S_ZERO;
+    bool lower = (uplo == MagmaLower);
 
     /* Check input arguments */
     magma_int_t info = 0;
@@ -38,19 +89,19 @@ magma_int_t ssyrk_d(
         info = -1;
     }
     if (m < 0) {
-        info = -3;
+        info = -2;
     }
     if (n < 0) {
-        info = -4;
+        info = -3;
     }
-    if ((lda < max(1, m)) && (m > 0)) {
-        info = -7;
+    if (lda < max(1, (lower ? m : n))) {
+        info = -6;
     }
-    if ((ldc < max(1, m)) && (m > 0)) {
-        info = -10;
+    if (ldc < max(1, m)) {
+        info = -9;
     }
     if ( incD < 0 ) {
-        info = -12;
+        info = -11;
     }
     if (info != 0) {
         magma_xerbla( __func__, -(info) );
@@ -58,39 +109,129 @@ magma_int_t ssyrk_d(
     }
 
     /* Quick return */
-    if (m == 0 || n == 0 ||
-        ((alpha == 0.0 || m == 0) && beta == 1.0) ) {
+    if (m == 0 ||
+        ((alpha == 0.0 || n == 0) && beta == 1.0) ) {
         return info;
     }
 
-    if ( uplo == MagmaLower ) {
-        for (j=0; j < m; j++) {
-            for (i=j; i < m; i++) {
-                float tmp = MAGMA_S_ZERO;
-                Aik = A+i;
-                Dkk = D;
-                Akj = A+j;
-                for (k=0; k < n; k++) {
-                    tmp += (*Aik) * (*Dkk) * conj( *Akj );
-                    Aik += lda;
-                    Dkk += incD;
-                    Akj += lda;
+    /* Allocate packing workspace for each thread */
+    magma_int_t nthreads = 1;
+    #ifdef _OPENMP
+    if (m > block_nb) {
+        nthreads = omp_get_max_threads();
+    }
+    #endif
+    magma_int_t lwork = (block_nb + kernel_mr)*block_kb;
+    float *work;
+    if (MAGMA_SUCCESS != magma_smalloc_cpu( &work, nthreads*lwork )) {
+        info = MAGMA_ERR_HOST_ALLOC;
+        return info;
+    }
+
+    magma_int_t nblocks = magma_ceildiv( m, block_nb );
+
+    #pragma omp parallel num_threads( nthreads )
+    {
+        magma_int_t tid = 0;
+        #ifdef _OPENMP
+        tid = omp_get_thread_num();
+        #endif
+        float *Bp = work + tid*lwork;         // block_kb x block_nb
+        float *Ap = Bp + block_nb*block_kb;  // kernel_mr x block_kb
+        float AB[ kernel_mr*kernel_nr ];
+
+        // the work per block column varies along the triangle
+        #pragma omp for schedule(dynamic)
+        for (magma_int_t jb=0; jb < nblocks; jb++) {
+            magma_int_t j0 = jb*block_nb;
+            magma_int_t nj = min( block_nb, m - j0 );
+
+            // rows [ibegin, iend) of this block column intersect the triangle
+            magma_int_t ibegin = (lower ? j0 : 0);
+            magma_int_t iend   = (lower ? m  : j0 + nj);
+
+            /* C = beta*C */
+            if (beta != 1.0) {
+                for (magma_int_t j=j0; j < j0 + nj; j++) {
+                    magma_int_t i1 = (lower ? j : 0);
+                    magma_int_t i2 = (lower ? m : j + 1);
+                    for (magma_int_t i=i1; i < i2; i++) {
+                        C(i, j) = (beta == 0.0 ? c_zero : beta * C(i, j));
+                    }
                 }
-                C(i, j) = beta * C(i, j) + alpha * tmp;
             }
-        }
-    }
-    else {
-        for (j=0; j < m; j++) {
-            for (i=0; i <= j; i++) {
-                float tmp = MAGMA_S_ZERO;
-                for (k=0; k < n; k++) {
-                    tmp += A(i, k) * D( k ) * conj( A(k, j) );
+            if (alpha == 0.0) {
+                continue;
+            }
+
+            for (magma_int_t l0=0; l0 < n; l0 += block_kb) {
+                magma_int_t nl = min( block_kb, n - l0 );
+
+                /* Pack alpha*D*A^H (alpha*D*A for upper) in kernel_nr panels */
+                for (magma_int_t jr=0; jr < nj; jr += kernel_nr) {
+                    float *Bpj = Bp + jr*nl;
+                    for (magma_int_t l=0; l < nl; l++) {
+                        float d = alpha * D( l0+l );
+                        for (magma_int_t r=0; r < kernel_nr; r++) {
+                            magma_int_t j = j0 + jr + r;
+                            if (jr + r >= nj) {
+                                Bpj[r + l*kernel_nr] = c_zero;
+                            }
+                            else if (lower) {
+                                Bpj[r + l*kernel_nr] = d * conj( A(j, l0+l) );
+                            }
+                            else {
+                                Bpj[r + l*kernel_nr] = d * A(l0+l, j);
+                            }
+                        }
+                    }
+                }
+
+                for (magma_int_t i0=ibegin; i0 < iend; i0 += kernel_mr) {
+                    magma_int_t mi = min( kernel_mr, iend - i0 );
+
+                    /* Pack A (A^H for upper) in a kernel_mr panel */
+                    for (magma_int_t l=0; l < nl; l++) {
+                        for (magma_int_t r=0; r < kernel_mr; r++) {
+                            if (r >= mi) {
+                                Ap[r + l*kernel_mr] = c_zero;
+                            }
+                            else if (lower) {
+                                Ap[r + l*kernel_mr] = A(i0+r, l0+l);
+                            }
+                            else {
+                                Ap[r + l*kernel_mr] = conj( A(l0+l, i0+r) );
+                            }
+                        }
+                    }
+
+                    for (magma_int_t jr=0; jr < nj; jr += kernel_nr) {
+                        magma_int_t nr = min( kernel_nr, nj - jr );
+                        // skip tiles outside the triangle
+                        if ( lower && i0 + mi - 1 < j0 + jr ) {
+                            continue;
+                        }
+                        if ( ! lower && i0 > j0 + jr + nr - 1 ) {
+                            continue;
+                        }
+                        ssyrk_d_kernel( nl, Ap, Bp + jr*nl, AB );
+
+                        for (magma_int_t r2=0; r2 < nr; r2++) {
+                            magma_int_t j = j0 + jr + r2;
+                            for (magma_int_t r=0; r < mi; r++) {
+                                magma_int_t i = i0 + r;
+                                if (lower ? i >= j : i <= j) {
+                                    C(i, j) += AB[r + r2*kernel_mr];
+                                }
+                            }
+                        }
+                    }
                 }
-                C(i, j) = beta * C(i, j) + alpha * tmp;
             }
         }
     }
+
+    magma_free_cpu( work );
     return info;
 }
 
@@ -266,8 +407,11 @@ magma_ssytrf_nopiv_cpu(
     magma_int_t ione = 1;
     float alpha;
     float d_one = 1.0;
+    float d_neg_one = -1.0;
     float c_one     = MAGMA_S_ONE;
+    #ifdef SSYRK_D_WORKSPACE
     float c_neg_one = MAGMA_S_NEG_ONE;
+    #endif
 
     /* Check input arguments */
     *info = 0;
@@ -302,7 +446,6 @@ magma_ssytrf_nopiv_cpu(
 
                 /* Scale the block to divide by D */
                 for (magma_int_t k=0; k < sb; k++) {
-                    #define SSYRK_D_WORKSPACE
                     #ifdef SSYRK_D_WORKSPACE
                     for (magma_int_t ii=i+sb; ii < n; ii++) {
                         A(i+k, ii) = MAGMA_S_CONJ( A(ii, i+k) );
@@ -321,8 +464,8 @@ magma_ssytrf_nopiv_cpu(
                                               &A(i, i+sb),    lda );  // workspace, I am writing on upper part :)
                 #else
                 ssyrk_d( MagmaLower, height, sb,
-                         c_neg_one, &A(i+sb, i),    lda,      // A21
-                         c_one,     &A(i+sb, i+sb), lda,      // A22
+                         d_neg_one, &A(i+sb, i),    lda,      // A21
+                         d_one,     &A(i+sb, i+sb), lda,      // A22
                                     &A(i, i),       lda+1 );  // D11
                 #endif
             }
@@ -348,7 +491,6 @@ magma_ssytrf_nopiv_cpu(
 
                 /* Scale the block to divide by D */
                 for (magma_int_t k=0; k < sb; k++) {
-                    #define SSYRK_D_WORKSPACE
                     #ifdef SSYRK_D_WORKSPACE
                     for (magma_int_t ii=i+sb; ii < n; ii++) {
                         A(ii, i+k) = MAGMA_S_CONJ( A(i+k, ii) );
@@ -367,8 +509,8 @@ magma_ssytrf_nopiv_cpu(
                                               &A(i+sb, i),    lda );  // workspace, I am writing on upper part :)
                 #else
                 ssyrk_d( MagmaUpper, height, sb,
-                         c_neg_one, &A(i, i+sb),    lda,      // A21
-                         c_one,     &A(i+sb, i+sb), lda,      // A22
+                         d_neg_one, &A(i, i+sb),    lda,      // A21
+                         d_one,     &A(i+sb, i+sb), lda,      // A22
                                     &A(i, i),       lda+1 );  // D11
                 #endif
             }
@@ -0,0 +1,387 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "laswp_host.hpp"  // includes magma_internal.h, after the STL headers
+
+#define COMPLEX
+
+
+/******************************************************************************/
+// Symmetric permutation of the trailing m-by-m Hermitian matrix A, of which
+// only the lower triangle is stored: A = P*A*P**H, where row i of the result
+// is row perm[i] of the original. Host version of the lacpy_sym_in/out pair
+// used by magma_zhetrf_aasen: the columns that move are gathered into
+// work (m-by-count) from the original matrix, then scattered back.
+static void
+zhesymperm_lower(
+    magma_int_t m, magma_int_t count, const magma_int_t *rows,
+    const magma_int_t *perm,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magmaDoubleComplex *work )
+{
+    #define A(i_, j_)    (A    + (i_) + (j_)*lda)
+    #define work(i_, k_) (work + (i_) + (k_)*m)
+
+    // gather: work(i,k) = Aorig( perm[i], perm[t] ), where t is the target
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t k = 0; k < count; ++k) {
+        magma_int_t s = rows[2*k];
+        for (magma_int_t i = 0; i < m; ++i) {
+            magma_int_t p = perm[i];
+            *work(i,k) = (p >= s ? *A(p,s) : MAGMA_Z_CONJ( *A(s,p) ));
+        }
+    }
+
+    // scatter column t into the lower triangle. An element in both a moved
+    // row and a moved column is written only with the smaller target, i.e.,
+    // as part of column t.
+    #pragma omp parallel for schedule(static)
+    for (magma_int_t k = 0; k < count; ++k) {
+        magma_int_t t = rows[2*k+1];
+        for (magma_int_t i = 0; i < t; ++i) {
+            if (perm[i] == i) {
+                *A(t,i) = MAGMA_Z_CONJ( *work(i,k) );
+            }
+        }
+        for (magma_int_t i = t; i < m; ++i) {
+            *A(i,t) = *work(i,k);
+        }
+    }
+
+    #undef A
+    #undef work
+}
+
+
+/***************************************************************************//**
+    Purpose
+    =======
+
+    ZHETRF_AASEN_CPU computes the factorization of a complex Hermitian matrix A
+    based on a communication-avoiding variant of the Aasen's algorithm,
+    computed entirely on the CPU host.
+    The form of the factorization is
+
+     A = U*T*U**H  or  A = L*T*L**H
+
+    where U (or L) is a product of permutation and unit upper (lower)
+    triangular matrices, and T is Hermitian and banded matrix of the
+    band width equal to the block size, nb = magma_get_zhetrf_aasen_nb(n).
+
+    This is the host version of magma_zhetrf_aasen, and returns the
+    factorization in the same format. The independent block products that
+    form H(:,j), and the row blocks of the update of the panel L(:,j+1),
+    are computed by parallel threads, each running single-threaded BLAS;
+    the her2k and the panel LU use multi-threaded BLAS. The symmetric
+    pivoting moves only the rows and columns that are interchanged, in
+    parallel.
+    The banded T is factored by magma_zhetrs_aasen_cpu, with a band LU.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  Upper triangle of A is stored;
+      -     = MagmaLower:  Lower triangle of A is stored.
+            Only MagmaLower is currently implemented.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in,out]
+    A       COMPLEX*16 array, dimension (LDA,N)
+            On entry, the Hermitian matrix A.  If UPLO = MagmaLower, the
+            leading N-by-N lower triangular part of A contains the lower
+            triangular part of the matrix A, and the strictly upper
+            triangular part of A is not referenced.
+    \n
+            On exit, the banded matrix T and the triangular factor L.
+            T(j,j) is in the diagonal block A(j,j), the upper triangular
+            T(j+1,j) in the upper triangle of block A(j+1,j), and L(:,j+1)
+            is in the strictly lower part of block column j.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[out]
+    ipiv    INTEGER array, dimension (N)
+            Details of the interchanges: row and column i of A were
+            interchanged with row and column IPIV(i).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+
+    @ingroup magma_hetrf_aasen
+*******************************************************************************/
+extern "C" magma_int_t
+magma_zhetrf_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n,
+    magmaDoubleComplex *A, magma_int_t lda,
+    magma_int_t *ipiv, magma_int_t *info)
+{
+    #define A(i_, j_)  (A  + (j_)*nb*lda + (i_)*nb)
+    #define T(i_, j_)  (A  + (j_)*nb*lda + (i_)*nb)
+    #define L(i_, j_)  ((i_) == (j_) ? (hL + (i_)*nb) : (A + ((j_)-1)*nb*lda + (i_)*nb))
+    #define H(i_)      (hH + (i_)*nb)
+    #define W(i_)      (hW + (i_)*nb*nb)
+    #define X(i_)      (hX + (i_)*nb*nb)
+    #define Y(i_)      (hY + (i_)*nb*nb)
+
+    /* Constants */
+    const double d_one  = 1.0;
+    const magmaDoubleComplex c_one     = MAGMA_Z_ONE;
+    const magmaDoubleComplex c_zero    = MAGMA_Z_ZERO;
+    const magmaDoubleComplex c_neg_one = MAGMA_Z_NEG_ONE;
+    const magmaDoubleComplex c_neg_half = MAGMA_Z_MAKE( -0.5, 0.0 );
+    const magma_int_t ione = 1;
+
+    /* Local variables */
+    magmaDoubleComplex *hL=NULL, *hH=NULL, *hW=NULL, *hX=NULL, *hY=NULL, *hwork=NULL;
+    magma_int_t *perm=NULL, *rows=NULL;
+    magma_int_t nb = magma_get_zhetrf_aasen_nb( n );
+    magma_int_t nt, lapack_threads;
+
+    *info = 0;
+    if (uplo != MagmaLower) {
+        *info = MAGMA_ERR_NOT_IMPLEMENTED;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (lda < max(1,n)) {
+        *info = -4;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if ( n == 0 )
+        return *info;
+
+    nt = magma_ceildiv( n, nb );
+    if (MAGMA_SUCCESS != magma_zmalloc_cpu( &hL,    lda*nb ) ||
+        MAGMA_SUCCESS != magma_zmalloc_cpu( &hH,    lda*nb ) ||
+        MAGMA_SUCCESS != magma_zmalloc_cpu( &hW,    nb*nb*nt ) ||
+        MAGMA_SUCCESS != magma_zmalloc_cpu( &hX,    nb*nb*nt ) ||
+        MAGMA_SUCCESS != magma_zmalloc_cpu( &hY,    nb*nb*nt ) ||
+        MAGMA_SUCCESS != magma_zmalloc_cpu( &hwork, n*2*nb ) ||
+        MAGMA_SUCCESS != magma_imalloc_cpu( &perm,  n ) ||
+        MAGMA_SUCCESS != magma_imalloc_cpu( &rows,  2*(2*nb) ))
+    {
+        *info = MAGMA_ERR_HOST_ALLOC;
+        goto cleanup;
+    }
+
+    for (magma_int_t ii=0; ii < n; ii++) {
+        perm[ii] = ii;
+    }
+    for (magma_int_t ii=0; ii < min(n,nb); ii++) {
+        ipiv[ii] = ii+1;
+    }
+
+    lapack_threads = magma_get_lapack_numthreads();
+
+    //=========================================================
+    // Compute the Aasen's factorization P*A*P' = L*T*L'.
+    for (magma_int_t j=0; j < nt; j++) {
+        magma_int_t jb = min( nb, n-j*nb );
+
+        // Compute off-diagonal blocks of H(:,j),
+        // i.e., H(i,j) = T(i,i-1)*L(j,i-1)' + T(i,i)*L(j,i)' + T(i,i+1)*L(j,i+1)',
+        // and W(i) = ( T(i,i+1)*L(j,i+1)' + .5*T(i,i)*L(j,i)' )' for the her2k.
+        // H(0,j) and W(0) are not needed since they are multiplied with L(:,0) = 0.
+        // Blocks are independent, so each thread computes some of them.
+        magma_set_lapack_numthreads( 1 );
+        #pragma omp parallel for schedule(dynamic)
+        for (magma_int_t i=1; i < j; i++) {
+            magma_int_t kb = (i < j-1 ? nb : jb);
+            // X(i) = T(i,i) * L(j,i)'
+            blasf77_zgemm( MagmaNoTransStr, MagmaConjTransStr,
+                           &nb, &jb, &nb,
+                           &c_one,  T(i,i), &lda,
+                                    L(j,i), &lda,
+                           &c_zero, X(i),   &nb );
+            // H(i,j) = T(i,i+1) * L(j,i+1)' + X(i)
+            blasf77_zgemm( MagmaConjTransStr, MagmaConjTransStr,
+                           &nb, &jb, &kb,
+                           &c_one,  T(i+1,i), &lda,
+                                    L(j,i+1), &lda,
+                           &c_zero, H(i),     &lda );
+            for (magma_int_t jj=0; jj < jb; jj++) {
+                blasf77_zaxpy( &nb, &c_one, X(i) + jj*nb, &ione, H(i) + jj*lda, &ione );
+            }
+            // Y(i) = H(i,j) - .5*X(i), and W(i) = Y(i)'
+            lapackf77_zlacpy( MagmaFullStr, &nb, &jb, H(i), &lda, Y(i), &nb );
+            for (magma_int_t jj=0; jj < jb; jj++) {
+                blasf77_zaxpy( &nb, &c_neg_half, X(i) + jj*nb, &ione, Y(i) + jj*nb, &ione );
+            }
+            for (magma_int_t jj=0; jj < jb; jj++) {
+                for (magma_int_t ii=0; ii < nb; ii++) {
+                    #ifdef COMPLEX
+                    W(i)[jj + ii*nb] = MAGMA_Z_CONJ( Y(i)[ii + jj*nb] );
+                    #else
+                    W(i)[jj + ii*nb] = Y(i)[ii + jj*nb];
+                    #endif
+                }
+            }
+            // H(i,j) += T(i,i-1) * L(j,i-1)'
+            if (i > 1) { // if i == 1, then L(j,i-1) = 0
+                blasf77_zgemm( MagmaNoTransStr, MagmaConjTransStr,
+                               &nb, &jb, &nb,
+                               &c_one, T(i,i-1), &lda,
+                                       L(j,i-1), &lda,
+                               &c_one, H(i),     &lda );
+            }
+        }
+        magma_set_lapack_numthreads( lapack_threads );
+
+        // compute T(j, j) = A(j,j) - L(j,1:j)*H(1:j,j) (where T is A in memory)
+        if (j > 1) {
+            magma_int_t k = (j-1)*nb;
+            blasf77_zher2k( MagmaLowerStr, MagmaNoTransStr,
+                            &jb, &k,
+                            &c_neg_one, L(j,1), &lda,
+                                        W(1),   &nb,
+                            &d_one,     T(j,j), &lda );
+        }
+        // symmetrize T(j,j); as in LAPACK, the imaginary parts of the
+        // diagonal of A are assumed to be zero
+        for (magma_int_t jj=0; jj < jb; jj++) {
+            #ifdef COMPLEX
+            T(j,j)[jj + jj*lda] = MAGMA_Z_MAKE( MAGMA_Z_REAL( T(j,j)[jj + jj*lda] ), 0. );
+            #endif
+            for (magma_int_t ii=jj+1; ii < jb; ii++) {
+                T(j,j)[jj + ii*lda] = MAGMA_Z_CONJ( T(j,j)[ii + jj*lda] );
+            }
+        }
+        // > Compute T(j,j) = L(j,j)^-1 T(j,j) L(j,j)^-H
+        if (j > 0) { // if j == 0, then L(j,j) = I
+            blasf77_ztrsm( MagmaLeftStr, MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr,
+                           &jb, &jb,
+                           &c_one, L(j,j), &lda,
+                                   T(j,j), &lda );
+            blasf77_ztrsm( MagmaRightStr, MagmaLowerStr, MagmaConjTransStr, MagmaUnitStr,
+                           &jb, &jb,
+                           &c_one, L(j,j), &lda,
+                                   T(j,j), &lda );
+        }
+
+        if (j < nt-1) {
+            // ** Panel + Update **
+            magma_int_t ib = n-(j+1)*nb;
+            magma_int_t mb = min( ib, jb );
+            magma_int_t iinfo;
+
+            // compute H(j,j)
+            // > H(j,j) = T(j,j)*L(j,j)'
+            //   H(0,0) is not needed since it is multiplied with L(j+1:n,0)
+            if (j >= 1) {
+                blasf77_zgemm( MagmaNoTransStr, MagmaConjTransStr,
+                               &jb, &jb, &jb,
+                               &c_one,  T(j,j), &lda,
+                                        L(j,j), &lda,
+                               &c_zero, H(j),   &lda );
+                if (j >= 2) {
+                    // > H(j,j) += T(j,j-1)*L(j,j-1)'
+                    blasf77_zgemm( MagmaNoTransStr, MagmaConjTransStr,
+                                   &jb, &jb, &nb,
+                                   &c_one, T(j,j-1), &lda,
+                                           L(j,j-1), &lda,
+                                   &c_one, H(j),     &lda );
+                }
+            }
+
+            // extract L(:, j+1), A(j+1:nt,j) -= L(j+1:nt,1:j) H(1:j,j),
+            // by row blocks in parallel
+            if (j >= 1) {
+                magma_int_t k = j*nb;
+                magma_set_lapack_numthreads( 1 );
+                #pragma omp parallel for schedule(dynamic)
+                for (magma_int_t i=j+1; i < nt; i++) {
+                    magma_int_t mi = min( nb, n-i*nb );
+                    blasf77_zgemm( MagmaNoTransStr, MagmaNoTransStr,
+                                   &mi, &jb, &k,
+                                   &c_neg_one, L(i,1), &lda,
+                                               H(1),   &lda,
+                                   &c_one,     A(i,j), &lda );
+                }
+                magma_set_lapack_numthreads( lapack_threads );
+            }
+
+            // panel factorization
+            lapackf77_zgetrf( &ib, &jb, A(j+1,j), &lda, &ipiv[(1+j)*nb], &iinfo );
+            // iinfo > 0 means T(j+1,j) is singular, which is not an error
+
+            // save L(j+1,j+1), and make it unit-lower triangular
+            lapackf77_zlacpy( MagmaFullStr, &mb, &mb, A(j+1,j), &lda, L(j+1,j+1), &lda );
+            lapackf77_zlaset( MagmaUpperStr, &mb, &mb, &c_zero, &c_one, L(j+1,j+1), &lda );
+            // extract T(j+1,j)
+            magma_int_t mb1 = mb-1, jb1 = jb-1;
+            lapackf77_zlaset( MagmaLowerStr, &mb1, &jb1, &c_zero, &c_zero, T(j+1,j)+1, &lda );
+            if (j > 0) {
+                blasf77_ztrsm( MagmaRightStr, MagmaLowerStr, MagmaConjTransStr, MagmaUnitStr,
+                               &mb, &jb,
+                               &c_one, L(j,j),   &lda,
+                                       T(j+1,j), &lda );
+            }
+
+            // apply pivot back to L(j+1:nt, 1:j)
+            if (j > 0) {
+                magma_int_t k = j*nb;
+                magma_laswp_plan plan( 0, mb, &ipiv[(j+1)*nb], 1 );
+                magma_laswp_host_cols( plan, k, L(j+1,1), lda );
+            }
+            // symmetric pivot of the trailing matrix
+            for (magma_int_t ii=0; ii < mb; ii++) {
+                magma_int_t piv = perm[ipiv[(j+1)*nb+ii]-1];
+                perm[ipiv[(j+1)*nb+ii]-1] = perm[ii];
+                perm[ii] = piv;
+            }
+            magma_int_t count = 0;
+            for (magma_int_t ii=0; ii < ib; ii++) {
+                if (perm[ii] != ii) {
+                    rows[2*count]   = perm[ii];
+                    rows[2*count+1] = ii;
+                    count++;
+                }
+            }
+            zhesymperm_lower( ib, count, rows, perm, A(j+1,j+1), lda, hwork );
+            // reset perm
+            for (magma_int_t ii=0; ii < count; ii++) {
+                perm[rows[2*ii+1]] = rows[2*ii+1];
+            }
+            for (magma_int_t k=(1+j)*nb; k < (1+j)*nb+mb; k++) {
+                ipiv[k] += (j+1)*nb;
+            }
+        }
+    }
+
+    // put L(j+1,j+1) below T(j+1,j)
+    for (magma_int_t j=0; j < nt-1; j++) {
+        magma_int_t jb2 = min( nb, n-(j+1)*nb ) - 1;
+        lapackf77_zlacpy( MagmaLowerStr, &jb2, &jb2, L(j+1,j+1)+1, &lda, A(j+1,j)+1, &lda );
+    }
+
+cleanup:
+    magma_free_cpu( hL );
+    magma_free_cpu( hH );
+    magma_free_cpu( hW );
+    magma_free_cpu( hX );
+    magma_free_cpu( hY );
+    magma_free_cpu( hwork );
+    magma_free_cpu( perm );
+    magma_free_cpu( rows );
+
+    return *info;
+} /* magma_zhetrf_aasen_cpu */
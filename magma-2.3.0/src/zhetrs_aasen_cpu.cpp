@@ -0,0 +1,282 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+#include "task_scheduler.hpp"
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZHETRS_AASEN_CPU solves a system of linear equations A*X = B with a
+    complex Hermitian matrix A using the factorization A = L*T*L**H computed
+    by ZHETRF_AASEN_CPU (or ZHETRF_AASEN), on the CPU host.
+
+    The banded T is block tridiagonal, with blocks of size
+    nb = magma_get_zhetrf_aasen_nb(n). It is copied to a block band storage,
+    where block column k holds block rows k-2 to k+1, leaving room for the
+    fill from pivoting. T is factored there by a block band LU with partial
+    pivoting: for block column k, a panel task factors the 2*nb-by-nb
+    panel, and two tasks apply it to block columns k+1 and k+2. The forward
+    and backward band solves are tasks on nb-by-nb blocks of B.
+    magma_task_scheduler executes these tasks as soon as the blocks they
+    depend on are ready, so the update of block column k+2 proceeds in
+    parallel with the panel of k+1, and the solve of each block of right
+    hand sides proceeds in parallel with the factorization.
+
+    Arguments
+    ---------
+    @param[in]
+    uplo    magma_uplo_t
+      -     = MagmaUpper:  Upper triangle of A is stored;
+      -     = MagmaLower:  Lower triangle of A is stored.
+            Only MagmaLower is currently implemented.
+
+    @param[in]
+    n       INTEGER
+            The order of the matrix A.  N >= 0.
+
+    @param[in]
+    nrhs    INTEGER
+            The number of right hand sides, i.e., the number of columns
+            of the matrix B.  NRHS >= 0.
+
+    @param[in]
+    A       COMPLEX_16 array, dimension (LDA,N)
+            The banded matrix T and the triangular factor L, as computed by
+            ZHETRF_AASEN_CPU.
+
+    @param[in]
+    lda     INTEGER
+            The leading dimension of the array A.  LDA >= max(1,N).
+
+    @param[in]
+    ipiv    INTEGER array, dimension (N)
+            Details of the interchanges as computed by ZHETRF_AASEN_CPU.
+
+    @param[in,out]
+    B       COMPLEX_16 array, dimension (LDB,NRHS)
+            On entry, the right hand side matrix B.
+            On exit, the solution matrix X.
+
+    @param[in]
+    ldb     INTEGER
+            The leading dimension of the array B.  LDB >= max(1,N).
+
+    @param[out]
+    info    INTEGER
+      -     = 0:  successful exit
+      -     < 0:  if INFO = -i, the i-th argument had an illegal value
+                  or another error occured, such as memory allocation failed.
+      -     > 0:  if INFO = i, U(i,i) of the band LU of T is exactly zero,
+                  so T is singular and the solution could not be computed.
+
+    @ingroup magma_hetrf_aasen
+*******************************************************************************/
+extern "C" magma_int_t
+magma_zhetrs_aasen_cpu(
+    magma_uplo_t uplo, magma_int_t n, magma_int_t nrhs,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    const magma_int_t *ipiv,
+    magmaDoubleComplex *B, magma_int_t ldb,
+    magma_int_t *info)
+{
+    #define A(i_, j_)   (A  + (i_)*nb + (j_)*nb*lda)
+    #define B(i_, j_)   (B  + (i_)*nb + (j_)*nb*ldb)
+    #define L(i_, j_)   (A  + (i_)*nb + ((j_)-1)*nb*lda)  // L(i,j), j >= 1
+    // slot s of block column k of T holds block row k-2+s
+    #define T(k_, s_)   (hT + (k_)*ldt*nb + (s_)*nb)
+
+    /* Constants */
+    const magmaDoubleComplex c_one     = MAGMA_Z_ONE;
+    const magmaDoubleComplex c_neg_one = MAGMA_Z_NEG_ONE;
+    const magmaDoubleComplex c_zero    = MAGMA_Z_ZERO;
+    const magma_int_t ione     = 1;
+    const magma_int_t ineg_one = -1;
+
+    /* Local variables */
+    magmaDoubleComplex *hT = NULL;
+    magma_int_t *tpiv = NULL;
+    magma_int_t nb = magma_get_zhetrf_aasen_nb( n );
+    magma_int_t nt, jt, ldt, lapack_threads;
+
+    *info = 0;
+    if (uplo != MagmaLower) {
+        *info = MAGMA_ERR_NOT_IMPLEMENTED;
+    } else if (n < 0) {
+        *info = -2;
+    } else if (nrhs < 0) {
+        *info = -3;
+    } else if (lda < max(1,n)) {
+        *info = -5;
+    } else if (ldb < max(1,n)) {
+        *info = -8;
+    }
+    if (*info != 0) {
+        magma_xerbla( __func__, -(*info) );
+        return *info;
+    }
+
+    /* Quick return */
+    if (n == 0 || nrhs == 0)
+        return *info;
+
+    nt  = magma_ceildiv( n,    nb );
+    jt  = magma_ceildiv( nrhs, nb );
+    ldt = 4*nb;
+    if (MAGMA_SUCCESS != magma_zmalloc_cpu( &hT,   ldt*nb*nt ) ||
+        MAGMA_SUCCESS != magma_imalloc_cpu( &tpiv, n ))
+    {
+        magma_free_cpu( hT );
+        *info = MAGMA_ERR_HOST_ALLOC;
+        return *info;
+    }
+
+    /* B = P*B */
+    lapackf77_zlaswp( &nrhs, B, &ldb, &ione, &n, ipiv, &ione );
+
+    /* B = L^{-1} B; L(:,0) is the identity */
+    for (magma_int_t k=1; k < nt; k++) {
+        magma_int_t kb = min( nb, n-k*nb );
+        magma_int_t mk = n - (k+1)*nb;
+        blasf77_ztrsm( MagmaLeftStr, MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr,
+                       &kb, &nrhs, &c_one, L(k,k), &lda, B(k,0), &ldb );
+        if (mk > 0) {
+            blasf77_zgemm( MagmaNoTransStr, MagmaNoTransStr, &mk, &nrhs, &kb,
+                           &c_neg_one, L(k+1,k), &lda, B(k,0),   &ldb,
+                           &c_one,                     B(k+1,0), &ldb );
+        }
+    }
+
+    /* copy T to block band storage */
+    magma_int_t ncol = nt*nb;
+    lapackf77_zlaset( MagmaFullStr, &ldt, &ncol, &c_zero, &c_zero, hT, &ldt );
+    for (magma_int_t k=0; k < nt; k++) {
+        magma_int_t kb = min( nb, n-k*nb );
+        lapackf77_zlacpy( MagmaFullStr, &kb, &kb, A(k,k), &lda, T(k,2), &ldt );
+        if (k+1 < nt) {
+            // T(k+1,k) is upper triangular; T(k,k+1) = T(k+1,k)^H
+            magma_int_t rb = min( nb, n-(k+1)*nb );
+            for (magma_int_t jj=0; jj < kb; jj++) {
+                for (magma_int_t ii=0; ii <= min( jj, rb-1 ); ii++) {
+                    magmaDoubleComplex t = A(k+1,k)[ii + jj*lda];
+                    T(k,3)  [ii + jj*ldt] = t;
+                    T(k+1,1)[jj + ii*ldt] = MAGMA_Z_CONJ( t );
+                }
+            }
+        }
+    }
+
+    /* Band LU of T, and Y = T^{-1} B */
+    lapack_threads = magma_get_lapack_numthreads();
+    magma_set_lapack_numthreads( 1 );
+    {
+        magma_task_scheduler dag;
+        dag.launch( magma_get_parallel_numthreads() );
+
+        for (magma_int_t k=0; k < nt; k++) {
+            magma_int_t kb = min( nb, n-k*nb );
+            magma_int_t mk = min( 2*nb, n-k*nb );  // rows in panel
+            magma_int_t *kpiv = tpiv + k*nb;
+
+            // factor panel [ T(k,k); T(k+1,k) ]
+            dag.insert( { magma_task_write( T(k,0) ) }, [=] {
+                magma_int_t iinfo;
+                lapackf77_zgetrf( &mk, &kb, T(k,2), &ldt, kpiv, &iinfo );
+                if (iinfo > 0 && *info == 0) {
+                    *info = iinfo + k*nb;
+                }
+            });
+
+            // apply to block columns k+1 (block rows k, k+1 in slots 1, 2)
+            // and k+2 (fill in slot 0, and slot 1)
+            for (magma_int_t c=k+1; c < min( k+3, nt ); c++) {
+                magma_int_t cb = min( nb, n-c*nb );
+                magma_int_t s0 = k - c + 2;
+                dag.insert( { magma_task_read( T(k,0) ), magma_task_write( T(c,0) ) }, [=] {
+                    magma_int_t m2 = mk - kb;
+                    lapackf77_zlaswp( &cb, T(c,s0), &ldt, &ione, &kb, kpiv, &ione );
+                    blasf77_ztrsm( MagmaLeftStr, MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr,
+                                   &kb, &cb, &c_one, T(k,2), &ldt, T(c,s0), &ldt );
+                    blasf77_zgemm( MagmaNoTransStr, MagmaNoTransStr, &m2, &cb, &kb,
+                                   &c_neg_one, T(k,3),    &ldt, T(c,s0), &ldt,
+                                   &c_one,     T(c,s0+1), &ldt );
+                });
+            }
+
+            // forward solve with the panel, for each block of right hand sides
+            for (magma_int_t j=0; j < jt; j++) {
+                magma_int_t jb = min( nb, nrhs-j*nb );
+                std::vector< magma_task_access > access;
+                access.push_back( magma_task_read( T(k,0) ));
+                access.push_back( magma_task_write( B(k,j) ));
+                if (k+1 < nt) {
+                    access.push_back( magma_task_write( B(k+1,j) ));
+                }
+                dag.insert( access, [=] {
+                    magma_int_t m2 = mk - kb;
+                    lapackf77_zlaswp( &jb, B(k,j), &ldb, &ione, &kb, kpiv, &ione );
+                    blasf77_ztrsm( MagmaLeftStr, MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr,
+                                   &kb, &jb, &c_one, T(k,2), &ldt, B(k,j), &ldb );
+                    blasf77_zgemm( MagmaNoTransStr, MagmaNoTransStr, &m2, &jb, &kb,
+                                   &c_neg_one, T(k,3),   &ldt, B(k,j), &ldb,
+                                   &c_one,     B(k+1,j), &ldb );
+                });
+            }
+        }
+
+        // backward solve with U, which has two block superdiagonals
+        for (magma_int_t k=nt-1; k >= 0; k--) {
+            magma_int_t kb = min( nb, n-k*nb );
+            for (magma_int_t j=0; j < jt; j++) {
+                magma_int_t jb = min( nb, nrhs-j*nb );
+                std::vector< magma_task_access > access;
+                access.push_back( magma_task_read( T(k,0) ));
+                access.push_back( magma_task_write( B(k,j) ));
+                for (magma_int_t c=k+1; c < min( k+3, nt ); c++) {
+                    access.push_back( magma_task_read( T(c,0) ));
+                    access.push_back( magma_task_read( B(c,j) ));
+                }
+                dag.insert( access, [=] {
+                    for (magma_int_t c=k+1; c < min( k+3, nt ); c++) {
+                        magma_int_t cb = min( nb, n-c*nb );
+                        blasf77_zgemm( MagmaNoTransStr, MagmaNoTransStr, &kb, &jb, &cb,
+                                       &c_neg_one, T(c,k-c+2), &ldt, B(c,j), &ldb,
+                                       &c_one,                       B(k,j), &ldb );
+                    }
+                    blasf77_ztrsm( MagmaLeftStr, MagmaUpperStr, MagmaNoTransStr, MagmaNonUnitStr,
+                                   &kb, &jb, &c_one, T(k,2), &ldt, B(k,j), &ldb );
+                });
+            }
+        }
+
+        dag.sync();
+        dag.quit();
+    }
+    magma_set_lapack_numthreads( lapack_threads );
+
+    /* B = L^{-H} B */
+    for (magma_int_t k=nt-1; k >= 1; k--) {
+        magma_int_t kb = min( nb, n-k*nb );
+        magma_int_t mk = n - (k+1)*nb;
+        if (mk > 0) {
+            blasf77_zgemm( MagmaConjTransStr, MagmaNoTransStr, &kb, &nrhs, &mk,
+                           &c_neg_one, L(k+1,k), &lda, B(k+1,0), &ldb,
+                           &c_one,                     B(k,0),   &ldb );
+        }
+        blasf77_ztrsm( MagmaLeftStr, MagmaLowerStr, MagmaConjTransStr, MagmaUnitStr,
+                       &kb, &nrhs, &c_one, L(k,k), &lda, B(k,0), &ldb );
+    }
+
+    /* B = P^T*B */
+    lapackf77_zlaswp( &nrhs, B, &ldb, &ione, &n, ipiv, &ineg_one );
+
+    magma_free_cpu( hT );
+    magma_free_cpu( tpiv );
+
+    return *info;
+} /* magma_zhetrs_aasen_cpu */
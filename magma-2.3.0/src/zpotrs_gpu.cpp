@@ -65,9 +65,6 @@ magma_zpotrs_gpu(
     magmaDoubleComplex_ptr dB, magma_int_t lddb,
     magma_int_t *info)
 {
-    // Constants
-    const magmaDoubleComplex c_one = MAGMA_Z_ONE;
-
     *info = 0;
     if ( uplo != MagmaUpper && uplo != MagmaLower )
         *info = -1;
@@ -99,8 +96,7 @@ magma_zpotrs_gpu(
             magma_ztrsv( MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, dA, ldda, dB, 1, queue );
             magma_ztrsv( MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, dA, ldda, dB, 1, queue );
         } else {
-            magma_ztrsm( MagmaLeft, MagmaUpper, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
-            magma_ztrsm( MagmaLeft, MagmaUpper, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+            magmablas_zpotrs_trsm( MagmaUpper, n, nrhs, dA, ldda, dB, lddb, queue );
         }
     }
     else {
@@ -108,8 +104,7 @@ magma_zpotrs_gpu(
             magma_ztrsv( MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, dA, ldda, dB, 1, queue );
             magma_ztrsv( MagmaLower, MagmaConjTrans, MagmaNonUnit, n, dA, ldda, dB, 1, queue );
         } else {
-            magma_ztrsm( MagmaLeft, MagmaLower, MagmaNoTrans,   MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
-            magma_ztrsm( MagmaLeft, MagmaLower, MagmaConjTrans, MagmaNonUnit, n, nrhs, c_one, dA, ldda, dB, lddb, queue );
+            magmablas_zpotrs_trsm( MagmaLower, n, nrhs, dA, ldda, dB, lddb, queue );
         }
     }
 
@@ -0,0 +1,376 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+
+*/
+#include "batched_compact.hpp"  // includes magma_internal.h after <algorithm>
+
+/******************************************************************************/
+// Common code for magma_ztrsm_batched_cpu and magma_ztrsm_vbatched_cpu;
+// m_array, n_array, lda_array, and ldb_array are NULL for a fixed size batch.
+static void
+magma_ztrsm_batched_cpu_core(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, const magma_int_t *m_array,
+    magma_int_t n, const magma_int_t *n_array,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex **A_array, magma_int_t lda, const magma_int_t *lda_array,
+    magmaDoubleComplex **B_array, magma_int_t ldb, const magma_int_t *ldb_array,
+    magma_int_t batchCount )
+{
+    typedef magmaDoubleComplex T;
+    const int L = magma_compact_traits< T >::lanes;
+    const magmaDoubleComplex c_zero = MAGMA_Z_ZERO;
+
+    // The kernel solves op(A) X = B with op(A) = A or A^T.
+    // Reduce the other cases to these, with A and B transposed when packed:
+    // left,  ConjTrans:  A^H X = B            with A^H packed, uplo swapped;
+    // right, NoTrans:    A^T X^T = B^T;
+    // right, Trans:      A   X^T = B^T;
+    // right, ConjTrans:  A   X^H = conj(alpha) B^H.
+    magma_trans_t opA, opB, opK;
+    magma_uplo_t uploK = uplo;
+    magmaDoubleComplex alphaK = alpha;
+    if (side == MagmaLeft) {
+        opB = MagmaNoTrans;
+        if (transA == MagmaConjTrans) {
+            opA   = MagmaConjTrans;
+            opK   = MagmaNoTrans;
+            uploK = (uplo == MagmaLower ? MagmaUpper : MagmaLower);
+        }
+        else {
+            opA = MagmaNoTrans;
+            opK = transA;
+        }
+    }
+    else {
+        opA = MagmaNoTrans;
+        if (transA == MagmaNoTrans) {
+            opB = MagmaTrans;
+            opK = MagmaTrans;
+        }
+        else if (transA == MagmaTrans) {
+            opB = MagmaTrans;
+            opK = MagmaNoTrans;
+        }
+        else {
+            opB    = MagmaConjTrans;
+            opK    = MagmaNoTrans;
+            alphaK = MAGMA_Z_CONJ( alpha );
+        }
+    }
+
+    magma_compact_groups groups;
+    magma_compact_make_groups( batchCount, L, m, n, m_array, n_array, groups );
+
+    magma_compact_parallel_groups< T >( groups,
+        [&]( const magma_int_t* idx, magma_int_t count, std::vector< T >& work )
+        {
+            magma_int_t mk = (m_array ? m_array[ idx[0] ] : m);
+            magma_int_t nk = (n_array ? n_array[ idx[0] ] : n);
+            T *Aptr[ L ], *Bptr[ L ];
+            magma_int_t lda_[ L ], ldb_[ L ];
+            for (magma_int_t l = 0; l < count; ++l) {
+                Aptr[l] = A_array[ idx[l] ];
+                Bptr[l] = B_array[ idx[l] ];
+                lda_[l] = (lda_array ? lda_array[ idx[l] ] : lda);
+                ldb_[l] = (ldb_array ? ldb_array[ idx[l] ] : ldb);
+            }
+            if (mk <= 0 || nk <= 0)
+                return;
+
+            if (MAGMA_Z_EQUAL( alpha, c_zero )) {
+                for (magma_int_t l = 0; l < count; ++l) {
+                    lapackf77_zlaset( "F", &mk, &nk, &c_zero, &c_zero, Bptr[l], &ldb_[l] );
+                }
+                return;
+            }
+
+            if (mk > magma_compact_max_size || nk > magma_compact_max_size) {
+                for (magma_int_t l = 0; l < count; ++l) {
+                    blasf77_ztrsm( lapack_side_const(side), lapack_uplo_const(uplo),
+                                   lapack_trans_const(transA), lapack_diag_const(diag),
+                                   &mk, &nk, &alpha, Aptr[l], &lda_[l], Bptr[l], &ldb_[l] );
+                }
+                return;
+            }
+
+            // the kernel's B is mb-by-nb, with A of order mb
+            magma_int_t mb = (side == MagmaLeft ? mk : nk);
+            magma_int_t nb = (side == MagmaLeft ? nk : mk);
+            work.resize( (mb*mb + mb*nb + mb)*L );
+            T* Ac   = &work[0];
+            T* Bc   = Ac + mb*mb*L;
+            T* invd = Bc + mb*nb*L;
+
+            magma_compact_pack( opA, mb, mb, Aptr, lda_, count, Ac, true );
+            magma_compact_pack( opB, mb, nb, Bptr, ldb_, count, Bc, false );
+            if (! MAGMA_Z_EQUAL( alphaK, MAGMA_Z_ONE )) {
+                for (magma_int_t i = 0; i < mb*nb*L; ++i) {
+                    Bc[i] *= alphaK;
+                }
+            }
+            magma_compact_dispatch< magma_compact_nt_max, magma_trsm_compact_kernel< T > >
+                ::run( mb, uploK, opK, diag, nb, Ac, Bc, invd );
+            magma_compact_unpack( opB, MagmaFull, mb, nb, Bc, Bptr, ldb_, count );
+        });
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZTRSM_BATCHED_CPU solves one of the matrix equations
+
+        op(A_i) * X_i = alpha * B_i,   or   X_i * op(A_i) = alpha * B_i,
+
+    for a batch of triangular matrices A_i and right hand sides B_i,
+    on the CPU host, where op(A) = A, A**T, or A**H.
+    X_i overwrites B_i.
+
+    For M, N <= 64, groups of systems are interleaved in SIMD lanes (the
+    compact layout of batched_compact.hpp) and solved together, with a
+    kernel specialized at compile time for triangular matrices of order
+    <= 32. Larger systems are solved one at a time by BLAS.
+    Systems are distributed over the OpenMP threads.
+
+    Arguments
+    ---------
+    @param[in]
+    side    magma_side_t.
+            On entry, side specifies whether op(A) appears on the left
+            or right of X as follows:
+      -     = MagmaLeft:  op(A)*X = alpha*B.
+      -     = MagmaRight: X*op(A) = alpha*B.
+
+    @param[in]
+    uplo    magma_uplo_t.
+            On entry, uplo specifies whether the matrix A is an upper or
+            lower triangular matrix as follows:
+      -     = MagmaUpper:  A is an upper triangular matrix.
+      -     = MagmaLower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  magma_trans_t.
+            On entry, transA specifies the form of op(A) to be used in
+            the matrix multiplication as follows:
+      -     = MagmaNoTrans:    op(A) = A.
+      -     = MagmaTrans:      op(A) = A**T.
+      -     = MagmaConjTrans:  op(A) = A**H.
+
+    @param[in]
+    diag    magma_diag_t.
+            On entry, diag specifies whether or not A is unit triangular
+            as follows:
+      -     = MagmaUnit:    A is assumed to be unit triangular.
+      -     = MagmaNonUnit: A is not assumed to be unit triangular.
+
+    @param[in]
+    m       INTEGER.
+            On entry, m specifies the number of rows of each B_i.  M >= 0.
+
+    @param[in]
+    n       INTEGER.
+            On entry, n specifies the number of columns of each B_i.  N >= 0.
+
+    @param[in]
+    alpha   COMPLEX_16.
+            On entry, alpha specifies the scalar alpha. When alpha is
+            zero then A is not referenced and B need not be set before
+            entry.
+
+    @param[in]
+    A_array Array of pointers, dimension (batchCount).
+            Each is a COMPLEX_16 array A_i of dimension (LDA,k), where k is
+            m when side = MagmaLeft and is n when side = MagmaRight,
+            holding the triangular matrix in its uplo triangle.
+
+    @param[in]
+    lda     INTEGER.
+            The leading dimension of each A_i.
+            When side = MagmaLeft,  LDA >= max( 1, m ),
+            when side = MagmaRight, LDA >= max( 1, n ).
+
+    @param[in,out]
+    B_array Array of pointers, dimension (batchCount).
+            Each is a COMPLEX_16 array B_i of dimension (LDB,N).
+            On entry, the m-by-n right hand side B_i.
+            On exit, the solution X_i.
+
+    @param[in]
+    ldb     INTEGER.
+            The leading dimension of each B_i.  LDB >= max( 1, m ).
+
+    @param[in]
+    batchCount  INTEGER
+                The number of systems to solve.
+
+    @ingroup magma_trsm_batched
+*******************************************************************************/
+extern "C" void
+magma_ztrsm_batched_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t m, magma_int_t n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex **A_array, magma_int_t lda,
+    magmaDoubleComplex **B_array, magma_int_t ldb,
+    magma_int_t batchCount )
+{
+    magma_int_t nrowA = (side == MagmaLeft ? m : n);
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -2;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -3;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -4;
+    } else if (m < 0) {
+        info = -5;
+    } else if (n < 0) {
+        info = -6;
+    } else if (lda < max(1,nrowA)) {
+        info = -9;
+    } else if (ldb < max(1,m)) {
+        info = -11;
+    } else if (batchCount < 0) {
+        info = -12;
+    }
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    /* Quick return if possible */
+    if (batchCount == 0)
+        return;
+
+    magma_ztrsm_batched_cpu_core( side, uplo, transA, diag, m, NULL, n, NULL,
+                                  alpha, A_array, lda, NULL, B_array, ldb, NULL,
+                                  batchCount );
+}
+
+
+/***************************************************************************//**
+    Purpose
+    -------
+    ZTRSM_VBATCHED_CPU solves a batch of triangular systems of variable
+    sizes on the CPU host,
+
+        op(A_i) * X_i = alpha * B_i,   or   X_i * op(A_i) = alpha * B_i.
+
+    See magma_ztrsm_batched_cpu. The systems are sorted into size classes,
+    the systems with the same M[i] and N[i], and each class is solved as a
+    fixed size batch.
+
+    Arguments
+    ---------
+    @param[in]
+    side    magma_side_t.
+      -     = MagmaLeft:  op(A)*X = alpha*B.
+      -     = MagmaRight: X*op(A) = alpha*B.
+
+    @param[in]
+    uplo    magma_uplo_t.
+      -     = MagmaUpper:  A is an upper triangular matrix.
+      -     = MagmaLower:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  magma_trans_t.
+      -     = MagmaNoTrans:    op(A) = A.
+      -     = MagmaTrans:      op(A) = A**T.
+      -     = MagmaConjTrans:  op(A) = A**H.
+
+    @param[in]
+    diag    magma_diag_t.
+      -     = MagmaUnit:    A is assumed to be unit triangular.
+      -     = MagmaNonUnit: A is not assumed to be unit triangular.
+
+    @param[in]
+    m       Array of INTEGERs, dimension (batchCount).
+            The number of rows of each B_i.  M[i] >= 0.
+
+    @param[in]
+    n       Array of INTEGERs, dimension (batchCount).
+            The number of columns of each B_i.  N[i] >= 0.
+
+    @param[in]
+    alpha   COMPLEX_16.
+            The scalar alpha, the same for all systems.
+
+    @param[in]
+    A_array Array of pointers, dimension (batchCount).
+            Each is a COMPLEX_16 array A_i of dimension (LDA[i],k), where k
+            is M[i] when side = MagmaLeft and is N[i] when side = MagmaRight.
+
+    @param[in]
+    lda     Array of INTEGERs, dimension (batchCount).
+            The leading dimension of each A_i.  LDA[i] >= max( 1, k ).
+
+    @param[in,out]
+    B_array Array of pointers, dimension (batchCount).
+            Each is a COMPLEX_16 array B_i of dimension (LDB[i],N[i]).
+            On exit, the solution X_i.
+
+    @param[in]
+    ldb     Array of INTEGERs, dimension (batchCount).
+            The leading dimension of each B_i.  LDB[i] >= max( 1, M[i] ).
+
+    @param[in]
+    batchCount  INTEGER
+                The number of systems to solve.
+
+    @ingroup magma_trsm_batched
+*******************************************************************************/
+extern "C" void
+magma_ztrsm_vbatched_cpu(
+    magma_side_t side, magma_uplo_t uplo, magma_trans_t transA, magma_diag_t diag,
+    magma_int_t *m, magma_int_t *n,
+    magmaDoubleComplex alpha,
+    magmaDoubleComplex **A_array, magma_int_t *lda,
+    magmaDoubleComplex **B_array, magma_int_t *ldb,
+    magma_int_t batchCount )
+{
+    magma_int_t info = 0;
+    if ( side != MagmaLeft && side != MagmaRight ) {
+        info = -1;
+    } else if ( uplo != MagmaUpper && uplo != MagmaLower ) {
+        info = -2;
+    } else if ( transA != MagmaNoTrans && transA != MagmaTrans && transA != MagmaConjTrans ) {
+        info = -3;
+    } else if ( diag != MagmaUnit && diag != MagmaNonUnit ) {
+        info = -4;
+    } else if (batchCount < 0) {
+        info = -12;
+    }
+    for (magma_int_t i = 0; i < batchCount && info == 0; ++i) {
+        magma_int_t nrowA = (side == MagmaLeft ? m[i] : n[i]);
+        if (m[i] < 0) {
+            info = -5;
+        } else if (n[i] < 0) {
+            info = -6;
+        } else if (lda[i] < max(1,nrowA)) {
+            info = -9;
+        } else if (ldb[i] < max(1,m[i])) {
+            info = -11;
+        }
+    }
+    if (info != 0) {
+        magma_xerbla( __func__, -(info) );
+        return;
+    }
+
+    /* Quick return if possible */
+    if (batchCount == 0)
+        return;
+
+    magma_ztrsm_batched_cpu_core( side, uplo, transA, diag, 0, m, 0, n,
+                                  alpha, A_array, 0, lda, B_array, 0, ldb,
+                                  batchCount );
+}
@@ -31,13 +31,7 @@
 extern "C"
 void magma_smake_symmetric( magma_int_t N, float* A, magma_int_t lda )
 {
-    magma_int_t i, j;
-    for( i=0; i < N; ++i ) {
-        A(i,i) = MAGMA_S_MAKE( MAGMA_S_REAL( A(i,i) ), 0. );
-        for( j=0; j < i; ++j ) {
-            A(j,i) = MAGMA_S_CONJ( A(i,j) );
-        }
-    }
+    magma_ssymmetrize_cpu( MagmaLower, N, A, lda );
 }
 
 
@@ -48,13 +42,11 @@ void magma_smake_symmetric( magma_int_t N, float* A, magma_int_t lda )
 extern "C"
 void magma_smake_hpd( magma_int_t N, float* A, magma_int_t lda )
 {
-    magma_int_t i, j;
+    magma_int_t i;
     for( i=0; i < N; ++i ) {
         A(i,i) = MAGMA_S_MAKE( MAGMA_S_REAL( A(i,i) ) + N, 0. );
-        for( j=0; j < i; ++j ) {
-            A(j,i) = MAGMA_S_CONJ( A(i,j) );
-        }
     }
+    magma_ssymmetrize_cpu( MagmaLower, N, A, lda );
 }
 
 #ifdef COMPLEX
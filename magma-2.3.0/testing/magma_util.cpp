@@ -40,6 +40,9 @@
 #elif defined(HAVE_MIC)
     const char* g_platform_str = "Xeon Phi";
 
+#elif defined(HAVE_HOST)
+    const char* g_platform_str = "host";
+
 #else
     #error "unknown platform"
 #endif
@@ -0,0 +1,176 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zgehrd_cpu.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Returns ||X - Y||_F / ||Y||_F for n-by-n X and Y, both with leading
+   dimension ld; X is overwritten.
+*/
+static float diff_norm(
+    magma_int_t n, magmaFloatComplex *X, const magmaFloatComplex *Y, magma_int_t ld )
+{
+    const magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
+    const magma_int_t ione = 1;
+    float work[1];
+    for (magma_int_t j = 0; j < n; ++j) {
+        blasf77_caxpy( &n, &c_neg_one, Y + j*ld, &ione, X + j*ld, &ione );
+    }
+    float Ynorm = lapackf77_clange( "F", &n, &n, Y, &ld, work );
+    float Xnorm = lapackf77_clange( "F", &n, &n, X, &ld, work );
+    return (Ynorm == 0 ? Xnorm : Xnorm / Ynorm);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing cgehrd_cpu
+   Reduces A = Q H Q^H with magma_cgehrd_cpu, forms Q with LAPACK cunghr,
+   and checks the backward error |A - Q H Q^H| / (N |A|) and |I - Q^H Q| / N.
+   Q and H are also compared with those of LAPACK cgehrd. The difference is
+   reported but not checked: the reduction is backward stable, not forward
+   stable, so even LAPACK's blocked and unblocked cgehrd differ by more than
+   rounding, most of all in single precision and for large N.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gflops, magma_perf, magma_time, cpu_perf, cpu_time;
+    float          Anorm, error, ortho, h_diff, q_diff, work[1];
+    magmaFloatComplex *h_A, *h_R, *h_Q, *h_Rlapack, *h_Qlapack, *h_work, *h_T, *tau;
+    magmaFloatComplex c_zero    = MAGMA_C_ZERO;
+    magmaFloatComplex c_one     = MAGMA_C_ONE;
+    magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
+    magma_int_t N, n2, lda, nb, lwork, info;
+    magma_int_t ione = 1;
+    int status = 0;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    float tol = opts.tolerance * lapackf77_slamch("E");
+
+    printf("%%   N   CPU Gflop/s (sec)   MAGMA Gflop/s (sec)   |A-QHQ^H|/N|A|   |I-Q^H Q|/N   |H-Hlapack|/|H|   |Q-Qlapack|/|Q|\n");
+    printf("%%=================================================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N      = opts.nsize[itest];
+            lda    = max( 1, N );
+            n2     = lda*N;
+            nb     = magma_get_cgehrd_nb( N );
+            lwork  = max( 1, N*nb );
+            gflops = FLOPS_CGEHRD( N ) / 1e9;
+
+            TESTING_CHECK( magma_cmalloc_cpu( &h_A,       n2       ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_R,       n2       ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_Q,       n2       ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_Rlapack, n2       ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_Qlapack, n2       ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_T,       n2       ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_work,    lwork    ));
+            TESTING_CHECK( magma_cmalloc_cpu( &tau,       max(1,N) ));
+
+            /* Initialize the matrix */
+            magma_generate_matrix( opts, N, N, nullptr, h_A, lda );
+            lapackf77_clacpy( MagmaFullStr, &N, &N, h_A, &lda, h_R,       &lda );
+            lapackf77_clacpy( MagmaFullStr, &N, &N, h_A, &lda, h_Rlapack, &lda );
+            Anorm = lapackf77_clange( "F", &N, &N, h_A, &lda, work );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            magma_time = magma_wtime();
+            magma_cgehrd_cpu( N, ione, N, h_R, lda, tau, h_work, lwork, &info );
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+            if (info != 0) {
+                printf("magma_cgehrd_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+            lapackf77_clacpy( MagmaFullStr, &N, &N, h_R, &lda, h_Q, &lda );
+            lapackf77_cunghr( &N, &ione, &N, h_Q, &lda, tau, h_work, &lwork, &info );
+
+            /* =====================================================================
+               Performs operation using LAPACK
+               =================================================================== */
+            cpu_time = magma_wtime();
+            lapackf77_cgehrd( &N, &ione, &N, h_Rlapack, &lda, tau, h_work, &lwork, &info );
+            cpu_time = magma_wtime() - cpu_time;
+            cpu_perf = gflops / cpu_time;
+            if (info != 0) {
+                printf("lapackf77_cgehrd returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+            lapackf77_clacpy( MagmaFullStr, &N, &N, h_Rlapack, &lda, h_Qlapack, &lda );
+            lapackf77_cunghr( &N, &ione, &N, h_Qlapack, &lda, tau, h_work, &lwork, &info );
+
+            /* =====================================================================
+               Check the result
+               =================================================================== */
+            // H is the upper Hessenberg part
+            for( int j = 0; j < N-1; ++j ) {
+                for( int i = j+2; i < N; ++i ) {
+                    h_R      [i + j*lda] = c_zero;
+                    h_Rlapack[i + j*lda] = c_zero;
+                }
+            }
+
+            // A -= (Q H) Q^H
+            blasf77_cgemm( MagmaNoTransStr, MagmaNoTransStr, &N, &N, &N,
+                           &c_one, h_Q, &lda, h_R, &lda, &c_zero, h_T, &lda );
+            blasf77_cgemm( MagmaNoTransStr, MagmaConjTransStr, &N, &N, &N,
+                           &c_neg_one, h_T, &lda, h_Q, &lda, &c_one, h_A, &lda );
+            error = lapackf77_clange( "F", &N, &N, h_A, &lda, work ) / (N*Anorm);
+
+            // I - Q^H Q
+            lapackf77_claset( MagmaFullStr, &N, &N, &c_zero, &c_one, h_T, &lda );
+            blasf77_cgemm( MagmaConjTransStr, MagmaNoTransStr, &N, &N, &N,
+                           &c_neg_one, h_Q, &lda, h_Q, &lda, &c_one, h_T, &lda );
+            ortho = lapackf77_clange( "F", &N, &N, h_T, &lda, work ) / N;
+
+            h_diff = diff_norm( N, h_R, h_Rlapack, lda );
+            q_diff = diff_norm( N, h_Q, h_Qlapack, lda );
+
+            bool okay = (error < tol && ortho < tol);
+            status += ! okay;
+            printf("%5lld   %7.2f (%7.4f)   %7.2f (%7.4f)     %8.2e         %8.2e      %8.2e          %8.2e     %s\n",
+                   (long long) N, cpu_perf, cpu_time, magma_perf, magma_time,
+                   error, ortho, h_diff, q_diff, (okay ? "ok" : "failed") );
+
+            magma_free_cpu( h_A       );
+            magma_free_cpu( h_R       );
+            magma_free_cpu( h_Q       );
+            magma_free_cpu( h_Rlapack );
+            magma_free_cpu( h_Qlapack );
+            magma_free_cpu( h_T       );
+            magma_free_cpu( h_work    );
+            magma_free_cpu( tau       );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
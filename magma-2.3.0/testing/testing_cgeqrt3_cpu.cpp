@@ -0,0 +1,214 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zgeqrt3_cpu.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Returns ||X - Y||_F / ||Y||_F for m-by-n X and Y, both with leading
+   dimension ld; X is overwritten.
+*/
+static float diff_norm(
+    magma_int_t m, magma_int_t n,
+    magmaFloatComplex *X, const magmaFloatComplex *Y, magma_int_t ld )
+{
+    const magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
+    const magma_int_t ione = 1;
+    float work[1];
+    for (magma_int_t j = 0; j < n; ++j) {
+        blasf77_caxpy( &m, &c_neg_one, Y + j*ld, &ione, X + j*ld, &ione );
+    }
+    float Ynorm = lapackf77_clange( "F", &m, &n, Y, &ld, work );
+    float Xnorm = lapackf77_clange( "F", &m, &n, X, &ld, work );
+    return (Ynorm == 0 ? Xnorm : Xnorm / Ynorm);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing cgeqrt3_cpu and clarfb_cpu
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gflops, magma_perf, magma_time, cpu_perf=0, cpu_time=0;
+    float          qr_error, t_error, larfb_error, error, work[1];
+    magma_int_t M, N, lda, ldc, ldt, lwork, n2, info;
+    magma_int_t ione     = 1;
+    magma_int_t ISEED[4] = {0,0,0,1};
+    magmaFloatComplex *hA, *hR, *hQ, *hT, *hTlapack, *tau, *hwork;
+    magmaFloatComplex *hC, *hCmagma, *hClapack;
+    magmaFloatComplex c_zero    = MAGMA_C_ZERO;
+    magmaFloatComplex c_one     = MAGMA_C_ONE;
+    magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
+    int status = 0;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    float tol = opts.tolerance * lapackf77_slamch("E");
+
+    printf("%% Requires M >= N; if M < N, N = M is used.\n");
+    printf("%%   M     N   MAGMA Gflop/s (ms)    CPU Gflop/s (ms)   |A - QR|/(N|A|)   T error   larfb error\n");
+    printf("%%=============================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M = opts.msize[itest];
+            N = min( opts.nsize[itest], M );
+            gflops = (FLOPS_CGEQRF( M, N ) + FLOPS_CGEQRT( M, N )) / 1e9;
+
+            lda   = max( 1, M );
+            ldc   = max( 1, M );
+            ldt   = max( 1, N );
+            n2    = lda*N;
+            lwork = max( 1, max( M, N )*N );
+
+            TESTING_CHECK( magma_cmalloc_cpu( &hA,       n2      ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hR,       n2      ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hQ,       n2      ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hT,       ldt*N   ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hTlapack, ldt*N   ));
+            TESTING_CHECK( magma_cmalloc_cpu( &tau,      max(1,N) ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hwork,    lwork   ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hC,       ldc*M   ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hCmagma,  ldc*M   ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hClapack, ldc*M   ));
+
+            /* Initialize the matrices */
+            magma_generate_matrix( opts, M, N, nullptr, hA, lda );
+            lapackf77_clacpy( MagmaFullStr, &M, &N, hA, &lda, hR, &lda );
+
+            /* =====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            magma_time = magma_wtime();
+            magma_cgeqrt3_cpu( M, N, hR, lda, tau, hT, ldt, &info );
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+            if (info != 0) {
+                printf("magma_cgeqrt3_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            /* =====================================================================
+               Performs operation using LAPACK, cgeqrf then clarft
+               =================================================================== */
+            if ( opts.lapack ) {
+                lapackf77_clacpy( MagmaFullStr, &M, &N, hA, &lda, hQ, &lda );
+                cpu_time = magma_wtime();
+                lapackf77_cgeqrf( &M, &N, hQ, &lda, hTlapack, hwork, &lwork, &info );
+                lapackf77_clarft( MagmaForwardStr, MagmaColumnwiseStr, &M, &N,
+                                  hQ, &lda, hTlapack, hwork, &ldt );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+            }
+
+            /* =====================================================================
+               Check the result
+               =================================================================== */
+            // |A - Q R| / (N |A|), with Q formed from V and tau by cungqr
+            float Anorm = lapackf77_clange( "F", &M, &N, hA, &lda, work );
+            lapackf77_clacpy( MagmaFullStr, &M, &N, hR, &lda, hQ, &lda );
+            lapackf77_cungqr( &M, &N, &N, hQ, &lda, tau, hwork, &lwork, &info );
+            lapackf77_claset( "Lower", &N, &N, &c_zero, &c_zero, hTlapack, &ldt );
+            lapackf77_clacpy( "Upper", &N, &N, hR, &lda, hTlapack, &ldt );
+            blasf77_cgemm( "N", "N", &M, &N, &N,
+                           &c_neg_one, hQ, &lda, hTlapack, &ldt,
+                           &c_one,     hA, &lda );
+            qr_error = lapackf77_clange( "F", &M, &N, hA, &lda, work ) / (N*Anorm);
+
+            // T against clarft from the same V and tau; T's lower triangle is
+            // not referenced, so it is cleared in both for the comparison
+            lapackf77_clarft( MagmaForwardStr, MagmaColumnwiseStr, &M, &N,
+                              hR, &lda, tau, hTlapack, &ldt );
+            if (N > 1) {
+                magma_int_t N1 = N-1;
+                lapackf77_claset( "Lower", &N1, &N1, &c_zero, &c_zero, hT+1,       &ldt );
+                lapackf77_claset( "Lower", &N1, &N1, &c_zero, &c_zero, hTlapack+1, &ldt );
+            }
+            t_error = diff_norm( N, N, hTlapack, hT, ldt );
+
+            // clarfb_cpu from the Left, Right, and both sides against clarfb
+            magma_int_t sizeC = ldc*M;
+            larfb_error = 0;
+            lapackf77_clarnv( &ione, ISEED, &sizeC, hC );
+            for (int s = 0; s < 3; ++s) {
+                magma_side_t side = (s == 0 ? MagmaLeft : s == 1 ? MagmaRight : MagmaBothSides);
+                magma_trans_t trans = (s == 1 ? MagmaNoTrans : Magma_ConjTrans);
+                lapackf77_clacpy( MagmaFullStr, &M, &M, hC, &ldc, hCmagma,  &ldc );
+                lapackf77_clacpy( MagmaFullStr, &M, &M, hC, &ldc, hClapack, &ldc );
+                magma_clarfb_cpu( side, trans, MagmaForward, MagmaColumnwise,
+                                  M, M, N, hR, lda, hT, ldt, hCmagma, ldc );
+                if (side != MagmaRight) {
+                    lapackf77_clarfb( MagmaLeftStr, lapack_trans_const(trans),
+                                      MagmaForwardStr, MagmaColumnwiseStr,
+                                      &M, &M, &N, hR, &lda, hT, &ldt, hClapack, &ldc,
+                                      hwork, &M );
+                }
+                if (side != MagmaLeft) {
+                    magma_trans_t trans_r = (side == MagmaRight ? trans : MagmaNoTrans);
+                    lapackf77_clarfb( MagmaRightStr, lapack_trans_const(trans_r),
+                                      MagmaForwardStr, MagmaColumnwiseStr,
+                                      &M, &M, &N, hR, &lda, hT, &ldt, hClapack, &ldc,
+                                      hwork, &M );
+                }
+                error = diff_norm( M, M, hCmagma, hClapack, ldc );
+                larfb_error = max( larfb_error, error );
+            }
+
+            bool okay = (qr_error < tol && t_error < tol && larfb_error < tol);
+            status += ! okay;
+            if ( opts.lapack ) {
+                printf("%5lld %5lld   %7.2f (%7.2f)   %7.2f (%7.2f)   %8.2e          %8.2e  %8.2e   %s\n",
+                       (long long) M, (long long) N,
+                       magma_perf, 1000.*magma_time,
+                       cpu_perf,   1000.*cpu_time,
+                       qr_error, t_error, larfb_error,
+                       (okay ? "ok" : "failed"));
+            }
+            else {
+                printf("%5lld %5lld   %7.2f (%7.2f)     ---   (  ---  )   %8.2e          %8.2e  %8.2e   %s\n",
+                       (long long) M, (long long) N,
+                       magma_perf, 1000.*magma_time,
+                       qr_error, t_error, larfb_error,
+                       (okay ? "ok" : "failed"));
+            }
+
+            magma_free_cpu( hA );
+            magma_free_cpu( hR );
+            magma_free_cpu( hQ );
+            magma_free_cpu( hT );
+            magma_free_cpu( hTlapack );
+            magma_free_cpu( tau );
+            magma_free_cpu( hwork );
+            magma_free_cpu( hC );
+            magma_free_cpu( hCmagma );
+            magma_free_cpu( hClapack );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
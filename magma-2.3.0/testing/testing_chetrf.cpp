@@ -5,7 +5,7 @@
        Univ. of Colorado, Denver
        @date November 2017
 
-       @generated from testing/testing_zhetrf.cpp, normal z -> c, Wed Nov 15 00:34:24 2017
+       @generated from testing/testing_zhetrf.cpp, normal z -> c, Sat Oct 17 06:29:04 2026
        @author Ichitaro Yamazaki
 */
 // includes, system
@@ -132,9 +132,11 @@ float get_residual(
 }
 
 /******************************************************************************/
+// If host is true, solves with magma_chetrs_aasen_cpu instead of the
+// LAPACK triangular and band solvers.
 float get_residual_aasen(
     magma_opts &opts,
-    bool nopiv, magma_uplo_t uplo, magma_int_t n,
+    bool nopiv, bool host, magma_uplo_t uplo, magma_int_t n,
     magmaFloatComplex *A, magma_int_t lda,
     magma_int_t *ipiv )
 {
@@ -142,14 +144,14 @@ float get_residual_aasen(
     const magmaFloatComplex c_one     = MAGMA_C_ONE;
     const magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
     
-    magmaFloatComplex *L, *T;
+    magmaFloatComplex *L, *T = NULL;
     #define  A(i,j) ( A[(i) + (j)*lda])
     #define  L(i,j) ( L[(i) + (j)*n])
     TESTING_CHECK( magma_cmalloc_cpu( &L, n*n ));
     memset( L, 0, n*n*sizeof(magmaFloatComplex) );
 
     magma_int_t i, j, piv;
-    magma_int_t nb = magma_get_chetrf_aasen_nb(n);
+    magma_int_t nb = magma_get_zhetrf_aasen_nb(n);
     // extract L
     for (i=0; i < min(n,nb); i++) {
         L(i,i) = c_one;
@@ -171,65 +173,74 @@ float get_residual_aasen(
     TESTING_CHECK( magma_cmalloc_cpu( &b, n ));
     lapackf77_clarnv( &ione, ISEED, &n, b );
     blasf77_ccopy( &n, b, &ione, x, &ione );
-    // pivot..
-    for (i=0; i < n; i++) {
-        piv = ipiv[i]-1;
-        magmaFloatComplex val = x[i];
-        x[i] = x[piv];
-        x[piv] = val;
+    if (host) {
+        magma_chetrs_aasen_cpu( uplo, n, 1, A, lda, ipiv, x, n, &info );
+        if (info != 0) {
+            printf("magma_chetrs_aasen_cpu returned error %lld: %s.\n",
+                   (long long) info, magma_strerror( info ));
+        }
     }
-    // forward solve
-    blasf77_ctrsv( MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr, &n, &L(0,0), &n, x, &ione );
-    // banded solver
-    magma_int_t nrhs = 1, *p = NULL;
-    TESTING_CHECK( magma_imalloc_cpu( &p, n ));
-    //#define CHESV_USE_CGESV
-    #ifdef CHESV_USE_CGESV
-        // using CGESV on banded matrix
-        #define  T(i,j) ( T[(i) + (j)*n])
-        // extract T
-        TESTING_CHECK( magma_cmalloc_cpu( &T, n*n ));
-        memset( T, 0, n*n*sizeof(magmaFloatComplex) );
+    else {
+        // pivot..
         for (i=0; i < n; i++) {
-            magma_int_t istart = max(0, i-nb);
-            for (j=istart; j <= i; j++) {
-                T(i,j) = A(i,j);
-            }
-            for (j=istart; j < i; j++) {
-                T(j,i) = MAGMA_C_CONJ(A(i,j));
-            }
+            piv = ipiv[i]-1;
+            magmaFloatComplex val = x[i];
+            x[i] = x[piv];
+            x[piv] = val;
         }
-        // solve with T
-        lapackf77_cgesv( &n, &nrhs, &T(0, 0), &n, p, x, &n, &info );
-    #else
-        // using CGBSV on banded matrix
-        magma_int_t ldtb = 3*nb+1;
-        // extract T
-        TESTING_CHECK( magma_cmalloc_cpu( &T, ldtb * n ));
-        memset( T, 0, ldtb*n*sizeof(magmaFloatComplex) );
-        for (j=0; j<n; j++) {
-            magma_int_t i0 = max(0, j-nb);
-            magma_int_t i1 = min(n-1, j+nb);
-            for (i=i0; i<j; i++) {
-                T[nb + i-(j-nb) + j*ldtb] = MAGMA_C_CONJ(A(j,i));
+        // forward solve
+        blasf77_ctrsv( MagmaLowerStr, MagmaNoTransStr, MagmaUnitStr, &n, &L(0,0), &n, x, &ione );
+        // banded solver
+        magma_int_t nrhs = 1, *p = NULL;
+        TESTING_CHECK( magma_imalloc_cpu( &p, n ));
+        //#define CHESV_USE_CGESV
+        #ifdef CHESV_USE_CGESV
+            // using CGESV on banded matrix
+            #define  T(i,j) ( T[(i) + (j)*n])
+            // extract T
+            TESTING_CHECK( magma_cmalloc_cpu( &T, n*n ));
+            memset( T, 0, n*n*sizeof(magmaFloatComplex) );
+            for (i=0; i < n; i++) {
+                magma_int_t istart = max(0, i-nb);
+                for (j=istart; j <= i; j++) {
+                    T(i,j) = A(i,j);
+                }
+                for (j=istart; j < i; j++) {
+                    T(j,i) = MAGMA_C_CONJ(A(i,j));
+                }
             }
-            for (i=j; i<=i1; i++) {
-                T[nb + i-(j-nb) + j*ldtb] = A(i,j);
+            // solve with T
+            lapackf77_cgesv( &n, &nrhs, &T(0, 0), &n, p, x, &n, &info );
+        #else
+            // using CGBSV on banded matrix
+            magma_int_t ldtb = 3*nb+1;
+            // extract T
+            TESTING_CHECK( magma_cmalloc_cpu( &T, ldtb * n ));
+            memset( T, 0, ldtb*n*sizeof(magmaFloatComplex) );
+            for (j=0; j<n; j++) {
+                magma_int_t i0 = max(0, j-nb);
+                magma_int_t i1 = min(n-1, j+nb);
+                for (i=i0; i<j; i++) {
+                    T[nb + i-(j-nb) + j*ldtb] = MAGMA_C_CONJ(A(j,i));
+                }
+                for (i=j; i<=i1; i++) {
+                    T[nb + i-(j-nb) + j*ldtb] = A(i,j);
+                }
             }
+            // solve with T
+            lapackf77_cgbsv(&n,&nb,&nb, &nrhs, T,&ldtb, p,x,&n, &info);
+        #endif
+        magma_free_cpu( p );
+
+        // backward solve
+        blasf77_ctrsv( MagmaLowerStr, MagmaConjTransStr, MagmaUnitStr, &n, &L(0,0), &n, x, &ione );
+        // pivot..
+        for (i=n-1; i >= 0; i--) {
+            piv = ipiv[i]-1;
+            magmaFloatComplex val = x[i];
+            x[i] = x[piv];
+            x[piv] = val;
         }
-        // solve with T
-        lapackf77_cgbsv(&n,&nb,&nb, &nrhs, T,&ldtb, p,x,&n, &info);
-    #endif
-    magma_free_cpu( p );
-
-    // backward solve
-    blasf77_ctrsv( MagmaLowerStr, MagmaConjTransStr, MagmaUnitStr, &n, &L(0,0), &n, x, &ione );
-    // pivot..
-    for (i=n-1; i >= 0; i--) {
-        piv = ipiv[i]-1;
-        magmaFloatComplex val = x[i];
-        x[i] = x[piv];
-        x[piv] = val;
     }
 
     // reset to original A
@@ -516,7 +527,7 @@ float get_LTLt_error(
     memset( T, 0, N*N*sizeof(magmaFloatComplex) );
 
     magma_int_t i, j, istart, piv;
-    magma_int_t nb = magma_get_chetrf_aasen_nb(N);
+    magma_int_t nb = magma_get_zhetrf_aasen_nb(N);
     
     // for debuging
     /*
@@ -579,20 +590,23 @@ float get_LTLt_error(
     //printf( "A0=" );
     //magma_cprint(N,N, &A(0,0),N);
 
-    // symmetrize; the pivoting code below assumes a full matrix
+    // symmetrize; the pivoting code below assumes a full matrix.
+    // The imaginary parts of the diagonal are assumed to be zero.
     if (opts.uplo == MagmaLower) {
         // copy L to U
         for (j = 0; j < N; ++j) {
+            A(j,j) = MAGMA_C_MAKE( MAGMA_C_REAL( A(j,j) ), 0. );
             for (i = 0; i < j; ++i) {
-                A(i,j) = A(j,i);
+                A(i,j) = MAGMA_C_CONJ( A(j,i) );
             }
         }
     }
     else {
         // copy U to L
         for (j = 0; j < N; ++j) {
+            A(j,j) = MAGMA_C_MAKE( MAGMA_C_REAL( A(j,j) ), 0. );
             for (i = 0; i < j; ++i) {
-                A(j,i) = A(i,j);
+                A(j,i) = MAGMA_C_CONJ( A(i,j) );
             }
         }
     }
@@ -632,7 +646,7 @@ float get_LTLt_error(
 }
 
 /* ////////////////////////////////////////////////////////////////////////////
-   -- Testing chetrf
+   -- Testing zhetrf
 */
 int main( int argc, char** argv)
 {
@@ -644,7 +658,7 @@ int main( int argc, char** argv)
     float          error, error_lapack = 0.0;
     magma_int_t     *ipiv;
     magma_int_t     cpu_panel = 1, N, n2, lda, lwork, info;
-    magma_int_t     cpu = 0, nopiv = 0, nopiv_gpu = 0, row = 0, aasen = 0;
+    magma_int_t     cpu = 0, nopiv = 0, nopiv_gpu = 0, row = 0, aasen = 0, aasen_cpu = 0;
     int status = 0;
     
     magma_opts opts;
@@ -667,6 +681,7 @@ int main( int argc, char** argv)
             "%%           3 = No-piv (CPU) -- uses random, diagonally dominant matrix by default\n"
             "%%           4 = No-piv (GPU) -- uses random, diagonally dominant matrix by default\n"
             "%%           6 = Aasen's\n"
+            "%%           7 = Aasen's (CPU host)\n"
             "\n" );
     printf( "%% version %lld: ", (long long) opts.version );
     switch (opts.version) {
@@ -696,6 +711,11 @@ int main( int argc, char** argv)
             aasen = 1;
             printf( "CPU-Interface to Aasen's, %s", (cpu_panel ? "CPU panel" : "GPU panel") );
             break;
+        case 7:
+            aasen = 1;
+            aasen_cpu = 1;
+            printf( "CPU-Interface to Aasen's on CPU host" );
+            break;
         default:
             printf( "unknown version\n" );
             return 0;
@@ -775,6 +795,12 @@ int main( int argc, char** argv)
                 magma_cgetmatrix(N, N, d_A, ldda, h_A, lda, opts.queue );
                 magma_free( d_A );
             }
+            else if (aasen_cpu) {
+                // Aasen's LTLt on CPU host
+                gpu_time = magma_wtime();
+                magma_chetrf_aasen_cpu( opts.uplo, N, h_A, lda, ipiv, &info);
+                gpu_time = magma_wtime() - gpu_time;
+            }
             else if (aasen) {
                 // CPU-interface to Aasen's LTLt
                 gpu_time = magma_wtime();
@@ -806,7 +832,7 @@ int main( int argc, char** argv)
             }
             if ( opts.check == 2 && info == 0) {
                 if (aasen) {
-                    error = get_residual_aasen( opts, (nopiv | nopiv_gpu), opts.uplo, N, h_A, lda, ipiv );
+                    error = get_residual_aasen( opts, (nopiv | nopiv_gpu), aasen_cpu, opts.uplo, N, h_A, lda, ipiv );
                 }
                 else {
                     error = get_residual( opts, (nopiv | nopiv_gpu), opts.uplo, N, h_A, lda, ipiv );
@@ -0,0 +1,129 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zpotrf_tile.cpp, normal z -> c, Sat Oct 17 06:16:06 2026
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing cpotrf_tile
+   Time excludes conversion to and from tile-major layout.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    // constants
+    const magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
+    const magma_int_t ione = 1;
+
+    // locals
+    real_Double_t   gflops, gpu_perf, gpu_time, cpu_perf, cpu_time;
+    magmaFloatComplex *h_A, *h_R, *h_T;
+    magma_int_t N, n2, lda, nb, info;
+    float      Anorm, error, work[1], *sigma;
+    int status = 0;
+
+    magma_opts opts;
+    opts.matrix = "rand_dominant";  // default
+    opts.parse_opts( argc, argv );
+    opts.lapack |= opts.check;  // check (-c) implies lapack (-l)
+
+    float tol = opts.tolerance * lapackf77_slamch("E");
+
+    printf("%% uplo = %s\n", lapack_uplo_const(opts.uplo) );
+    printf("%%   N    NB   CPU Gflop/s (sec)   Tile Gflop/s (sec)   ||R_magma - R_lapack||_F / ||R_lapack||_F\n");
+    printf("%%========================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N     = opts.nsize[itest];
+            lda   = N;
+            n2    = lda*N;
+            nb    = (opts.nb > 0 ? opts.nb : magma_get_zpotrf_nb( N ));
+            gflops = FLOPS_CPOTRF( N ) / 1e9;
+
+            TESTING_CHECK( magma_cmalloc_cpu( &h_A, n2 ));
+            TESTING_CHECK( magma_smalloc_cpu( &sigma, N ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_R, n2 ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_T, magma_roundup( N, nb )*magma_roundup( N, nb ) ));
+
+            /* Initialize the matrix */
+            magma_generate_matrix( opts, N, N, sigma, h_A, lda );
+            if (opts.verbose) {
+                printf( "A = " ); magma_cprint( N, N, h_A, lda );
+            }
+            magma_cge2tile( N, N, nb, h_A, lda, h_T );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            gpu_time = magma_wtime();
+            magma_cpotrf_tile( opts.uplo, N, nb, h_T, &info );
+            gpu_time = magma_wtime() - gpu_time;
+            gpu_perf = gflops / gpu_time;
+            if (info != 0) {
+                printf("magma_cpotrf_tile returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            magma_ctile2ge( N, N, nb, h_T, h_R, lda );
+
+            if ( opts.lapack ) {
+                /* =====================================================================
+                   Performs operation using LAPACK
+                   =================================================================== */
+                cpu_time = magma_wtime();
+                lapackf77_cpotrf( lapack_uplo_const(opts.uplo), &N, h_A, &lda, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_cpotrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+
+                /* =====================================================================
+                   Check the result compared to LAPACK
+                   =================================================================== */
+                blasf77_caxpy(&n2, &c_neg_one, h_A, &ione, h_R, &ione);
+                Anorm = lapackf77_clange("f", &N, &N, h_A, &lda, work);
+                error = lapackf77_clange("f", &N, &N, h_R, &lda, work) / Anorm;
+
+                printf("%5lld %5lld   %7.2f (%7.2f)    %7.2f (%7.2f)    %8.2e   %s\n",
+                       (long long) N, (long long) nb, cpu_perf, cpu_time, gpu_perf, gpu_time,
+                       error, (error < tol ? "ok" : "failed") );
+                status += ! (error < tol);
+            }
+            else {
+                printf("%5lld %5lld     ---   (  ---  )    %7.2f (%7.2f)      ---  \n",
+                       (long long) N, (long long) nb, gpu_perf, gpu_time );
+            }
+            magma_free_cpu( h_A );
+            magma_free_cpu( sigma );
+            magma_free_cpu( h_R );
+            magma_free_cpu( h_T );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -22,7 +22,7 @@
 #include "testings.h"
 
 /* ////////////////////////////////////////////////////////////////////////////
-   -- Testing csymmetrize
+   -- Testing zsymmetrize
    Code is very similar to testing_ctranspose.cpp
 */
 int main( int argc, char** argv)
@@ -30,10 +30,10 @@ int main( int argc, char** argv)
     TESTING_CHECK( magma_init() );
     magma_print_environment();
 
-    real_Double_t    gbytes, gpu_perf, gpu_time, cpu_perf, cpu_time;
-    float           error, work[1];
+    real_Double_t    gbytes, gpu_perf, gpu_time, cpu_perf, cpu_time, sym_perf, sym_time;
+    float           error, sym_error, work[1];
     magmaFloatComplex  c_neg_one = MAGMA_C_NEG_ONE;
-    magmaFloatComplex *h_A, *h_R;
+    magmaFloatComplex *h_A, *h_R, *h_S;
     magmaFloatComplex_ptr d_A;
     magma_int_t N, size, lda, ldda;
     magma_int_t ione     = 1;
@@ -43,8 +43,8 @@ int main( int argc, char** argv)
     opts.parse_opts( argc, argv );
 
     printf("%% uplo = %s\n", lapack_uplo_const(opts.uplo) );
-    printf("%%   N   CPU GByte/s (ms)    GPU GByte/s (ms)    check\n");
-    printf("%%====================================================\n");
+    printf("%%   N   CPU GByte/s (ms)    GPU GByte/s (ms)    _cpu GByte/s (ms)   check\n");
+    printf("%%========================================================================\n");
     for( int itest = 0; itest < opts.ntest; ++itest ) {
         for( int iter = 0; iter < opts.niter; ++iter ) {
             N = opts.nsize[itest];
@@ -56,6 +56,7 @@ int main( int argc, char** argv)
     
             TESTING_CHECK( magma_cmalloc_cpu( &h_A, size   ));
             TESTING_CHECK( magma_cmalloc_cpu( &h_R, size   ));
+            TESTING_CHECK( magma_cmalloc_cpu( &h_S, size   ));
             
             TESTING_CHECK( magma_cmalloc( &d_A, ldda*N ));
             
@@ -77,6 +78,15 @@ int main( int argc, char** argv)
             gpu_time = magma_sync_wtime( opts.queue ) - gpu_time;
             gpu_perf = gbytes / gpu_time;
             
+            /* =====================================================================
+               Performs operation using MAGMA's host version
+               =================================================================== */
+            lapackf77_clacpy( "Full", &N, &N, h_A, &lda, h_S, &lda );
+            sym_time = magma_wtime();
+            magma_csymmetrize_cpu( opts.uplo, N, h_S, lda );
+            sym_time = magma_wtime() - sym_time;
+            sym_perf = gbytes / sym_time;
+            
             /* =====================================================================
                Performs operation using naive in-place algorithm
                (LAPACK doesn't implement symmetrize)
@@ -106,14 +116,19 @@ int main( int argc, char** argv)
             
             blasf77_caxpy(&size, &c_neg_one, h_A, &ione, h_R, &ione);
             error = lapackf77_clange("f", &N, &N, h_R, &lda, work);
+            
+            blasf77_caxpy(&size, &c_neg_one, h_A, &ione, h_S, &ione);
+            sym_error = lapackf77_clange("f", &N, &N, h_S, &lda, work);
 
-            printf("%5lld   %7.2f (%7.2f)   %7.2f (%7.2f)   %s\n",
+            printf("%5lld   %7.2f (%7.2f)   %7.2f (%7.2f)   %7.2f (%7.2f)   %s\n",
                    (long long) N, cpu_perf, cpu_time*1000., gpu_perf, gpu_time*1000.,
-                   (error == 0. ? "ok" : "failed") );
-            status += ! (error == 0.);
+                   sym_perf, sym_time*1000.,
+                   (error == 0. && sym_error == 0. ? "ok" : "failed") );
+            status += ! (error == 0. && sym_error == 0.);
             
             magma_free_cpu( h_A );
             magma_free_cpu( h_R );
+            magma_free_cpu( h_S );
             
             magma_free( d_A );
             fflush( stdout );
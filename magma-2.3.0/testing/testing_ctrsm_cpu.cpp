@@ -0,0 +1,251 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_ztrsm_cpu.cpp, normal z -> c, Wed Nov 15 00:34:20 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "magma_operators.h"  // for MAGMA_C_DIV
+#include "testings.h"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Checks magma_ctrtri_cpu against LAPACK's ctrtri for the Ak-by-Ak
+   triangle of A. Returns ||R_magma - R_lapack||_F / ||R_lapack||_F.
+*/
+static float check_trtri(
+    magma_uplo_t uplo, magma_diag_t diag, magma_int_t Ak,
+    const magmaFloatComplex *A, magma_int_t lda )
+{
+    const magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
+    const magma_int_t ione = 1;
+    magmaFloatComplex *R, *Rlapack;
+    magma_int_t info;
+    float work[1];
+
+    TESTING_CHECK( magma_cmalloc_cpu( &R,       lda*Ak ));
+    TESTING_CHECK( magma_cmalloc_cpu( &Rlapack, lda*Ak ));
+    lapackf77_clacpy( MagmaFullStr, &Ak, &Ak, A, &lda, R,       &lda );
+    lapackf77_clacpy( MagmaFullStr, &Ak, &Ak, A, &lda, Rlapack, &lda );
+
+    magma_ctrtri_cpu( uplo, diag, Ak, R, lda, &info );
+    if (info != 0) {
+        printf("magma_ctrtri_cpu returned error %lld: %s.\n",
+               (long long) info, magma_strerror( info ));
+    }
+    lapackf77_ctrtri( lapack_uplo_const(uplo), lapack_diag_const(diag),
+                      &Ak, Rlapack, &lda, &info );
+
+    // compares the whole arrays, so the other triangle must be unchanged
+    for (magma_int_t j = 0; j < Ak; ++j) {
+        blasf77_caxpy( &Ak, &c_neg_one, Rlapack + j*lda, &ione, R + j*lda, &ione );
+    }
+    float Rnorm = lapackf77_clange( "F", &Ak, &Ak, Rlapack, &lda, work );
+    float error = lapackf77_clange( "F", &Ak, &Ak, R,       &lda, work ) / Rnorm;
+
+    magma_free_cpu( R );
+    magma_free_cpu( Rlapack );
+    return error;
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing ctrsm_cpu, ctrtri_diag_cpu, and ctrtri_cpu
+*/
+int main( int argc, char** argv)
+{
+    #define hA(i_, j_) (hA + (i_) + (j_)*lda)
+
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gflops, magma_perf, magma_time, reuse_perf, reuse_time, cpu_perf=0, cpu_time=0;
+    float          magma_error, lapack_error=0, trtri_error, work[1];
+    magma_int_t M, N, Ak, lda, ldb, sizeB, info;
+    magma_int_t ione     = 1;
+    magma_int_t ISEED[4] = {0,0,0,1};
+    magma_int_t *ipiv;
+    magmaFloatComplex *hA, *hB, *hX, *hBmagma, *hBreuse, *hBlapack, *invA;
+    magmaFloatComplex c_neg_one = MAGMA_C_NEG_ONE;
+    magmaFloatComplex c_one = MAGMA_C_ONE;
+    magmaFloatComplex alpha = MAGMA_C_MAKE(  0.29, -0.86 );
+    int status = 0;
+
+    magma_opts opts;
+    opts.matrix = "rand_dominant";  // default
+    opts.tolerance = 100;           // default
+    opts.parse_opts( argc, argv );
+
+    float tol = opts.tolerance * lapackf77_slamch("E");
+
+    printf("%% side = %s, uplo = %s, transA = %s, diag = %s\n",
+           lapack_side_const(opts.side), lapack_uplo_const(opts.uplo),
+           lapack_trans_const(opts.transA), lapack_diag_const(opts.diag) );
+
+    printf("%%   M     N  MAGMA Gflop/s (ms)  reused invA (ms)     CPU Gflop/s (ms)      MAGMA     LAPACK error   trtri error\n");
+    printf("%%=================================================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M = opts.msize[itest];
+            N = opts.nsize[itest];
+            gflops = FLOPS_CTRSM(opts.side, M, N) / 1e9;
+
+            Ak  = (opts.side == MagmaLeft ? M : N);
+            lda = max( 1, Ak );
+            ldb = max( 1, M );
+            sizeB = ldb*N;
+
+            TESTING_CHECK( magma_cmalloc_cpu( &hA,       lda*Ak ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hB,       sizeB  ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hX,       sizeB  ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hBmagma,  sizeB  ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hBreuse,  sizeB  ));
+            TESTING_CHECK( magma_cmalloc_cpu( &hBlapack, sizeB  ));
+            TESTING_CHECK( magma_cmalloc_cpu( &invA,     magma_roundup( Ak, 128 )*128 ));
+            TESTING_CHECK( magma_imalloc_cpu( &ipiv,     Ak     ));
+
+            /* Initialize the matrices */
+            /* Factor A into LU to get well-conditioned triangular matrix.
+             * Copy L to U, since L seems okay when used with non-unit diagonal
+             * (i.e., from U), while U fails when used with unit diagonal. */
+            magma_generate_matrix( opts, Ak, Ak, nullptr, hA, lda );
+            lapackf77_cgetrf( &Ak, &Ak, hA, &lda, ipiv, &info );
+            for (int j = 0; j < Ak; ++j) {
+                for (int i = 0; i < j; ++i) {
+                    *hA(i,j) = *hA(j,i);
+                }
+            }
+
+            lapackf77_clarnv( &ione, ISEED, &sizeB, hB );
+            lapackf77_clacpy( MagmaFullStr, &M, &N, hB, &ldb, hBmagma,  &ldb );
+            lapackf77_clacpy( MagmaFullStr, &M, &N, hB, &ldb, hBreuse,  &ldb );
+            lapackf77_clacpy( MagmaFullStr, &M, &N, hB, &ldb, hBlapack, &ldb );
+
+            /* =====================================================================
+               Performs operation using MAGMA, inverting the diagonal blocks
+               =================================================================== */
+            magma_time = magma_wtime();
+            magma_ctrsm_cpu( opts.side, opts.uplo, opts.transA, opts.diag,
+                             M, N,
+                             alpha, hA, lda, NULL,
+                                    hBmagma, ldb );
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+
+            /* =====================================================================
+               Again, reusing diagonal blocks inverted beforehand; must match
+               =================================================================== */
+            magma_ctrtri_diag_cpu( opts.uplo, opts.diag, Ak, hA, lda, invA );
+            reuse_time = magma_wtime();
+            magma_ctrsm_cpu( opts.side, opts.uplo, opts.transA, opts.diag,
+                             M, N,
+                             alpha, hA, lda, invA,
+                                    hBreuse, ldb );
+            reuse_time = magma_wtime() - reuse_time;
+            reuse_perf = gflops / reuse_time;
+            bool same = (memcmp( hBreuse, hBmagma, sizeB*sizeof(magmaFloatComplex) ) == 0);
+
+            /* =====================================================================
+               Performs operation using CPU BLAS
+               =================================================================== */
+            if ( opts.lapack ) {
+                cpu_time = magma_wtime();
+                blasf77_ctrsm( lapack_side_const(opts.side), lapack_uplo_const(opts.uplo),
+                               lapack_trans_const(opts.transA), lapack_diag_const(opts.diag),
+                               &M, &N,
+                               &alpha, hA, &lda,
+                                       hBlapack, &ldb );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+            }
+
+            /* =====================================================================
+               Check the result
+               =================================================================== */
+            // ||b - 1/alpha*A*x|| / (||A||*||x||)
+            magmaFloatComplex inv_alpha = MAGMA_C_DIV( c_one, alpha );
+            float normR, normX, normA;
+            normA = lapackf77_clantr( "M",
+                                      lapack_uplo_const(opts.uplo),
+                                      lapack_diag_const(opts.diag),
+                                      &Ak, &Ak, hA, &lda, work );
+
+            memcpy( hX, hBmagma, sizeB*sizeof(magmaFloatComplex) );
+            blasf77_ctrmm( lapack_side_const(opts.side), lapack_uplo_const(opts.uplo),
+                           lapack_trans_const(opts.transA), lapack_diag_const(opts.diag),
+                           &M, &N,
+                           &inv_alpha, hA, &lda,
+                                       hX, &ldb );
+
+            blasf77_caxpy( &sizeB, &c_neg_one, hB, &ione, hX, &ione );
+            normR = lapackf77_clange( "M", &M, &N, hX,      &ldb, work );
+            normX = lapackf77_clange( "M", &M, &N, hBmagma, &ldb, work );
+            magma_error = normR/(normX*normA);
+
+            trtri_error = check_trtri( opts.uplo, opts.diag, Ak, hA, lda );
+
+            bool okay = (magma_error < tol && same && trtri_error < tol);
+            status += ! okay;
+            if ( opts.lapack ) {
+                // check lapack
+                // this verifies that the matrix wasn't so bad that it couldn't be solved accurately.
+                memcpy( hX, hBlapack, sizeB*sizeof(magmaFloatComplex) );
+                blasf77_ctrmm( lapack_side_const(opts.side), lapack_uplo_const(opts.uplo),
+                               lapack_trans_const(opts.transA), lapack_diag_const(opts.diag),
+                               &M, &N,
+                               &inv_alpha, hA, &lda,
+                                           hX, &ldb );
+
+                blasf77_caxpy( &sizeB, &c_neg_one, hB, &ione, hX, &ione );
+                normR = lapackf77_clange( "M", &M, &N, hX,       &ldb, work );
+                normX = lapackf77_clange( "M", &M, &N, hBlapack, &ldb, work );
+                lapack_error = normR/(normX*normA);
+
+                printf("%5lld %5lld   %7.2f (%7.2f)   %7.2f (%7.2f)   %7.2f (%7.2f)   %8.2e   %8.2e       %8.2e   %s\n",
+                        (long long) M, (long long) N,
+                        magma_perf,  1000.*magma_time,
+                        reuse_perf,  1000.*reuse_time,
+                        cpu_perf,    1000.*cpu_time,
+                        magma_error, lapack_error, trtri_error,
+                        (okay ? "ok" : "failed"));
+            }
+            else {
+                printf("%5lld %5lld   %7.2f (%7.2f)   %7.2f (%7.2f)     ---   (  ---  )   %8.2e     ---          %8.2e   %s\n",
+                        (long long) M, (long long) N,
+                        magma_perf,  1000.*magma_time,
+                        reuse_perf,  1000.*reuse_time,
+                        magma_error, trtri_error,
+                        (okay ? "ok" : "failed"));
+            }
+
+            magma_free_cpu( hA );
+            magma_free_cpu( hB );
+            magma_free_cpu( hX );
+            magma_free_cpu( hBmagma  );
+            magma_free_cpu( hBreuse  );
+            magma_free_cpu( hBlapack );
+            magma_free_cpu( invA );
+            magma_free_cpu( ipiv );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -0,0 +1,228 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zgetrf_batched_cpu.cpp, normal z -> d, Wed Nov 15 00:34:24 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+#include "../control/magma_threadsetting.h"  // internal header
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing dgetrf_batched_cpu and dgetrf_vbatched_cpu
+      --version 1: fixed size, M-by-N.
+      --version 2: variable size, M_i-by-N_i with M_i in [1, M], N_i in [1, N].
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gflops, magma_perf, magma_time, cpu_perf, cpu_time;
+    double *h_A, *h_R, *h_T, *h_L, *h_U;
+    double **A_array = NULL;
+    magma_int_t *ipiv, *ipiv_magma, **ipiv_array = NULL;
+    magma_int_t *m_array, *n_array, *lda_array, *info_array;
+    magma_int_t M, N, min_mn, n2, lda, info, batchCount;
+    double c_zero    = MAGMA_D_ZERO;
+    double c_one     = MAGMA_D_ONE;
+    double c_neg_one = MAGMA_D_NEG_ONE;
+    magma_int_t ione     = 1;
+    magma_int_t ISEED[4] = {0,0,0,1};
+    double      work[1], error;
+    int status = 0;
+
+    magma_opts opts( MagmaOptsBatched );
+    opts.parse_opts( argc, argv );
+    batchCount = opts.batchcount;
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+
+    printf("%% %s\n",
+           (opts.version == 1 ? "fixed size" : "variable size M_i in [1, M], N_i in [1, N]"));
+    printf("%% BatchCount   M     N    CPU Gflop/s (ms)   MAGMA Gflop/s (ms)   ||PA - LU||_F / (N ||A||_F)\n");
+    printf("%%=========================================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M      = opts.msize[itest];
+            N      = opts.nsize[itest];
+            min_mn = min( M, N );
+            lda    = M;
+            n2     = lda * N * batchCount;
+
+            TESTING_CHECK( magma_dmalloc_cpu( &h_A, n2 ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_R, n2 ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_T, lda*N ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_L, M*min_mn ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_U, min_mn*N ));
+            TESTING_CHECK( magma_imalloc_cpu( &ipiv,       min_mn * batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &ipiv_magma, min_mn * batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &m_array,    batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &n_array,    batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &lda_array,  batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &info_array, batchCount ));
+            TESTING_CHECK( magma_malloc_cpu( (void**) &A_array,    batchCount * sizeof(double*) ));
+            TESTING_CHECK( magma_malloc_cpu( (void**) &ipiv_array, batchCount * sizeof(magma_int_t*) ));
+
+            // guarantee reproducible sizes
+            srand(1000);
+            gflops = 0;
+            for (int s = 0; s < batchCount; ++s) {
+                m_array[s]    = (opts.version == 1 ? M : 1 + (rand() % M));
+                n_array[s]    = (opts.version == 1 ? N : 1 + (rand() % N));
+                lda_array[s]  = lda;
+                A_array[s]    = h_R + s * lda * N;
+                ipiv_array[s] = ipiv_magma + s * min_mn;
+                gflops += FLOPS_DGETRF( m_array[s], n_array[s] ) / 1e9;
+            }
+
+            /* Initialize the matrices */
+            lapackf77_dlarnv( &ione, ISEED, &n2, h_A );
+            magma_int_t columns = N * batchCount;
+            lapackf77_dlacpy( MagmaFullStr, &M, &columns, h_A, &lda, h_R, &lda );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            magma_time = magma_wtime();
+            if (opts.version == 1) {
+                info = magma_dgetrf_batched_cpu( M, N, A_array, lda, ipiv_array, info_array, batchCount );
+            }
+            else {
+                info = magma_dgetrf_vbatched_cpu( m_array, n_array, A_array, lda_array, ipiv_array, info_array, batchCount );
+            }
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+            if (info != 0) {
+                printf("magma_dgetrf_batched_cpu returned argument error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+                status += 1;
+            }
+            for (int s = 0; s < batchCount; ++s) {
+                if (info_array[s] != 0) {
+                    printf("magma_dgetrf_batched_cpu matrix %lld returned diag error %lld\n",
+                           (long long) s, (long long) info_array[s] );
+                    status += 1;
+                    break;
+                }
+            }
+
+            /* =====================================================================
+               Check the factorization
+               error = || P*A - L*U || / (N * ||A||), the worst over the batch
+               =================================================================== */
+            error = 0;
+            if ( opts.check ) {
+                for (int s = 0; s < batchCount; ++s) {
+                    magma_int_t Ms = m_array[s];
+                    magma_int_t Ns = n_array[s];
+                    magma_int_t Ks = min( Ms, Ns );
+                    double *A  = h_A + s * lda * N;
+                    double *LU = h_R + s * lda * N;
+                    double Anorm, err;
+                    lapackf77_dlacpy( MagmaFullStr, &Ms, &Ns, A, &lda, h_T, &lda );
+                    lapackf77_dlaswp( &Ns, h_T, &lda, &ione, &Ks, ipiv_array[s], &ione );
+                    // copy LU to L and U, and set diagonal of L to 1
+                    lapackf77_dlaset( MagmaFullStr, &Ms, &Ks, &c_zero, &c_zero, h_L, &M );
+                    lapackf77_dlaset( MagmaFullStr, &Ks, &Ns, &c_zero, &c_zero, h_U, &min_mn );
+                    lapackf77_dlacpy( MagmaLowerStr, &Ms, &Ks, LU, &lda, h_L, &M );
+                    for (magma_int_t j = 0; j < Ks; ++j) {
+                        h_L[ j + j*M ] = c_one;
+                    }
+                    lapackf77_dlacpy( MagmaUpperStr, &Ks, &Ns, LU, &lda, h_U, &min_mn );
+                    Anorm = lapackf77_dlange( "f", &Ms, &Ns, h_T, &lda, work );
+                    blasf77_dgemm( "N", "N", &Ms, &Ns, &Ks,
+                                   &c_one, h_L, &M, h_U, &min_mn, &c_neg_one, h_T, &lda );
+                    err = lapackf77_dlange( "f", &Ms, &Ns, h_T, &lda, work )
+                        / (Ns * Anorm);
+                    if ( isnan(err) || isinf(err) ) {
+                        error = err;
+                        break;
+                    }
+                    error = max( err, error );
+                }
+            }
+
+            /* =====================================================================
+               Performs operation using LAPACK
+               =================================================================== */
+            if ( opts.lapack ) {
+                cpu_time = magma_wtime();
+                #if defined(_OPENMP)
+                magma_int_t nthreads = magma_get_lapack_numthreads();
+                magma_set_lapack_numthreads(1);
+                magma_set_omp_numthreads(nthreads);
+                #pragma omp parallel for schedule(dynamic)
+                #endif
+                for (magma_int_t s=0; s < batchCount; s++) {
+                    magma_int_t locinfo;
+                    lapackf77_dgetrf( &m_array[s], &n_array[s], h_A + s * lda * N, &lda,
+                                      ipiv + s * min_mn, &locinfo );
+                    if (locinfo != 0) {
+                        printf("lapackf77_dgetrf matrix %lld returned error %lld: %s.\n",
+                               (long long) s, (long long) locinfo, magma_strerror( locinfo ));
+                    }
+                }
+                #if defined(_OPENMP)
+                magma_set_lapack_numthreads(nthreads);
+                #endif
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+
+                printf("%10lld %5lld %5lld   %7.2f (%7.2f)    %7.2f (%7.2f)",
+                       (long long) batchCount, (long long) M, (long long) N,
+                       cpu_perf, cpu_time*1000., magma_perf, magma_time*1000. );
+            }
+            else {
+                printf("%10lld %5lld %5lld     ---   (  ---  )    %7.2f (%7.2f)",
+                       (long long) batchCount, (long long) M, (long long) N,
+                       magma_perf, magma_time*1000. );
+            }
+            if ( opts.check ) {
+                bool okay = (error < tol);
+                status += ! okay;
+                printf("     %8.2e   %s\n", error, (okay ? "ok" : "failed"));
+            }
+            else {
+                printf("       ---\n");
+            }
+
+            magma_free_cpu( h_A );
+            magma_free_cpu( h_R );
+            magma_free_cpu( h_T );
+            magma_free_cpu( h_L );
+            magma_free_cpu( h_U );
+            magma_free_cpu( ipiv );
+            magma_free_cpu( ipiv_magma );
+            magma_free_cpu( m_array );
+            magma_free_cpu( n_array );
+            magma_free_cpu( lda_array );
+            magma_free_cpu( info_array );
+            magma_free_cpu( A_array );
+            magma_free_cpu( ipiv_array );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
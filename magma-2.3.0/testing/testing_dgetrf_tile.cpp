@@ -0,0 +1,275 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zgetrf_tile.cpp, normal z -> d, Sat Oct 17 06:16:06 2026
+       @author Mark Gates
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+
+// Initialize matrix to random.
+// This ensures the same ISEED is always used,
+// so we can re-generate the identical matrix.
+void init_matrix(
+    magma_opts &opts,
+    magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda )
+{
+    magma_int_t iseed_save[4];
+    for (magma_int_t i = 0; i < 4; ++i) {
+        iseed_save[i] = opts.iseed[i];
+    }
+
+    magma_generate_matrix( opts, m, n, nullptr, A, lda );
+
+    // restore iseed
+    for (magma_int_t i = 0; i < 4; ++i) {
+        opts.iseed[i] = iseed_save[i];
+    }
+}
+
+
+// On input, A and ipiv is LU factorization of A. On output, A is overwritten.
+// Requires m == n.
+// Uses init_matrix() to re-generate original A as needed.
+// Generates random RHS b and solves Ax=b.
+// Returns residual, |Ax - b| / (n |A| |x|).
+double get_residual(
+    magma_opts &opts,
+    magma_int_t m, magma_int_t n,
+    double *A, magma_int_t lda,
+    magma_int_t *ipiv )
+{
+    if ( m != n ) {
+        printf( "\nERROR: residual check defined only for square matrices\n" );
+        return -1;
+    }
+    
+    const double c_one     = MAGMA_D_ONE;
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const magma_int_t ione = 1;
+    
+    // this seed should be DIFFERENT than used in init_matrix
+    // (else x is column of A, so residual can be exactly zero)
+    magma_int_t ISEED[4] = {0,0,0,1};
+    magma_int_t info = 0;
+    double *x, *b;
+    
+    // initialize RHS
+    TESTING_CHECK( magma_dmalloc_cpu( &x, n ));
+    TESTING_CHECK( magma_dmalloc_cpu( &b, n ));
+    lapackf77_dlarnv( &ione, ISEED, &n, b );
+    blasf77_dcopy( &n, b, &ione, x, &ione );
+    
+    // solve Ax = b
+    lapackf77_dgetrs( "Notrans", &n, &ione, A, &lda, ipiv, x, &n, &info );
+    if (info != 0) {
+        printf("lapackf77_dgetrs returned error %lld: %s.\n",
+               (long long) info, magma_strerror( info ));
+    }
+    
+    // reset to original A
+    init_matrix( opts, m, n, A, lda );
+    
+    // compute r = Ax - b, saved in b
+    blasf77_dgemv( "Notrans", &m, &n, &c_one, A, &lda, x, &ione, &c_neg_one, b, &ione );
+    
+    // compute residual |Ax - b| / (n*|A|*|x|)
+    double norm_x, norm_A, norm_r, work[1];
+    norm_A = lapackf77_dlange( "F", &m, &n, A, &lda, work );
+    norm_r = lapackf77_dlange( "F", &n, &ione, b, &n, work );
+    norm_x = lapackf77_dlange( "F", &n, &ione, x, &n, work );
+    
+    //printf( "r=\n" ); magma_dprint( 1, n, b, 1 );
+    
+    magma_free_cpu( x );
+    magma_free_cpu( b );
+    
+    //printf( "r=%.2e, A=%.2e, x=%.2e, n=%lld\n", norm_r, norm_A, norm_x, (long long) n );
+    return norm_r / (n * norm_A * norm_x);
+}
+
+
+// On input, LU and ipiv is LU factorization of A. On output, LU is overwritten.
+// Works for any m, n.
+// Uses init_matrix() to re-generate original A as needed.
+// Returns error in factorization, |PA - LU| / (n |A|)
+// This allocates 3 more matrices to store A, L, and U.
+double get_LU_error(
+    magma_opts &opts,
+    magma_int_t M, magma_int_t N,
+    double *LU, magma_int_t lda,
+    magma_int_t *ipiv)
+{
+    magma_int_t min_mn = min(M,N);
+    magma_int_t ione   = 1;
+    magma_int_t i, j;
+    double alpha = MAGMA_D_ONE;
+    double beta  = MAGMA_D_ZERO;
+    double *A, *L, *U;
+    double work[1], matnorm, residual;
+    
+    TESTING_CHECK( magma_dmalloc_cpu( &A, lda*N    ));
+    TESTING_CHECK( magma_dmalloc_cpu( &L, M*min_mn ));
+    TESTING_CHECK( magma_dmalloc_cpu( &U, min_mn*N ));
+    memset( L, 0, M*min_mn*sizeof(double) );
+    memset( U, 0, min_mn*N*sizeof(double) );
+
+    // set to original A
+    init_matrix( opts, M, N, A, lda );
+    lapackf77_dlaswp( &N, A, &lda, &ione, &min_mn, ipiv, &ione);
+    
+    // copy LU to L and U, and set diagonal to 1
+    lapackf77_dlacpy( MagmaLowerStr, &M, &min_mn, LU, &lda, L, &M      );
+    lapackf77_dlacpy( MagmaUpperStr, &min_mn, &N, LU, &lda, U, &min_mn );
+    for (j=0; j < min_mn; j++)
+        L[j+j*M] = MAGMA_D_MAKE( 1., 0. );
+    
+    matnorm = lapackf77_dlange("f", &M, &N, A, &lda, work);
+
+    blasf77_dgemm("N", "N", &M, &N, &min_mn,
+                  &alpha, L, &M, U, &min_mn, &beta, LU, &lda);
+
+    for( j = 0; j < N; j++ ) {
+        for( i = 0; i < M; i++ ) {
+            LU[i+j*lda] = MAGMA_D_SUB( LU[i+j*lda], A[i+j*lda] );
+        }
+    }
+    residual = lapackf77_dlange("f", &M, &N, LU, &lda, work);
+
+    magma_free_cpu( A );
+    magma_free_cpu( L );
+    magma_free_cpu( U );
+
+    return residual / (matnorm * N);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing dgetrf_tile
+   Time excludes conversion to and from tile-major layout.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gflops, gpu_perf, gpu_time, cpu_perf=0, cpu_time=0;
+    double          error;
+    double *h_A, *h_T;
+    magma_int_t     *ipiv;
+    magma_int_t     M, N, n2, lda, info, min_mn, nb;
+    int status = 0;
+    
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+    
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+
+    if ( opts.check == 2 ) {
+        printf("%%   M     N    NB   CPU Gflop/s (sec)  Tile Gflop/s (sec)   |Ax-b|/(N*|A|*|x|)\n");
+    }
+    else {
+        printf("%%   M     N    NB   CPU Gflop/s (sec)  Tile Gflop/s (sec)   |PA-LU|/(N*|A|)\n");
+    }
+    printf("%%========================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M = opts.msize[itest];
+            N = opts.nsize[itest];
+            min_mn = min(M, N);
+            lda    = M;
+            n2     = lda*N;
+            nb     = (opts.nb > 0 ? opts.nb : magma_get_zgetrf_nb( M, N ));
+            gflops = FLOPS_DGETRF( M, N ) / 1e9;
+            
+            TESTING_CHECK( magma_imalloc_cpu( &ipiv, min_mn ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_A,  n2 ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_T,  magma_roundup( M, nb )*magma_roundup( N, nb ) ));
+            
+            /* =====================================================================
+               Performs operation using LAPACK
+               =================================================================== */
+            if ( opts.lapack ) {
+                init_matrix( opts, M, N, h_A, lda );
+                
+                cpu_time = magma_wtime();
+                lapackf77_dgetrf( &M, &N, h_A, &lda, ipiv, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_dgetrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+            }
+            
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            init_matrix( opts, M, N, h_A, lda );
+            magma_dge2tile( M, N, nb, h_A, lda, h_T );
+            
+            gpu_time = magma_wtime();
+            magma_dgetrf_tile( M, N, nb, h_T, ipiv, &info );
+            gpu_time = magma_wtime() - gpu_time;
+            gpu_perf = gflops / gpu_time;
+            if (info != 0) {
+                printf("magma_dgetrf_tile returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+            magma_dtile2ge( M, N, nb, h_T, h_A, lda );
+            
+            /* =====================================================================
+               Check the factorization
+               =================================================================== */
+            if ( opts.lapack ) {
+                printf("%5lld %5lld %5lld   %7.2f (%7.2f)   %7.2f (%7.2f)",
+                       (long long) M, (long long) N, (long long) nb,
+                       cpu_perf, cpu_time, gpu_perf, gpu_time );
+            }
+            else {
+                printf("%5lld %5lld %5lld     ---   (  ---  )   %7.2f (%7.2f)",
+                       (long long) M, (long long) N, (long long) nb, gpu_perf, gpu_time );
+            }
+            if ( opts.check == 2 ) {
+                error = get_residual( opts, M, N, h_A, lda, ipiv );
+                printf("   %8.2e   %s\n", error, (error < tol ? "ok" : "failed"));
+                status += ! (error < tol);
+            }
+            else if ( opts.check ) {
+                error = get_LU_error( opts, M, N, h_A, lda, ipiv );
+                printf("   %8.2e   %s\n", error, (error < tol ? "ok" : "failed"));
+                status += ! (error < tol);
+            }
+            else {
+                printf("     ---   \n");
+            }
+            
+            magma_free_cpu( ipiv );
+            magma_free_cpu( h_A  );
+            magma_free_cpu( h_T  );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -124,6 +124,39 @@ int main( int argc, char** argv )
                     serror, (serror == 0 ? "ok" : "failed") );
             status += ! (serror == 0);
             
+            /* =====================================================================
+               Performs operation using magma_dlat2s_cpu, then checks that it
+               reports the first entry out of range
+               =================================================================== */
+            // the other triangle is not converted; start with SR = SA there
+            lapackf77_slacpy( "Full", &n, &n, SA, &lda, SR, &lda );
+            cpu_time = magma_wtime();
+            magma_dlat2s_cpu( uplo[iuplo], n, A, lda, SR, lda, &info );
+            cpu_time = magma_wtime() - cpu_time;
+            cpu_perf = gbytes / cpu_time;
+            if (info != 0) {
+                printf("magma_dlat2s_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+            
+            blasf77_saxpy( &size, &s_neg_one, SA, &ione, SR, &ione );
+            serror = lapackf77_slange( "Fro", &n, &n, SR, &lda, swork );
+            
+            // diagonal entries, which are in either triangle
+            magma_int_t overflow;
+            magma_int_t k1 = (n-1) + (n-1)*lda;
+            magma_int_t k2 = n/2 + (n/2)*lda;
+            A[k1] = MAGMA_D_MAKE(  1e300, 0 );
+            A[k2] = MAGMA_D_MAKE( -1e300, 0 );
+            magma_dlat2s_cpu( uplo[iuplo], n, A, lda, SR, lda, &overflow );
+            bool okay = (serror == 0 && overflow == k2 + 1);
+            
+            printf( "  _cpu %5s %5lld   %7.2f (%7.2f)   overflow %8lld   %8.2e   %s\n",
+                    lapack_uplo_const(uplo[iuplo]), (long long) n,
+                    cpu_perf, cpu_time*1000., (long long) overflow,
+                    serror, (okay ? "ok" : "failed") );
+            status += ! okay;
+            
             /* =====================================================================
                Reset matrices
                =================================================================== */
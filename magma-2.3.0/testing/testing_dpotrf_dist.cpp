@@ -0,0 +1,213 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zpotrf_dist.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+#if defined(HAVE_MPI)
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Copies participant d's part of the global matrix hA to its local matrix
+   A (to_local), or back.
+*/
+static void copy_local(
+    const magma_bcyclic_t *desc, magma_int_t d, bool to_local,
+    double *hA, magma_int_t lda, double *A )
+{
+    magma_int_t mloc, nloc, i, j;
+    magma_bcyclic_local_size( desc, d, &mloc, &nloc );
+    for (magma_int_t jl = 0; jl < nloc; jl += desc->nb) {
+        for (magma_int_t il = 0; il < mloc; il += desc->mb) {
+            magma_int_t ib = min( desc->mb, mloc - il );
+            magma_int_t jb = min( desc->nb, nloc - jl );
+            magma_bcyclic_global_index( desc, d, il, jl, &i, &j );
+            if (to_local)
+                lapackf77_dlacpy( MagmaFullStr, &ib, &jb, hA + i + j*lda, &lda,
+                                  A + il + jl*desc->ldd, &desc->ldd );
+            else
+                lapackf77_dlacpy( MagmaFullStr, &ib, &jb, A + il + jl*desc->ldd, &desc->ldd,
+                                  hA + i + j*lda, &lda );
+        }
+    }
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Gathers the local matrices A of all ranks into hA on rank 0.
+*/
+static void gather_matrix(
+    const magma_bcyclic_t *desc, double *A,
+    double *hA, magma_int_t lda, int rank, int nprocs )
+{
+    magma_int_t mloc, nloc, size;
+    if (rank != 0) {
+        magma_bcyclic_local_size( desc, rank, &mloc, &nloc );
+        size = desc->ldd*nloc*sizeof(double);
+        MPI_Send( A, int(size), MPI_BYTE, 0, 0, MPI_COMM_WORLD );
+        return;
+    }
+    copy_local( desc, 0, false, hA, lda, A );
+    for (int d = 1; d < nprocs; ++d) {
+        double *B;
+        magma_bcyclic_local_size( desc, d, &mloc, &nloc );
+        TESTING_CHECK( magma_dmalloc_cpu( &B, desc->ldd*max(1,nloc) ));
+        size = desc->ldd*nloc*sizeof(double);
+        MPI_Recv( B, int(size), MPI_BYTE, d, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE );
+        copy_local( desc, d, false, hA, lda, B );
+        magma_free_cpu( B );
+    }
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing zpotrf_dist
+   Run with several ranks, e.g., mpirun -np 4 ./testing_dpotrf_dist;
+   on one node, MPI's shared-memory transport stands in for the network.
+*/
+int main( int argc, char** argv)
+{
+    MPI_Init( &argc, &argv );
+    int rank, nprocs;
+    MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+    MPI_Comm_size( MPI_COMM_WORLD, &nprocs );
+
+    TESTING_CHECK( magma_init() );
+    if (rank == 0) {
+        magma_print_environment();
+    }
+
+    // constants
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const magma_int_t ione = 1;
+
+    // locals
+    real_Double_t   gflops, dist_perf, dist_time, cpu_perf, cpu_time;
+    double *h_A, *h_R, *A;
+    magma_int_t N, n2, lda, nb, P, Q, mloc, nloc, info;
+    double      Anorm, error, work[1], *sigma;
+    magma_bcyclic_t desc;
+    int status = 0;
+
+    magma_opts opts;
+    opts.matrix = "rand_dominant";  // default
+    opts.parse_opts( argc, argv );
+    opts.lapack |= opts.check;  // check (-c) implies lapack (-l)
+
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+
+    magma_bcyclic_grid( nprocs, &P, &Q );
+    if (rank == 0) {
+        printf("%% uplo = %s, %lld x %lld grid of ranks\n",
+               lapack_uplo_const( MagmaLower ), (long long) P, (long long) Q );
+        printf("%% N     nb   CPU Gflop/s (sec)   MPI Gflop/s (sec)   ||R_dist - R_lapack||_F / ||R_lapack||_F\n");
+        printf("%%===========================================================\n");
+    }
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N   = opts.nsize[itest];
+            nb  = (opts.nb > 0 ? opts.nb : magma_get_zpotrf_nb( N ));
+            lda = N;
+            n2  = lda*N;
+            gflops = FLOPS_DPOTRF( N ) / 1e9;
+
+            TESTING_CHECK( magma_bcyclic_init( &desc, N, N, nb, nb, P, Q ));
+            magma_bcyclic_local_size( &desc, rank, &mloc, &nloc );
+
+            TESTING_CHECK( magma_dmalloc_cpu( &h_A, n2 ));
+            TESTING_CHECK( magma_dmalloc_cpu( &sigma, N ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_R, n2 ));
+            TESTING_CHECK( magma_dmalloc_cpu( &A, desc.ldd*max(1,nloc) ));
+
+            /* Initialize the matrix, the same on all ranks */
+            magma_generate_matrix( opts, N, N, sigma, h_A, lda );
+            lapackf77_dlacpy( MagmaFullStr, &N, &N, h_A, &lda, h_R, &lda );
+            copy_local( &desc, rank, true, h_A, lda, A );
+
+            /* ====================================================================
+               Performs operation using MAGMA over MPI
+               =================================================================== */
+            MPI_Barrier( MPI_COMM_WORLD );
+            dist_time = magma_wtime();
+            magma_dpotrf_dist( MagmaLower, N, A, &desc, MPI_COMM_WORLD, &info );
+            MPI_Barrier( MPI_COMM_WORLD );
+            dist_time = magma_wtime() - dist_time;
+            dist_perf = gflops / dist_time;
+            if (info != 0 && rank == 0) {
+                printf("magma_dpotrf_dist returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            if ( opts.lapack ) {
+                gather_matrix( &desc, A, h_R, lda, rank, nprocs );
+            }
+            if ( opts.lapack && rank == 0 ) {
+                /* =====================================================================
+                   Performs operation using LAPACK
+                   =================================================================== */
+                cpu_time = magma_wtime();
+                lapackf77_dpotrf( MagmaLowerStr, &N, h_A, &lda, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_dpotrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+
+                /* =====================================================================
+                   Check the result compared to LAPACK
+                   =================================================================== */
+                blasf77_daxpy(&n2, &c_neg_one, h_A, &ione, h_R, &ione);
+                Anorm = lapackf77_dlange("f", &N, &N, h_A, &lda, work);
+                error = lapackf77_dlange("f", &N, &N, h_R, &lda, work) / Anorm;
+
+                printf("%5lld %4lld   %7.2f (%7.2f)   %7.2f (%7.2f)   %8.2e   %s\n",
+                       (long long) N, (long long) nb, cpu_perf, cpu_time, dist_perf, dist_time,
+                       error, (error < tol ? "ok" : "failed") );
+                status += ! (error < tol);
+            }
+            else if ( rank == 0 ) {
+                printf("%5lld %4lld     ---   (  ---  )   %7.2f (%7.2f)     ---  \n",
+                       (long long) N, (long long) nb, dist_perf, dist_time );
+            }
+            magma_free_cpu( h_A );
+            magma_free_cpu( sigma );
+            magma_free_cpu( h_R );
+            magma_free_cpu( A );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 && rank == 0 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    MPI_Bcast( &status, 1, MPI_INT, 0, MPI_COMM_WORLD );
+    MPI_Finalize();
+    return status;
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+    printf("%% testing_dpotrf_dist requires MAGMA built with -DHAVE_MPI; skipped.\n");
+    return 0;
+}
+
+#endif // HAVE_MPI
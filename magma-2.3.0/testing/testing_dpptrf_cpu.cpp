@@ -0,0 +1,176 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zpptrf_cpu.cpp, normal z -> d, Wed Nov 15 00:34:20 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Checks the packed (TP) and RFP (TF) conversions of the uplo triangle of A
+   against LAPACK's dtrttp and dtrttf, for both transr, and that converting
+   back restores the triangle. All are copies, so they must match exactly.
+   Returns the number of failures.
+*/
+static int check_formats(
+    magma_uplo_t uplo, magma_int_t N,
+    const double *A, magma_int_t lda )
+{
+    const double c_zero = MAGMA_D_ZERO;
+    const magma_trans_t transr[] = { MagmaNoTrans, MagmaTrans };
+    magma_int_t npack = N*(N+1)/2, info;
+    double *AP, *RP, *B;
+    int errors = 0;
+
+    TESTING_CHECK( magma_dmalloc_cpu( &AP, max( 1, npack ) ));
+    TESTING_CHECK( magma_dmalloc_cpu( &RP, max( 1, npack ) ));
+    TESTING_CHECK( magma_dmalloc_cpu( &B,  lda*N ));
+
+    // packed
+    lapackf77_dtrttp( lapack_uplo_const(uplo), &N, A, &lda, RP, &info );
+    magma_dtrttp_cpu( uplo, N, A, lda, AP, &info );
+    errors += (memcmp( AP, RP, npack*sizeof(double) ) != 0);
+    lapackf77_dlacpy( "Full", &N, &N, A, &lda, B, &lda );
+    lapackf77_dlaset( lapack_uplo_const(uplo), &N, &N, &c_zero, &c_zero, B, &lda );
+    magma_dtpttr_cpu( uplo, N, AP, B, lda, &info );
+    errors += (memcmp( B, A, lda*N*sizeof(double) ) != 0);
+
+    // rectangular full packed
+    for (int t = 0; t < 2; ++t) {
+        lapackf77_dtrttf( lapack_trans_const(transr[t]), lapack_uplo_const(uplo),
+                          &N, A, &lda, RP, &info );
+        magma_dtrttf_cpu( transr[t], uplo, N, A, lda, AP, &info );
+        errors += (memcmp( AP, RP, npack*sizeof(double) ) != 0);
+        lapackf77_dlaset( lapack_uplo_const(uplo), &N, &N, &c_zero, &c_zero, B, &lda );
+        magma_dtfttr_cpu( transr[t], uplo, N, AP, B, lda, &info );
+        errors += (memcmp( B, A, lda*N*sizeof(double) ) != 0);
+    }
+
+    magma_free_cpu( AP );
+    magma_free_cpu( RP );
+    magma_free_cpu( B  );
+    return errors;
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing dpptrf_cpu, and the packed and RFP conversions
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    // constants
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const magma_int_t ione = 1;
+
+    // locals
+    real_Double_t   gflops, cpu_perf, cpu_time, magma_perf, magma_time;
+    double *h_A, *h_AP, *h_RP;
+    magma_int_t N, n2, npack, lda, info;
+    double      Anorm, error, work[1], *sigma;
+    int status = 0;
+
+    magma_opts opts;
+    opts.matrix = "rand_dominant";  // default
+    opts.parse_opts( argc, argv );
+    opts.lapack |= opts.check;  // check (-c) implies lapack (-l)
+
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+
+    printf("%% uplo = %s\n", lapack_uplo_const(opts.uplo) );
+    printf("%%   N   CPU Gflop/s (sec)   MAGMA Gflop/s (sec)   ||R_magma - R_lapack||_F / ||R_lapack||_F   TP/TF\n");
+    printf("%%=========================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N     = opts.nsize[itest];
+            lda   = max( 1, N );
+            n2    = lda*N;
+            npack = N*(N+1)/2;
+            gflops = FLOPS_DPOTRF( N ) / 1e9;
+
+            TESTING_CHECK( magma_dmalloc_cpu( &h_A, n2 ));
+            TESTING_CHECK( magma_dmalloc_cpu( &sigma, N ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_AP, max( 1, npack ) ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_RP, max( 1, npack ) ));
+
+            /* Initialize the matrix */
+            magma_generate_matrix( opts, N, N, sigma, h_A, lda );
+            int format_errors = check_formats( opts.uplo, N, h_A, lda );
+            status += (format_errors != 0);
+
+            magma_dtrttp_cpu( opts.uplo, N, h_A, lda, h_AP, &info );
+            blasf77_dcopy( &npack, h_AP, &ione, h_RP, &ione );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            magma_time = magma_wtime();
+            magma_dpptrf_cpu( opts.uplo, N, h_AP, &info );
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+            if (info != 0) {
+                printf("magma_dpptrf_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            if ( opts.lapack ) {
+                /* =====================================================================
+                   Performs operation using LAPACK
+                   =================================================================== */
+                cpu_time = magma_wtime();
+                lapackf77_dpptrf( lapack_uplo_const(opts.uplo), &N, h_RP, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_dpptrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+
+                /* =====================================================================
+                   Check the result compared to LAPACK
+                   =================================================================== */
+                blasf77_daxpy( &npack, &c_neg_one, h_RP, &ione, h_AP, &ione );
+                Anorm = lapackf77_dlange( "f", &npack, &ione, h_RP, &npack, work );
+                error = lapackf77_dlange( "f", &npack, &ione, h_AP, &npack, work ) / Anorm;
+
+                printf("%5lld   %7.2f (%7.2f)   %7.2f (%7.2f)     %8.2e                                  %s\n",
+                       (long long) N, cpu_perf, cpu_time, magma_perf, magma_time,
+                       error, (error < tol && format_errors == 0 ? "ok" : "failed") );
+                status += ! (error < tol);
+            }
+            else {
+                printf("%5lld     ---   (  ---  )   %7.2f (%7.2f)       ---                                     %s\n",
+                       (long long) N, magma_perf, magma_time,
+                       (format_errors == 0 ? "ok" : "failed") );
+            }
+            magma_free_cpu( h_A );
+            magma_free_cpu( sigma );
+            magma_free_cpu( h_AP );
+            magma_free_cpu( h_RP );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -0,0 +1,281 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+// internal header, after the STL headers since magma_internal.h defines min, max;
+// needs -I control
+#include "schedule_sim.hpp"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Times the kinds of work of the dry runs, at panel-like sizes, on this
+   machine: BLAS on the queue's device, LAPACK panels on the host, and
+   transfers over the link; adds them to the model's table.
+*/
+static void calibrate( magma_sim_model& model, magma_queue_t queue )
+{
+    const magma_int_t Ms[] = { 1024, 3072 };
+    const magma_int_t bs[] = { 64, 128, 256, 512 };
+    const magma_int_t ione = 1;
+    magma_int_t ISEED[4] = { 0, 0, 0, 1 };
+    const double c_one = MAGMA_D_ONE, c_neg_one = MAGMA_D_NEG_ONE;
+
+    const magma_int_t maxM = 3072;
+    magma_int_t size = maxM*maxM, info;
+    magma_int_t *ipiv;
+    double *hA, *hB;
+    magmaDouble_ptr dA, dB, dC;
+    TESTING_CHECK( magma_dmalloc_cpu( &hA, size ));
+    TESTING_CHECK( magma_dmalloc_cpu( &hB, size ));
+    TESTING_CHECK( magma_imalloc_cpu( &ipiv, maxM ));
+    TESTING_CHECK( magma_dmalloc( &dA, size ));
+    TESTING_CHECK( magma_dmalloc( &dB, size ));
+    TESTING_CHECK( magma_dmalloc( &dC, size ));
+    lapackf77_dlarnv( &ione, ISEED, &size, hA );
+    for (magma_int_t i = 0; i < maxM; ++i) {
+        ipiv[i] = maxM - i;  // a swap in each row
+    }
+    // diagonally dominant, for potrf
+    for (magma_int_t i = 0; i < maxM; ++i) {
+        hA[ i + i*maxM ] += maxM;
+    }
+    magma_dsetmatrix( maxM, maxM, hA, maxM, dA, maxM, queue );
+    magma_dsetmatrix( maxM, maxM, hA, maxM, dB, maxM, queue );
+    magma_dsetmatrix( maxM, maxM, hA, maxM, dC, maxM, queue );
+
+    // best of 2 runs, after a warmup
+    #define TIME( unit_, kind_, m_, n_, k_, call_ )                           \
+        do {                                                                  \
+            real_Double_t best_ = 0;                                          \
+            for (int iter_ = 0; iter_ < 3; ++iter_) {                         \
+                real_Double_t t_ = magma_sync_wtime( queue );                 \
+                call_;                                                        \
+                t_ = magma_sync_wtime( queue ) - t_;                          \
+                if (iter_ == 1 || (iter_ > 1 && t_ < best_))                  \
+                    best_ = t_;                                               \
+            }                                                                 \
+            model.calibrate( unit_, kind_, m_, n_, k_, best_ );               \
+        } while (0)
+
+    for (int im = 0; im < 2; ++im) {
+        for (int ib = 0; ib < 4; ++ib) {
+            magma_int_t M = Ms[im], b = bs[ib];
+            TIME( MagmaSimDevice, MagmaSimGemm, M, b, M,
+                  magma_dgemm( MagmaNoTrans, MagmaTrans, M, b, M,
+                               c_neg_one, dA, maxM, dB, maxM, c_one, dC, maxM, queue ));
+            TIME( MagmaSimDevice, MagmaSimGemm, M, M, b,
+                  magma_dgemm( MagmaNoTrans, MagmaNoTrans, M, M, b,
+                               c_neg_one, dA, maxM, dB, maxM, c_one, dC, maxM, queue ));
+            TIME( MagmaSimDevice, MagmaSimSyrk, b, b, M,
+                  magma_dsyrk( MagmaLower, MagmaNoTrans, b, M,
+                               c_neg_one, dA, maxM, c_one, dC, maxM, queue ));
+            TIME( MagmaSimDevice, MagmaSimTrsm, M, b, b,
+                  magma_dtrsm( MagmaRight, MagmaLower, MagmaTrans, MagmaNonUnit, M, b,
+                               c_one, dA, maxM, dC, maxM, queue ));
+            TIME( MagmaSimDevice, MagmaSimTranspose, M, b, 0,
+                  magmablas_dtranspose( M, b, dA, maxM, dC, maxM, queue ));
+            TIME( MagmaSimDevice, MagmaSimLaswp, b, M, b,
+                  magmablas_dlaswp( M, dC, maxM, 1, b, ipiv, 1, queue ));
+            TIME( MagmaSimLink, MagmaSimCopy, M, b, 0,
+                  magma_dsetmatrix( M, b, hA, maxM, dC, maxM, queue ));
+            TIME( MagmaSimLink, MagmaSimCopy, b, M, 0,
+                  magma_dgetmatrix( b, M, dA, maxM, hB, maxM, queue ));
+            TIME( MagmaSimHost, MagmaSimGetrf, M, b, 0,
+                  lapackf77_dlacpy( MagmaFullStr, &M, &b, hA, &maxM, hB, &maxM );
+                  lapackf77_dgetrf( &M, &b, hB, &maxM, ipiv, &info ));
+            if (im == 0) {
+                TIME( MagmaSimHost, MagmaSimPotrf, b, b, 0,
+                      lapackf77_dlacpy( MagmaFullStr, &b, &b, hA, &maxM, hB, &maxM );
+                      lapackf77_dpotrf( MagmaLowerStr, &b, hB, &maxM, &info ));
+            }
+        }
+    }
+    #undef TIME
+
+    magma_free_cpu( hA );
+    magma_free_cpu( hB );
+    magma_free_cpu( ipiv );
+    magma_free( dA );
+    magma_free( dB );
+    magma_free( dC );
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Simulates dgetrf_mgpu (lu) or dpotrf3_mgpu with the configuration.
+*/
+static magma_sim_report simulate(
+    const magma_sim_model& model, bool lu, magma_int_t M, magma_int_t N,
+    magma_int_t ngpu, magma_int_t nb, magma_int_t lookahead, magma_int_t nqueue )
+{
+    magma_sim sim( model, ngpu, nqueue );
+    if (lu)
+        magma_dgetrf_mgpu_sim( sim, M, N, nb, lookahead );
+    else
+        magma_dpotrf3_mgpu_sim( sim, N, nb, lookahead );
+    return sim.run();
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Checks that the schedule is consistent, and that the dry run does all
+   the flops of the factorization.
+   @return 0 if ok, else 1.
+*/
+static int check_report( const magma_sim_report& r, double flops, double tol )
+{
+    const double eps = 1e-12 * r.makespan;
+    bool okay = (r.violations == 0)
+             && (r.makespan >= r.critical_path - eps)
+             && (fabs( r.flops - flops ) <= tol * flops);
+    for (size_t i = 0; i < r.resources.size(); ++i) {
+        okay = okay && (r.resources[i].busy <= r.makespan + eps);
+    }
+    return ! okay;
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing the schedule simulator, and tuning with it.
+      For each size, and 1, 2, 4, 8 simulated gpus, predicts the time of
+      dgetrf_mgpu and dpotrf3_mgpu as configured today, and finds the best
+      nb (or --nb), look-ahead, and queue count.
+      The cost model is a roofline of a reference node, unless
+      $MAGMA_SIM_MODEL names a model file; if $MAGMA_SIM_CALIBRATE names
+      a file, times the kernels on this machine first, and saves the model.
+      With -c, checks each schedule; with --verbose, prints where the time
+      of the current configuration goes.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    const magma_int_t ngpus[] = { 1, 2, 4, 8 };
+    const magma_int_t nbs[]   = { 64, 128, 192, 256, 320, 384, 448, 512, 640, 768, 1024 };
+    const int nngpu = sizeof(ngpus) / sizeof(ngpus[0]);
+    const int nnb   = sizeof(nbs)   / sizeof(nbs[0]);
+    int status = 0;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    // unit trsm counts as non-unit, so dgetrf's flops are off by O(n^2 ngpu)
+    double tol = 1e-2;
+
+    magma_sim_model model;
+    const char* filename = getenv( "MAGMA_SIM_MODEL" );
+    if (filename != NULL) {
+        TESTING_CHECK( model.load( filename ));
+    }
+    filename = getenv( "MAGMA_SIM_CALIBRATE" );
+    if (filename != NULL) {
+        calibrate( model, opts.queue );
+        TESTING_CHECK( model.save( filename ));
+        printf( "%% calibrated model saved in %s\n", filename );
+    }
+    printf( "%% model: host %.0f Gflop/s, %.0f GB/s; device %.0f Gflop/s, %.0f GB/s; link %.1f GB/s\n",
+            model.peak[MagmaSimHost],   model.bandwidth[MagmaSimHost],
+            model.peak[MagmaSimDevice], model.bandwidth[MagmaSimDevice],
+            model.bandwidth[MagmaSimLink] );
+
+    for (int lu = 1; lu >= 0; --lu) {
+        const magma_int_t nqueue_driver = (lu ? 2 : 3);
+        printf( "\n%% %s: current = driver's nb, look-ahead 1, %lld queues; best = over nb, look-ahead 0 or 1, 1 to %lld queues\n",
+                (lu ? "dgetrf_mgpu" : "dpotrf3_mgpu"),
+                (long long) nqueue_driver, (long long) nqueue_driver );
+        printf( "%%   M     N  ngpu    current: nb  time (s)  Gflop/s  crit.path  host idle  dev idle     best: nb la nq  time (s)  Gflop/s  speedup%s\n",
+                (opts.check ? "  check" : "") );
+        printf( "%%==============================================================================================================================\n" );
+        for (int itest = 0; itest < opts.ntest; ++itest) {
+            magma_int_t M = (lu ? opts.msize[itest] : opts.nsize[itest]);
+            magma_int_t N = opts.nsize[itest];
+            double flops = (lu ? FLOPS_DGETRF( M, N ) : FLOPS_DPOTRF( N ));
+            magma_int_t nb_driver = (lu ? magma_get_dgetrf_nb( M, N ) : magma_get_dpotrf_nb( N ));
+
+            for (int ig = 0; ig < nngpu; ++ig) {
+                magma_int_t ngpu = ngpus[ig];
+                // the drivers need at least a block column per gpu
+                if (nb_driver >= N || ngpu > magma_ceildiv( N, nb_driver ))
+                    continue;
+                int failed = 0;
+
+                magma_sim_report cur = simulate( model, lu, M, N, ngpu, nb_driver, 1, nqueue_driver );
+                failed += check_report( cur, flops, tol );
+
+                double dev_idle = 0;
+                for (magma_int_t d = 0; d < ngpu; ++d) {
+                    dev_idle += cur.resources[ 1 + 3*d ].idle;
+                }
+                dev_idle /= ngpu;
+
+                magma_int_t best_nb = nb_driver, best_la = 1, best_nq = nqueue_driver;
+                double best_time = cur.makespan;
+                for (int inb = 0; inb < nnb; ++inb) {
+                    magma_int_t nb = (opts.nb > 0 ? opts.nb : nbs[inb]);
+                    if (nb >= N || ngpu > magma_ceildiv( N, nb ))
+                        continue;
+                    for (magma_int_t la = 0; la <= 1; ++la) {
+                        for (magma_int_t nq = 1; nq <= nqueue_driver; ++nq) {
+                            magma_sim_report r = simulate( model, lu, M, N, ngpu, nb, la, nq );
+                            if (opts.check)
+                                failed += check_report( r, flops, tol );
+                            if (r.makespan < best_time) {
+                                best_time = r.makespan;
+                                best_nb = nb;
+                                best_la = la;
+                                best_nq = nq;
+                            }
+                        }
+                    }
+                    if (opts.nb > 0)
+                        break;
+                }
+
+                printf( "%5lld %5lld  %4lld   %12lld  %8.4f  %7.0f  %8.4f   %6.1f%%   %6.1f%%   %11lld %2lld %2lld  %8.4f  %7.0f  %6.2fx%s\n",
+                        (long long) M, (long long) N, (long long) ngpu,
+                        (long long) nb_driver, cur.makespan, flops / 1e9 / cur.makespan,
+                        cur.critical_path,
+                        100 * cur.resources[0].idle / cur.makespan,
+                        100 * dev_idle / cur.makespan,
+                        (long long) best_nb, (long long) best_la, (long long) best_nq,
+                        best_time, flops / 1e9 / best_time, cur.makespan / best_time,
+                        (opts.check ? (failed ? "  failed" : "  ok") : "") );
+                status += (failed != 0);
+
+                if (opts.verbose) {
+                    printf( "%%      %lld tasks;", (long long) cur.ntask );
+                    for (size_t i = 0; i < cur.resources.size(); ++i) {
+                        printf( "  %s busy %.4f", cur.resources[i].name.c_str(), cur.resources[i].busy );
+                    }
+                    printf( "\n%%      binding chain:" );
+                    std::map< std::string, double >::const_iterator iter;
+                    for (iter = cur.path.begin(); iter != cur.path.end(); ++iter) {
+                        printf( "  %s %.1f%%", iter->first.c_str(), 100 * iter->second / cur.makespan );
+                    }
+                    printf( "\n" );
+                }
+                fflush( stdout );
+            }
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
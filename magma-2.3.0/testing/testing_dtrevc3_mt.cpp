@@ -0,0 +1,199 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal d -> s
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Returns ||X - Y||_F / ||Y||_F for n-by-n X and Y, both with leading
+   dimension ld; X is overwritten.
+*/
+static double diff_norm(
+    magma_int_t n, double *X, const double *Y, magma_int_t ld )
+{
+    const double c_neg_one = MAGMA_D_NEG_ONE;
+    const magma_int_t ione = 1;
+    double work[1];
+    for (magma_int_t j = 0; j < n; ++j) {
+        blasf77_daxpy( &n, &c_neg_one, Y + j*ld, &ione, X + j*ld, &ione );
+    }
+    double Ynorm = lapackf77_dlange( "F", &n, &n, Y, &ld, work );
+    double Xnorm = lapackf77_dlange( "F", &n, &n, X, &ld, work );
+    return (Ynorm == 0 ? Xnorm : Xnorm / Ynorm);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing dtrevc3_mt
+   Computes the Schur form T = Q^T A Q of a random matrix, which has many
+   2x2 blocks for complex conjugate pairs, then compares the left and right
+   eigenvectors of dtrevc3_mt with LAPACK dtrevc3, both back-transformed
+   by Q (howmany = MagmaBacktransVec) and of T itself (MagmaAllVec).
+   The block size nb of dtrevc3_mt is set through lwork = n + 2*n*nb;
+   with --nb, only that nb is tested, else nb = 16, 32, 64, 128, 256.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   magma_time, cpu_time=0;
+    double          vl_error, vr_error, error;
+    magma_int_t N, lda, n2, lwork, lwork_lapack, nb, mout, info;
+    magma_int_t ione = 1;
+    double *hA, *hT, *hQ, *tau, *wr, *wi, *hwork;
+    double *VLmagma, *VRmagma, *VLlapack, *VRlapack;
+    int status = 0;
+
+    const magma_int_t nb_list[] = { 16, 32, 64, 128, 256 };
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+
+    printf("%% Errors are the max over howmany = BacktransVec and AllVec.\n");
+    printf("%%   N    nb  pairs   MAGMA time (sec)   CPU time (sec)   VL error   VR error\n");
+    printf("%%============================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N     = opts.nsize[itest];
+            lda   = max( 1, N );
+            n2    = lda*N;
+            lwork_lapack = max( 1, N*(1 + 2*256) );  // also for dgehrd, dorghr, dhseqr
+            lwork = max( lwork_lapack, 3*N );      // also for nb up to 256
+
+            TESTING_CHECK( magma_dmalloc_cpu( &hA,       n2       ));
+            TESTING_CHECK( magma_dmalloc_cpu( &hT,       n2       ));
+            TESTING_CHECK( magma_dmalloc_cpu( &hQ,       n2       ));
+            TESTING_CHECK( magma_dmalloc_cpu( &tau,      max(1,N) ));
+            TESTING_CHECK( magma_dmalloc_cpu( &wr,       max(1,N) ));
+            TESTING_CHECK( magma_dmalloc_cpu( &wi,       max(1,N) ));
+            TESTING_CHECK( magma_dmalloc_cpu( &hwork,    lwork    ));
+            TESTING_CHECK( magma_dmalloc_cpu( &VLmagma,  n2       ));
+            TESTING_CHECK( magma_dmalloc_cpu( &VRmagma,  n2       ));
+            TESTING_CHECK( magma_dmalloc_cpu( &VLlapack, n2       ));
+            TESTING_CHECK( magma_dmalloc_cpu( &VRlapack, n2       ));
+
+            /* Initialize the matrix and reduce it to Schur form, A = Q T Q^T */
+            magma_generate_matrix( opts, N, N, nullptr, hA, lda );
+            lapackf77_dlacpy( MagmaFullStr, &N, &N, hA, &lda, hT, &lda );
+            lapackf77_dgehrd( &N, &ione, &N, hT, &lda, tau, hwork, &lwork_lapack, &info );
+            lapackf77_dlacpy( MagmaLowerStr, &N, &N, hT, &lda, hQ, &lda );
+            lapackf77_dorghr( &N, &ione, &N, hQ, &lda, tau, hwork, &lwork_lapack, &info );
+            lapackf77_dhseqr( "S", "V", &N, &ione, &N, hT, &lda, wr, wi,
+                              hQ, &lda, hwork, &lwork_lapack, &info );
+            if (info != 0) {
+                printf("lapackf77_dhseqr returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            magma_int_t pairs = 0;
+            for (magma_int_t j = 0; j < N; ++j) {
+                pairs += (wi[j] > 0);
+            }
+
+            magma_int_t nnb = (opts.nb > 0 ? 1 : 5);
+            for( magma_int_t inb = 0; inb < nnb; ++inb ) {
+                nb = (opts.nb > 0 ? opts.nb : nb_list[inb]);
+                magma_int_t lwork_magma = max( 3*N, N + 2*N*nb );
+
+                vl_error = 0;
+                vr_error = 0;
+                magma_time = 0;
+                cpu_time = 0;
+                for (int h = 0; h < 2; ++h) {
+                    magma_vec_t howmany = (h == 0 ? MagmaBacktransVec : MagmaAllVec);
+                    if (howmany == MagmaBacktransVec) {
+                        lapackf77_dlacpy( MagmaFullStr, &N, &N, hQ, &lda, VLmagma,  &lda );
+                        lapackf77_dlacpy( MagmaFullStr, &N, &N, hQ, &lda, VRmagma,  &lda );
+                        lapackf77_dlacpy( MagmaFullStr, &N, &N, hQ, &lda, VLlapack, &lda );
+                        lapackf77_dlacpy( MagmaFullStr, &N, &N, hQ, &lda, VRlapack, &lda );
+                    }
+
+                    /* =====================================================================
+                       Performs operation using MAGMA
+                       =================================================================== */
+                    real_Double_t time = magma_wtime();
+                    magma_dtrevc3_mt( MagmaBothSides, howmany, NULL, N,
+                                      hT, lda, VLmagma, lda, VRmagma, lda,
+                                      N, &mout, hwork, lwork_magma, &info );
+                    time = magma_wtime() - time;
+                    if (howmany == MagmaBacktransVec) {
+                        magma_time = time;
+                    }
+                    if (info != 0) {
+                        printf("magma_dtrevc3_mt returned error %lld: %s.\n",
+                               (long long) info, magma_strerror( info ));
+                    }
+
+                    /* =====================================================================
+                       Performs operation using LAPACK
+                       =================================================================== */
+                    time = magma_wtime();
+                    lapackf77_dtrevc3( "B", (h == 0 ? "B" : "A"), NULL, &N,
+                                       hT, &lda, VLlapack, &lda, VRlapack, &lda,
+                                       &N, &mout, hwork, &lwork_lapack, &info );
+                    time = magma_wtime() - time;
+                    if (howmany == MagmaBacktransVec) {
+                        cpu_time = time;
+                    }
+                    if (info != 0) {
+                        printf("lapackf77_dtrevc3 returned error %lld: %s.\n",
+                               (long long) info, magma_strerror( info ));
+                    }
+
+                    /* =====================================================================
+                       Check the result
+                       =================================================================== */
+                    error = diff_norm( N, VLmagma, VLlapack, lda );
+                    vl_error = max( vl_error, error );
+                    error = diff_norm( N, VRmagma, VRlapack, lda );
+                    vr_error = max( vr_error, error );
+                }
+
+                bool okay = (vl_error < tol && vr_error < tol);
+                status += ! okay;
+                printf("%5lld %5lld  %5lld   %9.4f          %9.4f        %8.2e   %8.2e   %s\n",
+                       (long long) N, (long long) nb, (long long) pairs,
+                       magma_time, cpu_time, vl_error, vr_error,
+                       (okay ? "ok" : "failed"));
+            }
+
+            magma_free_cpu( hA );
+            magma_free_cpu( hT );
+            magma_free_cpu( hQ );
+            magma_free_cpu( tau );
+            magma_free_cpu( wr );
+            magma_free_cpu( wi );
+            magma_free_cpu( hwork );
+            magma_free_cpu( VLmagma );
+            magma_free_cpu( VRmagma );
+            magma_free_cpu( VLlapack );
+            magma_free_cpu( VRlapack );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
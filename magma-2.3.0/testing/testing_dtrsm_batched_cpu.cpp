@@ -0,0 +1,209 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_ztrsm_batched_cpu.cpp, normal z -> d, Wed Nov 15 00:34:24 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+#include "../control/magma_threadsetting.h"  // internal header
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing dtrsm_batched_cpu and dtrsm_vbatched_cpu
+      --version 1: fixed size, B is M-by-N.
+      --version 2: variable size, B_i is M_i-by-N_i with M_i in [1, M], N_i in [1, N].
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gflops, magma_perf, magma_time, cpu_perf, cpu_time;
+    double *h_A, *h_B, *h_X;
+    double **A_array = NULL, **B_array = NULL;
+    magma_int_t *m_array, *n_array, *lda_array, *ldb_array;
+    magma_int_t M, N, Ak, sizeA, sizeB, lda, ldb, batchCount;
+    double c_neg_one = MAGMA_D_NEG_ONE;
+    double alpha = MAGMA_D_MAKE(  0.29, -0.86 );
+    magma_int_t ione     = 1;
+    magma_int_t ISEED[4] = {0,0,0,1};
+    double      work[1], error;
+    int status = 0;
+
+    magma_opts opts( MagmaOptsBatched );
+    opts.parse_opts( argc, argv );
+    opts.lapack |= opts.check;  // check (-c) implies lapack (-l)
+    batchCount = opts.batchcount;
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+
+    printf("%% side = %s, uplo = %s, transA = %s, diag = %s, %s\n",
+           lapack_side_const(opts.side), lapack_uplo_const(opts.uplo),
+           lapack_trans_const(opts.transA), lapack_diag_const(opts.diag),
+           (opts.version == 1 ? "fixed size" : "variable size M_i in [1, M], N_i in [1, N]"));
+    printf("%% BatchCount   M     N    CPU Gflop/s (ms)   MAGMA Gflop/s (ms)   ||X_magma - X_blas||_F / ||X_blas||_F\n");
+    printf("%%=====================================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M   = opts.msize[itest];
+            N   = opts.nsize[itest];
+            Ak  = (opts.side == MagmaLeft ? M : N);
+            lda = Ak;
+            ldb = M;
+            sizeA = lda * Ak * batchCount;
+            sizeB = ldb * N  * batchCount;
+
+            TESTING_CHECK( magma_dmalloc_cpu( &h_A, sizeA ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_B, sizeB ));
+            TESTING_CHECK( magma_dmalloc_cpu( &h_X, sizeB ));
+            TESTING_CHECK( magma_imalloc_cpu( &m_array,   batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &n_array,   batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &lda_array, batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &ldb_array, batchCount ));
+            TESTING_CHECK( magma_malloc_cpu( (void**) &A_array, batchCount * sizeof(double*) ));
+            TESTING_CHECK( magma_malloc_cpu( (void**) &B_array, batchCount * sizeof(double*) ));
+
+            // guarantee reproducible sizes
+            srand(1000);
+            gflops = 0;
+            for (int s = 0; s < batchCount; ++s) {
+                m_array[s]   = (opts.version == 1 ? M : 1 + (rand() % M));
+                n_array[s]   = (opts.version == 1 ? N : 1 + (rand() % N));
+                lda_array[s] = lda;
+                ldb_array[s] = ldb;
+                A_array[s]   = h_A + s * lda * Ak;
+                B_array[s]   = h_X + s * ldb * N;
+                gflops += FLOPS_DTRSM( opts.side, m_array[s], n_array[s] ) / 1e9;
+            }
+
+            /* Initialize the matrices;
+               scale the off-diagonal of A so the triangular systems are well
+               conditioned, with or without the unit diagonal */
+            lapackf77_dlarnv( &ione, ISEED, &sizeA, h_A );
+            lapackf77_dlarnv( &ione, ISEED, &sizeB, h_B );
+            double scale = 1. / max( 1, Ak );
+            for (int s = 0; s < batchCount; ++s) {
+                double *A = h_A + s * lda * Ak;
+                for (magma_int_t j = 0; j < Ak; ++j) {
+                    for (magma_int_t i = 0; i < Ak; ++i) {
+                        A[i + j*lda] = (i == j
+                                        ? MAGMA_D_ADD( A[i + j*lda], MAGMA_D_ONE )
+                                        : MAGMA_D_MAKE( MAGMA_D_REAL( A[i + j*lda] ) * scale,
+                                                       MAGMA_D_IMAG( A[i + j*lda] ) * scale ));
+                    }
+                }
+            }
+            magma_int_t columns = N * batchCount;
+            lapackf77_dlacpy( MagmaFullStr, &M, &columns, h_B, &ldb, h_X, &ldb );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            magma_time = magma_wtime();
+            if (opts.version == 1) {
+                magma_dtrsm_batched_cpu( opts.side, opts.uplo, opts.transA, opts.diag,
+                                         M, N, alpha, A_array, lda, B_array, ldb, batchCount );
+            }
+            else {
+                magma_dtrsm_vbatched_cpu( opts.side, opts.uplo, opts.transA, opts.diag,
+                                          m_array, n_array, alpha, A_array, lda_array,
+                                          B_array, ldb_array, batchCount );
+            }
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+
+            /* =====================================================================
+               Performs operation using BLAS
+               =================================================================== */
+            if ( opts.lapack ) {
+                cpu_time = magma_wtime();
+                #if defined(_OPENMP)
+                magma_int_t nthreads = magma_get_lapack_numthreads();
+                magma_set_lapack_numthreads(1);
+                magma_set_omp_numthreads(nthreads);
+                #pragma omp parallel for schedule(dynamic)
+                #endif
+                for (magma_int_t s=0; s < batchCount; s++) {
+                    blasf77_dtrsm( lapack_side_const(opts.side), lapack_uplo_const(opts.uplo),
+                                   lapack_trans_const(opts.transA), lapack_diag_const(opts.diag),
+                                   &m_array[s], &n_array[s], &alpha,
+                                   h_A + s * lda * Ak, &lda,
+                                   h_B + s * ldb * N,  &ldb );
+                }
+                #if defined(_OPENMP)
+                magma_set_lapack_numthreads(nthreads);
+                #endif
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+
+                /* =====================================================================
+                   Check the result compared to BLAS
+                   =================================================================== */
+                error = 0;
+                for (int s = 0; s < batchCount; ++s) {
+                    magma_int_t Ms = m_array[s];
+                    magma_int_t Ns = n_array[s];
+                    double *B = h_B + s * ldb * N;
+                    double *X = h_X + s * ldb * N;
+                    double Bnorm, err;
+                    for (magma_int_t j = 0; j < Ns; ++j) {
+                        blasf77_daxpy( &Ms, &c_neg_one, B + j*ldb, &ione, X + j*ldb, &ione );
+                    }
+                    Bnorm = lapackf77_dlange( "f", &Ms, &Ns, B, &ldb, work );
+                    err   = lapackf77_dlange( "f", &Ms, &Ns, X, &ldb, work )
+                          / Bnorm;
+                    if ( isnan(err) || isinf(err) ) {
+                        error = err;
+                        break;
+                    }
+                    error = max( err, error );
+                }
+                bool okay = (error < tol);
+                status += ! okay;
+
+                printf("%10lld %5lld %5lld   %7.2f (%7.2f)    %7.2f (%7.2f)     %8.2e   %s\n",
+                       (long long) batchCount, (long long) M, (long long) N,
+                       cpu_perf, cpu_time*1000.,
+                       magma_perf, magma_time*1000., error, (okay ? "ok" : "failed"));
+            }
+            else {
+                printf("%10lld %5lld %5lld     ---   (  ---  )    %7.2f (%7.2f)       ---\n",
+                       (long long) batchCount, (long long) M, (long long) N,
+                       magma_perf, magma_time*1000. );
+            }
+
+            magma_free_cpu( h_A );
+            magma_free_cpu( h_B );
+            magma_free_cpu( h_X );
+            magma_free_cpu( m_array );
+            magma_free_cpu( n_array );
+            magma_free_cpu( lda_array );
+            magma_free_cpu( ldb_array );
+            magma_free_cpu( A_array );
+            magma_free_cpu( B_array );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
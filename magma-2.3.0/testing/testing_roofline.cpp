@@ -0,0 +1,300 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+// Tests the roofline instrumentation of control/roofline.cpp, compiled here
+// with ROOFLINE defined, whether or not the library was. Its functions are
+// renamed so they don't clash with the library's when it was built with
+// -DROOFLINE. Internal, after the STL headers since magma_internal.h
+// defines min, max; needs -I control.
+#ifndef ROOFLINE
+#define ROOFLINE
+#endif
+#define roofline_start_ test_roofline_start_
+#define roofline_end    test_roofline_end
+#define roofline_report test_roofline_report
+#include "roofline.cpp"
+
+
+/******************************************************************************/
+// warn( condition ) is like assert, but doesn't abort. Also counts number of failures.
+magma_int_t gFailures = 0;
+
+void warn_helper( int cond, const char* str, const char* file, int line )
+{
+    if ( ! cond ) {
+        printf( "*** testing_roofline error: %s:%d: assertion %s failed\n", file, line, str );
+        gFailures += 1;
+    }
+}
+
+#define warn(x) warn_helper( (x), #x, __FILE__, __LINE__ )
+
+
+/******************************************************************************/
+// Returns the site of routine, or NULL if it was never tagged.
+const roofline_site* find_site( const char* routine, const char* site )
+{
+    std::map< std::pair< std::string, std::string >, roofline_site >::const_iterator it;
+    it = glog.sites.find( std::make_pair( std::string( routine ), std::string( site )));
+    return (it == glog.sites.end() ? NULL : &it->second);
+}
+
+
+/******************************************************************************/
+// Tags calls the way a driver does: a host gemm, twice; a device gemm; and
+// a transfer. Routine is then this function's name.
+void tagged_calls( magma_int_t n, magma_queue_t queue )
+{
+    const double c_one = MAGMA_D_ONE, c_zero = MAGMA_D_ZERO;
+    magma_int_t ione = 1, ISEED[4] = { 0, 0, 0, 1 };
+    magma_int_t size = n*n;
+    double *hA, *hC;
+    magmaDouble_ptr dA, dC;
+    TESTING_CHECK( magma_dmalloc_cpu( &hA, size ));
+    TESTING_CHECK( magma_dmalloc_cpu( &hC, size ));
+    TESTING_CHECK( magma_dmalloc( &dA, size ));
+    TESTING_CHECK( magma_dmalloc( &dC, size ));
+    lapackf77_dlarnv( &ione, ISEED, &size, hA );
+
+    for( int i = 0; i < 2; ++i ) {
+        roofline_start( "host gemm", FLOPS_DGEMM( n, n, n ),
+                        sizeof(double) * roofline_gemm_elems( n, n, n ), NULL );
+        blasf77_dgemm( "N", "N", &n, &n, &n, &c_one, hA, &n, hA, &n, &c_zero, hC, &n );
+        roofline_end();
+    }
+
+    roofline_copy_start( "setmatrix", sizeof(double) * n*n, queue );
+    magma_dsetmatrix( n, n, hA, n, dA, n, queue );
+    roofline_end();
+
+    roofline_start( "device gemm", FLOPS_DGEMM( n, n, n ),
+                    sizeof(double) * roofline_gemm_elems( n, n, n ), queue );
+    magma_dgemm( MagmaNoTrans, MagmaNoTrans, n, n, n,
+                 c_one, dA, n, dA, n, c_zero, dC, n, queue );
+    roofline_end();
+
+    magma_free_cpu( hA );
+    magma_free_cpu( hC );
+    magma_free( dA );
+    magma_free( dC );
+}
+
+
+/******************************************************************************/
+void test_counts( magma_queue_t queue )
+{
+    printf( "%%=====================================================================\n%s\n", __func__ );
+
+    const magma_int_t n = 256;
+    tagged_calls( n, queue );
+    warn( glog.stack.empty() );
+    warn( glog.sites.size() == 3 );
+
+    const roofline_site* s = find_site( "tagged_calls", "host gemm" );
+    warn( s != NULL );
+    if ( s != NULL ) {
+        printf( "host gemm    calls %ld, Gflop %.4f, GB %.4f, time %.2e\n",
+                s->calls, s->flops / 1e9, s->bytes / 1e9, s->time );
+        warn( s->unit  == HOST );
+        warn( s->calls == 2 );
+        warn( s->flops == 2*FLOPS_DGEMM( n, n, n ));
+        warn( s->bytes == 2*sizeof(double)*4.*n*n );
+        warn( s->time  >  0 );
+    }
+
+    s = find_site( "tagged_calls", "device gemm" );
+    warn( s != NULL );
+    if ( s != NULL ) {
+        printf( "device gemm  calls %ld, Gflop %.4f, GB %.4f, time %.2e\n",
+                s->calls, s->flops / 1e9, s->bytes / 1e9, s->time );
+        warn( s->unit  == DEVICE );
+        warn( s->calls == 1 );
+        warn( s->flops == FLOPS_DGEMM( n, n, n ));
+        warn( s->time  >  0 );
+    }
+
+    s = find_site( "tagged_calls", "setmatrix" );
+    warn( s != NULL );
+    if ( s != NULL ) {
+        printf( "setmatrix    calls %ld, Gflop %.4f, GB %.4f, time %.2e\n",
+                s->calls, s->flops / 1e9, s->bytes / 1e9, s->time );
+        warn( s->unit  == LINK );
+        warn( s->calls == 1 );
+        warn( s->flops == 0 );
+        warn( s->bytes == sizeof(double)*n*n );
+    }
+
+    // unmatched end is reported, not counted
+    printf( "expect an error for the unmatched roofline_end:\n" );
+    roofline_end();
+    warn( glog.sites.size() == 3 );
+    printf( "\n" );
+}
+
+
+/******************************************************************************/
+void test_fraction()
+{
+    printf( "%%=====================================================================\n%s\n", __func__ );
+
+    // host: 100 Gflop/s, 10 GB/s, so ridge at 10 flop/B; link: 10 GB/s
+    roofline_peak peak;
+    peak.gflops[HOST] = 100;  peak.gbytes[HOST] = 10;
+    peak.gflops[DEVICE] = 0;  peak.gbytes[DEVICE] = 0;
+    peak.gflops[LINK] = 0;    peak.gbytes[LINK] = 10;
+
+    struct {
+        int unit;
+        double flops, bytes, time;
+        double fraction;
+        const char* bound;
+    } tests[] = {
+        // 1 flop/B, 1 Gflop/s, of attainable 10 Gflop/s
+        { HOST,  1e9,  1e9, 1.0, 0.1,  "memory"  },
+        // 100 flop/B, 50 Gflop/s, of peak 100 Gflop/s
+        { HOST,  1e11, 1e9, 2.0, 0.5,  "compute" },
+        // data movement, 5 GB/s of 10 GB/s
+        { HOST,  0,    5e9, 1.0, 0.5,  "memory"  },
+        // transfer, 5 GB/s of 10 GB/s
+        { LINK,  0,    5e9, 1.0, 0.5,  "link"    },
+        // 200 Gflop/s, above the peak; not clamped here
+        { HOST,  2e11, 1e9, 1.0, 2.0,  "compute" },
+        // no peak measured for the unit
+        { DEVICE, 1e9, 1e9, 1.0, 0.0,  "compute" },
+    };
+
+    printf( "unit     Gflop        GB    time   fraction (expect)   bound\n" );
+    printf( "%%===========================================================\n" );
+    for( size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); ++i ) {
+        roofline_site s;
+        s.unit  = tests[i].unit;
+        s.calls = 1;
+        s.flops = tests[i].flops;
+        s.bytes = tests[i].bytes;
+        s.time  = tests[i].time;
+        const char* bound = NULL;
+        double fraction = roofline_fraction( s, peak, &bound );
+        printf( "%-6s %7.1f %9.1f %7.1f   %8.3f (%6.3f)   %s\n",
+                unit_names[s.unit], s.flops / 1e9, s.bytes / 1e9, s.time,
+                fraction, tests[i].fraction, bound );
+        warn( fabs( fraction - tests[i].fraction ) < 1e-12 );
+        warn( bound != NULL && strcmp( bound, tests[i].bound ) == 0 );
+    }
+    printf( "\n" );
+}
+
+
+/******************************************************************************/
+// Reports the counts of test_counts, plus a site faster than any peak,
+// to a file, then checks that %roof is clamped to 100% and flagged, and
+// that the counts were cleared.
+void test_report()
+{
+    printf( "%%=====================================================================\n%s\n", __func__ );
+
+#ifndef _MSC_VER // not Windows
+
+    roofline_site& fast = glog.sites[ std::make_pair( std::string( "test_report" ),
+                                                      std::string( "in cache" )) ];
+    fast.unit  = HOST;
+    fast.calls = 1;
+    fast.flops = 1e15;
+    fast.bytes = 1e12;
+    fast.time  = 1e-3;
+
+    char filename[] = "testing_roofline.txt";
+    setenv( "MAGMA_ROOFLINE", filename, 1 );
+    roofline_report();
+    unsetenv( "MAGMA_ROOFLINE" );
+    warn( glog.sites.empty() );
+
+    FILE* file = fopen( filename, "r" );
+    warn( file != NULL );
+    if ( file != NULL ) {
+        char line[ 1024 ];
+        int rows = 0, flagged = 0, footnote = 0;
+        while ( fgets( line, sizeof(line), file ) != NULL ) {
+            printf( "%s", line );
+            if ( line[0] == '%' ) {
+                footnote += (strstr( line, "clamped to 100%" ) != NULL);
+                continue;
+            }
+            // last field of a site's row is its %roof
+            const char* pct = strrchr( line, ' ' );
+            if ( pct == NULL || strchr( line, '%' ) == NULL ) {
+                continue;
+            }
+            rows += 1;
+            double roof = atof( pct );
+            warn( 0 <= roof && roof <= 100 );
+            if ( strstr( line, "in cache" ) != NULL ) {
+                warn( strstr( line, "100.0%*" ) != NULL );
+            }
+            flagged += (strchr( line, '*' ) != NULL);
+        }
+        fclose( file );
+        remove( filename );
+        warn( rows == 4 );
+        warn( flagged >= 1 );
+        warn( footnote == 1 );
+    }
+
+    // nothing left to report, so no file
+    setenv( "MAGMA_ROOFLINE", filename, 1 );
+    roofline_report();
+    unsetenv( "MAGMA_ROOFLINE" );
+    file = fopen( filename, "r" );
+    warn( file == NULL );
+    if ( file != NULL ) {
+        fclose( file );
+        remove( filename );
+    }
+
+#endif // not Windows
+    printf( "\n" );
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing roofline instrumentation
+*/
+int main( int argc, char** argv )
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    magma_queue_t queue;
+    magma_queue_create( 0, &queue );
+
+    test_counts( queue );
+    test_fraction();
+    test_report();
+
+    magma_queue_destroy( queue );
+
+    if ( gFailures > 0 ) {
+        printf( "\n%lld tests failed\n", (long long) gFailures );
+    }
+    else {
+        printf( "\nall tests passed\n" );
+    }
+
+    TESTING_CHECK( magma_finalize() );
+    return gFailures;
+}
@@ -94,11 +94,16 @@ int main( int argc, char** argv)
                     magma_sgehrd_m( N, ione, N, h_R, lda, tau, h_work, lwork, T, &info );
                 }
             }
-            else {
+            else if ( opts.version == 2 ) {
                 // LAPACK-complaint arguments, no dT array
                 printf( "magma_sgehrd2\n" );
                 magma_sgehrd2( N, ione, N, h_R, lda, tau, h_work, lwork, &info );
             }
+            else {
+                // host only, no dT array
+                printf( "magma_sgehrd_cpu\n" );
+                magma_sgehrd_cpu( N, ione, N, h_R, lda, tau, h_work, lwork, &info );
+            }
             gpu_time = magma_wtime() - gpu_time;
             gpu_perf = gflops / gpu_time;
             if (info != 0) {
@@ -129,7 +134,7 @@ int main( int argc, char** argv)
                     magma_sorghr( N, ione, N, h_Q, lda, tau, dT, nb, &info );
                 }
                 else {
-                    // for magma_sgehrd2, no dT array
+                    // for magma_sgehrd2 and magma_sgehrd_cpu, no dT array
                     lapackf77_sorghr( &N, &ione, &N, h_Q, &lda, tau, h_work, &lwork, &info );
                 }
                 if (info != 0) {
@@ -0,0 +1,217 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zgemm_host_tune.cpp, normal z -> s, Wed Nov 15 00:34:24 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+// internal header, after the STL headers since magma_internal.h defines min, max;
+// needs -I control -I magmablas_host
+#include "gemm_template_host.hpp"
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Tuning harness for the host GEMM template (magmablas_host).
+      Times every version in gemm_config_host.hpp, including version 0,
+      the host BLAS, on representative shapes of each shape class,
+      checks each against BLAS, and prints the fastest version per class,
+      to update gemm_host_tuned in gemm_config_host.hpp.
+      The small class is timed as a batch of --batch matrices;
+      the others one matrix at a time, best of --niter runs.
+      Versions 1-8 are single threaded, while version 0 uses all the
+      threads of the host BLAS, so tune with the thread count of the
+      target runs.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    // representative shapes, m, n, k, by class; a one-small-dimension
+    // class only takes a large operand that fits in gemm_host_l2_bytes,
+    // so tall-skinny products beyond that are timed with the general class
+    const magma_int_t shapes[][3] = {
+        {  512,  512,  512 },  // general
+        { 1024,  256,  768 },
+        { 4096,    8, 4096 },  // general: tall-skinny, beyond L2
+        { 8192,    8, 1024 },
+        {    8,    8,    8 },  // small (batched)
+        {   16,   16,   16 },
+        {   24,   24,   24 },
+        {   32,   32,   32 },
+        {    2,  256,  256 },  // small m: checksum rows e^T A
+        {    4,  128,  512 },
+        {  256,    2,  256 },  // small n: checksum columns A e, panels
+        {  512,    8,  128 },
+        {  256,  256,    2 },  // small k: rank-2 updates
+        {  128,  512,    8 },
+    };
+    const int nshapes = sizeof(shapes) / sizeof(shapes[0]);
+    const int nv = gemm_host_nversions;
+    const char* class_name[ gemm_host_nshapes ] = { "general", "small", "small m", "small n", "small k" };
+
+    real_Double_t class_time[ gemm_host_nshapes ][ gemm_host_nversions ];
+    memset( class_time, 0, sizeof(class_time) );
+
+    float *hA, *hB, *hC, *hCref;
+    float **A_array, **B_array, **C_array;
+    float c_neg_one = MAGMA_S_NEG_ONE;
+    float alpha = MAGMA_S_MAKE(  0.29, -0.86 );
+    float beta  = MAGMA_S_MAKE( -0.48,  0.38 );
+    magma_int_t ione     = 1;
+    magma_int_t ISEED[4] = {0,0,0,1};
+    float work[1];
+    int status = 0;
+
+    magma_opts opts( MagmaOptsBatched );
+    opts.parse_opts( argc, argv );
+    float tol = opts.tolerance * lapackf77_slamch("E");
+
+    printf("%% transA = %s, transB = %s, host BLAS threads %lld\n",
+           lapack_trans_const(opts.transA), lapack_trans_const(opts.transB),
+           (long long) magma_get_lapack_numthreads() );
+    printf("%%     M     N     K  class     batch  ");
+    for (int v = 0; v < nv; ++v) {
+        printf("   v%d", v);
+    }
+    printf("   Gflop/s; best, max error\n");
+    printf("%%=======================================================================================================\n");
+    for (int ishape = 0; ishape < nshapes; ++ishape) {
+        magma_int_t M = shapes[ishape][0];
+        magma_int_t N = shapes[ishape][1];
+        magma_int_t K = shapes[ishape][2];
+        gemm_host_shape_t shape = gemm_host_shape< float >( M, N, K );
+        magma_int_t batch = (shape == gemm_host_small ? opts.batchcount : 1);
+
+        magma_int_t Am  = (opts.transA == MagmaNoTrans ? M : K);
+        magma_int_t An  = (opts.transA == MagmaNoTrans ? K : M);
+        magma_int_t Bm  = (opts.transB == MagmaNoTrans ? K : N);
+        magma_int_t Bn  = (opts.transB == MagmaNoTrans ? N : K);
+        magma_int_t lda = Am, ldb = Bm, ldc = M;
+        magma_int_t sizeA = lda*An*batch;
+        magma_int_t sizeB = ldb*Bn*batch;
+        magma_int_t sizeC = ldc*N*batch;
+        real_Double_t gflops = FLOPS_SGEMM( M, N, K ) / 1e9 * batch;
+
+        TESTING_CHECK( magma_smalloc_cpu( &hA,    sizeA ));
+        TESTING_CHECK( magma_smalloc_cpu( &hB,    sizeB ));
+        TESTING_CHECK( magma_smalloc_cpu( &hC,    sizeC ));
+        TESTING_CHECK( magma_smalloc_cpu( &hCref, sizeC ));
+        TESTING_CHECK( magma_malloc_cpu( (void**) &A_array, batch * sizeof(float*) ));
+        TESTING_CHECK( magma_malloc_cpu( (void**) &B_array, batch * sizeof(float*) ));
+        TESTING_CHECK( magma_malloc_cpu( (void**) &C_array, batch * sizeof(float*) ));
+        for (magma_int_t s = 0; s < batch; ++s) {
+            A_array[s] = hA + s*lda*An;
+            B_array[s] = hB + s*ldb*Bn;
+            C_array[s] = hC + s*ldc*N;
+        }
+        lapackf77_slarnv( &ione, ISEED, &sizeA, hA );
+        lapackf77_slarnv( &ione, ISEED, &sizeB, hB );
+        lapackf77_slarnv( &ione, ISEED, &sizeC, hCref );
+
+        printf( "%7lld %5lld %5lld  %-8s %6lld  ",
+                (long long) M, (long long) N, (long long) K,
+                class_name[ shape ], (long long) batch );
+
+        int best = 0;
+        real_Double_t best_time = 0;
+        float error = 0;
+        float *Cref = NULL;
+        for (int v = 0; v < nv; ++v) {
+            real_Double_t time = 0;
+            for (int iter = 0; iter < opts.niter; ++iter) {
+                blasf77_scopy( &sizeC, hCref, &ione, hC, &ione );
+                real_Double_t t = magma_wtime();
+                if (batch > 1) {
+                    gemm_host_run_batched( v, opts.transA, opts.transB,
+                                           M, NULL, N, NULL, K, NULL,
+                                           alpha, A_array, lda, NULL,
+                                                  B_array, ldb, NULL,
+                                           beta,  C_array, ldc, NULL, batch );
+                }
+                else {
+                    gemm_host_run( v, opts.transA, opts.transB, M, N, K,
+                                   alpha, hA, lda, hB, ldb, beta, hC, ldc );
+                }
+                t = magma_wtime() - t;
+                time = (iter == 0 ? t : min( time, t ));
+            }
+            class_time[ shape ][ v ] += time;
+            printf( " %5.1f", gflops / time );
+            if (v == 0 || time < best_time) {
+                best = v;
+                best_time = time;
+            }
+
+            if (v == 0) {
+                // keep the BLAS result as the reference
+                TESTING_CHECK( magma_smalloc_cpu( &Cref, sizeC ));
+                blasf77_scopy( &sizeC, hC, &ione, Cref, &ione );
+            }
+            else if (opts.check) {
+                // error = ||C_v - C_blas|| / (sqrt(K) ||C_blas||), over the batch
+                for (magma_int_t s = 0; s < batch; ++s) {
+                    float *C  = hC   + s*ldc*N;
+                    float *C0 = Cref + s*ldc*N;
+                    float Cnorm = lapackf77_slange( "F", &M, &N, C0, &ldc, work );
+                    for (magma_int_t j = 0; j < N; ++j) {
+                        blasf77_saxpy( &M, &c_neg_one, C0 + j*ldc, &ione, C + j*ldc, &ione );
+                    }
+                    float err = lapackf77_slange( "F", &M, &N, C, &ldc, work )
+                               / (sqrt(float(K+2)) * Cnorm);
+                    if (isnan(err) || isinf(err) || err > error) {
+                        error = err;
+                    }
+                }
+            }
+        }
+        bool okay = (error < tol);
+        status += ! okay;
+        if (opts.check) {
+            printf( "   v%d  %8.2e   %s\n", best, error, (okay ? "ok" : "failed") );
+        }
+        else {
+            printf( "   v%d     ---\n", best );
+        }
+
+        magma_free_cpu( hA );
+        magma_free_cpu( hB );
+        magma_free_cpu( hC );
+        magma_free_cpu( hCref );
+        magma_free_cpu( Cref );
+        magma_free_cpu( A_array );
+        magma_free_cpu( B_array );
+        magma_free_cpu( C_array );
+        fflush( stdout );
+    }
+
+    // fastest version per class, by total time over the class's shapes;
+    // general stays version 0, the only multithreaded one
+    printf( "\n%% gemm_host_tuned< float >: general, small, small m, small n, small k\n" );
+    printf( "%% { " );
+    for (int c = 0; c < gemm_host_nshapes; ++c) {
+        int best = 0;
+        for (int v = 1; v < nv && c != gemm_host_general; ++v) {
+            if (class_time[c][v] < class_time[c][best])
+                best = v;
+        }
+        printf( "%d%s", best, (c < gemm_host_nshapes-1 ? ", " : " }\n") );
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
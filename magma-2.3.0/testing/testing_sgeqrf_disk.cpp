@@ -0,0 +1,202 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zgeqrf_disk.cpp, normal z -> s, Sat Oct 17 06:08:49 2026
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing sgeqrf_disk
+   The matrix is written to a temporary file, factored, and read back.
+   --nb sets the panel width; by default, the minimum workspace is used.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    const float             d_neg_one = MAGMA_S_NEG_ONE;
+    const float             d_one     = MAGMA_S_ONE;
+    const float c_neg_one = MAGMA_S_NEG_ONE;
+    const float c_one     = MAGMA_S_ONE;
+    const float c_zero    = MAGMA_S_ZERO;
+    
+    real_Double_t    gflops, gpu_perf, gpu_time, cpu_perf=0, cpu_time=0;
+    float           Anorm, error=0, error2=0;
+    float *h_A, *h_R, *tau, *h_work, *d_work, tmp[1], unused[1];
+    magma_int_t M, N, n2, lda, lwork, ldwork, info, min_mn, nb;
+    
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    int status = 0;
+    float tol = opts.tolerance * lapackf77_slamch("E");
+    
+    printf("%%   M     N   CPU Gflop/s (sec)  Disk Gflop/s (sec)   |R - Q^H*A|   |I - Q^H*Q|\n");
+    printf("%%==============================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M = opts.msize[itest];
+            N = opts.nsize[itest];
+            min_mn = min(M, N);
+            lda    = M;
+            n2     = lda*N;
+            nb     = magma_get_zgeqrf_nb( M, N );
+            gflops = FLOPS_SGEQRF( M, N ) / 1e9;
+            
+            // query for workspace size
+            lwork = -1;
+            lapackf77_sgeqrf( &M, &N, unused, &M, unused, tmp, &lwork, &info );
+            lwork = (magma_int_t)MAGMA_S_REAL( tmp[0] );
+            lwork = max( lwork, N*nb );
+            
+            ldwork = -1;
+            magma_sgeqrf_disk( M, N, 0, 0, lda, unused, tmp, ldwork, &info );
+            ldwork = (magma_int_t)MAGMA_S_REAL( tmp[0] );
+            if ( opts.nb > 0 ) {
+                ldwork = max( ldwork, (4*M + 2*opts.nb)*opts.nb );
+            }
+            
+            // Allocate host memory for the matrix
+            TESTING_CHECK( magma_smalloc_cpu( &tau,    min_mn ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_A,    n2     ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_work, lwork  ));
+            TESTING_CHECK( magma_smalloc_cpu( &d_work, ldwork ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_R,    n2     ));
+            
+            /* Initialize the matrix, and write it to a file */
+            magma_generate_matrix( opts, M, N, nullptr, h_A, lda );
+            FILE* file = tmpfile();
+            if ( file == NULL ) {
+                printf( "cannot create temporary file\n" );
+                status += 1;
+                break;
+            }
+            fwrite( h_A, sizeof(float), n2, file );
+            fflush( file );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            gpu_time = magma_wtime();
+            magma_sgeqrf_disk( M, N, fileno( file ), 0, lda, tau, d_work, ldwork, &info );
+            gpu_time = magma_wtime() - gpu_time;
+            gpu_perf = gflops / gpu_time;
+            if (info != 0) {
+                printf("magma_sgeqrf_disk returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+            
+            rewind( file );
+            if ( fread( h_R, sizeof(float), n2, file ) != size_t(n2) ) {
+                printf( "cannot read temporary file\n" );
+            }
+            fclose( file );
+            
+            /* =====================================================================
+               Check the result, following zqrt01 except using the reduced Q.
+               This works for any M,N (square, tall, wide).
+               =================================================================== */
+            if ( opts.check ) {
+                magma_int_t ldq = M;
+                magma_int_t ldr = min_mn;
+                float *Q, *R;
+                float *work;
+                TESTING_CHECK( magma_smalloc_cpu( &Q,    ldq*min_mn ));  // M by K
+                TESTING_CHECK( magma_smalloc_cpu( &R,    ldr*N ));       // K by N
+                TESTING_CHECK( magma_smalloc_cpu( &work, min_mn ));
+                
+                // generate M by K matrix Q, where K = min(M,N)
+                lapackf77_slacpy( "Lower", &M, &min_mn, h_R, &lda, Q, &ldq );
+                lapackf77_sorgqr( &M, &min_mn, &min_mn, Q, &ldq, tau, h_work, &lwork, &info );
+                assert( info == 0 );
+                
+                // copy K by N matrix R
+                lapackf77_slaset( "Lower", &min_mn, &N, &c_zero, &c_zero, R, &ldr );
+                lapackf77_slacpy( "Upper", &min_mn, &N, h_R, &lda,        R, &ldr );
+                
+                // error = || R - Q^H*A || / (N * ||A||)
+                blasf77_sgemm( "Conj", "NoTrans", &min_mn, &N, &M,
+                               &c_neg_one, Q, &ldq, h_A, &lda, &c_one, R, &ldr );
+                Anorm = lapackf77_slange( "1", &M,      &N, h_A, &lda, work );
+                error = lapackf77_slange( "1", &min_mn, &N, R,   &ldr, work );
+                if ( N > 0 && Anorm > 0 )
+                    error /= (N*Anorm);
+                
+                // set R = I (K by K identity), then R = I - Q^H*Q
+                // error = || I - Q^H*Q || / N
+                lapackf77_slaset( "Upper", &min_mn, &min_mn, &c_zero, &c_one, R, &ldr );
+                blasf77_ssyrk( "Upper", "Conj", &min_mn, &M, &d_neg_one, Q, &ldq, &d_one, R, &ldr );
+                error2 = safe_lapackf77_slansy( "1", "Upper", &min_mn, R, &ldr, work );
+                if ( N > 0 )
+                    error2 /= N;
+                
+                magma_free_cpu( Q    );  Q    = NULL;
+                magma_free_cpu( R    );  R    = NULL;
+                magma_free_cpu( work );  work = NULL;
+            }
+            
+            /* =====================================================================
+               Performs operation using LAPACK
+               =================================================================== */
+            if ( opts.lapack ) {
+                cpu_time = magma_wtime();
+                lapackf77_sgeqrf( &M, &N, h_A, &lda, tau, h_work, &lwork, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_sgeqrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+            }
+            
+            /* =====================================================================
+               Print performance and error.
+               =================================================================== */
+            printf("%5lld %5lld   ", (long long) M, (long long) N );
+            if ( opts.lapack ) {
+                printf( "%7.2f (%7.2f)", cpu_perf, cpu_time );
+            }
+            else {
+                printf("  ---   (  ---  )" );
+            }
+            printf( "   %7.2f (%7.2f)   ", gpu_perf, gpu_time );
+            if ( opts.check ) {
+                bool okay = (error < tol && error2 < tol);
+                status += ! okay;
+                printf( "%11.2e   %11.2e   %s\n", error, error2, (okay ? "ok" : "failed") );
+            }
+            else {
+                printf( "    ---\n" );
+            }
+            
+            magma_free_cpu( tau    );
+            magma_free_cpu( h_A    );
+            magma_free_cpu( h_work );
+            magma_free_cpu( d_work );
+            magma_free_cpu( h_R    );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
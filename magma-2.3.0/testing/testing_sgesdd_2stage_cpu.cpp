@@ -0,0 +1,163 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_dgesdd_2stage_cpu.cpp, normal d -> s, Wed Nov 15 00:34:24 2017
+*/
+// includes, system
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing dgesdd_2stage_cpu
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gpu_time, cpu_time;
+    float *hA, *hR, *U, *VT, *S, *Sref, *hwork, work[1], unused[1];
+    magma_int_t *iwork;
+    magma_int_t M, N, N_U, M_VT, lda, ldu, ldv, min_mn, info, lwork;
+    magma_int_t ione     = 1;
+    magma_int_t ineg_one = -1;
+    float d_neg_one = MAGMA_S_NEG_ONE;
+    float nan = MAGMA_S_NAN;
+    int status = 0;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    float tol = opts.tolerance * lapackf77_slamch("E");
+
+    printf( "%% jobz     M     N   CPU time (sec)   2-stage (sec)" );
+    printf( "   |S-Sref|   |A-USV^H|  |I-UU^H|/M  |I-VV^H|/N   S sorted\n" );
+    printf( "%%=====================================================================================================\n" );
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+      for( auto jobz = opts.jobu.begin(); jobz != opts.jobu.end(); ++jobz ) {
+        if ( *jobz == MagmaOverwriteVec ) {
+            printf( "%% skipping jobz = %c; not supported by magma_sgesdd_2stage_cpu\n",
+                    lapacke_vec_const(*jobz) );
+            continue;
+        }
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M = opts.msize[itest];
+            N = opts.nsize[itest];
+            min_mn = min(M, N);
+            N_U  = (*jobz == MagmaAllVec ? M : min_mn);
+            M_VT = (*jobz == MagmaAllVec ? N : min_mn);
+            lda = M;
+            ldu = M;
+            ldv = M_VT;
+
+            TESTING_CHECK( magma_smalloc_cpu( &hA,    lda*N   ));
+            TESTING_CHECK( magma_smalloc_cpu( &hR,    lda*N   ));
+            TESTING_CHECK( magma_smalloc_cpu( &U,     ldu*N_U ));
+            TESTING_CHECK( magma_smalloc_cpu( &VT,    ldv*N   ));
+            TESTING_CHECK( magma_smalloc_cpu( &S,     min_mn  ));
+            TESTING_CHECK( magma_smalloc_cpu( &Sref,  min_mn  ));
+            TESTING_CHECK( magma_imalloc_cpu( &iwork, 8*min_mn ));
+
+            // force check to fail if gesdd returns info error
+            float result[5] = { nan, nan, nan, nan, nan };
+
+            /* Initialize the matrix */
+            magma_generate_matrix( opts, M, N, Sref, hA, lda );
+            lapackf77_slacpy( MagmaFullStr, &M, &N, hA, &lda, hR, &lda );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            gpu_time = magma_wtime();
+            magma_sgesdd_2stage_cpu( *jobz, M, N, hR, lda, S, U, ldu, VT, ldv, &info );
+            gpu_time = magma_wtime() - gpu_time;
+            if (info != 0) {
+                printf( "magma_sgesdd_2stage_cpu returned error %lld: %s.\n",
+                        (long long) info, magma_strerror( info ));
+                status += 1;
+            }
+            else {
+                check_sgesvd( opts.check, *jobz, *jobz, M, N, hA, lda, S, U, ldu, VT, ldv, result );
+            }
+
+            if ( opts.lapack ) {
+                /* =====================================================================
+                   Performs operation using LAPACK, singular values only
+                   =================================================================== */
+                lapackf77_slacpy( MagmaFullStr, &M, &N, hA, &lda, hR, &lda );
+                lapackf77_sgesdd( "N", &M, &N, hR, &lda, Sref, unused, &ione, unused, &ione,
+                                  work, &ineg_one, iwork, &info );
+                lwork = magma_int_t( work[0] );
+                TESTING_CHECK( magma_smalloc_cpu( &hwork, lwork ));
+                cpu_time = magma_wtime();
+                lapackf77_sgesdd( "N", &M, &N, hR, &lda, Sref, unused, &ione, unused, &ione,
+                                  hwork, &lwork, iwork, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                if (info != 0) {
+                    printf( "lapackf77_sgesdd returned error %lld: %s.\n",
+                            (long long) info, magma_strerror( info ));
+                }
+                magma_free_cpu( hwork );
+
+                blasf77_saxpy( &min_mn, &d_neg_one, S, &ione, Sref, &ione );
+                result[4]  = lapackf77_slange( "f", &min_mn, &ione, Sref, &min_mn, work );
+                result[4] /= lapackf77_slange( "f", &min_mn, &ione, S,    &min_mn, work );
+                printf( "   %c   %5lld %5lld   %9.4f        %9.4f     ",
+                        lapacke_vec_const(*jobz),
+                        (long long) M, (long long) N,
+                        cpu_time, gpu_time );
+            }
+            else {
+                result[4] = -1;  // indicates S - Sref not checked
+                printf( "   %c   %5lld %5lld      ---           %9.4f     ",
+                        lapacke_vec_const(*jobz),
+                        (long long) M, (long long) N,
+                        gpu_time );
+            }
+
+            /* =====================================================================
+               Print error checks
+               =================================================================== */
+            if ( result[4] < 0. ) { printf(  "     ---   " ); } else { printf(  "   %8.2e", result[4]); }  // S - Sref
+            if ( result[0] < 0. ) { printf( "      ---   " ); } else { printf( "    %8.2e", result[0]); }  // A - USV'
+            if ( result[1] < 0. ) { printf( "      ---   " ); } else { printf( "    %8.2e", result[1]); }  // I - UU'
+            if ( result[2] < 0. ) { printf( "      ---   " ); } else { printf( "    %8.2e", result[2]); }  // I - VV'
+            bool okay = (result[0] < tol) && (result[1] < tol)
+                     && (result[2] < tol) && (result[3] == 0.)
+                     && (result[4] < tol);
+            status += ! okay;
+            printf( "   %-3s   %s\n", (result[3] == 0. ? "yes" : "no"), (okay ? "ok" : "failed") );
+
+            magma_free_cpu( hA    );
+            magma_free_cpu( hR    );
+            magma_free_cpu( U     );
+            magma_free_cpu( VT    );
+            magma_free_cpu( S     );
+            magma_free_cpu( Sref  );
+            magma_free_cpu( iwork );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+      }  // job
+      if ( opts.jobu.size() > 1 ) {
+          printf( "%%----------\n" );
+      }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -0,0 +1,192 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Rounds x to nearest even with a p-bit significand and minimum exponent
+   emin, in double, where it is exact; the reference for slag2h and slag2bf.
+*/
+static float round_ref( float x, int p, int emin )
+{
+    int e;
+    frexp( x, &e );
+    double ulp = ldexp( 1.0, (e-1 > emin ? e-1 : emin) - (p-1) );
+    return (float) (nearbyint( x / ulp ) * ulp);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Checks that all 2^16 bit patterns survive a round trip from 16 bits to
+   single and back; NaNs must stay NaN. Returns the number of failures.
+*/
+static int check_round_trip( bool bfloat16 )
+{
+    const magma_int_t nb = 256;
+    unsigned short h[ 65536 ], r[ 65536 ];
+    float *x;
+    magma_int_t info;
+    int errors = 0;
+
+    TESTING_CHECK( magma_smalloc_cpu( &x, 65536 ));
+    for (int i = 0; i < 65536; ++i) {
+        h[i] = (unsigned short) i;
+    }
+    if (bfloat16) {
+        magma_bflag2s_cpu( nb, nb, h, nb, x, nb, &info );
+        magma_slag2bf_cpu( nb, nb, x, nb, r, nb, &info );
+    }
+    else {
+        magma_hlag2s_cpu( nb, nb, h, nb, x, nb, &info );
+        magma_slag2h_cpu( nb, nb, x, nb, r, nb, &info );
+    }
+    unsigned short exp_mask = (bfloat16 ? 0x7f80 : 0x7c00);
+    for (int i = 0; i < 65536; ++i) {
+        bool nan = (h[i] & exp_mask) == exp_mask && (h[i] & ~(exp_mask | 0x8000)) != 0;
+        if (nan ? ! isnan( x[i] ) || (r[i] & exp_mask) != exp_mask
+                : r[i] != h[i]) {
+            errors += 1;
+        }
+    }
+    magma_free_cpu( x );
+    return errors;
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing slag2h, hlag2s, slag2bf, and bflag2s
+*/
+int main( int argc, char** argv )
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gbytes, cpu_perf, cpu_time;
+    magma_int_t ione = 1;
+    magma_int_t m, n, lda, size, info;
+    magma_int_t ISEED[4] = {0,0,0,1};
+    int status = 0;
+    float *SA, *SR;
+    magmaHalf *HA;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    int errors = check_round_trip( false );
+    printf( "%% half     round trip of all 2^16 values:  %d errors   %s\n",
+            errors, (errors == 0 ? "ok" : "failed") );
+    status += (errors != 0);
+    errors = check_round_trip( true );
+    printf( "%% bfloat16 round trip of all 2^16 values:  %d errors   %s\n\n",
+            errors, (errors == 0 ? "ok" : "failed") );
+    status += (errors != 0);
+
+    printf("%% func      M     N     CPU GB/s (ms)     back (ms)     errors   overflow\n");
+    printf("%%========================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            m = opts.msize[itest];
+            n = opts.nsize[itest];
+            lda  = m;
+            size = lda*n;
+            // m*n single loads and m*n 16-bit stores (and vice-versa back)
+            gbytes = (real_Double_t) m*n * (sizeof(float) + sizeof(magmaHalf)) / 1e9;
+
+            TESTING_CHECK( magma_smalloc_cpu( &SA, size ));
+            TESTING_CHECK( magma_smalloc_cpu( &SR, size ));
+            TESTING_CHECK( magma_malloc_cpu( (void**) &HA, size*sizeof(magmaHalf) ));
+
+            // entries of magnitude up to 1000, some tiny to get subnormals
+            lapackf77_slarnv( &ione, ISEED, &size, SA );
+            for (magma_int_t i = 0; i < size; ++i) {
+                SA[i] *= (i % 3 == 0 ? 1e-6f : 1000.f);
+            }
+
+            for (int ifmt = 0; ifmt < 2; ++ifmt) {
+                bool bf = (ifmt == 1);
+
+                /* =====================================================================
+                   Converts to 16 bits and back
+                   =================================================================== */
+                cpu_time = magma_wtime();
+                if (bf)
+                    magma_slag2bf_cpu( m, n, SA, lda, HA, lda, &info );
+                else
+                    magma_slag2h_cpu( m, n, SA, lda, HA, lda, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gbytes / cpu_time;
+                if (info != 0) {
+                    printf("magma_slag2%s_cpu returned error %lld: %s.\n",
+                           (bf ? "bf" : "h"), (long long) info, magma_strerror( info ));
+                }
+
+                real_Double_t back_time = magma_wtime();
+                if (bf)
+                    magma_bflag2s_cpu( m, n, HA, lda, SR, lda, &info );
+                else
+                    magma_hlag2s_cpu( m, n, HA, lda, SR, lda, &info );
+                back_time = magma_wtime() - back_time;
+
+                /* =====================================================================
+                   Check against rounding in double
+                   =================================================================== */
+                magma_int_t nerr = 0;
+                for (magma_int_t i = 0; i < size; ++i) {
+                    float ref = (bf ? round_ref( SA[i], 8, -126 )
+                                    : round_ref( SA[i], 11, -14 ));
+                    nerr += (SR[i] != ref);
+                }
+
+                /* =====================================================================
+                   Check that the first entry out of range is reported
+                   =================================================================== */
+                magma_int_t k1 = (m-1) + (n-1)*lda;
+                magma_int_t k2 = m/2 + (n/2)*lda;
+                float s1 = SA[k1], s2 = SA[k2];
+                SA[k1] = (bf ?  3.4e38f : 1e5f);
+                SA[k2] = (bf ? -3.4e38f : -7e4f);
+                if (bf)
+                    magma_slag2bf_cpu( m, n, SA, lda, HA, lda, &info );
+                else
+                    magma_slag2h_cpu( m, n, SA, lda, HA, lda, &info );
+                SA[k1] = s1;
+                SA[k2] = s2;
+
+                bool okay = (nerr == 0 && info == k2 + 1);
+                printf( "%-8s %5lld %5lld   %7.2f (%7.2f)   %7.2f      %8lld   %8lld   %s\n",
+                        (bf ? "slag2bf" : "slag2h"),
+                        (long long) m, (long long) n,
+                        cpu_perf, cpu_time*1000., back_time*1000.,
+                        (long long) nerr, (long long) info,
+                        (okay ? "ok" : "failed") );
+                status += ! okay;
+            }
+
+            magma_free_cpu( SA );
+            magma_free_cpu( SR );
+            magma_free_cpu( HA );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -55,14 +55,21 @@ int main( int argc, char** argv)
     
     float eps = lapackf77_slamch("E");
     
-    // Frobenius norm not currently supported, but leave this here for future support
+    // Frobenius norm not currently supported on the GPU, but leave this here for future support
     // of different norms. See similar code in testing_slansy.cpp.
+    // The host backend supports all four, in the order of magma_slange_all_cpu.
     magma_norm_t norm[] = { MagmaMaxNorm, MagmaOneNorm, MagmaInfNorm, MagmaFrobeniusNorm };
+    #ifdef HAVE_HOST
+    const int nnorm = 4;
+    float norms_all[4];
+    #else
+    const int nnorm = 3;
+    #endif
     
     printf("%%   M     N   norm   CPU GByte/s (ms)    GPU GByte/s (ms)        error               nan      inf\n");
     printf("%%================================================================================================\n");
     for( int itest = 0; itest < opts.ntest; ++itest ) {
-      for( int inorm = 0; inorm < 3; ++inorm ) {  /* < 4 for Frobenius */
+      for( int inorm = 0; inorm < nnorm; ++inorm ) {
         for( int iter = 0; iter < opts.niter; ++iter ) {
             M   = opts.msize[itest];
             N   = opts.nsize[itest];
@@ -140,6 +147,12 @@ int main( int argc, char** argv)
             }
             error = fabs( norm_magma - norm_lapack )
                   / (norm_lapack * normalize);
+            #ifdef HAVE_HOST
+            // all norms in one pass
+            magma_slange_all_cpu( M, N, h_A, lda, norms_all );
+            error = max( error, fabs( norms_all[inorm] - norm_lapack )
+                                / (norm_lapack * normalize) );
+            #endif
             bool okay; okay = (error <= tol);
             status += ! okay;
             
@@ -0,0 +1,190 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zpotrf_batched_cpu.cpp, normal z -> s, Wed Nov 15 00:34:24 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+#include "../control/magma_threadsetting.h"  // internal header
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing spotrf_batched_cpu and spotrf_vbatched_cpu
+      --version 1: fixed size, N-by-N.
+      --version 2: variable size, N_i-by-N_i with N_i random in [1, N].
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    real_Double_t   gflops, magma_perf, magma_time, cpu_perf, cpu_time;
+    float *h_A, *h_R;
+    float **A_array = NULL;
+    magma_int_t *n_array, *lda_array, *info_array;
+    magma_int_t N, n2, lda, info, batchCount;
+    float c_neg_one = MAGMA_S_NEG_ONE;
+    magma_int_t ione     = 1;
+    magma_int_t ISEED[4] = {0,0,0,1};
+    float      work[1], error;
+    int status = 0;
+
+    magma_opts opts( MagmaOptsBatched );
+    opts.parse_opts( argc, argv );
+    opts.lapack |= opts.check;  // check (-c) implies lapack (-l)
+    batchCount = opts.batchcount;
+    float tol = opts.tolerance * lapackf77_slamch("E");
+    const char* uplo = lapack_uplo_const( opts.uplo );
+
+    printf("%% uplo = %s, %s\n", uplo,
+           (opts.version == 1 ? "fixed size" : "variable size N_i in [1, N]"));
+    printf("%% BatchCount   N    CPU Gflop/s (ms)   MAGMA Gflop/s (ms)   ||R_magma - R_lapack||_F / ||R_lapack||_F\n");
+    printf("%%===================================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N   = opts.nsize[itest];
+            lda = N;
+            n2  = lda * N * batchCount;
+
+            TESTING_CHECK( magma_smalloc_cpu( &h_A, n2 ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_R, n2 ));
+            TESTING_CHECK( magma_imalloc_cpu( &n_array,    batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &lda_array,  batchCount ));
+            TESTING_CHECK( magma_imalloc_cpu( &info_array, batchCount ));
+            TESTING_CHECK( magma_malloc_cpu( (void**) &A_array, batchCount * sizeof(float*) ));
+
+            // guarantee reproducible sizes
+            srand(1000);
+            gflops = 0;
+            for (int s = 0; s < batchCount; ++s) {
+                n_array[s]   = (opts.version == 1 ? N : 1 + (rand() % N));
+                lda_array[s] = lda;
+                A_array[s]   = h_R + s * lda * N;
+                gflops += FLOPS_SPOTRF( n_array[s] ) / 1e9;
+            }
+
+            /* Initialize the matrices */
+            lapackf77_slarnv( &ione, ISEED, &n2, h_A );
+            for (int s = 0; s < batchCount; ++s) {
+                magma_smake_hpd( n_array[s], h_A + s * lda * N, lda );
+            }
+            magma_int_t columns = N * batchCount;
+            lapackf77_slacpy( MagmaFullStr, &N, &columns, h_A, &lda, h_R, &lda );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            magma_time = magma_wtime();
+            if (opts.version == 1) {
+                info = magma_spotrf_batched_cpu( opts.uplo, N, A_array, lda, info_array, batchCount );
+            }
+            else {
+                info = magma_spotrf_vbatched_cpu( opts.uplo, n_array, A_array, lda_array, info_array, batchCount );
+            }
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+            if (info != 0) {
+                printf("magma_spotrf_batched_cpu returned argument error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+                status += 1;
+            }
+            for (int s = 0; s < batchCount; ++s) {
+                if (info_array[s] != 0) {
+                    printf("magma_spotrf_batched_cpu matrix %lld returned diag error %lld\n",
+                           (long long) s, (long long) info_array[s] );
+                    status += 1;
+                    break;
+                }
+            }
+
+            /* =====================================================================
+               Performs operation using LAPACK
+               =================================================================== */
+            if ( opts.lapack ) {
+                cpu_time = magma_wtime();
+                #if defined(_OPENMP)
+                magma_int_t nthreads = magma_get_lapack_numthreads();
+                magma_set_lapack_numthreads(1);
+                magma_set_omp_numthreads(nthreads);
+                #pragma omp parallel for schedule(dynamic)
+                #endif
+                for (magma_int_t s=0; s < batchCount; s++) {
+                    magma_int_t locinfo;
+                    lapackf77_spotrf( uplo, &n_array[s], h_A + s * lda * N, &lda, &locinfo );
+                    if (locinfo != 0) {
+                        printf("lapackf77_spotrf matrix %lld returned error %lld: %s.\n",
+                               (long long) s, (long long) locinfo, magma_strerror( locinfo ));
+                    }
+                }
+                #if defined(_OPENMP)
+                magma_set_lapack_numthreads(nthreads);
+                #endif
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+
+                /* =====================================================================
+                   Check the result compared to LAPACK
+                   =================================================================== */
+                error = 0;
+                for (int s = 0; s < batchCount; ++s) {
+                    magma_int_t Ns = n_array[s];
+                    float *A = h_A + s * lda * N;
+                    float *R = h_R + s * lda * N;
+                    float Anorm, err;
+                    for (magma_int_t j = 0; j < Ns; ++j) {
+                        blasf77_saxpy( &Ns, &c_neg_one, A + j*lda, &ione, R + j*lda, &ione );
+                    }
+                    Anorm = safe_lapackf77_slansy( "f", uplo, &Ns, A, &lda, work );
+                    err   = safe_lapackf77_slansy( "f", uplo, &Ns, R, &lda, work )
+                          / Anorm;
+                    if ( isnan(err) || isinf(err) ) {
+                        error = err;
+                        break;
+                    }
+                    error = max( err, error );
+                }
+                bool okay = (error < tol);
+                status += ! okay;
+
+                printf("%10lld %5lld   %7.2f (%7.2f)    %7.2f (%7.2f)     %8.2e   %s\n",
+                       (long long) batchCount, (long long) N, cpu_perf, cpu_time*1000.,
+                       magma_perf, magma_time*1000., error, (okay ? "ok" : "failed"));
+            }
+            else {
+                printf("%10lld %5lld     ---   (  ---  )    %7.2f (%7.2f)       ---\n",
+                       (long long) batchCount, (long long) N, magma_perf, magma_time*1000. );
+            }
+
+            magma_free_cpu( h_A );
+            magma_free_cpu( h_R );
+            magma_free_cpu( n_array );
+            magma_free_cpu( lda_array );
+            magma_free_cpu( info_array );
+            magma_free_cpu( A_array );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -0,0 +1,148 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zpotrf_disk.cpp, normal z -> s, Sat Oct 17 06:08:49 2026
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing spotrf_disk
+   The matrix is written to a temporary file, factored, and read back.
+   --nb sets the panel width; by default, the minimum workspace is used.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    // constants
+    const float c_neg_one = MAGMA_S_NEG_ONE;
+    const magma_int_t ione = 1;
+
+    // locals
+    real_Double_t   gflops, gpu_perf, gpu_time, cpu_perf, cpu_time;
+    float *h_A, *h_R, *h_work, tmp[1];
+    magma_int_t N, n2, lda, lwork, info;
+    float      Anorm, error, work[1], *sigma;
+    int status = 0;
+
+    magma_opts opts;
+    opts.matrix = "rand_dominant";  // default
+    opts.parse_opts( argc, argv );
+    opts.lapack |= opts.check;  // check (-c) implies lapack (-l)
+
+    float tol = opts.tolerance * lapackf77_slamch("E");
+
+    printf("%% uplo = %s\n", lapack_uplo_const(opts.uplo) );
+    printf("%%   N   CPU Gflop/s (sec)   Disk Gflop/s (sec)   ||R_magma - R_lapack||_F / ||R_lapack||_F\n");
+    printf("%%========================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N     = opts.nsize[itest];
+            lda   = N;
+            n2    = lda*N;
+            gflops = FLOPS_SPOTRF( N ) / 1e9;
+
+            // query for workspace size
+            lwork = -1;
+            magma_spotrf_disk( opts.uplo, N, 0, 0, lda, tmp, lwork, &info );
+            lwork = (magma_int_t) MAGMA_S_REAL( tmp[0] );
+            if ( opts.nb > 0 ) {
+                lwork = max( lwork, 4*N*opts.nb );
+            }
+
+            TESTING_CHECK( magma_smalloc_cpu( &h_A, n2 ));
+            TESTING_CHECK( magma_smalloc_cpu( &sigma, N ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_R, n2 ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_work, lwork ));
+
+            /* Initialize the matrix, and write it to a file */
+            magma_generate_matrix( opts, N, N, sigma, h_A, lda );
+            if (opts.verbose) {
+                printf( "A = " ); magma_sprint( N, N, h_A, lda );
+            }
+            FILE* file = tmpfile();
+            if ( file == NULL ) {
+                printf( "cannot create temporary file\n" );
+                status += 1;
+                break;
+            }
+            fwrite( h_A, sizeof(float), n2, file );
+            fflush( file );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            gpu_time = magma_wtime();
+            magma_spotrf_disk( opts.uplo, N, fileno( file ), 0, lda, h_work, lwork, &info );
+            gpu_time = magma_wtime() - gpu_time;
+            gpu_perf = gflops / gpu_time;
+            if (info != 0) {
+                printf("magma_spotrf_disk returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            rewind( file );
+            if ( fread( h_R, sizeof(float), n2, file ) != size_t(n2) ) {
+                printf( "cannot read temporary file\n" );
+            }
+            fclose( file );
+
+            if ( opts.lapack ) {
+                /* =====================================================================
+                   Performs operation using LAPACK
+                   =================================================================== */
+                cpu_time = magma_wtime();
+                lapackf77_spotrf( lapack_uplo_const(opts.uplo), &N, h_A, &lda, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_spotrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+
+                /* =====================================================================
+                   Check the result compared to LAPACK
+                   =================================================================== */
+                blasf77_saxpy(&n2, &c_neg_one, h_A, &ione, h_R, &ione);
+                Anorm = lapackf77_slange("f", &N, &N, h_A, &lda, work);
+                error = lapackf77_slange("f", &N, &N, h_R, &lda, work) / Anorm;
+
+                printf("%5lld   %7.2f (%7.2f)    %7.2f (%7.2f)    %8.2e   %s\n",
+                       (long long) N, cpu_perf, cpu_time, gpu_perf, gpu_time,
+                       error, (error < tol ? "ok" : "failed") );
+                status += ! (error < tol);
+            }
+            else {
+                printf("%5lld     ---   (  ---  )    %7.2f (%7.2f)      ---  \n",
+                       (long long) N, gpu_perf, gpu_time );
+            }
+            magma_free_cpu( h_A );
+            magma_free_cpu( sigma );
+            magma_free_cpu( h_R );
+            magma_free_cpu( h_work );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
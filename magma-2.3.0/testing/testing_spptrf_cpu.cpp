@@ -0,0 +1,176 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zpptrf_cpu.cpp, normal z -> s, Wed Nov 15 00:34:20 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Checks the packed (TP) and RFP (TF) conversions of the uplo triangle of A
+   against LAPACK's strttp and strttf, for both transr, and that converting
+   back restores the triangle. All are copies, so they must match exactly.
+   Returns the number of failures.
+*/
+static int check_formats(
+    magma_uplo_t uplo, magma_int_t N,
+    const float *A, magma_int_t lda )
+{
+    const float c_zero = MAGMA_S_ZERO;
+    const magma_trans_t transr[] = { MagmaNoTrans, MagmaTrans };
+    magma_int_t npack = N*(N+1)/2, info;
+    float *AP, *RP, *B;
+    int errors = 0;
+
+    TESTING_CHECK( magma_smalloc_cpu( &AP, max( 1, npack ) ));
+    TESTING_CHECK( magma_smalloc_cpu( &RP, max( 1, npack ) ));
+    TESTING_CHECK( magma_smalloc_cpu( &B,  lda*N ));
+
+    // packed
+    lapackf77_strttp( lapack_uplo_const(uplo), &N, A, &lda, RP, &info );
+    magma_strttp_cpu( uplo, N, A, lda, AP, &info );
+    errors += (memcmp( AP, RP, npack*sizeof(float) ) != 0);
+    lapackf77_slacpy( "Full", &N, &N, A, &lda, B, &lda );
+    lapackf77_slaset( lapack_uplo_const(uplo), &N, &N, &c_zero, &c_zero, B, &lda );
+    magma_stpttr_cpu( uplo, N, AP, B, lda, &info );
+    errors += (memcmp( B, A, lda*N*sizeof(float) ) != 0);
+
+    // rectangular full packed
+    for (int t = 0; t < 2; ++t) {
+        lapackf77_strttf( lapack_trans_const(transr[t]), lapack_uplo_const(uplo),
+                          &N, A, &lda, RP, &info );
+        magma_strttf_cpu( transr[t], uplo, N, A, lda, AP, &info );
+        errors += (memcmp( AP, RP, npack*sizeof(float) ) != 0);
+        lapackf77_slaset( lapack_uplo_const(uplo), &N, &N, &c_zero, &c_zero, B, &lda );
+        magma_stfttr_cpu( transr[t], uplo, N, AP, B, lda, &info );
+        errors += (memcmp( B, A, lda*N*sizeof(float) ) != 0);
+    }
+
+    magma_free_cpu( AP );
+    magma_free_cpu( RP );
+    magma_free_cpu( B  );
+    return errors;
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing spptrf_cpu, and the packed and RFP conversions
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    // constants
+    const float c_neg_one = MAGMA_S_NEG_ONE;
+    const magma_int_t ione = 1;
+
+    // locals
+    real_Double_t   gflops, cpu_perf, cpu_time, magma_perf, magma_time;
+    float *h_A, *h_AP, *h_RP;
+    magma_int_t N, n2, npack, lda, info;
+    float      Anorm, error, work[1], *sigma;
+    int status = 0;
+
+    magma_opts opts;
+    opts.matrix = "rand_dominant";  // default
+    opts.parse_opts( argc, argv );
+    opts.lapack |= opts.check;  // check (-c) implies lapack (-l)
+
+    float tol = opts.tolerance * lapackf77_slamch("E");
+
+    printf("%% uplo = %s\n", lapack_uplo_const(opts.uplo) );
+    printf("%%   N   CPU Gflop/s (sec)   MAGMA Gflop/s (sec)   ||R_magma - R_lapack||_F / ||R_lapack||_F   TP/TF\n");
+    printf("%%=========================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N     = opts.nsize[itest];
+            lda   = max( 1, N );
+            n2    = lda*N;
+            npack = N*(N+1)/2;
+            gflops = FLOPS_SPOTRF( N ) / 1e9;
+
+            TESTING_CHECK( magma_smalloc_cpu( &h_A, n2 ));
+            TESTING_CHECK( magma_smalloc_cpu( &sigma, N ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_AP, max( 1, npack ) ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_RP, max( 1, npack ) ));
+
+            /* Initialize the matrix */
+            magma_generate_matrix( opts, N, N, sigma, h_A, lda );
+            int format_errors = check_formats( opts.uplo, N, h_A, lda );
+            status += (format_errors != 0);
+
+            magma_strttp_cpu( opts.uplo, N, h_A, lda, h_AP, &info );
+            blasf77_scopy( &npack, h_AP, &ione, h_RP, &ione );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            magma_time = magma_wtime();
+            magma_spptrf_cpu( opts.uplo, N, h_AP, &info );
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+            if (info != 0) {
+                printf("magma_spptrf_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            if ( opts.lapack ) {
+                /* =====================================================================
+                   Performs operation using LAPACK
+                   =================================================================== */
+                cpu_time = magma_wtime();
+                lapackf77_spptrf( lapack_uplo_const(opts.uplo), &N, h_RP, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_spptrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+
+                /* =====================================================================
+                   Check the result compared to LAPACK
+                   =================================================================== */
+                blasf77_saxpy( &npack, &c_neg_one, h_RP, &ione, h_AP, &ione );
+                Anorm = lapackf77_slange( "f", &npack, &ione, h_RP, &npack, work );
+                error = lapackf77_slange( "f", &npack, &ione, h_AP, &npack, work ) / Anorm;
+
+                printf("%5lld   %7.2f (%7.2f)   %7.2f (%7.2f)     %8.2e                                  %s\n",
+                       (long long) N, cpu_perf, cpu_time, magma_perf, magma_time,
+                       error, (error < tol && format_errors == 0 ? "ok" : "failed") );
+                status += ! (error < tol);
+            }
+            else {
+                printf("%5lld     ---   (  ---  )   %7.2f (%7.2f)       ---                                     %s\n",
+                       (long long) N, magma_perf, magma_time,
+                       (format_errors == 0 ? "ok" : "failed") );
+            }
+            magma_free_cpu( h_A );
+            magma_free_cpu( sigma );
+            magma_free_cpu( h_AP );
+            magma_free_cpu( h_RP );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -0,0 +1,255 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @generated from testing/testing_zhetrf_aasen_cpu.cpp, normal z -> s, Wed Nov 15 00:34:20 2017
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "magma_operators.h"  // for MAGMA_S_SUB
+#include "testings.h"
+
+
+/******************************************************************************/
+// On input, LT and ipiv are the Aasen factorization of the symmetric A,
+// with uplo = MagmaLower.
+// Returns |P A P^H - L T L^H| / (N |A|).
+float get_LTLt_error(
+    magma_int_t N,
+    const float *A, magma_int_t lda,
+    const float *LT,
+    const magma_int_t *ipiv )
+{
+    const float c_one  = MAGMA_S_ONE;
+    const float c_zero = MAGMA_S_ZERO;
+    float work[1], matnorm, residual;
+    float *PA, *L, *T, *LT2;
+
+    #define PA(i,j) (PA[(i) + (j)*N])
+    #define  L(i,j) ( L[(i) + (j)*N])
+    #define  T(i,j) ( T[(i) + (j)*N])
+    #define LT(i,j) (LT[(i) + (j)*lda])
+
+    TESTING_CHECK( magma_smalloc_cpu( &PA,  N*N ));
+    TESTING_CHECK( magma_smalloc_cpu( &L,   N*N ));
+    TESTING_CHECK( magma_smalloc_cpu( &T,   N*N ));
+    TESTING_CHECK( magma_smalloc_cpu( &LT2, N*N ));
+    memset( L, 0, N*N*sizeof(float) );
+    memset( T, 0, N*N*sizeof(float) );
+
+    magma_int_t i, j, piv;
+    magma_int_t nb = magma_get_ssytrf_aasen_nb( N );
+
+    // extract the band T, of bandwidth nb
+    for (i=0; i < N; i++) {
+        magma_int_t istart = max( 0, i-nb );
+        for (j=istart; j <= i; j++) {
+            T(i,j) = LT(i,j);
+        }
+        for (j=istart; j < i; j++) {
+            T(j,i) = MAGMA_S_CONJ( LT(i,j) );
+        }
+    }
+    // extract L; its first nb columns are the identity
+    for (i=0; i < min( N, nb ); i++) {
+        L(i,i) = c_one;
+    }
+    for (i=nb; i < N; i++) {
+        for (j=0; j < i-nb; j++) {
+            L(i,nb+j) = LT(i,j);
+        }
+        L(i,i) = c_one;
+    }
+
+    // T = L T L^H
+    blasf77_sgemm( MagmaNoTransStr, MagmaNoTransStr, &N, &N, &N,
+                   &c_one, L, &N, T, &N, &c_zero, LT2, &N );
+    blasf77_sgemm( MagmaNoTransStr, MagmaConjTransStr, &N, &N, &N,
+                   &c_one, LT2, &N, L, &N, &c_zero, T, &N );
+
+    // full symmetric A from its lower triangle, with real diagonal
+    matnorm = lapackf77_slansy( "Fro", MagmaLowerStr, &N, A, &lda, work );
+    for (j=0; j < N; j++) {
+        PA(j,j) = MAGMA_S_MAKE( MAGMA_S_REAL( A[j + j*lda] ), 0. );
+        for (i=j+1; i < N; i++) {
+            PA(i,j) = A[i + j*lda];
+            PA(j,i) = MAGMA_S_CONJ( A[i + j*lda] );
+        }
+    }
+
+    // apply symmetric pivoting, P A P^H
+    for (j=0; j < N; j++) {
+        piv = ipiv[j]-1;
+        if (piv != j) {
+            blasf77_sswap( &N, &PA(j,0), &N, &PA(piv,0), &N );
+            magma_int_t ione = 1;
+            blasf77_sswap( &N, &PA(0,j), &ione, &PA(0,piv), &ione );
+        }
+    }
+
+    for (j=0; j < N; j++) {
+        for (i=0; i < N; i++) {
+            T(i,j) = MAGMA_S_SUB( T(i,j), PA(i,j) );
+        }
+    }
+    residual = lapackf77_slange( "Fro", &N, &N, T, &N, work );
+
+    #undef PA
+    #undef L
+    #undef T
+    #undef LT
+
+    magma_free_cpu( PA  );
+    magma_free_cpu( L   );
+    magma_free_cpu( T   );
+    magma_free_cpu( LT2 );
+
+    return residual / (matnorm * N);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing ssytrf_aasen_cpu and ssytrs_aasen_cpu
+   Only uplo = MagmaLower is implemented.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    float *h_A, *h_LT, *h_B, *h_X, *work, temp;
+    real_Double_t   gflops, magma_perf, magma_time, cpu_perf=0, cpu_time=0;
+    float          fact_error, solve_error, Anorm, Xnorm, Rnorm, rwork[1];
+    magma_int_t     *ipiv;
+    magma_int_t     N, NRHS, lda, ldb, n2, lwork, info;
+    magma_int_t     ione     = 1;
+    magma_int_t     ISEED[4] = {0,0,0,1};
+    float c_one     = MAGMA_S_ONE;
+    float c_neg_one = MAGMA_S_NEG_ONE;
+    int status = 0;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    float tol = opts.tolerance * lapackf77_slamch("E");
+    NRHS = opts.nrhs;
+
+    printf("%% uplo = %s\n", lapack_uplo_const( MagmaLower ));
+    printf("%%   N  NRHS   CPU Gflop/s (sec)   MAGMA Gflop/s (sec)   |PAP^H - LTL^H|/(N|A|)   |AX - B|/(N|A||X|)\n");
+    printf("%%===============================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N   = opts.nsize[itest];
+            lda = max( 1, N );
+            ldb = lda;
+            n2  = lda*N;
+            gflops = FLOPS_SPOTRF( N ) / 1e9;
+
+            TESTING_CHECK( magma_imalloc_cpu( &ipiv, max( 1, N ) ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_A,  n2        ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_LT, n2        ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_B,  ldb*NRHS  ));
+            TESTING_CHECK( magma_smalloc_cpu( &h_X,  ldb*NRHS  ));
+
+            /* Initialize the matrix; only its lower triangle is referenced */
+            magma_generate_matrix( opts, N, N, nullptr, h_A, lda );
+
+            /* =====================================================================
+               Performs operation using LAPACK, Bunch-Kaufman ssytrf for timing
+               =================================================================== */
+            if ( opts.lapack ) {
+                lwork = -1;
+                lapackf77_ssytrf( MagmaLowerStr, &N, h_LT, &lda, ipiv, &temp, &lwork, &info );
+                lwork = (magma_int_t) MAGMA_S_REAL( temp );
+                TESTING_CHECK( magma_smalloc_cpu( &work, max( 1, lwork ) ));
+                lapackf77_slacpy( MagmaFullStr, &N, &N, h_A, &lda, h_LT, &lda );
+
+                cpu_time = magma_wtime();
+                lapackf77_ssytrf( MagmaLowerStr, &N, h_LT, &lda, ipiv, work, &lwork, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_ssytrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+                magma_free_cpu( work );
+            }
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            lapackf77_slacpy( MagmaFullStr, &N, &N, h_A, &lda, h_LT, &lda );
+            magma_time = magma_wtime();
+            magma_ssytrf_aasen_cpu( MagmaLower, N, h_LT, lda, ipiv, &info );
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+            if (info != 0) {
+                printf("magma_ssytrf_aasen_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            /* =====================================================================
+               Check the factorization, then solve with it
+               =================================================================== */
+            fact_error = get_LTLt_error( N, h_A, lda, h_LT, ipiv );
+
+            magma_int_t sizeB = ldb*NRHS;
+            lapackf77_slarnv( &ione, ISEED, &sizeB, h_B );
+            lapackf77_slacpy( MagmaFullStr, &N, &NRHS, h_B, &ldb, h_X, &ldb );
+            magma_ssytrs_aasen_cpu( MagmaLower, N, NRHS, h_LT, lda, ipiv, h_X, ldb, &info );
+            if (info != 0) {
+                printf("magma_ssytrs_aasen_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            // |A X - B| / (N |A| |X|)
+            Anorm = lapackf77_slansy( "Fro", MagmaLowerStr, &N, h_A, &lda, rwork );
+            Xnorm = lapackf77_slange( "Fro", &N, &NRHS, h_X, &ldb, rwork );
+            blasf77_ssymm( MagmaLeftStr, MagmaLowerStr, &N, &NRHS,
+                           &c_one,     h_A, &lda, h_X, &ldb,
+                           &c_neg_one, h_B, &ldb );
+            Rnorm = lapackf77_slange( "Fro", &N, &NRHS, h_B, &ldb, rwork );
+            solve_error = Rnorm / (N*Anorm*Xnorm);
+
+            bool okay = (fact_error < tol && solve_error < tol);
+            status += ! okay;
+            if ( opts.lapack ) {
+                printf("%5lld %5lld   %7.2f (%7.4f)   %7.2f (%7.4f)     %8.2e                 %8.2e   %s\n",
+                       (long long) N, (long long) NRHS,
+                       cpu_perf, cpu_time, magma_perf, magma_time,
+                       fact_error, solve_error, (okay ? "ok" : "failed"));
+            }
+            else {
+                printf("%5lld %5lld     ---   (  ---  )   %7.2f (%7.4f)     %8.2e                 %8.2e   %s\n",
+                       (long long) N, (long long) NRHS,
+                       magma_perf, magma_time,
+                       fact_error, solve_error, (okay ? "ok" : "failed"));
+            }
+
+            magma_free_cpu( ipiv );
+            magma_free_cpu( h_A  );
+            magma_free_cpu( h_LT );
+            magma_free_cpu( h_B  );
+            magma_free_cpu( h_X  );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
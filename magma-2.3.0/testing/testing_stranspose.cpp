@@ -44,9 +44,10 @@ int main( int argc, char** argv)
     #endif
     
     real_Double_t    gbytes, gpu_perf, gpu_time, gpu_perf2=0, gpu_time2=0, cpu_perf, cpu_time;
-    float           error, error2, work[1];
+    real_Double_t    host_perf, host_time, host_perf2, host_time2;
+    float           error, error2, error3, error4, work[1];
     float  c_neg_one = MAGMA_S_NEG_ONE;
-    float *h_A, *h_B, *h_R;
+    float *h_A, *h_B, *h_R, *h_C;
     magmaFloat_ptr d_A, d_B;
     magma_int_t M, N, size, lda, ldda, ldb, lddb;
     magma_int_t ione     = 1;
@@ -63,9 +64,9 @@ int main( int argc, char** argv)
     magma_trans_t trans[] = { MagmaTrans };
     #endif
 
-    printf("%% Inplace transpose requires M == N.\n");
-    printf("%% Trans     M     N   CPU GByte/s (ms)    GPU GByte/s (ms)  check   Inplace GB/s (ms)  check\n");
-    printf("%%=========================================================================================\n");
+    printf("%% Inplace transpose requires M == N on the GPU; magma_stranspose*_cpu (Host) takes any M, N.\n");
+    printf("%% Trans     M     N   CPU GByte/s (ms)    GPU GByte/s (ms)  check   Inplace GB/s (ms)  check   Host GByte/s (ms)  check   Host inplace (ms)  check\n");
+    printf("%%=====================================================================================================================================\n");
     for( int itest = 0; itest < opts.ntest; ++itest ) {
       for( int itran = 0; itran < ntrans; ++itran ) {
         for( int iter = 0; iter < opts.niter; ++iter ) {
@@ -81,6 +82,7 @@ int main( int argc, char** argv)
             TESTING_CHECK( magma_smalloc_cpu( &h_A, lda*N  ));  // input:  M x N
             TESTING_CHECK( magma_smalloc_cpu( &h_B, ldb*M  ));  // output: N x M
             TESTING_CHECK( magma_smalloc_cpu( &h_R, ldb*M  ));  // output: N x M
+            TESTING_CHECK( magma_smalloc_cpu( &h_C, lda*N  ));  // in-place: M x N, then N x M
             
             TESTING_CHECK( magma_smalloc( &d_A, ldda*N ));  // input:  M x N
             TESTING_CHECK( magma_smalloc( &d_B, lddb*M ));  // output: N x M
@@ -122,6 +124,43 @@ int main( int argc, char** argv)
             cpu_time = magma_wtime() - cpu_time;
             cpu_perf = gbytes / cpu_time;
             
+            /* ====================================================================
+               Performs operation using MAGMA on the CPU host,
+               out-of-place (h_R) and in-place (h_C)
+               =================================================================== */
+            lapackf77_slacpy( "g", &N, &M, h_B, &ldb, h_R, &ldb );  // touch pages, as for d_B
+            host_time = magma_wtime();
+            if ( trans[itran] == MagmaTrans ) {
+                magma_stranspose_cpu( M, N, h_A, lda, h_R, ldb );
+            }
+            #ifdef COMPLEX
+            else {
+                magma_stranspose_conj_cpu( M, N, h_A, lda, h_R, ldb );
+            }
+            #endif
+            host_time = magma_wtime() - host_time;
+            host_perf = gbytes / host_time;
+
+            size = ldb*M;
+            blasf77_saxpy( &size, &c_neg_one, h_B, &ione, h_R, &ione );
+            error3 = lapackf77_slange("f", &N, &M, h_R, &ldb, work );
+
+            lapackf77_slacpy( "g", &M, &N, h_A, &lda, h_C, &lda );
+            host_time2 = magma_wtime();
+            if ( trans[itran] == MagmaTrans ) {
+                magma_stranspose_inplace_cpu( M, N, h_C, lda );
+            }
+            #ifdef COMPLEX
+            else {
+                magma_stranspose_conj_inplace_cpu( M, N, h_C, lda );
+            }
+            #endif
+            host_time2 = magma_wtime() - host_time2;
+            host_perf2 = gbytes / host_time2;
+
+            blasf77_saxpy( &size, &c_neg_one, h_B, &ione, h_C, &ione );
+            error4 = lapackf77_slange("f", &N, &M, h_C, &ldb, work );
+
             /* ====================================================================
                Performs operation using MAGMA, out-of-place
                =================================================================== */
@@ -133,10 +172,10 @@ int main( int argc, char** argv)
                 //magmablas_stranspose( M-2, N-2, d_A(1,1), ldda, d_B(1,1), lddb, opts.queue );  // inset by 1 row & col
                 magmablas_stranspose( M, N, d_A(0,0), ldda, d_B(0,0), lddb, opts.queue );
             }
-            #ifdef HAVE_CUBLAS
+            #if defined(COMPLEX) && (defined(HAVE_CUBLAS) || defined(HAVE_HOST))
             else {
-                //magmablas_stranspose( M-2, N-2, d_A(1,1), ldda, d_B(1,1), lddb, opts.queue );  // inset by 1 row & col
-                magmablas_stranspose( M, N, d_A(0,0), ldda, d_B(0,0), lddb, opts.queue );
+                //magmablas_stranspose_conj( M-2, N-2, d_A(1,1), ldda, d_B(1,1), lddb, opts.queue );  // inset by 1 row & col
+                magmablas_stranspose_conj( M, N, d_A(0,0), ldda, d_B(0,0), lddb, opts.queue );
             }
             #endif
             gpu_time = magma_sync_wtime( opts.queue ) - gpu_time;
@@ -153,10 +192,10 @@ int main( int argc, char** argv)
                     //magmablas_stranspose_inplace( N-2, d_A(1,1), ldda, opts.queue );  // inset by 1 row & col
                     magmablas_stranspose_inplace( N, d_A(0,0), ldda, opts.queue );
                 }
-                #ifdef HAVE_CUBLAS
+                #if defined(COMPLEX) && (defined(HAVE_CUBLAS) || defined(HAVE_HOST))
                 else {
-                    //magmablas_stranspose_inplace( N-2, d_A(1,1), ldda, opts.queue );  // inset by 1 row & col
-                    magmablas_stranspose_inplace( N, d_A(0,0), ldda, opts.queue );
+                    //magmablas_stranspose_conj_inplace( N-2, d_A(1,1), ldda, opts.queue );  // inset by 1 row & col
+                    magmablas_stranspose_conj_inplace( N, d_A(0,0), ldda, opts.queue );
                 }
                 #endif
                 gpu_time2 = magma_sync_wtime( opts.queue ) - gpu_time2;
@@ -178,27 +217,36 @@ int main( int argc, char** argv)
                 blasf77_saxpy( &size, &c_neg_one, h_B, &ione, h_R, &ione );
                 error2 = lapackf77_slange("f", &N, &M, h_R, &ldb, work );
     
-                printf("%5c %5lld %5lld   %7.2f (%7.2f)   %7.2f (%7.2f)  %6s  %7.2f (%7.2f)  %s\n",
+                printf("%5c %5lld %5lld   %7.2f (%7.2f)   %7.2f (%7.2f)  %6s  %7.2f (%7.2f)  %5s   %7.2f (%7.2f)  %5s   %7.2f (%7.2f)  %s\n",
                        lapacke_trans_const( trans[itran] ),
                        (long long) M, (long long) N,
                        cpu_perf, cpu_time*1000., gpu_perf, gpu_time*1000.,
                        (error  == 0. ? "ok" : "failed"),
                        gpu_perf2, gpu_time2,
-                       (error2 == 0. ? "ok" : "failed") );
-                status += ! (error == 0. && error2 == 0.);
+                       (error2 == 0. ? "ok" : "failed"),
+                       host_perf, host_time*1000.,
+                       (error3 == 0. ? "ok" : "failed"),
+                       host_perf2, host_time2*1000.,
+                       (error4 == 0. ? "ok" : "failed") );
+                status += ! (error == 0. && error2 == 0. && error3 == 0. && error4 == 0.);
             }
             else {
-                printf("%5c %5lld %5lld   %7.2f (%7.2f)   %7.2f (%7.2f)  %6s    ---   (  ---  )\n",
+                printf("%5c %5lld %5lld   %7.2f (%7.2f)   %7.2f (%7.2f)  %6s    ---   (  ---  )    ---    %7.2f (%7.2f)  %5s   %7.2f (%7.2f)  %s\n",
                        lapacke_trans_const( trans[itran] ),
                        (long long) M, (long long) N,
                        cpu_perf, cpu_time*1000., gpu_perf, gpu_time*1000.,
-                       (error  == 0. ? "ok" : "failed") );
-                status += ! (error == 0.);
+                       (error  == 0. ? "ok" : "failed"),
+                       host_perf, host_time*1000.,
+                       (error3 == 0. ? "ok" : "failed"),
+                       host_perf2, host_time2*1000.,
+                       (error4 == 0. ? "ok" : "failed") );
+                status += ! (error == 0. && error3 == 0. && error4 == 0.);
             }
             
             magma_free_cpu( h_A );
             magma_free_cpu( h_B );
             magma_free_cpu( h_R );
+            magma_free_cpu( h_C );
             
             magma_free( d_A );
             magma_free( d_B );
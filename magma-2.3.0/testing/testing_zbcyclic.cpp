@@ -0,0 +1,216 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> c d s
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Returns the number of entries of the m-by-n A and B that differ;
+   the copies are exact, so this should be 0.
+*/
+static magma_int_t count_diff(
+    magma_int_t m, magma_int_t n,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    const magmaDoubleComplex *B, magma_int_t ldb )
+{
+    magma_int_t cnt = 0;
+    for (magma_int_t j = 0; j < n; ++j) {
+        for (magma_int_t i = 0; i < m; ++i) {
+            cnt += ! MAGMA_Z_EQUAL( A[ i + j*lda ], B[ i + j*ldb ] );
+        }
+    }
+    return cnt;
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing zsetmatrix_2D_bcyclic, zgetmatrix_2D_bcyclic,
+      zredistribute_2D_bcyclic, zpackmatrix_2D_bcyclic, and
+      zunpackmatrix_2D_bcyclic, over several P x Q grids.
+      Participants share devices round robin if there are fewer devices.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    // grids; the second of each pair is the target of redistribution
+    const magma_int_t grids[][4] = {
+        { 1, 1,  2, 2 },
+        { 1, 4,  2, 2 },  // 1D column to 2D
+        { 4, 1,  1, 4 },  // 1D row to 1D column
+        { 2, 2,  2, 3 },
+        { 2, 3,  3, 2 },
+    };
+    const int ngrids = sizeof(grids) / sizeof(grids[0]);
+
+    real_Double_t   redist_time, gbytes;
+    double          work[1];
+    magma_int_t M, N, lda, n2, nb, mb, d, mloc, nloc, ndevices, errors;
+    magma_int_t ione     = 1;
+    magma_int_t ISEED[4] = {0,0,0,1};
+    magmaDoubleComplex *hA, *hR;
+    magmaDoubleComplex_ptr dA[6], dB[6], dbuf[6];
+    magma_int_t count[6];
+    magma_queue_t queues[6];
+    magma_device_t devices[ MagmaMaxGPUs ];
+    magmaDoubleComplex c_zero = MAGMA_Z_ZERO;
+    magma_bcyclic_t descA, descB;
+    int status = 0;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    magma_getdevices( devices, MagmaMaxGPUs, &ndevices );
+
+    printf("%%   M     N    nb   P x Q  -> P x Q   redist GB/s (ms)   index  set/get  redist  pack\n");
+    printf("%%=====================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M   = opts.msize[itest];
+            N   = opts.nsize[itest];
+            nb  = (opts.nb > 0 ? opts.nb : 64);
+            lda = max( 1, M );
+            n2  = lda*N;
+            gbytes = sizeof(magmaDoubleComplex) * 1.*M*N / 1e9;
+
+            TESTING_CHECK( magma_zmalloc_cpu( &hA, n2 ));
+            TESTING_CHECK( magma_zmalloc_cpu( &hR, n2 ));
+            lapackf77_zlarnv( &ione, ISEED, &n2, hA );
+
+            for (int g = 0; g < ngrids; ++g) {
+                magma_int_t P  = grids[g][0], Q  = grids[g][1];
+                magma_int_t P2 = grids[g][2], Q2 = grids[g][3];
+                magma_int_t nprocs = max( P*Q, P2*Q2 );
+                mb = nb;
+                TESTING_CHECK( magma_bcyclic_init( &descA, M, N, mb, nb, P, Q ));
+                // a different tile size for the target layout
+                TESTING_CHECK( magma_bcyclic_init( &descB, M, N, nb + nb/2, nb/2 + 1, P2, Q2 ));
+
+                for (d = 0; d < nprocs; ++d) {
+                    magma_setdevice( devices[ d % ndevices ] );
+                    magma_queue_create( devices[ d % ndevices ], &queues[d] );
+                    dA[d] = dB[d] = dbuf[d] = NULL;
+                    if (d < P*Q) {
+                        magma_bcyclic_local_size( &descA, d, &mloc, &nloc );
+                        TESTING_CHECK( magma_zmalloc( &dA[d],   descA.ldd*max(1,nloc) ));
+                        TESTING_CHECK( magma_zmalloc( &dbuf[d], max(1,mloc*nloc) ));
+                    }
+                    if (d < P2*Q2) {
+                        magma_bcyclic_local_size( &descB, d, &mloc, &nloc );
+                        TESTING_CHECK( magma_zmalloc( &dB[d], descB.ldd*max(1,nloc) ));
+                    }
+                }
+
+                /* =====================================================================
+                   Index queries: local <-> global round trip, owner, sizes
+                   =================================================================== */
+                magma_int_t index_errors = 0, total = 0;
+                for (d = 0; d < P*Q; ++d) {
+                    magma_bcyclic_local_size( &descA, d, &mloc, &nloc );
+                    total += mloc*nloc;
+                }
+                index_errors += (total != M*N);
+                for (magma_int_t j = 0; j < N; j += max( 1, N/37 )) {
+                    for (magma_int_t i = 0; i < M; i += max( 1, M/41 )) {
+                        magma_int_t dev, il, jl, i2, j2;
+                        magma_bcyclic_local_index( &descA, i, j, &dev, &il, &jl );
+                        magma_bcyclic_global_index( &descA, dev, il, jl, &i2, &j2 );
+                        magma_bcyclic_local_size( &descA, dev, &mloc, &nloc );
+                        index_errors += (i2 != i || j2 != j || il >= mloc || jl >= nloc
+                                         || dev != magma_bcyclic_owner( &descA, i, j ));
+                    }
+                }
+
+                /* =====================================================================
+                   Set and get
+                   =================================================================== */
+                magma_zsetmatrix_2D_bcyclic( &descA, hA, lda, dA, queues );
+                lapackf77_zlaset( "Full", &M, &N, &c_zero, &c_zero, hR, &lda );
+                magma_zgetmatrix_2D_bcyclic( &descA, dA, hR, lda, queues );
+                magma_int_t setget_errors = count_diff( M, N, hA, lda, hR, lda );
+
+                /* =====================================================================
+                   Redistribute to the target layout
+                   =================================================================== */
+                redist_time = magma_sync_wtime( queues[0] );
+                magma_zredistribute_2D_bcyclic( &descA, dA, &descB, dB, queues );
+                redist_time = magma_sync_wtime( queues[0] ) - redist_time;
+                lapackf77_zlaset( "Full", &M, &N, &c_zero, &c_zero, hR, &lda );
+                magma_zgetmatrix_2D_bcyclic( &descB, dB, hR, lda, queues );
+                magma_int_t redist_errors = count_diff( M, N, hA, lda, hR, lda );
+
+                /* =====================================================================
+                   Pack each participant's part of a submatrix, clear A,
+                   and unpack; only the submatrix is restored
+                   =================================================================== */
+                magma_int_t i0 = M/3, j0 = N/4, ms = M/2, ns = N/2;
+                for (d = 0; d < P*Q; ++d) {
+                    magma_setdevice( devices[ d % ndevices ] );
+                    count[d] = magma_zpackmatrix_2D_bcyclic( &descA, d, i0, j0, ms, ns,
+                                                             dA[d], dbuf[d], queues[d] );
+                    magma_bcyclic_local_size( &descA, d, &mloc, &nloc );
+                    magmablas_zlaset( MagmaFull, mloc, nloc, c_zero, c_zero,
+                                      dA[d], descA.ldd, queues[d] );
+                }
+                total = 0;
+                for (d = 0; d < P*Q; ++d) {
+                    magma_setdevice( devices[ d % ndevices ] );
+                    total += magma_zunpackmatrix_2D_bcyclic( &descA, d, i0, j0, ms, ns,
+                                                             dbuf[d], dA[d], queues[d] );
+                    total -= count[d];
+                }
+                magma_zgetmatrix_2D_bcyclic( &descA, dA, hR, lda, queues );
+                magma_int_t pack_errors = (total != 0)
+                    + count_diff( ms, ns, hA + i0 + j0*lda, lda, hR + i0 + j0*lda, lda );
+                lapackf77_zlaset( "Full", &ms, &ns, &c_zero, &c_zero, hR + i0 + j0*lda, &lda );
+                pack_errors += (lapackf77_zlange( "M", &M, &N, hR, &lda, work ) != 0);
+
+                errors = index_errors + setget_errors + redist_errors + pack_errors;
+                status += (errors != 0);
+                printf("%5lld %5lld %5lld   %lld x %lld  -> %lld x %lld   %7.2f (%7.2f)   %5lld  %7lld  %6lld  %4lld   %s\n",
+                       (long long) M, (long long) N, (long long) nb,
+                       (long long) P, (long long) Q, (long long) P2, (long long) Q2,
+                       gbytes / redist_time, 1000.*redist_time,
+                       (long long) index_errors, (long long) setget_errors,
+                       (long long) redist_errors, (long long) pack_errors,
+                       (errors == 0 ? "ok" : "failed"));
+
+                for (d = 0; d < nprocs; ++d) {
+                    magma_setdevice( devices[ d % ndevices ] );
+                    magma_free( dA[d] );
+                    magma_free( dB[d] );
+                    magma_free( dbuf[d] );
+                    magma_queue_destroy( queues[d] );
+                }
+                magma_setdevice( devices[0] );
+            }
+
+            magma_free_cpu( hA );
+            magma_free_cpu( hR );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
@@ -0,0 +1,170 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> s d c
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing zgeqrf_tile
+   Time excludes conversion to and from tile-major layout.
+   Since Q differs from LAPACK's (see magma_zgeqrf_tile), this checks R,
+   which is unique up to signs, by |A^H*A - R^H*R|.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    const double             d_neg_one = MAGMA_D_NEG_ONE;
+    const double             d_one     = MAGMA_D_ONE;
+    const double             d_zero    = MAGMA_D_ZERO;
+    const magmaDoubleComplex c_zero    = MAGMA_Z_ZERO;
+
+    real_Double_t    gflops, gpu_perf, gpu_time, cpu_perf=0, cpu_time=0;
+    double           Anorm, error=0;
+    magmaDoubleComplex *h_A, *h_R, *h_T, *h_TT, *tau, *h_work, tmp[1], unused[1];
+    magma_int_t M, N, n2, lda, lwork, info, min_mn, nb, ntile;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    int status = 0;
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+
+    printf("%%   M     N    NB   CPU Gflop/s (sec)  Tile Gflop/s (sec)   |A^H*A - R^H*R|/(N*|A|^2)\n");
+    printf("%%========================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M = opts.msize[itest];
+            N = opts.nsize[itest];
+            min_mn = min(M, N);
+            lda    = M;
+            n2     = lda*N;
+            nb     = (opts.nb > 0 ? opts.nb : magma_get_zgeqrf_nb( M, N ));
+            ntile  = magma_roundup( M, nb )*magma_roundup( N, nb );
+            gflops = FLOPS_ZGEQRF( M, N ) / 1e9;
+
+            // query for workspace size
+            lwork = -1;
+            lapackf77_zgeqrf( &M, &N, unused, &M, unused, tmp, &lwork, &info );
+            lwork = (magma_int_t)MAGMA_Z_REAL( tmp[0] );
+
+            TESTING_CHECK( magma_zmalloc_cpu( &tau,    min_mn ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_A,    n2     ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_R,    n2     ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_T,    ntile  ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_TT,   ntile  ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_work, lwork  ));
+
+            /* Initialize the matrix */
+            magma_generate_matrix( opts, M, N, nullptr, h_A, lda );
+            magma_zge2tile( M, N, nb, h_A, lda, h_T );
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            gpu_time = magma_wtime();
+            magma_zgeqrf_tile( M, N, nb, h_T, h_TT, &info );
+            gpu_time = magma_wtime() - gpu_time;
+            gpu_perf = gflops / gpu_time;
+            if (info != 0) {
+                printf("magma_zgeqrf_tile returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+            magma_ztile2ge( M, N, nb, h_T, h_R, lda );
+
+            /* =====================================================================
+               Check the result: A^H*A = R^H*Q^H*Q*R = R^H*R.
+               This works for any M,N (square, tall, wide).
+               =================================================================== */
+            if ( opts.check ) {
+                magma_int_t ldr = min_mn;
+                magmaDoubleComplex *R, *G;
+                double *work;
+                TESTING_CHECK( magma_zmalloc_cpu( &R,    ldr*N ));  // K by N
+                TESTING_CHECK( magma_zmalloc_cpu( &G,    N*N   ));  // N by N
+                TESTING_CHECK( magma_dmalloc_cpu( &work, max( M, N ) ));
+
+                // copy K by N matrix R
+                lapackf77_zlaset( "Lower", &min_mn, &N, &c_zero, &c_zero, R, &ldr );
+                lapackf77_zlacpy( "Upper", &min_mn, &N, h_R, &lda,        R, &ldr );
+
+                // error = || A^H*A - R^H*R || / (N * ||A||^2)
+                blasf77_zherk( "Upper", "Conj", &N, &M,      &d_one,     h_A, &lda, &d_zero, G, &N );
+                blasf77_zherk( "Upper", "Conj", &N, &min_mn, &d_neg_one, R,   &ldr, &d_one, G, &N );
+                Anorm = lapackf77_zlange( "1", &M, &N, h_A, &lda, work );
+                error = safe_lapackf77_zlanhe( "1", "Upper", &N, G, &N, work );
+                if ( N > 0 && Anorm > 0 )
+                    error /= (N*Anorm*Anorm);
+
+                magma_free_cpu( R    );  R    = NULL;
+                magma_free_cpu( G    );  G    = NULL;
+                magma_free_cpu( work );  work = NULL;
+            }
+
+            /* =====================================================================
+               Performs operation using LAPACK
+               =================================================================== */
+            if ( opts.lapack ) {
+                cpu_time = magma_wtime();
+                lapackf77_zgeqrf( &M, &N, h_A, &lda, tau, h_work, &lwork, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_zgeqrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+            }
+
+            /* =====================================================================
+               Print performance and error.
+               =================================================================== */
+            printf("%5lld %5lld %5lld   ", (long long) M, (long long) N, (long long) nb );
+            if ( opts.lapack ) {
+                printf( "%7.2f (%7.2f)", cpu_perf, cpu_time );
+            }
+            else {
+                printf("  ---   (  ---  )" );
+            }
+            printf( "   %7.2f (%7.2f)   ", gpu_perf, gpu_time );
+            if ( opts.check ) {
+                bool okay = (error < tol);
+                status += ! okay;
+                printf( "%11.2e   %s\n", error, (okay ? "ok" : "failed") );
+            }
+            else {
+                printf( "    ---\n" );
+            }
+
+            magma_free_cpu( tau    );
+            magma_free_cpu( h_A    );
+            magma_free_cpu( h_R    );
+            magma_free_cpu( h_T    );
+            magma_free_cpu( h_TT   );
+            magma_free_cpu( h_work );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}
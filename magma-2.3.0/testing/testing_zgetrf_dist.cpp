@@ -0,0 +1,254 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> c d s
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "testings.h"
+
+#if defined(HAVE_MPI)
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Copies participant d's part of the global matrix hA to its local matrix
+   A (to_local), or back.
+*/
+static void copy_local(
+    const magma_bcyclic_t *desc, magma_int_t d, bool to_local,
+    magmaDoubleComplex *hA, magma_int_t lda, magmaDoubleComplex *A )
+{
+    magma_int_t mloc, nloc, i, j;
+    magma_bcyclic_local_size( desc, d, &mloc, &nloc );
+    for (magma_int_t jl = 0; jl < nloc; jl += desc->nb) {
+        for (magma_int_t il = 0; il < mloc; il += desc->mb) {
+            magma_int_t ib = min( desc->mb, mloc - il );
+            magma_int_t jb = min( desc->nb, nloc - jl );
+            magma_bcyclic_global_index( desc, d, il, jl, &i, &j );
+            if (to_local)
+                lapackf77_zlacpy( MagmaFullStr, &ib, &jb, hA + i + j*lda, &lda,
+                                  A + il + jl*desc->ldd, &desc->ldd );
+            else
+                lapackf77_zlacpy( MagmaFullStr, &ib, &jb, A + il + jl*desc->ldd, &desc->ldd,
+                                  hA + i + j*lda, &lda );
+        }
+    }
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Gathers the local matrices A of all ranks into hA on rank 0.
+*/
+static void gather_matrix(
+    const magma_bcyclic_t *desc, magmaDoubleComplex *A,
+    magmaDoubleComplex *hA, magma_int_t lda, int rank, int nprocs )
+{
+    magma_int_t mloc, nloc, size;
+    if (rank != 0) {
+        magma_bcyclic_local_size( desc, rank, &mloc, &nloc );
+        size = desc->ldd*nloc*sizeof(magmaDoubleComplex);
+        MPI_Send( A, int(size), MPI_BYTE, 0, 0, MPI_COMM_WORLD );
+        return;
+    }
+    copy_local( desc, 0, false, hA, lda, A );
+    for (int d = 1; d < nprocs; ++d) {
+        magmaDoubleComplex *B;
+        magma_bcyclic_local_size( desc, d, &mloc, &nloc );
+        TESTING_CHECK( magma_zmalloc_cpu( &B, desc->ldd*max(1,nloc) ));
+        size = desc->ldd*nloc*sizeof(magmaDoubleComplex);
+        MPI_Recv( B, int(size), MPI_BYTE, d, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE );
+        copy_local( desc, d, false, hA, lda, B );
+        magma_free_cpu( B );
+    }
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   Returns the error in the factorization LU and ipiv of A, |PA - LU| / (N |A|),
+   as get_LU_error in testing_zgetrf_gpu. A and LU are overwritten.
+*/
+static double get_LU_error(
+    magma_int_t M, magma_int_t N,
+    magmaDoubleComplex *A, magmaDoubleComplex *LU, magma_int_t lda,
+    magma_int_t *ipiv )
+{
+    const magmaDoubleComplex c_one     = MAGMA_Z_ONE;
+    const magmaDoubleComplex c_neg_one = MAGMA_Z_NEG_ONE;
+    const magmaDoubleComplex c_zero    = MAGMA_Z_ZERO;
+    const magma_int_t ione = 1;
+    magma_int_t min_mn = min( M, N );
+    magmaDoubleComplex *L, *U;
+    double work[1], matnorm, residual;
+
+    TESTING_CHECK( magma_zmalloc_cpu( &L, M*min_mn ));
+    TESTING_CHECK( magma_zmalloc_cpu( &U, min_mn*N ));
+    lapackf77_zlaset( MagmaFullStr, &M, &min_mn, &c_zero, &c_one, L, &M );
+    lapackf77_zlaset( MagmaFullStr, &min_mn, &N, &c_zero, &c_zero, U, &min_mn );
+
+    lapackf77_zlaswp( &N, A, &lda, &ione, &min_mn, ipiv, &ione );
+    magma_int_t M1 = M - 1;
+    lapackf77_zlacpy( MagmaLowerStr, &M1, &min_mn, LU + 1, &lda, L + 1, &M );
+    lapackf77_zlacpy( MagmaUpperStr, &min_mn, &N, LU, &lda, U, &min_mn );
+
+    matnorm = lapackf77_zlange( "f", &M, &N, A, &lda, work );
+    blasf77_zgemm( "N", "N", &M, &N, &min_mn,
+                   &c_one,     L, &M, U, &min_mn,
+                   &c_neg_one, A, &lda );
+    residual = lapackf77_zlange( "f", &M, &N, A, &lda, work );
+
+    magma_free_cpu( L );
+    magma_free_cpu( U );
+
+    return residual / (matnorm * N);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing zgetrf_dist
+   Run with several ranks, e.g., mpirun -np 4 ./testing_zgetrf_dist;
+   on one node, MPI's shared-memory transport stands in for the network.
+*/
+int main( int argc, char** argv)
+{
+    MPI_Init( &argc, &argv );
+    int rank, nprocs;
+    MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+    MPI_Comm_size( MPI_COMM_WORLD, &nprocs );
+
+    TESTING_CHECK( magma_init() );
+    if (rank == 0) {
+        magma_print_environment();
+    }
+
+    real_Double_t   gflops, dist_perf, dist_time, cpu_perf=0, cpu_time=0;
+    double          error;
+    magmaDoubleComplex *h_A, *h_R, *A;
+    magma_int_t     *ipiv;
+    magma_int_t M, N, n2, lda, nb, P, Q, mloc, nloc, info, min_mn;
+    magma_bcyclic_t desc;
+    int status = 0;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+
+    magma_bcyclic_grid( nprocs, &P, &Q );
+    if (rank == 0) {
+        printf("%% %lld x %lld grid of ranks\n", (long long) P, (long long) Q );
+        printf("%%   M     N   nb   CPU Gflop/s (sec)   MPI Gflop/s (sec)   |PA-LU|/(N*|A|)\n");
+        printf("%%========================================================================\n");
+    }
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            M = opts.msize[itest];
+            N = opts.nsize[itest];
+            min_mn = min( M, N );
+            nb     = (opts.nb > 0 ? opts.nb : magma_get_zgetrf_nb( M, N ));
+            lda    = M;
+            n2     = lda*N;
+            gflops = FLOPS_ZGETRF( M, N ) / 1e9;
+
+            TESTING_CHECK( magma_bcyclic_init( &desc, M, N, nb, nb, P, Q ));
+            magma_bcyclic_local_size( &desc, rank, &mloc, &nloc );
+
+            TESTING_CHECK( magma_imalloc_cpu( &ipiv, max(1,min_mn) ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_A,  n2 ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_R,  n2 ));
+            TESTING_CHECK( magma_zmalloc_cpu( &A, desc.ldd*max(1,nloc) ));
+
+            /* Initialize the matrix, the same on all ranks */
+            magma_generate_matrix( opts, M, N, nullptr, h_A, lda );
+            copy_local( &desc, rank, true, h_A, lda, A );
+
+            /* =====================================================================
+               Performs operation using LAPACK
+               =================================================================== */
+            if ( opts.lapack && rank == 0 ) {
+                lapackf77_zlacpy( MagmaFullStr, &M, &N, h_A, &lda, h_R, &lda );
+                cpu_time = magma_wtime();
+                lapackf77_zgetrf( &M, &N, h_R, &lda, ipiv, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_zgetrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+            }
+
+            /* ====================================================================
+               Performs operation using MAGMA over MPI
+               =================================================================== */
+            MPI_Barrier( MPI_COMM_WORLD );
+            dist_time = magma_wtime();
+            magma_zgetrf_dist( M, N, A, &desc, ipiv, MPI_COMM_WORLD, &info );
+            MPI_Barrier( MPI_COMM_WORLD );
+            dist_time = magma_wtime() - dist_time;
+            dist_perf = gflops / dist_time;
+            if (info != 0 && rank == 0) {
+                printf("magma_zgetrf_dist returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            if ( opts.check ) {
+                gather_matrix( &desc, A, h_R, lda, rank, nprocs );
+            }
+            if ( rank == 0 ) {
+                if ( opts.lapack ) {
+                    printf("%5lld %5lld %4lld   %7.2f (%7.2f)   %7.2f (%7.2f)",
+                           (long long) M, (long long) N, (long long) nb,
+                           cpu_perf, cpu_time, dist_perf, dist_time );
+                }
+                else {
+                    printf("%5lld %5lld %4lld     ---   (  ---  )   %7.2f (%7.2f)",
+                           (long long) M, (long long) N, (long long) nb,
+                           dist_perf, dist_time );
+                }
+                if ( opts.check ) {
+                    error = get_LU_error( M, N, h_A, h_R, lda, ipiv );
+                    printf("   %8.2e   %s\n", error, (error < tol ? "ok" : "failed"));
+                    status += ! (error < tol);
+                }
+                else {
+                    printf("     ---  \n");
+                }
+            }
+
+            magma_free_cpu( ipiv );
+            magma_free_cpu( h_A );
+            magma_free_cpu( h_R );
+            magma_free_cpu( A );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 && rank == 0 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    MPI_Bcast( &status, 1, MPI_INT, 0, MPI_COMM_WORLD );
+    MPI_Finalize();
+    return status;
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+    printf("%% testing_zgetrf_dist requires MAGMA built with -DHAVE_MPI; skipped.\n");
+    return 0;
+}
+
+#endif // HAVE_MPI
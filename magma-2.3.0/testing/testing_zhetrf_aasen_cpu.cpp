@@ -0,0 +1,255 @@
+/*
+    -- MAGMA (version 2.3.0) --
+       Univ. of Tennessee, Knoxville
+       Univ. of California, Berkeley
+       Univ. of Colorado, Denver
+       @date November 2017
+
+       @precisions normal z -> c d s
+*/
+// includes, system
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+// includes, project
+#include "flops.h"
+#include "magma_v2.h"
+#include "magma_lapack.h"
+#include "magma_operators.h"  // for MAGMA_Z_SUB
+#include "testings.h"
+
+
+/******************************************************************************/
+// On input, LT and ipiv are the Aasen factorization of the Hermitian A,
+// with uplo = MagmaLower.
+// Returns |P A P^H - L T L^H| / (N |A|).
+double get_LTLt_error(
+    magma_int_t N,
+    const magmaDoubleComplex *A, magma_int_t lda,
+    const magmaDoubleComplex *LT,
+    const magma_int_t *ipiv )
+{
+    const magmaDoubleComplex c_one  = MAGMA_Z_ONE;
+    const magmaDoubleComplex c_zero = MAGMA_Z_ZERO;
+    double work[1], matnorm, residual;
+    magmaDoubleComplex *PA, *L, *T, *LT2;
+
+    #define PA(i,j) (PA[(i) + (j)*N])
+    #define  L(i,j) ( L[(i) + (j)*N])
+    #define  T(i,j) ( T[(i) + (j)*N])
+    #define LT(i,j) (LT[(i) + (j)*lda])
+
+    TESTING_CHECK( magma_zmalloc_cpu( &PA,  N*N ));
+    TESTING_CHECK( magma_zmalloc_cpu( &L,   N*N ));
+    TESTING_CHECK( magma_zmalloc_cpu( &T,   N*N ));
+    TESTING_CHECK( magma_zmalloc_cpu( &LT2, N*N ));
+    memset( L, 0, N*N*sizeof(magmaDoubleComplex) );
+    memset( T, 0, N*N*sizeof(magmaDoubleComplex) );
+
+    magma_int_t i, j, piv;
+    magma_int_t nb = magma_get_zhetrf_aasen_nb( N );
+
+    // extract the band T, of bandwidth nb
+    for (i=0; i < N; i++) {
+        magma_int_t istart = max( 0, i-nb );
+        for (j=istart; j <= i; j++) {
+            T(i,j) = LT(i,j);
+        }
+        for (j=istart; j < i; j++) {
+            T(j,i) = MAGMA_Z_CONJ( LT(i,j) );
+        }
+    }
+    // extract L; its first nb columns are the identity
+    for (i=0; i < min( N, nb ); i++) {
+        L(i,i) = c_one;
+    }
+    for (i=nb; i < N; i++) {
+        for (j=0; j < i-nb; j++) {
+            L(i,nb+j) = LT(i,j);
+        }
+        L(i,i) = c_one;
+    }
+
+    // T = L T L^H
+    blasf77_zgemm( MagmaNoTransStr, MagmaNoTransStr, &N, &N, &N,
+                   &c_one, L, &N, T, &N, &c_zero, LT2, &N );
+    blasf77_zgemm( MagmaNoTransStr, MagmaConjTransStr, &N, &N, &N,
+                   &c_one, LT2, &N, L, &N, &c_zero, T, &N );
+
+    // full Hermitian A from its lower triangle, with real diagonal
+    matnorm = lapackf77_zlanhe( "Fro", MagmaLowerStr, &N, A, &lda, work );
+    for (j=0; j < N; j++) {
+        PA(j,j) = MAGMA_Z_MAKE( MAGMA_Z_REAL( A[j + j*lda] ), 0. );
+        for (i=j+1; i < N; i++) {
+            PA(i,j) = A[i + j*lda];
+            PA(j,i) = MAGMA_Z_CONJ( A[i + j*lda] );
+        }
+    }
+
+    // apply symmetric pivoting, P A P^H
+    for (j=0; j < N; j++) {
+        piv = ipiv[j]-1;
+        if (piv != j) {
+            blasf77_zswap( &N, &PA(j,0), &N, &PA(piv,0), &N );
+            magma_int_t ione = 1;
+            blasf77_zswap( &N, &PA(0,j), &ione, &PA(0,piv), &ione );
+        }
+    }
+
+    for (j=0; j < N; j++) {
+        for (i=0; i < N; i++) {
+            T(i,j) = MAGMA_Z_SUB( T(i,j), PA(i,j) );
+        }
+    }
+    residual = lapackf77_zlange( "Fro", &N, &N, T, &N, work );
+
+    #undef PA
+    #undef L
+    #undef T
+    #undef LT
+
+    magma_free_cpu( PA  );
+    magma_free_cpu( L   );
+    magma_free_cpu( T   );
+    magma_free_cpu( LT2 );
+
+    return residual / (matnorm * N);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////////////
+   -- Testing zhetrf_aasen_cpu and zhetrs_aasen_cpu
+   Only uplo = MagmaLower is implemented.
+*/
+int main( int argc, char** argv)
+{
+    TESTING_CHECK( magma_init() );
+    magma_print_environment();
+
+    magmaDoubleComplex *h_A, *h_LT, *h_B, *h_X, *work, temp;
+    real_Double_t   gflops, magma_perf, magma_time, cpu_perf=0, cpu_time=0;
+    double          fact_error, solve_error, Anorm, Xnorm, Rnorm, rwork[1];
+    magma_int_t     *ipiv;
+    magma_int_t     N, NRHS, lda, ldb, n2, lwork, info;
+    magma_int_t     ione     = 1;
+    magma_int_t     ISEED[4] = {0,0,0,1};
+    magmaDoubleComplex c_one     = MAGMA_Z_ONE;
+    magmaDoubleComplex c_neg_one = MAGMA_Z_NEG_ONE;
+    int status = 0;
+
+    magma_opts opts;
+    opts.parse_opts( argc, argv );
+
+    double tol = opts.tolerance * lapackf77_dlamch("E");
+    NRHS = opts.nrhs;
+
+    printf("%% uplo = %s\n", lapack_uplo_const( MagmaLower ));
+    printf("%%   N  NRHS   CPU Gflop/s (sec)   MAGMA Gflop/s (sec)   |PAP^H - LTL^H|/(N|A|)   |AX - B|/(N|A||X|)\n");
+    printf("%%===============================================================================================\n");
+    for( int itest = 0; itest < opts.ntest; ++itest ) {
+        for( int iter = 0; iter < opts.niter; ++iter ) {
+            N   = opts.nsize[itest];
+            lda = max( 1, N );
+            ldb = lda;
+            n2  = lda*N;
+            gflops = FLOPS_ZPOTRF( N ) / 1e9;
+
+            TESTING_CHECK( magma_imalloc_cpu( &ipiv, max( 1, N ) ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_A,  n2        ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_LT, n2        ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_B,  ldb*NRHS  ));
+            TESTING_CHECK( magma_zmalloc_cpu( &h_X,  ldb*NRHS  ));
+
+            /* Initialize the matrix; only its lower triangle is referenced */
+            magma_generate_matrix( opts, N, N, nullptr, h_A, lda );
+
+            /* =====================================================================
+               Performs operation using LAPACK, Bunch-Kaufman zhetrf for timing
+               =================================================================== */
+            if ( opts.lapack ) {
+                lwork = -1;
+                lapackf77_zhetrf( MagmaLowerStr, &N, h_LT, &lda, ipiv, &temp, &lwork, &info );
+                lwork = (magma_int_t) MAGMA_Z_REAL( temp );
+                TESTING_CHECK( magma_zmalloc_cpu( &work, max( 1, lwork ) ));
+                lapackf77_zlacpy( MagmaFullStr, &N, &N, h_A, &lda, h_LT, &lda );
+
+                cpu_time = magma_wtime();
+                lapackf77_zhetrf( MagmaLowerStr, &N, h_LT, &lda, ipiv, work, &lwork, &info );
+                cpu_time = magma_wtime() - cpu_time;
+                cpu_perf = gflops / cpu_time;
+                if (info != 0) {
+                    printf("lapackf77_zhetrf returned error %lld: %s.\n",
+                           (long long) info, magma_strerror( info ));
+                }
+                magma_free_cpu( work );
+            }
+
+            /* ====================================================================
+               Performs operation using MAGMA
+               =================================================================== */
+            lapackf77_zlacpy( MagmaFullStr, &N, &N, h_A, &lda, h_LT, &lda );
+            magma_time = magma_wtime();
+            magma_zhetrf_aasen_cpu( MagmaLower, N, h_LT, lda, ipiv, &info );
+            magma_time = magma_wtime() - magma_time;
+            magma_perf = gflops / magma_time;
+            if (info != 0) {
+                printf("magma_zhetrf_aasen_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            /* =====================================================================
+               Check the factorization, then solve with it
+               =================================================================== */
+            fact_error = get_LTLt_error( N, h_A, lda, h_LT, ipiv );
+
+            magma_int_t sizeB = ldb*NRHS;
+            lapackf77_zlarnv( &ione, ISEED, &sizeB, h_B );
+            lapackf77_zlacpy( MagmaFullStr, &N, &NRHS, h_B, &ldb, h_X, &ldb );
+            magma_zhetrs_aasen_cpu( MagmaLower, N, NRHS, h_LT, lda, ipiv, h_X, ldb, &info );
+            if (info != 0) {
+                printf("magma_zhetrs_aasen_cpu returned error %lld: %s.\n",
+                       (long long) info, magma_strerror( info ));
+            }
+
+            // |A X - B| / (N |A| |X|)
+            Anorm = lapackf77_zlanhe( "Fro", MagmaLowerStr, &N, h_A, &lda, rwork );
+            Xnorm = lapackf77_zlange( "Fro", &N, &NRHS, h_X, &ldb, rwork );
+            blasf77_zhemm( MagmaLeftStr, MagmaLowerStr, &N, &NRHS,
+                           &c_one,     h_A, &lda, h_X, &ldb,
+                           &c_neg_one, h_B, &ldb );
+            Rnorm = lapackf77_zlange( "Fro", &N, &NRHS, h_B, &ldb, rwork );
+            solve_error = Rnorm / (N*Anorm*Xnorm);
+
+            bool okay = (fact_error < tol && solve_error < tol);
+            status += ! okay;
+            if ( opts.lapack ) {
+                printf("%5lld %5lld   %7.2f (%7.4f)   %7.2f (%7.4f)     %8.2e                 %8.2e   %s\n",
+                       (long long) N, (long long) NRHS,
+                       cpu_perf, cpu_time, magma_perf, magma_time,
+                       fact_error, solve_error, (okay ? "ok" : "failed"));
+            }
+            else {
+                printf("%5lld %5lld     ---   (  ---  )   %7.2f (%7.4f)     %8.2e                 %8.2e   %s\n",
+                       (long long) N, (long long) NRHS,
+                       magma_perf, magma_time,
+                       fact_error, solve_error, (okay ? "ok" : "failed"));
+            }
+
+            magma_free_cpu( ipiv );
+            magma_free_cpu( h_A  );
+            magma_free_cpu( h_LT );
+            magma_free_cpu( h_B  );
+            magma_free_cpu( h_X  );
+            fflush( stdout );
+        }
+        if ( opts.niter > 1 ) {
+            printf( "\n" );
+        }
+    }
+
+    opts.cleanup();
+    TESTING_CHECK( magma_finalize() );
+    return status;
+}